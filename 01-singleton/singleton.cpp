@@ -2,27 +2,137 @@
 // Used for managing a global simulation environment in HPC applications
 #include <iostream>
 #include <memory>
-#include <mutex>
 #include <vector>
 #include <cmath>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstddef>
+
+// Counter split into cache-line-sized shards. Each thread adds to its own
+// shard, so concurrent writers never share a cache line; reads sum all
+// shards and see every add that happened before them.
+template <typename T>
+class ShardedCounter {
+private:
+    static constexpr size_t kShards = 64;
+
+    struct alignas(64) Shard {
+        std::atomic<T> value{T()};
+    };
+    Shard shards_[kShards];
+
+    static size_t shardIndex() {
+        static std::atomic<size_t> nextThread{0};
+        thread_local size_t index = nextThread.fetch_add(1, std::memory_order_relaxed) % kShards;
+        return index;
+    }
+
+public:
+    void add(T delta) {
+        // Uncontended unless more than kShards threads write
+        std::atomic<T>& value = shards_[shardIndex()].value;
+        T current = value.load(std::memory_order_relaxed);
+        while (!value.compare_exchange_weak(current, current + delta, std::memory_order_relaxed)) {}
+    }
+
+    T load() const {
+        T sum = T();
+        for (const Shard& shard : shards_) sum += shard.value.load(std::memory_order_relaxed);
+        return sum;
+    }
+};
+
+// Append-only log of doubles. Writers claim a slot with one fetch_add and
+// publish it with a release store; segments double in size and are never
+// moved, so readers can snapshot the published prefix without taking a lock
+// and without blocking writers.
+class AppendOnlyLog {
+private:
+    static constexpr size_t kFirstSegment = 1024;
+    static constexpr size_t kMaxSegments = 40;   // kFirstSegment * 2^40 entries
+
+    struct Entry {
+        std::atomic<bool> ready{false};
+        double value = 0.0;
+    };
+
+    std::atomic<Entry*> segments_[kMaxSegments];
+    std::atomic<size_t> reserved_{0};
+
+    // Segment s holds entries [kFirstSegment * (2^s - 1), kFirstSegment * (2^(s+1) - 1))
+    static size_t segmentOf(size_t index, size_t& offset) {
+        size_t scaled = index / kFirstSegment + 1;
+        size_t segment = 0;
+        while (scaled >>= 1) ++segment;
+        offset = index - kFirstSegment * ((size_t(1) << segment) - 1);
+        return segment;
+    }
+
+    Entry* segment(size_t s) {
+        Entry* entries = segments_[s].load(std::memory_order_acquire);
+        if (entries) return entries;
+        // Racing writers may both allocate; the loser frees its copy
+        Entry* fresh = new Entry[kFirstSegment << s];
+        if (segments_[s].compare_exchange_strong(entries, fresh, std::memory_order_acq_rel)) {
+            return fresh;
+        }
+        delete[] fresh;
+        return entries;
+    }
+
+public:
+    AppendOnlyLog() {
+        for (auto& s : segments_) s.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~AppendOnlyLog() {
+        for (auto& s : segments_) delete[] s.load(std::memory_order_relaxed);
+    }
+
+    AppendOnlyLog(const AppendOnlyLog&) = delete;
+    AppendOnlyLog& operator=(const AppendOnlyLog&) = delete;
+
+    void append(double value) {
+        size_t offset;
+        size_t s = segmentOf(reserved_.fetch_add(1, std::memory_order_relaxed), offset);
+        Entry& entry = segment(s)[offset];
+        entry.value = value;
+        entry.ready.store(true, std::memory_order_release);
+    }
+
+    // Entries appended so far, including ones still being written
+    size_t size() const { return reserved_.load(std::memory_order_relaxed); }
+
+    // Copy of the published prefix; stops at the first slot still being written
+    std::vector<double> snapshot() const {
+        size_t count = reserved_.load(std::memory_order_acquire);
+        std::vector<double> values;
+        values.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            size_t offset;
+            size_t s = segmentOf(i, offset);
+            const Entry* entries = segments_[s].load(std::memory_order_acquire);
+            if (!entries || !entries[offset].ready.load(std::memory_order_acquire)) break;
+            values.push_back(entries[offset].value);
+        }
+        return values;
+    }
+};
 
 class SimulationEnvironment {
 private:
-    static std::unique_ptr<SimulationEnvironment> instance;
-    static std::mutex mutex;
-    
     // Simulation parameters
-    double timeStep = 1e-6;  // Time step in seconds
-    double totalEnergy = 0.0;
-    int particleCount = 0;
-    std::vector<double> fieldStrengths;
+    std::atomic<double> timeStep{1e-6};  // Time step in seconds
+    ShardedCounter<double> totalEnergy;
+    ShardedCounter<long long> particleCount;
+    AppendOnlyLog fieldStrengths;
     
     // Private constructor prevents direct instantiation
     SimulationEnvironment() {
         std::cout << "Initializing global simulation environment...\n";
         std::cout << "Setting up MPI communication channels...\n";
         std::cout << "Allocating GPU resources...\n";
-        fieldStrengths.reserve(1000);
     }
     
 public:
@@ -30,43 +140,47 @@ public:
     SimulationEnvironment(const SimulationEnvironment&) = delete;
     SimulationEnvironment& operator=(const SimulationEnvironment&) = delete;
     
-    // Thread-safe instance getter for HPC environments
+    // Thread-safe instance getter for HPC environments. A function-local
+    // static is initialized exactly once (C++11 guarantees it), after which
+    // each call is a plain load with no lock.
     static SimulationEnvironment* getInstance() {
-        std::lock_guard<std::mutex> lock(mutex);
-        if (!instance) {
-            instance.reset(new SimulationEnvironment());
-        }
-        return instance.get();
+        static SimulationEnvironment instance;
+        return &instance;
     }
     
     // Simulation control methods
     void setTimeStep(double dt) {
-        timeStep = dt;
+        timeStep.store(dt, std::memory_order_relaxed);
         std::cout << "Time step updated to: " << dt << " seconds\n";
     }
     
+    // Silent variant for worker threads
+    void recordFieldStrength(double strength) {
+        fieldStrengths.append(strength);
+        totalEnergy.add(strength * strength);
+    }
+
     void updateFieldStrength(double strength) {
-        fieldStrengths.push_back(strength);
-        totalEnergy += strength * strength;
+        recordFieldStrength(strength);
         std::cout << "Field strength recorded: " << strength << " Tesla\n";
     }
     
     void runDiagnostics() {
         std::cout << "\n=== Simulation Diagnostics ===\n";
-        std::cout << "Total energy: " << totalEnergy << " Joules\n";
-        std::cout << "Particle count: " << particleCount << "\n";
+        std::cout << "Total energy: " << totalEnergy.load() << " Joules\n";
+        std::cout << "Particle count: " << particleCount.load() << "\n";
         std::cout << "Field measurements: " << fieldStrengths.size() << "\n";
-        std::cout << "Time step: " << timeStep << " seconds\n";
+        std::cout << "Time step: " << timeStep.load(std::memory_order_relaxed) << " seconds\n";
     }
     
     void incrementParticles(int count) {
-        particleCount += count;
+        particleCount.add(count);
     }
-};
 
-// Static member initialization
-std::unique_ptr<SimulationEnvironment> SimulationEnvironment::instance = nullptr;
-std::mutex SimulationEnvironment::mutex;
+    long long getParticleCount() const { return particleCount.load(); }
+    double getTotalEnergy() const { return totalEnergy.load(); }
+    std::vector<double> snapshotFieldStrengths() const { return fieldStrengths.snapshot(); }
+};
 
 int main() {
     std::cout << "=== Particle Physics Simulation Control ===\n\n";
@@ -86,5 +200,51 @@ int main() {
     // Run diagnostics
     env1->runDiagnostics();
     
+    // Parallel particle injectors hammer the shared environment while a
+    // monitor thread takes snapshots of the field log
+    std::cout << "\n=== Parallel Particle Injection ===\n";
+    const int injectors = std::max(2u, std::thread::hardware_concurrency());
+    const int injectionsPerThread = 1000000;
+    const int fieldSamplesPerThread = 10000;
+    long long particlesBefore = env1->getParticleCount();
+
+    std::atomic<bool> injecting{true};
+    size_t snapshots = 0, largestSnapshot = 0;
+    std::thread monitor([&] {
+        while (injecting.load()) {
+            largestSnapshot = std::max(largestSnapshot, env1->snapshotFieldStrengths().size());
+            ++snapshots;
+        }
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < injectors; ++t) {
+        workers.emplace_back([=] {
+            for (int i = 0; i < injectionsPerThread; ++i) {
+                SimulationEnvironment::getInstance()->incrementParticles(1);
+                if (i % (injectionsPerThread / fieldSamplesPerThread) == 0) {
+                    SimulationEnvironment::getInstance()->recordFieldStrength(1.0 + 0.001 * t);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    auto end = std::chrono::steady_clock::now();
+    injecting.store(false);
+    monitor.join();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    long long injected = env1->getParticleCount() - particlesBefore;
+    std::cout << injectors << " injector threads, " << injected << " particles in "
+              << seconds * 1e3 << " ms (" << injected / seconds / 1e6 << " M increments/s)\n";
+    std::cout << "Expected " << static_cast<long long>(injectors) * injectionsPerThread
+              << " particles: " << (injected == static_cast<long long>(injectors) * injectionsPerThread ? "match" : "MISMATCH") << "\n";
+    std::cout << "Monitor took " << snapshots << " lock-free snapshots (largest "
+              << largestSnapshot << " entries)\n";
+    std::cout << "Final field log: " << env1->snapshotFieldStrengths().size() << " entries\n";
+
+    env1->runDiagnostics();
+
     return 0;
-}
\ No newline at end of file
+}
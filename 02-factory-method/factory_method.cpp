@@ -5,136 +5,421 @@
 #include <vector>
 #include <cmath>
 #include <string>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 
 // Abstract numerical solver interface
 class NumericalSolver {
+protected:
+    bool verbose = true;
+    double result = 0.0;
+
 public:
     virtual ~NumericalSolver() = default;
     virtual void solve(const std::vector<double>& initialConditions) = 0;
     virtual std::string getMethod() const = 0;
     virtual double getAccuracy() const = 0;
+
+    // Scalar summary of the last solve, for ensemble statistics
+    double getResult() const { return result; }
+    void setVerbose(bool enabled) { verbose = enabled; }
+
+    // Called when a pooled solver is returned. Workspaces keep their
+    // capacity, so the next solve of the same size allocates nothing.
+    virtual void reset() {
+        verbose = true;
+        result = 0.0;
+    }
 };
 
 // Finite Element Method (FEM) Solver
-class FEMSolver : public NumericalSolver {
+// Steady 1D heat conduction with linear elements on [0, 1]; the first and
+// last initial temperatures are the Dirichlet boundary values
+class FEMSolver final : public NumericalSolver {
 private:
     int meshElements = 1000;
     double tolerance = 1e-6;
-    
+
+    // Tridiagonal system workspace, reused across solves
+    std::vector<double> lower, diag, upper, rhs, temperature;
+
 public:
     void solve(const std::vector<double>& initialConditions) override {
-        std::cout << "Solving using Finite Element Method\n";
-        std::cout << "Mesh elements: " << meshElements << "\n";
-        std::cout << "Initial temperature field: ";
-        for (size_t i = 0; i < std::min(size_t(3), initialConditions.size()); ++i) {
-            std::cout << initialConditions[i] << " K ";
-        }
-        std::cout << "...\n";
-        std::cout << "Assembling stiffness matrix...\n";
-        std::cout << "Applying boundary conditions...\n";
-        std::cout << "Solving linear system with tolerance " << tolerance << "\n";
-    }
-    
+        if (initialConditions.empty()) {
+            throw std::invalid_argument("FEM solve needs boundary temperatures");
+        }
+        if (verbose) {
+            std::cout << "Solving using Finite Element Method\n";
+            std::cout << "Mesh elements: " << meshElements << "\n";
+            std::cout << "Initial temperature field: ";
+            for (size_t i = 0; i < std::min(size_t(3), initialConditions.size()); ++i) {
+                std::cout << initialConditions[i] << " K ";
+            }
+            std::cout << "...\n";
+            std::cout << "Assembling stiffness matrix...\n";
+        }
+
+        const size_t n = meshElements + 1;
+        const double h = 1.0 / meshElements;
+        lower.assign(n, -1.0 / h);
+        diag.assign(n, 2.0 / h);
+        upper.assign(n, -1.0 / h);
+        rhs.assign(n, 0.0);
+        temperature.resize(n);
+
+        if (verbose) std::cout << "Applying boundary conditions...\n";
+        diag[0] = diag[n - 1] = 1.0;
+        upper[0] = lower[n - 1] = 0.0;
+        rhs[0] = initialConditions.front();
+        rhs[n - 1] = initialConditions.back();
+
+        if (verbose) std::cout << "Solving linear system with tolerance " << tolerance << "\n";
+        // Thomas algorithm (forward sweep overwrites diag and rhs)
+        for (size_t i = 1; i < n; ++i) {
+            double m = lower[i] / diag[i - 1];
+            diag[i] -= m * upper[i - 1];
+            rhs[i] -= m * rhs[i - 1];
+        }
+        temperature[n - 1] = rhs[n - 1] / diag[n - 1];
+        for (size_t i = n - 1; i-- > 0;) {
+            temperature[i] = (rhs[i] - upper[i] * temperature[i + 1]) / diag[i];
+        }
+
+        double mean = 0.0;
+        for (double t : temperature) mean += t;
+        result = mean / n;
+        if (verbose) std::cout << "Mean temperature: " << result << " K\n";
+    }
+
     std::string getMethod() const override {
         return "Galerkin Finite Element Method";
     }
-    
+
     double getAccuracy() const override {
         return tolerance;
     }
 };
 
 // Runge-Kutta ODE Solver
-class RungeKuttaSolver : public NumericalSolver {
+// Planar gravitational N-body problem (G = 1, unit masses); the state is
+// x, y, vx, vy per body
+class RungeKuttaSolver final : public NumericalSolver {
 private:
     int order = 4;
     double timeStep = 0.001;
-    
+    int steps = 100;
+
+    // Stage workspace, reused across solves
+    std::vector<double> state, stage, k1, k2, k3, k4;
+
+    static void derivative(const std::vector<double>& s, std::vector<double>& ds) {
+        const size_t bodies = s.size() / 4;
+        const double softening = 1e-6;
+        for (size_t i = 0; i < bodies; ++i) {
+            ds[4 * i] = s[4 * i + 2];
+            ds[4 * i + 1] = s[4 * i + 3];
+            ds[4 * i + 2] = ds[4 * i + 3] = 0.0;
+        }
+        for (size_t i = 0; i < bodies; ++i) {
+            for (size_t j = i + 1; j < bodies; ++j) {
+                double dx = s[4 * j] - s[4 * i], dy = s[4 * j + 1] - s[4 * i + 1];
+                double r2 = dx * dx + dy * dy + softening;
+                double inv = 1.0 / (r2 * std::sqrt(r2));
+                ds[4 * i + 2] += dx * inv;
+                ds[4 * i + 3] += dy * inv;
+                ds[4 * j + 2] -= dx * inv;
+                ds[4 * j + 3] -= dy * inv;
+            }
+        }
+    }
+
+    static double energy(const std::vector<double>& s) {
+        const size_t bodies = s.size() / 4;
+        double e = 0.0;
+        for (size_t i = 0; i < bodies; ++i) {
+            e += 0.5 * (s[4 * i + 2] * s[4 * i + 2] + s[4 * i + 3] * s[4 * i + 3]);
+            for (size_t j = i + 1; j < bodies; ++j) {
+                double dx = s[4 * j] - s[4 * i], dy = s[4 * j + 1] - s[4 * i + 1];
+                e -= 1.0 / std::sqrt(dx * dx + dy * dy + 1e-6);
+            }
+        }
+        return e;
+    }
+
 public:
     void solve(const std::vector<double>& initialConditions) override {
-        std::cout << "Solving using Runge-Kutta Method (RK" << order << ")\n";
-        std::cout << "Time step: " << timeStep << " seconds\n";
-        std::cout << "Initial state vector: ";
-        for (size_t i = 0; i < std::min(size_t(3), initialConditions.size()); ++i) {
-            std::cout << initialConditions[i] << " ";
+        if (verbose) {
+            std::cout << "Solving using Runge-Kutta Method (RK" << order << ")\n";
+            std::cout << "Time step: " << timeStep << " seconds\n";
+            std::cout << "Initial state vector: ";
+            for (size_t i = 0; i < std::min(size_t(3), initialConditions.size()); ++i) {
+                std::cout << initialConditions[i] << " ";
+            }
+            std::cout << "...\n";
+            std::cout << "Computing k1, k2, k3, k4 coefficients...\n";
+        }
+
+        const size_t n = initialConditions.size() / 4 * 4;
+        state.assign(initialConditions.begin(), initialConditions.begin() + n);
+        stage.resize(n);
+        k1.resize(n);
+        k2.resize(n);
+        k3.resize(n);
+        k4.resize(n);
+        const double initialEnergy = energy(state);
+
+        if (verbose) std::cout << "Advancing solution in time...\n";
+        const double dt = timeStep;
+        for (int step = 0; step < steps; ++step) {
+            derivative(state, k1);
+            for (size_t i = 0; i < n; ++i) stage[i] = state[i] + 0.5 * dt * k1[i];
+            derivative(stage, k2);
+            for (size_t i = 0; i < n; ++i) stage[i] = state[i] + 0.5 * dt * k2[i];
+            derivative(stage, k3);
+            for (size_t i = 0; i < n; ++i) stage[i] = state[i] + dt * k3[i];
+            derivative(stage, k4);
+            for (size_t i = 0; i < n; ++i) {
+                state[i] += dt / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+            }
+        }
+
+        result = energy(state);
+        if (verbose) {
+            std::cout << "Energy after " << steps << " steps: " << result
+                      << " (drift " << std::abs(result - initialEnergy) << ")\n";
         }
-        std::cout << "...\n";
-        std::cout << "Computing k1, k2, k3, k4 coefficients...\n";
-        std::cout << "Advancing solution in time...\n";
     }
-    
+
     std::string getMethod() const override {
         return "4th Order Runge-Kutta";
     }
-    
+
     double getAccuracy() const override {
         return std::pow(timeStep, order);
     }
 };
 
 // Spectral Method Solver for Fluid Dynamics
-class SpectralSolver : public NumericalSolver {
+// Viscous decay of a periodic 1D vorticity field: the samples are
+// transformed to Fourier space, each mode decays as exp(-ν k² t), and the
+// field is evaluated on a fourierModes-point grid
+class SpectralSolver final : public NumericalSolver {
 private:
     int fourierModes = 256;
-    
+    double viscosity = 1e-3;
+    double endTime = 1.0;
+
+    // Spectral workspace, reused across solves
+    std::vector<double> re, im, field;
+
 public:
     void solve(const std::vector<double>& initialConditions) override {
-        std::cout << "Solving using Spectral Method\n";
-        std::cout << "Fourier modes: " << fourierModes << "\n";
-        std::cout << "Initial vorticity distribution: ";
-        for (size_t i = 0; i < std::min(size_t(3), initialConditions.size()); ++i) {
-            std::cout << initialConditions[i] << " ";
-        }
-        std::cout << "...\n";
-        std::cout << "Performing FFT...\n";
-        std::cout << "Computing nonlinear terms in spectral space...\n";
-        std::cout << "Time-stepping with exponential integrator...\n";
-    }
-    
+        if (verbose) {
+            std::cout << "Solving using Spectral Method\n";
+            std::cout << "Fourier modes: " << fourierModes << "\n";
+            std::cout << "Initial vorticity distribution: ";
+            for (size_t i = 0; i < std::min(size_t(3), initialConditions.size()); ++i) {
+                std::cout << initialConditions[i] << " ";
+            }
+            std::cout << "...\n";
+            std::cout << "Performing direct discrete Fourier transform...\n";
+        }
+
+        const size_t m = initialConditions.size();
+        const double twoPi = 2.0 * std::acos(-1.0);
+        re.assign(m, 0.0);
+        im.assign(m, 0.0);
+        for (size_t k = 0; k < m; ++k) {
+            for (size_t j = 0; j < m; ++j) {
+                double phase = -twoPi * k * j / m;
+                re[k] += initialConditions[j] * std::cos(phase) / m;
+                im[k] += initialConditions[j] * std::sin(phase) / m;
+            }
+        }
+
+        if (verbose) std::cout << "Time-stepping with exponential integrator...\n";
+        for (size_t k = 0; k < m; ++k) {
+            double wave = twoPi * (k <= m / 2 ? double(k) : double(k) - double(m));
+            double decay = std::exp(-viscosity * wave * wave * endTime);
+            re[k] *= decay;
+            im[k] *= decay;
+        }
+
+        field.assign(fourierModes, 0.0);
+        double enstrophy = 0.0;
+        for (int x = 0; x < fourierModes; ++x) {
+            double position = double(x) / fourierModes;
+            double value = 0.0;
+            for (size_t k = 0; k < m; ++k) {
+                double wave = twoPi * (k <= m / 2 ? double(k) : double(k) - double(m));
+                value += re[k] * std::cos(wave * position) - im[k] * std::sin(wave * position);
+            }
+            field[x] = value;
+            enstrophy += value * value;
+        }
+
+        result = 0.5 * enstrophy / fourierModes;
+        if (verbose) std::cout << "Enstrophy at t = " << endTime << ": " << result << "\n";
+    }
+
     std::string getMethod() const override {
-        return "Pseudo-spectral Method with FFT";
+        return "Fourier Spectral Method (direct DFT)";
     }
-    
+
     double getAccuracy() const override {
         return std::exp(-fourierModes / 10.0);  // Exponential convergence
     }
 };
 
+// Trimmed copy of pattern 25's ObjectPool: the same acquire()/Handle/reset
+// contract, with a mutex-guarded free list in place of the sharded lock-free
+// one. release() is public so an object taken out of a Handle can be
+// returned through a plain function pointer (see SolverDeleter).
+template<typename T>
+class ObjectPool {
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<std::unique_ptr<T>> objects_;
+    std::vector<T*> available_;
+    size_t maxSize_;
+    size_t acquires_ = 0;
+    std::function<std::unique_ptr<T>()> factory_;
+    std::function<void(T*)> reset_;
+
+public:
+    using Handle = std::unique_ptr<T, std::function<void(T*)>>;
+
+    ObjectPool(size_t maxSize,
+               std::function<std::unique_ptr<T>()> factory,
+               std::function<void(T*)> reset = [](T* obj) { obj->reset(); })
+        : maxSize_(maxSize), factory_(factory), reset_(reset) {}
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    Handle acquire() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (available_.empty() && objects_.size() < maxSize_) {
+            objects_.push_back(factory_());
+            available_.push_back(objects_.back().get());
+        }
+        condition_.wait(lock, [this] { return !available_.empty(); });
+        T* object = available_.back();
+        available_.pop_back();
+        acquires_++;
+        return Handle(object, [this](T* obj) { this->release(obj); });
+    }
+
+    void release(T* object) {
+        reset_(object);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            available_.push_back(object);
+        }
+        condition_.notify_one();
+    }
+
+    size_t totalCount() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return objects_.size();
+    }
+
+    size_t acquireCount() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return acquires_;
+    }
+};
+
+// One pool per concrete solver type, sized for one solver per thread with headroom
+template <typename Solver>
+ObjectPool<Solver>& solverPool() {
+    static ObjectPool<Solver> pool(4 * std::max(1u, std::thread::hardware_concurrency()),
+                                   [] { return std::unique_ptr<Solver>(new Solver()); });
+    return pool;
+}
+
+// Returns a solver to its pool, or deletes it when it was created fresh.
+// A function pointer keeps the handle free of std::function allocations.
+struct SolverDeleter {
+    void (*recycle)(NumericalSolver*) = nullptr;
+
+    void operator()(NumericalSolver* solver) const {
+        if (recycle) recycle(solver);
+        else delete solver;
+    }
+};
+
+using SolverHandle = std::unique_ptr<NumericalSolver, SolverDeleter>;
+
+enum class SolverAllocation { Fresh, Pooled };
+
 // Abstract simulation framework
 class SimulationFramework {
 protected:
     std::string problemType;
     std::vector<double> problemData;
-    
+    SolverAllocation allocation = SolverAllocation::Fresh;
+    bool verbose = true;
+
+    // Shared by every createSolver() override: a new solver, or one recycled
+    // (with its workspace) from the pool for Solver
+    template <typename Solver>
+    SolverHandle makeSolver() const {
+        if (allocation == SolverAllocation::Fresh) {
+            return SolverHandle(new Solver(), SolverDeleter());
+        }
+        SolverDeleter deleter;
+        deleter.recycle = [](NumericalSolver* solver) {
+            solverPool<Solver>().release(static_cast<Solver*>(solver));
+        };
+        return SolverHandle(solverPool<Solver>().acquire().release(), deleter);
+    }
+
 public:
     virtual ~SimulationFramework() = default;
-    
+
     // Factory method for creating appropriate solver
-    virtual std::unique_ptr<NumericalSolver> createSolver() = 0;
-    
-    // Template method for running simulation
-    void runSimulation() {
-        std::cout << "\n=== " << problemType << " Simulation ===\n";
-        
+    virtual SolverHandle createSolver() = 0;
+
+    // Template method for running simulation; returns the solver's result
+    double runSimulation() {
+        if (verbose) std::cout << "\n=== " << problemType << " Simulation ===\n";
+
         // Create appropriate solver
         auto solver = createSolver();
-        
-        std::cout << "Selected solver: " << solver->getMethod() << "\n";
-        std::cout << "Expected accuracy: " << solver->getAccuracy() << "\n\n";
-        
-        // Prepare initial conditions
-        std::cout << "Preparing initial conditions...\n";
-        
+        solver->setVerbose(verbose);
+
+        if (verbose) {
+            std::cout << "Selected solver: " << solver->getMethod() << "\n";
+            std::cout << "Expected accuracy: " << solver->getAccuracy() << "\n\n";
+
+            // Prepare initial conditions
+            std::cout << "Preparing initial conditions...\n";
+        }
+
         // Solve the problem
         solver->solve(problemData);
-        
-        std::cout << "\nPost-processing results...\n";
-        std::cout << "Simulation complete.\n";
+
+        if (verbose) {
+            std::cout << "\nPost-processing results...\n";
+            std::cout << "Simulation complete.\n";
+        }
+        return solver->getResult();
     }
-    
+
     void setProblemData(const std::vector<double>& data) {
         problemData = data;
     }
+
+    void setSolverAllocation(SolverAllocation mode) { allocation = mode; }
+    void setVerbose(bool enabled) { verbose = enabled; }
 };
 
 // Heat Transfer Simulation (uses FEM)
@@ -143,9 +428,9 @@ public:
     HeatTransferSimulation() {
         problemType = "Heat Transfer";
     }
-    
-    std::unique_ptr<NumericalSolver> createSolver() override {
-        return std::make_unique<FEMSolver>();
+
+    SolverHandle createSolver() override {
+        return makeSolver<FEMSolver>();
     }
 };
 
@@ -155,9 +440,9 @@ public:
     OrbitalMechanicsSimulation() {
         problemType = "Orbital Mechanics";
     }
-    
-    std::unique_ptr<NumericalSolver> createSolver() override {
-        return std::make_unique<RungeKuttaSolver>();
+
+    SolverHandle createSolver() override {
+        return makeSolver<RungeKuttaSolver>();
     }
 };
 
@@ -167,22 +452,77 @@ public:
     TurbulentFlowSimulation() {
         problemType = "Turbulent Flow";
     }
-    
-    std::unique_ptr<NumericalSolver> createSolver() override {
-        return std::make_unique<SpectralSolver>();
+
+    SolverHandle createSolver() override {
+        return makeSolver<SpectralSolver>();
     }
 };
 
+// Compile-time solver registry
+//
+// The same problem -> solver mapping as the createSolver() overrides, as
+// constexpr data. Code that knows its problem class at compile time gets the
+// concrete (final) solver type directly: no virtual factory hop and no
+// virtual solve(). A runtime choice is turned into a compile-time one by a
+// single switch in dispatchProblem().
+enum class ProblemClass { HeatTransfer, OrbitalMechanics, TurbulentFlow };
+enum class SolverKind { FiniteElement, RungeKutta, Spectral };
+
+constexpr SolverKind solverFor(ProblemClass problem) {
+    return problem == ProblemClass::HeatTransfer ? SolverKind::FiniteElement
+         : problem == ProblemClass::OrbitalMechanics ? SolverKind::RungeKutta
+         : SolverKind::Spectral;
+}
+
+template <SolverKind Kind> struct SolverRegistry;
+template <> struct SolverRegistry<SolverKind::FiniteElement> { using Solver = FEMSolver; };
+template <> struct SolverRegistry<SolverKind::RungeKutta> { using Solver = RungeKuttaSolver; };
+template <> struct SolverRegistry<SolverKind::Spectral> { using Solver = SpectralSolver; };
+
+template <ProblemClass Problem>
+using SolverForProblem = typename SolverRegistry<solverFor(Problem)>::Solver;
+
+template <ProblemClass Problem>
+struct ProblemTag {
+    static constexpr ProblemClass value = Problem;
+    using Solver = SolverForProblem<Problem>;
+};
+
+template <typename Visitor>
+auto dispatchProblem(ProblemClass problem, Visitor&& visitor)
+    -> decltype(visitor(ProblemTag<ProblemClass::HeatTransfer>())) {
+    switch (problem) {
+        case ProblemClass::HeatTransfer: return visitor(ProblemTag<ProblemClass::HeatTransfer>());
+        case ProblemClass::OrbitalMechanics: return visitor(ProblemTag<ProblemClass::OrbitalMechanics>());
+        case ProblemClass::TurbulentFlow: return visitor(ProblemTag<ProblemClass::TurbulentFlow>());
+    }
+    throw std::invalid_argument("Unknown problem class");
+}
+
+// Runs every ensemble member on a pooled solver of the registered type
+template <ProblemClass Problem>
+double runEnsemble(const std::vector<std::vector<double>>& members) {
+    using Solver = SolverForProblem<Problem>;
+    double sum = 0.0;
+    for (const auto& member : members) {
+        auto solver = solverPool<Solver>().acquire();
+        solver->setVerbose(false);
+        solver->solve(member);
+        sum += solver->getResult();
+    }
+    return sum;
+}
+
 int main() {
     std::cout << "=== Scientific Computing Solver Factory Demo ===\n";
-    
+
     // Heat conduction in a reactor vessel
     {
         HeatTransferSimulation heatSim;
         heatSim.setProblemData({473.15, 373.15, 323.15, 298.15});  // Temperature in Kelvin
         heatSim.runSimulation();
     }
-    
+
     // Three-body problem in celestial mechanics
     {
         OrbitalMechanicsSimulation orbitalSim;
@@ -192,7 +532,7 @@ int main() {
                                   -0.5, -0.866, -0.25, 0.433}); // Body 3
         orbitalSim.runSimulation();
     }
-    
+
     // Navier-Stokes simulation for turbulent flow
     {
         TurbulentFlowSimulation flowSim;
@@ -200,6 +540,55 @@ int main() {
         flowSim.setProblemData({0.1, -0.2, 0.15, -0.1, 0.05});
         flowSim.runSimulation();
     }
-    
+
+    // Ensemble of short heat-transfer runs: fresh solvers vs. pooled solvers
+    // vs. the compile-time registry
+    std::cout << "\n=== Ensemble Runs: Solver Allocation ===\n";
+    const int members = 20000;
+    std::vector<std::vector<double>> ensemble;
+    ensemble.reserve(members);
+    for (int i = 0; i < members; ++i) {
+        ensemble.push_back({300.0 + 0.01 * i, 350.0, 325.0, 280.0 + 0.005 * i});
+    }
+
+    auto timeIt = [](const std::function<double()>& run, double& sum) {
+        auto start = std::chrono::steady_clock::now();
+        sum = run();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    auto runFramework = [&](SolverAllocation mode) {
+        HeatTransferSimulation sim;
+        sim.setVerbose(false);
+        sim.setSolverAllocation(mode);
+        double sum = 0.0;
+        for (const auto& member : ensemble) {
+            sim.setProblemData(member);
+            sum += sim.runSimulation();
+        }
+        return sum;
+    };
+
+    double freshSum, pooledSum, registrySum;
+    double freshMs = timeIt([&] { return runFramework(SolverAllocation::Fresh); }, freshSum);
+    double pooledMs = timeIt([&] { return runFramework(SolverAllocation::Pooled); }, pooledSum);
+    ProblemClass chosen = ProblemClass::HeatTransfer;  // e.g. from an input deck
+    double registryMs = timeIt([&] {
+        return dispatchProblem(chosen, [&](auto tag) {
+            return runEnsemble<decltype(tag)::value>(ensemble);
+        });
+    }, registrySum);
+
+    std::cout << members << " members, " << 1000 << "-element FEM each\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  Fresh solver per run (virtual factory):   " << freshMs << " ms\n";
+    std::cout << "  Pooled solver per run (virtual factory):  " << pooledMs << " ms\n";
+    std::cout << "  Pooled solver per run (static registry):  " << registryMs << " ms\n";
+    std::cout << std::setprecision(6) << "  Mean of member results: " << freshSum / members
+              << " K (pooled " << (pooledSum == freshSum ? "identical" : "DIFFERS")
+              << ", registry " << (registrySum == freshSum ? "identical" : "DIFFERS") << ")\n";
+    std::cout << "  FEM solver pool: " << solverPool<FEMSolver>().totalCount() << " solver(s) for "
+              << solverPool<FEMSolver>().acquireCount() << " acquires\n";
+
     return 0;
-}
\ No newline at end of file
+}
@@ -4,70 +4,296 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+// Bump allocator over one caller-owned block. Simulations built into an
+// arena own no memory; reset() reclaims everything at once for the next
+// build of a parameter sweep.
+class SimulationArena {
+private:
+    std::unique_ptr<unsigned char[]> owned_;
+    unsigned char* base_;
+    size_t capacity_;
+    size_t used_ = 0;
+
+public:
+    explicit SimulationArena(size_t bytes)
+        : owned_(new unsigned char[bytes]), base_(owned_.get()), capacity_(bytes) {}
+
+    // Caller-provided storage (e.g. pinned or NUMA-local memory)
+    SimulationArena(void* storage, size_t bytes)
+        : base_(static_cast<unsigned char*>(storage)), capacity_(bytes) {}
+
+    SimulationArena(const SimulationArena&) = delete;
+    SimulationArena& operator=(const SimulationArena&) = delete;
+
+    template <typename T>
+    T* allocate(size_t count) {
+        size_t misalignment = reinterpret_cast<std::uintptr_t>(base_ + used_) % alignof(T);
+        size_t offset = used_ + (misalignment ? alignof(T) - misalignment : 0);
+        if (offset + count * sizeof(T) > capacity_) {
+            throw std::bad_alloc();
+        }
+        used_ = offset + count * sizeof(T);
+        return reinterpret_cast<T*>(base_ + offset);
+    }
+
+    void reset() { used_ = 0; }
+    size_t used() const { return used_; }
+    size_t capacity() const { return capacity_; }
+};
+
+// Molecular species: molecules of one kind, each with the same atom count
+struct Species {
+    std::string name;
+    int molecules;
+    int atomsPerMolecule;
+    double atomMass;  // amu, averaged over the molecule's atoms
+};
+
+class MolecularSimulation;
+
+// Immutable, validated simulation plan. Every size the build needs is
+// computed here once, so build() allocates each buffer exactly once and a
+// cached blueprint can be built any number of times without re-validation.
+class SimulationBlueprint : public std::enable_shared_from_this<SimulationBlueprint> {
+public:
+    // Mutable form filled in by the builder steps
+    class Draft {
+    private:
+        std::string forceField;
+        std::string integrator;
+        double timeStep = 0.0;
+        double temperature = 0.0;
+        double pressure = 0.0;
+        std::vector<Species> molecules;
+        std::vector<std::string> constraints;
+        int particleCount = 0;
+        std::string ensemble;
+
+    public:
+        void setForceField(const std::string& ff) { forceField = ff; }
+        void setIntegrator(const std::string& integ) { integrator = integ; }
+        void setTimeStep(double dt) { timeStep = dt; }
+        void setTemperature(double T) { temperature = T; }
+        void setPressure(double P) { pressure = P; }
+        void setEnsemble(const std::string& ens) { ensemble = ens; }
+        void setParticleCount(int count) { particleCount = count; }
+        void addMolecule(const std::string& name, int molecules, int atomsPerMolecule, double atomMass) {
+            this->molecules.push_back({name, molecules, atomsPerMolecule, atomMass});
+        }
+        void addConstraint(const std::string& constraint) {
+            constraints.push_back(constraint);
+        }
+
+        // Validates the draft and freezes it; throws std::invalid_argument
+        std::shared_ptr<const SimulationBlueprint> finalize() const;
+    };
+
+    // Doubles per particle: position, velocity, mass
+    static constexpr size_t kDoublesPerParticle = 7;
+
+    const std::string& forceField() const { return forceField_; }
+    const std::string& integrator() const { return integrator_; }
+    double timeStep() const { return timeStep_; }
+    double temperature() const { return temperature_; }
+    double pressure() const { return pressure_; }
+    const std::string& ensemble() const { return ensemble_; }
+    const std::vector<Species>& molecules() const { return molecules_; }
+    const std::vector<std::string>& constraints() const { return constraints_; }
+    size_t particleCount() const { return particleCount_; }
+    double boxLength() const { return boxLength_; }
+
+    // Arena bytes one build() needs, including alignment slack
+    size_t storageBytes() const {
+        return kDoublesPerParticle * particleCount_ * sizeof(double) + alignof(double);
+    }
+
+    std::unique_ptr<MolecularSimulation> build(SimulationArena* arena = nullptr) const;
+    // Same plan at another temperature: sweeps reuse the validated blueprint
+    std::unique_ptr<MolecularSimulation> build(double temperature, SimulationArena* arena = nullptr) const;
+
+private:
+    std::string forceField_;
+    std::string integrator_;
+    double timeStep_;
+    double temperature_;
+    double pressure_;
+    std::vector<Species> molecules_;
+    std::vector<std::string> constraints_;
+    size_t particleCount_;
+    std::string ensemble_;
+    double boxLength_;  // Cubic box edge, reduced units at unit number density
+
+    SimulationBlueprint() = default;
+};
 
 // Product class - Complete molecular dynamics simulation
 class MolecularSimulation {
 private:
-    std::string forceField;
-    std::string integrator;
-    double timeStep;
+    friend class SimulationBlueprint;
+
+    std::shared_ptr<const SimulationBlueprint> blueprint;  // Shared plan and metadata
     double temperature;
-    double pressure;
-    std::vector<std::string> molecules;
-    std::vector<std::string> constraints;
-    int particleCount;
-    std::string ensemble;
-    
+    std::unique_ptr<double[]> ownedStorage;  // Empty when built into an arena
+    double* positions[3];
+    double* velocities[3];
+    double* masses;
+
+    MolecularSimulation() = default;
+
 public:
-    void setForceField(const std::string& ff) { forceField = ff; }
-    void setIntegrator(const std::string& integ) { integrator = integ; }
-    void setTimeStep(double dt) { timeStep = dt; }
-    void setTemperature(double T) { temperature = T; }
-    void setPressure(double P) { pressure = P; }
-    void setEnsemble(const std::string& ens) { ensemble = ens; }
-    void setParticleCount(int count) { particleCount = count; }
-    void addMolecule(const std::string& molecule) { 
-        molecules.push_back(molecule); 
-    }
-    void addConstraint(const std::string& constraint) {
-        constraints.push_back(constraint);
-    }
-    
+    MolecularSimulation(const MolecularSimulation&) = delete;
+    MolecularSimulation& operator=(const MolecularSimulation&) = delete;
+
+    size_t particleCount() const { return blueprint->particleCount(); }
+    double targetTemperature() const { return temperature; }
+
+    // Instantaneous temperature from the kinetic energy (k_B = 1)
+    double kineticTemperature() const {
+        double twiceKinetic = 0.0;
+        for (size_t i = 0; i < particleCount(); ++i) {
+            double v2 = velocities[0][i] * velocities[0][i] + velocities[1][i] * velocities[1][i] +
+                        velocities[2][i] * velocities[2][i];
+            twiceKinetic += masses[i] * v2;
+        }
+        return twiceKinetic / (3.0 * particleCount());
+    }
+
     void displayConfiguration() {
         std::cout << "=== Molecular Dynamics Simulation Configuration ===\n";
-        std::cout << "Force Field: " << forceField << "\n";
-        std::cout << "Integrator: " << integrator << "\n";
-        std::cout << "Time Step: " << timeStep << " fs\n";
+        std::cout << "Force Field: " << blueprint->forceField() << "\n";
+        std::cout << "Integrator: " << blueprint->integrator() << "\n";
+        std::cout << "Time Step: " << blueprint->timeStep() << " fs\n";
         std::cout << "Temperature: " << temperature << " K\n";
-        std::cout << "Pressure: " << pressure << " atm\n";
-        std::cout << "Ensemble: " << ensemble << "\n";
-        std::cout << "Total Particles: " << particleCount << "\n";
+        std::cout << "Pressure: " << blueprint->pressure() << " atm\n";
+        std::cout << "Ensemble: " << blueprint->ensemble() << "\n";
+        std::cout << "Total Particles: " << particleCount() << "\n";
         std::cout << "Molecular Species: ";
-        for (const auto& mol : molecules) {
-            std::cout << mol << " ";
+        for (const auto& mol : blueprint->molecules()) {
+            std::cout << mol.name;
+            if (mol.molecules > 1) std::cout << " (" << mol.molecules << ")";
+            std::cout << " ";
         }
         std::cout << "\nConstraints: ";
-        for (const auto& con : constraints) {
+        for (const auto& con : blueprint->constraints()) {
             std::cout << con << " ";
         }
         std::cout << "\n\n";
     }
 };
 
+constexpr size_t SimulationBlueprint::kDoublesPerParticle;
+
+std::shared_ptr<const SimulationBlueprint> SimulationBlueprint::Draft::finalize() const {
+    std::string errors;
+    if (forceField.empty()) errors += " no force field;";
+    if (integrator.empty()) errors += " no integrator;";
+    if (ensemble.empty()) errors += " no ensemble;";
+    if (!(timeStep > 0.0)) errors += " time step must be positive;";
+    if (!(temperature > 0.0)) errors += " temperature must be positive;";
+    if (pressure < 0.0) errors += " pressure must be non-negative;";
+    if (molecules.empty()) errors += " no molecular species;";
+
+    size_t atoms = 0;
+    for (const auto& mol : molecules) {
+        if (mol.molecules <= 0 || mol.atomsPerMolecule <= 0 || !(mol.atomMass > 0.0)) {
+            errors += " invalid species '" + mol.name + "';";
+        } else {
+            atoms += size_t(mol.molecules) * mol.atomsPerMolecule;
+        }
+    }
+    if (particleCount != 0 && size_t(particleCount) != atoms) {
+        errors += " particle count " + std::to_string(particleCount) +
+                  " does not match species total " + std::to_string(atoms) + ";";
+    }
+    if (!errors.empty()) {
+        throw std::invalid_argument("Invalid simulation blueprint:" + errors);
+    }
+
+    std::shared_ptr<SimulationBlueprint> blueprint(new SimulationBlueprint());
+    blueprint->forceField_ = forceField;
+    blueprint->integrator_ = integrator;
+    blueprint->timeStep_ = timeStep;
+    blueprint->temperature_ = temperature;
+    blueprint->pressure_ = pressure;
+    blueprint->molecules_ = molecules;
+    blueprint->constraints_ = constraints;
+    blueprint->particleCount_ = atoms;
+    blueprint->ensemble_ = ensemble;
+    blueprint->boxLength_ = std::cbrt(double(atoms));
+    return blueprint;
+}
+
+std::unique_ptr<MolecularSimulation> SimulationBlueprint::build(SimulationArena* arena) const {
+    return build(temperature_, arena);
+}
+
+std::unique_ptr<MolecularSimulation> SimulationBlueprint::build(double temperature,
+                                                               SimulationArena* arena) const {
+    if (!(temperature > 0.0)) {
+        throw std::invalid_argument("Build temperature must be positive");
+    }
+    std::unique_ptr<MolecularSimulation> simulation(new MolecularSimulation());
+    simulation->blueprint = shared_from_this();
+    simulation->temperature = temperature;
+
+    // One allocation of the exact final size for all per-particle arrays
+    const size_t n = particleCount_;
+    double* storage;
+    if (arena) {
+        storage = arena->allocate<double>(kDoublesPerParticle * n);
+    } else {
+        simulation->ownedStorage.reset(new double[kDoublesPerParticle * n]);
+        storage = simulation->ownedStorage.get();
+    }
+    for (int d = 0; d < 3; ++d) {
+        simulation->positions[d] = storage + d * n;
+        simulation->velocities[d] = storage + (3 + d) * n;
+    }
+    simulation->masses = storage + 6 * n;
+
+    // Simple cubic lattice and Maxwell-Boltzmann velocities (k_B = 1)
+    const size_t side = size_t(std::ceil(std::cbrt(double(n))));
+    const double spacing = boxLength_ / side;
+    std::mt19937_64 rng(n);
+    std::normal_distribution<double> gaussian(0.0, 1.0);
+    size_t i = 0;
+    for (const auto& mol : molecules_) {
+        const double sigma = std::sqrt(temperature / mol.atomMass);
+        for (size_t atom = 0; atom < size_t(mol.molecules) * mol.atomsPerMolecule; ++atom, ++i) {
+            simulation->positions[0][i] = spacing * (i % side);
+            simulation->positions[1][i] = spacing * (i / side % side);
+            simulation->positions[2][i] = spacing * (i / (side * side));
+            for (int d = 0; d < 3; ++d) {
+                simulation->velocities[d][i] = sigma * gaussian(rng);
+            }
+            simulation->masses[i] = mol.atomMass;
+        }
+    }
+    return simulation;
+}
+
 // Abstract builder for molecular simulations
 class SimulationBuilder {
 protected:
-    std::unique_ptr<MolecularSimulation> simulation;
-    
+    SimulationBlueprint::Draft draft;
+
 public:
     void createNewSimulation() {
-        simulation = std::make_unique<MolecularSimulation>();
+        draft = SimulationBlueprint::Draft();
     }
-    
-    std::unique_ptr<MolecularSimulation> getSimulation() {
-        return std::move(simulation);
+
+    std::shared_ptr<const SimulationBlueprint> getBlueprint() {
+        return draft.finalize();
     }
-    
+
     virtual ~SimulationBuilder() = default;
     virtual void buildForceField() = 0;
     virtual void buildIntegrator() = 0;
@@ -80,32 +306,32 @@ public:
 class ProteinFoldingBuilder : public SimulationBuilder {
 public:
     void buildForceField() override {
-        simulation->setForceField("AMBER ff14SB");
+        draft.setForceField("AMBER ff14SB");
     }
-    
+
     void buildIntegrator() override {
-        simulation->setIntegrator("Langevin Dynamics");
-        simulation->setTimeStep(2.0);  // 2 femtoseconds
+        draft.setIntegrator("Langevin Dynamics");
+        draft.setTimeStep(2.0);  // 2 femtoseconds
     }
-    
+
     void buildThermodynamics() override {
-        simulation->setTemperature(310.15);  // Body temperature
-        simulation->setPressure(1.0);        // 1 atm
-        simulation->setEnsemble("NPT");      // Constant pressure and temperature
+        draft.setTemperature(310.15);  // Body temperature
+        draft.setPressure(1.0);        // 1 atm
+        draft.setEnsemble("NPT");      // Constant pressure and temperature
     }
-    
+
     void buildMolecularSystem() override {
-        simulation->addMolecule("Protein (1UBQ)");
-        simulation->addMolecule("TIP3P Water (10000)");
-        simulation->addMolecule("Na+ ions (20)");
-        simulation->addMolecule("Cl- ions (20)");
-        simulation->setParticleCount(31416);
+        draft.addMolecule("Protein (1UBQ)", 1, 1376, 7.4);  // All-atom ubiquitin
+        draft.addMolecule("TIP3P Water", 10000, 3, 6.0);
+        draft.addMolecule("Na+ ions", 20, 1, 22.99);
+        draft.addMolecule("Cl- ions", 20, 1, 35.45);
+        draft.setParticleCount(31416);
     }
-    
+
     void buildConstraints() override {
-        simulation->addConstraint("SHAKE (H-bonds)");
-        simulation->addConstraint("Periodic Boundary Conditions");
-        simulation->addConstraint("Long-range Electrostatics (PME)");
+        draft.addConstraint("SHAKE (H-bonds)");
+        draft.addConstraint("Periodic Boundary Conditions");
+        draft.addConstraint("Long-range Electrostatics (PME)");
     }
 };
 
@@ -113,29 +339,29 @@ public:
 class FluidDynamicsBuilder : public SimulationBuilder {
 public:
     void buildForceField() override {
-        simulation->setForceField("Lennard-Jones 12-6");
+        draft.setForceField("Lennard-Jones 12-6");
     }
-    
+
     void buildIntegrator() override {
-        simulation->setIntegrator("Velocity Verlet");
-        simulation->setTimeStep(0.005);  // 5 attoseconds for dense fluids
+        draft.setIntegrator("Velocity Verlet");
+        draft.setTimeStep(0.005);  // 5 attoseconds for dense fluids
     }
-    
+
     void buildThermodynamics() override {
-        simulation->setTemperature(298.15);  // Room temperature
-        simulation->setPressure(100.0);      // 100 atm (high pressure)
-        simulation->setEnsemble("NVE");      // Microcanonical ensemble
+        draft.setTemperature(298.15);  // Room temperature
+        draft.setPressure(100.0);      // 100 atm (high pressure)
+        draft.setEnsemble("NVE");      // Microcanonical ensemble
     }
-    
+
     void buildMolecularSystem() override {
-        simulation->addMolecule("Argon atoms (100000)");
-        simulation->setParticleCount(100000);
+        draft.addMolecule("Argon atoms", 100000, 1, 39.95);
+        draft.setParticleCount(100000);
     }
-    
+
     void buildConstraints() override {
-        simulation->addConstraint("Neighbor Lists (Verlet)");
-        simulation->addConstraint("Cutoff 2.5σ");
-        simulation->addConstraint("Tail Corrections");
+        draft.addConstraint("Neighbor Lists (Verlet)");
+        draft.addConstraint("Cutoff 2.5σ");
+        draft.addConstraint("Tail Corrections");
     }
 };
 
@@ -143,28 +369,44 @@ public:
 class SimulationDirector {
 private:
     SimulationBuilder* builder;
-    
+    std::map<std::string, std::shared_ptr<const SimulationBlueprint>> blueprints;
+
 public:
     void setBuilder(SimulationBuilder* b) {
         builder = b;
     }
-    
-    std::unique_ptr<MolecularSimulation> constructSimulation() {
+
+    // Phase 1: run the builder steps and validate them into a blueprint
+    std::shared_ptr<const SimulationBlueprint> planSimulation() {
         builder->createNewSimulation();
         builder->buildForceField();
         builder->buildIntegrator();
         builder->buildThermodynamics();
         builder->buildMolecularSystem();
         builder->buildConstraints();
-        return builder->getSimulation();
+        return builder->getBlueprint();
+    }
+
+    // Planned once per key with the current builder, then served from the cache
+    std::shared_ptr<const SimulationBlueprint> cachedBlueprint(const std::string& key) {
+        auto it = blueprints.find(key);
+        if (it == blueprints.end()) {
+            it = blueprints.emplace(key, planSimulation()).first;
+        }
+        return it->second;
+    }
+
+    // Both phases; kept for one-off runs
+    std::unique_ptr<MolecularSimulation> constructSimulation() {
+        return planSimulation()->build();
     }
 };
 
 int main() {
     std::cout << "=== Molecular Dynamics Simulation Builder Demo ===\n\n";
-    
+
     SimulationDirector director;
-    
+
     // Build protein folding simulation
     {
         std::cout << "Constructing Protein Folding Simulation...\n\n";
@@ -172,14 +414,14 @@ int main() {
         director.setBuilder(&proteinBuilder);
         auto proteinSim = director.constructSimulation();
         proteinSim->displayConfiguration();
-        
+
         std::cout << "Initializing simulation...\n";
         std::cout << "Loading crystal structure from PDB...\n";
         std::cout << "Solvating protein in water box...\n";
         std::cout << "Adding counterions for neutralization...\n";
         std::cout << "Energy minimization in progress...\n\n";
     }
-    
+
     // Build fluid dynamics simulation
     {
         std::cout << "Constructing Fluid Dynamics Simulation...\n\n";
@@ -187,13 +429,62 @@ int main() {
         director.setBuilder(&fluidBuilder);
         auto fluidSim = director.constructSimulation();
         fluidSim->displayConfiguration();
-        
+
         std::cout << "Initializing simulation...\n";
         std::cout << "Creating FCC lattice of Argon atoms...\n";
         std::cout << "Assigning Maxwell-Boltzmann velocities...\n";
         std::cout << "Equilibrating system for 100 ps...\n";
         std::cout << "Ready for production run...\n\n";
     }
-    
+
+    // Invalid configurations are rejected at planning time, before any
+    // particle storage is allocated
+    {
+        std::cout << "Validating a malformed draft...\n";
+        SimulationBlueprint::Draft draft;
+        draft.setForceField("Lennard-Jones 12-6");
+        draft.setTimeStep(-1.0);
+        draft.addMolecule("Argon atoms", 1000, 1, 39.95);
+        draft.setParticleCount(999);
+        try {
+            draft.finalize();
+        } catch (const std::invalid_argument& e) {
+            std::cout << e.what() << "\n\n";
+        }
+    }
+
+    // Temperature sweep: re-planning every point vs. one cached blueprint
+    // built into a reused arena
+    {
+        std::cout << "=== Temperature Sweep (Argon, 100000 atoms) ===\n";
+        FluidDynamicsBuilder fluidBuilder;
+        director.setBuilder(&fluidBuilder);
+        const double temperatures[] = {80.0, 90.0, 100.0, 110.0, 120.0, 130.0, 140.0, 150.0};
+
+        auto start = std::chrono::steady_clock::now();
+        double replannedSum = 0.0;
+        for (double T : temperatures) {
+            auto sim = director.planSimulation()->build(T);
+            replannedSum += sim->kineticTemperature();
+        }
+        double replannedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        auto blueprint = director.cachedBlueprint("argon-nve");
+        SimulationArena arena(blueprint->storageBytes());
+        start = std::chrono::steady_clock::now();
+        double cachedSum = 0.0;
+        for (double T : temperatures) {
+            arena.reset();
+            auto sim = director.cachedBlueprint("argon-nve")->build(T, &arena);
+            std::cout << "  T = " << T << " K -> kinetic temperature " << sim->kineticTemperature() << " K\n";
+            cachedSum += sim->kineticTemperature();
+        }
+        double cachedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "Re-planned builds: " << replannedMs << " ms, cached blueprint + arena: " << cachedMs
+                  << " ms (" << (replannedSum == cachedSum ? "identical states" : "STATES DIFFER") << ")\n";
+        std::cout << "Arena: " << arena.used() << " of " << arena.capacity() << " bytes per build\n";
+    }
+
     return 0;
-}
\ No newline at end of file
+}
@@ -6,10 +6,57 @@
 #include <string>
 #include <vector>
 #include <complex>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+// Trimmed copy of pattern 51's SmartCOW::COWPtr, without the logging.
+// Copies share one buffer; the first mutable access through a shared
+// pointer makes a private deep copy.
+template<typename T>
+class COWPtr {
+private:
+    std::shared_ptr<T> ptr_;
+
+    void ensureUnique() {
+        if (ptr_.use_count() > 1) {
+            ptr_ = std::make_shared<T>(*ptr_);
+        }
+    }
+
+public:
+    template<typename... Args>
+    explicit COWPtr(Args&&... args)
+        : ptr_(std::make_shared<T>(std::forward<Args>(args)...)) {}
+
+    // Read-only access
+    const T& operator*() const { return *ptr_; }
+    const T* operator->() const { return ptr_.get(); }
+    const T& get() const { return *ptr_; }
+
+    // Mutable access (triggers COW)
+    T& mutable_get() {
+        ensureUnique();
+        return *ptr_;
+    }
+
+    long use_count() const { return ptr_.use_count(); }
+};
+
+// Per-basis-state quantities fixed by the prototype's parameters. Built once
+// and shared read-only by every clone.
+struct BasisTable {
+    std::vector<double> interaction;    // Field-independent energy, meV
+    std::vector<double> magnetization;  // Sz, units of hbar
+};
 
 // Abstract prototype for quantum systems
 class QuantumSystem {
 public:
+    using Wavefunction = std::vector<std::complex<double>>;
+
     virtual ~QuantumSystem() = default;
     virtual std::unique_ptr<QuantumSystem> clone() const = 0;
     virtual void simulate() const = 0;
@@ -20,11 +67,41 @@ public:
         temperature_ = T;
     }
     virtual double getEnergy() const = 0;
-    
+
+    // <psi|H|psi> over the basis, with H diagonal in it. Read-only, so
+    // members that share a wavefunction can be measured concurrently.
+    double measureEnergy() const {
+        const Wavefunction& psi = *wavefunction_;
+        const BasisTable& basis = *basis_;
+        double energy = 0.0;
+        for (size_t i = 0; i < psi.size(); ++i) {
+            energy += std::norm(psi[i]) *
+                      (basis.interaction[i] - zeemanFactor_ * magneticField_ * basis.magnetization[i]);
+        }
+        return energy;
+    }
+
+    // Puts the system in a single basis state; the first call on a clone
+    // gives it a private wavefunction
+    void excite(size_t state) {
+        Wavefunction& psi = wavefunction_.mutable_get();
+        if (state >= psi.size()) throw std::out_of_range("Basis state out of range");
+        std::fill(psi.begin(), psi.end(), std::complex<double>(0.0, 0.0));
+        psi[state] = std::complex<double>(1.0, 0.0);
+    }
+
+    bool sharesWavefunctionWith(const QuantumSystem& other) const {
+        return &wavefunction_.get() == &other.wavefunction_.get();
+    }
+
+    size_t hilbertSize() const { return wavefunction_->size(); }
+
 protected:
     double magneticField_ = 0.0;  // Tesla
     double temperature_ = 300.0;  // Kelvin
-    std::vector<std::complex<double>> wavefunction_;
+    double zeemanFactor_ = 0.116;  // g * mu_B, meV/T (g = 2)
+    COWPtr<Wavefunction> wavefunction_;
+    std::shared_ptr<const BasisTable> basis_;
 };
 
 // Concrete prototype - Spin chain system
@@ -33,19 +110,40 @@ private:
     int numSpins_;
     double couplingStrength_;  // J in Heisenberg model
     std::string boundaryCondition_;
-    
+
 public:
-    SpinChain(int spins, double J, const std::string& bc) 
+    SpinChain(int spins, double J, const std::string& bc)
         : numSpins_(spins), couplingStrength_(J), boundaryCondition_(bc) {
         // Initialize quantum state
-        wavefunction_.resize(1 << numSpins_, std::complex<double>(0.0, 0.0));
-        wavefunction_[0] = std::complex<double>(1.0, 0.0);  // Ground state
+        Wavefunction& psi = wavefunction_.mutable_get();
+        psi.resize(size_t(1) << numSpins_, std::complex<double>(0.0, 0.0));
+        psi[0] = std::complex<double>(1.0, 0.0);  // Ground state
+
+        // Ising part of the Heisenberg energy and Sz for each configuration
+        auto basis = std::make_shared<BasisTable>();
+        basis->interaction.resize(psi.size());
+        basis->magnetization.resize(psi.size());
+        int bonds = boundaryCondition_ == "periodic" ? numSpins_ : numSpins_ - 1;
+        for (size_t state = 0; state < psi.size(); ++state) {
+            double bondSum = 0.0, sz = 0.0;
+            for (int s = 0; s < numSpins_; ++s) {
+                double si = (state >> s & 1) ? -0.5 : 0.5;
+                sz += si;
+                if (s < bonds) {
+                    double sj = (state >> ((s + 1) % numSpins_) & 1) ? -0.5 : 0.5;
+                    bondSum += si * sj;
+                }
+            }
+            basis->interaction[state] = -4.0 * couplingStrength_ * bondSum;
+            basis->magnetization[state] = sz;
+        }
+        basis_ = basis;
     }
-    
+
     std::unique_ptr<QuantumSystem> clone() const override {
         return std::make_unique<SpinChain>(*this);
     }
-    
+
     void simulate() const override {
         std::cout << "Simulating Heisenberg Spin Chain:\n";
         std::cout << "  Spins: " << numSpins_ << "\n";
@@ -55,7 +153,7 @@ public:
         std::cout << "  Temperature: " << temperature_ << " K\n";
         std::cout << "  Ground State Energy: " << getEnergy() << " meV\n\n";
     }
-    
+
     double getEnergy() const override {
         // Simplified energy calculation
         return -couplingStrength_ * (numSpins_ - 1) - magneticField_ * numSpins_ * 0.5;
@@ -68,20 +166,35 @@ private:
     double confinementEnergy_;
     int numElectrons_;
     std::string material_;
-    
+
 public:
     QuantumDot(double E0, int electrons, const std::string& mat)
         : confinementEnergy_(E0), numElectrons_(electrons), material_(mat) {
         // Initialize many-body wavefunction
-        int hilbertSize = 1 << (2 * numElectrons_);  // Spin up/down states
-        wavefunction_.resize(hilbertSize, std::complex<double>(0.0, 0.0));
-        wavefunction_[0] = std::complex<double>(1.0, 0.0);
+        size_t hilbertSize = size_t(1) << (2 * numElectrons_);  // Spin up/down states
+        Wavefunction& psi = wavefunction_.mutable_get();
+        psi.resize(hilbertSize, std::complex<double>(0.0, 0.0));
+        psi[0] = std::complex<double>(1.0, 0.0);
+
+        // Occupation-number basis: even bits spin up, odd bits spin down
+        auto basis = std::make_shared<BasisTable>();
+        basis->interaction.resize(hilbertSize);
+        basis->magnetization.resize(hilbertSize);
+        for (size_t state = 0; state < hilbertSize; ++state) {
+            int up = 0, down = 0;
+            for (int orbital = 0; orbital < 2 * numElectrons_; ++orbital) {
+                if (state >> orbital & 1) (orbital % 2 ? down : up)++;
+            }
+            basis->interaction[state] = (up + down) * confinementEnergy_;
+            basis->magnetization[state] = 0.5 * (up - down);
+        }
+        basis_ = basis;
     }
-    
+
     std::unique_ptr<QuantumSystem> clone() const override {
         return std::make_unique<QuantumDot>(*this);
     }
-    
+
     void simulate() const override {
         std::cout << "Simulating Quantum Dot System:\n";
         std::cout << "  Material: " << material_ << "\n";
@@ -91,7 +204,7 @@ public:
         std::cout << "  Temperature: " << temperature_ << " K\n";
         std::cout << "  Total Energy: " << getEnergy() << " meV\n\n";
     }
-    
+
     double getEnergy() const override {
         // Simplified Fock-Darwin spectrum
         double cyclotronFreq = 1.16 * magneticField_;  // meV/T for GaAs
@@ -99,17 +212,39 @@ public:
     }
 };
 
+// Splits [0, n) into one contiguous chunk per hardware thread
+template<typename Body>
+void parallelFor(size_t n, Body body) {
+    size_t threads = std::min<size_t>(n, std::max(1u, std::thread::hardware_concurrency()));
+    if (threads <= 1) {
+        for (size_t i = 0; i < n; ++i) body(i);
+        return;
+    }
+    std::vector<std::thread> workers;
+    size_t chunk = (n + threads - 1) / threads;
+    for (size_t begin = 0; begin < n; begin += chunk) {
+        size_t end = std::min(n, begin + chunk);
+        workers.emplace_back([=, &body] {
+            for (size_t i = begin; i < end; ++i) body(i);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+}
+
 // Quantum system prototype registry for parameter sweeps
 class QuantumSystemRegistry {
 private:
     std::unordered_map<std::string, std::unique_ptr<QuantumSystem>> prototypes_;
-    
+
+    static const QuantumSystem& member(const std::unique_ptr<QuantumSystem>& system) { return *system; }
+    static const QuantumSystem& member(const QuantumSystem& system) { return system; }
+
 public:
-    void registerPrototype(const std::string& key, 
+    void registerPrototype(const std::string& key,
                           std::unique_ptr<QuantumSystem> prototype) {
         prototypes_[key] = std::move(prototype);
     }
-    
+
     std::unique_ptr<QuantumSystem> create(const std::string& key) {
         auto it = prototypes_.find(key);
         if (it != prototypes_.end()) {
@@ -117,11 +252,13 @@ public:
         }
         return nullptr;
     }
-    
-    // Create ensemble for Monte Carlo simulations
+
+    // Create ensemble for Monte Carlo simulations. Clones share the
+    // prototype's wavefunction and basis until they modify them.
     std::vector<std::unique_ptr<QuantumSystem>> createEnsemble(
             const std::string& key, int count) {
         std::vector<std::unique_ptr<QuantumSystem>> ensemble;
+        ensemble.reserve(count);
         for (int i = 0; i < count; ++i) {
             auto system = create(key);
             if (system) {
@@ -130,26 +267,51 @@ public:
         }
         return ensemble;
     }
+
+    // Bulk variant for a known concrete type: members are stored by value in
+    // one contiguous allocation instead of one heap object per clone
+    template<typename System>
+    std::vector<System> createEnsembleOf(const std::string& key, int count) {
+        auto it = prototypes_.find(key);
+        if (it == prototypes_.end()) {
+            return {};
+        }
+        auto prototype = dynamic_cast<const System*>(it->second.get());
+        if (!prototype) {
+            throw std::invalid_argument("Prototype '" + key + "' has a different system type");
+        }
+        return std::vector<System>(count, *prototype);
+    }
+
+    // Measures every member concurrently; results are in ensemble order
+    template<typename Ensemble>
+    static std::vector<double> simulateEnsemble(const Ensemble& ensemble) {
+        std::vector<double> energies(ensemble.size());
+        parallelFor(ensemble.size(), [&](size_t i) {
+            energies[i] = member(ensemble[i]).measureEnergy();
+        });
+        return energies;
+    }
 };
 
 int main() {
     std::cout << "=== Quantum System Prototype Registry Demo ===\n\n";
-    
+
     // Create registry and register quantum system prototypes
     QuantumSystemRegistry registry;
-    
+
     // Register different spin chain configurations
     registry.registerPrototype("antiferromagnetic-chain",
         std::make_unique<SpinChain>(10, -1.0, "periodic"));
     registry.registerPrototype("ferromagnetic-chain",
         std::make_unique<SpinChain>(10, 1.0, "open"));
-    
+
     // Register quantum dot systems
     registry.registerPrototype("gaas-quantum-dot",
         std::make_unique<QuantumDot>(5.0, 2, "GaAs"));
     registry.registerPrototype("inas-quantum-dot",
         std::make_unique<QuantumDot>(3.0, 4, "InAs"));
-    
+
     // Parameter sweep: Magnetic field study
     std::cout << "=== Magnetic Field Parameter Sweep ===\n\n";
     auto spinSystem = registry.create("antiferromagnetic-chain");
@@ -158,7 +320,7 @@ int main() {
         system->setMagneticField(B);
         system->simulate();
     }
-    
+
     // Temperature ensemble for statistical mechanics
     std::cout << "=== Temperature Ensemble Generation ===\n\n";
     auto ensemble = registry.createEnsemble("gaas-quantum-dot", 3);
@@ -169,7 +331,7 @@ int main() {
         std::cout << "Ensemble member " << i+1 << ":\n";
         ensemble[i]->simulate();
     }
-    
+
     // Create copies for parallel computation
     std::cout << "=== Parallel Computation Setup ===\n\n";
     auto dotPrototype = registry.create("inas-quantum-dot");
@@ -179,6 +341,48 @@ int main() {
         std::cout << "Thread " << i << ": Initialized quantum dot\n";
     }
     std::cout << "\nReady for distributed quantum Monte Carlo simulation\n";
-    
+
+    // Large field sweep: the clones share one 2^18-amplitude wavefunction
+    // until a member is excited
+    std::cout << "\n=== Copy-on-Write Field Sweep Ensemble ===\n\n";
+    registry.registerPrototype("long-chain",
+        std::make_unique<SpinChain>(18, -1.0, "periodic"));
+    const int members = 256;
+
+    auto start = std::chrono::steady_clock::now();
+    auto sweep = registry.createEnsembleOf<SpinChain>("long-chain", members);
+    double cloneMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    for (int i = 0; i < members; ++i) {
+        sweep[i].setMagneticField(0.05 * i);
+    }
+    sweep[members - 1].excite((size_t(1) << 18) - 1);  // All spins down
+
+    int sharing = 0;
+    for (const auto& system : sweep) {
+        if (system.sharesWavefunctionWith(sweep[0])) ++sharing;
+    }
+    double amplitudeMB = sweep[0].hilbertSize() * sizeof(std::complex<double>) / 1048576.0;
+    std::cout << members << " members cloned in " << cloneMs << " ms\n";
+    std::cout << sharing << " members share one " << amplitudeMB << " MB wavefunction; "
+              << members - sharing << " excited member holds a private copy\n";
+    std::cout << "Wavefunction memory: " << (members - sharing + 1) * amplitudeMB
+              << " MB (deep clones: " << members * amplitudeMB << " MB)\n";
+
+    start = std::chrono::steady_clock::now();
+    std::vector<double> energies = QuantumSystemRegistry::simulateEnsemble(sweep);
+    double parallelMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    bool matches = true;
+    for (int i = 0; i < members; ++i) {
+        matches = matches && sweep[i].measureEnergy() == energies[i];
+    }
+    double serialMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "<H> at B = 0 T: " << energies[0] << " meV, B = "
+              << 0.05 * (members - 2) << " T: " << energies[members - 2] << " meV, excited at B = "
+              << 0.05 * (members - 1) << " T: " << energies[members - 1] << " meV\n";
+    std::cout << "Parallel measurement: " << parallelMs << " ms, serial: " << serialMs
+              << " ms (" << (matches ? "identical" : "MISMATCH") << ")\n";
+
     return 0;
-}
\ No newline at end of file
+}
@@ -4,6 +4,46 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MESH_HAVE_MMAP 1
+#endif
+
+// Non-owning view of a contiguous array, used for bulk ingestion so callers
+// can hand over generator or file buffers without building nested vectors
+template <typename T>
+class ConstSpan {
+private:
+    const T* ptr = nullptr;
+    size_t count = 0;
+
+public:
+    ConstSpan() = default;
+    ConstSpan(const T* data, size_t size) : ptr(data), count(size) {}
+    ConstSpan(const std::vector<T>& v) : ptr(v.data()), count(v.size()) {}
+
+    const T* data() const { return ptr; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T* begin() const { return ptr; }
+    const T* end() const { return ptr + count; }
+    const T& operator[](size_t i) const { return ptr[i]; }
+};
 
 // Implementation interface - Storage backend for computational meshes
 class MeshStorageBackend {
@@ -13,6 +53,25 @@ public:
     virtual void storeElements(const std::vector<std::vector<int>>& elements) = 0;
     virtual void storeBoundaryConditions(const std::string& type, const std::vector<int>& nodeIds) = 0;
     virtual size_t getMemoryUsage() const = 0;
+
+    // Bulk ingestion from flat buffers: xyz interleaved coordinates, and CSR
+    // connectivity where element e owns nodeIds[offsets[e], offsets[e+1]).
+    // The defaults unpack into the nested form so every backend accepts them.
+    virtual void ingestNodes(ConstSpan<double> xyz) {
+        std::vector<std::vector<double>> nodes(xyz.size() / 3);
+        for (size_t n = 0; n < nodes.size(); ++n) {
+            nodes[n].assign(xyz.begin() + 3 * n, xyz.begin() + 3 * n + 3);
+        }
+        storeNodes(nodes);
+    }
+
+    virtual void ingestElements(ConstSpan<std::uint64_t> offsets, ConstSpan<int> nodeIds) {
+        std::vector<std::vector<int>> elements(offsets.empty() ? 0 : offsets.size() - 1);
+        for (size_t e = 0; e < elements.size(); ++e) {
+            elements[e].assign(nodeIds.begin() + offsets[e], nodeIds.begin() + offsets[e + 1]);
+        }
+        storeElements(elements);
+    }
 };
 
 // Concrete implementation - Array-based storage for structured meshes
@@ -32,11 +91,22 @@ public:
         }
     }
     
+    void ingestNodes(ConstSpan<double> xyz) override {
+        std::cout << "Structured Storage: Storing nodes in 3D array format\n";
+        std::cout << "  Using implicit indexing (i,j,k) -> linear index\n";
+        std::cout << "  Memory layout: Contiguous for cache efficiency\n";
+        nodeCoordinates.assign(xyz.begin(), xyz.end());
+    }
+
     void storeElements(const std::vector<std::vector<int>>& elements) override {
         std::cout << "Structured Storage: Elements implicitly defined by grid\n";
         std::cout << "  Hexahedral elements from regular connectivity\n";
         std::cout << "  No explicit storage needed - computed on demand\n";
     }
+
+    void ingestElements(ConstSpan<std::uint64_t>, ConstSpan<int>) override {
+        storeElements({});
+    }
     
     void storeBoundaryConditions(const std::string& type, const std::vector<int>& nodeIds) override {
         std::cout << "Structured Storage: Boundary condition '" << type << "'\n";
@@ -88,6 +158,554 @@ public:
     }
 };
 
+// Read-only view of flat mesh arrays, shared by in-memory and mapped storage
+// so traversal kernels do not care where the bytes live
+struct MeshView {
+    size_t nodeCount = 0;
+    size_t elementCount = 0;
+    const double* coordinates = nullptr;          // xyz interleaved, 3 * nodeCount
+    const std::uint64_t* elementOffsets = nullptr; // elementCount + 1
+    const int* elementNodes = nullptr;
+    const std::uint64_t* nodeElementOffsets = nullptr; // nodeCount + 1
+    const int* nodeElements = nullptr;
+};
+
+// Node and element numbering strategies for FlatMeshStorage::reorder
+enum class MeshOrdering { ReverseCuthillMcKee, HilbertCurve };
+
+// Position of a point along a 3D Hilbert curve (Skilling's transpose algorithm)
+inline std::uint64_t hilbertIndex3D(std::uint32_t x, std::uint32_t y, std::uint32_t z, int bits) {
+    std::uint32_t X[3] = {x, y, z};
+    const std::uint32_t M = 1u << (bits - 1);
+    for (std::uint32_t Q = M; Q > 1; Q >>= 1) {
+        const std::uint32_t P = Q - 1;
+        for (int i = 0; i < 3; ++i) {
+            if (X[i] & Q) {
+                X[0] ^= P;
+            } else {
+                const std::uint32_t t = (X[0] ^ X[i]) & P;
+                X[0] ^= t;
+                X[i] ^= t;
+            }
+        }
+    }
+    X[1] ^= X[0];
+    X[2] ^= X[1];
+    std::uint32_t t = 0;
+    for (std::uint32_t Q = M; Q > 1; Q >>= 1) {
+        if (X[2] & Q) t ^= Q - 1;
+    }
+    for (int i = 0; i < 3; ++i) X[i] ^= t;
+
+    std::uint64_t key = 0;
+    for (int b = bits - 1; b >= 0; --b) {
+        for (int i = 0; i < 3; ++i) key = (key << 1) | ((X[i] >> b) & 1u);
+    }
+    return key;
+}
+
+// On-disk layout written by FlatMeshStorage::writeTo and mapped by
+// MappedMeshStorage. Arrays follow the header in native byte order:
+// elementOffsets, nodeElementOffsets, coordinates, elementNodes, nodeElements
+struct FlatMeshFileHeader {
+    char magic[8];
+    std::uint64_t nodeCount;
+    std::uint64_t elementCount;
+    std::uint64_t connectivitySize;
+};
+
+static const char kFlatMeshMagic[8] = {'F', 'L', 'A', 'T', 'M', 'S', 'H', '1'};
+
+inline size_t flatMeshFileSize(const FlatMeshFileHeader& h) {
+    return sizeof(FlatMeshFileHeader)
+         + (h.elementCount + 1) * sizeof(std::uint64_t)
+         + (h.nodeCount + 1) * sizeof(std::uint64_t)
+         + 3 * h.nodeCount * sizeof(double)
+         + 2 * h.connectivitySize * sizeof(int);
+}
+
+// Concrete implementation - Flat arrays with CSR connectivity in both
+// directions. One allocation per array regardless of mesh size, and
+// renumbering for locality before the solver touches the data.
+class FlatMeshStorage : public MeshStorageBackend {
+private:
+    std::vector<double> coordinates;
+    std::vector<std::uint64_t> elementOffsets{0};
+    std::vector<int> elementNodes;
+    std::vector<std::uint64_t> nodeElementOffsets{0};
+    std::vector<int> nodeElements;
+    std::map<std::string, std::vector<int>> boundarySets;
+
+    size_t nodeCount() const { return coordinates.size() / 3; }
+    size_t elementCount() const { return elementOffsets.size() - 1; }
+
+    // Transpose element->node CSR into node->element CSR with a counting pass
+    void buildNodeToElement() {
+        const size_t N = nodeCount();
+        nodeElementOffsets.assign(N + 1, 0);
+        for (int n : elementNodes) ++nodeElementOffsets[n + 1];
+        std::partial_sum(nodeElementOffsets.begin(), nodeElementOffsets.end(),
+                         nodeElementOffsets.begin());
+        nodeElements.resize(elementNodes.size());
+        std::vector<std::uint64_t> cursor(nodeElementOffsets.begin(), nodeElementOffsets.end() - 1);
+        for (size_t e = 0; e < elementCount(); ++e) {
+            for (std::uint64_t k = elementOffsets[e]; k < elementOffsets[e + 1]; ++k) {
+                nodeElements[cursor[elementNodes[k]]++] = static_cast<int>(e);
+            }
+        }
+    }
+
+    // Breadth-first Cuthill-McKee sweep from start, appending to order.
+    // Returns the index in order where the deepest level begins.
+    size_t cuthillMcKeeSweep(int start, const std::vector<int>& degree,
+                             std::vector<char>& visited, std::vector<int>& order) const {
+        size_t head = order.size();
+        visited[start] = 1;
+        order.push_back(start);
+        size_t levelStart = head;
+        size_t levelEnd = order.size();
+        while (head < order.size()) {
+            if (head == levelEnd) {
+                levelStart = levelEnd;
+                levelEnd = order.size();
+            }
+            const int n = order[head++];
+            const size_t first = order.size();
+            for (std::uint64_t i = nodeElementOffsets[n]; i < nodeElementOffsets[n + 1]; ++i) {
+                const int e = nodeElements[i];
+                for (std::uint64_t k = elementOffsets[e]; k < elementOffsets[e + 1]; ++k) {
+                    const int m = elementNodes[k];
+                    if (!visited[m]) {
+                        visited[m] = 1;
+                        order.push_back(m);
+                    }
+                }
+            }
+            std::sort(order.begin() + first, order.end(),
+                      [&degree](int a, int b) { return degree[a] < degree[b]; });
+        }
+        return levelStart;
+    }
+
+    std::vector<int> reverseCuthillMcKeeOrder() const {
+        const size_t N = nodeCount();
+        std::vector<int> degree(N, 0);
+        std::vector<int> stamp(N, -1);
+        for (size_t n = 0; n < N; ++n) {
+            for (std::uint64_t i = nodeElementOffsets[n]; i < nodeElementOffsets[n + 1]; ++i) {
+                const int e = nodeElements[i];
+                for (std::uint64_t k = elementOffsets[e]; k < elementOffsets[e + 1]; ++k) {
+                    const int m = elementNodes[k];
+                    if (m != static_cast<int>(n) && stamp[m] != static_cast<int>(n)) {
+                        stamp[m] = static_cast<int>(n);
+                        ++degree[n];
+                    }
+                }
+            }
+        }
+
+        std::vector<int> byDegree(N);
+        std::iota(byDegree.begin(), byDegree.end(), 0);
+        std::stable_sort(byDegree.begin(), byDegree.end(),
+                         [&degree](int a, int b) { return degree[a] < degree[b]; });
+
+        std::vector<char> visited(N, 0);
+        std::vector<int> order;
+        order.reserve(N);
+        for (int seed : byDegree) {
+            if (visited[seed]) continue;
+            // One George-Liu step: restart from the lowest-degree node of the
+            // deepest level to get a pseudo-peripheral starting point
+            const size_t componentStart = order.size();
+            const size_t lastLevel = cuthillMcKeeSweep(seed, degree, visited, order);
+            int peripheral = order[lastLevel];
+            for (size_t i = lastLevel; i < order.size(); ++i) {
+                if (degree[order[i]] < degree[peripheral]) peripheral = order[i];
+            }
+            for (size_t i = componentStart; i < order.size(); ++i) visited[order[i]] = 0;
+            order.resize(componentStart);
+            cuthillMcKeeSweep(peripheral, degree, visited, order);
+        }
+        std::reverse(order.begin(), order.end());
+        return order;
+    }
+
+    std::vector<int> hilbertOrder() const {
+        const size_t N = nodeCount();
+        double lo[3] = {HUGE_VAL, HUGE_VAL, HUGE_VAL};
+        double hi[3] = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+        for (size_t n = 0; n < N; ++n) {
+            for (int d = 0; d < 3; ++d) {
+                lo[d] = std::min(lo[d], coordinates[3 * n + d]);
+                hi[d] = std::max(hi[d], coordinates[3 * n + d]);
+            }
+        }
+        const int bits = 21;
+        const double cells = static_cast<double>((1u << bits) - 1);
+        std::vector<std::pair<std::uint64_t, int>> keyed(N);
+        for (size_t n = 0; n < N; ++n) {
+            std::uint32_t q[3];
+            for (int d = 0; d < 3; ++d) {
+                const double extent = hi[d] - lo[d];
+                const double t = extent > 0.0 ? (coordinates[3 * n + d] - lo[d]) / extent : 0.0;
+                q[d] = static_cast<std::uint32_t>(t * cells);
+            }
+            keyed[n] = {hilbertIndex3D(q[0], q[1], q[2], bits), static_cast<int>(n)};
+        }
+        std::sort(keyed.begin(), keyed.end());
+        std::vector<int> order(N);
+        for (size_t i = 0; i < N; ++i) order[i] = keyed[i].second;
+        return order;
+    }
+
+public:
+    void storeNodes(const std::vector<std::vector<double>>& nodes) override {
+        std::vector<double> xyz;
+        xyz.reserve(nodes.size() * 3);
+        for (const auto& node : nodes) {
+            if (node.size() != 3) throw std::invalid_argument("FlatMeshStorage: nodes must be 3D");
+            xyz.insert(xyz.end(), node.begin(), node.end());
+        }
+        ingestNodes(xyz);
+    }
+
+    void storeElements(const std::vector<std::vector<int>>& elements) override {
+        std::vector<std::uint64_t> offsets{0};
+        std::vector<int> ids;
+        offsets.reserve(elements.size() + 1);
+        for (const auto& elem : elements) {
+            ids.insert(ids.end(), elem.begin(), elem.end());
+            offsets.push_back(ids.size());
+        }
+        ingestElements(offsets, ids);
+    }
+
+    void ingestNodes(ConstSpan<double> xyz) override {
+        if (xyz.size() % 3 != 0) {
+            throw std::invalid_argument("FlatMeshStorage: coordinate count not a multiple of 3");
+        }
+        std::cout << "Flat Storage: Ingesting " << xyz.size() / 3
+                  << " nodes into one contiguous xyz array\n";
+        coordinates.assign(xyz.begin(), xyz.end());
+        elementOffsets.assign(1, 0);
+        elementNodes.clear();
+        nodeElementOffsets.assign(nodeCount() + 1, 0);
+        nodeElements.clear();
+        boundarySets.clear();
+    }
+
+    void ingestElements(ConstSpan<std::uint64_t> offsets, ConstSpan<int> nodeIds) override {
+        // No elements is a single zero offset; point at a constant rather
+        // than at elementOffsets, which is overwritten from offsets below
+        static const std::uint64_t kNoElements[1] = {0};
+        if (offsets.empty()) {
+            offsets = ConstSpan<std::uint64_t>(kNoElements, 1);
+        }
+        if (offsets[0] != 0 || offsets[offsets.size() - 1] != nodeIds.size()) {
+            throw std::invalid_argument("FlatMeshStorage: offsets do not span connectivity");
+        }
+        for (size_t e = 0; e + 1 < offsets.size(); ++e) {
+            if (offsets[e] > offsets[e + 1]) {
+                throw std::invalid_argument("FlatMeshStorage: offsets must be non-decreasing");
+            }
+        }
+        const int N = static_cast<int>(nodeCount());
+        for (int n : nodeIds) {
+            if (n < 0 || n >= N) throw std::out_of_range("FlatMeshStorage: node id out of range");
+        }
+        std::cout << "Flat Storage: CSR connectivity for " << offsets.size() - 1
+                  << " elements (" << nodeIds.size() << " node refs)\n";
+        elementOffsets.assign(offsets.begin(), offsets.end());
+        elementNodes.assign(nodeIds.begin(), nodeIds.end());
+        buildNodeToElement();
+    }
+
+    void storeBoundaryConditions(const std::string& type, const std::vector<int>& nodeIds) override {
+        std::cout << "Flat Storage: Boundary condition '" << type << "' ("
+                  << nodeIds.size() << " nodes)\n";
+        boundarySets[type] = nodeIds;
+    }
+
+    size_t getMemoryUsage() const override {
+        size_t mem = coordinates.capacity() * sizeof(double)
+                   + (elementOffsets.capacity() + nodeElementOffsets.capacity()) * sizeof(std::uint64_t)
+                   + (elementNodes.capacity() + nodeElements.capacity()) * sizeof(int);
+        for (const auto& set : boundarySets) mem += set.second.capacity() * sizeof(int);
+        return mem + sizeof(*this);
+    }
+
+    // Renumber nodes and elements. newNodeId maps old -> new node index;
+    // elementOrder lists old element indices in their new order.
+    void applyPermutation(const std::vector<int>& newNodeId, const std::vector<int>& elementOrder) {
+        const size_t N = nodeCount();
+        const size_t E = elementCount();
+        if (newNodeId.size() != N || elementOrder.size() != E) {
+            throw std::invalid_argument("FlatMeshStorage: permutation size mismatch");
+        }
+
+        std::vector<double> xyz(coordinates.size());
+        for (size_t n = 0; n < N; ++n) {
+            std::copy_n(&coordinates[3 * n], 3, &xyz[3 * static_cast<size_t>(newNodeId[n])]);
+        }
+
+        std::vector<std::uint64_t> offsets(E + 1, 0);
+        std::vector<int> ids(elementNodes.size());
+        for (size_t k = 0; k < E; ++k) {
+            const int e = elementOrder[k];
+            std::uint64_t out = offsets[k];
+            for (std::uint64_t i = elementOffsets[e]; i < elementOffsets[e + 1]; ++i) {
+                ids[out++] = newNodeId[elementNodes[i]];
+            }
+            offsets[k + 1] = out;
+        }
+
+        coordinates.swap(xyz);
+        elementOffsets.swap(offsets);
+        elementNodes.swap(ids);
+        for (auto& set : boundarySets) {
+            for (int& n : set.second) n = newNodeId[n];
+        }
+        buildNodeToElement();
+    }
+
+    // Renumber nodes along the chosen ordering, then sort elements by their
+    // lowest node so both traversal directions walk memory mostly forward
+    void reorder(MeshOrdering ordering) {
+        const size_t N = nodeCount();
+        const size_t E = elementCount();
+        const std::vector<int> order = ordering == MeshOrdering::ReverseCuthillMcKee
+                                     ? reverseCuthillMcKeeOrder() : hilbertOrder();
+        std::vector<int> newNodeId(N);
+        for (size_t i = 0; i < N; ++i) newNodeId[order[i]] = static_cast<int>(i);
+
+        // Counting sort on the smallest renumbered node of each element
+        std::vector<int> key(E, 0);
+        std::vector<size_t> bucket(N + 2, 0);
+        for (size_t e = 0; e < E; ++e) {
+            int lowest = static_cast<int>(N);  // Empty elements sort last
+            for (std::uint64_t k = elementOffsets[e]; k < elementOffsets[e + 1]; ++k) {
+                lowest = std::min(lowest, newNodeId[elementNodes[k]]);
+            }
+            key[e] = lowest;
+            ++bucket[lowest + 1];
+        }
+        std::partial_sum(bucket.begin(), bucket.end(), bucket.begin());
+        std::vector<int> elementOrder(E);
+        for (size_t e = 0; e < E; ++e) elementOrder[bucket[key[e]]++] = static_cast<int>(e);
+        applyPermutation(newNodeId, elementOrder);
+    }
+
+    // Largest node-index spread inside one element; the bandwidth of the
+    // assembled stiffness matrix and a proxy for gather locality
+    int bandwidth() const {
+        int width = 0;
+        for (size_t e = 0; e < elementCount(); ++e) {
+            if (elementOffsets[e] == elementOffsets[e + 1]) continue;
+            const auto range = std::minmax_element(elementNodes.begin() + elementOffsets[e],
+                                                   elementNodes.begin() + elementOffsets[e + 1]);
+            width = std::max(width, *range.second - *range.first);
+        }
+        return width;
+    }
+
+    const std::vector<int>& getBoundarySet(const std::string& type) const {
+        static const std::vector<int> empty;
+        auto it = boundarySets.find(type);
+        return it == boundarySets.end() ? empty : it->second;
+    }
+
+    MeshView view() const {
+        MeshView v;
+        v.nodeCount = nodeCount();
+        v.elementCount = elementCount();
+        v.coordinates = coordinates.data();
+        v.elementOffsets = elementOffsets.data();
+        v.elementNodes = elementNodes.data();
+        v.nodeElementOffsets = nodeElementOffsets.data();
+        v.nodeElements = nodeElements.data();
+        return v;
+    }
+
+    // Dump the arrays in the layout MappedMeshStorage opens in place
+    void writeTo(const std::string& path) const {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("FlatMeshStorage: cannot write " + path);
+        FlatMeshFileHeader header;
+        std::memcpy(header.magic, kFlatMeshMagic, sizeof(header.magic));
+        header.nodeCount = nodeCount();
+        header.elementCount = elementCount();
+        header.connectivitySize = elementNodes.size();
+        auto put = [&out](const void* p, size_t bytes) {
+            out.write(static_cast<const char*>(p), static_cast<std::streamsize>(bytes));
+        };
+        put(&header, sizeof(header));
+        put(elementOffsets.data(), elementOffsets.size() * sizeof(std::uint64_t));
+        put(nodeElementOffsets.data(), nodeElementOffsets.size() * sizeof(std::uint64_t));
+        put(coordinates.data(), coordinates.size() * sizeof(double));
+        put(elementNodes.data(), elementNodes.size() * sizeof(int));
+        put(nodeElements.data(), nodeElements.size() * sizeof(int));
+        if (!out) throw std::runtime_error("FlatMeshStorage: short write to " + path);
+    }
+};
+
+// Concrete implementation - A FlatMeshStorage file mapped read-only.
+// Opening validates the header and sets pointers; pages are faulted in by
+// the first traversal, so large meshes open without reading or parsing.
+class MappedMeshStorage : public MeshStorageBackend {
+private:
+    const unsigned char* base = nullptr;
+    size_t mappedBytes = 0;
+    std::vector<unsigned char> fallbackBuffer;  // Platforms without mmap
+    MeshView mesh;
+    std::map<std::string, std::vector<int>> boundarySets;
+
+    void release() {
+#ifdef MESH_HAVE_MMAP
+        if (base && fallbackBuffer.empty()) {
+            munmap(const_cast<unsigned char*>(base), mappedBytes);
+        }
+#endif
+        base = nullptr;
+        mappedBytes = 0;
+    }
+
+    void bindArrays() {
+        if (mappedBytes < sizeof(FlatMeshFileHeader)) {
+            throw std::runtime_error("MappedMeshStorage: file too small");
+        }
+        FlatMeshFileHeader header;
+        std::memcpy(&header, base, sizeof(header));
+        if (std::memcmp(header.magic, kFlatMeshMagic, sizeof(header.magic)) != 0) {
+            throw std::runtime_error("MappedMeshStorage: not a flat mesh file");
+        }
+        if (flatMeshFileSize(header) != mappedBytes) {
+            throw std::runtime_error("MappedMeshStorage: size does not match header");
+        }
+        const unsigned char* p = base + sizeof(header);
+        mesh.nodeCount = header.nodeCount;
+        mesh.elementCount = header.elementCount;
+        mesh.elementOffsets = reinterpret_cast<const std::uint64_t*>(p);
+        p += (header.elementCount + 1) * sizeof(std::uint64_t);
+        mesh.nodeElementOffsets = reinterpret_cast<const std::uint64_t*>(p);
+        p += (header.nodeCount + 1) * sizeof(std::uint64_t);
+        mesh.coordinates = reinterpret_cast<const double*>(p);
+        p += 3 * header.nodeCount * sizeof(double);
+        mesh.elementNodes = reinterpret_cast<const int*>(p);
+        p += header.connectivitySize * sizeof(int);
+        mesh.nodeElements = reinterpret_cast<const int*>(p);
+    }
+
+public:
+    explicit MappedMeshStorage(const std::string& path) {
+#ifdef MESH_HAVE_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("MappedMeshStorage: cannot open " + path);
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            throw std::runtime_error("MappedMeshStorage: cannot stat " + path);
+        }
+        mappedBytes = static_cast<size_t>(st.st_size);
+        void* addr = mmap(nullptr, mappedBytes, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) throw std::runtime_error("MappedMeshStorage: mmap failed for " + path);
+        base = static_cast<const unsigned char*>(addr);
+#else
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) throw std::runtime_error("MappedMeshStorage: cannot open " + path);
+        fallbackBuffer.resize(static_cast<size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(fallbackBuffer.data()),
+                static_cast<std::streamsize>(fallbackBuffer.size()));
+        base = fallbackBuffer.data();
+        mappedBytes = fallbackBuffer.size();
+#endif
+        try {
+            bindArrays();
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    ~MappedMeshStorage() override { release(); }
+
+    MappedMeshStorage(const MappedMeshStorage&) = delete;
+    MappedMeshStorage& operator=(const MappedMeshStorage&) = delete;
+
+    void storeNodes(const std::vector<std::vector<double>>&) override {
+        throw std::logic_error("MappedMeshStorage: geometry is read-only");
+    }
+
+    void storeElements(const std::vector<std::vector<int>>&) override {
+        throw std::logic_error("MappedMeshStorage: connectivity is read-only");
+    }
+
+    void ingestNodes(ConstSpan<double>) override {
+        throw std::logic_error("MappedMeshStorage: geometry is read-only");
+    }
+
+    void ingestElements(ConstSpan<std::uint64_t>, ConstSpan<int>) override {
+        throw std::logic_error("MappedMeshStorage: connectivity is read-only");
+    }
+
+    void storeBoundaryConditions(const std::string& type, const std::vector<int>& nodeIds) override {
+        std::cout << "Mapped Storage: Boundary condition '" << type << "' ("
+                  << nodeIds.size() << " nodes)\n";
+        boundarySets[type] = nodeIds;
+    }
+
+    // Heap footprint only; the mapped file is backed by the page cache
+    size_t getMemoryUsage() const override {
+        size_t mem = fallbackBuffer.capacity();
+        for (const auto& set : boundarySets) mem += set.second.capacity() * sizeof(int);
+        return mem + sizeof(*this);
+    }
+
+    size_t getMappedBytes() const { return mappedBytes; }
+    MeshView view() const { return mesh; }
+};
+
+// Connectivity traversal typical of FV/FE codes: gather coordinates into
+// element centroids, then scatter-free average of incident centroids back
+// to every node. Returns a checksum so orderings can be compared.
+inline double nodalCentroidAverage(const MeshView& m, std::vector<double>& centroids,
+                                   std::vector<double>& nodal) {
+    centroids.assign(3 * m.elementCount, 0.0);
+    nodal.assign(3 * m.nodeCount, 0.0);
+    for (size_t e = 0; e < m.elementCount; ++e) {
+        double c[3] = {0.0, 0.0, 0.0};
+        const std::uint64_t begin = m.elementOffsets[e];
+        const std::uint64_t end = m.elementOffsets[e + 1];
+        for (std::uint64_t k = begin; k < end; ++k) {
+            const double* x = m.coordinates + 3 * static_cast<size_t>(m.elementNodes[k]);
+            c[0] += x[0];
+            c[1] += x[1];
+            c[2] += x[2];
+        }
+        const double inv = end > begin ? 1.0 / static_cast<double>(end - begin) : 0.0;
+        for (int d = 0; d < 3; ++d) centroids[3 * e + d] = c[d] * inv;
+    }
+    double checksum = 0.0;
+    for (size_t n = 0; n < m.nodeCount; ++n) {
+        double s[3] = {0.0, 0.0, 0.0};
+        const std::uint64_t begin = m.nodeElementOffsets[n];
+        const std::uint64_t end = m.nodeElementOffsets[n + 1];
+        for (std::uint64_t k = begin; k < end; ++k) {
+            const double* c = &centroids[3 * static_cast<size_t>(m.nodeElements[k])];
+            s[0] += c[0];
+            s[1] += c[1];
+            s[2] += c[2];
+        }
+        const double inv = end > begin ? 1.0 / static_cast<double>(end - begin) : 0.0;
+        for (int d = 0; d < 3; ++d) {
+            nodal[3 * n + d] = s[d] * inv;
+            checksum += nodal[3 * n + d];
+        }
+    }
+    return checksum;
+}
+
 // Abstraction - Computational mesh interface
 class ComputationalMesh {
 protected:
@@ -130,24 +748,38 @@ public:
         std::cout << "Elements: " << elementsPerDim << "^3 = " 
                   << elementsPerDim * elementsPerDim * elementsPerDim << "\n\n";
         
-        // Generate nodes
-        std::vector<std::vector<double>> nodes;
+        // Generate nodes straight into a flat xyz buffer
+        const int n = elementsPerDim + 1;
+        std::vector<double> nodes;
+        nodes.reserve(3 * static_cast<size_t>(n) * n * n);
         for (int k = 0; k <= elementsPerDim; ++k) {
             for (int j = 0; j <= elementsPerDim; ++j) {
                 for (int i = 0; i <= elementsPerDim; ++i) {
-                    nodes.push_back({
-                        i * length / elementsPerDim,
-                        j * width / elementsPerDim,
-                        k * height / elementsPerDim
-                    });
+                    nodes.push_back(i * length / elementsPerDim);
+                    nodes.push_back(j * width / elementsPerDim);
+                    nodes.push_back(k * height / elementsPerDim);
                 }
             }
         }
-        storage->storeNodes(nodes);
+        storage->ingestNodes(nodes);
         
-        // Generate elements (if unstructured)
-        std::vector<std::vector<int>> elements;
-        storage->storeElements(elements);
+        // Hexahedral connectivity in CSR form (ignored by structured storage)
+        std::vector<std::uint64_t> offsets{0};
+        std::vector<int> elements;
+        elements.reserve(8 * static_cast<size_t>(elementsPerDim) * elementsPerDim * elementsPerDim);
+        auto id = [n](int i, int j, int k) { return i + n * (j + n * k); };
+        for (int k = 0; k < elementsPerDim; ++k) {
+            for (int j = 0; j < elementsPerDim; ++j) {
+                for (int i = 0; i < elementsPerDim; ++i) {
+                    const int hex[8] = {id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k), id(i, j + 1, k),
+                                        id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1),
+                                        id(i, j + 1, k + 1)};
+                    elements.insert(elements.end(), hex, hex + 8);
+                    offsets.push_back(elements.size());
+                }
+            }
+        }
+        storage->ingestElements(offsets, elements);
     }
     
     void applyBoundaryConditions() override {
@@ -188,27 +820,45 @@ public:
                   << axialElements << " axial\n\n";
         
         // Generate cylindrical mesh nodes
-        std::vector<std::vector<double>> nodes;
+        const int sectors = 8;  // Circumferential
+        std::vector<double> nodes;
+        nodes.reserve(3 * static_cast<size_t>(axialElements + 1) * (radialElements + 1) * sectors);
         double radius = diameter / 2.0;
         
         for (int i = 0; i <= axialElements; ++i) {
             double z = i * pipeLength / axialElements;
             for (int j = 0; j <= radialElements; ++j) {
                 double r = j * radius / radialElements;
-                for (int k = 0; k < 8; ++k) {  // Circumferential
-                    double theta = k * 2.0 * 3.14159 / 8;
-                    nodes.push_back({
-                        r * cos(theta),
-                        r * sin(theta),
-                        z
-                    });
+                for (int k = 0; k < sectors; ++k) {
+                    double theta = k * 2.0 * 3.14159 / sectors;
+                    nodes.push_back(r * cos(theta));
+                    nodes.push_back(r * sin(theta));
+                    nodes.push_back(z);
                 }
             }
         }
-        storage->storeNodes(nodes);
+        storage->ingestNodes(nodes);
         
-        std::vector<std::vector<int>> elements;
-        storage->storeElements(elements);
+        // Hexahedral cells between neighbouring rings and axial stations
+        std::vector<std::uint64_t> offsets{0};
+        std::vector<int> elements;
+        offsets.reserve(static_cast<size_t>(axialElements) * radialElements * sectors + 1);
+        elements.reserve(8 * static_cast<size_t>(axialElements) * radialElements * sectors);
+        const int rings = radialElements + 1;
+        auto id = [rings](int i, int j, int k) { return (i * rings + j) * sectors + k; };
+        for (int i = 0; i < axialElements; ++i) {
+            for (int j = 0; j < radialElements; ++j) {
+                for (int k = 0; k < sectors; ++k) {
+                    const int k1 = (k + 1) % sectors;
+                    const int hex[8] = {id(i, j, k), id(i, j + 1, k), id(i, j + 1, k1), id(i, j, k1),
+                                        id(i + 1, j, k), id(i + 1, j + 1, k), id(i + 1, j + 1, k1),
+                                        id(i + 1, j, k1)};
+                    elements.insert(elements.end(), hex, hex + 8);
+                    offsets.push_back(elements.size());
+                }
+            }
+        }
+        storage->ingestElements(offsets, elements);
     }
     
     void applyBoundaryConditions() override {
@@ -232,6 +882,86 @@ public:
     }
 };
 
+// Flat storage at scale: ingestion cost, reordering for locality, and a
+// memory-mapped reopen of the reordered mesh
+void flatStorageExample() {
+    std::cout << "\n=== Flat Storage Engine (CSR + Reordering + mmap) ===\n\n";
+    using Clock = std::chrono::steady_clock;
+    auto msSince = [](Clock::time_point t0) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    };
+
+    const int radial = 40;
+    const int axial = 2000;
+
+    auto nested = std::make_shared<UnstructuredMeshStorage>();
+    auto t0 = Clock::now();
+    CFDFluidMesh(0.1, 2.0, radial, axial, nested).generateMesh();
+    const double nestedMs = msSince(t0);
+
+    auto flat = std::make_shared<FlatMeshStorage>();
+    t0 = Clock::now();
+    CFDFluidMesh(0.1, 2.0, radial, axial, flat).generateMesh();
+    const double flatMs = msSince(t0);
+
+    std::cout << "\nIngestion: nested vectors " << nestedMs << " ms, flat CSR "
+              << flatMs << " ms\n";
+    std::cout << "Footprint: flat " << flat->getMemoryUsage() / (1024 * 1024)
+              << " MiB incl. node->element map\n";
+
+    // Mesh files from generators and partitioners rarely arrive in a
+    // cache-friendly numbering; scramble to model that input
+    const MeshView initial = flat->view();
+    std::mt19937 rng(2024);
+    std::vector<int> newNodeId(initial.nodeCount);
+    std::iota(newNodeId.begin(), newNodeId.end(), 0);
+    std::shuffle(newNodeId.begin(), newNodeId.end(), rng);
+    std::vector<int> elementOrder(initial.elementCount);
+    std::iota(elementOrder.begin(), elementOrder.end(), 0);
+    std::shuffle(elementOrder.begin(), elementOrder.end(), rng);
+    flat->applyPermutation(newNodeId, elementOrder);
+
+    std::vector<double> centroids, nodal;
+    auto timeSweeps = [&](const MeshView& m, double& checksum) {
+        const int sweeps = 5;
+        auto start = Clock::now();
+        for (int s = 0; s < sweeps; ++s) checksum = nodalCentroidAverage(m, centroids, nodal);
+        return msSince(start) / sweeps;
+    };
+
+    std::cout << "\nCentroid gather/average sweep (" << initial.elementCount << " hexes, "
+              << initial.nodeCount << " nodes):\n";
+    double checksum = 0.0;
+    double ms = timeSweeps(flat->view(), checksum);
+    std::cout << "  Scrambled: bandwidth " << flat->bandwidth() << ", " << ms
+              << " ms/sweep, checksum " << checksum << "\n";
+
+    flat->reorder(MeshOrdering::HilbertCurve);
+    ms = timeSweeps(flat->view(), checksum);
+    std::cout << "  Hilbert:   bandwidth " << flat->bandwidth() << ", " << ms
+              << " ms/sweep, checksum " << checksum << "\n";
+
+    t0 = Clock::now();
+    flat->reorder(MeshOrdering::ReverseCuthillMcKee);
+    const double rcmMs = msSince(t0);
+    ms = timeSweeps(flat->view(), checksum);
+    std::cout << "  RCM:       bandwidth " << flat->bandwidth() << ", " << ms
+              << " ms/sweep, checksum " << checksum << " (reorder " << rcmMs << " ms)\n";
+
+    const std::string path = "pipe_mesh.flat";
+    flat->writeTo(path);
+    t0 = Clock::now();
+    {
+        MappedMeshStorage mapped(path);
+        const double openMs = msSince(t0);
+        std::cout << "\nMapped " << mapped.getMappedBytes() / (1024 * 1024) << " MiB in "
+                  << openMs << " ms (heap " << mapped.getMemoryUsage() << " bytes)\n";
+        ms = timeSweeps(mapped.view(), checksum);
+        std::cout << "  Mapped RCM sweep: " << ms << " ms/sweep, checksum " << checksum << "\n";
+    }
+    std::remove(path.c_str());
+}
+
 int main() {
     std::cout << "=== Computational Mesh Bridge Pattern Demo ===\n\n";
     
@@ -267,8 +997,14 @@ int main() {
     beamUnstructured.generateMesh();
     beamUnstructured.reportMemoryUsage();
     
-    std::cout << "Bridge pattern allows switching between structured and\n";
+    FEMStructuralMesh beamFlat(10.0, 1.0, 1.0, 20, std::make_shared<FlatMeshStorage>());
+    beamFlat.generateMesh();
+    beamFlat.reportMemoryUsage();
+
+    flatStorageExample();
+
+    std::cout << "\nBridge pattern allows switching between structured and\n";
     std::cout << "unstructured storage without changing mesh algorithms!\n";
     
     return 0;
-}
\ No newline at end of file
+}
@@ -5,9 +5,43 @@
 #include <memory>
 #include <algorithm>
 #include <string>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+class RegionDomain;
 
 // Component interface - Computational domain element
 class ComputationalDomain {
+protected:
+    RegionDomain* parent_ = nullptr;  // Non-owning back link, maintained by RegionDomain
+    uint64_t revision_ = 0;           // Bumped whenever this subtree changes shape
+    friend class RegionDomain;
+    
+    static std::atomic<bool>& tracingFlag() {
+        static std::atomic<bool> flag(true);
+        return flag;
+    }
+    
+    static bool tracing() { return tracingFlag().load(std::memory_order_relaxed); }
+    
+    // Whole-message writes so parallel traversals do not interleave lines
+    static void trace(const std::string& text) {
+        static std::mutex consoleMutex;
+        std::lock_guard<std::mutex> lock(consoleMutex);
+        std::cout << text;
+    }
+    
 public:
     virtual ~ComputationalDomain() = default;
     virtual void computePhysics(double timeStep) = 0;
@@ -20,6 +54,16 @@ public:
     virtual void addSubdomain(std::shared_ptr<ComputationalDomain> subdomain) {}
     virtual void removeSubdomain(std::shared_ptr<ComputationalDomain> subdomain) {}
     virtual std::shared_ptr<ComputationalDomain> getSubdomain(int index) { return nullptr; }
+    virtual size_t getSubdomainCount() const { return 0; }
+    
+    // Post-children step of a time step (halo exchange for regions)
+    virtual void exchangeBoundaryData(double) {}
+    
+    RegionDomain* getParent() const { return parent_; }
+    uint64_t getRevision() const { return revision_; }
+    
+    // Large trees switch off per-element logging
+    static void setTracing(bool enabled) { tracingFlag().store(enabled); }
 };
 
 // Leaf node - Single physics element (cannot be subdivided)
@@ -30,18 +74,53 @@ private:
     double volume_;
     int nodesPerElement_;
     std::string physicsModel_;
+    std::vector<double> state_;    // One value per DOF
+    std::vector<double> scratch_;
+    
+    // Dense element operator applied to the local state: O(DOFs^2), which is
+    // what getComputationalCost() models
+    void relaxState(double timeStep) {
+        const size_t n = state_.size();
+        const double relaxation = timeStep / (timeStep + 3600.0);
+        scratch_.resize(n);
+        for (size_t r = 0; r < n; ++r) {
+            double acc = 0.0, weight = 0.0;
+            for (size_t c = 0; c < n; ++c) {
+                const double k = 1.0 / (1.0 + std::fabs(static_cast<double>(r) - static_cast<double>(c)));
+                acc += k * state_[c];
+                weight += k;
+            }
+            scratch_[r] = state_[r] + relaxation * (acc / weight - state_[r]);
+        }
+        state_.swap(scratch_);
+    }
     
 public:
     ElementDomain(const std::string& type, int id, double volume, 
                   int nodes, const std::string& physics)
         : elementType_(type), elementId_(id), volume_(volume), 
-          nodesPerElement_(nodes), physicsModel_(physics) {}
+          nodesPerElement_(nodes), physicsModel_(physics) {
+        state_.resize(static_cast<size_t>(nodes) * 3);
+        for (size_t i = 0; i < state_.size(); ++i) {
+            state_[i] = std::sin(0.37 * id + 0.11 * static_cast<double>(i));
+        }
+    }
     
     void computePhysics(double timeStep) override {
-        std::cout << "Element " << elementId_ << ": Computing " << physicsModel_ 
-                  << " (dt=" << timeStep << "s)\n";
-        std::cout << "  Solving on " << nodesPerElement_ << " nodes\n";
-        std::cout << "  Volume: " << volume_ << " m³\n";
+        relaxState(timeStep);
+        if (!tracing()) return;
+        std::ostringstream out;
+        out << "Element " << elementId_ << ": Computing " << physicsModel_ 
+            << " (dt=" << timeStep << "s)\n";
+        out << "  Solving on " << nodesPerElement_ << " nodes\n";
+        out << "  Volume: " << volume_ << " m³\n";
+        trace(out.str());
+    }
+    
+    double stateSum() const {
+        double sum = 0.0;
+        for (double v : state_) sum += v;
+        return sum;
     }
     
     void displayHierarchy(int depth) const override {
@@ -70,20 +149,57 @@ private:
     std::string decompositionMethod_;
     std::vector<std::shared_ptr<ComputationalDomain>> subdomains_;
     int mpiRank_;  // MPI process assignment
+    double cachedDOFs_ = 0.0;
+    double cachedCost_ = 0.0;
+    
+    // Recompute this region's totals from its children's cached values and
+    // walk up to the root: O(depth * fan-out) per tree mutation instead of a
+    // full subtree walk on every query
+    void refreshAggregates() {
+        double dofs = 0.0, cost = 0.0;
+        for (const auto& subdomain : subdomains_) {
+            dofs += subdomain->getTotalDOFs();
+            cost += subdomain->getComputationalCost();
+        }
+        // Add communication overhead
+        cost += subdomains_.size() * 100;  // Inter-subdomain communication
+        cachedDOFs_ = dofs;
+        cachedCost_ = cost;
+        ++revision_;
+        if (parent_) parent_->refreshAggregates();
+    }
     
 public:
     RegionDomain(const std::string& name, const std::string& method, int rank)
         : regionName_(name), decompositionMethod_(method), mpiRank_(rank) {}
     
+    ~RegionDomain() override {
+        for (const auto& subdomain : subdomains_) subdomain->parent_ = nullptr;
+    }
+    
+    // A domain belongs to at most one region, so cached totals have exactly
+    // one path to invalidate
     void addSubdomain(std::shared_ptr<ComputationalDomain> subdomain) override {
+        if (!subdomain) {
+            throw std::invalid_argument("RegionDomain: null subdomain");
+        }
+        if (subdomain->parent_) {
+            throw std::invalid_argument("RegionDomain: subdomain already belongs to a region");
+        }
+        for (const ComputationalDomain* d = this; d; d = d->parent_) {
+            if (d == subdomain.get()) throw std::invalid_argument("RegionDomain: cycle in domain tree");
+        }
+        subdomain->parent_ = this;
         subdomains_.push_back(subdomain);
+        refreshAggregates();
     }
     
     void removeSubdomain(std::shared_ptr<ComputationalDomain> subdomain) override {
-        subdomains_.erase(
-            std::remove(subdomains_.begin(), subdomains_.end(), subdomain),
-            subdomains_.end()
-        );
+        auto it = std::find(subdomains_.begin(), subdomains_.end(), subdomain);
+        if (it == subdomains_.end()) return;
+        (*it)->parent_ = nullptr;
+        subdomains_.erase(it);
+        refreshAggregates();
     }
     
     std::shared_ptr<ComputationalDomain> getSubdomain(int index) override {
@@ -93,18 +209,31 @@ public:
         return nullptr;
     }
     
+    size_t getSubdomainCount() const override { return subdomains_.size(); }
+    
     void computePhysics(double timeStep) override {
-        std::cout << "\nRegion '" << regionName_ << "' (MPI Rank " << mpiRank_ << "):\n";
-        std::cout << "Decomposition: " << decompositionMethod_ << "\n";
+        if (tracing()) {
+            std::ostringstream out;
+            out << "\nRegion '" << regionName_ << "' (MPI Rank " << mpiRank_ << "):\n";
+            out << "Decomposition: " << decompositionMethod_ << "\n";
+            trace(out.str());
+        }
         
         // Compute all subdomains
         for (const auto& subdomain : subdomains_) {
             subdomain->computePhysics(timeStep);
         }
         
-        // Exchange boundary data between subdomains
-        std::cout << "Exchanging boundary data between " << subdomains_.size() 
-                  << " subdomains\n";
+        exchangeBoundaryData(timeStep);
+    }
+    
+    // Exchange boundary data between subdomains
+    void exchangeBoundaryData(double) override {
+        if (!tracing()) return;
+        std::ostringstream out;
+        out << "Exchanging boundary data between " << subdomains_.size() 
+            << " subdomains\n";
+        trace(out.str());
     }
     
     void displayHierarchy(int depth) const override {
@@ -116,25 +245,360 @@ public:
         }
     }
     
-    double getTotalDOFs() const override {
-        double totalDOFs = 0;
-        for (const auto& subdomain : subdomains_) {
-            totalDOFs += subdomain->getTotalDOFs();
+    double getTotalDOFs() const override { return cachedDOFs_; }
+    
+    double getComputationalCost() const override { return cachedCost_; }
+};
+
+// Fork-join worker pool (same design as the ScientificThreadPool in pattern
+// 30, cut down to a blocking parallelFor); the calling thread takes part
+class ForkJoinPool {
+private:
+    std::vector<std::thread> workers_;
+    std::mutex submit_;    // One parallelFor at a time when callers share the pool
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    
+    const std::function<void(size_t, size_t)>* job_ = nullptr;
+    size_t jobSize_ = 0;
+    size_t grain_ = 1;
+    std::atomic<size_t> next_{0};
+    size_t active_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+    
+    void runChunks() {
+        size_t begin;
+        while ((begin = next_.fetch_add(grain_)) < jobSize_) {
+            try {
+                (*job_)(begin, std::min(begin + grain_, jobSize_));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) error_ = std::current_exception();
+            }
         }
-        return totalDOFs;
     }
     
-    double getComputationalCost() const override {
-        double totalCost = 0;
-        for (const auto& subdomain : subdomains_) {
-            totalCost += subdomain->getComputationalCost();
+    void workerLoop() {
+        uint64_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+            }
+            runChunks();
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0) done_.notify_one();
         }
-        // Add communication overhead
-        totalCost += subdomains_.size() * 100;  // Inter-subdomain communication
-        return totalCost;
+    }
+    
+public:
+    explicit ForkJoinPool(size_t threads = std::thread::hardware_concurrency()) {
+        for (size_t i = 1; i < std::max<size_t>(threads, 1); ++i) {
+            workers_.emplace_back(&ForkJoinPool::workerLoop, this);
+        }
+    }
+    
+    ~ForkJoinPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+    
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+    
+    size_t size() const { return workers_.size() + 1; }
+    
+    // Calls body(begin, end) over [0, count) in chunks of grain items
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) {
+        if (workers_.empty() || count <= grain) {
+            if (count > 0) body(0, count);
+            return;
+        }
+        std::lock_guard<std::mutex> submitLock(submit_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &body;
+            jobSize_ = count;
+            grain_ = std::max<size_t>(grain, 1);
+            next_.store(0);
+            active_ = workers_.size();
+            error_ = nullptr;
+            ++generation_;
+        }
+        wake_.notify_all();
+        runChunks();
+        
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return active_ == 0; });
+        job_ = nullptr;
+        if (error_) std::rethrow_exception(error_);
+    }
+};
+
+// Parallel time step over a domain tree. Leaves are independent, so they are
+// spread over workers by longest-processing-time on getComputationalCost();
+// each region runs its boundary exchange as soon as its last child finishes,
+// on whichever worker finished it. The flattened plan is kept until the
+// root's revision changes, i.e. until the tree is mutated.
+class ParallelDomainExecutor {
+private:
+    ForkJoinPool pool_;
+    const ComputationalDomain* planRoot_ = nullptr;
+    uint64_t planRevision_ = 0;
+    size_t planBuilds_ = 0;
+    
+    std::vector<ComputationalDomain*> domains_;  // Pre-order
+    std::vector<int> parentIndex_;
+    std::vector<int> childCount_;
+    std::vector<std::vector<int>> bins_;         // Leaf indices per worker bin
+    std::vector<double> binCost_;
+    std::unique_ptr<std::atomic<int>[]> pending_;
+    
+    void buildPlan(ComputationalDomain& root) {
+        domains_.clear();
+        parentIndex_.clear();
+        childCount_.clear();
+        
+        std::vector<std::pair<ComputationalDomain*, int>> stack{{&root, -1}};
+        std::vector<std::pair<double, int>> leaves;
+        while (!stack.empty()) {
+            ComputationalDomain* domain = stack.back().first;
+            const int parent = stack.back().second;
+            stack.pop_back();
+            const int index = static_cast<int>(domains_.size());
+            domains_.push_back(domain);
+            parentIndex_.push_back(parent);
+            const size_t children = domain->getSubdomainCount();
+            childCount_.push_back(static_cast<int>(children));
+            if (domain->isLeaf()) leaves.push_back({domain->getComputationalCost(), index});
+            for (size_t c = children; c-- > 0;) {
+                stack.push_back({domain->getSubdomain(static_cast<int>(c)).get(), index});
+            }
+        }
+        
+        // LPT: heaviest leaf first onto the currently lightest bin
+        const size_t binCount = pool_.size();
+        bins_.assign(binCount, std::vector<int>());
+        binCost_.assign(binCount, 0.0);
+        std::stable_sort(leaves.begin(), leaves.end(),
+                         [](const std::pair<double, int>& a, const std::pair<double, int>& b) {
+                             return a.first > b.first;
+                         });
+        typedef std::pair<double, size_t> Load;
+        std::priority_queue<Load, std::vector<Load>, std::greater<Load>> lightest;
+        for (size_t b = 0; b < binCount; ++b) lightest.push({0.0, b});
+        for (const auto& leaf : leaves) {
+            Load load = lightest.top();
+            lightest.pop();
+            bins_[load.second].push_back(leaf.second);
+            binCost_[load.second] += leaf.first;
+            lightest.push({binCost_[load.second], load.second});
+        }
+        // Tree order within a bin keeps sibling elements adjacent in memory
+        for (auto& bin : bins_) std::sort(bin.begin(), bin.end());
+        
+        pending_.reset(new std::atomic<int>[domains_.size()]);
+        planRoot_ = &root;
+        planRevision_ = root.getRevision();
+        ++planBuilds_;
+    }
+    
+    // Mark a domain done and run every ancestor whose last child this was
+    void complete(int index, double timeStep) {
+        for (int p = parentIndex_[index]; p >= 0; p = parentIndex_[p]) {
+            if (pending_[p].fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+            domains_[p]->exchangeBoundaryData(timeStep);
+        }
+    }
+    
+public:
+    explicit ParallelDomainExecutor(size_t threads = std::thread::hardware_concurrency())
+        : pool_(threads) {}
+    
+    // The tree must not be mutated while a step is running
+    void computePhysics(ComputationalDomain& root, double timeStep) {
+        if (planRoot_ != &root || planRevision_ != root.getRevision()) buildPlan(root);
+        for (size_t i = 0; i < domains_.size(); ++i) {
+            pending_[i].store(childCount_[i], std::memory_order_relaxed);
+        }
+        
+        // Regions without children finish immediately, deepest first
+        for (size_t i = domains_.size(); i-- > 0;) {
+            if (!domains_[i]->isLeaf() && childCount_[i] == 0) {
+                domains_[i]->exchangeBoundaryData(timeStep);
+                complete(static_cast<int>(i), timeStep);
+            }
+        }
+        
+        pool_.parallelFor(bins_.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                for (int leaf : bins_[b]) {
+                    domains_[leaf]->computePhysics(timeStep);
+                    complete(leaf, timeStep);
+                }
+            }
+        });
+    }
+    
+    size_t getWorkerCount() const { return pool_.size(); }
+    size_t getPlanBuilds() const { return planBuilds_; }
+    
+    // Heaviest bin over the mean bin; 1.0 is a perfect split
+    double getImbalance() const {
+        if (binCost_.empty()) return 1.0;
+        double total = 0.0, heaviest = 0.0;
+        for (double c : binCost_) {
+            total += c;
+            heaviest = std::max(heaviest, c);
+        }
+        return total > 0.0 ? heaviest * binCost_.size() / total : 1.0;
     }
 };
 
+// Full subtree walk: what every getTotalDOFs() query cost before caching
+double recountDOFs(ComputationalDomain& domain) {
+    if (domain.isLeaf()) return domain.getTotalDOFs();
+    double total = 0.0;
+    for (size_t i = 0; i < domain.getSubdomainCount(); ++i) {
+        total += recountDOFs(*domain.getSubdomain(static_cast<int>(i)));
+    }
+    return total;
+}
+
+void collectLeaves(ComputationalDomain& domain, std::vector<ComputationalDomain*>& leaves) {
+    if (domain.isLeaf()) {
+        leaves.push_back(&domain);
+        return;
+    }
+    for (size_t i = 0; i < domain.getSubdomainCount(); ++i) {
+        collectLeaves(*domain.getSubdomain(static_cast<int>(i)), leaves);
+    }
+}
+
+double leafStateChecksum(ComputationalDomain& root) {
+    std::vector<ComputationalDomain*> leaves;
+    collectLeaves(root, leaves);
+    double sum = 0.0;
+    for (auto* leaf : leaves) sum += static_cast<ElementDomain*>(leaf)->stateSum();
+    return sum;
+}
+
+// Four ocean basins, each split into regional and sub-regional domains with
+// a random mix of element sizes; the first basin is eddy-resolving, so cost
+// is concentrated in one corner of the tree as in multi-resolution runs
+std::shared_ptr<RegionDomain> buildClimateModel(unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> leafCount(6, 40);
+    auto global = std::make_shared<RegionDomain>("Coupled Climate Model", "Space-Filling Curve", 0);
+    int elementId = 0;
+    for (int b = 0; b < 4; ++b) {
+        auto basin = std::make_shared<RegionDomain>("Basin " + std::to_string(b), "Graph Partitioning", b);
+        std::uniform_int_distribution<int> nodeCount(4, b == 0 ? 64 : 16);
+        for (int r = 0; r < 8; ++r) {
+            auto region = std::make_shared<RegionDomain>("Region " + std::to_string(r), "Adaptive Refinement", b);
+            for (int s = 0; s < 12; ++s) {
+                auto sub = std::make_shared<RegionDomain>("Column " + std::to_string(s), "Uniform Decomposition", b);
+                const int leaves = leafCount(rng);
+                for (int e = 0; e < leaves; ++e) {
+                    sub->addSubdomain(std::make_shared<ElementDomain>(
+                        "Hexahedral", elementId++, 1e6, nodeCount(rng), "Primitive Equations"));
+                }
+                region->addSubdomain(sub);
+            }
+            basin->addSubdomain(region);
+        }
+        global->addSubdomain(basin);
+    }
+    return global;
+}
+
+void parallelTraversalExample() {
+    std::cout << "\n=== Parallel Load-Balanced Domain Traversal ===\n";
+    using Clock = std::chrono::steady_clock;
+    auto msSince = [](Clock::time_point t0) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    };
+    ComputationalDomain::setTracing(false);
+    
+    auto serialModel = buildClimateModel(42);
+    auto parallelModel = buildClimateModel(42);
+    std::vector<ComputationalDomain*> leaves;
+    collectLeaves(*parallelModel, leaves);
+    std::cout << "Climate tree: " << leaves.size() << " elements, "
+              << parallelModel->getTotalDOFs() << " DOFs\n";
+    
+    // Cached aggregates versus recounting the whole tree per query
+    const int queries = 1000;
+    double sink = 0.0;
+    auto t0 = Clock::now();
+    for (int q = 0; q < queries; ++q) sink += parallelModel->getTotalDOFs();
+    const double cachedUs = msSince(t0) * 1000.0 / queries;
+    t0 = Clock::now();
+    for (int q = 0; q < queries; ++q) sink += recountDOFs(*parallelModel);
+    const double recountUs = msSince(t0) * 1000.0 / queries;
+    std::cout << "getTotalDOFs(): cached " << cachedUs << " us, full recount " << recountUs
+              << " us (agree: " << (sink == 2.0 * queries * parallelModel->getTotalDOFs() ? "yes" : "no")
+              << ")\n";
+    
+    ParallelDomainExecutor executor(4);
+    
+    // Splitting the pre-order leaf list into equal-count chunks ignores cost
+    const size_t workers = executor.getWorkerCount();
+    std::vector<double> chunkCost(workers, 0.0);
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        chunkCost[i * workers / leaves.size()] += leaves[i]->getComputationalCost();
+    }
+    double chunkTotal = 0.0, chunkMax = 0.0;
+    for (double c : chunkCost) {
+        chunkTotal += c;
+        chunkMax = std::max(chunkMax, c);
+    }
+    
+    const int steps = 3;
+    const double timeStep = 300.0;
+    t0 = Clock::now();
+    for (int s = 0; s < steps; ++s) serialModel->computePhysics(timeStep);
+    const double serialMs = msSince(t0) / steps;
+    t0 = Clock::now();
+    for (int s = 0; s < steps; ++s) executor.computePhysics(*parallelModel, timeStep);
+    const double parallelMs = msSince(t0) / steps;
+    
+    const double serialSum = leafStateChecksum(*serialModel);
+    const double parallelSum = leafStateChecksum(*parallelModel);
+    std::cout << "Workers: " << workers << " (hardware threads: "
+              << std::thread::hardware_concurrency() << ")\n";
+    std::cout << "Load imbalance (max/mean cost): LPT " << executor.getImbalance()
+              << ", equal-count split " << chunkMax * workers / chunkTotal << "\n";
+    std::cout << "Time step: serial " << serialMs << " ms, parallel " << parallelMs << " ms\n";
+    std::cout << "State checksum: serial " << serialSum << ", parallel " << parallelSum
+              << (serialSum == parallelSum ? " (identical)" : " (MISMATCH)") << "\n";
+    
+    // Mutating the tree refreshes cached totals along one path and forces a re-plan
+    auto basin = parallelModel->getSubdomain(3);
+    parallelModel->removeSubdomain(basin);
+    auto region = std::make_shared<RegionDomain>("Arctic Refinement", "Adaptive Refinement", 4);
+    for (int e = 0; e < 50; ++e) {
+        region->addSubdomain(std::make_shared<ElementDomain>(
+            "Prism", 90000 + e, 2e5, 18, "Sea Ice Dynamics"));
+    }
+    parallelModel->addSubdomain(region);
+    executor.computePhysics(*parallelModel, timeStep);
+    std::cout << "After replacing a basin: " << parallelModel->getTotalDOFs() << " DOFs cached, "
+              << recountDOFs(*parallelModel) << " recounted, plans built: "
+              << executor.getPlanBuilds() << "\n";
+    
+    ComputationalDomain::setTracing(true);
+}
+
 int main() {
     std::cout << "=== Multi-Scale Domain Decomposition Demo ===\n\n";
     
@@ -211,6 +675,8 @@ int main() {
     double timeStep = 300.0;  // 5 minutes
     globalDomain->computePhysics(timeStep);
     
+    parallelTraversalExample();
+    
     std::cout << "\nComposite pattern enables hierarchical domain decomposition\n";
     std::cout << "for efficient parallel computation in Earth system models!\n";
     
@@ -7,6 +7,10 @@
 #include <random>
 #include <cmath>
 #include <iomanip>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <chrono>
 
 // Flyweight interface - Shared molecular parameters
 class AtomType {
@@ -168,6 +172,10 @@ public:
         vx_ = vx; vy_ = vy; vz_ = vz;
     }
     
+    void drift(double dt) {
+        x_ += vx_ * dt; y_ += vy_ * dt; z_ += vz_ * dt;
+    }
+    
     void addBond(int atomId) {
         bondedAtoms_.push_back(atomId);
     }
@@ -199,16 +207,379 @@ public:
     double getX() const { return x_; }
     double getY() const { return y_; }
     double getZ() const { return z_; }
+    double getVX() const { return vx_; }
+    double getVY() const { return vy_; }
+    double getVZ() const { return vz_; }
+    const std::vector<int>& getBonds() const { return bondedAtoms_; }
 };
 
+class NeighborList;
+
+// Structure-of-arrays particle store, the owning storage for a system's
+// extrinsic state. Positions and velocities live in contiguous per-component
+// arrays, each atom carries only a dense 16-bit index into the shared
+// flyweights, and the per-pair LJ/Coulomb coefficients are precomputed into
+// flat ntypes x ntypes tables so the energy loop is branch-free streaming
+// arithmetic the compiler can vectorize. Atom objects are built on demand as
+// views for display and the reference loop.
+class ParticleStore {
+private:
+    std::vector<double> x_, y_, z_;       // Positions (Angstroms)
+    std::vector<double> vx_, vy_, vz_;    // Velocities (Angstroms/ps)
+    std::vector<uint16_t> type_;          // Index into types_ and the pair tables
+    
+    // Bond connectivity in compressed sparse row form. Bonds are only ever
+    // added to the newest atom, so rows are appended in order.
+    std::vector<uint32_t> bondOffsets_{0}; // size N+1
+    std::vector<int> bondTargets_;
+    
+    // Flyweights referenced by type index, and the flat pair tables built
+    // from them
+    std::vector<std::shared_ptr<AtomType>> types_;
+    std::unordered_map<const AtomType*, uint16_t> typeIndex_;
+    size_t numTypes_ = 0;
+    std::vector<double> c12_;             // 4*eps_ij*sigma_ij^12
+    std::vector<double> c6_;              // 4*eps_ij*sigma_ij^6
+    std::vector<double> qq_;              // ke*q_i*q_j
+    std::vector<double> typeMass_;
+    
+public:
+    // Appends an atom at rest; the pair tables grow when it brings a new type
+    void addParticle(double x, double y, double z, const std::shared_ptr<AtomType>& type) {
+        auto it = typeIndex_.find(type.get());
+        if (it == typeIndex_.end()) {
+            if (types_.size() == std::numeric_limits<uint16_t>::max()) {
+                throw std::length_error("ParticleStore: too many atom types");
+            }
+            it = typeIndex_.emplace(type.get(), static_cast<uint16_t>(types_.size())).first;
+            types_.push_back(type);
+            buildPairTables();
+        }
+        
+        x_.push_back(x); y_.push_back(y); z_.push_back(z);
+        vx_.push_back(0.0); vy_.push_back(0.0); vz_.push_back(0.0);
+        type_.push_back(it->second);
+        bondOffsets_.push_back(bondOffsets_.back());
+    }
+    
+    // Bonds the most recently added atom to atomId
+    void addBond(int atomId) {
+        bondTargets_.push_back(atomId);
+        ++bondOffsets_.back();
+    }
+    
+    void setVelocity(size_t i, double vx, double vy, double vz) {
+        vx_[i] = vx; vy_[i] = vy; vz_[i] = vz;
+    }
+    
+    const std::shared_ptr<AtomType>& getType(size_t i) const { return types_[type_[i]]; }
+    
+    // Materializes atom i as a standalone Atom; ids are 1-based
+    Atom atom(size_t i) const {
+        Atom view(static_cast<int>(i + 1), x_[i], y_[i], z_[i], getType(i));
+        view.setVelocity(vx_[i], vy_[i], vz_[i]);
+        for (const int* bond = bondsBegin(i); bond != bondsEnd(i); ++bond) {
+            view.addBond(*bond);
+        }
+        return view;
+    }
+    
+    // Same update as Atom::drift, applied to the packed arrays in place
+    void drift(double dt) {
+        for (size_t i = 0; i < size(); ++i) {
+            x_[i] += vx_[i] * dt; y_[i] += vy_[i] * dt; z_[i] += vz_[i] * dt;
+        }
+    }
+    
+    size_t size() const { return x_.size(); }
+    size_t getTypeCount() const { return numTypes_; }
+    const double* xData() const { return x_.data(); }
+    const double* yData() const { return y_.data(); }
+    const double* zData() const { return z_.data(); }
+    
+    size_t getBondCount(size_t i) const { return bondOffsets_[i + 1] - bondOffsets_[i]; }
+    const int* bondsBegin(size_t i) const { return bondTargets_.data() + bondOffsets_[i]; }
+    const int* bondsEnd(size_t i) const { return bondTargets_.data() + bondOffsets_[i + 1]; }
+    
+    double computeKineticEnergy() const {
+        double kinetic = 0.0;
+        for (size_t i = 0; i < size(); ++i) {
+            double v2 = vx_[i]*vx_[i] + vy_[i]*vy_[i] + vz_[i]*vz_[i];
+            kinetic += 0.5 * typeMass_[type_[i]] * v2 * 0.01; // Convert to kcal/mol
+        }
+        return kinetic;
+    }
+    
+    // All-pairs non-bonded energy within the cutoff
+    double computePotentialEnergy(double cutoff) const {
+        const size_t n = size();
+        const double cutoff2 = cutoff * cutoff;
+        const double* __restrict xs = x_.data();
+        const double* __restrict ys = y_.data();
+        const double* __restrict zs = z_.data();
+        const uint16_t* __restrict types = type_.data();
+        
+        double potential = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            const double xi = xs[i], yi = ys[i], zi = zs[i];
+            const size_t row = types[i] * numTypes_;
+            const double* __restrict c12Row = c12_.data() + row;
+            const double* __restrict c6Row = c6_.data() + row;
+            const double* __restrict qqRow = qq_.data() + row;
+            
+            double partial = 0.0;
+            for (size_t j = i + 1; j < n; ++j) {
+                partial += pairEnergy(xi - xs[j], yi - ys[j], zi - zs[j], cutoff2,
+                                      c12Row[types[j]], c6Row[types[j]], qqRow[types[j]]);
+            }
+            potential += partial;
+        }
+        return potential;
+    }
+    
+    // Non-bonded energy over a prebuilt Verlet list (defined below NeighborList)
+    double computePotentialEnergy(const NeighborList& list) const;
+    
+    double computeTotalEnergy(double cutoff) const {
+        return computeKineticEnergy() + computePotentialEnergy(cutoff);
+    }
+    
+    size_t getMemorySize() const {
+        return sizeof(*this)
+             + (x_.capacity() + y_.capacity() + z_.capacity()
+                + vx_.capacity() + vy_.capacity() + vz_.capacity()) * sizeof(double)
+             + type_.capacity() * sizeof(uint16_t)
+             + bondOffsets_.capacity() * sizeof(uint32_t)
+             + bondTargets_.capacity() * sizeof(int)
+             + types_.capacity() * sizeof(std::shared_ptr<AtomType>)
+             + typeIndex_.size() * (sizeof(std::pair<const AtomType* const, uint16_t>) + 2 * sizeof(void*))
+             + typeIndex_.bucket_count() * sizeof(void*)
+             + (c12_.capacity() + c6_.capacity() + qq_.capacity() + typeMass_.capacity()) * sizeof(double);
+    }
+    
+private:
+    // Branch-free so the pair loop vectorizes: out-of-cutoff pairs are masked
+    // to zero rather than skipped
+    static double pairEnergy(double dx, double dy, double dz, double cutoff2,
+                             double c12, double c6, double qq) {
+        double r2 = dx*dx + dy*dy + dz*dz;
+        double inside = r2 < cutoff2 ? 1.0 : 0.0;
+        r2 = r2 > 1e-12 ? r2 : 1e-12;  // Guard coincident atoms
+        double invR2 = 1.0 / r2;
+        double invR6 = invR2 * invR2 * invR2;
+        double lj = c12 * invR6 * invR6 - c6 * invR6;
+        double coulomb = qq * std::sqrt(invR2);
+        return inside * (lj + coulomb);
+    }
+    
+    void buildPairTables() {
+        const double ke = 332.0637; // Coulomb constant in kcal*Angstrom/(mol*e^2)
+        const auto& types = types_;
+        numTypes_ = types.size();
+        c12_.assign(numTypes_ * numTypes_, 0.0);
+        c6_.assign(numTypes_ * numTypes_, 0.0);
+        qq_.assign(numTypes_ * numTypes_, 0.0);
+        typeMass_.resize(numTypes_);
+        
+        for (size_t a = 0; a < numTypes_; ++a) {
+            typeMass_[a] = types[a]->getMass();
+            for (size_t b = 0; b < numTypes_; ++b) {
+                // Lorentz-Berthelot mixing, same as AtomType::computeLennardJones
+                double sigma = (types[a]->getSigma() + types[b]->getSigma()) / 2.0;
+                double epsilon = std::sqrt(types[a]->getEpsilon() * types[b]->getEpsilon());
+                double sigma6 = std::pow(sigma, 6);
+                c6_[a * numTypes_ + b] = 4.0 * epsilon * sigma6;
+                c12_[a * numTypes_ + b] = 4.0 * epsilon * sigma6 * sigma6;
+                qq_[a * numTypes_ + b] = ke * types[a]->getCharge() * types[b]->getCharge();
+            }
+        }
+    }
+};
+
+
+// Verlet neighbor list built from a cell-linked list.
+// Pairs within cutoff + skin are recorded once (j > i) in CSR form. The list
+// stays valid until some atom has moved more than skin/2 since the last build,
+// because two atoms closing in on each other can then have crossed the cutoff.
+class NeighborList {
+private:
+    double cutoff_;
+    double skin_;
+    std::vector<double> refX_, refY_, refZ_;  // Positions at last build
+    std::vector<uint32_t> offsets_;           // size N+1
+    std::vector<uint32_t> neighbors_;
+    
+    // Cell-linked list scratch: head atom per cell, next atom in same cell
+    std::vector<int> cellHead_;
+    std::vector<int> cellNext_;
+    size_t rebuildCount_ = 0;
+    
+public:
+    NeighborList(double cutoff, double skin) : cutoff_(cutoff), skin_(skin) {}
+    
+    void setSkin(double skin) { skin_ = skin; offsets_.clear(); }
+    double getCutoff() const { return cutoff_; }
+    double getSkin() const { return skin_; }
+    
+    bool needsRebuild(const ParticleStore& particles) const {
+        const size_t n = particles.size();
+        if (offsets_.size() != n + 1) {
+            return true;
+        }
+        const double limit2 = 0.25 * skin_ * skin_;
+        const double* xs = particles.xData();
+        const double* ys = particles.yData();
+        const double* zs = particles.zData();
+        for (size_t i = 0; i < n; ++i) {
+            double dx = xs[i] - refX_[i];
+            double dy = ys[i] - refY_[i];
+            double dz = zs[i] - refZ_[i];
+            if (dx*dx + dy*dy + dz*dz > limit2) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // Rebuilds only when required; returns true if a rebuild happened
+    bool update(const ParticleStore& particles) {
+        if (!needsRebuild(particles)) {
+            return false;
+        }
+        build(particles);
+        return true;
+    }
+    
+    void build(const ParticleStore& particles) {
+        const size_t n = particles.size();
+        const double* xs = particles.xData();
+        const double* ys = particles.yData();
+        const double* zs = particles.zData();
+        refX_.assign(xs, xs + n);
+        refY_.assign(ys, ys + n);
+        refZ_.assign(zs, zs + n);
+        offsets_.assign(n + 1, 0);
+        neighbors_.clear();
+        ++rebuildCount_;
+        if (n == 0) {
+            return;
+        }
+        
+        // Bin atoms into cells no smaller than the list radius, so every
+        // neighbor of an atom lies in its own or one of the 26 adjacent cells
+        const double listRadius = cutoff_ + skin_;
+        const double listRadius2 = listRadius * listRadius;
+        double lo[3] = {xs[0], ys[0], zs[0]};
+        double hi[3] = {xs[0], ys[0], zs[0]};
+        for (size_t i = 1; i < n; ++i) {
+            lo[0] = std::min(lo[0], xs[i]); hi[0] = std::max(hi[0], xs[i]);
+            lo[1] = std::min(lo[1], ys[i]); hi[1] = std::max(hi[1], ys[i]);
+            lo[2] = std::min(lo[2], zs[i]); hi[2] = std::max(hi[2], zs[i]);
+        }
+        
+        double cellSize = listRadius;
+        long dims[3];
+        auto computeDims = [&] {
+            for (int d = 0; d < 3; ++d) {
+                dims[d] = std::max(1L, static_cast<long>((hi[d] - lo[d]) / cellSize));
+            }
+        };
+        computeDims();
+        // Sparse systems (e.g. a long backbone) would otherwise allocate far
+        // more empty cells than atoms
+        while (static_cast<size_t>(dims[0] * dims[1] * dims[2]) > 2 * n + 27) {
+            cellSize *= 1.5;
+            computeDims();
+        }
+        
+        auto cellCoord = [&](double v, int d) {
+            long c = static_cast<long>((v - lo[d]) / cellSize);
+            return std::min(std::max(c, 0L), dims[d] - 1);
+        };
+        
+        cellHead_.assign(dims[0] * dims[1] * dims[2], -1);
+        cellNext_.assign(n, -1);
+        for (size_t i = 0; i < n; ++i) {
+            long c = (cellCoord(zs[i], 2) * dims[1] + cellCoord(ys[i], 1)) * dims[0] + cellCoord(xs[i], 0);
+            cellNext_[i] = cellHead_[c];
+            cellHead_[c] = static_cast<int>(i);
+        }
+        
+        for (size_t i = 0; i < n; ++i) {
+            long cx = cellCoord(xs[i], 0), cy = cellCoord(ys[i], 1), cz = cellCoord(zs[i], 2);
+            for (long z = std::max(cz - 1, 0L); z <= std::min(cz + 1, dims[2] - 1); ++z) {
+                for (long y = std::max(cy - 1, 0L); y <= std::min(cy + 1, dims[1] - 1); ++y) {
+                    for (long x = std::max(cx - 1, 0L); x <= std::min(cx + 1, dims[0] - 1); ++x) {
+                        for (int j = cellHead_[(z * dims[1] + y) * dims[0] + x]; j >= 0; j = cellNext_[j]) {
+                            if (static_cast<size_t>(j) <= i) continue;
+                            double dx = xs[i] - xs[j];
+                            double dy = ys[i] - ys[j];
+                            double dz = zs[i] - zs[j];
+                            if (dx*dx + dy*dy + dz*dz < listRadius2) {
+                                neighbors_.push_back(static_cast<uint32_t>(j));
+                            }
+                        }
+                    }
+                }
+            }
+            offsets_[i + 1] = static_cast<uint32_t>(neighbors_.size());
+        }
+    }
+    
+    const uint32_t* offsetsData() const { return offsets_.data(); }
+    const uint32_t* neighborsData() const { return neighbors_.data(); }
+    size_t getPairCount() const { return neighbors_.size(); }
+    size_t getRebuildCount() const { return rebuildCount_; }
+};
+
+// Neighbor-list energy: same masked kernel as the all-pairs loop, but only
+// over pairs within cutoff + skin
+inline double ParticleStore::computePotentialEnergy(const NeighborList& list) const {
+    const double cutoff2 = list.getCutoff() * list.getCutoff();
+    const double* __restrict xs = x_.data();
+    const double* __restrict ys = y_.data();
+    const double* __restrict zs = z_.data();
+    const uint16_t* __restrict types = type_.data();
+    const uint32_t* __restrict offsets = list.offsetsData();
+    const uint32_t* __restrict neighbors = list.neighborsData();
+    
+    double potential = 0.0;
+    for (size_t i = 0; i < size(); ++i) {
+        const double xi = xs[i], yi = ys[i], zi = zs[i];
+        const size_t row = types[i] * numTypes_;
+        const double* __restrict c12Row = c12_.data() + row;
+        const double* __restrict c6Row = c6_.data() + row;
+        const double* __restrict qqRow = qq_.data() + row;
+        
+        double partial = 0.0;
+        for (uint32_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+            const uint32_t j = neighbors[k];
+            partial += pairEnergy(xi - xs[j], yi - ys[j], zi - zs[j], cutoff2,
+                                  c12Row[types[j]], c6Row[types[j]], qqRow[types[j]]);
+        }
+        potential += partial;
+    }
+    return potential;
+}
+
 // Molecular system managing millions of atoms
 class MolecularSystem {
+public:
+    enum class EnergyMethod {
+        BruteForce,     // All pairs, O(N^2), reference path
+        NeighborList    // Cell-list built Verlet list, O(N)
+    };
+    
 private:
-    std::vector<Atom> atoms_;
+    ParticleStore particles_;    // Owns all per-atom state
     std::string systemName_;
     double boxX_, boxY_, boxZ_;  // Simulation box dimensions
     double temperature_;         // System temperature (K)
     double totalEnergy_;
+    double cutoff_ = 12.0;       // Non-bonded cutoff (Angstroms)
+    
+    EnergyMethod energyMethod_ = EnergyMethod::NeighborList;
+    NeighborList neighborList_{cutoff_, 2.0};
     
 public:
     MolecularSystem(const std::string& name, double boxSize, double temp)
@@ -218,9 +589,7 @@ public:
     void addAtom(double x, double y, double z, 
                  const std::string& element,
                  const std::string& hybridization = "") {
-        auto type = ForceFieldLibrary::getAtomType(element, hybridization);
-        int atomId = atoms_.size() + 1;
-        atoms_.emplace_back(atomId, x, y, z, type);
+        particles_.addParticle(x, y, z, ForceFieldLibrary::getAtomType(element, hybridization));
     }
     
     void addProteinBackbone(double startX, double startY, double startZ, int length) {
@@ -230,19 +599,19 @@ public:
             
             // Nitrogen
             addAtom(startX + offset, startY, startZ, "N");
-            if (i > 0) atoms_.back().addBond(atoms_.size() - 3);
+            if (i > 0) particles_.addBond(particles_.size() - 3);
             
             // Alpha carbon
             addAtom(startX + offset + 1.5, startY, startZ, "C", "sp3");
-            atoms_.back().addBond(atoms_.size() - 1);
+            particles_.addBond(particles_.size() - 1);
             
             // Carbonyl carbon
             addAtom(startX + offset + 2.5, startY, startZ + 0.5, "C", "sp2");
-            atoms_.back().addBond(atoms_.size() - 1);
+            particles_.addBond(particles_.size() - 1);
             
             // Carbonyl oxygen
             addAtom(startX + offset + 2.5, startY, startZ + 1.7, "O");
-            atoms_.back().addBond(atoms_.size() - 1);
+            particles_.addBond(particles_.size() - 1);
         }
     }
     
@@ -251,39 +620,70 @@ public:
         std::random_device rd;
         std::mt19937 gen(rd());
         
-        for (auto& atom : atoms_) {
+        for (size_t i = 0; i < particles_.size(); ++i) {
             double kT = 0.001987 * temperature_; // Boltzmann constant * T
-            double sigma = std::sqrt(kT / atom.getType()->getMass());
+            double sigma = std::sqrt(kT / particles_.getType(i)->getMass());
             std::normal_distribution<> vel_dist(0.0, sigma * 100); // Convert to Å/ps
             
-            atom.setVelocity(vel_dist(gen), vel_dist(gen), vel_dist(gen));
+            double vx = vel_dist(gen), vy = vel_dist(gen), vz = vel_dist(gen);
+            particles_.setVelocity(i, vx, vy, vz);
         }
     }
     
+    const ParticleStore& getParticleStore() const { return particles_; }
+    
+    void setEnergyMethod(EnergyMethod method) { energyMethod_ = method; }
+    void setNeighborSkin(double skin) { neighborList_.setSkin(skin); }
+    const NeighborList& getNeighborList() const { return neighborList_; }
+    
     double computeTotalEnergy() {
+        const ParticleStore& particles = particles_;
+        if (energyMethod_ == EnergyMethod::NeighborList) {
+            neighborList_.update(particles);
+            totalEnergy_ = particles.computeKineticEnergy()
+                         + particles.computePotentialEnergy(neighborList_);
+        } else {
+            totalEnergy_ = particles.computeTotalEnergy(cutoff_);
+        }
+        return totalEnergy_;
+    }
+    
+    // Free flight x += v*dt; enough to exercise neighbor-list reuse
+    void propagate(double dt) {
+        particles_.drift(dt);
+    }
+    
+    // Original array-of-structures loop, kept as a reference for validation.
+    // The Atom views exist only for the duration of the call.
+    double computeTotalEnergyAoS() const {
+        std::vector<Atom> atoms;
+        atoms.reserve(particles_.size());
+        for (size_t i = 0; i < particles_.size(); ++i) {
+            atoms.push_back(particles_.atom(i));
+        }
+        
         double kineticEnergy = 0.0;
         double potentialEnergy = 0.0;
         
         // Kinetic energy
-        for (const auto& atom : atoms_) {
+        for (const auto& atom : atoms) {
             kineticEnergy += atom.computeKineticEnergy();
         }
         
-        // Non-bonded interactions (simplified - only nearest neighbors)
-        for (size_t i = 0; i < atoms_.size(); ++i) {
-            for (size_t j = i + 1; j < atoms_.size(); ++j) {
-                double dist = atoms_[i].computeDistance(atoms_[j]);
-                if (dist < 12.0) { // Cutoff distance
-                    potentialEnergy += atoms_[i].getType()->computeLennardJones(
-                        dist, *atoms_[j].getType());
-                    potentialEnergy += atoms_[i].getType()->computeCoulomb(
-                        dist, *atoms_[j].getType());
+        // Non-bonded interactions within the cutoff
+        for (size_t i = 0; i < atoms.size(); ++i) {
+            for (size_t j = i + 1; j < atoms.size(); ++j) {
+                double dist = atoms[i].computeDistance(atoms[j]);
+                if (dist < cutoff_) {
+                    potentialEnergy += atoms[i].getType()->computeLennardJones(
+                        dist, *atoms[j].getType());
+                    potentialEnergy += atoms[i].getType()->computeCoulomb(
+                        dist, *atoms[j].getType());
                 }
             }
         }
         
-        totalEnergy_ = kineticEnergy + potentialEnergy;
-        return totalEnergy_;
+        return kineticEnergy + potentialEnergy;
     }
     
     void displaySystem() const {
@@ -291,35 +691,31 @@ public:
         std::cout << "Box dimensions: " << boxX_ << " × " << boxY_ 
                   << " × " << boxZ_ << " Å³\n";
         std::cout << "Temperature: " << temperature_ << " K\n";
-        std::cout << "Total atoms: " << atoms_.size() << "\n";
+        std::cout << "Total atoms: " << particles_.size() << "\n";
     }
     
     void displaySample(int count) const {
         std::cout << "\nSample atoms:\n";
-        for (int i = 0; i < count && i < atoms_.size(); ++i) {
-            atoms_[i].display();
+        for (size_t i = 0; i < static_cast<size_t>(count) && i < particles_.size(); ++i) {
+            particles_.atom(i).display();
         }
     }
     
     size_t getAtomCount() const {
-        return atoms_.size();
+        return particles_.size();
     }
     
     size_t getTotalMemory() const {
-        size_t extrinsicMemory = 0;
-        for (const auto& atom : atoms_) {
-            extrinsicMemory += atom.getMemorySize();
-        }
-        
+        // The store holds all extrinsic state; Atom views are transient
+        size_t extrinsicMemory = particles_.getMemorySize();
         size_t intrinsicMemory = ForceFieldLibrary::getTotalMemory();
-        
         return extrinsicMemory + intrinsicMemory;
     }
     
     size_t getMemoryWithoutFlyweight() const {
         // If each atom stored its own force field parameters
         size_t paramSize = 200; // Estimated bytes for all parameters
-        return atoms_.size() * (sizeof(Atom) + paramSize);
+        return particles_.size() * (sizeof(Atom) + paramSize);
     }
 };
 
@@ -385,9 +781,59 @@ int main() {
     
     // Compute initial energy
     std::cout << "\nComputing system energy...\n";
+    proteinSystem.setEnergyMethod(MolecularSystem::EnergyMethod::BruteForce);
+    auto aosStart = std::chrono::steady_clock::now();
+    double aosEnergy = proteinSystem.computeTotalEnergyAoS();
+    auto aosEnd = std::chrono::steady_clock::now();
     double energy = proteinSystem.computeTotalEnergy();
+    auto soaEnd = std::chrono::steady_clock::now();
+    
+    const ParticleStore& store = proteinSystem.getParticleStore();
+    auto aosMs = std::chrono::duration_cast<std::chrono::milliseconds>(aosEnd - aosStart).count();
+    auto soaMs = std::chrono::duration_cast<std::chrono::milliseconds>(soaEnd - aosEnd).count();
+    
     std::cout << "Total energy: " << std::fixed << std::setprecision(2) 
               << energy << " kcal/mol\n";
+    std::cout << "  AoS reference: " << aosEnergy << " kcal/mol (" << aosMs << " ms)\n";
+    std::cout << "  SoA pair loop: " << energy << " kcal/mol (" << soaMs << " ms, "
+              << store.getTypeCount() << " packed types)\n";
+    std::cout << "  Per-atom memory: " 
+              << (double)store.getMemorySize() / store.size() << " B (ParticleStore) vs "
+              << (double)sizeof(Atom) << " B per Atom object\n";
+    
+    // Neighbor list versus the brute-force SoA result above
+    std::cout << "\nValidating neighbor-list energy against brute force...\n";
+    proteinSystem.setEnergyMethod(MolecularSystem::EnergyMethod::NeighborList);
+    auto listStart = std::chrono::steady_clock::now();
+    double listEnergy = proteinSystem.computeTotalEnergy();
+    auto listEnd = std::chrono::steady_clock::now();
+    
+    std::cout << "  Neighbor list: " << listEnergy << " kcal/mol ("
+              << std::chrono::duration_cast<std::chrono::milliseconds>(listEnd - listStart).count() << " ms incl. build, "
+              << proteinSystem.getNeighborList().getPairCount() << " pairs)\n";
+    std::cout << "  Relative difference: " << std::scientific << std::setprecision(2)
+              << std::abs(listEnergy - energy) / std::abs(energy) << std::fixed << "\n";
+    
+    // Large backbone: only tractable with the neighbor list
+    std::cout << "\n=== 100k-Atom Protein Backbone ===\n";
+    MolecularSystem backbone("Extended backbone", 100.0, 300.0);
+    backbone.addProteinBackbone(0.0, 0.0, 0.0, 25000);
+    backbone.initializeVelocities();
+    
+    const int steps = 200;
+    const double dt = 0.001; // ps
+    auto mdStart = std::chrono::steady_clock::now();
+    double backboneEnergy = backbone.computeTotalEnergy();
+    for (int step = 0; step < steps; ++step) {
+        backbone.propagate(dt);
+        backboneEnergy = backbone.computeTotalEnergy();
+    }
+    auto mdEnd = std::chrono::steady_clock::now();
+    
+    std::cout << "Atoms: " << backbone.getAtomCount() << ", steps: " << steps 
+              << ", list rebuilds: " << backbone.getNeighborList().getRebuildCount() << "\n";
+    std::cout << "Final energy: " << std::setprecision(2) << backboneEnergy << " kcal/mol ("
+              << std::chrono::duration_cast<std::chrono::milliseconds>(mdEnd - mdStart).count() << " ms total)\n";
     
     // Small test system to show parameter sharing
     std::cout << "\n=== Small Test System ===\n";
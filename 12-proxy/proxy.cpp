@@ -1,6 +1,7 @@
 // Proxy Pattern - Remote HPC Cluster Resource Manager
 // Manages access to remote computational resources and large datasets
 #include <iostream>
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <chrono>
@@ -8,15 +9,37 @@
 #include <vector>
 #include <iomanip>
 #include <sstream>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <stdexcept>
 
 // Subject interface - Computational resource
 class ComputationalResource {
 public:
     virtual ~ComputationalResource() = default;
-    virtual void submitJob(const std::string& jobScript, int cores, double memory) = 0;
+    // Returns the job ID, or an empty string when no cluster job was created
+    virtual std::string submitJob(const std::string& jobScript, int cores, double memory) = 0;
     virtual std::string getStatus() = 0;
     virtual double getUsage() = 0;
     virtual void retrieveResults(const std::string& jobId) = 0;
+    
+    // Downloads and returns the result payload; resources without a payload
+    // notion just perform the retrieval
+    virtual std::string fetchResults(const std::string& jobId) {
+        retrieveResults(jobId);
+        return "";
+    }
 };
 
 // Real subject - Remote HPC cluster
@@ -54,7 +77,7 @@ public:
         establishConnection();
     }
     
-    void submitJob(const std::string& jobScript, int cores, double memory) override {
+    std::string submitJob(const std::string& jobScript, int cores, double memory) override {
         std::string jobId = generateJobId();
         std::cout << "\nSubmitting job to " << clusterName_ << ":\n";
         std::cout << "  Job ID: " << jobId << "\n";
@@ -62,11 +85,13 @@ public:
                   << std::fixed << std::setprecision(2) << memory << " GB RAM\n";
         std::cout << "  Script: " << jobScript << "\n";
         std::cout << "  Transferring input files...\n";
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
         std::cout << "  Job queued in partition 'gpu-v100'\n";
         
         // Simulate job execution
         currentLoad_ += cores / (double)totalCores_;
         jobResults_[jobId] = "Simulation completed: 1.2M timesteps, convergence achieved";
+        return jobId;
     }
     
     std::string getStatus() override {
@@ -97,6 +122,12 @@ public:
             std::cout << "  Files saved to: /scratch/results/" << jobId << "/\n";
         }
     }
+    
+    std::string fetchResults(const std::string& jobId) override {
+        retrieveResults(jobId);
+        auto it = jobResults_.find(jobId);
+        return it != jobResults_.end() ? it->second : "";
+    }
 };
 
 // Virtual proxy - Lazy connection to HPC resources
@@ -125,9 +156,9 @@ public:
                   << " (connection deferred)\n";
     }
     
-    void submitJob(const std::string& jobScript, int cores, double memory) override {
+    std::string submitJob(const std::string& jobScript, int cores, double memory) override {
         ensureConnected();
-        realCluster_->submitJob(jobScript, cores, memory);
+        return realCluster_->submitJob(jobScript, cores, memory);
     }
     
     std::string getStatus() override {
@@ -144,6 +175,11 @@ public:
         ensureConnected();
         realCluster_->retrieveResults(jobId);
     }
+    
+    std::string fetchResults(const std::string& jobId) override {
+        ensureConnected();
+        return realCluster_->fetchResults(jobId);
+    }
 };
 
 // Protection proxy - Access control and quota management
@@ -162,8 +198,8 @@ private:
     
     std::unordered_map<std::string, UserQuota> userQuotas_;
     
-    bool checkQuota(int requestedCores, double requestedMemory) const {
-        auto it = userQuotas_.find(currentUser_);
+    bool checkQuota(const std::string& user, int requestedCores, double requestedMemory) const {
+        auto it = userQuotas_.find(user);
         if (it == userQuotas_.end() || !it->second.hasAccess) {
             return false;
         }
@@ -199,19 +235,40 @@ public:
         }
     }
     
-    void submitJob(const std::string& jobScript, int cores, double memory) override {
-        if (!checkQuota(cores, memory)) {
-            std::cout << "\nAccess denied: " << currentUser_ 
+    bool hasAccess(const std::string& user) const {
+        auto it = userQuotas_.find(user);
+        return it != userQuotas_.end() && it->second.hasAccess;
+    }
+    
+    // Explicit-user forms, for front proxies that authenticate per call
+    // rather than through setCurrentUser()
+    std::string submitJobAs(const std::string& user, const std::string& jobScript,
+                            int cores, double memory) {
+        if (!checkQuota(user, cores, memory)) {
+            std::cout << "\nAccess denied: " << user 
                       << " - Insufficient quota or permissions\n";
             std::cout << "Requested: " << cores << " cores, " << memory << " GB\n";
-            return;
+            return "";
         }
         
-        resource_->submitJob(jobScript, cores, memory);
+        std::string jobId = resource_->submitJob(jobScript, cores, memory);
         
         // Update usage
-        auto& quota = userQuotas_[currentUser_];
+        auto& quota = userQuotas_[user];
         quota.cpuHoursUsed += cores * 0.5; // Assume 30 min job
+        return jobId;
+    }
+    
+    std::string fetchResultsAs(const std::string& user, const std::string& jobId) {
+        if (hasAccess(user)) {
+            return resource_->fetchResults(jobId);
+        }
+        std::cout << "Access denied for retrieving results\n";
+        return "";
+    }
+    
+    std::string submitJob(const std::string& jobScript, int cores, double memory) override {
+        return submitJobAs(currentUser_, jobScript, cores, memory);
     }
     
     std::string getStatus() override {
@@ -223,23 +280,240 @@ public:
     }
     
     void retrieveResults(const std::string& jobId) override {
-        if (userQuotas_[currentUser_].hasAccess) {
+        if (hasAccess(currentUser_)) {
             resource_->retrieveResults(jobId);
         } else {
             std::cout << "Access denied for retrieving results\n";
         }
     }
+    
+    std::string fetchResults(const std::string& jobId) override {
+        return fetchResultsAs(currentUser_, jobId);
+    }
+};
+
+// Canonical form of a batch script for content addressing: comments and
+// blank lines dropped, whitespace runs collapsed, CRLF folded. Shebang and
+// scheduler directives (#SBATCH, #PBS, #BSUB) change the job, so they stay.
+inline std::string normalizeJobScript(const std::string& script) {
+    std::string canonical;
+    std::istringstream lines(script);
+    std::string line;
+    while (std::getline(lines, line)) {
+        std::string collapsed;
+        bool pendingSpace = false;
+        for (char c : line) {
+            if (c == ' ' || c == '\t' || c == '\r') {
+                pendingSpace = !collapsed.empty();
+                continue;
+            }
+            if (pendingSpace) collapsed += ' ';
+            pendingSpace = false;
+            collapsed += c;
+        }
+        if (collapsed.empty()) continue;
+        if (collapsed[0] == '#' && collapsed.compare(0, 2, "#!") != 0 &&
+            collapsed.compare(0, 7, "#SBATCH") != 0 && collapsed.compare(0, 4, "#PBS") != 0 &&
+            collapsed.compare(0, 5, "#BSUB") != 0) {
+            continue;
+        }
+        canonical += collapsed;
+        canonical += '\n';
+    }
+    return canonical;
+}
+
+// 128-bit content digest (two FNV-1a lanes) rendered as hex; used as the
+// cache index and on-disk file name, with the full key verified on lookup
+inline std::string contentDigest(const std::string& data) {
+    uint64_t lanes[2] = {0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL};
+    for (unsigned char c : data) {
+        lanes[0] = (lanes[0] ^ c) * 0x100000001b3ULL;
+        lanes[1] = (lanes[1] ^ static_cast<unsigned char>(c + 0x5b)) * 0x100000001b3ULL;
+    }
+    std::ostringstream hex;
+    hex << std::hex << std::setfill('0') << std::setw(16) << lanes[0] << std::setw(16) << lanes[1];
+    return hex.str();
+}
+
+// Byte-bounded LRU cache of job results with per-entry expiry and an optional
+// write-through directory tier that survives restarts. Thread-safe.
+class JobResultCache {
+public:
+    struct Entry {
+        std::string jobId;
+        std::string payload;  // Empty until the results have been downloaded
+    };
+    
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t diskHits = 0;
+        size_t evictions = 0;
+        size_t expirations = 0;
+        size_t bytes = 0;
+        size_t entries = 0;
+    };
+    
+    // Expiry is wall-clock so that disk entries keep their meaning across runs
+    using Clock = std::chrono::system_clock;
+    
+private:
+    struct Node {
+        std::string digest;
+        std::string key;
+        Entry entry;
+        Clock::time_point expiresAt;
+        size_t bytes;
+    };
+    
+    size_t capacityBytes_;
+    std::filesystem::path diskDirectory_;
+    std::list<Node> lru_;  // Most recently used first
+    std::unordered_map<std::string, std::list<Node>::iterator> index_;
+    mutable std::mutex mutex_;
+    Stats stats_;
+    
+    static size_t footprint(const std::string& key, const Entry& entry) {
+        return sizeof(Node) + 2 * 32 + key.size() + entry.jobId.size() + entry.payload.size();
+    }
+    
+    void unlink(std::list<Node>::iterator it) {
+        stats_.bytes -= it->bytes;
+        index_.erase(it->digest);
+        lru_.erase(it);
+    }
+    
+    void evictToFit() {
+        while (stats_.bytes > capacityBytes_ && !lru_.empty()) {
+            unlink(std::prev(lru_.end()));
+            ++stats_.evictions;
+        }
+    }
+    
+    void insertLocked(const std::string& digest, const std::string& key,
+                      const Entry& entry, Clock::time_point expiresAt) {
+        auto found = index_.find(digest);
+        if (found != index_.end()) unlink(found->second);
+        const size_t bytes = footprint(key, entry);
+        if (bytes > capacityBytes_) return;  // Larger than the whole budget: disk tier only
+        lru_.push_front(Node{digest, key, entry, expiresAt, bytes});
+        index_[digest] = lru_.begin();
+        stats_.bytes += bytes;
+        evictToFit();
+    }
+    
+    std::filesystem::path diskPath(const std::string& digest) const {
+        return diskDirectory_ / (digest + ".job");
+    }
+    
+    // Record: "HPCJOB1 <expiry-ms> <key-len> <id-len> <payload-len>\n" + raw bytes
+    void writeToDisk(const std::string& digest, const std::string& key,
+                     const Entry& entry, Clock::time_point expiresAt) const {
+        if (diskDirectory_.empty()) return;
+        const auto expiryMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            expiresAt.time_since_epoch()).count();
+        const auto target = diskPath(digest);
+        auto staging = target;
+        staging += ".tmp";
+        {
+            std::ofstream out(staging, std::ios::binary | std::ios::trunc);
+            if (!out) return;
+            out << "HPCJOB1 " << expiryMs << ' ' << key.size() << ' ' << entry.jobId.size()
+                << ' ' << entry.payload.size() << '\n' << key << entry.jobId << entry.payload;
+            if (!out) return;
+        }
+        std::error_code ec;
+        std::filesystem::rename(staging, target, ec);  // Readers never see a torn record
+    }
+    
+    bool readFromDisk(const std::string& digest, const std::string& key,
+                      Entry& entry, Clock::time_point& expiresAt) const {
+        if (diskDirectory_.empty()) return false;
+        const auto path = diskPath(digest);
+        std::ifstream in(path, std::ios::binary);
+        if (!in) return false;
+        std::string magic;
+        long long expiryMs = 0;
+        size_t keySize = 0, idSize = 0, payloadSize = 0;
+        in >> magic >> expiryMs >> keySize >> idSize >> payloadSize;
+        if (!in || magic != "HPCJOB1" || in.get() != '\n') return false;
+        std::string storedKey(keySize, '\0');
+        entry.jobId.assign(idSize, '\0');
+        entry.payload.assign(payloadSize, '\0');
+        in.read(&storedKey[0], static_cast<std::streamsize>(keySize));
+        in.read(&entry.jobId[0], static_cast<std::streamsize>(idSize));
+        in.read(&entry.payload[0], static_cast<std::streamsize>(payloadSize));
+        if (!in || storedKey != key) return false;
+        expiresAt = Clock::time_point(std::chrono::milliseconds(expiryMs));
+        if (expiresAt <= Clock::now()) {
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+            return false;
+        }
+        return true;
+    }
+    
+public:
+    explicit JobResultCache(size_t capacityBytes, const std::string& diskDirectory = "")
+        : capacityBytes_(capacityBytes), diskDirectory_(diskDirectory) {
+        if (!diskDirectory_.empty()) std::filesystem::create_directories(diskDirectory_);
+    }
+    
+    bool lookup(const std::string& key, Entry& out) {
+        const std::string digest = contentDigest(key);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto found = index_.find(digest);
+        if (found != index_.end()) {
+            auto it = found->second;
+            if (it->key == key && it->expiresAt > Clock::now()) {
+                lru_.splice(lru_.begin(), lru_, it);
+                out = it->entry;
+                ++stats_.hits;
+                return true;
+            }
+            if (it->key == key) ++stats_.expirations;
+            unlink(it);
+        }
+        Clock::time_point expiresAt;
+        if (readFromDisk(digest, key, out, expiresAt)) {
+            insertLocked(digest, key, out, expiresAt);
+            ++stats_.hits;
+            ++stats_.diskHits;
+            return true;
+        }
+        ++stats_.misses;
+        return false;
+    }
+    
+    // Entries with a payload are written through to the disk tier
+    void insert(const std::string& key, const Entry& entry, std::chrono::milliseconds ttl) {
+        const std::string digest = contentDigest(key);
+        const auto expiresAt = Clock::now() + ttl;
+        std::lock_guard<std::mutex> lock(mutex_);
+        insertLocked(digest, key, entry, expiresAt);
+        if (!entry.payload.empty()) writeToDisk(digest, key, entry, expiresAt);
+    }
+    
+    Stats getStats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats stats = stats_;
+        stats.entries = lru_.size();
+        return stats;
+    }
+    
+    size_t getCapacityBytes() const { return capacityBytes_; }
 };
 
 // Caching proxy - Caches cluster status and job results
 class CachingHPCProxy : public ComputationalResource {
 private:
-    std::unique_ptr<ComputationalResource> resource_;
+    std::unique_ptr<SecureHPCProxy> resource_;
+    std::mutex resourceMutex_;  // The proxies behind this one are single-threaded
     
     // Cached data
     mutable std::string cachedStatus_;
     mutable double cachedUsage_;
-    mutable std::unordered_map<std::string, std::string> cachedResults_;
     
     // Cache timestamps
     mutable std::chrono::steady_clock::time_point lastStatusUpdate_;
@@ -249,6 +523,29 @@ private:
     static constexpr auto STATUS_CACHE_DURATION = std::chrono::seconds(30);
     static constexpr auto USAGE_CACHE_DURATION = std::chrono::seconds(10);
     
+    // Job results, addressed by user + normalized script + resources
+    JobResultCache results_;
+    std::atomic<std::chrono::milliseconds> resultTtl_{std::chrono::hours(24)};
+    
+    // Each call reads the user once and passes it down, so the cache key,
+    // the access check and the forwarded request agree even if another
+    // thread switches users mid-call
+    mutable std::mutex userMutex_;
+    std::string currentUser_;
+    
+    struct InFlightSubmission {
+        std::promise<std::string> jobId;
+        std::shared_future<std::string> ready{jobId.get_future().share()};
+    };
+    std::mutex inflightMutex_;
+    std::unordered_map<std::string, std::shared_ptr<InFlightSubmission>> inflight_;
+    
+    std::mutex aliasMutex_;
+    std::unordered_map<std::string, std::string> jobKeys_;  // User + job ID -> content key
+    
+    std::atomic<size_t> clusterSubmissions_{0};
+    std::atomic<size_t> coalescedSubmissions_{0};
+    
     bool isStatusCacheValid() const {
         auto now = std::chrono::steady_clock::now();
         return !cachedStatus_.empty() && 
@@ -260,28 +557,119 @@ private:
         return (now - lastUsageUpdate_) < USAGE_CACHE_DURATION;
     }
     
+    std::string currentUser() const {
+        std::lock_guard<std::mutex> lock(userMutex_);
+        return currentUser_;
+    }
+    
+    // Results are scoped per user: quota and access checks live in the
+    // protection proxy behind this one and must not be bypassed by a hit
+    static std::string jobKey(const std::string& user, const std::string& jobScript,
+                              int cores, double memory) {
+        std::ostringstream key;
+        key << user << '\x1f' << cores << '\x1f' << std::setprecision(17) << memory << '\x1f'
+            << normalizeJobScript(jobScript);
+        return key.str();
+    }
+    
+    static std::string aliasKey(const std::string& user, const std::string& jobId) {
+        return user + '\x1f' + jobId;
+    }
+    
+    void rememberJob(const std::string& user, const std::string& jobId, const std::string& key) {
+        std::lock_guard<std::mutex> lock(aliasMutex_);
+        jobKeys_[aliasKey(user, jobId)] = key;
+    }
+    
+    bool hasAccess(const std::string& user) {
+        std::lock_guard<std::mutex> lock(resourceMutex_);
+        return resource_->hasAccess(user);
+    }
+    
 public:
     CachingHPCProxy(const std::string& name, const std::string& host,
-                    int cores, double memory)
+                    int cores, double memory,
+                    size_t resultCacheBytes = 64 << 20,
+                    const std::string& resultCacheDirectory = "")
         : resource_(std::make_unique<SecureHPCProxy>(name, host, cores, memory)),
-          cachedUsage_(0.0) {
+          cachedUsage_(0.0),
+          results_(resultCacheBytes, resultCacheDirectory) {
         std::cout << "Caching proxy enabled for HPC resource\n";
     }
     
     void setCurrentUser(const std::string& user) {
-        // Forward to secure proxy
-        if (auto* secureProxy = dynamic_cast<SecureHPCProxy*>(resource_.get())) {
-            secureProxy->setCurrentUser(user);
+        {
+            std::lock_guard<std::mutex> lock(userMutex_);
+            currentUser_ = user;
         }
+        // Forward to secure proxy for its quota report
+        std::lock_guard<std::mutex> lock(resourceMutex_);
+        resource_->setCurrentUser(user);
     }
     
-    void submitJob(const std::string& jobScript, int cores, double memory) override {
-        resource_->submitJob(jobScript, cores, memory);
-        // Invalidate usage cache after job submission
-        lastUsageUpdate_ = std::chrono::steady_clock::time_point{};
+    void setResultTtl(std::chrono::milliseconds ttl) { resultTtl_.store(ttl); }
+    
+    // Identical jobs (after normalization) are answered from the cache, and
+    // concurrent identical submissions share one cluster submission
+    std::string submitJob(const std::string& jobScript, int cores, double memory) override {
+        const std::string user = currentUser();
+        const std::string key = jobKey(user, jobScript, cores, memory);
+        JobResultCache::Entry cached;
+        if (hasAccess(user) && results_.lookup(key, cached)) {
+            std::cout << "[Cache hit] Identical job already ran as " + cached.jobId + "\n";
+            rememberJob(user, cached.jobId, key);
+            return cached.jobId;
+        }
+        
+        std::shared_ptr<InFlightSubmission> flight, leader;
+        {
+            std::lock_guard<std::mutex> lock(inflightMutex_);
+            auto it = inflight_.find(key);
+            if (it != inflight_.end()) {
+                flight = it->second;
+            } else {
+                leader = std::make_shared<InFlightSubmission>();
+                inflight_[key] = leader;
+            }
+        }
+        if (flight) {
+            ++coalescedSubmissions_;
+            return flight->ready.get();
+        }
+        
+        auto finish = [&] {
+            std::lock_guard<std::mutex> lock(inflightMutex_);
+            inflight_.erase(key);
+        };
+        try {
+            std::string jobId;
+            // A previous leader may have completed between our lookup and
+            // taking leadership; its entry is visible before it left inflight_
+            if (hasAccess(user) && results_.lookup(key, cached)) {
+                jobId = cached.jobId;
+            } else {
+                {
+                    std::lock_guard<std::mutex> lock(resourceMutex_);
+                    jobId = resource_->submitJobAs(user, jobScript, cores, memory);
+                    // Invalidate usage cache after job submission
+                    lastUsageUpdate_ = std::chrono::steady_clock::time_point{};
+                }
+                ++clusterSubmissions_;
+                if (!jobId.empty()) results_.insert(key, {jobId, ""}, resultTtl_.load());
+            }
+            if (!jobId.empty()) rememberJob(user, jobId, key);
+            leader->jobId.set_value(jobId);
+            finish();
+            return jobId;
+        } catch (...) {
+            leader->jobId.set_exception(std::current_exception());
+            finish();
+            throw;
+        }
     }
     
     std::string getStatus() override {
+        std::lock_guard<std::mutex> lock(resourceMutex_);
         if (isStatusCacheValid()) {
             std::cout << "[Cache hit] Returning cached cluster status\n";
             return cachedStatus_;
@@ -294,6 +682,7 @@ public:
     }
     
     double getUsage() override {
+        std::lock_guard<std::mutex> lock(resourceMutex_);
         if (isUsageCacheValid()) {
             std::cout << "[Cache hit] Returning cached usage: " 
                       << std::fixed << std::setprecision(1) 
@@ -308,42 +697,257 @@ public:
     }
     
     void retrieveResults(const std::string& jobId) override {
+        fetchResults(jobId);
+    }
+    
+    std::string fetchResults(const std::string& jobId) override {
+        // A hit must pass the same check the cluster path does
+        const std::string user = currentUser();
+        if (!hasAccess(user)) {
+            std::cout << "Access denied for retrieving results\n";
+            return "";
+        }
+        
+        // Jobs this user did not submit through this proxy are cached under
+        // user + ID, so one user's downloads never answer another's request
+        std::string key = "job\x1f" + aliasKey(user, jobId);
+        {
+            std::lock_guard<std::mutex> lock(aliasMutex_);
+            auto it = jobKeys_.find(aliasKey(user, jobId));
+            if (it != jobKeys_.end()) key = it->second;
+        }
+        
         // Check if results are cached
-        auto it = cachedResults_.find(jobId);
-        if (it != cachedResults_.end()) {
+        JobResultCache::Entry cached;
+        if (results_.lookup(key, cached) && !cached.payload.empty()) {
             std::cout << "[Cache hit] Results already downloaded for " << jobId << "\n";
             std::cout << "  Using local copy from cache\n";
-            return;
+            return cached.payload;
         }
         
         // Retrieve and cache results
-        resource_->retrieveResults(jobId);
-        cachedResults_[jobId] = "cached";
+        std::string payload;
+        {
+            std::lock_guard<std::mutex> lock(resourceMutex_);
+            payload = resource_->fetchResultsAs(user, jobId);
+        }
+        if (!payload.empty()) results_.insert(key, {jobId, payload}, resultTtl_.load());
+        return payload;
     }
+    
+    size_t getClusterSubmissions() const { return clusterSubmissions_.load(); }
+    size_t getCoalescedSubmissions() const { return coalescedSubmissions_.load(); }
+    JobResultCache::Stats getResultCacheStats() const { return results_.getStats(); }
+};
+
+// Tuning for DistributedDataProxy's chunk cache and prefetcher
+struct ChunkPrefetchConfig {
+    size_t chunkBytes = 1 << 20;        // Payload per chunk
+    size_t cacheBytes = 16 << 20;       // Local LRU budget
+    size_t maxInFlight = 4;             // Concurrent transfers (fetcher threads)
+    size_t prefetchDepth = 4;           // Chunks predicted ahead of the reader
+    bool prefetching = true;
+    std::chrono::milliseconds fetchLatency{30};  // Simulated per-chunk transfer time
 };
 
 // Distributed data proxy for large scientific datasets
 class DistributedDataProxy : public ComputationalResource {
+public:
+    struct ChunkData {
+        std::string id;
+        std::string sourceNode;
+        std::vector<double> samples;
+    };
+    
+    struct Stats {
+        size_t accesses = 0;
+        size_t hits = 0;               // Served without waiting
+        size_t latePrefetches = 0;     // Predicted but still in transit when read
+        size_t prefetchesIssued = 0;
+        size_t usefulPrefetches = 0;   // Prefetched chunks that were later read
+        size_t wastedPrefetches = 0;   // Evicted before anyone read them
+        size_t evictions = 0;
+        size_t bytesMoved = 0;
+        
+        double hitRate() const { return accesses ? double(hits) / accesses : 0.0; }
+        double prefetchAccuracy() const {
+            return prefetchesIssued ? double(usefulPrefetches) / prefetchesIssued : 0.0;
+        }
+    };
+    
 private:
     std::string datasetName_;
     double totalSize_; // TB
     std::vector<std::string> dataNodes_;
-    mutable std::unordered_map<std::string, bool> localChunks_;
+    ChunkPrefetchConfig config_;
+    
+    struct CachedChunk {
+        std::shared_ptr<const ChunkData> data;
+        std::list<std::string>::iterator lruPosition;
+        bool prefetched;
+        bool used;
+    };
+    
+    struct FetchRequest {
+        std::string id;
+        long index;
+        bool prefetch;
+    };
+    
+    // Access-pattern detector: a stride seen twice in a row is predicted
+    struct StrideDetector {
+        std::string prefix;
+        long lastIndex = -1;
+        long lastStride = 0;
+    } detector_;
+    
+    std::mutex mutex_;
+    std::condition_variable work_;
+    std::condition_variable ready_;
+    std::list<std::string> lru_;  // Most recently used first
+    std::unordered_map<std::string, CachedChunk> localChunks_;
+    std::unordered_map<std::string, bool> inFlight_;  // Queued or transferring
+    std::deque<FetchRequest> queue_;
+    std::vector<std::thread> fetchers_;
+    size_t residentBytes_ = 0;
+    bool stop_ = false;
+    Stats stats_;
+    
+    // "chunk_017" -> ("chunk_", 17, width 3); index -1 when there is no number.
+    // Throws std::invalid_argument when the number does not fit in a long.
+    static long parseChunkIndex(const std::string& id, std::string& prefix, size_t& width) {
+        size_t pos = id.size();
+        while (pos > 0 && std::isdigit(static_cast<unsigned char>(id[pos - 1]))) --pos;
+        width = id.size() - pos;
+        prefix = id.substr(0, pos);
+        if (width == 0) return -1;
+        try {
+            return std::stol(id.substr(pos));
+        } catch (const std::out_of_range&) {
+            throw std::invalid_argument("DistributedDataProxy: chunk index out of range in \"" + id + "\"");
+        }
+    }
+    
+    static std::string formatChunkId(const std::string& prefix, long index, size_t width) {
+        std::ostringstream id;
+        id << prefix << std::setw(static_cast<int>(width)) << std::setfill('0') << index;
+        return id.str();
+    }
+    
+    // Chunks are striped round-robin across the data nodes
+    const std::string& homeNode(long index) const {
+        return dataNodes_[static_cast<size_t>(std::max(index, 0L)) % dataNodes_.size()];
+    }
+    
+    std::shared_ptr<const ChunkData> transfer(const FetchRequest& request) const {
+        std::this_thread::sleep_for(config_.fetchLatency);
+        auto chunk = std::make_shared<ChunkData>();
+        chunk->id = request.id;
+        chunk->sourceNode = homeNode(request.index);
+        chunk->samples.resize(config_.chunkBytes / sizeof(double));
+        const double phase = 0.001 * static_cast<double>(request.index);
+        for (size_t i = 0; i < chunk->samples.size(); ++i) {
+            chunk->samples[i] = std::sin(phase + 1e-4 * static_cast<double>(i));
+        }
+        return chunk;
+    }
+    
+    void fetcherLoop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            work_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (stop_) return;
+            FetchRequest request = queue_.front();
+            queue_.pop_front();
+            lock.unlock();
+            auto chunk = transfer(request);
+            lock.lock();
+            
+            lru_.push_front(request.id);
+            localChunks_[request.id] = {chunk, lru_.begin(), request.prefetch, false};
+            residentBytes_ += config_.chunkBytes;
+            stats_.bytesMoved += config_.chunkBytes;
+            inFlight_.erase(request.id);
+            evictToBudget();
+            ready_.notify_all();
+        }
+    }
+    
+    // Readers keep their shared_ptr, so eviction never invalidates data in use
+    void evictToBudget() {
+        while (residentBytes_ > config_.cacheBytes && lru_.size() > 1) {
+            auto victim = localChunks_.find(lru_.back());
+            if (victim->second.prefetched && !victim->second.used) ++stats_.wastedPrefetches;
+            localChunks_.erase(victim);
+            lru_.pop_back();
+            residentBytes_ -= config_.chunkBytes;
+            ++stats_.evictions;
+        }
+    }
+    
+    // Called with mutex_ held after every read, with the read chunk's parsed id
+    void predictAndPrefetch(long index, const std::string& prefix, size_t width) {
+        if (index < 0) return;
+        if (prefix != detector_.prefix) {
+            detector_ = StrideDetector();
+            detector_.prefix = prefix;
+        }
+        const long stride = detector_.lastIndex >= 0 ? index - detector_.lastIndex : 0;
+        const bool predictable = stride != 0 && stride == detector_.lastStride;
+        detector_.lastIndex = index;
+        detector_.lastStride = stride;
+        if (!config_.prefetching || !predictable) return;
+        
+        // Keep at most prefetchDepth predictions queued ahead of the reader
+        const size_t budget = config_.prefetchDepth + config_.maxInFlight;
+        for (size_t k = 1; k <= config_.prefetchDepth && inFlight_.size() < budget; ++k) {
+            // Stop at 0 and at the top of the index range instead of overflowing
+            const long steps = static_cast<long>(k);
+            if (stride > 0 ? (std::numeric_limits<long>::max() - index) / stride < steps
+                           : index / -stride < steps) {
+                break;
+            }
+            const long next = index + stride * steps;
+            const std::string nextId = formatChunkId(prefix, next, width);
+            if (localChunks_.count(nextId) || inFlight_.count(nextId)) continue;
+            inFlight_[nextId] = true;
+            queue_.push_back({nextId, next, true});
+            ++stats_.prefetchesIssued;
+        }
+        work_.notify_all();
+    }
     
 public:
-    DistributedDataProxy(const std::string& dataset, double size)
-        : datasetName_(dataset), totalSize_(size) {
+    DistributedDataProxy(const std::string& dataset, double size,
+                         const ChunkPrefetchConfig& config = ChunkPrefetchConfig())
+        : datasetName_(dataset), totalSize_(size), config_(config) {
         dataNodes_ = {"node1.hpc.edu", "node2.hpc.edu", "node3.hpc.edu"};
         std::cout << "\nDistributed data proxy for: " << datasetName_ 
                   << " (" << totalSize_ << " TB across " 
                   << dataNodes_.size() << " nodes)\n";
+        for (size_t i = 0; i < std::max<size_t>(config_.maxInFlight, 1); ++i) {
+            fetchers_.emplace_back(&DistributedDataProxy::fetcherLoop, this);
+        }
     }
     
-    void submitJob(const std::string& jobScript, int cores, double memory) override {
+    ~DistributedDataProxy() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_.notify_all();
+        for (auto& fetcher : fetchers_) fetcher.join();
+    }
+    
+    DistributedDataProxy(const DistributedDataProxy&) = delete;
+    DistributedDataProxy& operator=(const DistributedDataProxy&) = delete;
+    
+    std::string submitJob(const std::string& jobScript, int cores, double memory) override {
         std::cout << "\nScheduling data-local computation:\n";
         std::cout << "  Dataset: " << datasetName_ << "\n";
         std::cout << "  Analyzing data locality...\n";
         std::cout << "  Job scheduled on nodes with data chunks\n";
+        return "";
     }
     
     std::string getStatus() override {
@@ -357,21 +961,208 @@ public:
     }
     
     double getUsage() override {
-        return 0.0; // Not applicable for data proxy
+        std::lock_guard<std::mutex> lock(mutex_);
+        return double(residentBytes_) / double(config_.cacheBytes);  // Local cache fill
+    }
+    
+    // Blocks until the chunk is local. A demanded chunk jumps ahead of queued
+    // predictions; each read feeds the stride detector. Throws
+    // std::invalid_argument, before any state changes, for an id whose
+    // number overflows a long.
+    std::shared_ptr<const ChunkData> readChunk(const std::string& chunkId, bool* wasLocal = nullptr) {
+        std::string prefix;
+        size_t width = 0;
+        const long index = parseChunkIndex(chunkId, prefix, width);
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++stats_.accesses;
+        bool waited = false;
+        std::shared_ptr<const ChunkData> chunk;
+        while (true) {
+            auto it = localChunks_.find(chunkId);
+            if (it != localChunks_.end()) {
+                CachedChunk& cached = it->second;
+                lru_.splice(lru_.begin(), lru_, cached.lruPosition);
+                if (cached.prefetched && !cached.used) {
+                    ++stats_.usefulPrefetches;
+                    if (waited) ++stats_.latePrefetches;
+                }
+                cached.used = true;
+                chunk = cached.data;
+                break;
+            }
+            if (!inFlight_.count(chunkId)) {
+                inFlight_[chunkId] = false;
+                queue_.push_front({chunkId, index, false});
+                work_.notify_one();
+            } else {
+                auto queued = std::find_if(queue_.begin(), queue_.end(),
+                                           [&chunkId](const FetchRequest& r) { return r.id == chunkId; });
+                if (queued != queue_.end() && queued != queue_.begin()) {
+                    FetchRequest promoted = *queued;
+                    queue_.erase(queued);
+                    queue_.push_front(promoted);
+                }
+            }
+            waited = true;
+            ready_.wait(lock);
+        }
+        if (!waited) ++stats_.hits;
+        if (wasLocal) *wasLocal = !waited;
+        predictAndPrefetch(index, prefix, width);
+        return chunk;
     }
     
     void retrieveResults(const std::string& chunkId) override {
-        if (localChunks_[chunkId]) {
+        bool wasLocal = false;
+        auto chunk = readChunk(chunkId, &wasLocal);
+        if (wasLocal) {
             std::cout << "  Chunk " << chunkId << " already cached locally\n";
         } else {
-            std::cout << "  Streaming chunk " << chunkId << " from remote node...\n";
+            std::cout << "  Streaming chunk " << chunkId << " from " << chunk->sourceNode << "...\n";
             std::cout << "  Using parallel GridFTP for " 
-                      << (totalSize_ / dataNodes_.size()) << " TB transfer\n";
-            localChunks_[chunkId] = true;
+                      << (config_.chunkBytes >> 20) << " MB transfer\n";
         }
     }
+    
+    Stats getStats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
 };
 
+// Chunked analysis pass with and without the prefetcher: each chunk costs
+// one transfer latency to fetch and a fixed amount of local compute
+void chunkPrefetchExample() {
+    std::cout << "\nPrefetching chunk scheduler (30 ms transfers, 10 ms compute per chunk):\n";
+    auto analyse = [](DistributedDataProxy& data, long first, long stride, int count) {
+        double checksum = 0.0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; ++i) {
+            std::ostringstream id;
+            id << "chunk_" << std::setw(3) << std::setfill('0') << first + stride * i;
+            auto chunk = data.readChunk(id.str());
+            for (double v : chunk->samples) checksum += v;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        double ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(ms, checksum);
+    };
+    auto report = [](const char* label, const std::pair<double, double>& run,
+                     const DistributedDataProxy::Stats& stats) {
+        std::ostringstream line;
+        line << "  " << std::left << std::setw(22) << label << std::right
+             << std::fixed << std::setprecision(0) << std::setw(6) << run.first << " ms | hit rate "
+             << std::setprecision(2) << stats.hitRate() << " | prefetch accuracy "
+             << stats.prefetchAccuracy() << " (" << stats.usefulPrefetches << "/"
+             << stats.prefetchesIssued << ", " << stats.latePrefetches << " late) | "
+             << (stats.bytesMoved >> 20) << " MB moved\n";
+        std::cout << line.str();
+    };
+    
+    ChunkPrefetchConfig demandOnly;
+    demandOnly.prefetching = false;
+    struct Scan { const char* label; long first; long stride; };
+    const Scan scans[] = {{"sequential", 100, 1}, {"strided (every 3rd)", 400, 3}};
+    for (const Scan& scan : scans) {
+        std::cout << " " << scan.label << ", 32 chunks:\n";
+        {
+            DistributedDataProxy data("ERA5_Reanalysis", 5.0, demandOnly);
+            auto run = analyse(data, scan.first, scan.stride, 32);
+            report("demand fetch", run, data.getStats());
+        }
+        {
+            DistributedDataProxy data("ERA5_Reanalysis", 5.0);
+            auto run = analyse(data, scan.first, scan.stride, 32);
+            report("prefetch (depth 4)", run, data.getStats());
+        }
+    }
+    
+    DistributedDataProxy data("ERA5_Reanalysis", 5.0);
+    try {
+        data.readChunk("chunk_99999999999999999999999");
+    } catch (const std::invalid_argument& e) {
+        std::cout << " Rejected: " << e.what() << "\n";
+    }
+}
+
+// Content-addressed job cache: normalization, in-flight deduplication,
+// expiry, the byte budget and the disk tier across a proxy restart
+void jobResultCacheExample(CachingHPCProxy& cluster) {
+    std::cout << "\nContent-addressed job results:\n";
+    const std::string script =
+        "#!/bin/bash\n#SBATCH --nodes=4\n# mesh study, run 3\nsrun ./fem_solver --mesh beam.msh\n";
+    const std::string reformatted =
+        "#!/bin/bash\r\n#SBATCH   --nodes=4\r\n\r\n# re-run after lunch\r\n  srun ./fem_solver  --mesh beam.msh\r\n";
+    const std::string first = cluster.submitJob(script, 128, 512.0);
+    const std::string second = cluster.submitJob(reformatted, 128, 512.0);
+    std::cout << "Reformatted script mapped to " << second
+              << (first == second ? " (same job, not resubmitted)\n" : " (resubmitted)\n");
+    
+    std::cout << "\n8 concurrent identical submissions:\n";
+    const size_t before = cluster.getClusterSubmissions();
+    std::vector<std::thread> clients;
+    std::vector<std::string> ids(8);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        clients.emplace_back([&cluster, &ids, i] {
+            ids[i] = cluster.submitJob("srun ./spectral_dns --re 5200\n", 64, 256.0);
+        });
+    }
+    for (auto& client : clients) client.join();
+    const bool sameId = std::all_of(ids.begin(), ids.end(),
+                                    [&ids](const std::string& id) { return id == ids[0]; });
+    std::cout << "Reached the cluster " << cluster.getClusterSubmissions() - before
+              << " time(s); " << cluster.getCoalescedSubmissions()
+              << " coalesced while in flight; all clients got " << ids[0]
+              << (sameId ? "\n" : " (IDs differ!)\n");
+    
+    std::cout << "\nShort TTL entry:\n";
+    cluster.setResultTtl(std::chrono::milliseconds(50));
+    const std::string shortLived = cluster.submitJob("srun ./qmc_sampler --walkers 4096\n", 32, 64.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(80));
+    const std::string rerun = cluster.submitJob("srun ./qmc_sampler --walkers 4096\n", 32, 64.0);
+    std::cout << "After expiry: " << shortLived << " -> " << rerun << "\n";
+    cluster.setResultTtl(std::chrono::hours(24));
+    
+    auto stats = cluster.getResultCacheStats();
+    std::cout << "Result cache: " << stats.hits << " hits, " << stats.misses << " misses, "
+              << stats.expirations << " expired, " << stats.entries << " entries, "
+              << stats.bytes << " bytes\n";
+    
+    // Byte budget: the oldest entries make room for new ones
+    JobResultCache bounded(16 * 1024);
+    for (int i = 0; i < 500; ++i) {
+        bounded.insert("job-" + std::to_string(i), {"JOB_" + std::to_string(i), std::string(200, 'r')},
+                       std::chrono::minutes(5));
+    }
+    stats = bounded.getStats();
+    std::cout << "16 KiB budget after 500 results: " << stats.entries << " resident, "
+              << stats.bytes << " bytes, " << stats.evictions << " evicted\n";
+    
+    // Disk tier: a fresh proxy (a new process, in practice) answers from the
+    // directory without opening a connection to the cluster
+    std::cout << "\nDisk tier across restart:\n";
+    const std::string cacheDir = "hpc_result_cache";
+    std::string jobId;
+    {
+        CachingHPCProxy firstRun("Stampede3", "stampede3.tacc.edu", 560000, 2900.0, 1 << 20, cacheDir);
+        firstRun.setCurrentUser("postdoc_jones");
+        jobId = firstRun.submitJob("srun ./climate_ensemble --members 40\n", 128, 1024.0);
+        firstRun.retrieveResults(jobId);
+    }
+    {
+        CachingHPCProxy restarted("Stampede3", "stampede3.tacc.edu", 560000, 2900.0, 1 << 20, cacheDir);
+        restarted.setCurrentUser("postdoc_jones");
+        const std::string again = restarted.submitJob("srun ./climate_ensemble --members 40\n", 128, 1024.0);
+        const std::string payload = restarted.fetchResults(again);
+        stats = restarted.getResultCacheStats();
+        std::cout << "Restarted proxy: " << again << " -> \"" << payload << "\" ("
+                  << stats.diskHits << " disk hits, " << restarted.getClusterSubmissions()
+                  << " cluster submissions)\n";
+    }
+    std::filesystem::remove_all(cacheDir);
+}
+
 int main() {
     std::cout << "=== HPC Resource Proxy Pattern Demo ===\n\n";
     
@@ -424,12 +1215,20 @@ int main() {
     }
     
     std::cout << "\nJob submission (invalidates cache):\n";
-    cachedCluster.submitJob("large_scale_fem.slurm", 1024, 4096.0);
+    std::string femJob = cachedCluster.submitJob("large_scale_fem.slurm", 256, 2048.0);
     cachedCluster.getUsage();
     
     std::cout << "\nRetrieving results (with caching):\n";
-    cachedCluster.retrieveResults("JOB_1002");
-    cachedCluster.retrieveResults("JOB_1002"); // Should use cache
+    cachedCluster.retrieveResults(femJob);
+    cachedCluster.retrieveResults(femJob); // Should use cache
+    
+    std::cout << "\nSame job ID requested by a guest:\n";
+    cachedCluster.setCurrentUser("guest");
+    const bool leaked = !cachedCluster.fetchResults(femJob).empty();
+    std::cout << (leaked ? "Cached results served to guest!\n" : "Guest refused despite the cached copy\n");
+    cachedCluster.setCurrentUser("postdoc_jones");
+    
+    jobResultCacheExample(cachedCluster);
     
     // Distributed Data Proxy
     std::cout << "\n\n4. Distributed Data Proxy Demo:\n";
@@ -442,6 +1241,8 @@ int main() {
     climateData.retrieveResults("chunk_002");
     climateData.retrieveResults("chunk_001"); // Cached
     
+    chunkPrefetchExample();
+    
     std::cout << "\nProxy pattern enables efficient management of\n";
     std::cout << "remote HPC resources and large scientific datasets!\n";
     
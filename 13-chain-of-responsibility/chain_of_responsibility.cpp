@@ -7,6 +7,9 @@
 #include <cmath>
 #include <limits>
 #include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <sstream>
 
 // Data quality issues that validators can detect
 enum class DataIssueType {
@@ -59,6 +62,7 @@ public:
     }
     
     const std::vector<DataIssueType>& getIssues() const { return detectedIssues_; }
+    void clearIssues() { detectedIssues_.clear(); }
     
     void setValidated(bool valid) { validated_ = valid; }
     bool isValidated() const { return validated_; }
@@ -77,6 +81,19 @@ public:
     }
 };
 
+// Streaming half of a validator. The dataset is fed in order as contiguous
+// blocks; finish() prints the report and records issues on the dataset.
+class ValidationKernel {
+public:
+    virtual ~ValidationKernel() = default;
+    virtual void consume(const double* block, size_t offset, size_t count) = 0;
+    
+    // True once the verdict is a failure no matter what the remaining data holds
+    virtual bool failureDecided() const { return false; }
+    
+    virtual bool finish(ScientificDataset& dataset) = 0;
+};
+
 // Abstract validator in the chain
 class DataValidator {
 protected:
@@ -93,16 +110,22 @@ public:
         nextValidator_ = validator;
     }
     
+    const std::shared_ptr<DataValidator>& getNext() const { return nextValidator_; }
+    const std::string& getName() const { return validatorName_; }
+    
+    // Per-dataset streaming state; the fused pipeline runs every kernel of
+    // the chain over each block while it is still in cache
+    virtual std::unique_ptr<ValidationKernel> createKernel(const ScientificDataset& dataset) const = 0;
+    
+    // A decided failure of a hard constraint makes the rest of the data
+    // irrelevant, so a fused pass may stop reading
+    virtual bool isHardConstraint() const { return false; }
+    
     virtual void validate(ScientificDataset& dataset) {
         std::cout << "\n[" << validatorName_ << "] Starting validation...\n";
         
         bool passedValidation = performValidation(dataset);
-        
-        if (!passedValidation) {
-            std::cout << "  ⚠️  Issues detected by " << validatorName_ << "\n";
-        } else {
-            std::cout << "  ✓ Passed " << validatorName_ << " validation\n";
-        }
+        reportOutcome(passedValidation);
         
         // Always pass to next validator in chain
         if (nextValidator_) {
@@ -113,10 +136,15 @@ public:
         }
     }
     
-protected:
-    virtual bool performValidation(ScientificDataset& dataset) = 0;
+    void reportOutcome(bool passedValidation) const {
+        if (!passedValidation) {
+            std::cout << "  ⚠️  Issues detected by " << validatorName_ << "\n";
+        } else {
+            std::cout << "  ✓ Passed " << validatorName_ << " validation\n";
+        }
+    }
     
-    void summarizeValidation(ScientificDataset& dataset) {
+    static void summarizeValidation(ScientificDataset& dataset) {
         std::cout << "\n=== Validation Summary ===\n";
         if (dataset.getIssues().empty()) {
             std::cout << "✓ Dataset passed all validations!\n";
@@ -130,6 +158,18 @@ protected:
             dataset.setValidated(false);
         }
     }
+    
+protected:
+    // Chained mode: this validator's own full pass over the data
+    virtual bool performValidation(ScientificDataset& dataset) {
+        auto kernel = createKernel(dataset);
+        const auto& data = dataset.getData();
+        const size_t blockSize = 8192;
+        for (size_t offset = 0; offset < data.size(); offset += blockSize) {
+            kernel->consume(data.data() + offset, offset, std::min(blockSize, data.size() - offset));
+        }
+        return kernel->finish(dataset);
+    }
 };
 
 // Concrete validators
@@ -137,309 +177,508 @@ class MissingValueValidator : public DataValidator {
 public:
     MissingValueValidator() : DataValidator("Missing Value Validator") {}
     
-protected:
-    bool performValidation(ScientificDataset& dataset) override {
-        const auto& data = dataset.getData();
-        int missingCount = 0;
-        int nanCount = 0;
-        int infCount = 0;
-        
-        for (const auto& value : data) {
-            if (std::isnan(value)) {
-                nanCount++;
-            } else if (std::isinf(value)) {
-                infCount++;
-            } else if (value == -999.0 || value == -9999.0) { // Common missing value markers
-                missingCount++;
+    std::unique_ptr<ValidationKernel> createKernel(const ScientificDataset& dataset) const override {
+        return std::unique_ptr<ValidationKernel>(new Kernel(dataset.getData().size(), tolerance_));
+    }
+        
+private:
+    class Kernel : public ValidationKernel {
+        size_t total_;
+        double tolerance_;
+        size_t missingCount_ = 0, nanCount_ = 0, infCount_ = 0;
+        
+    public:
+        Kernel(size_t total, double tolerance) : total_(total), tolerance_(tolerance) {}
+        
+        void consume(const double* block, size_t, size_t count) override {
+            size_t nan = 0, inf = 0, sentinel = 0;
+            for (size_t i = 0; i < count; ++i) {
+                const double value = block[i];
+                nan += std::isnan(value);
+                inf += std::isinf(value);
+                sentinel += (value == -999.0) | (value == -9999.0);  // Common missing value markers
             }
+            nanCount_ += nan;
+            infCount_ += inf;
+            missingCount_ += sentinel;
         }
         
-        int totalIssues = missingCount + nanCount + infCount;
-        double missingRatio = (double)totalIssues / data.size();
-        
-        std::cout << "  Checking for missing values...\n";
-        std::cout << "  Found: " << nanCount << " NaN, " 
-                  << infCount << " Inf, " 
-                  << missingCount << " sentinel values\n";
-        std::cout << "  Missing data ratio: " 
-                  << std::fixed << std::setprecision(2) 
-                  << (missingRatio * 100) << "%\n";
+        bool failureDecided() const override {
+            return missingCount_ + nanCount_ + infCount_ > tolerance_ * total_;
+        }
         
-        if (missingRatio > tolerance_) {
-            dataset.addIssue(DataIssueType::MISSING_VALUES);
-            return false;
+        bool finish(ScientificDataset& dataset) override {
+            int totalIssues = missingCount_ + nanCount_ + infCount_;
+            double missingRatio = (double)totalIssues / total_;
+        
+            std::cout << "  Checking for missing values...\n";
+            std::cout << "  Found: " << nanCount_ << " NaN, " 
+                      << infCount_ << " Inf, " 
+                      << missingCount_ << " sentinel values\n";
+            std::cout << "  Missing data ratio: " 
+                      << std::fixed << std::setprecision(2) 
+                      << (missingRatio * 100) << "%\n";
+            
+            if (missingRatio > tolerance_) {
+                dataset.addIssue(DataIssueType::MISSING_VALUES);
+                return false;
+            }
+            return true;
         }
-        return true;
-    }
+    };
 };
 
 class RangeValidator : public DataValidator {
 public:
     RangeValidator() : DataValidator("Physical Range Validator", 0.0) {}
     
-protected:
-    bool performValidation(ScientificDataset& dataset) override {
-        const auto& data = dataset.getData();
-        double minExpected = dataset.getMinExpected();
-        double maxExpected = dataset.getMaxExpected();
-        int outOfRangeCount = 0;
-        double minFound = std::numeric_limits<double>::max();
-        double maxFound = std::numeric_limits<double>::lowest();
-        
-        for (const auto& value : data) {
-            if (!std::isnan(value) && !std::isinf(value)) {
-                minFound = std::min(minFound, value);
-                maxFound = std::max(maxFound, value);
+    std::unique_ptr<ValidationKernel> createKernel(const ScientificDataset& dataset) const override {
+        return std::unique_ptr<ValidationKernel>(
+            new Kernel(dataset.getMinExpected(), dataset.getMaxExpected()));
+    }
+        
+    bool isHardConstraint() const override { return true; }
                 
-                if (value < minExpected || value > maxExpected) {
-                    outOfRangeCount++;
+private:
+    class Kernel : public ValidationKernel {
+        double minExpected_, maxExpected_;
+        int outOfRangeCount_ = 0;
+        double minFound_ = std::numeric_limits<double>::max();
+        double maxFound_ = std::numeric_limits<double>::lowest();
+        
+    public:
+        Kernel(double minExpected, double maxExpected)
+            : minExpected_(minExpected), maxExpected_(maxExpected) {}
+        
+        void consume(const double* block, size_t, size_t count) override {
+            double lo = minFound_, hi = maxFound_;
+            int outside = 0;
+            for (size_t i = 0; i < count; ++i) {
+                const double value = block[i];
+                if (std::isfinite(value)) {
+                    lo = std::min(lo, value);
+                    hi = std::max(hi, value);
+                    outside += (value < minExpected_) | (value > maxExpected_);
                 }
             }
+            minFound_ = lo;
+            maxFound_ = hi;
+            outOfRangeCount_ += outside;
         }
         
-        std::cout << "  Checking physical range constraints...\n";
-        std::cout << "  Expected range: [" << minExpected << ", " 
-                  << maxExpected << "]\n";
-        std::cout << "  Actual range: [" << minFound << ", " 
-                  << maxFound << "]\n";
-        std::cout << "  Out of range values: " << outOfRangeCount << "\n";
+        bool failureDecided() const override { return outOfRangeCount_ > 0; }
         
-        if (outOfRangeCount > 0) {
-            dataset.addIssue(DataIssueType::PHYSICAL_CONSTRAINT_VIOLATION);
-            return false;
+        bool finish(ScientificDataset& dataset) override {
+            std::cout << "  Checking physical range constraints...\n";
+            std::cout << "  Expected range: [" << minExpected_ << ", " 
+                      << maxExpected_ << "]\n";
+            std::cout << "  Actual range: [" << minFound_ << ", " 
+                      << maxFound_ << "]\n";
+            std::cout << "  Out of range values: " << outOfRangeCount_ << "\n";
+            
+            if (outOfRangeCount_ > 0) {
+                dataset.addIssue(DataIssueType::PHYSICAL_CONSTRAINT_VIOLATION);
+                return false;
+            }
+            return true;
         }
-        return true;
-    }
+    };
 };
 
 class StatisticalValidator : public DataValidator {
 public:
     StatisticalValidator() : DataValidator("Statistical Outlier Validator", 3.0) {} // 3 sigma
     
-protected:
-    bool performValidation(ScientificDataset& dataset) override {
-        auto& data = dataset.getDataMutable();
-        
-        // Calculate mean and standard deviation
-        double sum = 0.0, sumSq = 0.0;
-        int validCount = 0;
-        
-        for (const auto& value : data) {
-            if (!std::isnan(value) && !std::isinf(value)) {
-                sum += value;
-                sumSq += value * value;
-                validCount++;
+    std::unique_ptr<ValidationKernel> createKernel(const ScientificDataset&) const override {
+        return std::unique_ptr<ValidationKernel>(new Kernel(tolerance_));
+    }
+        
+private:
+    // One pass: exact moments per block, merged with Chan's formula. The
+    // z-score test needs the final moments, so values beyond a looser gate
+    // (0.75 x threshold) of the running estimate are kept as candidates and
+    // re-tested at the end. The running estimate includes the current block,
+    // which is scanned twice while it is cache-resident.
+    //
+    // The gate can drift from the final statistics (an early outlier judged
+    // against a small-sample estimate), so finish() only trusts the
+    // candidates if every block's gate interval lies inside the final
+    // threshold interval; otherwise, or if the candidate list hit its cap,
+    // it re-tests the whole dataset exactly.
+    class Kernel : public ValidationKernel {
+        static constexpr size_t kMaxCandidates = 1 << 16;  // 1 MiB
+        
+        double tolerance_;
+        size_t count_ = 0;
+        double mean_ = 0.0;
+        double m2_ = 0.0;
+        std::vector<std::pair<size_t, double>> candidates_;
+        bool candidatesOverflowed_ = false;
+        // Union of the per-block gate intervals: values inside were dropped
+        double droppedLo_ = std::numeric_limits<double>::max();
+        double droppedHi_ = std::numeric_limits<double>::lowest();
+        
+    public:
+        explicit Kernel(double tolerance) : tolerance_(tolerance) {}
+        
+        void consume(const double* block, size_t offset, size_t count) override {
+            // Two-pass moments of the cache-resident block, no per-sample divide
+            size_t n = 0;
+            double sum = 0.0;
+            for (size_t i = 0; i < count; ++i) {
+                const double value = block[i];
+                if (std::isfinite(value)) {
+                    sum += value;
+                    ++n;
+                }
+            }
+            if (n == 0) return;
+            const double mean = sum / n;
+            double m2 = 0.0;
+            for (size_t i = 0; i < count; ++i) {
+                const double value = block[i];
+                if (std::isfinite(value)) m2 += (value - mean) * (value - mean);
+            }
+            const size_t merged = count_ + n;
+            const double delta = mean - mean_;
+            mean_ += delta * n / merged;
+            m2_ += m2 + delta * delta * (double(count_) * n / merged);
+            count_ = merged;
+        
+            const double gate = 0.75 * tolerance_ * std::sqrt(m2_ / count_);
+            droppedLo_ = std::min(droppedLo_, mean_ - gate);
+            droppedHi_ = std::max(droppedHi_, mean_ + gate);
+            if (candidatesOverflowed_) return;
+            for (size_t i = 0; i < count; ++i) {
+                const double value = block[i];
+                if (std::isfinite(value) && std::abs(value - mean_) > gate) {
+                    candidates_.push_back(std::make_pair(offset + i, value));
+                }
+            }
+            if (candidates_.size() > kMaxCandidates) {
+                candidatesOverflowed_ = true;
+                std::vector<std::pair<size_t, double>>().swap(candidates_);
             }
         }
         
-        if (validCount < 2) return true; // Not enough data for statistics
-        
-        double mean = sum / validCount;
-        double variance = (sumSq / validCount) - (mean * mean);
-        double stdDev = std::sqrt(variance);
+        bool finish(ScientificDataset& dataset) override {
+            int validCount = static_cast<int>(count_);
+            if (validCount < 2) return true; // Not enough data for statistics
         
-        // Detect outliers using Z-score
-        int outlierCount = 0;
-        std::vector<int> outlierIndices;
-        
-        for (size_t i = 0; i < data.size(); ++i) {
-            if (!std::isnan(data[i]) && !std::isinf(data[i])) {
-                double zScore = std::abs((data[i] - mean) / stdDev);
+            double mean = mean_;
+            double stdDev = std::sqrt(m2_ / count_);
+            
+            // Detect outliers using Z-score
+            int outlierCount = 0;
+            std::vector<std::pair<size_t, double>> outliers;
+            auto test = [&](size_t index, double value) {
+                double zScore = std::abs((value - mean) / stdDev);
                 if (zScore > tolerance_) {
                     outlierCount++;
-                    outlierIndices.push_back(i);
+                    if (outliers.size() < 3) outliers.push_back(std::make_pair(index, value));
+                }
+            };
+            const double limit = tolerance_ * stdDev;
+            const bool candidatesComplete = !candidatesOverflowed_ &&
+                droppedLo_ >= mean - limit && droppedHi_ <= mean + limit;
+            if (candidatesComplete) {
+                for (const auto& candidate : candidates_) test(candidate.first, candidate.second);
+            } else {
+                const auto& data = dataset.getData();
+                for (size_t i = 0; i < data.size(); ++i) {
+                    if (std::isfinite(data[i])) test(i, data[i]);
                 }
             }
-        }
-        
-        std::cout << "  Performing statistical analysis...\n";
-        std::cout << "  Mean: " << std::fixed << std::setprecision(4) << mean 
-                  << ", Std Dev: " << stdDev << "\n";
-        std::cout << "  Z-score threshold: " << tolerance_ << " sigma\n";
-        std::cout << "  Outliers detected: " << outlierCount 
-                  << " (" << std::fixed << std::setprecision(1) 
-                  << (100.0 * outlierCount / validCount) << "%)\n";
-        
-        if (outlierCount > validCount * 0.05) { // More than 5% outliers
-            dataset.addIssue(DataIssueType::OUTLIERS);
             
-            // Show some outlier examples
-            std::cout << "  Example outliers: ";
-            for (int i = 0; i < std::min(3, (int)outlierIndices.size()); ++i) {
-                int idx = outlierIndices[i];
-                std::cout << "index " << idx << " (" << data[idx] << ") ";
+            std::cout << "  Performing statistical analysis...\n";
+            std::cout << "  Mean: " << std::fixed << std::setprecision(4) << mean 
+                      << ", Std Dev: " << stdDev << "\n";
+            std::cout << "  Z-score threshold: " << tolerance_ << " sigma\n";
+            std::cout << "  Outliers detected: " << outlierCount 
+                      << " (" << std::fixed << std::setprecision(1) 
+                      << (100.0 * outlierCount / validCount) << "%)\n";
+            
+            if (outlierCount > validCount * 0.05) { // More than 5% outliers
+                dataset.addIssue(DataIssueType::OUTLIERS);
+                
+                // Show some outlier examples
+                std::cout << "  Example outliers: ";
+                for (const auto& outlier : outliers) {
+                    std::cout << "index " << outlier.first << " (" << outlier.second << ") ";
+                }
+                std::cout << "\n";
+                return false;
             }
-            std::cout << "\n";
-            return false;
+            return true;
         }
-        return true;
-    }
+    };
 };
 
 class NoiseAnalysisValidator : public DataValidator {
 public:
     NoiseAnalysisValidator() : DataValidator("Noise Level Validator", 0.20) {} // 20% SNR threshold
     
-protected:
-    bool performValidation(ScientificDataset& dataset) override {
-        const auto& data = dataset.getData();
-        double samplingRate = dataset.getSamplingRate();
-        
-        if (data.size() < 100) return true; // Need sufficient data for noise analysis
-        
-        // Calculate signal power (using moving average as "signal")
-        std::vector<double> smoothed;
-        int windowSize = 10;
-        for (size_t i = windowSize/2; i < data.size() - windowSize/2; ++i) {
-            double avg = 0.0;
-            for (int j = -windowSize/2; j <= windowSize/2; ++j) {
-                if (!std::isnan(data[i+j])) {
-                    avg += data[i+j];
+    std::unique_ptr<ValidationKernel> createKernel(const ScientificDataset& dataset) const override {
+        return std::unique_ptr<ValidationKernel>(
+            new Kernel(dataset.getData().size(), dataset.getSamplingRate(), tolerance_));
+    }
+        
+private:
+    // Moving-average signal estimate over an 11-sample window (sum / 10, as
+    // before). The last windowSize samples of each block are carried into
+    // the next so windows spanning a block boundary see contiguous data.
+    class Kernel : public ValidationKernel {
+        static const int windowSize = 10;
+        size_t total_;
+        double samplingRate_;
+        double tolerance_;
+        double signalPower_ = 0.0, noisePower_ = 0.0;
+        std::vector<double> window_;  // Carried tail followed by the current block
+        
+    public:
+        Kernel(size_t total, double samplingRate, double tolerance)
+            : total_(total), samplingRate_(samplingRate), tolerance_(tolerance) {}
+        
+        void consume(const double* block, size_t, size_t count) override {
+            if (total_ < 100) return;
+            window_.insert(window_.end(), block, block + count);
+            const size_t half = windowSize / 2;
+            if (window_.size() <= 2 * half) return;
+            
+            // Sliding window sum; a window holding an Inf is summed directly
+            // so the Inf cannot poison the running total
+            double signal = 0.0, noise = 0.0;
+            const double* w = window_.data();
+            double running = 0.0;
+            int infinities = 0;
+            for (size_t j = 0; j < 2 * half; ++j) {
+                if (std::isinf(w[j])) infinities++;
+                else if (!std::isnan(w[j])) running += w[j];
+            }
+            for (size_t i = half; i + half < window_.size(); ++i) {
+                const double entering = w[i + half];
+                if (std::isinf(entering)) infinities++;
+                else if (!std::isnan(entering)) running += entering;
+                
+                double avg = running;
+                if (infinities > 0) {
+                    avg = 0.0;
+                    for (int j = -windowSize/2; j <= windowSize/2; ++j) {
+                        const double v = w[i + j];
+                        avg += std::isnan(v) ? 0.0 : v;
+                    }
                 }
+                const double smoothed = avg / windowSize;
+                if (!std::isnan(w[i]) && !std::isnan(smoothed)) {
+                    signal += smoothed * smoothed;
+                    const double diff = w[i] - smoothed;
+                    noise += diff * diff;
+                }
+                
+                const double leaving = w[i - half];
+                if (std::isinf(leaving)) infinities--;
+                else if (!std::isnan(leaving)) running -= leaving;
             }
-            smoothed.push_back(avg / windowSize);
+            signalPower_ += signal;
+            noisePower_ += noise;
+            window_.erase(window_.begin(), window_.end() - 2 * half);
         }
         
-        // Calculate noise as difference from smoothed signal
-        double signalPower = 0.0, noisePower = 0.0;
-        for (size_t i = 0; i < smoothed.size(); ++i) {
-            size_t dataIdx = i + windowSize/2;
-            if (!std::isnan(data[dataIdx]) && !std::isnan(smoothed[i])) {
-                signalPower += smoothed[i] * smoothed[i];
-                double noise = data[dataIdx] - smoothed[i];
-                noisePower += noise * noise;
+        bool finish(ScientificDataset& dataset) override {
+            if (total_ < 100) return true; // Need sufficient data for noise analysis
+            
+            const size_t smoothedCount = total_ - windowSize;
+            double signalPower = signalPower_ / smoothedCount;
+            double noisePower = noisePower_ / smoothedCount;
+            
+            double snr = 10.0 * std::log10(signalPower / noisePower);
+            double noiseRatio = std::sqrt(noisePower) / std::sqrt(signalPower);
+            
+            std::cout << "  Analyzing noise characteristics...\n";
+            std::cout << "  Sampling rate: " << samplingRate_ << " Hz\n";
+            std::cout << "  Signal-to-Noise Ratio: " 
+                      << std::fixed << std::setprecision(2) << snr << " dB\n";
+            std::cout << "  Noise level: " 
+                      << std::fixed << std::setprecision(1) 
+                      << (noiseRatio * 100) << "% of signal\n";
+            
+            if (noiseRatio > tolerance_) {
+                dataset.addIssue(DataIssueType::NOISE_LEVEL);
+                return false;
             }
+            return true;
         }
-        
-        signalPower /= smoothed.size();
-        noisePower /= smoothed.size();
-        
-        double snr = 10.0 * std::log10(signalPower / noisePower);
-        double noiseRatio = std::sqrt(noisePower) / std::sqrt(signalPower);
-        
-        std::cout << "  Analyzing noise characteristics...\n";
-        std::cout << "  Sampling rate: " << samplingRate << " Hz\n";
-        std::cout << "  Signal-to-Noise Ratio: " 
-                  << std::fixed << std::setprecision(2) << snr << " dB\n";
-        std::cout << "  Noise level: " 
-                  << std::fixed << std::setprecision(1) 
-                  << (noiseRatio * 100) << "% of signal\n";
-        
-        if (noiseRatio > tolerance_) {
-            dataset.addIssue(DataIssueType::NOISE_LEVEL);
-            return false;
-        }
-        return true;
-    }
+    };
 };
 
 class CalibrationValidator : public DataValidator {
 public:
     CalibrationValidator() : DataValidator("Calibration Validator") {}
     
-protected:
-    bool performValidation(ScientificDataset& dataset) override {
-        const auto& data = dataset.getData();
-        const std::string& instrument = dataset.getInstrumentType();
+    std::unique_ptr<ValidationKernel> createKernel(const ScientificDataset& dataset) const override {
+        return std::unique_ptr<ValidationKernel>(new Kernel(dataset));
+    }
+    
+private:
+    // Accumulates what every instrument check needs in one pass: the means
+    // of the first and last quarter (baseline drift) and the overall mean
+    class Kernel : public ValidationKernel {
+        std::string instrument_;
+        size_t total_;
+        size_t quarterSize_;
+        double firstQuarter_ = 0.0, lastQuarter_ = 0.0, sum_ = 0.0;
+        int count1_ = 0, count2_ = 0, count_ = 0;
+        
+        static void accumulate(const double* block, size_t begin, size_t end,
+                               double& sum, int& count) {
+            double s = 0.0;
+            int c = 0;
+            for (size_t i = begin; i < end; ++i) {
+                if (!std::isnan(block[i])) {
+                    s += block[i];
+                    c++;
+                }
+            }
+            sum += s;
+            count += c;
+        }
         
-        // Instrument-specific calibration checks
-        std::cout << "  Checking calibration for " << instrument << "...\n";
+        // Simple baseline drift calculation
+        double calculateBaselineDrift() const {
+            if (total_ < 100) return 0.0;
+            if (count1_ > 0 && count2_ > 0) {
+                return std::abs(lastQuarter_ / count2_ - firstQuarter_ / count1_);
+            }
+            return 0.0;
+        }
         
-        bool calibrationOk = true;
+    public:
+        explicit Kernel(const ScientificDataset& dataset)
+            : instrument_(dataset.getInstrumentType()), total_(dataset.getData().size()),
+              quarterSize_(dataset.getData().size() / 4) {}
         
-        if (instrument == "Spectrometer") {
-            // Check for wavelength calibration issues
-            // Look for expected peaks or patterns
-            std::cout << "  Verifying spectral peak positions...\n";
-            std::cout << "  Checking baseline stability...\n";
-            
-            // Simulate calibration check
-            double baselineDrift = calculateBaselineDrift(data);
-            std::cout << "  Baseline drift: " << baselineDrift << " units\n";
-            
-            if (baselineDrift > 0.05) {
-                calibrationOk = false;
+        void consume(const double* block, size_t offset, size_t count) override {
+            const size_t end = offset + count;
+            if (offset < quarterSize_) {
+                accumulate(block, 0, std::min(end, quarterSize_) - offset, firstQuarter_, count1_);
+            }
+            const size_t lastBegin = total_ - quarterSize_;
+            if (end > lastBegin) {
+                accumulate(block, std::max(offset, lastBegin) - offset, count, lastQuarter_, count2_);
             }
+            if (instrument_ == "Thermometer") accumulate(block, 0, count, sum_, count_);
+        }
+        
+        bool finish(ScientificDataset& dataset) override {
+            const std::string& instrument = instrument_;
+            
+            // Instrument-specific calibration checks
+            std::cout << "  Checking calibration for " << instrument << "...\n";
             
-        } else if (instrument == "Thermometer") {
-            // Check temperature calibration
-            double temp = dataset.getTemperature();
-            std::cout << "  Reference temperature: " << temp << " K\n";
+            bool calibrationOk = true;
             
-            // Check if readings are consistent with environmental conditions
-            double avgReading = 0.0;
-            int count = 0;
-            for (const auto& value : data) {
-                if (!std::isnan(value)) {
-                    avgReading += value;
-                    count++;
+            if (instrument == "Spectrometer") {
+                // Check for wavelength calibration issues
+                // Look for expected peaks or patterns
+                std::cout << "  Verifying spectral peak positions...\n";
+                std::cout << "  Checking baseline stability...\n";
+                
+                double baselineDrift = calculateBaselineDrift();
+                std::cout << "  Baseline drift: " << baselineDrift << " units\n";
+                
+                if (baselineDrift > 0.05) {
+                    calibrationOk = false;
+                }
+                
+            } else if (instrument == "Thermometer") {
+                // Check temperature calibration
+                double temp = dataset.getTemperature();
+                std::cout << "  Reference temperature: " << temp << " K\n";
+                
+                // Check if readings are consistent with environmental conditions
+                double avgReading = sum_ / count_;
+                
+                double deviation = std::abs(avgReading - temp) / temp;
+                std::cout << "  Average reading: " << avgReading << " K\n";
+                std::cout << "  Deviation from reference: " 
+                          << (deviation * 100) << "%\n";
+                
+                if (deviation > 0.02) { // 2% tolerance
+                    calibrationOk = false;
                 }
+                
+            } else if (instrument == "Pressure Sensor") {
+                // Check pressure calibration
+                double pressure = dataset.getPressure();
+                std::cout << "  Reference pressure: " << pressure << " Pa\n";
+                // Similar checks...
             }
-            avgReading /= count;
-            
-            double deviation = std::abs(avgReading - temp) / temp;
-            std::cout << "  Average reading: " << avgReading << " K\n";
-            std::cout << "  Deviation from reference: " 
-                      << (deviation * 100) << "%\n";
             
-            if (deviation > 0.02) { // 2% tolerance
-                calibrationOk = false;
+            if (!calibrationOk) {
+                dataset.addIssue(DataIssueType::CALIBRATION_ERROR);
+                std::cout << "  ⚠️  Calibration drift detected!\n";
+                return false;
             }
             
-        } else if (instrument == "Pressure Sensor") {
-            // Check pressure calibration
-            double pressure = dataset.getPressure();
-            std::cout << "  Reference pressure: " << pressure << " Pa\n";
-            // Similar checks...
+            std::cout << "  ✓ Calibration within specifications\n";
+            return true;
         }
-        
-        if (!calibrationOk) {
-            dataset.addIssue(DataIssueType::CALIBRATION_ERROR);
-            std::cout << "  ⚠️  Calibration drift detected!\n";
-            return false;
-        }
-        
-        std::cout << "  ✓ Calibration within specifications\n";
-        return true;
-    }
-    
+    };
+};
+
+// How DataValidationPipeline walks the data
+enum class ValidationMode {
+    CHAINED,  // Each validator makes its own pass (one memory sweep per validator)
+    FUSED     // One sweep in cache-sized blocks feeding every validator's kernel
+};
+
+// Data validation pipeline using chain of responsibility
+class DataValidationPipeline {
 private:
-    double calculateBaselineDrift(const std::vector<double>& data) {
-        // Simple baseline drift calculation
-        if (data.size() < 100) return 0.0;
-        
-        double firstQuarter = 0.0, lastQuarter = 0.0;
-        int quarterSize = data.size() / 4;
-        int count1 = 0, count2 = 0;
-        
-        for (int i = 0; i < quarterSize; ++i) {
-            if (!std::isnan(data[i])) {
-                firstQuarter += data[i];
-                count1++;
-            }
+    std::shared_ptr<DataValidator> firstValidator_;
+    ValidationMode mode_ = ValidationMode::CHAINED;
+    size_t blockSize_ = 8192;         // 64 KiB of doubles: stays in L2 across all kernels
+    bool stopOnHardFailure_ = false;
+    size_t samplesRead_ = 0;
+    
+    void validateFused(ScientificDataset& dataset) {
+        std::vector<DataValidator*> chain;
+        std::vector<std::unique_ptr<ValidationKernel>> kernels;
+        for (DataValidator* v = firstValidator_.get(); v; v = v->getNext().get()) {
+            chain.push_back(v);
+            kernels.push_back(v->createKernel(dataset));
         }
         
-        for (size_t i = data.size() - quarterSize; i < data.size(); ++i) {
-            if (!std::isnan(data[i])) {
-                lastQuarter += data[i];
-                count2++;
+        const auto& data = dataset.getData();
+        DataValidator* stoppedBy = nullptr;
+        size_t offset = 0;
+        while (offset < data.size() && !stoppedBy) {
+            const size_t count = std::min(blockSize_, data.size() - offset);
+            for (size_t k = 0; k < kernels.size(); ++k) {
+                kernels[k]->consume(data.data() + offset, offset, count);
+            }
+            offset += count;
+            if (!stopOnHardFailure_) continue;
+            for (size_t k = 0; k < kernels.size(); ++k) {
+                if (chain[k]->isHardConstraint() && kernels[k]->failureDecided()) {
+                    stoppedBy = chain[k];
+                    break;
+                }
             }
         }
-        
-        if (count1 > 0 && count2 > 0) {
-            firstQuarter /= count1;
-            lastQuarter /= count2;
-            return std::abs(lastQuarter - firstQuarter);
+        samplesRead_ = offset;
+        
+        for (size_t k = 0; k < chain.size(); ++k) {
+            std::cout << "\n[" << chain[k]->getName() << "] Starting validation...\n";
+            if (stoppedBy && chain[k] != stoppedBy) {
+                std::cout << "  Skipped: stream stopped at sample " << offset << " of "
+                          << data.size() << " by " << stoppedBy->getName() << "\n";
+                continue;
+            }
+            chain[k]->reportOutcome(kernels[k]->finish(dataset));
         }
-        
-        return 0.0;
+        DataValidator::summarizeValidation(dataset);
     }
-};
-
-// Data validation pipeline using chain of responsibility
-class DataValidationPipeline {
-private:
-    std::shared_ptr<DataValidator> firstValidator_;
     
 public:
     DataValidationPipeline() {
@@ -463,13 +702,27 @@ public:
         std::cout << "       → Noise Level → Calibration Check\n\n";
     }
     
+    void setMode(ValidationMode mode) { mode_ = mode; }
+    void setBlockSize(size_t samples) { blockSize_ = std::max<size_t>(samples, 1); }
+    
+    // Fused mode only: abandon the sweep once a hard constraint has failed
+    void setStopOnHardFailure(bool stop) { stopOnHardFailure_ = stop; }
+    
+    size_t getSamplesRead() const { return samplesRead_; }
+    
     void validateDataset(ScientificDataset& dataset) {
         std::cout << "Dataset: " << dataset.getExperimentName() << "\n";
         std::cout << "Instrument: " << dataset.getInstrumentType() << "\n";
         std::cout << "Data points: " << dataset.getData().size() << "\n";
         std::cout << "Starting validation pipeline...\n";
         
-        firstValidator_->validate(dataset);
+        dataset.clearIssues();
+        if (mode_ == ValidationMode::FUSED) {
+            validateFused(dataset);
+        } else {
+            firstValidator_->validate(dataset);
+            samplesRead_ = dataset.getData().size();
+        }
         
         if (dataset.isValidated()) {
             std::cout << "\n✅ Dataset approved for analysis!\n";
@@ -510,6 +763,85 @@ std::vector<double> generateExperimentalData(int size, double baseline,
     return data;
 }
 
+// Runs one validation with the report captured instead of printed
+std::string captureReport(DataValidationPipeline& pipeline, ScientificDataset& dataset) {
+    std::ostringstream report;
+    std::streambuf* previous = std::cout.rdbuf(report.rdbuf());
+    pipeline.validateDataset(dataset);
+    std::cout.rdbuf(previous);
+    return report.str();
+}
+
+// Fused single-pass validation versus one sweep per validator
+void fusedValidationExample() {
+    std::cout << "\n\n=== Fused Single-Pass Validation ===\n";
+    
+    std::ostringstream quiet;
+    std::streambuf* previous = std::cout.rdbuf(quiet.rdbuf());
+    DataValidationPipeline chained;
+    DataValidationPipeline fused;
+    std::cout.rdbuf(previous);
+    fused.setMode(ValidationMode::FUSED);
+    
+    // The fused report must match the chained one, including windows and
+    // quarters that straddle block boundaries
+    fused.setBlockSize(64);
+    srand(7);
+    std::vector<ScientificDataset> cases;
+    cases.push_back(ScientificDataset("Clean", "Spectrometer",
+        generateExperimentalData(1000, 100.0, 20.0, 0.5), 1000.0, 70.0, 130.0));
+    cases.push_back(ScientificDataset("Missing", "Thermometer",
+        generateExperimentalData(1000, 50.0, 10.0, 0.5, 0.15), 10.0, 30.0, 70.0, 323.15));
+    cases.push_back(ScientificDataset("Outliers", "Mass Spectrometer",
+        generateExperimentalData(1000, 1.0, 0.5, 0.1, 0.0, 20), 10000.0, 0.0, 2.0));
+    cases.push_back(ScientificDataset("Noisy", "Pressure Sensor",
+        generateExperimentalData(1000, 101325.0, 100.0, 500.0), 100.0, 100000.0, 102000.0, 293.15, 101325.0));
+    auto drift = generateExperimentalData(1000, 100.0, 20.0, 1.0);
+    for (size_t i = 0; i < drift.size(); ++i) drift[i] += i * 0.1;
+    cases.push_back(ScientificDataset("Drift", "Spectrometer", drift, 1.0, 70.0, 200.0));
+    // Outliers bunched in the first block widen the running estimate enough
+    // that its candidate gate alone would drop them
+    auto burst = generateExperimentalData(1000, 100.0, 20.0, 0.5);
+    std::fill(burst.begin(), burst.begin() + 16, 184.0);
+    cases.push_back(ScientificDataset("Early burst", "Spectrometer", burst, 1000.0, 0.0, 300.0));
+    
+    int identical = 0;
+    for (auto& dataset : cases) {
+        identical += captureReport(chained, dataset) == captureReport(fused, dataset);
+    }
+    std::cout << "Test cases with identical chained/fused reports: " << identical
+              << "/" << cases.size() << "\n";
+    
+    // Throughput on a long acquisition that no longer fits in cache
+    fused.setBlockSize(8192);
+    const int samples = 1 << 24;
+    ScientificDataset longRun("Long Acquisition", "Thermometer",
+        generateExperimentalData(samples, 300.0, 5.0, 0.5), 1000.0, 280.0, 320.0, 300.0);
+    
+    auto timeRun = [&](DataValidationPipeline& pipeline) {
+        auto start = std::chrono::high_resolution_clock::now();
+        captureReport(pipeline, longRun);
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+    double chainedMs = timeRun(chained);
+    double fusedMs = timeRun(fused);
+    std::cout << samples << " samples (" << (samples * sizeof(double) >> 20) << " MiB):\n";
+    std::cout << "  Chained (5 sweeps):  " << std::fixed << std::setprecision(1)
+              << chainedMs << " ms\n";
+    std::cout << "  Fused (1 sweep):     " << fusedMs << " ms ("
+              << std::setprecision(2) << chainedMs / fusedMs << "x)\n";
+    
+    // A hard-constraint violation early in the stream ends the sweep
+    longRun.getDataMutable()[samples / 100] = 1.0e6;
+    fused.setStopOnHardFailure(true);
+    double stoppedMs = timeRun(fused);
+    std::cout << "  Early range violation with stop-on-hard-failure: "
+              << std::setprecision(1) << stoppedMs << " ms, read "
+              << std::setprecision(2) << (100.0 * fused.getSamplesRead() / samples)
+              << "% of the samples\n";
+}
+
 int main() {
     DataValidationPipeline pipeline;
     
@@ -555,6 +887,8 @@ int main() {
                               driftData, 1.0, 70.0, 200.0);
     pipeline.validateDataset(dataset5);
     
+    fusedValidationExample();
+    
     std::cout << "\n\nChain of Responsibility pattern enables modular\n";
     std::cout << "data validation for scientific experiments!\n";
     
@@ -10,6 +10,15 @@
 #include <fstream>
 #include <iomanip>
 #include <cmath>
+#include <map>
+#include <sstream>
+#include <deque>
+#include <unordered_map>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <stdexcept>
+#include <cstdio>
 
 // Receiver - Computational simulation engine
 class SimulationEngine {
@@ -25,56 +34,61 @@ private:
     std::vector<double> energyHistory_;
     std::vector<double> temperatureHistory_;
     bool isRunning_;
+    bool verbose_;          // Parameter sweeps switch off per-call logging
     
 public:
     SimulationEngine() 
         : currentTime_(0.0), timeStep_(1e-15), temperature_(300.0),
           pressure_(101325.0), volume_(1e-6), particleCount_(1000),
-          solver_("Velocity-Verlet"), isRunning_(false) {}
+          solver_("Velocity-Verlet"), isRunning_(false), verbose_(true) {}
+    
+    void setVerbose(bool verbose) { verbose_ = verbose; }
     
     // Simulation operations
     void setTimeStep(double dt) {
         double oldDt = timeStep_;
         timeStep_ = dt;
-        std::cout << "Time step changed from " << std::scientific << std::setprecision(2) 
+        if (verbose_) std::cout << "Time step changed from " << std::scientific << std::setprecision(2) 
                   << oldDt << " to " << dt << " seconds\n";
     }
     
     void setTemperature(double temp) {
         double oldTemp = temperature_;
         temperature_ = temp;
-        std::cout << "Temperature changed from " << std::fixed << std::setprecision(2)
+        if (verbose_) std::cout << "Temperature changed from " << std::fixed << std::setprecision(2)
                   << oldTemp << " to " << temp << " K\n";
     }
     
     void setPressure(double pressure) {
         double oldPressure = pressure_;
         pressure_ = pressure;
-        std::cout << "Pressure changed from " << std::scientific << std::setprecision(2)
+        if (verbose_) std::cout << "Pressure changed from " << std::scientific << std::setprecision(2)
                   << oldPressure << " to " << pressure << " Pa\n";
     }
     
     void setParticleCount(int count) {
         int oldCount = particleCount_;
         particleCount_ = count;
-        std::cout << "Particle count changed from " << oldCount 
+        if (verbose_) std::cout << "Particle count changed from " << oldCount 
                   << " to " << count << "\n";
     }
     
     void setSolver(const std::string& solver) {
         std::string oldSolver = solver_;
         solver_ = solver;
-        std::cout << "Solver changed from " << oldSolver 
+        if (verbose_) std::cout << "Solver changed from " << oldSolver 
                   << " to " << solver << "\n";
     }
     
     void runSimulation(double duration) {
-        std::cout << "\n--- Running simulation for " << std::scientific 
-                  << duration << " seconds ---\n";
-        std::cout << "Parameters: T=" << std::fixed << temperature_ 
-                  << "K, P=" << std::scientific << pressure_ 
-                  << "Pa, N=" << particleCount_ << "\n";
-        std::cout << "Using " << solver_ << " integrator\n";
+        if (verbose_) {
+            std::cout << "\n--- Running simulation for " << std::scientific 
+                      << duration << " seconds ---\n";
+            std::cout << "Parameters: T=" << std::fixed << temperature_ 
+                      << "K, P=" << std::scientific << pressure_ 
+                      << "Pa, N=" << particleCount_ << "\n";
+            std::cout << "Using " << solver_ << " integrator\n";
+        }
         
         isRunning_ = true;
         int steps = static_cast<int>(duration / timeStep_);
@@ -90,19 +104,22 @@ public:
             energyHistory_.push_back(totalEnergy);
             temperatureHistory_.push_back(temperature_ + 0.1 * std::sin(i));
             
-            if (i % 3 == 0) {
+            if (verbose_ && i % 3 == 0) {
                 std::cout << "  Step " << i << ": E=" << std::scientific 
                           << totalEnergy << " J, T=" << std::fixed 
                           << temperatureHistory_.back() << " K\n";
             }
         }
         
-        std::cout << "Simulation completed. Total time: " 
-                  << std::scientific << currentTime_ << " s\n";
+        if (verbose_) {
+            std::cout << "Simulation completed. Total time: " 
+                      << std::scientific << currentTime_ << " s\n";
+        }
         isRunning_ = false;
     }
     
     void saveCheckpoint(const std::string& filename) {
+        if (!verbose_) return;
         std::cout << "Saving checkpoint to " << filename << "\n";
         std::cout << "  Current time: " << std::scientific << currentTime_ << " s\n";
         std::cout << "  Energy history points: " << energyHistory_.size() << "\n";
@@ -150,6 +167,237 @@ public:
     }
 };
 
+// Operations recorded in the command journal. Parameter setters come first so
+// isParameterOp() is a single comparison.
+enum class JournalOp : uint8_t {
+    SET_TIME_STEP,
+    SET_TEMPERATURE,
+    SET_PRESSURE,
+    SET_PARTICLE_COUNT,
+    CHANGE_SOLVER,
+    RUN_SIMULATION,
+    SAVE_CHECKPOINT,
+    BEGIN_BATCH,
+    END_BATCH,
+    OPAQUE              // Not replayable; kept so the history stays complete
+};
+
+inline bool isParameterOp(JournalOp op) { return op <= JournalOp::CHANGE_SOLVER; }
+
+// One journal entry: 16 bytes, no heap ownership
+struct JournalRecord {
+    enum : uint8_t { UNDO = 1, REDO = 2 };
+    
+    JournalOp op;
+    uint8_t flags;
+    uint16_t reserved;
+    uint32_t text;      // Interned string: solver, file or workflow name
+    double value;
+    
+    JournalRecord(JournalOp o = JournalOp::OPAQUE, double v = 0.0, uint32_t t = 0, uint8_t f = 0)
+        : op(o), flags(f), reserved(0), text(t), value(v) {}
+};
+static_assert(sizeof(JournalRecord) == 16, "journal records must stay compact");
+
+// Bump allocator over fixed-size blocks. Memory is only released with the
+// arena, and growing it never moves what was already handed out.
+class JournalArena {
+private:
+    size_t blockBytes_;
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    size_t blockSize_ = 0;
+    size_t used_ = 0;
+    size_t reserved_ = 0;
+    
+public:
+    explicit JournalArena(size_t blockBytes = 64 * 1024) : blockBytes_(blockBytes) {}
+    
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        size_t offset = (used_ + alignment - 1) & ~(alignment - 1);
+        if (blocks_.empty() || offset + bytes > blockSize_) {
+            blockSize_ = std::max(bytes, blockBytes_);
+            blocks_.emplace_back(new char[blockSize_]);
+            reserved_ += blockSize_;
+            offset = 0;
+        }
+        used_ = offset + bytes;
+        return blocks_.back().get() + offset;
+    }
+    
+    size_t bytesReserved() const { return reserved_; }
+};
+
+// Append-only journal of everything that changed engine state. Records live
+// in arena chunks and strings are interned once, so a long parameter sweep
+// costs 16 bytes per record and never reallocates. Replaying the journal
+// against a fresh SimulationEngine reproduces the session: a restart
+// without a checkpoint.
+class CommandJournal {
+private:
+    static constexpr size_t recordsPerChunk_ = 4096;     // One 64 KiB arena block
+    JournalArena arena_;
+    JournalArena textArena_{4096};
+    std::vector<JournalRecord*> chunks_;
+    size_t size_ = 0;
+    std::vector<const char*> texts_;
+    std::unordered_map<std::string, uint32_t> textIds_;
+    
+public:
+    CommandJournal() { intern(""); }
+    
+    uint32_t intern(const std::string& text) {
+        auto it = textIds_.find(text);
+        if (it != textIds_.end()) return it->second;
+        char* copy = static_cast<char*>(textArena_.allocate(text.size() + 1, 1));
+        std::memcpy(copy, text.c_str(), text.size() + 1);
+        uint32_t id = static_cast<uint32_t>(texts_.size());
+        texts_.push_back(copy);
+        textIds_.emplace(text, id);
+        return id;
+    }
+    
+    const char* text(uint32_t id) const { return texts_.at(id); }
+    
+    JournalRecord& append(const JournalRecord& record) {
+        if (size_ == chunks_.size() * recordsPerChunk_) {
+            chunks_.push_back(static_cast<JournalRecord*>(
+                arena_.allocate(recordsPerChunk_ * sizeof(JournalRecord), alignof(JournalRecord))));
+        }
+        JournalRecord* slot = chunks_.back() + size_ % recordsPerChunk_;
+        *slot = record;
+        ++size_;
+        return *slot;
+    }
+    
+    JournalRecord& append(JournalOp op, double value = 0.0, uint32_t text = 0, uint8_t flags = 0) {
+        return append(JournalRecord(op, value, text, flags));
+    }
+    
+    const JournalRecord& operator[](size_t i) const {
+        return chunks_[i / recordsPerChunk_][i % recordsPerChunk_];
+    }
+    JournalRecord& back() { return chunks_[(size_ - 1) / recordsPerChunk_][(size_ - 1) % recordsPerChunk_]; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t bytesReserved() const { return arena_.bytesReserved() + textArena_.bytesReserved(); }
+    
+    std::string describe(const JournalRecord& record) const {
+        std::stringstream ss;
+        switch (record.op) {
+            case JournalOp::SET_TIME_STEP:
+                ss << "SetTimeStep (dt=" << std::scientific << std::setprecision(2) << record.value << "s)";
+                break;
+            case JournalOp::SET_TEMPERATURE:
+                ss << "SetTemperature (T=" << std::fixed << std::setprecision(2) << record.value << "K)";
+                break;
+            case JournalOp::SET_PRESSURE:
+                ss << "SetPressure (P=" << std::scientific << std::setprecision(2) << record.value << "Pa)";
+                break;
+            case JournalOp::SET_PARTICLE_COUNT:
+                ss << "SetParticleCount (N=" << static_cast<int>(record.value) << ")";
+                break;
+            case JournalOp::CHANGE_SOLVER:
+                ss << "ChangeSolver (solver=" << text(record.text) << ")";
+                break;
+            case JournalOp::RUN_SIMULATION:
+                ss << "RunSimulation (duration=" << std::scientific << std::setprecision(2) << record.value << "s)";
+                break;
+            case JournalOp::SAVE_CHECKPOINT:
+                ss << "SaveCheckpoint (file=" << text(record.text) << ")";
+                break;
+            case JournalOp::BEGIN_BATCH:
+                ss << "Workflow (" << text(record.text) << ")";
+                break;
+            case JournalOp::END_BATCH:
+                ss << "EndWorkflow (" << text(record.text) << ")";
+                break;
+            case JournalOp::OPAQUE:
+                ss << text(record.text);
+                break;
+        }
+        if (record.flags & JournalRecord::UNDO) ss << " [undo]";
+        if (record.flags & JournalRecord::REDO) ss << " [redo]";
+        return ss.str();
+    }
+    
+    // Performs one record on the engine; markers and opaque records do nothing
+    void apply(const JournalRecord& record, SimulationEngine& engine) const {
+        switch (record.op) {
+            case JournalOp::SET_TIME_STEP: engine.setTimeStep(record.value); break;
+            case JournalOp::SET_TEMPERATURE: engine.setTemperature(record.value); break;
+            case JournalOp::SET_PRESSURE: engine.setPressure(record.value); break;
+            case JournalOp::SET_PARTICLE_COUNT: engine.setParticleCount(static_cast<int>(record.value)); break;
+            case JournalOp::CHANGE_SOLVER: engine.setSolver(text(record.text)); break;
+            case JournalOp::RUN_SIMULATION: engine.runSimulation(record.value); break;
+            case JournalOp::SAVE_CHECKPOINT: engine.saveCheckpoint(text(record.text)); break;
+            case JournalOp::BEGIN_BATCH:
+            case JournalOp::END_BATCH:
+            case JournalOp::OPAQUE:
+                break;
+        }
+    }
+    
+    size_t replay(SimulationEngine& engine) const {
+        size_t applied = 0;
+        for (size_t i = 0; i < size_; ++i) {
+            const JournalRecord& record = (*this)[i];
+            apply(record, engine);
+            applied += record.op < JournalOp::BEGIN_BATCH;
+        }
+        return applied;
+    }
+    
+    // Binary layout: "SIMJRNL1", text count, (length, bytes) per text,
+    // record count, raw records
+    void writeTo(const std::string& path) const {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("Cannot write journal " + path);
+        out.write("SIMJRNL1", 8);
+        uint64_t textCount = texts_.size();
+        out.write(reinterpret_cast<const char*>(&textCount), sizeof(textCount));
+        for (const char* text : texts_) {
+            uint32_t length = static_cast<uint32_t>(std::strlen(text));
+            out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            out.write(text, length);
+        }
+        uint64_t recordCount = size_;
+        out.write(reinterpret_cast<const char*>(&recordCount), sizeof(recordCount));
+        for (size_t c = 0; c < chunks_.size(); ++c) {
+            size_t count = std::min(recordsPerChunk_, size_ - c * recordsPerChunk_);
+            out.write(reinterpret_cast<const char*>(chunks_[c]), count * sizeof(JournalRecord));
+        }
+        if (!out) throw std::runtime_error("Failed writing journal " + path);
+    }
+    
+    static CommandJournal readFrom(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        char magic[8];
+        if (!in.read(magic, 8) || std::memcmp(magic, "SIMJRNL1", 8) != 0) {
+            throw std::runtime_error("Not a simulation journal: " + path);
+        }
+        CommandJournal journal;
+        uint64_t textCount = 0;
+        in.read(reinterpret_cast<char*>(&textCount), sizeof(textCount));
+        for (uint64_t i = 0; i < textCount && in; ++i) {
+            uint32_t length = 0;
+            in.read(reinterpret_cast<char*>(&length), sizeof(length));
+            std::string text(length, '\0');
+            in.read(&text[0], length);
+            if (journal.intern(text) != i) throw std::runtime_error("Corrupt journal text table: " + path);
+        }
+        uint64_t recordCount = 0;
+        in.read(reinterpret_cast<char*>(&recordCount), sizeof(recordCount));
+        JournalRecord record;
+        for (uint64_t i = 0; i < recordCount; ++i) {
+            if (!in.read(reinterpret_cast<char*>(&record), sizeof(record)) || record.text >= textCount) {
+                throw std::runtime_error("Truncated journal: " + path);
+            }
+            journal.append(record);
+        }
+        return journal;
+    }
+};
+
 // Command interface
 class SimulationCommand {
 public:
@@ -159,6 +407,15 @@ public:
     virtual std::string getName() const = 0;
     virtual std::string getParameters() const = 0;
     
+    // Parameter setters describe themselves as a value so the manager can
+    // journal, coalesce and undo them without keeping the command object
+    virtual bool toParameterChange(CommandJournal&, JournalRecord&) const { return false; }
+    
+    // Records needed to replay this command's effect
+    virtual void appendTo(CommandJournal& journal) const {
+        journal.append(JournalOp::OPAQUE, 0.0, journal.intern(getName() + " (" + getParameters() + ")"));
+    }
+    
     // For logging and reproducibility
     std::chrono::system_clock::time_point getTimestamp() const {
         return timestamp_;
@@ -194,6 +451,11 @@ public:
         engine_.setTimeStep(oldTimeStep_);
     }
     
+    bool toParameterChange(CommandJournal&, JournalRecord& change) const override {
+        change = JournalRecord(JournalOp::SET_TIME_STEP, newTimeStep_);
+        return true;
+    }
+    
     std::string getName() const override {
         return "SetTimeStep";
     }
@@ -226,6 +488,11 @@ public:
         engine_.setTemperature(oldTemperature_);
     }
     
+    bool toParameterChange(CommandJournal&, JournalRecord& change) const override {
+        change = JournalRecord(JournalOp::SET_TEMPERATURE, newTemperature_);
+        return true;
+    }
+    
     std::string getName() const override {
         return "SetTemperature";
     }
@@ -258,6 +525,11 @@ public:
         engine_.setPressure(oldPressure_);
     }
     
+    bool toParameterChange(CommandJournal&, JournalRecord& change) const override {
+        change = JournalRecord(JournalOp::SET_PRESSURE, newPressure_);
+        return true;
+    }
+    
     std::string getName() const override {
         return "SetPressure";
     }
@@ -295,6 +567,10 @@ public:
                   << previousTime_ << " s\n";
     }
     
+    void appendTo(CommandJournal& journal) const override {
+        journal.append(JournalOp::RUN_SIMULATION, duration_);
+    }
+    
     std::string getName() const override {
         return "RunSimulation";
     }
@@ -328,6 +604,11 @@ public:
         engine_.setSolver(oldSolver_);
     }
     
+    bool toParameterChange(CommandJournal& journal, JournalRecord& change) const override {
+        change = JournalRecord(JournalOp::CHANGE_SOLVER, 0.0, journal.intern(newSolver_));
+        return true;
+    }
+    
     std::string getName() const override {
         return "ChangeSolver";
     }
@@ -355,6 +636,10 @@ public:
         std::cout << "Cannot undo checkpoint save (file: " << filename_ << ")\n";
     }
     
+    void appendTo(CommandJournal& journal) const override {
+        journal.append(JournalOp::SAVE_CHECKPOINT, 0.0, journal.intern(filename_));
+    }
+    
     std::string getName() const override {
         return "SaveCheckpoint";
     }
@@ -405,6 +690,20 @@ public:
         std::cout << "=== Workflow Undone ===\n\n";
     }
     
+    void appendTo(CommandJournal& journal) const override {
+        uint32_t name = journal.intern(workflowName_);
+        journal.append(JournalOp::BEGIN_BATCH, 0.0, name);
+        for (const auto& command : commands_) {
+            JournalRecord change;
+            if (command->toParameterChange(journal, change)) {
+                journal.append(change);
+            } else {
+                command->appendTo(journal);
+            }
+        }
+        journal.append(JournalOp::END_BATCH, 0.0, name);
+    }
+    
     std::string getName() const override {
         return "Workflow";
     }
@@ -414,64 +713,136 @@ public:
     }
 };
 
-// Command manager - handles execution, history, and reproducibility
+// Command manager - handles execution, history, and reproducibility.
+// History lives in a CommandJournal; undo keeps a bounded log in which
+// parameter changes are plain values and only other actions hold on to
+// their command object.
 class SimulationCommandManager {
 private:
-    std::stack<std::shared_ptr<SimulationCommand>> undoStack_;
-    std::stack<std::shared_ptr<SimulationCommand>> redoStack_;
-    std::vector<std::shared_ptr<SimulationCommand>> commandHistory_;
+    struct UndoEntry {
+        JournalRecord change;   // Parameter op with the value it set
+        double oldValue;
+        uint32_t oldText;
+        std::shared_ptr<SimulationCommand> command;  // Set for non-parameter actions
+    };
+    
+    struct ParameterState {
+        double timeStep, temperature, pressure;
+        int particleCount;
+        std::string solver;
+    };
+    
+    SimulationEngine& engine_;
+    CommandJournal journal_;
+    std::deque<UndoEntry> undoLog_;
+    std::vector<UndoEntry> redoLog_;
+    size_t maxUndoDepth_;
+    bool coalescing_;           // Journal tail and undo top are the latest setter call
+    size_t commandsExecuted_;
+    size_t coalescedCalls_;
+    bool verbose_;
     bool recordingScript_;
     std::string scriptFilename_;
     
 public:
-    SimulationCommandManager() : recordingScript_(false) {}
+    explicit SimulationCommandManager(SimulationEngine& engine, size_t maxUndoDepth = 1024)
+        : engine_(engine), maxUndoDepth_(maxUndoDepth), coalescing_(false),
+          commandsExecuted_(0), coalescedCalls_(0), verbose_(true),
+          recordingScript_(false) {}
+    
+    void setVerbose(bool verbose) { verbose_ = verbose; }
+    void setMaxUndoDepth(size_t depth) {
+        maxUndoDepth_ = depth;
+        while (undoLog_.size() > maxUndoDepth_) undoLog_.pop_front();
+    }
     
     void executeCommand(std::shared_ptr<SimulationCommand> command) {
-        command->execute();
-        undoStack_.push(command);
-        commandHistory_.push_back(command);
-        
-        // Clear redo stack on new command
-        while (!redoStack_.empty()) {
-            redoStack_.pop();
+        JournalRecord change;
+        if (command->toParameterChange(journal_, change)) {
+            applyParameterChange(change);
+        } else {
+            command->execute();
+            command->appendTo(journal_);
+            coalescing_ = false;
+            redoLog_.clear();
+            pushUndo(UndoEntry{JournalRecord(), 0.0, 0, command});
+            ++commandsExecuted_;
         }
         
-        std::cout << "\n[EXECUTED] " << command->getName() 
-                  << " (" << command->getParameters() << ")\n";
+        if (verbose_) {
+            std::cout << "\n[EXECUTED] " << command->getName() 
+                      << " (" << command->getParameters() << ")\n";
+        }
         
         if (recordingScript_) {
             logCommandToScript(command);
         }
     }
     
+    // Allocation-free setters for parameter sweeps. Consecutive calls to the
+    // same setter fold into one journal record and one undo step, which
+    // reverts to the value from before the whole burst.
+    void setTimeStep(double dt) { applyParameterChange(JournalRecord(JournalOp::SET_TIME_STEP, dt)); }
+    void setTemperature(double temperature) { applyParameterChange(JournalRecord(JournalOp::SET_TEMPERATURE, temperature)); }
+    void setPressure(double pressure) { applyParameterChange(JournalRecord(JournalOp::SET_PRESSURE, pressure)); }
+    void setParticleCount(int count) { applyParameterChange(JournalRecord(JournalOp::SET_PARTICLE_COUNT, count)); }
+    
     void undo() {
-        if (undoStack_.empty()) {
+        if (undoLog_.empty()) {
             std::cout << "\n[INFO] Nothing to undo\n";
             return;
         }
         
-        auto command = undoStack_.top();
-        undoStack_.pop();
-        std::cout << "\n[UNDO] " << command->getName() 
-                  << " (" << command->getParameters() << ")\n";
-        command->undo();
-        redoStack_.push(command);
+        UndoEntry entry = undoLog_.back();
+        undoLog_.pop_back();
+        coalescing_ = false;
+        if (entry.command) {
+            if (verbose_) {
+                std::cout << "\n[UNDO] " << entry.command->getName() 
+                          << " (" << entry.command->getParameters() << ")\n";
+            }
+            ParameterState before = captureParameters();
+            entry.command->undo();
+            journalParameterChanges(before, JournalRecord::UNDO);
+        } else {
+            if (verbose_) std::cout << "\n[UNDO] " << journal_.describe(entry.change) << "\n";
+            JournalRecord revert(entry.change.op, entry.oldValue, entry.oldText, JournalRecord::UNDO);
+            journal_.apply(revert, engine_);
+            journal_.append(revert);
+        }
+        redoLog_.push_back(entry);
     }
     
     void redo() {
-        if (redoStack_.empty()) {
+        if (redoLog_.empty()) {
             std::cout << "\n[INFO] Nothing to redo\n";
             return;
         }
         
-        auto command = redoStack_.top();
-        redoStack_.pop();
-        std::cout << "\n[REDO] " << command->getName() 
-                  << " (" << command->getParameters() << ")\n";
-        command->execute();
-        undoStack_.push(command);
+        UndoEntry entry = redoLog_.back();
+        redoLog_.pop_back();
+        coalescing_ = false;
+        if (entry.command) {
+            if (verbose_) {
+                std::cout << "\n[REDO] " << entry.command->getName() 
+                          << " (" << entry.command->getParameters() << ")\n";
+            }
+            entry.command->execute();
+            entry.command->appendTo(journal_);
+        } else {
+            if (verbose_) std::cout << "\n[REDO] " << journal_.describe(entry.change) << "\n";
+            JournalRecord again = entry.change;
+            again.flags = JournalRecord::REDO;
+            journal_.apply(again, engine_);
+            journal_.append(again);
+        }
+        pushUndo(entry);
     }
     
+    const CommandJournal& getJournal() const { return journal_; }
+    size_t getUndoDepth() const { return undoLog_.size(); }
+    size_t getCoalescedCalls() const { return coalescedCalls_; }
+    
     void startScriptRecording(const std::string& filename) {
         scriptFilename_ = filename;
         recordingScript_ = true;
@@ -489,27 +860,40 @@ public:
     
     void saveCommandHistory(const std::string& filename) {
         std::cout << "\n[SAVE] Saving command history to " << filename << "\n";
-        std::cout << "Total commands: " << commandHistory_.size() << "\n";
+        std::cout << "Journal records: " << journal_.size() << "\n";
         
-        // Simulate saving
-        for (size_t i = 0; i < commandHistory_.size(); ++i) {
+        int depth = 0;
+        for (size_t i = 0; i < journal_.size(); ++i) {
+            const JournalRecord& record = journal_[i];
+            if (record.op == JournalOp::END_BATCH) {
+                --depth;
+                continue;
+            }
             std::cout << "  " << std::setw(3) << i+1 << ": " 
-                      << commandHistory_[i]->getName() 
-                      << " (" << commandHistory_[i]->getParameters() << ")\n";
+                      << std::string(2 * depth, ' ') << journal_.describe(record) << "\n";
+            if (record.op == JournalOp::BEGIN_BATCH) ++depth;
         }
         std::cout << "History saved successfully\n";
     }
     
+    void saveJournal(const std::string& filename) const {
+        journal_.writeTo(filename);
+    }
+    
     void showStatistics() {
         std::cout << "\n=== Command Statistics ===\n";
-        std::cout << "Total commands executed: " << commandHistory_.size() << "\n";
-        std::cout << "Undo stack size: " << undoStack_.size() << "\n";
-        std::cout << "Redo stack size: " << redoStack_.size() << "\n";
+        std::cout << "Total commands executed: " << commandsExecuted_ << "\n";
+        std::cout << "Undo log depth: " << undoLog_.size() << " (max " << maxUndoDepth_ << ")\n";
+        std::cout << "Redo log depth: " << redoLog_.size() << "\n";
+        std::cout << "Journal: " << journal_.size() << " records, "
+                  << journal_.bytesReserved() / 1024 << " KiB reserved, "
+                  << coalescedCalls_ << " coalesced setter calls\n";
         
-        // Count command types
+        // Count journaled operations
         std::map<std::string, int> commandCounts;
-        for (const auto& cmd : commandHistory_) {
-            commandCounts[cmd->getName()]++;
+        for (size_t i = 0; i < journal_.size(); ++i) {
+            std::string name = journal_.describe(journal_[i]);
+            commandCounts[name.substr(0, name.find(' '))]++;
         }
         
         std::cout << "\nCommand frequency:\n";
@@ -520,6 +904,61 @@ public:
     }
     
 private:
+    void applyParameterChange(const JournalRecord& change) {
+        ++commandsExecuted_;
+        redoLog_.clear();
+        if (coalescing_ && journal_.back().op == change.op) {
+            journal_.back() = change;
+            if (!undoLog_.empty()) undoLog_.back().change = change;
+            ++coalescedCalls_;
+        } else {
+            UndoEntry entry{change, 0.0, 0, nullptr};
+            readParameter(change.op, entry.oldValue, entry.oldText);
+            journal_.append(change);
+            pushUndo(entry);
+            coalescing_ = true;
+        }
+        journal_.apply(change, engine_);
+    }
+    
+    void readParameter(JournalOp op, double& value, uint32_t& text) {
+        switch (op) {
+            case JournalOp::SET_TIME_STEP: value = engine_.getTimeStep(); break;
+            case JournalOp::SET_TEMPERATURE: value = engine_.getTemperature(); break;
+            case JournalOp::SET_PRESSURE: value = engine_.getPressure(); break;
+            case JournalOp::SET_PARTICLE_COUNT: value = engine_.getParticleCount(); break;
+            case JournalOp::CHANGE_SOLVER: text = journal_.intern(engine_.getSolver()); break;
+            default: break;
+        }
+    }
+    
+    void pushUndo(const UndoEntry& entry) {
+        if (maxUndoDepth_ == 0) return;
+        if (undoLog_.size() == maxUndoDepth_) undoLog_.pop_front();
+        undoLog_.push_back(entry);
+    }
+    
+    ParameterState captureParameters() const {
+        return ParameterState{engine_.getTimeStep(), engine_.getTemperature(),
+                              engine_.getPressure(), engine_.getParticleCount(),
+                              engine_.getSolver()};
+    }
+    
+    // Journals whatever an opaque undo changed, so replay follows it
+    void journalParameterChanges(const ParameterState& before, uint8_t flags) {
+        ParameterState after = captureParameters();
+        if (after.timeStep != before.timeStep)
+            journal_.append(JournalOp::SET_TIME_STEP, after.timeStep, 0, flags);
+        if (after.temperature != before.temperature)
+            journal_.append(JournalOp::SET_TEMPERATURE, after.temperature, 0, flags);
+        if (after.pressure != before.pressure)
+            journal_.append(JournalOp::SET_PRESSURE, after.pressure, 0, flags);
+        if (after.particleCount != before.particleCount)
+            journal_.append(JournalOp::SET_PARTICLE_COUNT, after.particleCount, 0, flags);
+        if (after.solver != before.solver)
+            journal_.append(JournalOp::CHANGE_SOLVER, 0.0, journal_.intern(after.solver), flags);
+    }
+    
     void logCommandToScript(std::shared_ptr<SimulationCommand> command) {
         // In real implementation, would write to file
         std::cout << "[SCRIPT] Logged: " << command->getName() 
@@ -527,9 +966,99 @@ private:
     }
 };
 
+// Parameter sweep through the journaled manager versus one heap command per call
+void journalSweepExample() {
+    std::cout << "\n=== Journaled Parameter Sweep ===\n";
+    const int runs = 1000;
+    const int callsPerBurst = 1000;     // Controller adjustments between runs
+    auto temperatureAt = [](int run, int k) { return 300.0 + 50.0 * std::sin(run * 0.01 + k * 1e-3); };
+    auto timeStepAt = [](int k) { return 1e-15 * (0.5 + 0.5 * k / callsPerBurst); };
+    
+    // How the manager used to keep history: every call is a heap command
+    // referenced from the undo stack and the history vector
+    SimulationEngine legacyEngine;
+    legacyEngine.setVerbose(false);
+    std::stack<std::shared_ptr<SimulationCommand>> undoStack;
+    std::vector<std::shared_ptr<SimulationCommand>> history;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int run = 0; run < runs; ++run) {
+        for (int k = 0; k < callsPerBurst; ++k) {
+            auto command = std::make_shared<SetTemperatureCommand>(legacyEngine, temperatureAt(run, k));
+            command->execute();
+            undoStack.push(command);
+            history.push_back(command);
+        }
+        for (int k = 0; k < callsPerBurst; ++k) {
+            auto command = std::make_shared<SetTimeStepCommand>(legacyEngine, timeStepAt(k));
+            command->execute();
+            undoStack.push(command);
+            history.push_back(command);
+        }
+        auto command = std::make_shared<RunSimulationCommand>(legacyEngine, 5e-15);
+        command->execute();
+        undoStack.push(command);
+        history.push_back(command);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double legacyMs = std::chrono::duration<double, std::milli>(end - start).count();
+    // Object plus control block, and a shared_ptr in both containers
+    size_t legacyBytes = history.size() *
+        (sizeof(SetTemperatureCommand) + 16 + 2 * sizeof(std::shared_ptr<SimulationCommand>));
+    
+    SimulationEngine engine;
+    engine.setVerbose(false);
+    SimulationCommandManager manager(engine, 64);
+    manager.setVerbose(false);
+    double timeStepBeforeLastBurst = 0.0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int run = 0; run < runs; ++run) {
+        for (int k = 0; k < callsPerBurst; ++k) manager.setTemperature(temperatureAt(run, k));
+        timeStepBeforeLastBurst = engine.getTimeStep();
+        for (int k = 0; k < callsPerBurst; ++k) manager.setTimeStep(timeStepAt(k));
+        manager.executeCommand(std::make_shared<RunSimulationCommand>(engine, 5e-15));
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double journalMs = std::chrono::duration<double, std::milli>(end - start).count();
+    const CommandJournal& journal = manager.getJournal();
+    
+    std::cout << history.size() << " commands (" << runs << " runs, "
+              << 2 * callsPerBurst << " setter calls before each)\n";
+    std::cout << "  Heap command per call: " << std::fixed << std::setprecision(1)
+              << legacyMs << " ms, ~" << legacyBytes / (1024 * 1024) << " MiB of history\n";
+    std::cout << "  Journaled + coalesced: " << journalMs << " ms, "
+              << journal.size() << " records in " << journal.bytesReserved() / 1024 << " KiB ("
+              << manager.getCoalescedCalls() << " calls coalesced), undo depth "
+              << manager.getUndoDepth() << "\n";
+    
+    // Checkpoint-free restart: replay the journal from disk into a fresh engine
+    std::string path = "parameter_sweep.simjournal";
+    manager.saveJournal(path);
+    CommandJournal restored = CommandJournal::readFrom(path);
+    std::remove(path.c_str());
+    SimulationEngine restarted;
+    restarted.setVerbose(false);
+    size_t applied = restored.replay(restarted);
+    bool matches = restarted.getTemperature() == engine.getTemperature() &&
+                   restarted.getTimeStep() == engine.getTimeStep() &&
+                   restarted.getCurrentTime() == engine.getCurrentTime() &&
+                   restarted.getHistorySize() == engine.getHistorySize() &&
+                   legacyEngine.getCurrentTime() == engine.getCurrentTime();
+    std::cout << "  Replayed " << applied << " records from disk into a fresh engine: "
+              << (matches ? "state matches" : "STATE MISMATCH") << " (t="
+              << std::scientific << std::setprecision(3) << restarted.getCurrentTime()
+              << " s, " << restarted.getHistorySize() << " history points)\n";
+    
+    // One undo step reverts a whole coalesced burst
+    manager.setVerbose(true);
+    manager.undo();     // Last run
+    manager.undo();     // The 1000 time-step adjustments before it
+    std::cout << "  Time step restored to the value before the burst: "
+              << (engine.getTimeStep() == timeStepBeforeLastBurst ? "yes" : "NO") << "\n";
+}
+
 int main() {
     SimulationEngine engine;
-    SimulationCommandManager manager;
+    SimulationCommandManager manager(engine);
     
     std::cout << "=== Scientific Simulation Command System ===\n\n";
     
@@ -617,6 +1146,8 @@ int main() {
     std::cout << "\n=== Undoing Entire Workflow ===\n";
     manager.undo();
     
+    journalSweepExample();
+    
     std::cout << "\nCommand pattern enables reproducible scientific simulations\n";
     std::cout << "with full undo/redo capability and workflow automation!\n";
     
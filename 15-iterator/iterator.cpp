@@ -8,6 +8,99 @@
 #include <cmath>
 #include <iomanip>
 #include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+// Non-owning view over contiguous elements (same shape as the Span in
+// pattern 16)
+template <typename T>
+class Span {
+private:
+    T* ptr_ = nullptr;
+    size_t size_ = 0;
+    
+public:
+    Span() = default;
+    Span(T* data, size_t size) : ptr_(data), size_(size) {}
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    Span(const Span<U>& other) : ptr_(other.data()), size_(other.size()) {}
+    
+    T* data() const { return ptr_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    T* begin() const { return ptr_; }
+    T* end() const { return ptr_ + size_; }
+    T& operator[](size_t i) const { return ptr_[i]; }
+    T& front() const { return ptr_[0]; }
+    T& back() const { return ptr_[size_ - 1]; }
+};
+
+// STL random-access iterator over positions 0..n of a view generator.
+// Dereferencing asks the generator for a small view object (a span, a slab
+// handle) built on the fly, so traversal never copies field data. Like
+// vector<bool>, reference is the view itself rather than a C++ reference.
+template <typename Generator>
+class ViewIterator {
+private:
+    Generator generator_;
+    size_t position_ = 0;
+    
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename Generator::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type;
+    using pointer = void;
+    
+    ViewIterator() = default;
+    ViewIterator(const Generator& generator, size_t position)
+        : generator_(generator), position_(position) {}
+    
+    value_type operator*() const { return generator_(position_); }
+    value_type operator[](difference_type n) const { return generator_(position_ + n); }
+    
+    ViewIterator& operator++() { ++position_; return *this; }
+    ViewIterator operator++(int) { ViewIterator old = *this; ++position_; return old; }
+    ViewIterator& operator--() { --position_; return *this; }
+    ViewIterator operator--(int) { ViewIterator old = *this; --position_; return old; }
+    ViewIterator& operator+=(difference_type n) { position_ += n; return *this; }
+    ViewIterator& operator-=(difference_type n) { position_ -= n; return *this; }
+    ViewIterator operator+(difference_type n) const { return ViewIterator(generator_, position_ + n); }
+    ViewIterator operator-(difference_type n) const { return ViewIterator(generator_, position_ - n); }
+    friend ViewIterator operator+(difference_type n, const ViewIterator& it) { return it + n; }
+    difference_type operator-(const ViewIterator& other) const {
+        return static_cast<difference_type>(position_) - static_cast<difference_type>(other.position_);
+    }
+    
+    bool operator==(const ViewIterator& other) const { return position_ == other.position_; }
+    bool operator!=(const ViewIterator& other) const { return position_ != other.position_; }
+    bool operator<(const ViewIterator& other) const { return position_ < other.position_; }
+    bool operator>(const ViewIterator& other) const { return position_ > other.position_; }
+    bool operator<=(const ViewIterator& other) const { return position_ <= other.position_; }
+    bool operator>=(const ViewIterator& other) const { return position_ >= other.position_; }
+};
+
+template <typename Generator>
+class ViewRange {
+private:
+    Generator generator_;
+    size_t size_;
+    
+public:
+    using iterator = ViewIterator<Generator>;
+    using value_type = typename Generator::value_type;
+    
+    ViewRange(const Generator& generator, size_t size) : generator_(generator), size_(size) {}
+    
+    iterator begin() const { return iterator(generator_, 0); }
+    iterator end() const { return iterator(generator_, size_); }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    value_type operator[](size_t n) const { return generator_(n); }
+};
 
 // Forward declarations
 template<typename T> class DataIterator;
@@ -137,10 +230,9 @@ public:
                 throw std::out_of_range("No more windows");
             }
             
-            std::vector<TimeSeriesPoint> window;
-            for (size_t i = 0; i < windowSize_; ++i) {
-                window.push_back(data_[current_ + i]);
-            }
+            // Copies each window; windows() yields spans instead
+            std::vector<TimeSeriesPoint> window(data_.begin() + current_,
+                                                data_.begin() + current_ + windowSize_);
             current_ += stride_;
             return window;
         }
@@ -213,6 +305,33 @@ public:
         return std::make_unique<DecimatedIterator>(data_, factor);
     }
     
+    // Sliding windows as spans into the series: nothing is copied or
+    // allocated per window, and the range is random access so windows can
+    // be split across workers or binary-searched by start time
+    struct WindowGenerator {
+        using value_type = Span<const TimeSeriesPoint>;
+        const TimeSeriesPoint* data = nullptr;
+        size_t windowSize = 0;
+        size_t stride = 1;
+        
+        value_type operator()(size_t n) const {
+            return value_type(data + n * stride, windowSize);
+        }
+    };
+    using WindowRange = ViewRange<WindowGenerator>;
+    
+    WindowRange windows(size_t windowSize, size_t stride) const {
+        size_t count = 0;
+        if (windowSize > 0 && stride > 0 && data_.size() >= windowSize) {
+            count = (data_.size() - windowSize) / stride + 1;
+        }
+        return WindowRange(WindowGenerator{data_.data(), windowSize, stride}, count);
+    }
+    
+    Span<const TimeSeriesPoint> points() const {
+        return Span<const TimeSeriesPoint>(data_.data(), data_.size());
+    }
+    
     size_t size() const override { return data_.size(); }
     std::string getDatasetName() const override { return name_; }
     std::string getUnits() const { return units_; }
@@ -231,36 +350,48 @@ struct GridPoint {
 };
 
 // 3D Grid Dataset for CFD/FEM simulations
+//
+// Field values live in one contiguous buffer in row-major order (k fastest,
+// then j, then i), so a k-line is a contiguous span and an i-slab is ny*nz
+// contiguous values. The virtual DataIterator interface stays for generic
+// analysis code; stencil kernels use the view ranges (cells, lines, slabs,
+// tiles), which hand out spans into the buffer and never copy or allocate.
 class GridDataset : public ScientificDataset<GridPoint> {
 private:
-    std::vector<std::vector<std::vector<double>>> grid_;
+    std::vector<double> data_;
     size_t nx_, ny_, nz_;
     double dx_, dy_, dz_;
     std::string name_;
     std::string fieldName_;
     
+    size_t offset(size_t i, size_t j, size_t k) const {
+        return (i * ny_ + j) * nz_ + k;
+    }
+
 public:
     GridDataset(const std::string& name, const std::string& field,
                 size_t nx, size_t ny, size_t nz,
                 double dx, double dy, double dz)
-        : name_(name), fieldName_(field), 
+        : data_(nx * ny * nz, 0.0),
           nx_(nx), ny_(ny), nz_(nz),
-          dx_(dx), dy_(dy), dz_(dz) {
-        // Initialize grid
-        grid_.resize(nx_);
-        for (size_t i = 0; i < nx_; ++i) {
-            grid_[i].resize(ny_);
-            for (size_t j = 0; j < ny_; ++j) {
-                grid_[i][j].resize(nz_, 0.0);
-            }
+          dx_(dx), dy_(dy), dz_(dz),
+          name_(name), fieldName_(field) {}
+
+    void setGridValue(size_t i, size_t j, size_t k, double value) {
+        if (i < nx_ && j < ny_ && k < nz_) {
+            data_[offset(i, j, k)] = value;
         }
     }
     
-    void setGridValue(size_t i, size_t j, size_t k, double value) {
-        if (i < nx_ && j < ny_ && k < nz_) {
-            grid_[i][j][k] = value;
+    double getGridValue(size_t i, size_t j, size_t k) const {
+        if (i >= nx_ || j >= ny_ || k >= nz_) {
+            throw std::out_of_range("Grid index out of range");
         }
+        return data_[offset(i, j, k)];
     }
+
+    double* data() { return data_.data(); }
+    const double* data() const { return data_.data(); }
     
     void generateTestField() {
         // Generate a test scalar field (e.g., temperature distribution)
@@ -274,7 +405,7 @@ public:
                     double r2 = (x-nx_*dx_/2)*(x-nx_*dx_/2) + 
                                (y-ny_*dy_/2)*(y-ny_*dy_/2) + 
                                (z-nz_*dz_/2)*(z-nz_*dz_/2);
-                    grid_[i][j][k] = 100.0 * std::exp(-r2 / (nx_*dx_*nx_*dx_/16));
+                    data_[offset(i, j, k)] = 100.0 * std::exp(-r2 / (nx_*dx_*nx_*dx_/16));
                 }
             }
         }
@@ -307,7 +438,7 @@ public:
             }
             
             GridPoint point(i_, j_, k_, 
-                           dataset_.grid_[i_][j_][k_],
+                           dataset_.data_[dataset_.offset(i_, j_, k_)],
                            i_ * dataset_.dx_,
                            j_ * dataset_.dy_,
                            k_ * dataset_.dz_);
@@ -342,47 +473,64 @@ public:
     };
     
     // Boundary-only iterator (for boundary conditions)
+    //
+    // Walks boundary cells in row-major order without materializing them:
+    // columns on an i or j face are boundary along their whole k-line,
+    // interior columns only touch the boundary at k = 0 and k = nz-1.
     class BoundaryIterator : public DataIterator<GridPoint> {
     private:
         const GridDataset& dataset_;
-        std::vector<GridPoint> boundaryPoints_;
+        size_t i_ = 0, j_ = 0, k_ = 0;
         size_t current_ = 0;
+        size_t total_;
         
-        void collectBoundaryPoints() {
-            // Collect all boundary points
-            for (size_t i = 0; i < dataset_.nx_; ++i) {
-                for (size_t j = 0; j < dataset_.ny_; ++j) {
-                    for (size_t k = 0; k < dataset_.nz_; ++k) {
-                        if (i == 0 || i == dataset_.nx_-1 ||
-                            j == 0 || j == dataset_.ny_-1 ||
-                            k == 0 || k == dataset_.nz_-1) {
-                            boundaryPoints_.emplace_back(
-                                i, j, k, dataset_.grid_[i][j][k],
-                                i * dataset_.dx_, j * dataset_.dy_, k * dataset_.dz_
-                            );
-                        }
-                    }
+        bool onSideFace() const {
+            return i_ == 0 || i_ == dataset_.nx_-1 ||
+                   j_ == 0 || j_ == dataset_.ny_-1;
+        }
+
+        void advance() {
+            if (onSideFace()) {
+                k_++;
+            } else {
+                k_ = (k_ == 0 && dataset_.nz_ > 1) ? dataset_.nz_-1 : dataset_.nz_;
+            }
+            if (k_ >= dataset_.nz_) {
+                k_ = 0;
+                j_++;
+                if (j_ >= dataset_.ny_) {
+                    j_ = 0;
+                    i_++;
                 }
             }
         }
         
+        static size_t interiorExtent(size_t n) { return n > 2 ? n - 2 : 0; }
+
     public:
-        BoundaryIterator(const GridDataset& dataset) : dataset_(dataset) {
-            collectBoundaryPoints();
-        }
+        BoundaryIterator(const GridDataset& dataset)
+            : dataset_(dataset),
+              total_(dataset.size() - interiorExtent(dataset.nx_) *
+                                      interiorExtent(dataset.ny_) *
+                                      interiorExtent(dataset.nz_)) {}
         
         bool hasNext() const override {
-            return current_ < boundaryPoints_.size();
+            return current_ < total_;
         }
         
         GridPoint next() override {
             if (!hasNext()) {
                 throw std::out_of_range("No more boundary points");
             }
-            return boundaryPoints_[current_++];
+            GridPoint point(i_, j_, k_, dataset_.data_[dataset_.offset(i_, j_, k_)],
+                            i_ * dataset_.dx_, j_ * dataset_.dy_, k_ * dataset_.dz_);
+            advance();
+            current_++;
+            return point;
         }
         
         void reset() override {
+            i_ = j_ = k_ = 0;
             current_ = 0;
         }
         
@@ -391,10 +539,307 @@ public:
         }
         
         double getProgress() const override {
-            return boundaryPoints_.empty() ? 1.0 :
-                   static_cast<double>(current_) / boundaryPoints_.size();
+            return total_ == 0 ? 1.0 :
+                   static_cast<double>(current_) / total_;
+        }
+    };
+
+    // Views handed out by the ranges. T is double or const double; all of
+    // them are a pointer plus extents, cheap to return by value.
+
+    // One cell: value reference plus indices and coordinates computed on
+    // demand from the linear offset
+    template <typename T>
+    class BasicCell {
+    private:
+        T* value_ = nullptr;
+        size_t index_ = 0;
+        const GridDataset* grid_ = nullptr;
+
+    public:
+        BasicCell() = default;
+        BasicCell(T* value, size_t index, const GridDataset* grid)
+            : value_(value), index_(index), grid_(grid) {}
+
+        T& value() const { return *value_; }
+        size_t index() const { return index_; }
+        size_t i() const { return index_ / (grid_->ny_ * grid_->nz_); }
+        size_t j() const { return (index_ / grid_->nz_) % grid_->ny_; }
+        size_t k() const { return index_ % grid_->nz_; }
+        double x() const { return i() * grid_->dx_; }
+        double y() const { return j() * grid_->dy_; }
+        double z() const { return k() * grid_->dz_; }
+
+        GridPoint point() const {
+            return GridPoint(i(), j(), k(), *value_, x(), y(), z());
+        }
+    };
+
+    // Contiguous k-line of the (i, j) column
+    template <typename T>
+    struct BasicLine {
+        size_t i = 0;
+        size_t j = 0;
+        Span<T> values;
+    };
+
+    // One i-plane: ny contiguous k-lines of nz values
+    template <typename T>
+    class BasicSlab {
+    private:
+        T* base_ = nullptr;
+        size_t i_ = 0, ny_ = 0, nz_ = 0;
+
+    public:
+        BasicSlab() = default;
+        BasicSlab(T* base, size_t i, size_t ny, size_t nz)
+            : base_(base), i_(i), ny_(ny), nz_(nz) {}
+
+        size_t index() const { return i_; }
+        Span<T> line(size_t j) const { return Span<T>(base_ + j * nz_, nz_); }
+        T& operator()(size_t j, size_t k) const { return base_[j * nz_ + k]; }
+        Span<T> values() const { return Span<T>(base_, ny_ * nz_); }
+    };
+
+    // Box [i0,i1) x [j0,j1) x [k0,k1); k-lines inside it stay contiguous
+    template <typename T>
+    class BasicTile {
+    private:
+        T* base_ = nullptr;
+        size_t ny_ = 0, nz_ = 0;
+        size_t lo_[3] = {0, 0, 0};
+        size_t hi_[3] = {0, 0, 0};
+
+    public:
+        BasicTile() = default;
+        BasicTile(T* base, size_t ny, size_t nz, const size_t lo[3], const size_t hi[3])
+            : base_(base), ny_(ny), nz_(nz) {
+            for (int d = 0; d < 3; ++d) {
+                lo_[d] = lo[d];
+                hi_[d] = hi[d];
+            }
+        }
+
+        size_t iBegin() const { return lo_[0]; }
+        size_t iEnd() const { return hi_[0]; }
+        size_t jBegin() const { return lo_[1]; }
+        size_t jEnd() const { return hi_[1]; }
+        size_t kBegin() const { return lo_[2]; }
+        size_t kEnd() const { return hi_[2]; }
+        size_t cellCount() const {
+            return (hi_[0] - lo_[0]) * (hi_[1] - lo_[1]) * (hi_[2] - lo_[2]);
+        }
+
+        // k-line of column (i, j) clipped to the tile; i and j are global, so
+        // stencils can fetch neighbour columns just outside the tile
+        Span<T> line(size_t i, size_t j) const {
+            return Span<T>(base_ + (i * ny_ + j) * nz_ + lo_[2], hi_[2] - lo_[2]);
         }
     };
+
+    using Cell = BasicCell<double>;
+    using ConstCell = BasicCell<const double>;
+    using Line = BasicLine<double>;
+    using ConstLine = BasicLine<const double>;
+    using Slab = BasicSlab<double>;
+    using ConstSlab = BasicSlab<const double>;
+    using Tile = BasicTile<double>;
+    using ConstTile = BasicTile<const double>;
+
+    template <typename T>
+    struct CellGenerator {
+        using value_type = BasicCell<T>;
+        T* base = nullptr;
+        const GridDataset* grid = nullptr;
+
+        value_type operator()(size_t n) const { return value_type(base + n, n, grid); }
+    };
+
+    template <typename T>
+    struct LineGenerator {
+        using value_type = BasicLine<T>;
+        T* base = nullptr;
+        size_t ny = 1, nz = 0;
+
+        value_type operator()(size_t n) const {
+            value_type line;
+            line.i = n / ny;
+            line.j = n % ny;
+            line.values = Span<T>(base + n * nz, nz);
+            return line;
+        }
+    };
+
+    template <typename T>
+    struct SlabGenerator {
+        using value_type = BasicSlab<T>;
+        T* base = nullptr;
+        size_t ny = 0, nz = 0;
+
+        value_type operator()(size_t i) const {
+            return value_type(base + i * ny * nz, i, ny, nz);
+        }
+    };
+
+    // Random-access ranges over every cell, every k-line and every i-slab
+    ViewRange<CellGenerator<double>> cells() {
+        return ViewRange<CellGenerator<double>>(CellGenerator<double>{data_.data(), this}, data_.size());
+    }
+    ViewRange<CellGenerator<const double>> cells() const {
+        return ViewRange<CellGenerator<const double>>(
+            CellGenerator<const double>{data_.data(), this}, data_.size());
+    }
+    ViewRange<LineGenerator<double>> lines() {
+        return ViewRange<LineGenerator<double>>(LineGenerator<double>{data_.data(), ny_, nz_}, nx_ * ny_);
+    }
+    ViewRange<LineGenerator<const double>> lines() const {
+        return ViewRange<LineGenerator<const double>>(
+            LineGenerator<const double>{data_.data(), ny_, nz_}, nx_ * ny_);
+    }
+    ViewRange<SlabGenerator<double>> slabs() {
+        return ViewRange<SlabGenerator<double>>(SlabGenerator<double>{data_.data(), ny_, nz_}, nx_);
+    }
+    ViewRange<SlabGenerator<const double>> slabs() const {
+        return ViewRange<SlabGenerator<const double>>(
+            SlabGenerator<const double>{data_.data(), ny_, nz_}, nx_);
+    }
+
+    enum class TileOrder {
+        ROW_MAJOR,  // tiles visited i-major like the cells inside them
+        MORTON      // Z-order over tile coordinates: neighbouring tiles stay close in time
+    };
+
+    // Forward iterator over the tiles covering the grid minus `halo` layers
+    // on each face. Morton order interleaves the bits of the tile
+    // coordinates, giving each dimension only as many bits as its tile
+    // count needs; codes that fall outside the tile grid are skipped, which
+    // wastes at most a few increments per tile for non-power-of-two shapes.
+    template <typename T>
+    class TileIterator {
+    private:
+        T* base_ = nullptr;
+        size_t ny_ = 0, nz_ = 0;
+        size_t lo_[3] = {0, 0, 0};
+        size_t hi_[3] = {0, 0, 0};
+        size_t extent_[3] = {1, 1, 1};
+        size_t count_[3] = {0, 0, 0};
+        unsigned bits_[3] = {0, 0, 0};
+        TileOrder order_ = TileOrder::ROW_MAJOR;
+        uint64_t code_ = 0;
+        uint64_t endCode_ = 0;
+        size_t tile_[3] = {0, 0, 0};
+
+        bool decode(uint64_t code, size_t tile[3]) const {
+            if (order_ == TileOrder::ROW_MAJOR) {
+                tile[2] = code % count_[2];
+                tile[1] = (code / count_[2]) % count_[1];
+                tile[0] = code / (count_[2] * count_[1]);
+                return true;
+            }
+            tile[0] = tile[1] = tile[2] = 0;
+            unsigned maxBits = std::max(bits_[0], std::max(bits_[1], bits_[2]));
+            for (unsigned level = 0; level < maxBits; ++level) {
+                for (int d = 2; d >= 0; --d) {
+                    if (level < bits_[d]) {
+                        tile[d] |= static_cast<size_t>(code & 1) << level;
+                        code >>= 1;
+                    }
+                }
+            }
+            return tile[0] < count_[0] && tile[1] < count_[1] && tile[2] < count_[2];
+        }
+
+        void settle() {
+            while (code_ < endCode_ && !decode(code_, tile_)) {
+                ++code_;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = BasicTile<T>;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type;
+        using pointer = void;
+
+        TileIterator() = default;
+        TileIterator(T* base, const size_t dims[3], const size_t extent[3],
+                     size_t halo, TileOrder order, bool atEnd)
+            : base_(base), ny_(dims[1]), nz_(dims[2]), order_(order) {
+            bool empty = false;
+            for (int d = 0; d < 3; ++d) {
+                lo_[d] = halo;
+                hi_[d] = dims[d] > halo ? dims[d] - halo : 0;
+                extent_[d] = std::max<size_t>(1, extent[d]);
+                count_[d] = hi_[d] > lo_[d] ? (hi_[d] - lo_[d] + extent_[d] - 1) / extent_[d] : 0;
+                empty = empty || count_[d] == 0;
+                while ((size_t(1) << bits_[d]) < count_[d]) {
+                    bits_[d]++;
+                }
+            }
+            if (empty) {
+                endCode_ = 0;
+            } else if (order_ == TileOrder::ROW_MAJOR) {
+                endCode_ = count_[0] * count_[1] * count_[2];
+            } else {
+                endCode_ = uint64_t(1) << (bits_[0] + bits_[1] + bits_[2]);
+            }
+            code_ = atEnd ? endCode_ : 0;
+            settle();
+        }
+
+        value_type operator*() const {
+            size_t lo[3], hi[3];
+            for (int d = 0; d < 3; ++d) {
+                lo[d] = lo_[d] + tile_[d] * extent_[d];
+                hi[d] = std::min(hi_[d], lo[d] + extent_[d]);
+            }
+            return value_type(base_, ny_, nz_, lo, hi);
+        }
+
+        TileIterator& operator++() {
+            ++code_;
+            settle();
+            return *this;
+        }
+        TileIterator operator++(int) { TileIterator old = *this; ++*this; return old; }
+
+        bool operator==(const TileIterator& other) const { return code_ == other.code_; }
+        bool operator!=(const TileIterator& other) const { return code_ != other.code_; }
+
+        size_t tileCount() const { return count_[0] * count_[1] * count_[2]; }
+    };
+
+    template <typename T>
+    class TileRange {
+    private:
+        TileIterator<T> begin_, end_;
+
+    public:
+        using iterator = TileIterator<T>;
+
+        TileRange(T* base, const size_t dims[3], const size_t extent[3],
+                  size_t halo, TileOrder order)
+            : begin_(base, dims, extent, halo, order, false),
+              end_(base, dims, extent, halo, order, true) {}
+
+        iterator begin() const { return begin_; }
+        iterator end() const { return end_; }
+        size_t size() const { return begin_.tileCount(); }
+    };
+
+    TileRange<double> tiles(size_t ti, size_t tj, size_t tk,
+                            TileOrder order = TileOrder::MORTON, size_t halo = 0) {
+        const size_t dims[3] = {nx_, ny_, nz_};
+        const size_t extent[3] = {ti, tj, tk};
+        return TileRange<double>(data_.data(), dims, extent, halo, order);
+    }
+    TileRange<const double> tiles(size_t ti, size_t tj, size_t tk,
+                                  TileOrder order = TileOrder::MORTON, size_t halo = 0) const {
+        const size_t dims[3] = {nx_, ny_, nz_};
+        const size_t extent[3] = {ti, tj, tk};
+        return TileRange<const double>(data_.data(), dims, extent, halo, order);
+    }
     
     std::unique_ptr<DataIterator<GridPoint>> createIterator() override {
         return std::make_unique<RowMajorIterator>(*this);
@@ -449,11 +894,11 @@ void analyzeTimeSeries(TimeSeriesDataset& dataset) {
 
 void analyzeWindowed(TimeSeriesDataset& dataset, size_t windowSize) {
     std::cout << "\n  Windowed analysis (window=" << windowSize << "):\n";
-    auto winIt = dataset.createWindowedIterator(windowSize, windowSize/2);
+    auto windows = dataset.windows(windowSize, windowSize/2);
     
     int windowNum = 0;
-    while (winIt->hasNext() && windowNum < 5) { // Show first 5 windows
-        auto window = winIt->next();
+    for (auto it = windows.begin(); it != windows.end() && windowNum < 5; ++it) { // Show first 5 windows
+        auto window = *it;
         double winMean = 0;
         for (const auto& point : window) {
             winMean += point.value;
@@ -514,6 +959,162 @@ void analyzeGrid(GridDataset& dataset) {
               << boundarySum / boundaryCount << "\n";
 }
 
+// Seven-point Laplacian over the grid interior, once through the virtual
+// iterator with bounds-checked neighbour lookups and once through each of the
+// view ranges. All three add the neighbours in the same order, so the
+// results must agree bit for bit.
+void stencilTraversalExample() {
+    std::cout << "\n\n4. Stencil Traversal: Virtual Iterator vs Views\n";
+    std::cout << "===============================================\n";
+    
+    const size_t n = 160;
+    GridDataset field("Stencil Benchmark", "Temperature", n, n, n, 0.01, 0.01, 0.01);
+    field.generateTestField();
+    const GridDataset& input = field;
+    GridDataset viaIterator("Laplacian", "Temperature", n, n, n, 0.01, 0.01, 0.01);
+    GridDataset viaSlabs("Laplacian", "Temperature", n, n, n, 0.01, 0.01, 0.01);
+    GridDataset viaTiles("Laplacian", "Temperature", n, n, n, 0.01, 0.01, 0.01);
+    const double interiorCells = std::pow(static_cast<double>(n - 2), 3);
+    
+    auto report = [&](const char* label, std::chrono::microseconds elapsed) {
+        std::cout << "  " << std::left << std::setw(38) << label << std::right
+                  << std::fixed << std::setprecision(1) << std::setw(8)
+                  << elapsed.count() / 1000.0 << " ms  "
+                  << std::setw(7) << interiorCells / elapsed.count() << " Mcells/s\n";
+    };
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    auto it = field.createIterator();
+    while (it->hasNext()) {
+        GridPoint p = it->next();
+        if (p.i == 0 || p.i == n-1 || p.j == 0 || p.j == n-1 || p.k == 0 || p.k == n-1) {
+            continue;
+        }
+        double lap = input.getGridValue(p.i-1, p.j, p.k) + input.getGridValue(p.i+1, p.j, p.k) +
+                     input.getGridValue(p.i, p.j-1, p.k) + input.getGridValue(p.i, p.j+1, p.k) +
+                     input.getGridValue(p.i, p.j, p.k-1) + input.getGridValue(p.i, p.j, p.k+1) -
+                     6.0 * p.value;
+        viaIterator.setGridValue(p.i, p.j, p.k, lap);
+    }
+    auto iteratorTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    
+    // Slabs: three input planes and one output plane per i, k-lines as spans
+    start = std::chrono::high_resolution_clock::now();
+    auto inSlabs = input.slabs();
+    auto outSlabs = viaSlabs.slabs();
+    for (size_t i = 1; i + 1 < n; ++i) {
+        auto below = inSlabs[i-1], here = inSlabs[i], above = inSlabs[i+1];
+        auto target = outSlabs[i];
+        for (size_t j = 1; j + 1 < n; ++j) {
+            Span<const double> down = below.line(j), up = above.line(j);
+            Span<const double> south = here.line(j-1), north = here.line(j+1);
+            Span<const double> c = here.line(j);
+            Span<double> out = target.line(j);
+            for (size_t k = 1; k + 1 < n; ++k) {
+                out[k] = down[k] + up[k] + south[k] + north[k] +
+                         c[k-1] + c[k+1] - 6.0 * c[k];
+            }
+        }
+    }
+    auto slabTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    
+    // Tiles: Morton-ordered 16x16 column blocks with full k-lines, skipping
+    // the one-cell halo; neighbour lines are addressed through the same tile
+    start = std::chrono::high_resolution_clock::now();
+    const double* base = input.data();
+    double* outBase = viaTiles.data();
+    for (auto tile : input.tiles(16, 16, n, GridDataset::TileOrder::MORTON, 1)) {
+        for (size_t i = tile.iBegin(); i < tile.iEnd(); ++i) {
+            for (size_t j = tile.jBegin(); j < tile.jEnd(); ++j) {
+                const double* c = tile.line(i, j).data();
+                const double* down = tile.line(i-1, j).data();
+                const double* up = tile.line(i+1, j).data();
+                const double* south = tile.line(i, j-1).data();
+                const double* north = tile.line(i, j+1).data();
+                double* out = outBase + (c - base);
+                size_t len = tile.kEnd() - tile.kBegin();
+                for (size_t k = 0; k < len; ++k) {
+                    out[k] = down[k] + up[k] + south[k] + north[k] +
+                             c[k-1] + c[k+1] - 6.0 * c[k];
+                }
+            }
+        }
+    }
+    auto tileTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    
+    std::cout << "  Grid: " << n << "³, interior " << static_cast<size_t>(interiorCells) << " cells\n";
+    report("Virtual iterator + getGridValue", iteratorTime);
+    report("Slab/line spans", slabTime);
+    report("Morton tiles (16x16 columns)", tileTime);
+    
+    bool identical = std::equal(viaIterator.data(), viaIterator.data() + viaIterator.size(), viaSlabs.data()) &&
+                     std::equal(viaIterator.data(), viaIterator.data() + viaIterator.size(), viaTiles.data());
+    std::cout << "  Results identical: " << (identical ? "yes" : "NO") << "\n";
+    std::cout << "  Speedup (spans): " << std::setprecision(1)
+              << (double)iteratorTime.count() / slabTime.count() << "x\n";
+    
+    // Other view ranges on the small field
+    size_t columnCells = 0;
+    for (auto cell : input.cells()) {
+        if (cell.i() == 0 && cell.j() == 0) {
+            columnCells++;
+        }
+    }
+    auto lines = input.lines();
+    auto hottest = std::max_element(lines.begin(), lines.end(),
+        [](const GridDataset::ConstLine& a, const GridDataset::ConstLine& b) {
+            return *std::max_element(a.values.begin(), a.values.end()) <
+                   *std::max_element(b.values.begin(), b.values.end());
+        });
+    std::cout << "  cells(): " << input.cells().size() << " views, " << columnCells
+              << " on the (0,0) column; lines(): hottest column ("
+              << (*hottest).i << ", " << (*hottest).j << ")\n";
+    
+    // Sliding windows: copied vectors vs spans
+    TimeSeriesDataset series("Window Benchmark", "Units", 1000.0);
+    series.generateSyntheticData(200000, 1.0);
+    const size_t windowSize = 256, stride = 8;
+    
+    start = std::chrono::high_resolution_clock::now();
+    auto winIt = series.createWindowedIterator(windowSize, stride);
+    double copiedSum = 0;
+    size_t copiedCount = 0;
+    while (winIt->hasNext()) {
+        auto window = winIt->next();
+        double mean = 0;
+        for (const auto& point : window) {
+            mean += point.value;
+        }
+        copiedSum += mean / window.size();
+        copiedCount++;
+    }
+    auto copiedTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    
+    start = std::chrono::high_resolution_clock::now();
+    double spanSum = 0;
+    size_t spanCount = 0;
+    for (auto window : series.windows(windowSize, stride)) {
+        double mean = 0;
+        for (const auto& point : window) {
+            mean += point.value;
+        }
+        spanSum += mean / window.size();
+        spanCount++;
+    }
+    auto spanTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    
+    std::cout << "\n  Sliding windows (" << copiedCount << " windows of " << windowSize << "):\n";
+    std::cout << "    WindowedIterator (copies): " << copiedTime.count() << " μs\n";
+    std::cout << "    windows() spans:           " << spanTime.count() << " μs\n";
+    std::cout << "    Same means: " << (copiedSum == spanSum && copiedCount == spanCount ? "yes" : "NO")
+              << ", speedup " << (double)copiedTime.count() / spanTime.count() << "x\n";
+}
+
 int main() {
     std::cout << "=== Scientific Dataset Iterator Pattern Demo ===\n\n";
     
@@ -594,6 +1195,8 @@ int main() {
     std::cout << "  Speedup: " << std::fixed << std::setprecision(2)
               << (double)seqTime.count() / decTime.count() << "x\n";
     
+    stencilTraversalExample();
+    
     std::cout << "\nIterator pattern provides flexible traversal\n";
     std::cout << "of scientific datasets with different access patterns!\n";
     
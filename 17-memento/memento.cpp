@@ -12,6 +12,13 @@
 #include <random>
 #include <fstream>
 #include <chrono>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <future>
+#include <filesystem>
+#include <stdexcept>
 
 // Forward declaration
 class MolecularDynamicsSimulation;
@@ -32,10 +39,154 @@ struct ParticleState {
           temperature(0.0), pressure(0.0) {}
 };
 
+// Lossless compression for checkpointed double fields
+//
+// Each value is XORed with a reference: the same element of the previous
+// checkpoint for delta fields, or the preceding element for key frames.
+// Between nearby MD steps only the low mantissa bits move, so residuals have
+// many leading zero bytes. Residuals are stored two per header byte (4-bit
+// significant-byte counts) followed by their significant bytes.
+class CompressedField {
+private:
+    std::shared_ptr<const std::vector<uint8_t>> bytes_;  // null once spilled to disk
+    size_t count_ = 0;
+    size_t storedSize_ = 0;
+    bool delta_ = false;
+    std::string spillPath_;
+    std::streamoff spillOffset_ = 0;
+    
+    static uint64_t toBits(double v) {
+        uint64_t b;
+        std::memcpy(&b, &v, sizeof(b));
+        return b;
+    }
+    
+    static double fromBits(uint64_t b) {
+        double v;
+        std::memcpy(&v, &b, sizeof(v));
+        return v;
+    }
+    
+    static unsigned significantBytes(uint64_t x) {
+        unsigned n = 0;
+        while (x) {
+            ++n;
+            x >>= 8;
+        }
+        return n;
+    }
+    
+    std::shared_ptr<const std::vector<uint8_t>> loadBytes() const {
+        if (bytes_) {
+            return bytes_;
+        }
+        auto bytes = std::make_shared<std::vector<uint8_t>>(storedSize_);
+        std::ifstream in(spillPath_, std::ios::binary);
+        in.seekg(spillOffset_);
+        in.read(reinterpret_cast<char*>(bytes->data()), storedSize_);
+        if (!in) {
+            throw std::runtime_error("Failed to read spilled checkpoint: " + spillPath_);
+        }
+        return bytes;
+    }
+    
+public:
+    // reference == nullptr encodes a self-contained key frame
+    static CompressedField encode(const std::vector<double>& values,
+                                  const std::vector<double>* reference) {
+        size_t n = values.size();
+        
+        // Residual pass kept branch-free so it vectorizes
+        std::vector<uint64_t> residual(n);
+        if (reference) {
+            const double* ref = reference->data();
+            for (size_t i = 0; i < n; ++i) {
+                residual[i] = toBits(values[i]) ^ toBits(ref[i]);
+            }
+        } else if (n > 0) {
+            residual[0] = toBits(values[0]);
+            for (size_t i = 1; i < n; ++i) {
+                residual[i] = toBits(values[i]) ^ toBits(values[i - 1]);
+            }
+        }
+        
+        auto bytes = std::make_shared<std::vector<uint8_t>>();
+        bytes->reserve(n * 2);
+        for (size_t i = 0; i < n; i += 2) {
+            unsigned n0 = significantBytes(residual[i]);
+            unsigned n1 = i + 1 < n ? significantBytes(residual[i + 1]) : 0;
+            bytes->push_back(static_cast<uint8_t>(n0 | (n1 << 4)));
+            for (unsigned b = 0; b < n0; ++b) bytes->push_back(static_cast<uint8_t>(residual[i] >> (8 * b)));
+            for (unsigned b = 0; b < n1; ++b) bytes->push_back(static_cast<uint8_t>(residual[i + 1] >> (8 * b)));
+        }
+        bytes->shrink_to_fit();
+        
+        CompressedField field;
+        field.count_ = n;
+        field.storedSize_ = bytes->size();
+        field.delta_ = reference != nullptr;
+        field.bytes_ = std::move(bytes);
+        return field;
+    }
+    
+    // For delta fields `out` must already hold the reference values
+    void decodeInto(std::vector<double>& out) const {
+        auto holder = loadBytes();
+        const uint8_t* p = holder->data();
+        out.resize(count_);
+        
+        uint64_t prev = 0;
+        for (size_t i = 0; i < count_; i += 2) {
+            uint8_t header = *p++;
+            for (size_t k = 0; k < 2 && i + k < count_; ++k) {
+                unsigned nbytes = k == 0 ? (header & 0x0F) : (header >> 4);
+                uint64_t r = 0;
+                for (unsigned b = 0; b < nbytes; ++b) r |= static_cast<uint64_t>(*p++) << (8 * b);
+                
+                if (delta_) {
+                    out[i + k] = fromBits(toBits(out[i + k]) ^ r);
+                } else {
+                    prev ^= r;
+                    out[i + k] = fromBits(prev);
+                }
+            }
+        }
+    }
+    
+    bool isDelta() const { return delta_; }
+    bool isResident() const { return bytes_ != nullptr; }
+    size_t residentBytes() const { return bytes_ ? bytes_->size() : 0; }
+    size_t storedBytes() const { return storedSize_; }
+    std::shared_ptr<const std::vector<uint8_t>> payload() const { return bytes_; }
+    
+    void markSpilled(const std::string& path, std::streamoff offset) {
+        spillPath_ = path;
+        spillOffset_ = offset;
+    }
+    
+    // Only after the spill write has completed
+    void releaseResident() { bytes_.reset(); }
+};
+
 // Memento class - stores complete simulation state
+//
+// Fields are kept compressed. A delta memento stores XOR residuals against
+// base_, the previous checkpoint, and a key frame stores self-contained
+// fields; decoding a delta walks the chain back to the nearest key frame.
+// Fields are decoded one at a time, so a restore only pays for what it asks
+// for. The caretaker may spill the payload to disk, after which fields are
+// read back from the spill file on demand.
 class SimulationMemento {
+public:
+    enum Field : unsigned { Positions = 1, Velocities = 2, Forces = 4, AllFields = 7 };
+    
 private:
-    ParticleState particleState_;
+    std::array<CompressedField, 3> fields_;   // positions, velocities, forces
+    const SimulationMemento* base_;           // nullptr for key frames
+    double potentialEnergy_;
+    double kineticEnergy_;
+    double temperature_;
+    double pressure_;
     double currentTime_;
     double timeStep_;
     int stepNumber_;
@@ -43,41 +194,164 @@ private:
     int numParticles_;
     std::string timestamp_;
     std::string checkpointReason_;
-    size_t memoryUsage_;
+    size_t rawBytes_;
+    
+    // Asynchronous spill to disk
+    std::string spillPath_;
+    std::future<void> spillWrite_;
+    bool spilled_ = false;
     
     // Only MolecularDynamicsSimulation can create mementos
     friend class MolecularDynamicsSimulation;
     
-    SimulationMemento(const ParticleState& state, double time, double dt, 
-                     int step, double boxLen, int numPart, const std::string& reason)
-        : particleState_(state), currentTime_(time), timeStep_(dt), 
-          stepNumber_(step), boxLength_(boxLen), numParticles_(numPart),
-          checkpointReason_(reason) {
+    static const std::vector<double>& stateField(const ParticleState& state, size_t index) {
+        return index == 0 ? state.positions : (index == 1 ? state.velocities : state.forces);
+    }
+    
+    SimulationMemento(const ParticleState& state, const SimulationMemento* base,
+                     double time, double dt, int step, double boxLen, int numPart,
+                     const std::string& reason)
+        : base_(base), potentialEnergy_(state.potentialEnergy), kineticEnergy_(state.kineticEnergy),
+          temperature_(state.temperature), pressure_(state.pressure),
+          currentTime_(time), timeStep_(dt), stepNumber_(step), boxLength_(boxLen),
+          numParticles_(numPart), checkpointReason_(reason) {
         // Generate timestamp
         auto now = std::time(nullptr);
         std::stringstream ss;
         ss << std::put_time(std::localtime(&now), "%Y-%m-%d %H:%M:%S");
         timestamp_ = ss.str();
         
-        // Estimate memory usage
-        memoryUsage_ = sizeof(ParticleState) + particleState_.positions.capacity() * sizeof(double) * 3;
+        std::vector<double> reference;
+        for (size_t f = 0; f < fields_.size(); ++f) {
+            const std::vector<double>& values = stateField(state, f);
+            if (base_) {
+                base_->decodeField(f, reference);
+                fields_[f] = CompressedField::encode(values, &reference);
+            } else {
+                fields_[f] = CompressedField::encode(values, nullptr);
+            }
+        }
+        
+        rawBytes_ = sizeof(ParticleState) + 3 * state.positions.size() * sizeof(double);
+    }
+    
+    void decodeField(size_t index, std::vector<double>& out) const {
+        if (fields_[index].isDelta()) {
+            base_->decodeField(index, out);
+        }
+        fields_[index].decodeInto(out);
+    }
+    
+    void waitForSpill() const {
+        if (spillWrite_.valid()) {
+            spillWrite_.wait();
+        }
     }
     
 public:
+    ~SimulationMemento() {
+        waitForSpill();
+        if (!spillPath_.empty()) {
+            std::remove(spillPath_.c_str());
+        }
+    }
+    
+    SimulationMemento(const SimulationMemento&) = delete;
+    SimulationMemento& operator=(const SimulationMemento&) = delete;
+    
     std::string getDescription() const {
         std::stringstream ss;
         ss << "Checkpoint: " << checkpointReason_ << " at " << timestamp_
            << "\n  Simulation time: " << std::scientific << currentTime_ << " s"
            << "\n  Step: " << stepNumber_ << ", Particles: " << numParticles_
            << "\n  Energy: " << std::fixed << std::setprecision(3) 
-           << (particleState_.kineticEnergy + particleState_.potentialEnergy) << " J"
-           << "\n  Memory: " << (memoryUsage_ / 1024.0) << " KB";
+           << (kineticEnergy_ + potentialEnergy_) << " J"
+           << "\n  Memory: " << (storedBytes() / 1024.0) << " KB "
+           << (isKeyframe() ? "key frame" : "delta") << " (raw " << (rawBytes_ / 1024.0) << " KB"
+           << (spilled_ ? ", spilled to disk)" : ")");
         return ss.str();
     }
     
     double getSimulationTime() const { return currentTime_; }
     int getStepNumber() const { return stepNumber_; }
     const std::string& getReason() const { return checkpointReason_; }
+    
+    bool isKeyframe() const { return base_ == nullptr; }
+    const SimulationMemento* getBase() const { return base_; }
+    bool isSpilled() const { return spilled_; }
+    size_t rawBytes() const { return rawBytes_; }
+    
+    size_t storedBytes() const {
+        size_t total = 0;
+        for (const auto& field : fields_) total += field.storedBytes();
+        return total;
+    }
+    
+    size_t residentBytes() const {
+        size_t total = 0;
+        for (const auto& field : fields_) total += field.residentBytes();
+        return total;
+    }
+    
+    size_t deltaDepth() const {
+        return base_ ? base_->deltaDepth() + 1 : 0;
+    }
+    
+    // Re-encode as a key frame so the base checkpoint can be discarded
+    void rebaseAsKeyframe() {
+        if (!base_) return;
+        std::array<CompressedField, 3> keyframe;
+        std::vector<double> values;
+        for (size_t f = 0; f < fields_.size(); ++f) {
+            decodeField(f, values);
+            keyframe[f] = CompressedField::encode(values, nullptr);
+        }
+        waitForSpill();
+        if (!spillPath_.empty()) {
+            std::remove(spillPath_.c_str());
+            spillPath_.clear();
+        }
+        spilled_ = false;
+        fields_ = std::move(keyframe);
+        base_ = nullptr;
+    }
+    
+    // Starts writing the compressed payload to `path` on a background thread;
+    // the in-memory copy stays valid until releaseSpilled() sees the write done
+    void spillToDisk(const std::string& path) {
+        if (spilled_ || spillWrite_.valid()) return;
+        spillPath_ = path;
+        
+        std::vector<std::shared_ptr<const std::vector<uint8_t>>> payloads;
+        std::streamoff offset = 0;
+        for (auto& field : fields_) {
+            field.markSpilled(path, offset);
+            offset += field.storedBytes();
+            payloads.push_back(field.payload());
+        }
+        spillWrite_ = std::async(std::launch::async, [path, payloads]() {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            for (const auto& bytes : payloads) {
+                out.write(reinterpret_cast<const char*>(bytes->data()), bytes->size());
+            }
+        });
+    }
+    
+    bool spillInProgress() const { return spillWrite_.valid(); }
+    
+    // Drops the resident payload once its spill write has finished
+    bool releaseSpilled(bool wait = false) {
+        if (!spillWrite_.valid()) {
+            return false;
+        }
+        if (!wait && spillWrite_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return false;
+        }
+        spillWrite_.get();
+        for (auto& field : fields_) field.releaseResident();
+        spilled_ = true;
+        return true;
+    }
 };
 
 // Originator - Molecular Dynamics Simulation that creates and restores from mementos
@@ -240,18 +514,26 @@ public:
         std::cout << "============================\n\n";
     }
     
-    // Create memento
-    std::unique_ptr<SimulationMemento> saveCheckpoint(const std::string& reason) const {
+    // Create memento; with a previous checkpoint only the residuals are stored
+    std::unique_ptr<SimulationMemento> saveCheckpoint(const std::string& reason,
+                                                      const SimulationMemento* previous = nullptr) const {
         std::cout << "Creating simulation checkpoint: " << reason << "...\n";
         return std::unique_ptr<SimulationMemento>(
-            new SimulationMemento(currentState_, currentTime_, timeStep_, 
+            new SimulationMemento(currentState_, previous, currentTime_, timeStep_, 
                                 stepNumber_, boxLength_, numParticles_, reason)
         );
     }
     
-    // Restore from memento
-    void restoreCheckpoint(const SimulationMemento& checkpoint) {
-        currentState_ = checkpoint.particleState_;
+    // Restore from memento; fields not selected keep their current values
+    void restoreCheckpoint(const SimulationMemento& checkpoint,
+                           unsigned fields = SimulationMemento::AllFields) {
+        if (fields & SimulationMemento::Positions) checkpoint.decodeField(0, currentState_.positions);
+        if (fields & SimulationMemento::Velocities) checkpoint.decodeField(1, currentState_.velocities);
+        if (fields & SimulationMemento::Forces) checkpoint.decodeField(2, currentState_.forces);
+        currentState_.potentialEnergy = checkpoint.potentialEnergy_;
+        currentState_.kineticEnergy = checkpoint.kineticEnergy_;
+        currentState_.temperature = checkpoint.temperature_;
+        currentState_.pressure = checkpoint.pressure_;
         currentTime_ = checkpoint.currentTime_;
         timeStep_ = checkpoint.timeStep_;
         stepNumber_ = checkpoint.stepNumber_;
@@ -265,17 +547,51 @@ public:
     int getStepNumber() const { return stepNumber_; }
     double getTotalEnergy() const { return currentState_.kineticEnergy + currentState_.potentialEnergy; }
     double getTemperature() const { return currentState_.temperature; }
+    const std::vector<double>& getPositions() const { return currentState_.positions; }
+    const std::vector<double>& getVelocities() const { return currentState_.velocities; }
 };
 
 // Caretaker - manages simulation checkpoints and rollback
+//
+// Checkpoints are chained as deltas against their predecessor, with a key
+// frame every keyframeInterval_ checkpoints to bound restore cost. When the
+// resident payload exceeds memoryBudget_ the oldest checkpoints are spilled
+// to spillDirectory_ in the background; the newest one always stays in RAM.
 class SimulationCheckpointManager {
 private:
     std::vector<std::unique_ptr<SimulationMemento>> checkpoints_;
     size_t currentIndex_ = 0;
     size_t maxCheckpoints_ = 10;
+    size_t memoryBudget_;
+    size_t keyframeInterval_;
+    std::filesystem::path spillDirectory_;
+    size_t spillCounter_ = 0;
+    
+    void enforceMemoryBudget() {
+        size_t resident = 0;
+        for (auto& checkpoint : checkpoints_) {
+            checkpoint->releaseSpilled();
+            resident += checkpoint->residentBytes();
+        }
+        
+        for (size_t i = 0; i + 1 < checkpoints_.size() && resident > memoryBudget_; ++i) {
+            SimulationMemento& checkpoint = *checkpoints_[i];
+            if (checkpoint.isSpilled() || checkpoint.spillInProgress()) continue;
+            
+            std::filesystem::path path = spillDirectory_ /
+                ("md_checkpoint_" + std::to_string(reinterpret_cast<uintptr_t>(this)) +
+                 "_" + std::to_string(spillCounter_++) + ".chk");
+            resident -= checkpoint.residentBytes();
+            checkpoint.spillToDisk(path.string());
+        }
+    }
     
 public:
-    SimulationCheckpointManager(size_t maxCheckpoints = 10) : maxCheckpoints_(maxCheckpoints) {}
+    SimulationCheckpointManager(size_t maxCheckpoints = 10, size_t memoryBudget = SIZE_MAX,
+                                size_t keyframeInterval = 8,
+                                std::filesystem::path spillDirectory = std::filesystem::temp_directory_path())
+        : maxCheckpoints_(maxCheckpoints), memoryBudget_(memoryBudget),
+          keyframeInterval_(keyframeInterval), spillDirectory_(std::move(spillDirectory)) {}
     
     void createCheckpoint(MolecularDynamicsSimulation& simulation, const std::string& reason) {
         // Remove any checkpoints after current index (for branching recovery)
@@ -283,17 +599,30 @@ public:
             checkpoints_.erase(checkpoints_.begin() + currentIndex_, checkpoints_.end());
         }
         
-        // Add new checkpoint
-        checkpoints_.push_back(simulation.saveCheckpoint(reason));
+        // Add new checkpoint, as a delta unless the chain is due a key frame
+        const SimulationMemento* previous = nullptr;
+        if (!checkpoints_.empty() && checkpoints_.back()->deltaDepth() + 1 < keyframeInterval_) {
+            previous = checkpoints_.back().get();
+        }
+        checkpoints_.push_back(simulation.saveCheckpoint(reason, previous));
         currentIndex_ = checkpoints_.size();
         
         // Limit number of checkpoints to prevent excessive memory usage
         if (checkpoints_.size() > maxCheckpoints_) {
+            if (checkpoints_[1]->getBase() == checkpoints_[0].get()) {
+                checkpoints_[1]->rebaseAsKeyframe();
+            }
             checkpoints_.erase(checkpoints_.begin());
             currentIndex_--;
         }
         
-        std::cout << "Checkpoint #" << checkpoints_.size() << " created\n\n";
+        enforceMemoryBudget();
+        
+        const SimulationMemento& created = *checkpoints_.back();
+        std::cout << "Checkpoint #" << checkpoints_.size() << " created ("
+                  << (created.isKeyframe() ? "key frame" : "delta") << ", "
+                  << std::fixed << std::setprecision(1) << created.storedBytes() / 1024.0
+                  << " KB of " << created.rawBytes() / 1024.0 << " KB raw)\n\n";
     }
     
     void rollback(MolecularDynamicsSimulation& simulation) {
@@ -316,16 +645,43 @@ public:
         }
     }
     
-    void restoreToCheckpoint(MolecularDynamicsSimulation& simulation, size_t index) {
+    // `fields` selects which particle arrays to reconstruct (SimulationMemento::Field bits)
+    void restoreToCheckpoint(MolecularDynamicsSimulation& simulation, size_t index,
+                             unsigned fields = SimulationMemento::AllFields) {
         if (index > 0 && index <= checkpoints_.size()) {
             currentIndex_ = index;
-            simulation.restoreCheckpoint(*checkpoints_[index - 1]);
+            simulation.restoreCheckpoint(*checkpoints_[index - 1], fields);
             std::cout << "Restored to checkpoint #" << index << "\n\n";
         } else {
             std::cout << "Invalid checkpoint index: " << index << "\n";
         }
     }
     
+    // Blocks until background spills are written and their memory released
+    void flushSpills() {
+        for (auto& checkpoint : checkpoints_) {
+            checkpoint->releaseSpilled(true);
+        }
+    }
+    
+    size_t residentBytes() const {
+        size_t total = 0;
+        for (const auto& checkpoint : checkpoints_) total += checkpoint->residentBytes();
+        return total;
+    }
+    
+    size_t rawBytes() const {
+        size_t total = 0;
+        for (const auto& checkpoint : checkpoints_) total += checkpoint->rawBytes();
+        return total;
+    }
+    
+    size_t spilledCount() const {
+        size_t count = 0;
+        for (const auto& checkpoint : checkpoints_) count += checkpoint->isSpilled() ? 1 : 0;
+        return count;
+    }
+    
     void showCheckpointHistory() const {
         std::cout << "\n=== Checkpoint History ===\n";
         for (size_t i = 0; i < checkpoints_.size(); ++i) {
@@ -335,7 +691,10 @@ public:
         }
         std::cout << "Current position: " << currentIndex_ 
                   << "/" << checkpoints_.size() << "\n";
-        std::cout << "Memory usage: ~" << (checkpoints_.size() * 50) << " KB\n\n";
+        std::cout << "Memory usage: ~" << std::fixed << std::setprecision(1)
+                  << residentBytes() / 1024.0 << " KB resident ("
+                  << rawBytes() / 1024.0 << " KB as full copies, "
+                  << spilledCount() << " spilled to disk)\n\n";
     }
     
     void exportCheckpoint(size_t index, const std::string& filename) const {
@@ -371,9 +730,15 @@ private:
     };
     
     // Memento as inner class for climate snapshots
+    // Grid fields are stored as compressed key frames; the calm initial
+    // wind fields, for instance, shrink to a few bytes
     class ClimateMemento {
     private:
-        ClimateState state_;
+        std::array<CompressedField, 5> fields_;  // temperature, humidity, pressure, windU, windV
+        double globalMeanTemp_;
+        double co2Concentration_;
+        double iceVolume_;
+        double seaLevel_;
         double simulationYear_;
         double timeStep_;
         int yearNumber_;
@@ -382,12 +747,37 @@ private:
         std::string timestamp_;
         
         friend class ClimateSimulation;
+        
+        static std::array<const std::vector<double>*, 5> gridFields(const ClimateState& state) {
+            return {&state.temperatureField, &state.humidityField, &state.pressureField,
+                    &state.windVelocityU, &state.windVelocityV};
+        }
+        
+        void restoreInto(ClimateState& state) const {
+            std::array<std::vector<double>*, 5> targets = {
+                &state.temperatureField, &state.humidityField, &state.pressureField,
+                &state.windVelocityU, &state.windVelocityV};
+            for (size_t f = 0; f < fields_.size(); ++f) {
+                fields_[f].decodeInto(*targets[f]);
+            }
+            state.globalMeanTemp = globalMeanTemp_;
+            state.co2Concentration = co2Concentration_;
+            state.iceVolume = iceVolume_;
+            state.seaLevel = seaLevel_;
+        }
     
     public:
         ClimateMemento(const ClimateState& state, double year, double dt, 
                       int yearNum, const std::string& scenario, double co2Rate)
-            : state_(state), simulationYear_(year), timeStep_(dt), 
+            : globalMeanTemp_(state.globalMeanTemp), co2Concentration_(state.co2Concentration),
+              iceVolume_(state.iceVolume), seaLevel_(state.seaLevel),
+              simulationYear_(year), timeStep_(dt), 
               yearNumber_(yearNum), scenario_(scenario), co2EmissionRate_(co2Rate) {
+            auto sources = gridFields(state);
+            for (size_t f = 0; f < fields_.size(); ++f) {
+                fields_[f] = CompressedField::encode(*sources[f], nullptr);
+            }
+            
             auto now = std::time(nullptr);
             std::stringstream ss;
             ss << std::put_time(std::localtime(&now), "%Y-%m-%d %H:%M:%S");
@@ -399,12 +789,19 @@ private:
             ss << "Climate checkpoint at " << timestamp_
                << "\n  Simulation year: " << std::fixed << simulationYear_
                << "\n  Scenario: " << scenario_
-               << "\n  Global temp: " << std::setprecision(2) << state_.globalMeanTemp << " K"
-               << "\n  CO₂: " << std::setprecision(1) << state_.co2Concentration << " ppm"
-               << "\n  Sea level: " << state_.seaLevel << " m";
+               << "\n  Global temp: " << std::setprecision(2) << globalMeanTemp_ << " K"
+               << "\n  CO₂: " << std::setprecision(1) << co2Concentration_ << " ppm"
+               << "\n  Sea level: " << seaLevel_ << " m"
+               << "\n  Stored: " << storedBytes() / 1024.0 << " KB";
             return ss.str();
         }
         
+        size_t storedBytes() const {
+            size_t total = 0;
+            for (const auto& field : fields_) total += field.storedBytes();
+            return total;
+        }
+        
         double getSimulationYear() const { return simulationYear_; }
         const std::string& getScenario() const { return scenario_; }
     };
@@ -519,7 +916,7 @@ public:
     }
     
     void restoreClimateCheckpoint(const Memento& checkpoint) {
-        currentState_ = checkpoint.state_;
+        checkpoint.restoreInto(currentState_);
         simulationYear_ = checkpoint.simulationYear_;
         timeStep_ = checkpoint.timeStep_;
         yearNumber_ = checkpoint.yearNumber_;
@@ -618,6 +1015,39 @@ public:
     }
 };
 
+// Incremental checkpoints under a memory budget, verified bit-for-bit
+void incrementalCheckpointExample() {
+    std::cout << "\n\n=== Incremental Checkpoints with Memory Budget ===\n";
+    
+    MolecularDynamicsSimulation mdSim(400, 20.0, 300.0);
+    // 64 KB of resident checkpoints, key frame every 4 checkpoints
+    SimulationCheckpointManager checkpointMgr(10, 64 * 1024, 4);
+    
+    std::vector<std::vector<double>> savedPositions;
+    std::vector<std::vector<double>> savedVelocities;
+    for (int c = 0; c < 8; ++c) {
+        if (c > 0) mdSim.runSteps(25);
+        savedPositions.push_back(mdSim.getPositions());
+        savedVelocities.push_back(mdSim.getVelocities());
+        checkpointMgr.createCheckpoint(mdSim, "Segment " + std::to_string(c));
+    }
+    checkpointMgr.flushSpills();
+    std::cout << "Resident: " << std::fixed << std::setprecision(1)
+              << checkpointMgr.residentBytes() / 1024.0 << " KB vs "
+              << checkpointMgr.rawBytes() / 1024.0 << " KB as full copies, "
+              << checkpointMgr.spilledCount() << " checkpoints spilled to disk\n";
+    
+    // Lazy restore: only positions are reconstructed from the spilled delta chain
+    checkpointMgr.restoreToCheckpoint(mdSim, 3, SimulationMemento::Positions);
+    bool positionsExact = mdSim.getPositions() == savedPositions[2];
+    checkpointMgr.restoreToCheckpoint(mdSim, 8);
+    bool fullExact = mdSim.getPositions() == savedPositions[7] &&
+                     mdSim.getVelocities() == savedVelocities[7];
+    std::cout << "Positions-only restore of checkpoint #3 (base chain on disk) bit-exact: "
+              << (positionsExact ? "yes" : "NO") << "\n";
+    std::cout << "Full restore of checkpoint #8 bit-exact: " << (fullExact ? "yes" : "NO") << "\n";
+}
+
 int main() {
     std::cout << "=== Molecular Dynamics Simulation with Checkpoint Recovery ===\n\n";
     
@@ -728,6 +1158,8 @@ int main() {
     scenarioMgr.exportScenario(2, "rcp85_midcentury.dat");
     scenarioMgr.exportScenario(3, "rcp26_mitigation.dat");
     
+    incrementalCheckpointExample();
+    
     std::cout << "\nMemento pattern enables robust checkpoint/restart capability\n";
     std::cout << "for long-running scientific simulations with scenario exploration!\n";
     
@@ -13,10 +13,31 @@
 #include <fstream>
 #include <chrono>
 #include <random>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+#include <array>
+#include <stdexcept>
 
 // Forward declarations
 class SimulationObserver;
 
+// Dispatch counters for one observer, as seen by the subject when a
+// snapshot is published
+struct ObserverQueueStats {
+    std::string observer;
+    std::string policy;
+    size_t depth = 0;        // Snapshots waiting in the queue
+    size_t maxDepth = 0;
+    size_t delivered = 0;
+    size_t dropped = 0;      // Evicted from a full queue
+    size_t conflated = 0;    // Replaced by a newer snapshot (latest-only)
+    size_t skipped = 0;      // Filtered out by the delivery stride
+};
+
 // Simulation data structure
 struct SimulationData {
     double currentTime;
@@ -31,6 +52,7 @@ struct SimulationData {
     std::vector<double> positions;
     double convergenceResidual;
     std::string status;
+    std::vector<ObserverQueueStats> observerQueues; // Filled for asynchronous dispatch
     
     SimulationData() : currentTime(0.0), stepNumber(0), totalEnergy(0.0),
                       kineticEnergy(0.0), potentialEnergy(0.0), temperature(0.0),
@@ -38,6 +60,61 @@ struct SimulationData {
                       status("Initializing") {}
 };
 
+// Immutable snapshot handed to asynchronous observers; it stays valid for as
+// long as an observer holds it, whatever the integrator does next
+using SimulationSnapshot = std::shared_ptr<const SimulationData>;
+
+// How often an observer wants to hear from the simulation. The delivery
+// filter applies in both notification modes; the queue bound and overflow
+// action only matter when the observer runs on its own dispatcher thread.
+struct NotificationPolicy {
+    enum class Delivery { EVERY_UPDATE, EVERY_N_STEPS, LATEST_ONLY };
+    enum class Overflow { DROP_OLDEST, BLOCK };
+    
+    Delivery delivery = Delivery::EVERY_UPDATE;
+    int stride = 1;
+    size_t capacity = 64;
+    Overflow overflow = Overflow::DROP_OLDEST;
+    
+    static NotificationPolicy everyUpdate(size_t capacity = 64,
+                                          Overflow overflow = Overflow::DROP_OLDEST) {
+        NotificationPolicy policy;
+        policy.capacity = std::max<size_t>(capacity, 1);
+        policy.overflow = overflow;
+        return policy;
+    }
+    
+    static NotificationPolicy everyNSteps(int n, size_t capacity = 64,
+                                          Overflow overflow = Overflow::DROP_OLDEST) {
+        NotificationPolicy policy = everyUpdate(capacity, overflow);
+        policy.delivery = Delivery::EVERY_N_STEPS;
+        policy.stride = std::max(n, 1);
+        return policy;
+    }
+    
+    // Conflating mailbox: the observer only ever sees the newest state
+    static NotificationPolicy latestOnly() {
+        NotificationPolicy policy;
+        policy.delivery = Delivery::LATEST_ONLY;
+        policy.capacity = 1;
+        return policy;
+    }
+    
+    bool accepts(const SimulationData& data) const {
+        return delivery != Delivery::EVERY_N_STEPS || data.stepNumber % stride == 0;
+    }
+    
+    std::string describe() const {
+        std::string text;
+        switch (delivery) {
+            case Delivery::EVERY_UPDATE: text = "every update"; break;
+            case Delivery::EVERY_N_STEPS: text = "every " + std::to_string(stride) + " steps"; break;
+            case Delivery::LATEST_ONLY: return "latest only";
+        }
+        return text + (overflow == Overflow::BLOCK ? " (blocking)" : "");
+    }
+};
+
 // Subject interface - Observable Simulation
 class SimulationSubject {
 public:
@@ -55,17 +132,178 @@ public:
     virtual void onSimulationUpdate(const SimulationData& data) = 0;
     virtual std::string getObserverName() const = 0;
     virtual bool isActive() const { return true; }
+    
+    // Asynchronous entry point; observers that want to keep a snapshot
+    // beyond the call (e.g. to hand it to another thread) override this
+    virtual void onSimulationSnapshot(const SimulationSnapshot& snapshot) {
+        onSimulationUpdate(*snapshot);
+    }
+};
+
+// Writes one line to std::cout in a single locked call. Observers may run on
+// their own dispatcher threads, so they format into a private stream rather
+// than setting manipulators on the shared one.
+class ConsoleLine {
+private:
+    std::ostringstream line_;
+    
+    static std::mutex& consoleMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+    
+public:
+    ConsoleLine() = default;
+    ConsoleLine(const ConsoleLine&) = delete;
+    ConsoleLine& operator=(const ConsoleLine&) = delete;
+    
+    ~ConsoleLine() {
+        std::lock_guard<std::mutex> lock(consoleMutex());
+        std::cout << line_.str();
+    }
+    
+    template <typename T>
+    ConsoleLine& operator<<(const T& value) {
+        line_ << value;
+        return *this;
+    }
+    
+    ConsoleLine& operator<<(std::ios_base& (*manipulator)(std::ios_base&)) {
+        line_ << manipulator;
+        return *this;
+    }
+};
+
+// Bounded snapshot queue drained by a dedicated thread, one per observer in
+// asynchronous mode. The simulation thread only ever waits here when the
+// policy asks for BLOCK on a full queue.
+class ObserverChannel {
+private:
+    std::shared_ptr<SimulationObserver> observer_;
+    NotificationPolicy policy_;
+    std::deque<SimulationSnapshot> queue_;
+    mutable std::mutex mutex_;
+    std::condition_variable ready_;
+    std::condition_variable space_;
+    std::condition_variable idle_;
+    bool stopping_ = false;
+    bool busy_ = false;
+    ObserverQueueStats stats_;
+    std::thread dispatcher_;
+    
+    void dispatchLoop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return; // Stopping and fully drained
+            }
+            SimulationSnapshot snapshot = std::move(queue_.front());
+            queue_.pop_front();
+            busy_ = true;
+            space_.notify_one();
+            lock.unlock();
+            
+            observer_->onSimulationSnapshot(snapshot);
+            snapshot.reset();
+            
+            lock.lock();
+            busy_ = false;
+            ++stats_.delivered;
+            if (queue_.empty()) {
+                idle_.notify_all();
+            }
+        }
+    }
+    
+public:
+    ObserverChannel(std::shared_ptr<SimulationObserver> observer, const NotificationPolicy& policy)
+        : observer_(std::move(observer)), policy_(policy) {
+        stats_.observer = observer_->getObserverName();
+        stats_.policy = policy_.describe();
+        dispatcher_ = std::thread(&ObserverChannel::dispatchLoop, this);
+    }
+    
+    ObserverChannel(const ObserverChannel&) = delete;
+    ObserverChannel& operator=(const ObserverChannel&) = delete;
+    
+    // Delivers whatever is still queued before the thread exits
+    ~ObserverChannel() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        ready_.notify_one();
+        dispatcher_.join();
+    }
+    
+    void publish(const SimulationSnapshot& snapshot) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (policy_.delivery == NotificationPolicy::Delivery::LATEST_ONLY) {
+            if (!queue_.empty()) {
+                queue_.back() = snapshot;
+                ++stats_.conflated;
+                return; // Dispatcher already has a wake-up pending
+            }
+        } else if (queue_.size() >= policy_.capacity) {
+            if (policy_.overflow == NotificationPolicy::Overflow::BLOCK) {
+                space_.wait(lock, [this] { return queue_.size() < policy_.capacity; });
+            } else {
+                queue_.pop_front();
+                ++stats_.dropped;
+            }
+        }
+        queue_.push_back(snapshot);
+        stats_.maxDepth = std::max(stats_.maxDepth, queue_.size());
+        lock.unlock();
+        ready_.notify_one();
+    }
+    
+    // Waits until every queued snapshot has been handled
+    void drain() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_.wait(lock, [this] { return queue_.empty() && !busy_; });
+    }
+    
+    ObserverQueueStats getStats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ObserverQueueStats stats = stats_;
+        stats.depth = queue_.size();
+        return stats;
+    }
 };
 
+enum class NotificationMode { SYNCHRONOUS, ASYNCHRONOUS };
+
 // Concrete Subject - Molecular Dynamics Simulation
 class MolecularDynamicsSimulation : public SimulationSubject {
 private:
-    std::vector<std::shared_ptr<SimulationObserver>> observers_;
+    struct ObserverSlot {
+        std::shared_ptr<SimulationObserver> observer;
+        NotificationPolicy policy;
+        std::unique_ptr<ObserverChannel> channel; // Asynchronous mode only
+        ObserverQueueStats totals;                // Synchronous and retired-channel counts
+        
+        void retireChannel() {
+            if (!channel) return;
+            channel->drain();
+            ObserverQueueStats last = channel->getStats();
+            channel.reset();
+            totals.delivered += last.delivered;
+            totals.dropped += last.dropped;
+            totals.conflated += last.conflated;
+            totals.maxDepth = std::max(totals.maxDepth, last.maxDepth);
+        }
+    };
+    
+    std::vector<ObserverSlot> observers_;
+    NotificationMode notificationMode_ = NotificationMode::SYNCHRONOUS;
     SimulationData currentData_;
     std::mt19937 rng_;
     int numParticles_;
     double timeStep_;
     double boxLength_;
+    bool verbose_ = true;
     
 public:
     MolecularDynamicsSimulation(int numParticles, double timeStep, double boxLength)
@@ -74,26 +312,107 @@ public:
     }
     
     void attachObserver(std::shared_ptr<SimulationObserver> observer) override {
-        observers_.push_back(observer);
-        std::cout << "[SIM] Attached monitor: " << observer->getObserverName() << "\n";
+        attachObserver(observer, NotificationPolicy::everyUpdate());
     }
     
+    void attachObserver(std::shared_ptr<SimulationObserver> observer, const NotificationPolicy& policy) {
+        ObserverSlot slot;
+        slot.observer = observer;
+        slot.policy = policy;
+        slot.totals.observer = observer->getObserverName();
+        slot.totals.policy = policy.describe();
+        if (notificationMode_ == NotificationMode::ASYNCHRONOUS) {
+            slot.channel.reset(new ObserverChannel(observer, policy));
+        }
+        observers_.push_back(std::move(slot));
+        if (verbose_) {
+            std::cout << "[SIM] Attached monitor: " << observer->getObserverName() << "\n";
+        }
+    }
+    
+    // Drains the observer's queue before letting go of it
     void detachObserver(std::shared_ptr<SimulationObserver> observer) override {
-        auto it = std::find(observers_.begin(), observers_.end(), observer);
+        auto it = std::find_if(observers_.begin(), observers_.end(),
+                               [&](const ObserverSlot& slot) { return slot.observer == observer; });
         if (it != observers_.end()) {
             observers_.erase(it);
-            std::cout << "[SIM] Detached monitor: " << observer->getObserverName() << "\n";
+            if (verbose_) {
+                std::cout << "[SIM] Detached monitor: " << observer->getObserverName() << "\n";
+            }
         }
     }
     
     void notifyObservers() override {
-        for (auto& observer : observers_) {
-            if (observer->isActive()) {
-                observer->onSimulationUpdate(currentData_);
+        if (notificationMode_ == NotificationMode::SYNCHRONOUS) {
+            for (auto& slot : observers_) {
+                if (!slot.observer->isActive()) continue;
+                if (!slot.policy.accepts(currentData_)) {
+                    ++slot.totals.skipped;
+                    continue;
+                }
+                slot.observer->onSimulationUpdate(currentData_);
+                ++slot.totals.delivered;
+            }
+            return;
+        }
+        
+        // One immutable copy per notification, shared by every queue
+        std::shared_ptr<SimulationData> snapshot = std::make_shared<SimulationData>(currentData_);
+        snapshot->observerQueues = getDispatchStats();
+        SimulationSnapshot published = std::move(snapshot);
+        for (auto& slot : observers_) {
+            if (!slot.observer->isActive()) continue;
+            if (!slot.policy.accepts(currentData_)) {
+                ++slot.totals.skipped;
+                continue;
+            }
+            slot.channel->publish(published);
+        }
+    }
+    
+    // Switching to synchronous mode drains and joins every dispatcher, so
+    // observers are never called from two threads at once
+    void setNotificationMode(NotificationMode mode) {
+        if (mode == notificationMode_) return;
+        notificationMode_ = mode;
+        for (auto& slot : observers_) {
+            if (mode == NotificationMode::ASYNCHRONOUS) {
+                slot.channel.reset(new ObserverChannel(slot.observer, slot.policy));
+            } else {
+                slot.retireChannel();
             }
         }
     }
     
+    NotificationMode getNotificationMode() const { return notificationMode_; }
+    
+    // Blocks until every observer has handled all published snapshots
+    void flushObservers() {
+        for (auto& slot : observers_) {
+            if (slot.channel) slot.channel->drain();
+        }
+    }
+    
+    std::vector<ObserverQueueStats> getDispatchStats() const {
+        std::vector<ObserverQueueStats> stats;
+        stats.reserve(observers_.size());
+        for (const auto& slot : observers_) {
+            ObserverQueueStats entry = slot.totals;
+            if (slot.channel) {
+                ObserverQueueStats live = slot.channel->getStats();
+                entry.depth = live.depth;
+                entry.maxDepth = std::max(entry.maxDepth, live.maxDepth);
+                entry.delivered += live.delivered;
+                entry.dropped += live.dropped;
+                entry.conflated += live.conflated;
+            }
+            stats.push_back(entry);
+        }
+        return stats;
+    }
+    
+    void setVerbose(bool verbose) { verbose_ = verbose; }
+    
     const SimulationData& getSimulationData() const override {
         return currentData_;
     }
@@ -136,7 +455,9 @@ public:
     }
     
     void runSteps(int numSteps) {
-        std::cout << "\n[SIM] Running " << numSteps << " MD steps...\n";
+        if (verbose_) {
+            std::cout << "\n[SIM] Running " << numSteps << " MD steps...\n";
+        }
         for (int i = 0; i < numSteps; ++i) {
             runTimeStep();
             
@@ -201,8 +522,8 @@ public:
         if (!initialized_ && data.stepNumber > 0) {
             initialEnergy_ = data.totalEnergy;
             initialized_ = true;
-            std::cout << "[" << name_ << "] Initial energy: " 
-                      << std::scientific << initialEnergy_ << " J\n";
+            ConsoleLine() << "[" << name_ << "] Initial energy: " 
+                          << std::scientific << initialEnergy_ << " J\n";
             return;
         }
         
@@ -211,9 +532,9 @@ public:
             double relativeDrift = energyDrift / std::abs(initialEnergy_);
             
             if (relativeDrift > tolerance_) {
-                std::cout << "[" << name_ << "] ⚠️  ENERGY DRIFT WARNING: "
-                          << std::scientific << std::setprecision(3) 
-                          << relativeDrift << " (step " << data.stepNumber << ")\n";
+                ConsoleLine() << "[" << name_ << "] ⚠️  ENERGY DRIFT WARNING: "
+                              << std::scientific << std::setprecision(3) 
+                              << relativeDrift << " (step " << data.stepNumber << ")\n";
             }
         }
     }
@@ -227,10 +548,16 @@ private:
     std::chrono::steady_clock::time_point lastUpdateTime_;
     int lastStep_ = 0;
     bool initialized_ = false;
+    std::vector<ObserverQueueStats> dispatch_; // Latest queue counters from the subject
+    int dispatchStep_ = 0;
     
 public:
     void onSimulationUpdate(const SimulationData& data) override {
         auto currentTime = std::chrono::steady_clock::now();
+        if (!data.observerQueues.empty()) {
+            dispatch_ = data.observerQueues;
+            dispatchStep_ = data.stepNumber;
+        }
         
         if (!initialized_) {
             lastUpdateTime_ = currentTime;
@@ -245,15 +572,42 @@ public:
         if (elapsed.count() > 1000 && stepsDone > 0) { // Report every second
             double stepsPerSecond = (double)stepsDone / (elapsed.count() / 1000.0);
             
-            std::cout << "[" << name_ << "] Performance: " 
-                      << std::fixed << std::setprecision(1) << stepsPerSecond 
-                      << " steps/sec (step " << data.stepNumber << ")\n";
+            ConsoleLine line;
+            line << "[" << name_ << "] Performance: " 
+                 << std::fixed << std::setprecision(1) << stepsPerSecond 
+                 << " steps/sec (step " << data.stepNumber << ")";
+            if (!dispatch_.empty()) {
+                size_t queued = 0, dropped = 0;
+                for (const auto& queue : dispatch_) {
+                    queued += queue.depth;
+                    dropped += queue.dropped;
+                }
+                line << ", " << queued << " queued, " << dropped << " dropped";
+            }
+            line << "\n";
             
             lastUpdateTime_ = currentTime;
             lastStep_ = data.stepNumber;
         }
     }
     
+    // Queue depth and loss per observer, as of the last snapshot received
+    void printDispatchReport() const {
+        if (dispatch_.empty()) return;
+        ConsoleLine line;
+        line << "[" << name_ << "] Observer queues at step " << dispatchStep_ << ":\n";
+        line << "  " << std::left << std::setw(24) << "Observer" << std::setw(26) << "Policy"
+             << std::right << std::setw(7) << "Queued" << std::setw(7) << "Peak"
+             << std::setw(11) << "Delivered" << std::setw(9) << "Dropped"
+             << std::setw(11) << "Conflated" << std::setw(9) << "Skipped" << "\n";
+        for (const auto& queue : dispatch_) {
+            line << "  " << std::left << std::setw(24) << queue.observer << std::setw(26) << queue.policy
+                 << std::right << std::setw(7) << queue.depth << std::setw(7) << queue.maxDepth
+                 << std::setw(11) << queue.delivered << std::setw(9) << queue.dropped
+                 << std::setw(11) << queue.conflated << std::setw(9) << queue.skipped << "\n";
+        }
+    }
+    
     std::string getObserverName() const override { return name_; }
 };
 
@@ -277,10 +631,10 @@ public:
             avgTemp /= temperatureHistory_.size();
             avgPressure /= pressureHistory_.size();
             
-            std::cout << "[" << name_ << "] Step " << data.stepNumber
-                      << ": T=" << std::fixed << std::setprecision(2) << data.temperature << " K"
-                      << ", P=" << std::scientific << data.pressure << " Pa"
-                      << " (avg: T=" << std::fixed << avgTemp << " K)\n";
+            ConsoleLine() << "[" << name_ << "] Step " << data.stepNumber
+                          << ": T=" << std::fixed << std::setprecision(2) << data.temperature << " K"
+                          << ", P=" << std::scientific << data.pressure << " Pa"
+                          << " (avg: T=" << std::fixed << avgTemp << " K)\n";
         }
     }
     
@@ -309,7 +663,7 @@ public:
             if (file_.is_open()) {
                 fileOpen_ = true;
                 file_ << "# Step Time(s) TotalEnergy(J) KineticEnergy(J) PotentialEnergy(J) Temperature(K) Pressure(Pa)\n";
-                std::cout << "[" << name_ << "] Started recording to " << filename_ << "\n";
+                ConsoleLine() << "[" << name_ << "] Started recording to " << filename_ << "\n";
             }
         }
         
@@ -328,6 +682,66 @@ public:
     std::string getObserverName() const override { return name_; }
 };
 
+// Pair-distance histogram over a sample of particles - the kind of analysis
+// that costs far more per frame than the integrator step that produced it
+class TrajectoryAnalyzer : public SimulationObserver {
+private:
+    std::string name_;
+    int sampleSize_;
+    std::vector<double> histogram_;
+    int framesAnalyzed_ = 0;
+    int lastStep_ = -1;
+    double lastMeanRdf_ = 0.0;
+    
+public:
+    TrajectoryAnalyzer(const std::string& name, int sampleSize, int bins = 50)
+        : name_(name), sampleSize_(sampleSize), histogram_(bins) {}
+    
+    void onSimulationUpdate(const SimulationData& data) override {
+        const double box = std::cbrt(data.volume);
+        const double rMax = 0.5 * box;
+        const int n = std::min<int>(sampleSize_, static_cast<int>(data.positions.size() / 3));
+        const int bins = static_cast<int>(histogram_.size());
+        if (n < 2 || box <= 0.0) return;
+        
+        std::fill(histogram_.begin(), histogram_.end(), 0.0);
+        const double* p = data.positions.data();
+        for (int i = 0; i < n; ++i) {
+            for (int j = i + 1; j < n; ++j) {
+                // Minimum-image distance under periodic boundaries
+                double dx = p[3*i] - p[3*j];
+                double dy = p[3*i+1] - p[3*j+1];
+                double dz = p[3*i+2] - p[3*j+2];
+                dx -= box * std::round(dx / box);
+                dy -= box * std::round(dy / box);
+                dz -= box * std::round(dz / box);
+                double r = std::sqrt(dx*dx + dy*dy + dz*dz);
+                if (r < rMax) {
+                    histogram_[static_cast<int>(r / rMax * bins)] += 1.0;
+                }
+            }
+        }
+        
+        // Normalise by the ideal-gas shell population to get g(r)
+        const double density = n / data.volume;
+        const double pi = 3.14159265358979323846;
+        double sum = 0.0;
+        for (int b = 0; b < bins; ++b) {
+            double r0 = rMax * b / bins, r1 = rMax * (b + 1) / bins;
+            double shell = 4.0 / 3.0 * pi * (r1*r1*r1 - r0*r0*r0);
+            sum += histogram_[b] / (0.5 * n * density * shell);
+        }
+        lastMeanRdf_ = sum / bins;
+        lastStep_ = data.stepNumber;
+        ++framesAnalyzed_;
+    }
+    
+    int getFramesAnalyzed() const { return framesAnalyzed_; }
+    int getLastStep() const { return lastStep_; }
+    double getLastMeanRdf() const { return lastMeanRdf_; }
+    std::string getObserverName() const override { return name_; }
+};
+
 // Climate Model Monitoring
 struct ClimateData {
     double simulationYear;
@@ -513,6 +927,93 @@ public:
     static const std::string ERROR_DETECTED;
     static const std::string CHECKPOINT_CREATED;
     static const std::string SIMULATION_COMPLETED;
+    
+    // Dense id for a type name, so subscriptions can be indexed by array
+    // slot instead of hashing the string on every publish. The built-in
+    // types get ids 0-5 in declaration order. Known names are looked up
+    // without a lock; a new name is appended under one. There is no limit
+    // on the number of types: names live in fixed-size chunks that are
+    // linked on as the registry fills and never move, so a lock-free reader
+    // always sees a stable entry.
+    static int intern(const std::string& type) {
+        Registry& r = registry();
+        int id = lookup(r, type, r.count.load(std::memory_order_acquire));
+        if (id >= 0) return id;
+        
+        std::lock_guard<std::mutex> lock(r.mutex);
+        int count = r.count.load(std::memory_order_relaxed);
+        id = lookup(r, type, count);
+        if (id >= 0) return id;
+        if (count > 0 && count % kChunkSize == 0) {
+            Chunk* chunk = new Chunk();
+            r.tail->next.store(chunk, std::memory_order_release);
+            r.tail = chunk;
+        }
+        r.tail->names[count % kChunkSize] = type;
+        r.count.store(count + 1, std::memory_order_release);
+        return count;
+    }
+    
+    // -1 if the name has never been interned
+    static int find(const std::string& type) {
+        Registry& r = registry();
+        return lookup(r, type, r.count.load(std::memory_order_acquire));
+    }
+    
+    static const std::string& name(int id) {
+        const Chunk* chunk = &registry().head;
+        for (int skip = id / kChunkSize; skip > 0; --skip) {
+            chunk = chunk->next.load(std::memory_order_acquire);
+        }
+        return chunk->names[id % kChunkSize];
+    }
+    
+private:
+    static constexpr int kChunkSize = 64;
+    
+    struct Chunk {
+        std::array<std::string, kChunkSize> names;  // Entries below count are immutable
+        std::atomic<Chunk*> next{nullptr};
+    };
+    
+    struct Registry {
+        Chunk head;
+        Chunk* tail = &head;  // Guarded by mutex
+        std::atomic<int> count;
+        std::mutex mutex;
+        
+        Registry() : count(0) {
+            const std::string* builtIn[] = {&SIMULATION_STARTED, &STEP_COMPLETED, &CONVERGENCE_ACHIEVED,
+                                            &ERROR_DETECTED, &CHECKPOINT_CREATED, &SIMULATION_COMPLETED};
+            for (const std::string* type : builtIn) {
+                head.names[count.load(std::memory_order_relaxed)] = *type;
+                count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+        }
+        
+        ~Registry() {
+            Chunk* chunk = head.next.load(std::memory_order_relaxed);
+            while (chunk) {
+                Chunk* next = chunk->next.load(std::memory_order_relaxed);
+                delete chunk;
+                chunk = next;
+            }
+        }
+    };
+    
+    static Registry& registry() {
+        static Registry instance;
+        return instance;
+    }
+    
+    static int lookup(const Registry& r, const std::string& type, int count) {
+        const Chunk* chunk = &r.head;
+        for (int i = 0; i < count; ++i) {
+            if (i > 0 && i % kChunkSize == 0) chunk = chunk->next.load(std::memory_order_acquire);
+            if (chunk->names[i % kChunkSize] == type) return i;
+        }
+        return -1;
+    }
 };
 
 const std::string SimulationEventType::SIMULATION_STARTED = "simulation_started";
@@ -525,11 +1026,14 @@ const std::string SimulationEventType::SIMULATION_COMPLETED = "simulation_comple
 class SimulationEvent {
 private:
     std::string type_;
+    int typeId_;
     std::unordered_map<std::string, std::string> metadata_;
     std::chrono::system_clock::time_point timestamp_;
     
 public:
-    SimulationEvent(const std::string& type) : type_(type), timestamp_(std::chrono::system_clock::now()) {}
+    SimulationEvent(const std::string& type)
+        : type_(type), typeId_(SimulationEventType::intern(type)),
+          timestamp_(std::chrono::system_clock::now()) {}
     
     void setMetadata(const std::string& key, const std::string& value) {
         metadata_[key] = value;
@@ -539,7 +1043,8 @@ public:
         metadata_[key] = std::to_string(value);
     }
     
-    std::string getType() const { return type_; }
+    const std::string& getType() const { return type_; }
+    int getTypeId() const { return typeId_; }
     
     std::string getMetadata(const std::string& key) const {
         auto it = metadata_.find(key);
@@ -554,37 +1059,185 @@ public:
     virtual ~SimulationEventObserver() = default;
     virtual void onSimulationEvent(const SimulationEvent& event) = 0;
     virtual std::string getObserverName() const = 0;
+    
+    // Observers that return true are handed runs of consecutive same-type
+    // events as one array instead of one call per event
+    virtual bool acceptsBatches() const { return false; }
+    virtual void onSimulationEvents(const SimulationEvent* events, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            onSimulationEvent(events[i]);
+        }
+    }
 };
 
+// Subscriptions are indexed by event type id and kept in an immutable
+// table. Publishing reads the current table through an atomic pointer and
+// takes no lock. Subscribe and unsubscribe copy the table, swap the pointer
+// and retire the old copy tagged with the current epoch. A publisher
+// registers in the counter for the epoch it started in; the epoch only
+// advances once the previous epoch's counter drains, so a copy retired in
+// epoch R is freed once the epoch reaches R + 2 (a grace period in the RCU
+// sense). Overlapping publishers never pin retired copies. Because of the
+// grace period, a publisher that loaded the table just before an
+// unsubscribe may still deliver one more event to the removed observer.
 class HpcEventManager {
 private:
-    std::unordered_map<std::string, std::vector<std::shared_ptr<SimulationEventObserver>>> eventListeners_;
+    struct Subscriber {
+        std::shared_ptr<SimulationEventObserver> observer;
+        bool batched;
+    };
+    
+    struct SubscriptionTable {
+        std::vector<std::vector<Subscriber>> byType;
+    };
+    
+    struct RetiredTable {
+        std::unique_ptr<const SubscriptionTable> table;
+        uint64_t epoch;
+    };
+    
+    // Marks a publisher as reading the table for the duration of a call
+    class ReadSection {
+        const HpcEventManager& manager_;
+        uint64_t epoch_;
+    public:
+        explicit ReadSection(const HpcEventManager& manager) : manager_(manager) {
+            // Re-check after registering, so the counter always matches an
+            // epoch that was current while this publisher was counted in it
+            while (true) {
+                epoch_ = manager_.epoch_.load();
+                manager_.activePublishers_[epoch_ & 1].fetch_add(1);
+                if (manager_.epoch_.load() == epoch_) break;
+                manager_.activePublishers_[epoch_ & 1].fetch_sub(1);
+            }
+        }
+        ~ReadSection() { manager_.activePublishers_[epoch_ & 1].fetch_sub(1); }
+    };
+    
+    std::atomic<const SubscriptionTable*> table_;
+    mutable std::atomic<uint64_t> epoch_{0};
+    mutable std::atomic<int> activePublishers_[2] = {};
+    std::mutex writerMutex_;
+    std::deque<RetiredTable> retired_;
+    
+    // Moves to the next epoch if no publisher is left in the one before the
+    // current epoch, whose counter the next epoch reuses
+    bool tryAdvanceEpoch() {
+        const uint64_t epoch = epoch_.load();
+        if (activePublishers_[(epoch + 1) & 1].load() != 0) return false;
+        epoch_.store(epoch + 1);
+        return true;
+    }
+    
+    template <typename Mutation>
+    bool updateTable(Mutation mutate) {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        std::unique_ptr<SubscriptionTable> next(new SubscriptionTable(*table_.load()));
+        if (!mutate(*next)) return false;
+        retired_.push_back({std::unique_ptr<const SubscriptionTable>(table_.exchange(next.release())),
+                            epoch_.load()});
+        // Two advances complete the grace period for everything retired so far
+        if (tryAdvanceEpoch()) tryAdvanceEpoch();
+        const uint64_t epoch = epoch_.load();
+        while (!retired_.empty() && retired_.front().epoch + 2 <= epoch) {
+            retired_.pop_front();
+        }
+        return true;
+    }
+    
+    static void deliver(const Subscriber& subscriber, const SimulationEvent* events, size_t count) {
+        if (subscriber.batched) {
+            subscriber.observer->onSimulationEvents(events, count);
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                subscriber.observer->onSimulationEvent(events[i]);
+            }
+        }
+    }
     
 public:
+    HpcEventManager() : table_(new SubscriptionTable()) {}
+    
+    HpcEventManager(const HpcEventManager&) = delete;
+    HpcEventManager& operator=(const HpcEventManager&) = delete;
+    
+    // Publishers must have finished before the manager goes away
+    ~HpcEventManager() {
+        delete table_.load();
+    }
+    
     void subscribe(const std::string& eventType, std::shared_ptr<SimulationEventObserver> observer) {
-        eventListeners_[eventType].push_back(observer);
+        const int typeId = SimulationEventType::intern(eventType);
+        const bool batched = observer->acceptsBatches();
+        updateTable([&](SubscriptionTable& table) {
+            if (static_cast<int>(table.byType.size()) <= typeId) {
+                table.byType.resize(typeId + 1);
+            }
+            table.byType[typeId].push_back(Subscriber{observer, batched});
+            return true;
+        });
         std::cout << "[HPC-EVENTS] Subscribed " << observer->getObserverName() 
                   << " to " << eventType << "\n";
     }
     
     void unsubscribe(const std::string& eventType, std::shared_ptr<SimulationEventObserver> observer) {
-        auto& list = eventListeners_[eventType];
-        auto it = std::find(list.begin(), list.end(), observer);
-        if (it != list.end()) {
+        const int typeId = SimulationEventType::find(eventType);
+        if (typeId < 0) return;
+        bool removed = updateTable([&](SubscriptionTable& table) {
+            if (static_cast<int>(table.byType.size()) <= typeId) return false;
+            auto& list = table.byType[typeId];
+            auto it = std::find_if(list.begin(), list.end(),
+                                   [&](const Subscriber& s) { return s.observer == observer; });
+            if (it == list.end()) return false;
             list.erase(it);
+            return true;
+        });
+        if (removed) {
             std::cout << "[HPC-EVENTS] Unsubscribed " << observer->getObserverName() 
                       << " from " << eventType << "\n";
         }
     }
     
     void publishEvent(const SimulationEvent& event) {
-        auto it = eventListeners_.find(event.getType());
-        if (it != eventListeners_.end()) {
-            for (auto& observer : it->second) {
-                observer->onSimulationEvent(event);
+        ReadSection section(*this);
+        const SubscriptionTable* table = table_.load();
+        const size_t typeId = static_cast<size_t>(event.getTypeId());
+        if (typeId >= table->byType.size()) return;
+        for (const auto& subscriber : table->byType[typeId]) {
+            deliver(subscriber, &event, 1);
+        }
+    }
+    
+    // Splits the array into runs of one event type; each subscriber of that
+    // type receives a run as a single array (batched) or event by event
+    void publishEvents(const SimulationEvent* events, size_t count) {
+        ReadSection section(*this);
+        const SubscriptionTable* table = table_.load();
+        size_t begin = 0;
+        while (begin < count) {
+            const int typeId = events[begin].getTypeId();
+            size_t end = begin + 1;
+            while (end < count && events[end].getTypeId() == typeId) ++end;
+            if (static_cast<size_t>(typeId) < table->byType.size()) {
+                for (const auto& subscriber : table->byType[typeId]) {
+                    deliver(subscriber, events + begin, end - begin);
+                }
             }
+            begin = end;
         }
     }
+    
+    void publishEvents(const std::vector<SimulationEvent>& events) {
+        publishEvents(events.data(), events.size());
+    }
+    
+    size_t getSubscriberCount(const std::string& eventType) const {
+        const int typeId = SimulationEventType::find(eventType);
+        ReadSection section(*this);
+        const SubscriptionTable* table = table_.load();
+        if (typeId < 0 || static_cast<size_t>(typeId) >= table->byType.size()) return 0;
+        return table->byType[typeId].size();
+    }
 };
 
 class HpcLogger : public SimulationEventObserver {
@@ -688,6 +1341,209 @@ public:
     std::string getObserverName() const override { return name_; }
 };
 
+// Counts the events of one type it sees. In broadcast mode it is subscribed
+// to everything and filters itself, the way the HPC observers above do.
+class EventCounter : public SimulationEventObserver {
+private:
+    std::string name_;
+    std::string interest_;
+    bool batched_;
+    std::atomic<long> count_;
+    
+public:
+    EventCounter(const std::string& name, const std::string& interest, bool batched)
+        : name_(name), interest_(interest), batched_(batched), count_(0) {}
+    
+    void onSimulationEvent(const SimulationEvent& event) override {
+        if (event.getType() == interest_) {
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    
+    // Runs only ever hold the subscribed type
+    void onSimulationEvents(const SimulationEvent*, size_t count) override {
+        count_.fetch_add(static_cast<long>(count), std::memory_order_relaxed);
+    }
+    
+    bool acceptsBatches() const override { return batched_; }
+    long getCount() const { return count_.load(); }
+    std::string getObserverName() const override { return name_; }
+};
+
+// Event stream shaped like cluster telemetry: long runs of step reports
+// broken up by the occasional other event
+void eventIndexExample() {
+    std::cout << "\n\n=== Indexed, Lock-Free Event Dispatch ===\n";
+    const std::vector<std::string> types = {
+        SimulationEventType::SIMULATION_STARTED, SimulationEventType::STEP_COMPLETED,
+        SimulationEventType::CONVERGENCE_ACHIEVED, SimulationEventType::ERROR_DETECTED,
+        SimulationEventType::CHECKPOINT_CREATED, SimulationEventType::SIMULATION_COMPLETED};
+    const size_t numEvents = 1000000;
+    const int countersPerType = 2;
+    
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> otherType(0, static_cast<int>(types.size()) - 1);
+    std::vector<SimulationEvent> stream;
+    stream.reserve(numEvents);
+    std::vector<long> expected(types.size(), 0);
+    while (stream.size() < numEvents) {
+        int type = (stream.size() % 64 == 63) ? otherType(rng) : 1;
+        stream.emplace_back(types[type]);
+        ++expected[type];
+    }
+    
+    // Broadcast: every counter hears every event and filters by name;
+    // indexed: counters only subscribe to their own type
+    auto runCase = [&](const char* label, bool broadcast, bool batched) {
+        std::streambuf* saved = std::cout.rdbuf(nullptr); // Silence subscribe logging
+        HpcEventManager manager;
+        std::vector<std::shared_ptr<EventCounter>> counters;
+        for (size_t t = 0; t < types.size(); ++t) {
+            for (int c = 0; c < countersPerType; ++c) {
+                auto counter = std::make_shared<EventCounter>("counter", types[t], batched);
+                counters.push_back(counter);
+                if (broadcast) {
+                    for (const auto& type : types) manager.subscribe(type, counter);
+                } else {
+                    manager.subscribe(types[t], counter);
+                }
+            }
+        }
+        std::cout.rdbuf(saved);
+        
+        auto start = std::chrono::steady_clock::now();
+        if (batched) {
+            manager.publishEvents(stream);
+        } else {
+            for (const auto& event : stream) manager.publishEvent(event);
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        
+        bool exact = true;
+        for (size_t i = 0; i < counters.size(); ++i) {
+            exact = exact && counters[i]->getCount() == expected[i / countersPerType];
+        }
+        std::cout << "  " << std::left << std::setw(30) << label << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(8) << ms << " ms  "
+                  << std::setw(7) << numEvents / ms / 1000.0 << " M events/s  counts "
+                  << (exact ? "exact" : "WRONG") << "\n";
+        return ms;
+    };
+    
+    std::cout << numEvents << " events, " << types.size() * countersPerType << " observers ("
+              << countersPerType << " per event type):\n";
+    double broadcastMs = runCase("broadcast + observer filter", true, false);
+    double indexedMs = runCase("indexed, per event", false, false);
+    double batchedMs = runCase("indexed, batched runs", false, true);
+    std::cout << "  Indexing: " << std::setprecision(1) << broadcastMs / indexedMs
+              << "x, batching on top: " << indexedMs / batchedMs << "x\n";
+    
+    // Publishers keep going while another thread churns the subscription list
+    const int publishers = 3;
+    const size_t perPublisher = 200000;
+    HpcEventManager manager;
+    std::streambuf* saved = std::cout.rdbuf(nullptr);
+    auto steady = std::make_shared<EventCounter>("steady", SimulationEventType::STEP_COMPLETED, false);
+    auto transient = std::make_shared<EventCounter>("transient", SimulationEventType::STEP_COMPLETED, true);
+    manager.subscribe(SimulationEventType::STEP_COMPLETED, steady);
+    
+    std::atomic<bool> done(false);
+    int churns = 0;
+    std::thread churn([&] {
+        while (!done.load()) {
+            manager.subscribe(SimulationEventType::STEP_COMPLETED, transient);
+            manager.unsubscribe(SimulationEventType::STEP_COMPLETED, transient);
+            ++churns;
+            std::this_thread::yield();
+        }
+    });
+    std::vector<std::thread> workers;
+    SimulationEvent step(SimulationEventType::STEP_COMPLETED);
+    for (int p = 0; p < publishers; ++p) {
+        workers.emplace_back([&] {
+            for (size_t i = 0; i < perPublisher; ++i) manager.publishEvent(step);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    done.store(true);
+    churn.join();
+    std::cout.rdbuf(saved);
+    
+    std::cout << "Concurrent publish: " << publishers << " threads x " << perPublisher
+              << " events during " << (churns > 0 ? "ongoing" : "no") << " subscribe/unsubscribe churn, "
+              << "steady observer saw " << steady->getCount() << " of " << publishers * perPublisher
+              << (steady->getCount() == static_cast<long>(publishers * perPublisher) ? " (no loss)" : " (LOST EVENTS)")
+              << "\n";
+    
+    // The type registry grows in chunks, so well over one chunk of custom
+    // types intern to stable ids
+    const int customTypes = 200;
+    bool roundTrip = true;
+    for (int i = 0; i < customTypes; ++i) {
+        std::string type = "custom_event_" + std::to_string(i);
+        int id = SimulationEventType::intern(type);
+        roundTrip = roundTrip && SimulationEventType::name(id) == type && SimulationEventType::find(type) == id;
+    }
+    std::cout << "Interned " << customTypes << " custom event types: ids "
+              << (roundTrip ? "round-trip" : "WRONG") << "\n";
+    std::cout.unsetf(std::ios_base::floatfield);
+    std::cout << std::setprecision(6);
+}
+
+// Runs the same MD job with a deliberately slow analysis attached, once with
+// every observer called inline and once with per-observer dispatch threads
+void asyncObserverExample() {
+    std::cout << "\n\n=== Asynchronous Observer Dispatch ===\n";
+    const int particles = 2000;
+    const int steps = 100;
+    
+    auto runJob = [&](NotificationMode mode) {
+        MolecularDynamicsSimulation simulation(particles, 1e-15, 10.0);
+        simulation.setVerbose(false);
+        simulation.setNotificationMode(mode);
+        
+        auto rdf = std::make_shared<TrajectoryAnalyzer>("RDF Analyzer", 400);
+        auto rdfTrace = std::make_shared<TrajectoryAnalyzer>("RDF Trace (bounded)", 400);
+        auto recorder = std::make_shared<DataRecorder>("md_async.dat");
+        auto monitor = std::make_shared<PerformanceMonitor>();
+        simulation.attachObserver(rdf, NotificationPolicy::latestOnly());
+        simulation.attachObserver(rdfTrace, NotificationPolicy::everyUpdate(8));
+        simulation.attachObserver(recorder, NotificationPolicy::everyNSteps(
+            5, 16, NotificationPolicy::Overflow::BLOCK));
+        simulation.attachObserver(monitor, NotificationPolicy::latestOnly());
+        
+        auto start = std::chrono::steady_clock::now();
+        simulation.runSteps(steps);
+        auto integrated = std::chrono::steady_clock::now();
+        simulation.flushObservers();
+        auto drained = std::chrono::steady_clock::now();
+        
+        double integrateMs = std::chrono::duration<double, std::milli>(integrated - start).count();
+        double drainMs = std::chrono::duration<double, std::milli>(drained - integrated).count();
+        std::cout << (mode == NotificationMode::SYNCHRONOUS ? "Synchronous:  " : "Asynchronous: ")
+                  << steps << " steps integrated in " << std::fixed << std::setprecision(1)
+                  << integrateMs << " ms, observers idle " << drainMs << " ms later\n";
+        std::cout << "  RDF Analyzer: " << rdf->getFramesAnalyzed() << " frames, last at step "
+                  << rdf->getLastStep() << ", <g(r)> = " << std::setprecision(3)
+                  << rdf->getLastMeanRdf() << "\n";
+        std::cout << "  RDF Trace:    " << rdfTrace->getFramesAnalyzed() << " frames, last at step "
+                  << rdfTrace->getLastStep() << "\n";
+        if (mode == NotificationMode::ASYNCHRONOUS) {
+            monitor->printDispatchReport();
+        }
+        std::cout.unsetf(std::ios_base::floatfield);
+        std::cout << std::setprecision(6);
+        return integrateMs;
+    };
+    
+    double syncMs = runJob(NotificationMode::SYNCHRONOUS);
+    double asyncMs = runJob(NotificationMode::ASYNCHRONOUS);
+    std::cout << "Integrator wall time reduced " << std::fixed << std::setprecision(1)
+              << syncMs / asyncMs << "x by taking observers off the simulation thread\n";
+    std::cout.unsetf(std::ios_base::floatfield);
+    std::cout << std::setprecision(6);
+}
+
 int main() {
     std::cout << "=== Scientific Simulation Monitoring System ===\n\n";
     
@@ -717,6 +1573,8 @@ int main() {
     // Continue simulation
     mdSimulation->runSteps(30);
     
+    asyncObserverExample();
+    
     // Climate Simulation Example
     std::cout << "\n\n=== Climate Simulation Monitoring ===\n";
     
@@ -796,6 +1654,8 @@ int main() {
     completionEvent.setMetadata("walltime", "04:32:18");
     eventManager.publishEvent(completionEvent);
     
+    eventIndexExample();
+    
     std::cout << "\nObserver pattern enables comprehensive real-time monitoring\n";
     std::cout << "of scientific simulations with automated analysis and alerts!\n";
     
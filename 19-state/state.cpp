@@ -9,6 +9,15 @@
 #include <cmath>
 #include <random>
 #include <iomanip>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <exception>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdio>
 
 // Forward declarations
 class IterativeSolver;
@@ -353,6 +362,229 @@ void FailedState::terminate(IterativeSolver* solver) {
     std::cout << "[FAILED] Solver terminated due to failure\n";
 }
 
+// Counter-based random streams (Philox4x32-10, Salmon et al., SC'11).
+// Output is a pure function of (key, counter), so stream s, block b gives
+// the same numbers on any thread in any order: there is no generator state
+// to hand between workers and nothing to lock.
+class PhiloxStream {
+private:
+    uint32_t key_[2];
+    uint32_t counter_[4];  // {block lo, block hi, stream lo, stream hi}
+    uint32_t output_[4];
+    int used_ = 4;
+    
+    static void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        uint64_t product = static_cast<uint64_t>(a) * b;
+        hi = static_cast<uint32_t>(product >> 32);
+        lo = static_cast<uint32_t>(product);
+    }
+    
+    void generateBlock() {
+        uint32_t c[4] = {counter_[0], counter_[1], counter_[2], counter_[3]};
+        uint32_t k[2] = {key_[0], key_[1]};
+        for (int round = 0; round < 10; ++round) {
+            uint32_t hi0, lo0, hi1, lo1;
+            mulhilo(0xD2511F53u, c[0], hi0, lo0);
+            mulhilo(0xCD9E8D57u, c[2], hi1, lo1);
+            uint32_t next[4] = {hi1 ^ c[1] ^ k[0], lo1, hi0 ^ c[3] ^ k[1], lo0};
+            std::copy(next, next + 4, c);
+            k[0] += 0x9E3779B9u;
+            k[1] += 0xBB67AE85u;
+        }
+        std::copy(c, c + 4, output_);
+        if (++counter_[0] == 0) ++counter_[1];
+        used_ = 0;
+    }
+    
+public:
+    PhiloxStream(uint64_t seed, uint64_t stream) {
+        key_[0] = static_cast<uint32_t>(seed);
+        key_[1] = static_cast<uint32_t>(seed >> 32);
+        counter_[0] = counter_[1] = 0;
+        counter_[2] = static_cast<uint32_t>(stream);
+        counter_[3] = static_cast<uint32_t>(stream >> 32);
+    }
+    
+    uint32_t next32() {
+        if (used_ == 4) generateBlock();
+        return output_[used_++];
+    }
+    
+    // Uniform on [0, 1) with 53 random bits
+    double uniform() {
+        uint32_t a = next32() >> 5, b = next32() >> 6;
+        return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+    }
+};
+
+// Running mean/variance (Welford), mergeable in any grouping with Chan's
+// pairwise update so workers can accumulate independently
+struct SampleAccumulator {
+    size_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;
+    
+    void add(double x) {
+        ++count;
+        double delta = x - mean;
+        mean += delta / count;
+        m2 += delta * (x - mean);
+    }
+    
+    void merge(const SampleAccumulator& other) {
+        if (other.count == 0) return;
+        if (count == 0) {
+            *this = other;
+            return;
+        }
+        size_t total = count + other.count;
+        double delta = other.mean - mean;
+        mean += delta * other.count / total;
+        m2 += other.m2 + delta * delta * (static_cast<double>(count) * other.count / total);
+        count = total;
+    }
+    
+    double variance() const { return count > 1 ? m2 / (count - 1) : 0.0; }
+    double standardError() const { return count > 1 ? std::sqrt(variance() / count) : 1.0; }
+};
+
+// Fork-join worker pool (same design as the ScientificThreadPool in pattern
+// 30, cut down to a blocking parallelFor). The calling thread takes part, so
+// a pool of size 1 runs everything inline. Chunks are claimed from an atomic
+// counter, so with grain 1 idle workers pick up the next batch as they free up.
+class ForkJoinPool {
+private:
+    std::vector<std::thread> workers_;
+    std::mutex submit_;    // One parallelFor at a time when callers share the pool
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    
+    const std::function<void(size_t, size_t)>* job_ = nullptr;
+    size_t jobSize_ = 0;
+    size_t grain_ = 1;
+    std::atomic<size_t> next_{0};
+    size_t active_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+    
+    void runChunks() {
+        size_t begin;
+        while ((begin = next_.fetch_add(grain_)) < jobSize_) {
+            try {
+                (*job_)(begin, std::min(begin + grain_, jobSize_));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) error_ = std::current_exception();
+            }
+        }
+    }
+    
+    void workerLoop() {
+        uint64_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+            }
+            runChunks();
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0) done_.notify_one();
+        }
+    }
+    
+public:
+    explicit ForkJoinPool(size_t threads = std::thread::hardware_concurrency()) {
+        for (size_t i = 1; i < std::max<size_t>(threads, 1); ++i) {
+            workers_.emplace_back(&ForkJoinPool::workerLoop, this);
+        }
+    }
+    
+    ~ForkJoinPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+    
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+    
+    size_t size() const { return workers_.size() + 1; }
+    
+    // Calls body(begin, end) over [0, count) in chunks of grain items
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) {
+        if (workers_.empty() || count <= grain) {
+            if (count > 0) body(0, count);
+            return;
+        }
+        std::lock_guard<std::mutex> submitLock(submit_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &body;
+            jobSize_ = count;
+            grain_ = std::max<size_t>(grain, 1);
+            next_.store(0);
+            active_ = workers_.size();
+            error_ = nullptr;
+            ++generation_;
+        }
+        wake_.notify_all();
+        runChunks();
+        
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return active_ == 0; });
+        job_ = nullptr;
+        if (error_) std::rethrow_exception(error_);
+    }
+};
+
+// Batched Monte Carlo driver. Work is cut into fixed-size batches and batch b
+// of the simulation always draws from Philox stream b. Each batch fills its
+// own accumulator slot and the slots are merged in batch order, so the
+// estimate is bit-identical whatever the thread count or scheduling.
+class ParallelSamplingEngine {
+private:
+    ForkJoinPool pool_;
+    uint64_t seed_;
+    size_t batchSize_;
+    uint64_t nextStream_ = 0;
+    
+public:
+    ParallelSamplingEngine(size_t threads, uint64_t seed, size_t batchSize)
+        : pool_(threads), seed_(seed), batchSize_(std::max<size_t>(batchSize, 1)) {}
+    
+    // Runs numBatches x batchSize evaluations of kernel(PhiloxStream&)
+    template <typename Kernel>
+    SampleAccumulator run(size_t numBatches, Kernel kernel) {
+        std::vector<SampleAccumulator> partial(numBatches);
+        const uint64_t firstStream = nextStream_;
+        nextStream_ += numBatches;
+        pool_.parallelFor(numBatches, 1, [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                PhiloxStream rng(seed_, firstStream + b);
+                SampleAccumulator acc;
+                for (size_t i = 0; i < batchSize_; ++i) {
+                    acc.add(kernel(rng));
+                }
+                partial[b] = acc;
+            }
+        });
+        SampleAccumulator merged;
+        for (const auto& acc : partial) merged.merge(acc);
+        return merged;
+    }
+    
+    size_t getBatchSize() const { return batchSize_; }
+    size_t getThreadCount() const { return pool_.size(); }
+    uint64_t getStreamsUsed() const { return nextStream_; }
+};
+
 // Scientific Monte Carlo Simulation State Management
 class MonteCarloSimulation;
 
@@ -365,6 +597,10 @@ public:
     virtual void estimateError(MonteCarloSimulation* sim) = 0;
     virtual void finalize(MonteCarloSimulation* sim) = 0;
     
+    // Parallel path: draw numBatches engine batches. States that cannot
+    // sample say so exactly as they would for a single sample.
+    virtual void sampleBatches(MonteCarloSimulation* sim, size_t /*numBatches*/) { sample(sim); }
+    
     virtual std::string getStateName() const = 0;
 };
 
@@ -378,6 +614,10 @@ private:
     size_t currentSamples_;
     std::mt19937 rng_;
     std::string integralType_;
+    std::unique_ptr<ParallelSamplingEngine> engine_;
+    std::vector<SampleAccumulator> phases_;  // One estimator per sampling phase
+    double accuracyTarget_ = 0.001;
+    double refinementThreshold_ = 0.01;
     
 public:
     MonteCarloSimulation(std::unique_ptr<SimulationState> initialState, 
@@ -398,6 +638,48 @@ public:
     void calculateError() { state_->estimateError(this); }
     void finalizeSampling() { state_->finalize(this); }
     
+    // Switches sampling to the batched engine; results then depend only on
+    // the seed and batch size, not on threads
+    void enableParallelSampling(size_t threads, uint64_t seed, size_t batchSize = 4096) {
+        engine_.reset(new ParallelSamplingEngine(threads, seed, batchSize));
+    }
+    
+    void runBatches(size_t numBatches) {
+        if (!engine_) {
+            throw std::logic_error("runBatches() needs enableParallelSampling()");
+        }
+        state_->sampleBatches(this, numBatches);
+    }
+    
+    // Worker partials arrive here once a round of batches has joined, which
+    // is also where the current state decides whether to transition. Each
+    // phase keeps its own estimator (they have different variances) and the
+    // phases are combined by inverse-variance weighting.
+    void mergeBatchResults(size_t phase, const SampleAccumulator& round) {
+        if (phases_.size() <= phase) phases_.resize(phase + 1);
+        phases_[phase].merge(round);
+        
+        double weightSum = 0.0, weightedMean = 0.0;
+        currentSamples_ = 0;
+        for (const auto& estimator : phases_) {
+            currentSamples_ += estimator.count;
+            if (estimator.count < 2) continue;
+            double se = std::max(estimator.standardError(), 1e-300);
+            double weight = 1.0 / (se * se);
+            weightSum += weight;
+            weightedMean += weight * estimator.mean;
+        }
+        if (weightSum > 0.0) {
+            currentEstimate_ = weightedMean / weightSum;
+            standardError_ = 1.0 / std::sqrt(weightSum);
+        }
+    }
+    
+    void setAccuracyTargets(double accurateBelow, double refineAbove) {
+        accuracyTarget_ = accurateBelow;
+        refinementThreshold_ = refineAbove;
+    }
+    
     void addSample(double value) {
         samples_.push_back(value);
         currentSamples_++;
@@ -411,6 +693,7 @@ public:
     }
     
     void calculateStandardError() {
+        if (engine_) return; // Maintained by mergeBatchResults
         if (currentSamples_ < 2) return;
         
         double variance = 0.0;
@@ -429,8 +712,9 @@ public:
     
     // Getters for state logic
     bool hasCompletedSampling() const { return currentSamples_ >= targetSamples_; }
-    bool hasAccurateEstimate() const { return standardError_ < 0.001; }
-    bool needsMoreSamples() const { return standardError_ > 0.01 && currentSamples_ < targetSamples_ * 2; }
+    bool hasAccurateEstimate() const { return standardError_ < accuracyTarget_; }
+    bool needsMoreSamples() const { return standardError_ > refinementThreshold_ && currentSamples_ < targetSamples_ * 2; }
+    double getAccuracyTarget() const { return accuracyTarget_; }
     
     size_t getCurrentSamples() const { return currentSamples_; }
     size_t getTargetSamples() const { return targetSamples_; }
@@ -439,6 +723,11 @@ public:
     std::mt19937& getRNG() { return rng_; }
     const std::string& getIntegralType() const { return integralType_; }
     SimulationState* getState() const { return state_.get(); }
+    ParallelSamplingEngine* getEngine() const { return engine_.get(); }
+    const SampleAccumulator& getPhaseEstimator(size_t phase) const {
+        static const SampleAccumulator empty;
+        return phase < phases_.size() ? phases_[phase] : empty;
+    }
 };
 
 // Monte Carlo States
@@ -455,6 +744,7 @@ class MCSamplingState : public SimulationState {
 public:
     void initialize(MonteCarloSimulation* sim) override;
     void sample(MonteCarloSimulation* sim) override;
+    void sampleBatches(MonteCarloSimulation* sim, size_t numBatches) override;
     void estimateError(MonteCarloSimulation* sim) override;
     void finalize(MonteCarloSimulation* sim) override;
     std::string getStateName() const override { return "MC_SAMPLING"; }
@@ -464,6 +754,7 @@ class MCRefinementState : public SimulationState {
 public:
     void initialize(MonteCarloSimulation* sim) override;
     void sample(MonteCarloSimulation* sim) override;
+    void sampleBatches(MonteCarloSimulation* sim, size_t numBatches) override;
     void estimateError(MonteCarloSimulation* sim) override;
     void finalize(MonteCarloSimulation* sim) override;
     std::string getStateName() const override { return "MC_REFINEMENT"; }
@@ -519,6 +810,18 @@ void MCSamplingState::sample(MonteCarloSimulation* sim) {
     sim->getState()->estimateError(sim);
 }
 
+void MCSamplingState::sampleBatches(MonteCarloSimulation* sim, size_t numBatches) {
+    // Plain hit-or-miss estimator over the unit square (phase 0)
+    SampleAccumulator round = sim->getEngine()->run(numBatches, [](PhiloxStream& rng) {
+        double x = rng.uniform();
+        double y = rng.uniform();
+        return (x*x + y*y <= 1.0) ? 4.0 : 0.0;
+    });
+    sim->mergeBatchResults(0, round);
+    sim->displayProgress();
+    estimateError(sim);
+}
+
 void MCSamplingState::estimateError(MonteCarloSimulation* sim) {
     sim->calculateStandardError();
     
@@ -564,6 +867,45 @@ void MCRefinementState::sample(MonteCarloSimulation* sim) {
     sim->getState()->estimateError(sim);
 }
 
+void MCRefinementState::sampleBatches(MonteCarloSimulation* sim, size_t numBatches) {
+    // Antithetic pairs (phase 1): (x, y) and (1-x, 1-y) land on opposite
+    // sides of the arc more often than independent points, so the pair mean
+    // has lower variance than two plain samples
+    auto antithetic = [](PhiloxStream& rng) {
+        double x = rng.uniform();
+        double y = rng.uniform();
+        double a = (x*x + y*y <= 1.0) ? 4.0 : 0.0;
+        double b = ((1-x)*(1-x) + (1-y)*(1-y) <= 1.0) ? 4.0 : 0.0;
+        return 0.5 * (a + b);
+    };
+    ParallelSamplingEngine* engine = sim->getEngine();
+    const double batchSize = static_cast<double>(engine->getBatchSize());
+    const double target = sim->getAccuracyTarget();
+    
+    // A pilot round measures the antithetic variance; later rounds are sized
+    // to close the remaining gap in the combined error and handed to the
+    // workers batch by batch
+    size_t used = 0;
+    size_t round = std::min(numBatches, std::max<size_t>(engine->getThreadCount(), 4));
+    for (int pass = 1; round > 0; ++pass) {
+        sim->mergeBatchResults(1, engine->run(round, antithetic));
+        used += round;
+        const SampleAccumulator& refined = sim->getPhaseEstimator(1);
+        std::cout << "[MC-REFINE] Round " << pass << ": " << round << " antithetic batches, "
+                  << "pair variance " << std::fixed << std::setprecision(4) << refined.variance()
+                  << " vs plain " << sim->getPhaseEstimator(0).variance() << "\n";
+        if (sim->hasAccurateEstimate() || used >= numBatches) break;
+        
+        const SampleAccumulator& plain = sim->getPhaseEstimator(0);
+        double plainWeight = plain.count > 1 ? 1.0 / (plain.standardError() * plain.standardError()) : 0.0;
+        double pairsNeeded = refined.variance() * (1.0 / (target * target) - plainWeight);
+        double missing = std::max(0.0, pairsNeeded - static_cast<double>(refined.count));
+        round = std::min(numBatches - used, static_cast<size_t>(std::ceil(missing / batchSize)) + 1);
+    }
+    sim->displayProgress();
+    estimateError(sim);
+}
+
 void MCRefinementState::estimateError(MonteCarloSimulation* sim) {
     sim->calculateStandardError();
     
@@ -805,6 +1147,46 @@ void CompletedState::finalizeResults(QuantumChemistryCalculation* calc) {
     std::cout << "[QC-COMPLETE] Calculation completed successfully!\n";
 }
 
+// Same π job on 1, 2 and 4 threads: the state machine drives sampling and
+// refinement through the batched engine and must land on the same bits
+void parallelMonteCarloExample() {
+    std::cout << "\n\n=== Parallel Monte Carlo with Philox Streams ===\n";
+    const size_t threadCounts[] = {1, 2, 4};
+    std::vector<double> estimates;
+    
+    for (size_t threads : threadCounts) {
+        std::streambuf* saved = nullptr;
+        if (!estimates.empty()) saved = std::cout.rdbuf(nullptr); // Trace the first run only
+        
+        MonteCarloSimulation mc(std::make_unique<MCInitializationState>(), 1u << 21,
+                                "π estimation (batched, counter-based RNG)");
+        mc.enableParallelSampling(threads, 20240611, 1u << 14);
+        mc.setAccuracyTargets(5e-4, 1e-4);
+        
+        auto start = std::chrono::steady_clock::now();
+        mc.initializeSimulation();
+        for (int call = 0; call < 64 && mc.getState()->getStateName() != "MC_COMPLETED"; ++call) {
+            bool refining = mc.getState()->getStateName() == "MC_REFINEMENT";
+            mc.runBatches(refining ? 512 : 32);
+        }
+        mc.calculateError();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        
+        if (saved) std::cout.rdbuf(saved);
+        char bits[32];
+        std::snprintf(bits, sizeof(bits), "%.17g", mc.getCurrentEstimate());
+        std::cout << "threads=" << threads << ": pi = " << bits << " ± " << std::scientific
+                  << std::setprecision(2) << mc.getStandardError() << std::fixed
+                  << ", " << mc.getCurrentSamples() << " samples, "
+                  << mc.getEngine()->getStreamsUsed() << " streams, "
+                  << std::setprecision(1) << ms << " ms\n";
+        estimates.push_back(mc.getCurrentEstimate());
+    }
+    bool identical = std::all_of(estimates.begin(), estimates.end(),
+                                 [&](double e) { return e == estimates.front(); });
+    std::cout << "Bit-identical across thread counts: " << (identical ? "yes" : "NO") << "\n";
+}
+
 int main() {
     std::cout << "=== Scientific Computational State Management ===\n\n";
     
@@ -883,6 +1265,8 @@ int main() {
     
     mcMultiD.finalizeSampling();
     
+    parallelMonteCarloExample();
+    
     // Quantum Chemistry Calculation Example
     std::cout << "\n\n=== Quantum Chemistry Calculation ===\n";
     
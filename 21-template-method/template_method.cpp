@@ -13,6 +13,26 @@
 #include <random>
 #include <complex>
 #include <functional>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <list>
+#include <unordered_map>
+#include <cstring>
+#include <cerrno>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 // Template Method for Scientific Simulation Workflows
 class SimulationWorkflow {
@@ -405,6 +425,569 @@ protected:
     void incrementIteration() override { /* Already done in performIteration */ }
 };
 
+// Fork-join worker pool in the spirit of ScientificThreadPool (pattern 30),
+// trimmed to the one operation GEMM needs: split a range of independent
+// blocks across all threads and wait. The calling thread takes part, so a
+// pool of size 1 runs everything inline.
+class ForkJoinPool {
+private:
+    std::vector<std::thread> workers_;
+    std::mutex submit_;    // One parallelFor at a time when callers share the pool
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    
+    const std::function<void(size_t, size_t)>* job_ = nullptr;
+    size_t jobSize_ = 0;
+    size_t grain_ = 1;
+    std::atomic<size_t> next_{0};
+    size_t active_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+    
+    void runChunks() {
+        size_t begin;
+        while ((begin = next_.fetch_add(grain_)) < jobSize_) {
+            try {
+                (*job_)(begin, std::min(begin + grain_, jobSize_));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) error_ = std::current_exception();
+            }
+        }
+    }
+    
+    void workerLoop() {
+        uint64_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+            }
+            runChunks();
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0) done_.notify_one();
+        }
+    }
+    
+public:
+    explicit ForkJoinPool(size_t threads = std::thread::hardware_concurrency()) {
+        for (size_t i = 1; i < std::max<size_t>(threads, 1); ++i) {
+            workers_.emplace_back(&ForkJoinPool::workerLoop, this);
+        }
+    }
+    
+    ~ForkJoinPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+    
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+    
+    size_t size() const { return workers_.size() + 1; }
+    
+    // Calls body(begin, end) over [0, count) in chunks of grain items
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) {
+        if (workers_.empty() || count <= grain) {
+            if (count > 0) body(0, count);
+            return;
+        }
+        std::lock_guard<std::mutex> submitLock(submit_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &body;
+            jobSize_ = count;
+            grain_ = std::max<size_t>(grain, 1);
+            next_.store(0);
+            active_ = workers_.size();
+            error_ = nullptr;
+            ++generation_;
+        }
+        wake_.notify_all();
+        runChunks();
+        
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return active_ == 0; });
+        job_ = nullptr;
+        if (error_) std::rethrow_exception(error_);
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Cache-blocked DGEMM: C = alpha A B + beta C (row-major, leading dimensions)
+//
+// Goto/BLIS loop structure around a register-blocked micro-kernel:
+//   jc: NC columns of B     -> packed KC×NC panel stays in L3
+//   pc: KC-deep slab        -> each thread packs an MC×KC block of A into L2
+//   ic: MC rows (parallel)
+//   jr/ir: NR×KC sliver of B and MR×KC sliver of A stream from L1 while the
+//          micro-kernel keeps an MR×NR tile of C in vector registers
+// Packed panels are zero-padded to whole tiles, so the micro-kernel never
+// branches. The widest kernel the CPU supports (AVX-512, AVX2+FMA, or a
+// portable one) is chosen once, on first use.
+// ---------------------------------------------------------------------------
+
+struct GemmKernel {
+    const char* name;
+    size_t mr, nr;              // Register tile
+    size_t mc, kc, nc;          // Cache blocks (mc % mr == 0, nc % nr == 0)
+    int flopsPerCycle;          // Nominal double-precision peak per core
+    // C[0..mr)[0..nr) += alpha * (packed A sliver) * (packed B sliver)
+    void (*micro)(size_t kc, const double* A, const double* B, double* C, size_t ldc, double alpha);
+};
+
+// Portable kernel; the fixed-size accumulator loops auto-vectorize
+inline void gemmMicroGeneric(size_t kc, const double* A, const double* B, double* C,
+                             size_t ldc, double alpha) {
+    constexpr size_t MR = 4, NR = 8;
+    double acc[MR][NR] = {};
+    for (size_t k = 0; k < kc; ++k, A += MR, B += NR) {
+        for (size_t r = 0; r < MR; ++r) {
+            for (size_t c = 0; c < NR; ++c) acc[r][c] += A[r] * B[c];
+        }
+    }
+    for (size_t r = 0; r < MR; ++r) {
+        for (size_t c = 0; c < NR; ++c) C[r * ldc + c] += alpha * acc[r][c];
+    }
+}
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GEMM_X86_DISPATCH 1
+
+// 6×8 tile: 12 ymm accumulators, 2 B loads and 6 broadcasts per k
+__attribute__((target("avx2,fma")))
+inline void gemmMicroAvx2(size_t kc, const double* A, const double* B, double* C,
+                          size_t ldc, double alpha) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+    for (size_t k = 0; k < kc; ++k, A += 6, B += 8) {
+        __m256d b0 = _mm256_loadu_pd(B), b1 = _mm256_loadu_pd(B + 4);
+        __m256d a;
+        a = _mm256_broadcast_sd(A + 0); c00 = _mm256_fmadd_pd(a, b0, c00); c01 = _mm256_fmadd_pd(a, b1, c01);
+        a = _mm256_broadcast_sd(A + 1); c10 = _mm256_fmadd_pd(a, b0, c10); c11 = _mm256_fmadd_pd(a, b1, c11);
+        a = _mm256_broadcast_sd(A + 2); c20 = _mm256_fmadd_pd(a, b0, c20); c21 = _mm256_fmadd_pd(a, b1, c21);
+        a = _mm256_broadcast_sd(A + 3); c30 = _mm256_fmadd_pd(a, b0, c30); c31 = _mm256_fmadd_pd(a, b1, c31);
+        a = _mm256_broadcast_sd(A + 4); c40 = _mm256_fmadd_pd(a, b0, c40); c41 = _mm256_fmadd_pd(a, b1, c41);
+        a = _mm256_broadcast_sd(A + 5); c50 = _mm256_fmadd_pd(a, b0, c50); c51 = _mm256_fmadd_pd(a, b1, c51);
+    }
+    __m256d s = _mm256_set1_pd(alpha);
+    __m256d acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+    for (size_t r = 0; r < 6; ++r) {
+        double* row = C + r * ldc;
+        _mm256_storeu_pd(row, _mm256_fmadd_pd(s, acc[r][0], _mm256_loadu_pd(row)));
+        _mm256_storeu_pd(row + 4, _mm256_fmadd_pd(s, acc[r][1], _mm256_loadu_pd(row + 4)));
+    }
+}
+
+// 8×24 tile: 24 zmm accumulators, 3 B loads and 8 broadcasts per k
+__attribute__((target("avx512f")))
+inline void gemmMicroAvx512(size_t kc, const double* A, const double* B, double* C,
+                            size_t ldc, double alpha) {
+    __m512d acc[8][3];
+    for (size_t r = 0; r < 8; ++r) {
+        acc[r][0] = acc[r][1] = acc[r][2] = _mm512_setzero_pd();
+    }
+    for (size_t k = 0; k < kc; ++k, A += 8, B += 24) {
+        __m512d b0 = _mm512_loadu_pd(B), b1 = _mm512_loadu_pd(B + 8), b2 = _mm512_loadu_pd(B + 16);
+#pragma GCC unroll 8
+        for (size_t r = 0; r < 8; ++r) {
+            __m512d a = _mm512_set1_pd(A[r]);
+            acc[r][0] = _mm512_fmadd_pd(a, b0, acc[r][0]);
+            acc[r][1] = _mm512_fmadd_pd(a, b1, acc[r][1]);
+            acc[r][2] = _mm512_fmadd_pd(a, b2, acc[r][2]);
+        }
+    }
+    __m512d s = _mm512_set1_pd(alpha);
+    for (size_t r = 0; r < 8; ++r) {
+        double* row = C + r * ldc;
+        _mm512_storeu_pd(row, _mm512_fmadd_pd(s, acc[r][0], _mm512_loadu_pd(row)));
+        _mm512_storeu_pd(row + 8, _mm512_fmadd_pd(s, acc[r][1], _mm512_loadu_pd(row + 8)));
+        _mm512_storeu_pd(row + 16, _mm512_fmadd_pd(s, acc[r][2], _mm512_loadu_pd(row + 16)));
+    }
+}
+#endif
+
+inline const GemmKernel& gemmKernel() {
+    static const GemmKernel kernel = [] {
+#ifdef GEMM_X86_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return GemmKernel{"AVX-512 8x24", 8, 24, 96, 256, 4080, 32, gemmMicroAvx512};
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return GemmKernel{"AVX2+FMA 6x8", 6, 8, 96, 256, 4096, 16, gemmMicroAvx2};
+        }
+#endif
+        return GemmKernel{"Generic 4x8", 4, 8, 96, 256, 4096, 4, gemmMicroGeneric};
+    }();
+    return kernel;
+}
+
+inline ForkJoinPool& gemmPool() {
+    static ForkJoinPool pool;
+    return pool;
+}
+
+inline void blockedGemm(size_t M, size_t N, size_t K, double alpha,
+                        const double* A, size_t lda, const double* B, size_t ldb,
+                        double beta, double* C, size_t ldc, ForkJoinPool& pool = gemmPool()) {
+    const GemmKernel& kern = gemmKernel();
+    const size_t MR = kern.mr, NR = kern.nr;
+    
+    if (beta != 1.0) {
+        for (size_t i = 0; i < M; ++i) {
+            double* row = C + i * ldc;
+            if (beta == 0.0) std::fill(row, row + N, 0.0);  // Also clears NaNs
+            else for (size_t j = 0; j < N; ++j) row[j] *= beta;
+        }
+    }
+    if (M == 0 || N == 0 || K == 0 || alpha == 0.0) return;
+    
+    std::vector<double> packedB;
+    for (size_t jc = 0; jc < N; jc += kern.nc) {
+        size_t nc = std::min(kern.nc, N - jc);
+        size_t bPanels = (nc + NR - 1) / NR;
+        
+        for (size_t pc = 0; pc < K; pc += kern.kc) {
+            size_t kc = std::min(kern.kc, K - pc);
+            
+            // Pack B[pc.., jc..] into NR-wide slivers, k-major within each
+            packedB.resize(bPanels * NR * kc);
+            pool.parallelFor(bPanels, 16, [&](size_t begin, size_t end) {
+                for (size_t panel = begin; panel < end; ++panel) {
+                    double* dst = packedB.data() + panel * NR * kc;
+                    size_t j0 = panel * NR, width = std::min(NR, nc - j0);
+                    for (size_t k = 0; k < kc; ++k) {
+                        const double* src = B + (pc + k) * ldb + jc + j0;
+                        size_t c = 0;
+                        for (; c < width; ++c) dst[c] = src[c];
+                        for (; c < NR; ++c) dst[c] = 0.0;
+                        dst += NR;
+                    }
+                }
+            });
+            
+            size_t mBlocks = (M + kern.mc - 1) / kern.mc;
+            pool.parallelFor(mBlocks, 1, [&](size_t begin, size_t end) {
+                thread_local std::vector<double> packedA;
+                double edge[8 * 24];  // Largest tile of any kernel
+                for (size_t block = begin; block < end; ++block) {
+                    size_t ic = block * kern.mc, mc = std::min(kern.mc, M - ic);
+                    size_t aPanels = (mc + MR - 1) / MR;
+                    
+                    // Pack A[ic.., pc..] into MR-tall slivers, k-major within each
+                    packedA.resize(aPanels * MR * kc);
+                    for (size_t panel = 0; panel < aPanels; ++panel) {
+                        double* dst = packedA.data() + panel * MR * kc;
+                        size_t i0 = panel * MR, height = std::min(MR, mc - i0);
+                        for (size_t k = 0; k < kc; ++k) {
+                            size_t r = 0;
+                            for (; r < height; ++r) dst[r] = A[(ic + i0 + r) * lda + pc + k];
+                            for (; r < MR; ++r) dst[r] = 0.0;
+                            dst += MR;
+                        }
+                    }
+                    
+                    for (size_t jp = 0; jp < bPanels; ++jp) {
+                        size_t j0 = jp * NR, width = std::min(NR, nc - j0);
+                        const double* bSliver = packedB.data() + jp * NR * kc;
+                        for (size_t ip = 0; ip < aPanels; ++ip) {
+                            size_t i0 = ip * MR, height = std::min(MR, mc - i0);
+                            const double* aSliver = packedA.data() + ip * MR * kc;
+                            double* cTile = C + (ic + i0) * ldc + jc + j0;
+                            if (height == MR && width == NR) {
+                                kern.micro(kc, aSliver, bSliver, cTile, ldc, alpha);
+                            } else {
+                                // Partial tile: run the full kernel into scratch, copy the valid part
+                                std::fill(edge, edge + MR * NR, 0.0);
+                                kern.micro(kc, aSliver, bSliver, edge, NR, alpha);
+                                for (size_t r = 0; r < height; ++r) {
+                                    for (size_t c = 0; c < width; ++c) cTile[r * ldc + c] += edge[r * NR + c];
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+        }
+    }
+}
+
+// Nominal peak of the current core count and kernel, from the reported clock
+inline double theoreticalPeakGflops(size_t threads) {
+    double mhz = 0.0;
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.rfind("cpu MHz", 0) == 0) {
+            mhz = std::stod(line.substr(line.find(':') + 1));
+            break;
+        }
+    }
+    return mhz * 1e-3 * gemmKernel().flopsPerCycle * threads;
+}
+
+// ---------------------------------------------------------------------------
+// Statistical benchmark harness
+//
+// A single timed run says little: the first call pays for page faults and
+// cold caches, frequency scaling shifts between runs, and one preempted run
+// looks like a regression. runStatistical() below calibrates an iteration
+// count so each sample lasts at least minSampleSeconds, warms up, collects
+// the configured number of samples, drops outliers by modified z-score
+// (|x - median| / MAD), and reports median, p95, mean and standard
+// deviation per iteration. Hardware counters come from perf_event_open on
+// Linux and are reported as unavailable elsewhere or when the kernel refuses
+// access (perf_event_paranoid, containers).
+// ---------------------------------------------------------------------------
+
+struct BenchmarkConfig {
+    double minSampleSeconds = 0.01;   // Calibrated batch length of one sample
+    double warmupSeconds = 0.05;
+    size_t samples = 30;
+    double outlierThreshold = 3.5;    // Modified z-score beyond which a sample is dropped
+    int pinCpu = -1;                  // Pin the benchmarking thread to this CPU; -1 leaves affinity alone
+    bool hardwareCounters = true;
+};
+
+struct SampleStatistics {
+    size_t kept = 0;
+    size_t rejected = 0;
+    double median = 0.0;
+    double p95 = 0.0;
+    double mean = 0.0;
+    double stddev = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double mad = 0.0;   // Median absolute deviation of all samples
+
+    double relativeStddev() const { return mean > 0.0 ? stddev / mean : 0.0; }
+};
+
+// Linear interpolation between order statistics of a sorted sample
+inline double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    double rank = p * (sorted.size() - 1);
+    size_t lo = static_cast<size_t>(rank);
+    size_t hi = std::min(lo + 1, sorted.size() - 1);
+    return sorted[lo] + (rank - lo) * (sorted[hi] - sorted[lo]);
+}
+
+inline double medianOf(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return percentile(values, 0.5);
+}
+
+inline SampleStatistics computeStatistics(std::vector<double> samples, double outlierThreshold) {
+    SampleStatistics stats;
+    if (samples.empty()) return stats;
+
+    std::sort(samples.begin(), samples.end());
+    double median = percentile(samples, 0.5);
+    std::vector<double> deviations(samples.size());
+    for (size_t i = 0; i < samples.size(); ++i) deviations[i] = std::abs(samples[i] - median);
+    std::sort(deviations.begin(), deviations.end());
+    stats.mad = percentile(deviations, 0.5);
+
+    // 0.6745 scales the MAD to a standard deviation for normal data
+    std::vector<double> kept;
+    for (double s : samples) {
+        if (stats.mad > 0.0 && 0.6745 * std::abs(s - median) / stats.mad > outlierThreshold) {
+            stats.rejected++;
+        } else {
+            kept.push_back(s);
+        }
+    }
+    if (kept.empty()) {
+        kept = samples;
+        stats.rejected = 0;
+    }
+
+    stats.kept = kept.size();
+    stats.median = percentile(kept, 0.5);
+    stats.p95 = percentile(kept, 0.95);
+    stats.min = kept.front();
+    stats.max = kept.back();
+    double sum = 0.0;
+    for (double s : kept) sum += s;
+    stats.mean = sum / kept.size();
+    double sq = 0.0;
+    for (double s : kept) sq += (s - stats.mean) * (s - stats.mean);
+    stats.stddev = kept.size() > 1 ? std::sqrt(sq / (kept.size() - 1)) : 0.0;
+    return stats;
+}
+
+// Keeps the compiler from discarding a kernel whose result is otherwise unused
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+// cycles, instructions, last-level cache misses and branch misses for the
+// calling thread, read as one perf event group so they cover the same interval
+class HardwareCounters {
+public:
+    struct Reading {
+        uint64_t cycles = 0;
+        uint64_t instructions = 0;
+        uint64_t cacheMisses = 0;
+        uint64_t branchMisses = 0;
+    };
+
+private:
+    static constexpr int kEvents = 4;
+    int fds_[kEvents] = {-1, -1, -1, -1};
+    bool available_ = false;
+    std::string status_ = "not supported on this platform";
+
+#if defined(__linux__)
+    static int openEvent(uint64_t config, int groupFd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = groupFd == -1 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+    }
+#endif
+
+    void closeAll() {
+#if defined(__linux__)
+        for (int& fd : fds_) {
+            if (fd >= 0) close(fd);
+            fd = -1;
+        }
+#endif
+    }
+
+public:
+    HardwareCounters() {
+#if defined(__linux__)
+        const uint64_t events[kEvents] = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+        };
+        for (int i = 0; i < kEvents; ++i) {
+            fds_[i] = openEvent(events[i], i == 0 ? -1 : fds_[0]);
+            if (fds_[i] < 0) {
+                status_ = std::string("perf_event_open failed: ") + std::strerror(errno);
+                closeAll();
+                return;
+            }
+        }
+        available_ = true;
+        status_ = "perf_event_open";
+#endif
+    }
+
+    ~HardwareCounters() { closeAll(); }
+
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    bool available() const { return available_; }
+    const std::string& status() const { return status_; }
+
+    void start() {
+#if defined(__linux__)
+        if (!available_) return;
+        ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    Reading stop() {
+        Reading reading;
+#if defined(__linux__)
+        if (!available_) return reading;
+        ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        uint64_t values[1 + kEvents] = {};
+        if (read(fds_[0], values, sizeof(values)) == static_cast<ssize_t>(sizeof(values))) {
+            reading.cycles = values[1];
+            reading.instructions = values[2];
+            reading.cacheMisses = values[3];
+            reading.branchMisses = values[4];
+        }
+#endif
+        return reading;
+    }
+};
+
+// Pins the calling thread to one CPU for the scope and restores the
+// previous affinity mask afterwards
+class ScopedCpuPin {
+private:
+    bool pinned_ = false;
+#if defined(__linux__)
+    cpu_set_t previous_;
+#endif
+
+public:
+    explicit ScopedCpuPin(int cpu) {
+#if defined(__linux__)
+        if (cpu < 0 || sched_getaffinity(0, sizeof(previous_), &previous_) != 0) return;
+        cpu_set_t target;
+        CPU_ZERO(&target);
+        CPU_SET(cpu, &target);
+        pinned_ = sched_setaffinity(0, sizeof(target), &target) == 0;
+#else
+        (void)cpu;
+#endif
+    }
+
+    ~ScopedCpuPin() {
+#if defined(__linux__)
+        if (pinned_) sched_setaffinity(0, sizeof(previous_), &previous_);
+#endif
+    }
+
+    ScopedCpuPin(const ScopedCpuPin&) = delete;
+    ScopedCpuPin& operator=(const ScopedCpuPin&) = delete;
+
+    bool pinned() const { return pinned_; }
+};
+
+struct BenchmarkReport {
+    std::string name;
+    std::string unit;                      // What itemsPerIteration counts
+    double itemsPerIteration = 1.0;
+    uint64_t iterationsPerSample = 0;
+    SampleStatistics nsPerIteration;
+    int pinnedCpu = -1;                    // -1 when the run was not pinned
+    bool counters = false;
+    std::string counterStatus;
+    double cyclesPerIteration = 0.0;
+    double instructionsPerIteration = 0.0;
+    double cacheMissesPerIteration = 0.0;
+    double branchMissesPerIteration = 0.0;
+    std::string error;                     // Non-empty when the kernel threw
+
+    double itemsPerSecond() const {
+        return nsPerIteration.median > 0.0 ? itemsPerIteration * 1e9 / nsPerIteration.median : 0.0;
+    }
+};
+
 // Template Method for Scientific Benchmarking Framework
 class PerformanceBenchmark {
 public:
@@ -434,12 +1017,88 @@ public:
         cleanupEnvironment();
     }
     
+    // Template method for statistically sound measurements: the kernel runs
+    // in calibrated batches, and only the batches after warmup are sampled
+    BenchmarkReport runStatistical(const BenchmarkConfig& config = BenchmarkConfig()) {
+        using Clock = std::chrono::steady_clock;
+        BenchmarkReport report;
+        report.name = getBenchmarkName();
+        report.unit = itemUnit();
+        report.itemsPerIteration = itemsPerIteration();
+
+        ScopedCpuPin pin(config.pinCpu);
+        report.pinnedCpu = pin.pinned() ? config.pinCpu : -1;
+
+        auto timeBatch = [this](uint64_t iterations) {
+            auto start = Clock::now();
+            for (uint64_t i = 0; i < iterations; ++i) runKernel();
+            return std::chrono::duration<double>(Clock::now() - start).count();
+        };
+
+        try {
+            setUpKernel();
+
+            // Calibrate: grow the batch until it lasts minSampleSeconds
+            uint64_t iterations = 1;
+            while (true) {
+                double elapsed = timeBatch(iterations);
+                if (elapsed >= config.minSampleSeconds || iterations >= (uint64_t(1) << 40)) break;
+                double scale = elapsed > 0.0 ? 1.2 * config.minSampleSeconds / elapsed : 10.0;
+                iterations = std::max<uint64_t>(iterations * 2,
+                    static_cast<uint64_t>(std::ceil(iterations * std::min(scale, 10.0))));
+            }
+            report.iterationsPerSample = iterations;
+
+            warmupKernel();
+            auto warmupEnd = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(config.warmupSeconds));
+            do {
+                timeBatch(iterations);
+            } while (Clock::now() < warmupEnd);
+
+            HardwareCounters counters;
+            bool useCounters = config.hardwareCounters && counters.available();
+            report.counters = useCounters;
+            report.counterStatus = config.hardwareCounters ? counters.status() : "disabled";
+
+            std::vector<double> nsPerIteration;
+            std::vector<double> cycles, instructions, cacheMisses, branchMisses;
+            for (size_t s = 0; s < config.samples; ++s) {
+                if (useCounters) counters.start();
+                double elapsed = timeBatch(iterations);
+                if (useCounters) {
+                    HardwareCounters::Reading r = counters.stop();
+                    cycles.push_back(double(r.cycles) / iterations);
+                    instructions.push_back(double(r.instructions) / iterations);
+                    cacheMisses.push_back(double(r.cacheMisses) / iterations);
+                    branchMisses.push_back(double(r.branchMisses) / iterations);
+                }
+                nsPerIteration.push_back(elapsed * 1e9 / iterations);
+            }
+
+            report.nsPerIteration = computeStatistics(nsPerIteration, config.outlierThreshold);
+            if (useCounters) {
+                // Medians are robust to the same preempted samples the timing rejects
+                report.cyclesPerIteration = medianOf(cycles);
+                report.instructionsPerIteration = medianOf(instructions);
+                report.cacheMissesPerIteration = medianOf(cacheMisses);
+                report.branchMissesPerIteration = medianOf(branchMisses);
+            }
+        } catch (const std::exception& e) {
+            report.error = e.what();
+        }
+
+        tearDownKernel();
+        return report;
+    }
+
     virtual ~PerformanceBenchmark() = default;
+
+    virtual std::string getBenchmarkName() const = 0;
     
 protected:
     // Abstract methods
     virtual void measurementPhase() = 0;
-    virtual std::string getBenchmarkName() const = 0;
     
     // Hook methods with default implementations
     virtual void prepareEnvironment() {
@@ -457,60 +1116,118 @@ protected:
     virtual void cleanupEnvironment() {
         std::cout << "  Cleaning up benchmark resources\n";
     }
+
+    // Statistical-mode hooks. runKernel() is one timed iteration; the
+    // defaults reuse the one-shot hooks so existing benchmarks work unchanged
+    virtual void setUpKernel() { prepareEnvironment(); }
+    virtual void warmupKernel() {}
+    virtual void runKernel() { measurementPhase(); }
+    virtual void tearDownKernel() { cleanupEnvironment(); }
+    virtual double itemsPerIteration() const { return 1.0; }
+    virtual std::string itemUnit() const { return "iterations"; }
 };
 
 class MatrixMultiplicationBenchmark : public PerformanceBenchmark {
 private:
-    std::vector<std::vector<double>> matrixA_, matrixB_, result_;
+    // Row-major contiguous storage so the blocked kernel can pack panels
+    std::vector<double> matrixA_, matrixB_, result_, reference_;
     int size_ = 500;
+    double gemmSeconds_ = 0.0;
+    double naiveSeconds_ = 0.0;
     
+    void naiveMultiply(std::vector<double>& C) const {
+        for (int i = 0; i < size_; ++i) {
+            for (int j = 0; j < size_; ++j) {
+                double sum = 0.0;
+                for (int k = 0; k < size_; ++k) {
+                    sum += matrixA_[i * size_ + k] * matrixB_[k * size_ + j];
+                }
+                C[i * size_ + j] = sum;
+            }
+        }
+    }
+    
+    void allocate() {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        matrixA_.resize(size_t(size_) * size_);
+        matrixB_.resize(size_t(size_) * size_);
+        for (double& a : matrixA_) a = dist(gen);
+        for (double& b : matrixB_) b = dist(gen);
+        result_.assign(size_t(size_) * size_, 0.0);
+        reference_.assign(size_t(size_) * size_, 0.0);
+    }
+
 protected:
     void prepareEnvironment() override {
         PerformanceBenchmark::prepareEnvironment();
         std::cout << "  Allocating " << size_ << "x" << size_ << " matrices\n";
-        
-        matrixA_.resize(size_, std::vector<double>(size_, 1.5));
-        matrixB_.resize(size_, std::vector<double>(size_, 2.0));
-        result_.resize(size_, std::vector<double>(size_, 0.0));
+        allocate();
     }
     
     void warmupPhase() override {
         PerformanceBenchmark::warmupPhase();
-        // Perform smaller warmup multiplication
-        for (int i = 0; i < 10; ++i) {
-            for (int j = 0; j < 10; ++j) {
-                double sum = 0.0;
-                for (int k = 0; k < 10; ++k) {
-                    sum += matrixA_[i][k] * matrixB_[k][j];
-                }
-                result_[i][j] = sum;
-            }
-        }
+        // Small multiply that also starts the pool and selects the kernel
+        blockedGemm(64, 64, 64, 1.0, matrixA_.data(), size_, matrixB_.data(), size_,
+                    0.0, result_.data(), size_);
     }
     
     void measurementPhase() override {
-        std::cout << "  Performing matrix multiplication (" << size_ << "x" << size_ << ")\n";
+        std::cout << "  Performing matrix multiplication (" << size_ << "x" << size_ << ") with "
+                  << gemmKernel().name << " kernel on " << gemmPool().size() << " threads\n";
         
-        for (int i = 0; i < size_; ++i) {
-            for (int j = 0; j < size_; ++j) {
-                double sum = 0.0;
-                for (int k = 0; k < size_; ++k) {
-                    sum += matrixA_[i][k] * matrixB_[k][j];
-                }
-                result_[i][j] = sum;
-            }
-        }
+        auto start = std::chrono::high_resolution_clock::now();
+        blockedGemm(size_, size_, size_, 1.0, matrixA_.data(), size_, matrixB_.data(), size_,
+                    0.0, result_.data(), size_);
+        auto mid = std::chrono::high_resolution_clock::now();
+        naiveMultiply(reference_);
+        auto end = std::chrono::high_resolution_clock::now();
+        
+        gemmSeconds_ = std::chrono::duration<double>(mid - start).count();
+        naiveSeconds_ = std::chrono::duration<double>(end - mid).count();
     }
     
-    void analyzePerformance(long microseconds) override {
+    // Rates come from the separate GEMM and naive timings, not the total
+    void analyzePerformance(long) override {
         double operations = 2.0 * size_ * size_ * size_;  // 2n³ operations
-        double gflops = (operations / 1e9) / (microseconds / 1e6);
+        double gflops = operations / 1e9 / gemmSeconds_;
+        double naiveGflops = operations / 1e9 / naiveSeconds_;
+        double peak = theoreticalPeakGflops(gemmPool().size());
+        
+        double maxError = 0.0;
+        for (size_t i = 0; i < result_.size(); ++i) {
+            maxError = std::max(maxError, std::abs(result_[i] - reference_[i]));
+        }
         
         std::cout << "  Operations: " << std::scientific << operations << "\n";
         std::cout << "  Performance: " << std::fixed << std::setprecision(2) 
-                  << gflops << " GFLOPS\n";
+                  << gflops << " GFLOPS blocked, " << naiveGflops << " GFLOPS naive ("
+                  << gflops / naiveGflops << "x)\n";
+        if (peak > 0.0) {
+            std::cout << "  Theoretical peak: " << peak << " GFLOPS ("
+                      << 100.0 * gflops / peak << "% achieved)\n";
+        }
+        std::cout << "  Max |blocked - naive|: " << std::scientific << std::setprecision(1)
+                  << maxError << "\n";
     }
     
+    // Statistical mode times the blocked kernel alone; the naive reference
+    // is only for the one-shot correctness check
+    void setUpKernel() override { allocate(); }
+    void tearDownKernel() override {}
+
+    void runKernel() override {
+        blockedGemm(size_, size_, size_, 1.0, matrixA_.data(), size_, matrixB_.data(), size_,
+                    0.0, result_.data(), size_);
+        doNotOptimize(result_[0]);
+    }
+
+    double itemsPerIteration() const override { return 2.0 * size_ * size_ * size_; }
+    std::string itemUnit() const override { return "FLOP"; }
+
+public:
+    explicit MatrixMultiplicationBenchmark(int size = 500) : size_(size) {}
+
     std::string getBenchmarkName() const override {
         return "Matrix Multiplication Benchmark";
     }
@@ -521,27 +1238,17 @@ private:
     std::vector<std::complex<double>> signal_, fftResult_;
     int signalSize_ = 65536;  // 2^16
     
-protected:
-    void prepareEnvironment() override {
-        PerformanceBenchmark::prepareEnvironment();
-        std::cout << "  Generating signal with " << signalSize_ << " samples\n";
-        
+    void generateSignal(std::mt19937& gen) {
         signal_.resize(signalSize_);
         fftResult_.resize(signalSize_);
         
-        // Generate test signal
-        std::random_device rd;
-        std::mt19937 gen(rd());
         std::normal_distribution<double> dist(0.0, 1.0);
-        
         for (int i = 0; i < signalSize_; ++i) {
             signal_[i] = std::complex<double>(dist(gen), dist(gen));
         }
     }
     
-    void measurementPhase() override {
-        std::cout << "  Performing FFT computation\n";
-        
+    void transform() {
         // Simplified FFT simulation (normally would use FFTW or similar)
         for (int i = 0; i < signalSize_; ++i) {
             std::complex<double> sum(0.0, 0.0);
@@ -554,6 +1261,22 @@ protected:
         }
     }
     
+protected:
+    void prepareEnvironment() override {
+        PerformanceBenchmark::prepareEnvironment();
+        std::cout << "  Generating signal with " << signalSize_ << " samples\n";
+
+        // Generate test signal
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        generateSignal(gen);
+    }
+
+    void measurementPhase() override {
+        std::cout << "  Performing FFT computation\n";
+        transform();
+    }
+
     void analyzePerformance(long microseconds) override {
         double operations = signalSize_ * std::log2(signalSize_) * 5;  // Approx N log N
         double mflops = (operations / 1e6) / (microseconds / 1e6);
@@ -562,6 +1285,23 @@ protected:
         std::cout << "  Performance: " << std::fixed << std::setprecision(2) 
                   << mflops << " MFLOPS\n";
     }
+
+    void setUpKernel() override {
+        std::mt19937 gen(42);
+        generateSignal(gen);
+    }
+    void tearDownKernel() override {}
+
+    void runKernel() override {
+        transform();
+        doNotOptimize(fftResult_[0]);
+    }
+
+    double itemsPerIteration() const override { return signalSize_; }
+    std::string itemUnit() const override { return "samples"; }
+
+public:
+    explicit FFTBenchmark(int signalSize = 65536) : signalSize_(signalSize) {}
     
     std::string getBenchmarkName() const override {
         return "FFT Performance Benchmark";
@@ -572,13 +1312,9 @@ class MonteCarloBenchmark : public PerformanceBenchmark {
 private:
     double piEstimate_ = 0.0;
     int numSamples_ = 10000000;
+    std::mt19937 kernelGen_{42};
     
-protected:
-    void measurementPhase() override {
-        std::cout << "  Computing π using Monte Carlo (" << numSamples_ << " samples)\n";
-        
-        std::random_device rd;
-        std::mt19937 gen(rd());
+    double estimate(std::mt19937& gen) const {
         std::uniform_real_distribution<double> dist(-1.0, 1.0);
         
         int insideCircle = 0;
@@ -590,7 +1326,16 @@ protected:
             }
         }
         
-        piEstimate_ = 4.0 * insideCircle / numSamples_;
+        return 4.0 * insideCircle / numSamples_;
+    }
+
+protected:
+    void measurementPhase() override {
+        std::cout << "  Computing π using Monte Carlo (" << numSamples_ << " samples)\n";
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        piEstimate_ = estimate(gen);
     }
     
     void analyzePerformance(long microseconds) override {
@@ -603,11 +1348,527 @@ protected:
                   << samplesPerSecond << " MSamples/sec\n";
     }
     
+    void setUpKernel() override { kernelGen_.seed(42); }
+    void tearDownKernel() override {}
+
+    void runKernel() override {
+        piEstimate_ = estimate(kernelGen_);
+        doNotOptimize(piEstimate_);
+    }
+
+    double itemsPerIteration() const override { return numSamples_; }
+    std::string itemUnit() const override { return "samples"; }
+
+public:
+    explicit MonteCarloBenchmark(int numSamples = 10000000) : numSamples_(numSamples) {}
+
     std::string getBenchmarkName() const override {
         return "Monte Carlo π Estimation Benchmark";
     }
 };
 
+// Hot paths of other patterns, reduced to their inner loops so the harness
+// can track them next to the numerical kernels. Each mirrors the data
+// structure of the pattern it names rather than linking against it; the
+// patterns are separate programs.
+
+// Tagged index free list as in ObjectPool (pattern 25): acquire and
+// release a batch of slots per iteration
+class ObjectPoolKernelBenchmark : public PerformanceBenchmark {
+private:
+    static constexpr uint32_t kNil = 0;  // Links store index + 1
+    static constexpr size_t kSlots = 1024;
+    static constexpr size_t kBatch = 64;
+
+    std::vector<std::atomic<uint32_t>> next_;
+    std::atomic<uint64_t> head_{kNil};   // (tag << 32) | (index + 1)
+    std::vector<uint32_t> held_;
+
+    void push(uint32_t index) {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        uint64_t desired;
+        do {
+            next_[index].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            desired = (((head >> 32) + 1) << 32) | (index + 1);
+        } while (!head_.compare_exchange_weak(head, desired,
+                     std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    bool pop(uint32_t& index) {
+        uint64_t head = head_.load(std::memory_order_acquire);
+        while (static_cast<uint32_t>(head) != kNil) {
+            uint32_t top = static_cast<uint32_t>(head) - 1;
+            uint32_t next = next_[top].load(std::memory_order_relaxed);
+            uint64_t desired = (((head >> 32) + 1) << 32) | next;
+            if (head_.compare_exchange_weak(head, desired,
+                    std::memory_order_acquire, std::memory_order_acquire)) {
+                index = top;
+                return true;
+            }
+        }
+        return false;
+    }
+
+protected:
+    void measurementPhase() override {}
+
+    void setUpKernel() override {
+        next_ = std::vector<std::atomic<uint32_t>>(kSlots);
+        head_.store(kNil);
+        for (uint32_t i = 0; i < kSlots; ++i) push(i);
+        held_.assign(kBatch, 0);
+    }
+    void tearDownKernel() override {}
+
+    void runKernel() override {
+        for (size_t i = 0; i < kBatch; ++i) pop(held_[i]);
+        for (size_t i = kBatch; i-- > 0;) push(held_[i]);
+        doNotOptimize(held_[0]);
+    }
+
+    double itemsPerIteration() const override { return 2.0 * kBatch; }
+    std::string itemUnit() const override { return "ops"; }
+
+public:
+    std::string getBenchmarkName() const override { return "Object pool acquire/release"; }
+};
+
+// Sequence-numbered ring as in BlockingQueue (pattern 28): the lock-free
+// fast path, filled and drained by one thread
+class BoundedQueueKernelBenchmark : public PerformanceBenchmark {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        double value = 0.0;
+    };
+
+    static constexpr size_t kCapacity = 1024;
+    static constexpr size_t kBatch = 256;
+    std::unique_ptr<Cell[]> buffer_;
+    size_t mask_ = kCapacity - 1;
+    std::atomic<size_t> enqueuePos_{0};
+    std::atomic<size_t> dequeuePos_{0};
+    double checksum_ = 0.0;
+
+    bool tryPush(double value) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = buffer_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool tryPop(double& value) {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = buffer_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = cell.value;
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Empty
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+protected:
+    void measurementPhase() override {}
+
+    void setUpKernel() override {
+        buffer_.reset(new Cell[kCapacity]);
+        for (size_t i = 0; i < kCapacity; ++i) buffer_[i].sequence.store(i);
+        enqueuePos_.store(0);
+        dequeuePos_.store(0);
+    }
+    void tearDownKernel() override {}
+
+    void runKernel() override {
+        for (size_t i = 0; i < kBatch; ++i) tryPush(static_cast<double>(i));
+        double value = 0.0;
+        for (size_t i = 0; i < kBatch; ++i) {
+            tryPop(value);
+            checksum_ += value;
+        }
+        doNotOptimize(checksum_);
+    }
+
+    double itemsPerIteration() const override { return 2.0 * kBatch; }
+    std::string itemUnit() const override { return "ops"; }
+
+public:
+    std::string getBenchmarkName() const override { return "Bounded queue push/pop"; }
+};
+
+// LRU list plus hash index as in JobResultCache (pattern 12): lookups
+// with splice-to-front, about 90% hits, misses insert and evict the tail
+class LruCacheKernelBenchmark : public PerformanceBenchmark {
+private:
+    static constexpr size_t kCapacity = 4096;
+    static constexpr size_t kLookups = 1024;
+
+    std::list<std::pair<std::string, double>> lru_;   // Most recently used first
+    std::unordered_map<std::string, std::list<std::pair<std::string, double>>::iterator> index_;
+    std::vector<std::string> keys_;
+    size_t cursor_ = 0;
+    size_t hits_ = 0;
+
+    double lookup(const std::string& key) {
+        auto found = index_.find(key);
+        if (found != index_.end()) {
+            lru_.splice(lru_.begin(), lru_, found->second);
+            hits_++;
+            return found->second->second;
+        }
+        if (lru_.size() >= kCapacity) {
+            index_.erase(lru_.back().first);
+            lru_.pop_back();
+        }
+        lru_.emplace_front(key, static_cast<double>(key.size()));
+        index_[key] = lru_.begin();
+        return lru_.front().second;
+    }
+
+protected:
+    void measurementPhase() override {}
+
+    void setUpKernel() override {
+        lru_.clear();
+        index_.clear();
+        index_.reserve(2 * kCapacity);
+        keys_.clear();
+        std::mt19937 gen(7);
+        // 90% of lookups from a hot set that fits, 10% from a cold tail
+        std::uniform_int_distribution<int> hot{0, int(kCapacity * 3 / 4) - 1};
+        std::uniform_int_distribution<int> cold{int(kCapacity), int(kCapacity) * 64};
+        std::uniform_real_distribution<double> coin(0.0, 1.0);
+        for (size_t i = 0; i < 64 * kLookups; ++i) {
+            int id = coin(gen) < 0.9 ? hot(gen) : cold(gen);
+            keys_.push_back("job-" + std::to_string(id));
+        }
+        for (int id = 0; id < int(kCapacity * 3 / 4); ++id) lookup("job-" + std::to_string(id));
+        cursor_ = 0;
+        hits_ = 0;
+    }
+    void tearDownKernel() override {}
+
+    void runKernel() override {
+        double sum = 0.0;
+        for (size_t i = 0; i < kLookups; ++i) {
+            sum += lookup(keys_[cursor_]);
+            cursor_ = (cursor_ + 1) % keys_.size();
+        }
+        doNotOptimize(sum);
+    }
+
+    double itemsPerIteration() const override { return kLookups; }
+    std::string itemUnit() const override { return "lookups"; }
+
+public:
+    std::string getBenchmarkName() const override { return "LRU cache lookup"; }
+};
+
+// f(x, y) = sin(x) * y + x * x / (1 + y * y) over a block of points, either
+// by walking a virtual expression tree per point or by running register
+// bytecode a block at a time as BytecodeProgram does (pattern 23)
+class InterpreterKernelBenchmark : public PerformanceBenchmark {
+private:
+    struct Node {
+        virtual ~Node() = default;
+        virtual double eval(const double* vars) const = 0;
+    };
+    struct Var : Node {
+        int slot;
+        explicit Var(int s) : slot(s) {}
+        double eval(const double* vars) const override { return vars[slot]; }
+    };
+    struct Const : Node {
+        double value;
+        explicit Const(double v) : value(v) {}
+        double eval(const double*) const override { return value; }
+    };
+    struct Binary : Node {
+        char op;
+        std::unique_ptr<Node> lhs, rhs;
+        Binary(char o, std::unique_ptr<Node> l, std::unique_ptr<Node> r)
+            : op(o), lhs(std::move(l)), rhs(std::move(r)) {}
+        double eval(const double* vars) const override {
+            double a = lhs->eval(vars), b = rhs->eval(vars);
+            switch (op) {
+                case '+': return a + b;
+                case '*': return a * b;
+                default:  return a / b;
+            }
+        }
+    };
+    struct Sin : Node {
+        std::unique_ptr<Node> arg;
+        explicit Sin(std::unique_ptr<Node> a) : arg(std::move(a)) {}
+        double eval(const double* vars) const override { return std::sin(arg->eval(vars)); }
+    };
+
+    enum class Op : uint8_t { Add, Mul, Div, Sin };
+    struct Instruction { Op op; uint8_t dst, a, b; };
+
+    static constexpr size_t kBlock = 256;
+    bool bytecode_;
+    std::unique_ptr<Node> tree_;
+    std::vector<Instruction> code_;
+    std::vector<double> registers_;   // Register r occupies [r * kBlock, (r + 1) * kBlock)
+    std::vector<double> xs_, ys_, out_;
+
+    template <typename... Args>
+    static std::unique_ptr<Node> node(char op, Args&&... args) {
+        return std::unique_ptr<Node>(new Binary(op, std::forward<Args>(args)...));
+    }
+
+protected:
+    void measurementPhase() override {}
+
+    void setUpKernel() override {
+        xs_.resize(kBlock);
+        ys_.resize(kBlock);
+        out_.assign(kBlock, 0.0);
+        for (size_t i = 0; i < kBlock; ++i) {
+            xs_[i] = 0.01 * i;
+            ys_[i] = 1.0 - 0.005 * i;
+        }
+        auto x = [] { return std::unique_ptr<Node>(new Var(0)); };
+        auto y = [] { return std::unique_ptr<Node>(new Var(1)); };
+        tree_ = node('+',
+                     node('*', std::unique_ptr<Node>(new Sin(x())), y()),
+                     node('/', node('*', x(), x()),
+                               node('+', std::unique_ptr<Node>(new Const(1.0)), node('*', y(), y()))));
+        // r0 = x, r1 = y, r2 = 1
+        code_ = {
+            {Op::Sin, 3, 0, 0}, {Op::Mul, 3, 3, 1},      // r3 = sin(x) * y
+            {Op::Mul, 4, 0, 0}, {Op::Mul, 5, 1, 1},      // r4 = x * x, r5 = y * y
+            {Op::Add, 5, 2, 5}, {Op::Div, 4, 4, 5},      // r4 = r4 / (1 + r5)
+            {Op::Add, 3, 3, 4}
+        };
+        registers_.assign(6 * kBlock, 0.0);
+        std::copy(xs_.begin(), xs_.end(), registers_.begin());
+        std::copy(ys_.begin(), ys_.end(), registers_.begin() + kBlock);
+        std::fill(registers_.begin() + 2 * kBlock, registers_.begin() + 3 * kBlock, 1.0);
+    }
+    void tearDownKernel() override {}
+
+    void runKernel() override {
+        if (!bytecode_) {
+            double vars[2];
+            for (size_t i = 0; i < kBlock; ++i) {
+                vars[0] = xs_[i];
+                vars[1] = ys_[i];
+                out_[i] = tree_->eval(vars);
+            }
+            doNotOptimize(out_[0]);
+            return;
+        }
+        double* regs = registers_.data();
+        for (const Instruction& ins : code_) {
+            double* d = regs + ins.dst * kBlock;
+            const double* a = regs + ins.a * kBlock;
+            const double* b = regs + ins.b * kBlock;
+            switch (ins.op) {
+                case Op::Add: for (size_t i = 0; i < kBlock; ++i) d[i] = a[i] + b[i]; break;
+                case Op::Mul: for (size_t i = 0; i < kBlock; ++i) d[i] = a[i] * b[i]; break;
+                case Op::Div: for (size_t i = 0; i < kBlock; ++i) d[i] = a[i] / b[i]; break;
+                case Op::Sin: for (size_t i = 0; i < kBlock; ++i) d[i] = std::sin(a[i]); break;
+            }
+        }
+        doNotOptimize(regs[3 * kBlock]);
+    }
+
+    double itemsPerIteration() const override { return kBlock; }
+    std::string itemUnit() const override { return "evals"; }
+
+public:
+    explicit InterpreterKernelBenchmark(bool bytecode) : bytecode_(bytecode) {}
+
+    std::string getBenchmarkName() const override {
+        return bytecode_ ? "Interpreter (block bytecode)" : "Interpreter (tree walk)";
+    }
+};
+
+// Runs a set of benchmarks under one configuration and exports the reports
+class BenchmarkSuite {
+private:
+    BenchmarkConfig config_;
+    std::vector<std::unique_ptr<PerformanceBenchmark>> benchmarks_;
+    std::vector<BenchmarkReport> reports_;
+
+    static std::string formatNanoseconds(double ns) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(ns < 10.0 ? 2 : 1);
+        if (ns < 1e3) out << ns << " ns";
+        else if (ns < 1e6) out << ns / 1e3 << " us";
+        else if (ns < 1e9) out << ns / 1e6 << " ms";
+        else out << ns / 1e9 << " s";
+        return out.str();
+    }
+
+    static std::string formatRate(double perSecond, const std::string& unit) {
+        const char* prefixes[] = {"", "K", "M", "G", "T"};
+        int p = 0;
+        while (perSecond >= 1000.0 && p < 4) {
+            perSecond /= 1000.0;
+            ++p;
+        }
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(2) << perSecond << " " << prefixes[p] << unit << "/s";
+        return out.str();
+    }
+
+    static std::string jsonEscape(const std::string& text) {
+        std::string out;
+        for (char c : text) {
+            if (c == '"' || c == '\\') out += '\\';
+            out += c;
+        }
+        return out;
+    }
+
+    // setw counts bytes; names such as "π" need padding by code point
+    static std::string padRight(const std::string& text, size_t width) {
+        size_t columns = 0;
+        for (char c : text) columns += (static_cast<unsigned char>(c) & 0xC0) != 0x80;
+        return text + std::string(columns < width ? width - columns : 0, ' ');
+    }
+
+    // Quoted per RFC 4180: an embedded quote is doubled
+    static std::string csvField(const std::string& text) {
+        std::string field = "\"";
+        for (char c : text) {
+            if (c == '"') field += '"';
+            field += c;
+        }
+        return field + "\"";
+    }
+
+public:
+    explicit BenchmarkSuite(const BenchmarkConfig& config = BenchmarkConfig()) : config_(config) {}
+
+    void add(std::unique_ptr<PerformanceBenchmark> benchmark) {
+        benchmarks_.push_back(std::move(benchmark));
+    }
+
+    const std::vector<BenchmarkReport>& run(std::ostream& out) {
+        reports_.clear();
+        out << std::left << std::setw(36) << "Benchmark" << std::right
+            << std::setw(10) << "iters" << std::setw(12) << "median"
+            << std::setw(12) << "p95" << std::setw(8) << "rsd"
+            << std::setw(6) << "out" << "  throughput\n";
+        for (auto& benchmark : benchmarks_) {
+            reports_.push_back(benchmark->runStatistical(config_));
+            const BenchmarkReport& r = reports_.back();
+            out << padRight(r.name, 36);
+            if (!r.error.empty()) {
+                out << "  failed: " << r.error << "\n";
+                continue;
+            }
+            std::ostringstream rsd;
+            rsd << std::fixed << std::setprecision(1) << 100.0 * r.nsPerIteration.relativeStddev() << "%";
+            out << std::setw(10) << r.iterationsPerSample
+                << std::setw(12) << formatNanoseconds(r.nsPerIteration.median)
+                << std::setw(12) << formatNanoseconds(r.nsPerIteration.p95)
+                << std::setw(8) << rsd.str()
+                << std::setw(6) << r.nsPerIteration.rejected
+                << "  " << formatRate(r.itemsPerSecond(), r.unit) << "\n";
+            if (r.counters) {
+                out << "    " << std::fixed << std::setprecision(1)
+                    << r.cyclesPerIteration / r.itemsPerIteration << " cycles, "
+                    << r.instructionsPerIteration / r.itemsPerIteration << " instructions per "
+                    << r.unit << "; IPC " << std::setprecision(2)
+                    << (r.cyclesPerIteration > 0 ? r.instructionsPerIteration / r.cyclesPerIteration : 0.0)
+                    << "; " << std::setprecision(1) << r.cacheMissesPerIteration << " LLC misses/iter\n";
+            }
+        }
+        if (!reports_.empty()) {
+            const BenchmarkReport& r = reports_.front();
+            out << std::defaultfloat << config_.samples << " samples of >= " << config_.minSampleSeconds * 1e3
+                << " ms after " << config_.warmupSeconds * 1e3 << " ms warmup; CPU pin: "
+                << (r.pinnedCpu >= 0 ? std::to_string(r.pinnedCpu) : std::string("off"))
+                << "; hardware counters: " << r.counterStatus << "\n";
+        }
+        return reports_;
+    }
+
+    const std::vector<BenchmarkReport>& reports() const { return reports_; }
+
+    void writeJson(std::ostream& out) const {
+        out << std::setprecision(9) << "{\n  \"config\": {"
+            << "\"samples\": " << config_.samples
+            << ", \"min_sample_seconds\": " << config_.minSampleSeconds
+            << ", \"warmup_seconds\": " << config_.warmupSeconds
+            << ", \"outlier_threshold\": " << config_.outlierThreshold
+            << ", \"pin_cpu\": " << config_.pinCpu << "},\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < reports_.size(); ++i) {
+            const BenchmarkReport& r = reports_[i];
+            const SampleStatistics& s = r.nsPerIteration;
+            out << "    {\"name\": \"" << jsonEscape(r.name) << "\""
+                << ", \"unit\": \"" << jsonEscape(r.unit) << "\""
+                << ", \"items_per_iteration\": " << r.itemsPerIteration
+                << ", \"iterations_per_sample\": " << r.iterationsPerSample
+                << ", \"ns_per_iteration\": {\"median\": " << s.median << ", \"p95\": " << s.p95
+                << ", \"mean\": " << s.mean << ", \"stddev\": " << s.stddev
+                << ", \"min\": " << s.min << ", \"max\": " << s.max << ", \"mad\": " << s.mad
+                << ", \"kept\": " << s.kept << ", \"rejected\": " << s.rejected << "}"
+                << ", \"items_per_second\": " << r.itemsPerSecond()
+                << ", \"pinned_cpu\": " << r.pinnedCpu;
+            if (r.counters) {
+                out << ", \"counters\": {\"cycles\": " << r.cyclesPerIteration
+                    << ", \"instructions\": " << r.instructionsPerIteration
+                    << ", \"cache_misses\": " << r.cacheMissesPerIteration
+                    << ", \"branch_misses\": " << r.branchMissesPerIteration << "}";
+            } else {
+                out << ", \"counters\": null";
+            }
+            if (!r.error.empty()) out << ", \"error\": \"" << jsonEscape(r.error) << "\"";
+            out << "}" << (i + 1 < reports_.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+
+    void writeCsv(std::ostream& out) const {
+        out << "name,unit,items_per_iteration,iterations_per_sample,median_ns,p95_ns,mean_ns,"
+               "stddev_ns,min_ns,max_ns,kept,rejected,items_per_second,cycles,instructions,"
+               "cache_misses,branch_misses,error\n";
+        out << std::setprecision(9);
+        for (const BenchmarkReport& r : reports_) {
+            const SampleStatistics& s = r.nsPerIteration;
+            out << csvField(r.name) << "," << csvField(r.unit) << "," << r.itemsPerIteration << ","
+                << r.iterationsPerSample << "," << s.median << "," << s.p95 << "," << s.mean << ","
+                << s.stddev << "," << s.min << "," << s.max << "," << s.kept << "," << s.rejected << ","
+                << r.itemsPerSecond() << ",";
+            if (r.counters) {
+                out << r.cyclesPerIteration << "," << r.instructionsPerIteration << ","
+                    << r.cacheMissesPerIteration << "," << r.branchMissesPerIteration;
+            } else {
+                out << ",,,";
+            }
+            out << "," << csvField(r.error) << "\n";
+        }
+    }
+};
+
 // Template Method for Scientific Data Processing Pipeline
 class DataProcessingPipeline {
 public:
@@ -782,6 +2043,29 @@ int main() {
         std::cout << "\n";
     }
     
+    // Same template, statistical mode: calibrated batches, warmup, outlier
+    // rejection and hardware counters where the kernel allows them
+    std::cout << "=== Statistical Benchmark Harness ===\n\n";
+
+    BenchmarkConfig config;
+    config.pinCpu = 0;
+    BenchmarkSuite suite(config);
+    suite.add(std::make_unique<MatrixMultiplicationBenchmark>(256));
+    suite.add(std::make_unique<FFTBenchmark>(1024));
+    suite.add(std::make_unique<MonteCarloBenchmark>(1000000));
+    suite.add(std::make_unique<ObjectPoolKernelBenchmark>());
+    suite.add(std::make_unique<BoundedQueueKernelBenchmark>());
+    suite.add(std::make_unique<LruCacheKernelBenchmark>());
+    suite.add(std::make_unique<InterpreterKernelBenchmark>(false));
+    suite.add(std::make_unique<InterpreterKernelBenchmark>(true));
+    suite.run(std::cout);
+
+    std::ofstream json("benchmark_results.json");
+    suite.writeJson(json);
+    std::ofstream csv("benchmark_results.csv");
+    suite.writeCsv(csv);
+    std::cout << "Results written to benchmark_results.json and benchmark_results.csv\n";
+
     // Scientific Data Processing Pipelines
     std::cout << "\n=== Scientific Data Processing Pipelines ===\n\n";
     
@@ -12,6 +12,11 @@
 #include <cmath>
 #include <iomanip>
 #include <set>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <functional>
 
 // Define M_PI and M_E if not already defined (for MSVC compatibility)
 #ifndef M_PI
@@ -28,6 +33,14 @@ private:
     std::unordered_map<std::string, double> variables_;
     std::unordered_map<std::string, double> constants_;
     std::unordered_map<std::string, std::vector<double>> vectors_;
+    uint64_t revision_ = nextRevision();
+    
+    // Revisions are unique across contexts, so a cached value can never be
+    // mistaken for one computed against another context
+    static uint64_t nextRevision() {
+        static std::atomic<uint64_t> counter{0};
+        return ++counter;
+    }
     
 public:
     ScientificContext() {
@@ -43,6 +56,7 @@ public:
     
     void setVariable(const std::string& name, double value) {
         variables_[name] = value;
+        revision_ = nextRevision();
         std::cout << "Set " << name << " = " << std::scientific << std::setprecision(4) 
                   << value << "\n";
     }
@@ -81,6 +95,19 @@ public:
         throw std::runtime_error("Undefined vector: " + name);
     }
     
+    // Updates a variable without logging, for inner evaluation loops
+    void updateVariable(const std::string& name, double value) {
+        variables_[name] = value;
+        revision_ = nextRevision();
+    }
+    
+    // Changes whenever a variable is written
+    uint64_t revision() const { return revision_; }
+    
+    bool isConstant(const std::string& name) const {
+        return constants_.find(name) != constants_.end();
+    }
+    
     bool hasVariable(const std::string& name) const {
         return variables_.find(name) != variables_.end() || 
                constants_.find(name) != constants_.end();
@@ -113,12 +140,673 @@ public:
     }
 };
 
+class ExpressionCompiler;
+class SymbolicGraph;
+
 // Abstract Expression for scientific computation
 class Expression {
 public:
     virtual ~Expression() = default;
     virtual double evaluate(ScientificContext& context) = 0;
     virtual std::string toString() const = 0;
+    // Emits bytecode for this node and returns the register holding its value
+    virtual uint32_t compile(ExpressionCompiler& compiler) const = 0;
+    // Adds this node to a symbolic DAG and returns its node id; throws
+    // std::runtime_error for nodes without a symbolic form
+    virtual uint32_t lower(SymbolicGraph& graph) const = 0;
+};
+
+// Named scientific functions shared by the tree interpreter and the symbolic folder
+inline double evaluateFunction(const std::string& function, double arg) {
+    // Mathematical functions
+    if (function == "sin") return std::sin(arg);
+    if (function == "cos") return std::cos(arg);
+    if (function == "tan") return std::tan(arg);
+    if (function == "exp") return std::exp(arg);
+    if (function == "ln") return std::log(arg);
+    if (function == "log10") return std::log10(arg);
+    if (function == "sqrt") return std::sqrt(arg);
+    if (function == "abs") return std::abs(arg);
+    
+    // Hyperbolic functions
+    if (function == "sinh") return std::sinh(arg);
+    if (function == "cosh") return std::cosh(arg);
+    if (function == "tanh") return std::tanh(arg);
+    
+    // Special functions
+    if (function == "erf") return std::erf(arg);
+    if (function == "gamma") return std::tgamma(arg);
+    
+    throw std::runtime_error("Unknown function: " + function);
+}
+
+// ---------------------------------------------------------------------------
+// Bytecode compilation
+//
+// A parsed Expression tree can be lowered once into flat register bytecode and
+// then evaluated many times without virtual dispatch or name lookups. Every
+// instruction writes a fresh register (SSA form). Registers holding constants
+// are filled once, and variables are resolved at compile time to input slots.
+// Sub-expressions whose operands are all constants are folded by the compiler.
+// Execution processes a block of lanes per instruction, so each opcode is a
+// plain loop over arrays that the compiler can vectorize.
+// ---------------------------------------------------------------------------
+
+enum class OpCode : uint8_t {
+    Add, Sub, Mul, Div, Pow,
+    Sin, Cos, Tan, Exp, Ln, Log10, Sqrt, Abs,
+    Sinh, Cosh, Tanh, Erf, Gamma,
+    Integrate
+};
+
+struct Instruction {
+    OpCode op;
+    uint32_t dst;
+    uint32_t a;
+    uint32_t b;      // Unused by unary ops
+    uint32_t aux;    // Integral kernel index for Integrate
+};
+
+class BytecodeProgram {
+public:
+    static constexpr size_t kBlockSize = 256;
+    
+private:
+    friend class ExpressionCompiler;
+    
+    // Simpson's-rule kernel; the integrand is its own program whose inputs are
+    // the integration variable plus values captured from the enclosing program
+    struct IntegralKernel {
+        std::unique_ptr<BytecodeProgram> integrand;
+        size_t variableSlot;
+        std::vector<std::pair<size_t, uint32_t>> captures;   // (integrand slot, outer register)
+        int intervals;
+    };
+    
+    std::vector<Instruction> code_;
+    std::vector<std::pair<uint32_t, double>> constants_;   // (register, value)
+    std::vector<std::string> inputNames_;
+    std::vector<uint32_t> inputRegisters_;
+    std::vector<std::pair<std::string, uint32_t>> assignments_;
+    std::vector<IntegralKernel> integrals_;
+    size_t registerCount_ = 0;
+    uint32_t result_ = 0;
+    
+    static const char* opName(OpCode op) {
+        static const char* names[] = {
+            "add", "sub", "mul", "div", "pow",
+            "sin", "cos", "tan", "exp", "ln", "log10", "sqrt", "abs",
+            "sinh", "cosh", "tanh", "erf", "gamma", "integrate"
+        };
+        return names[static_cast<size_t>(op)];
+    }
+    
+    // Registers live at regs + r * stride; `lanes` <= stride values per register
+    void execute(double* regs, size_t stride, size_t lanes) const {
+        for (const Instruction& ins : code_) {
+            double* d = regs + ins.dst * stride;
+            const double* a = regs + ins.a * stride;
+            const double* b = regs + ins.b * stride;
+            
+            switch (ins.op) {
+                case OpCode::Add: for (size_t i = 0; i < lanes; ++i) d[i] = a[i] + b[i]; break;
+                case OpCode::Sub: for (size_t i = 0; i < lanes; ++i) d[i] = a[i] - b[i]; break;
+                case OpCode::Mul: for (size_t i = 0; i < lanes; ++i) d[i] = a[i] * b[i]; break;
+                case OpCode::Div: {
+                    bool zero = false;
+                    for (size_t i = 0; i < lanes; ++i) zero |= std::abs(b[i]) < 1e-15;
+                    if (zero) {
+                        throw std::runtime_error("Division by zero");
+                    }
+                    for (size_t i = 0; i < lanes; ++i) d[i] = a[i] / b[i];
+                    break;
+                }
+                case OpCode::Pow: for (size_t i = 0; i < lanes; ++i) d[i] = std::pow(a[i], b[i]); break;
+                case OpCode::Sin: for (size_t i = 0; i < lanes; ++i) d[i] = std::sin(a[i]); break;
+                case OpCode::Cos: for (size_t i = 0; i < lanes; ++i) d[i] = std::cos(a[i]); break;
+                case OpCode::Tan: for (size_t i = 0; i < lanes; ++i) d[i] = std::tan(a[i]); break;
+                case OpCode::Exp: for (size_t i = 0; i < lanes; ++i) d[i] = std::exp(a[i]); break;
+                case OpCode::Ln: for (size_t i = 0; i < lanes; ++i) d[i] = std::log(a[i]); break;
+                case OpCode::Log10: for (size_t i = 0; i < lanes; ++i) d[i] = std::log10(a[i]); break;
+                case OpCode::Sqrt: for (size_t i = 0; i < lanes; ++i) d[i] = std::sqrt(a[i]); break;
+                case OpCode::Abs: for (size_t i = 0; i < lanes; ++i) d[i] = std::abs(a[i]); break;
+                case OpCode::Sinh: for (size_t i = 0; i < lanes; ++i) d[i] = std::sinh(a[i]); break;
+                case OpCode::Cosh: for (size_t i = 0; i < lanes; ++i) d[i] = std::cosh(a[i]); break;
+                case OpCode::Tanh: for (size_t i = 0; i < lanes; ++i) d[i] = std::tanh(a[i]); break;
+                case OpCode::Erf: for (size_t i = 0; i < lanes; ++i) d[i] = std::erf(a[i]); break;
+                case OpCode::Gamma: for (size_t i = 0; i < lanes; ++i) d[i] = std::tgamma(a[i]); break;
+                case OpCode::Integrate: integrate(integrals_[ins.aux], a, b, d, regs, stride, lanes); break;
+            }
+        }
+    }
+    
+    // One batched integrand evaluation over all sample points per lane
+    void integrate(const IntegralKernel& kernel, const double* lower, const double* upper,
+                   double* out, const double* regs, size_t stride, size_t lanes) const {
+        const size_t samples = static_cast<size_t>(kernel.intervals) + 1;
+        const size_t slots = kernel.integrand->inputCount();
+        std::vector<std::vector<double>> inputs(slots, std::vector<double>(samples));
+        std::vector<const double*> inputPtrs(slots);
+        for (size_t s = 0; s < slots; ++s) inputPtrs[s] = inputs[s].data();
+        std::vector<double> f(samples);
+        
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            double a = lower[lane];
+            double h = (upper[lane] - a) / kernel.intervals;
+            std::vector<double>& x = inputs[kernel.variableSlot];
+            for (size_t i = 0; i < samples; ++i) x[i] = a + i * h;
+            for (const auto& capture : kernel.captures) {
+                std::fill(inputs[capture.first].begin(), inputs[capture.first].end(),
+                          regs[capture.second * stride + lane]);
+            }
+            
+            kernel.integrand->evaluateBatch(inputPtrs, f.data(), samples);
+            
+            double sum = f[0] + f[samples - 1];
+            double odd = 0.0, even = 0.0;
+            for (size_t i = 1; i + 1 < samples; i += 2) odd += f[i];
+            for (size_t i = 2; i + 1 < samples; i += 2) even += f[i];
+            out[lane] = (h / 3.0) * (sum + 4.0 * odd + 2.0 * even);
+        }
+    }
+    
+    void runScalar(const double* inputs, std::vector<double>& regs) const {
+        regs.resize(registerCount_);
+        fillConstants(regs.data(), 1, 1);
+        for (size_t s = 0; s < inputRegisters_.size(); ++s) {
+            regs[inputRegisters_[s]] = inputs[s];
+        }
+        execute(regs.data(), 1, 1);
+    }
+    
+    void fillConstants(double* regs, size_t stride, size_t lanes) const {
+        for (const auto& [reg, value] : constants_) {
+            std::fill(regs + reg * stride, regs + reg * stride + lanes, value);
+        }
+    }
+    
+public:
+    size_t inputCount() const { return inputNames_.size(); }
+    const std::vector<std::string>& inputNames() const { return inputNames_; }
+    size_t instructionCount() const { return code_.size(); }
+    size_t registerCount() const { return registerCount_; }
+    
+    // Scalar evaluation with input values given in inputNames() order
+    double evaluate(const double* inputs) const {
+        thread_local std::vector<double> regs;
+        runScalar(inputs, regs);
+        return regs[result_];
+    }
+    
+    // Looks each distinct variable up once, then applies any assignments
+    double evaluate(ScientificContext& context) const {
+        std::vector<double> inputs(inputNames_.size());
+        for (size_t s = 0; s < inputNames_.size(); ++s) {
+            inputs[s] = context.getVariable(inputNames_[s]);
+        }
+        std::vector<double> regs;
+        runScalar(inputs.data(), regs);
+        for (const auto& [name, reg] : assignments_) {
+            context.setVariable(name, regs[reg]);
+        }
+        return regs[result_];
+    }
+    
+    // Batched evaluation: inputs[s] points at `count` values for inputNames()[s]
+    void evaluateBatch(const std::vector<const double*>& inputs, double* out, size_t count) const {
+        if (inputs.size() != inputNames_.size()) {
+            throw std::invalid_argument("Expected " + std::to_string(inputNames_.size()) + " input arrays");
+        }
+        
+        std::vector<double> regs(registerCount_ * kBlockSize);
+        fillConstants(regs.data(), kBlockSize, kBlockSize);
+        
+        for (size_t start = 0; start < count; start += kBlockSize) {
+            size_t lanes = std::min(kBlockSize, count - start);
+            for (size_t s = 0; s < inputRegisters_.size(); ++s) {
+                std::copy(inputs[s] + start, inputs[s] + start + lanes,
+                          regs.data() + inputRegisters_[s] * kBlockSize);
+            }
+            execute(regs.data(), kBlockSize, lanes);
+            const double* result = regs.data() + result_ * kBlockSize;
+            std::copy(result, result + lanes, out + start);
+        }
+    }
+    
+    void evaluateBatch(const std::vector<const std::vector<double>*>& inputs, std::vector<double>& out) const {
+        size_t count = inputs.empty() ? out.size() : inputs[0]->size();
+        std::vector<const double*> ptrs;
+        for (const auto* input : inputs) {
+            if (input->size() != count) {
+                throw std::invalid_argument("Input arrays differ in length");
+            }
+            ptrs.push_back(input->data());
+        }
+        out.resize(count);
+        evaluateBatch(ptrs, out.data(), count);
+    }
+    
+    std::string disassemble() const {
+        std::stringstream ss;
+        for (size_t s = 0; s < inputNames_.size(); ++s) {
+            ss << "  r" << inputRegisters_[s] << " <- input " << inputNames_[s] << "\n";
+        }
+        for (const auto& [reg, value] : constants_) {
+            ss << "  r" << reg << " <- const " << std::scientific << std::setprecision(6) << value << "\n";
+        }
+        for (const Instruction& ins : code_) {
+            ss << "  r" << ins.dst << " = " << opName(ins.op) << " r" << ins.a;
+            if (ins.op <= OpCode::Pow || ins.op == OpCode::Integrate) ss << ", r" << ins.b;
+            ss << "\n";
+        }
+        ss << "  return r" << result_ << "\n";
+        return ss.str();
+    }
+};
+
+// Lowers an Expression tree into a BytecodeProgram; each node emits its own
+// instructions through compile() and returns the register holding its value
+class ExpressionCompiler {
+private:
+    struct Register {
+        bool isConstant;
+        double value;
+    };
+    
+    const ScientificContext& context_;
+    std::unique_ptr<BytecodeProgram> program_;
+    std::vector<Register> registers_;
+    std::unordered_map<std::string, uint32_t> inputSlots_;
+    std::unordered_map<uint64_t, uint32_t> constantPool_;      // Bit pattern -> register
+    std::unordered_map<uint64_t, uint32_t> valueNumbers_;      // (op, a, b) -> register
+    std::vector<std::pair<std::string, uint32_t>> bindings_;   // Innermost last
+    
+    uint32_t newRegister(bool isConstant, double value = 0.0) {
+        registers_.push_back({isConstant, value});
+        return static_cast<uint32_t>(registers_.size() - 1);
+    }
+    
+    uint32_t input(const std::string& name) {
+        uint32_t reg = newRegister(false);
+        inputSlots_.emplace(name, reg);
+        program_->inputNames_.push_back(name);
+        program_->inputRegisters_.push_back(reg);
+        return reg;
+    }
+    
+    static double apply(OpCode op, double a, double b) {
+        switch (op) {
+            case OpCode::Add: return a + b;
+            case OpCode::Sub: return a - b;
+            case OpCode::Mul: return a * b;
+            case OpCode::Div: return a / b;
+            case OpCode::Pow: return std::pow(a, b);
+            case OpCode::Sin: return std::sin(a);
+            case OpCode::Cos: return std::cos(a);
+            case OpCode::Tan: return std::tan(a);
+            case OpCode::Exp: return std::exp(a);
+            case OpCode::Ln: return std::log(a);
+            case OpCode::Log10: return std::log10(a);
+            case OpCode::Sqrt: return std::sqrt(a);
+            case OpCode::Abs: return std::abs(a);
+            case OpCode::Sinh: return std::sinh(a);
+            case OpCode::Cosh: return std::cosh(a);
+            case OpCode::Tanh: return std::tanh(a);
+            case OpCode::Erf: return std::erf(a);
+            case OpCode::Gamma: return std::tgamma(a);
+            case OpCode::Integrate: break;
+        }
+        throw std::logic_error("Cannot fold opcode");
+    }
+    
+public:
+    explicit ExpressionCompiler(const ScientificContext& context)
+        : context_(context), program_(new BytecodeProgram) {}
+    
+    uint32_t constant(double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        auto it = constantPool_.find(bits);
+        if (it != constantPool_.end()) {
+            return it->second;
+        }
+        uint32_t reg = newRegister(true, value);
+        constantPool_.emplace(bits, reg);
+        return reg;
+    }
+    
+    // Bound names (derivative/integral variables) first, then physical
+    // constants folded from the context, then program inputs
+    uint32_t variable(const std::string& name) {
+        for (auto it = bindings_.rbegin(); it != bindings_.rend(); ++it) {
+            if (it->first == name) return it->second;
+        }
+        if (context_.isConstant(name)) {
+            return constant(context_.getVariable(name));
+        }
+        auto it = inputSlots_.find(name);
+        if (it != inputSlots_.end()) {
+            return it->second;
+        }
+        return input(name);
+    }
+    
+    bool isConstant(uint32_t reg) const { return registers_[reg].isConstant; }
+    double constantValue(uint32_t reg) const { return registers_[reg].value; }
+    
+    uint32_t emit(OpCode op, uint32_t a, uint32_t b = 0) {
+        bool binary = op <= OpCode::Pow;
+        bool foldable = isConstant(a) && (!binary || isConstant(b));
+        // Leave x / 0 to fail at run time like the tree interpreter does
+        if (op == OpCode::Div && foldable && std::abs(constantValue(b)) < 1e-15) {
+            foldable = false;
+        }
+        if (foldable) {
+            return constant(apply(op, constantValue(a), binary ? constantValue(b) : 0.0));
+        }
+        // Small integer powers become multiplies, which vectorize
+        if (op == OpCode::Pow && isConstant(b)) {
+            double exponent = constantValue(b);
+            if (exponent == 1.0) return a;
+            if (exponent == 2.0) return emit(OpCode::Mul, a, a);
+            if (exponent == 3.0) return emit(OpCode::Mul, emit(OpCode::Mul, a, a), a);
+        }
+        // Reuse an identical pure instruction (Integrate never comes through here)
+        if (!binary) b = a;
+        uint64_t key = (uint64_t(op) << 56) | (uint64_t(a) << 28) | b;
+        auto it = valueNumbers_.find(key);
+        if (it != valueNumbers_.end()) {
+            return it->second;
+        }
+        uint32_t dst = newRegister(false);
+        program_->code_.push_back({op, dst, a, b, 0});
+        valueNumbers_.emplace(key, dst);
+        return dst;
+    }
+    
+    void bind(const std::string& name, uint32_t reg) { bindings_.emplace_back(name, reg); }
+    void unbind() { bindings_.pop_back(); }
+    
+    void assign(const std::string& name, uint32_t reg) {
+        program_->assignments_.emplace_back(name, reg);
+    }
+    
+    uint32_t integral(const Expression& integrand, const std::string& var,
+                      uint32_t lower, uint32_t upper, int intervals);
+    
+    std::unique_ptr<BytecodeProgram> finish(uint32_t result) {
+        BytecodeProgram& program = *program_;
+        program.result_ = result;
+        program.registerCount_ = registers_.size();
+        
+        // Only constants still referenced after folding need filling
+        std::vector<bool> used(registers_.size(), false);
+        used[result] = true;
+        for (const Instruction& ins : program.code_) {
+            used[ins.a] = used[ins.b] = true;
+        }
+        for (const auto& kernel : program.integrals_) {
+            for (const auto& capture : kernel.captures) used[capture.second] = true;
+        }
+        for (const auto& assignment : program.assignments_) used[assignment.second] = true;
+        for (uint32_t r = 0; r < registers_.size(); ++r) {
+            if (registers_[r].isConstant && used[r]) {
+                program.constants_.emplace_back(r, registers_[r].value);
+            }
+        }
+        return std::move(program_);
+    }
+};
+
+// The integrand becomes its own program: slot 0 is the integration variable,
+// every other input is captured from this program's registers
+inline uint32_t ExpressionCompiler::integral(const Expression& integrand, const std::string& var,
+                                             uint32_t lower, uint32_t upper, int intervals) {
+    ExpressionCompiler sub(context_);
+    sub.bind(var, sub.input(var));
+    std::unique_ptr<BytecodeProgram> body = sub.finish(integrand.compile(sub));
+    
+    BytecodeProgram::IntegralKernel kernel;
+    kernel.variableSlot = 0;
+    kernel.intervals = intervals;
+    for (size_t s = 1; s < body->inputNames_.size(); ++s) {
+        kernel.captures.emplace_back(s, variable(body->inputNames_[s]));
+    }
+    kernel.integrand = std::move(body);
+    program_->integrals_.push_back(std::move(kernel));
+    
+    uint32_t dst = newRegister(false);
+    program_->code_.push_back({OpCode::Integrate, dst, lower, upper,
+                               static_cast<uint32_t>(program_->integrals_.size() - 1)});
+    return dst;
+}
+
+inline std::unique_ptr<BytecodeProgram> compileExpression(const Expression& expression,
+                                                          const ScientificContext& context) {
+    ExpressionCompiler compiler(context);
+    return compiler.finish(expression.compile(compiler));
+}
+
+
+// ---------------------------------------------------------------------------
+// Symbolic differentiation
+//
+// Expressions lower into a hash-consed DAG: structurally identical
+// subexpressions become one node. Derivative rules repeat their operands
+// (f and g in f'g + fg', exp(u) inside d/dx exp(u)), so sharing keeps the
+// derivative compact. The builders fold constants and drop identities.
+// build() turns the DAG back into an Expression tree. Nodes with several
+// parents are wrapped in a SharedExpression that evaluates them once per pass.
+// ---------------------------------------------------------------------------
+
+class SymbolicGraph {
+public:
+    enum class Kind : uint8_t { Number, Variable, Function, Add, Sub, Mul, Div, Pow };
+    
+    struct Node {
+        Kind kind;
+        double value;       // Number
+        std::string name;   // Variable or function name
+        uint32_t a;         // Operand / function argument
+        uint32_t b;         // Second operand of binary nodes
+    };
+    
+private:
+    std::vector<Node> nodes_;
+    std::unordered_map<std::string, uint32_t> index_;     // Structural key -> node
+    std::unordered_map<std::string, std::unordered_map<uint32_t, uint32_t>> derivatives_;  // Per variable
+    
+    static bool isBinary(Kind kind) { return kind >= Kind::Add; }
+    
+    uint32_t intern(Kind kind, double value, const std::string& name, uint32_t a, uint32_t b) {
+        std::string key(1, static_cast<char>(kind));
+        key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        key.append(reinterpret_cast<const char*>(&a), sizeof(a));
+        key.append(reinterpret_cast<const char*>(&b), sizeof(b));
+        key += name;
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            return it->second;
+        }
+        uint32_t id = static_cast<uint32_t>(nodes_.size());
+        nodes_.push_back({kind, value, name, a, b});
+        index_.emplace(std::move(key), id);
+        return id;
+    }
+    
+    bool isNumber(uint32_t id) const { return nodes_[id].kind == Kind::Number; }
+    bool isNumber(uint32_t id, double value) const {
+        return isNumber(id) && nodes_[id].value == value;
+    }
+    
+    uint32_t binary(Kind kind, uint32_t a, uint32_t b) {
+        return intern(kind, 0.0, std::string(), a, b);
+    }
+    
+    // Commutative operands are ordered (numbers first) so x*y and y*x share a node
+    void order(uint32_t& a, uint32_t& b) const {
+        if (isNumber(b) && !isNumber(a)) std::swap(a, b);
+        else if (isNumber(a) == isNumber(b) && a > b) std::swap(a, b);
+    }
+    
+public:
+    uint32_t number(double value) {
+        return intern(Kind::Number, value, std::string(), 0, 0);
+    }
+    
+    uint32_t variable(const std::string& name) {
+        return intern(Kind::Variable, 0.0, name, 0, 0);
+    }
+    
+    uint32_t function(const std::string& name, uint32_t arg) {
+        if (isNumber(arg)) return number(evaluateFunction(name, nodes_[arg].value));
+        return intern(Kind::Function, 0.0, name, arg, 0);
+    }
+    
+    uint32_t add(uint32_t a, uint32_t b) {
+        order(a, b);
+        if (isNumber(a) && isNumber(b)) return number(nodes_[a].value + nodes_[b].value);
+        if (isNumber(a, 0.0)) return b;
+        if (a == b) return mul(number(2.0), a);
+        return binary(Kind::Add, a, b);
+    }
+    
+    uint32_t sub(uint32_t a, uint32_t b) {
+        if (isNumber(a) && isNumber(b)) return number(nodes_[a].value - nodes_[b].value);
+        if (isNumber(b, 0.0)) return a;
+        if (a == b) return number(0.0);
+        // 0 - c*x -> (-c)*x
+        if (isNumber(a, 0.0) && nodes_[b].kind == Kind::Mul && isNumber(nodes_[b].a)) {
+            return mul(number(-nodes_[nodes_[b].a].value), nodes_[b].b);
+        }
+        return binary(Kind::Sub, a, b);
+    }
+    
+    uint32_t mul(uint32_t a, uint32_t b) {
+        order(a, b);
+        if (isNumber(a) && isNumber(b)) return number(nodes_[a].value * nodes_[b].value);
+        if (isNumber(a, 0.0)) return a;
+        if (isNumber(a, 1.0)) return b;
+        // c1 * (c2 * x) -> (c1 c2) * x
+        if (isNumber(a) && nodes_[b].kind == Kind::Mul && isNumber(nodes_[b].a)) {
+            return mul(number(nodes_[a].value * nodes_[nodes_[b].a].value), nodes_[b].b);
+        }
+        return binary(Kind::Mul, a, b);
+    }
+    
+    uint32_t div(uint32_t a, uint32_t b) {
+        // Division by a literal zero is left in place to fail at evaluation
+        if (isNumber(a) && isNumber(b) && nodes_[b].value != 0.0) {
+            return number(nodes_[a].value / nodes_[b].value);
+        }
+        if (isNumber(a, 0.0) && !isNumber(b, 0.0)) return a;
+        if (isNumber(b, 1.0)) return a;
+        return binary(Kind::Div, a, b);
+    }
+    
+    uint32_t pow(uint32_t a, uint32_t b) {
+        if (isNumber(a) && isNumber(b)) return number(std::pow(nodes_[a].value, nodes_[b].value));
+        if (isNumber(b, 0.0)) return number(1.0);
+        if (isNumber(b, 1.0)) return a;
+        // Squares are the common case and a multiply is much cheaper than pow()
+        if (isNumber(b, 2.0)) return mul(a, a);
+        return binary(Kind::Pow, a, b);
+    }
+    
+    // d(node)/d(variable), memoized so shared subexpressions are differentiated once
+    uint32_t derivative(uint32_t id, const std::string& variable) {
+        auto& memo = derivatives_[variable];
+        auto it = memo.find(id);
+        if (it != memo.end()) {
+            return it->second;
+        }
+        
+        Node node = nodes_[id];  // Copy: nodes_ grows while we recurse
+        uint32_t result;
+        switch (node.kind) {
+            case Kind::Number:
+                result = number(0.0);
+                break;
+            case Kind::Variable:
+                result = number(node.name == variable ? 1.0 : 0.0);
+                break;
+            case Kind::Add:
+                result = add(derivative(node.a, variable), derivative(node.b, variable));
+                break;
+            case Kind::Sub:
+                result = sub(derivative(node.a, variable), derivative(node.b, variable));
+                break;
+            case Kind::Mul: {
+                uint32_t da = derivative(node.a, variable);
+                uint32_t db = derivative(node.b, variable);
+                result = add(mul(da, node.b), mul(node.a, db));
+                break;
+            }
+            case Kind::Div: {
+                uint32_t da = derivative(node.a, variable);
+                uint32_t db = derivative(node.b, variable);
+                if (isNumber(db, 0.0)) {
+                    result = div(da, node.b);
+                } else {
+                    result = div(sub(mul(da, node.b), mul(node.a, db)), mul(node.b, node.b));
+                }
+                break;
+            }
+            case Kind::Pow: {
+                uint32_t da = derivative(node.a, variable);
+                uint32_t db = derivative(node.b, variable);
+                if (isNumber(db, 0.0)) {
+                    // Power rule: b a^(b-1) a'
+                    result = mul(mul(node.b, pow(node.a, sub(node.b, number(1.0)))), da);
+                } else {
+                    // a^b (b' ln a + b a' / a)
+                    result = mul(id, add(mul(db, function("ln", node.a)),
+                                         div(mul(node.b, da), node.a)));
+                }
+                break;
+            }
+            case Kind::Function: {
+                uint32_t du = derivative(node.a, variable);
+                if (isNumber(du, 0.0)) {
+                    result = du;
+                    break;
+                }
+                uint32_t u = node.a;
+                uint32_t outer;
+                if (node.name == "sin") outer = function("cos", u);
+                else if (node.name == "cos") outer = sub(number(0.0), function("sin", u));
+                else if (node.name == "tan") {
+                    uint32_t c = function("cos", u);
+                    outer = div(number(1.0), mul(c, c));
+                }
+                else if (node.name == "exp") outer = id;
+                else if (node.name == "ln") outer = div(number(1.0), u);
+                else if (node.name == "log10") outer = div(number(1.0), mul(number(std::log(10.0)), u));
+                else if (node.name == "sqrt") outer = div(number(0.5), id);
+                else if (node.name == "abs") outer = div(u, id);
+                else if (node.name == "sinh") outer = function("cosh", u);
+                else if (node.name == "cosh") outer = function("sinh", u);
+                else if (node.name == "tanh") outer = sub(number(1.0), mul(id, id));
+                else if (node.name == "erf") {
+                    outer = mul(number(2.0 / std::sqrt(M_PI)),
+                                function("exp", sub(number(0.0), mul(u, u))));
+                }
+                else throw std::runtime_error("No symbolic derivative for " + node.name);
+                result = mul(outer, du);
+                break;
+            }
+            default:
+                throw std::logic_error("Unknown symbolic node");
+        }
+        
+        memo.emplace(id, result);
+        return result;
+    }
+    
+    // Rebuilds an evaluable tree rooted at id; defined after the expression classes
+    std::unique_ptr<Expression> build(uint32_t root) const;
+    
+    size_t nodeCount() const { return nodes_.size(); }
 };
 
 // Terminal Expression - Number
@@ -138,6 +826,14 @@ public:
         ss << std::scientific << std::setprecision(3) << value_;
         return ss.str();
     }
+    
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        return compiler.constant(value_);
+    }
+    
+    uint32_t lower(SymbolicGraph& graph) const override {
+        return graph.number(value_);
+    }
 };
 
 // Terminal Expression - Variable or Constant
@@ -156,6 +852,14 @@ public:
         return name_;
     }
     
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        return compiler.variable(name_);
+    }
+    
+    uint32_t lower(SymbolicGraph& graph) const override {
+        return graph.variable(name_);
+    }
+    
     const std::string& getName() const { return name_; }
 };
 
@@ -170,33 +874,31 @@ public:
         : function_(func), argument_(std::move(arg)) {}
     
     double evaluate(ScientificContext& context) override {
-        double arg = argument_->evaluate(context);
-        
-        // Mathematical functions
-        if (function_ == "sin") return std::sin(arg);
-        if (function_ == "cos") return std::cos(arg);
-        if (function_ == "tan") return std::tan(arg);
-        if (function_ == "exp") return std::exp(arg);
-        if (function_ == "ln") return std::log(arg);
-        if (function_ == "log10") return std::log10(arg);
-        if (function_ == "sqrt") return std::sqrt(arg);
-        if (function_ == "abs") return std::abs(arg);
-        
-        // Hyperbolic functions
-        if (function_ == "sinh") return std::sinh(arg);
-        if (function_ == "cosh") return std::cosh(arg);
-        if (function_ == "tanh") return std::tanh(arg);
-        
-        // Special functions
-        if (function_ == "erf") return std::erf(arg);
-        if (function_ == "gamma") return std::tgamma(arg);
-        
-        throw std::runtime_error("Unknown function: " + function_);
+        return evaluateFunction(function_, argument_->evaluate(context));
     }
     
     std::string toString() const override {
         return function_ + "(" + argument_->toString() + ")";
     }
+    
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        static const std::unordered_map<std::string, OpCode> opcodes = {
+            {"sin", OpCode::Sin}, {"cos", OpCode::Cos}, {"tan", OpCode::Tan},
+            {"exp", OpCode::Exp}, {"ln", OpCode::Ln}, {"log10", OpCode::Log10},
+            {"sqrt", OpCode::Sqrt}, {"abs", OpCode::Abs}, {"sinh", OpCode::Sinh},
+            {"cosh", OpCode::Cosh}, {"tanh", OpCode::Tanh}, {"erf", OpCode::Erf},
+            {"gamma", OpCode::Gamma}
+        };
+        auto it = opcodes.find(function_);
+        if (it == opcodes.end()) {
+            throw std::runtime_error("Unknown function: " + function_);
+        }
+        return compiler.emit(it->second, argument_->compile(compiler));
+    }
+    
+    uint32_t lower(SymbolicGraph& graph) const override {
+        return graph.function(function_, argument_->lower(graph));
+    }
 };
 
 // Non-terminal Expression - Addition
@@ -217,6 +919,16 @@ public:
     std::string toString() const override {
         return "(" + left_->toString() + " + " + right_->toString() + ")";
     }
+    
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        uint32_t a = left_->compile(compiler);
+        return compiler.emit(OpCode::Add, a, right_->compile(compiler));
+    }
+    
+    uint32_t lower(SymbolicGraph& graph) const override {
+        uint32_t a = left_->lower(graph);
+        return graph.add(a, right_->lower(graph));
+    }
 };
 
 // Non-terminal Expression - Subtraction
@@ -237,6 +949,16 @@ public:
     std::string toString() const override {
         return "(" + left_->toString() + " - " + right_->toString() + ")";
     }
+    
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        uint32_t a = left_->compile(compiler);
+        return compiler.emit(OpCode::Sub, a, right_->compile(compiler));
+    }
+    
+    uint32_t lower(SymbolicGraph& graph) const override {
+        uint32_t a = left_->lower(graph);
+        return graph.sub(a, right_->lower(graph));
+    }
 };
 
 // Non-terminal Expression - Multiplication
@@ -257,6 +979,16 @@ public:
     std::string toString() const override {
         return "(" + left_->toString() + " * " + right_->toString() + ")";
     }
+    
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        uint32_t a = left_->compile(compiler);
+        return compiler.emit(OpCode::Mul, a, right_->compile(compiler));
+    }
+    
+    uint32_t lower(SymbolicGraph& graph) const override {
+        uint32_t a = left_->lower(graph);
+        return graph.mul(a, right_->lower(graph));
+    }
 };
 
 // Non-terminal Expression - Division
@@ -281,6 +1013,16 @@ public:
     std::string toString() const override {
         return "(" + left_->toString() + " / " + right_->toString() + ")";
     }
+    
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        uint32_t a = left_->compile(compiler);
+        return compiler.emit(OpCode::Div, a, right_->compile(compiler));
+    }
+    
+    uint32_t lower(SymbolicGraph& graph) const override {
+        uint32_t a = left_->lower(graph);
+        return graph.div(a, right_->lower(graph));
+    }
 };
 
 // Power Expression
@@ -301,6 +1043,16 @@ public:
     std::string toString() const override {
         return "(" + base_->toString() + " ^ " + exponent_->toString() + ")";
     }
+    
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        uint32_t a = base_->compile(compiler);
+        return compiler.emit(OpCode::Pow, a, exponent_->compile(compiler));
+    }
+    
+    uint32_t lower(SymbolicGraph& graph) const override {
+        uint32_t a = base_->lower(graph);
+        return graph.pow(a, exponent_->lower(graph));
+    }
 };
 
 // Assignment Expression
@@ -323,31 +1075,55 @@ public:
     std::string toString() const override {
         return variableName_ + " = " + value_->toString();
     }
+    
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        uint32_t reg = value_->compile(compiler);
+        compiler.assign(variableName_, reg);
+        return reg;
+    }
+    
+    uint32_t lower(SymbolicGraph&) const override {
+        throw std::runtime_error("Assignment has no symbolic form: " + toString());
+    }
 };
 
-// Derivative Expression (numerical differentiation)
+// Derivative Expression. The derivative is taken symbolically once, at
+// construction; numerical differentiation is kept for functions without
+// symbolic rules (gamma, integrals, assignments)
 class DerivativeExpression : public Expression {
 private:
     std::unique_ptr<Expression> function_;
     std::string variable_;
+    std::unique_ptr<Expression> symbolic_;  // Null when falling back to finite differences
     double h_ = 1e-8;  // Step size
     
 public:
     DerivativeExpression(std::unique_ptr<Expression> func, const std::string& var)
-        : function_(std::move(func)), variable_(var) {}
+        : function_(std::move(func)), variable_(var) {
+        try {
+            SymbolicGraph graph;
+            symbolic_ = graph.build(graph.derivative(function_->lower(graph), variable_));
+        } catch (const std::runtime_error&) {
+            symbolic_.reset();
+        }
+    }
     
     double evaluate(ScientificContext& context) override {
+        if (symbolic_) {
+            return symbolic_->evaluate(context);
+        }
+        
         double x0 = context.getVariable(variable_);
         
         // Forward difference approximation
-        context.setVariable(variable_, x0 + h_);
+        context.updateVariable(variable_, x0 + h_);
         double f_plus = function_->evaluate(context);
         
-        context.setVariable(variable_, x0 - h_);
+        context.updateVariable(variable_, x0 - h_);
         double f_minus = function_->evaluate(context);
         
         // Restore original value
-        context.setVariable(variable_, x0);
+        context.updateVariable(variable_, x0);
         
         // Central difference
         return (f_plus - f_minus) / (2.0 * h_);
@@ -356,6 +1132,35 @@ public:
     std::string toString() const override {
         return "d/d" + variable_ + "[" + function_->toString() + "]";
     }
+    
+    // Both central-difference samples are inlined with the variable rebound,
+    // so the derivative vectorizes like any other expression
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        if (symbolic_) {
+            return symbolic_->compile(compiler);
+        }
+        uint32_t x = compiler.variable(variable_);
+        uint32_t step = compiler.constant(h_);
+        
+        compiler.bind(variable_, compiler.emit(OpCode::Add, x, step));
+        uint32_t fPlus = function_->compile(compiler);
+        compiler.unbind();
+        
+        compiler.bind(variable_, compiler.emit(OpCode::Sub, x, step));
+        uint32_t fMinus = function_->compile(compiler);
+        compiler.unbind();
+        
+        uint32_t diff = compiler.emit(OpCode::Sub, fPlus, fMinus);
+        return compiler.emit(OpCode::Div, diff, compiler.constant(2.0 * h_));
+    }
+    
+    // Nested derivatives differentiate the inner function twice
+    uint32_t lower(SymbolicGraph& graph) const override {
+        return graph.derivative(function_->lower(graph), variable_);
+    }
+    
+    bool isSymbolic() const { return symbolic_ != nullptr; }
+    const Expression* symbolicForm() const { return symbolic_.get(); }
 };
 
 // Integral Expression (numerical integration using Simpson's rule)
@@ -366,6 +1171,7 @@ private:
     std::unique_ptr<Expression> lower_;
     std::unique_ptr<Expression> upper_;
     int n_ = 1000;  // Number of intervals
+    std::unique_ptr<BytecodeProgram> compiled_;
     
 public:
     IntegralExpression(std::unique_ptr<Expression> func, const std::string& var,
@@ -373,38 +1179,126 @@ public:
         : function_(std::move(func)), variable_(var), 
           lower_(std::move(lower)), upper_(std::move(upper)) {}
     
+    // The integrand is compiled on first use, after which all Simpson samples
+    // are evaluated as one batch instead of one tree walk per sample
     double evaluate(ScientificContext& context) override {
-        double a = lower_->evaluate(context);
-        double b = upper_->evaluate(context);
-        double h = (b - a) / n_;
-        
-        double x0 = context.getVariable(variable_);  // Save original value
-        
-        // Simpson's rule
-        context.setVariable(variable_, a);
-        double sum = function_->evaluate(context);
-        
-        context.setVariable(variable_, b);
-        sum += function_->evaluate(context);
-        
-        for (int i = 1; i < n_; i++) {
-            double x = a + i * h;
-            context.setVariable(variable_, x);
-            double fx = function_->evaluate(context);
-            sum += (i % 2 == 0) ? 2 * fx : 4 * fx;
+        if (!compiled_) {
+            compiled_ = compileExpression(*this, context);
         }
-        
-        context.setVariable(variable_, x0);  // Restore original value
-        
-        return (h / 3.0) * sum;
+        return compiled_->evaluate(context);
     }
     
     std::string toString() const override {
         return "∫(" + lower_->toString() + " to " + upper_->toString() + 
                ") " + function_->toString() + " d" + variable_;
     }
+    
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        uint32_t a = lower_->compile(compiler);
+        uint32_t b = upper_->compile(compiler);
+        return compiler.integral(*function_, variable_, a, b, n_);
+    }
+    
+    uint32_t lower(SymbolicGraph&) const override {
+        throw std::runtime_error("Integral has no symbolic form: " + toString());
+    }
+};
+
+// Common subexpression produced by SymbolicGraph::build. Every parent holds its
+// own SharedExpression, but they all point at one Cell, whose value is cached
+// until the context's next variable write
+class SharedExpression : public Expression {
+public:
+    struct Cell {
+        std::unique_ptr<Expression> expression;
+        uint64_t revision = 0;
+        double value = 0.0;
+    };
+    
+private:
+    std::shared_ptr<Cell> cell_;
+    
+public:
+    explicit SharedExpression(std::shared_ptr<Cell> cell) : cell_(std::move(cell)) {}
+    
+    double evaluate(ScientificContext& context) override {
+        Cell& cell = *cell_;
+        if (cell.revision != context.revision()) {
+            cell.value = cell.expression->evaluate(context);
+            cell.revision = context.revision();
+        }
+        return cell.value;
+    }
+    
+    std::string toString() const override {
+        return cell_->expression->toString();
+    }
+    
+    // Repeats are merged again by the compiler's value numbering
+    uint32_t compile(ExpressionCompiler& compiler) const override {
+        return cell_->expression->compile(compiler);
+    }
+    
+    uint32_t lower(SymbolicGraph& graph) const override {
+        return cell_->expression->lower(graph);
+    }
 };
 
+inline std::unique_ptr<Expression> SymbolicGraph::build(uint32_t root) const {
+    // Count parents of every node reachable from the root
+    std::vector<uint32_t> parents(nodes_.size(), 0);
+    std::vector<bool> seen(nodes_.size(), false);
+    std::vector<uint32_t> stack{root};
+    seen[root] = true;
+    while (!stack.empty()) {
+        const Node& node = nodes_[stack.back()];
+        stack.pop_back();
+        uint32_t children[2] = {node.a, node.b};
+        size_t arity = isBinary(node.kind) ? 2 : (node.kind == Kind::Function ? 1 : 0);
+        for (size_t c = 0; c < arity; ++c) {
+            ++parents[children[c]];
+            if (!seen[children[c]]) {
+                seen[children[c]] = true;
+                stack.push_back(children[c]);
+            }
+        }
+    }
+    
+    std::unordered_map<uint32_t, std::shared_ptr<SharedExpression::Cell>> cells;
+    std::function<std::unique_ptr<Expression>(uint32_t)> make = [&](uint32_t id) {
+        const Node& node = nodes_[id];
+        // Variables are shared too: a cache hit is cheaper than two name lookups
+        bool shared = parents[id] > 1 && node.kind != Kind::Number;
+        if (shared) {
+            auto it = cells.find(id);
+            if (it != cells.end()) {
+                return std::unique_ptr<Expression>(std::make_unique<SharedExpression>(it->second));
+            }
+        }
+        
+        std::unique_ptr<Expression> expression;
+        switch (node.kind) {
+            case Kind::Number:   expression = std::make_unique<NumberExpression>(node.value); break;
+            case Kind::Variable: expression = std::make_unique<VariableExpression>(node.name); break;
+            case Kind::Function: expression = std::make_unique<FunctionExpression>(node.name, make(node.a)); break;
+            case Kind::Add:      expression = std::make_unique<AddExpression>(make(node.a), make(node.b)); break;
+            case Kind::Sub:      expression = std::make_unique<SubtractExpression>(make(node.a), make(node.b)); break;
+            case Kind::Mul:      expression = std::make_unique<MultiplyExpression>(make(node.a), make(node.b)); break;
+            case Kind::Div:      expression = std::make_unique<DivideExpression>(make(node.a), make(node.b)); break;
+            case Kind::Pow:      expression = std::make_unique<PowerExpression>(make(node.a), make(node.b)); break;
+        }
+        
+        if (shared) {
+            auto cell = std::make_shared<SharedExpression::Cell>();
+            cell->expression = std::move(expression);
+            cells.emplace(id, cell);
+            return std::unique_ptr<Expression>(std::make_unique<SharedExpression>(std::move(cell)));
+        }
+        return expression;
+    };
+    return make(root);
+}
+
 // Parser for scientific expressions
 class ExpressionParser {
 private:
@@ -448,22 +1342,25 @@ private:
         
         bool hasDecimal = false;
         bool hasExponent = false;
+        bool hasDigit = false;
         
         for (size_t i = idx; i < token.length(); ++i) {
-            if (token[i] == '.') {
+            if (std::isdigit(token[i])) {
+                hasDigit = true;
+            } else if (token[i] == '.') {
                 if (hasDecimal || hasExponent) return false;
                 hasDecimal = true;
             } else if (token[i] == 'e' || token[i] == 'E') {
-                if (hasExponent) return false;
+                if (hasExponent || !hasDigit) return false;
                 hasExponent = true;
                 if (i + 1 < token.length() && (token[i+1] == '-' || token[i+1] == '+')) {
                     i++;
                 }
-            } else if (!std::isdigit(token[i])) {
+            } else {
                 return false;
             }
         }
-        return idx < token.length();
+        return hasDigit;
     }
     
     bool isVariable(const std::string& token) const {
@@ -515,6 +1412,12 @@ private:
             return std::make_unique<VariableExpression>(token);
         }
         
+        // Unary minus binds looser than '^': - x ^ 2 is -(x^2)
+        if (token == "-") {
+            return std::make_unique<SubtractExpression>(
+                std::make_unique<NumberExpression>(0.0), parsePower());
+        }
+        
         if (token == "(") {
             auto expr = parseExpression();
             if (nextToken() != ")") {
@@ -809,6 +1712,131 @@ int main() {
     auto energy_unit = std::make_unique<PhysicalQuantity>(1.0, "J");
     std::cout << "Energy unit: " << energy_unit->toString() << "\n\n";
     
+    // Example 8: Bytecode compilation and batched grid evaluation
+    std::cout << "Example 8: Compiled Bytecode and Batched Evaluation\n";
+    std::cout << "---------------------------------------------------\n";
+    
+    auto gaussianProgram = compileExpression(*gaussian, context);
+    std::cout << "Gaussian PDF lowered to " << gaussianProgram->instructionCount()
+              << " instructions (constants folded, variables in slots):\n"
+              << gaussianProgram->disassemble();
+    std::cout << "Compiled result at x=1.5: " << std::fixed << std::setprecision(6)
+              << gaussianProgram->evaluate(context) << "\n";
+    
+    {
+        const size_t gridPoints = 200000;
+        std::vector<double> xs(gridPoints), mus(gridPoints, 0.0), sigmas(gridPoints, 1.0);
+        for (size_t i = 0; i < gridPoints; ++i) xs[i] = -5.0 + 10.0 * i / gridPoints;
+        
+        // Program inputs come in inputNames() order
+        std::unordered_map<std::string, const std::vector<double>*> columns = {
+            {"x", &xs}, {"mu", &mus}, {"sigma", &sigmas}};
+        std::vector<const std::vector<double>*> inputs;
+        for (const auto& name : gaussianProgram->inputNames()) inputs.push_back(columns.at(name));
+        
+        std::vector<double> treeOut(gridPoints), scalarOut(gridPoints), batchOut;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < gridPoints; ++i) {
+            context.updateVariable("x", xs[i]);
+            treeOut[i] = gaussian->evaluate(context);
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        std::vector<double> slotValues(inputs.size());
+        for (size_t i = 0; i < gridPoints; ++i) {
+            for (size_t s = 0; s < inputs.size(); ++s) slotValues[s] = (*inputs[s])[i];
+            scalarOut[i] = gaussianProgram->evaluate(slotValues.data());
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        gaussianProgram->evaluateBatch(inputs, batchOut);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        context.updateVariable("x", 1.5);
+        
+        double maxDiff = 0.0;
+        for (size_t i = 0; i < gridPoints; ++i) {
+            maxDiff = std::max({maxDiff, std::abs(treeOut[i] - scalarOut[i]), std::abs(treeOut[i] - batchOut[i])});
+        }
+        auto ms = [](auto a, auto b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+        std::cout << gridPoints << " grid points: tree " << std::setprecision(1) << ms(t0, t1)
+                  << " ms, bytecode scalar " << ms(t1, t2) << " ms, bytecode batched "
+                  << ms(t2, t3) << " ms (max diff " << std::scientific << std::setprecision(1)
+                  << maxDiff << ")\n";
+    }
+    
+    // Derivative and integral over arrays
+    {
+        auto slope = std::make_unique<DerivativeExpression>(
+            parser.parse("x ^ 2 + 3 * x"), "x");
+        auto slopeProgram = compileExpression(*slope, context);
+        std::vector<double> xs(1000), slopes;
+        for (size_t i = 0; i < xs.size(); ++i) xs[i] = i * 0.01;
+        slopeProgram->evaluateBatch({&xs}, slopes);
+        double slopeErr = 0.0;
+        for (size_t i = 0; i < xs.size(); ++i) slopeErr = std::max(slopeErr, std::abs(slopes[i] - (2 * xs[i] + 3)));
+        
+        // ∫(0 to x) exp(-t²) dt = √π/2 · erf(x), Simpson samples evaluated as one batch
+        auto erfIntegral = std::make_unique<IntegralExpression>(
+            parser.parse("exp ( - t ^ 2 )"), "t",
+            std::make_unique<NumberExpression>(0.0), std::make_unique<VariableExpression>("x"));
+        auto integralProgram = compileExpression(*erfIntegral, context);
+        std::vector<double> areas;
+        integralProgram->evaluateBatch({&xs}, areas);
+        double areaErr = 0.0;
+        for (size_t i = 0; i < xs.size(); ++i) {
+            areaErr = std::max(areaErr, std::abs(areas[i] - std::sqrt(M_PI) / 2 * std::erf(xs[i])));
+        }
+        std::cout << "Batched d/dx[x² + 3x] over 1000 points: max error " << std::scientific
+                  << std::setprecision(2) << slopeErr << "\n";
+        std::cout << "Batched ∫ exp(-t²) dt over 1000 upper limits: max error vs erf "
+                  << areaErr << "\n\n";
+    }
+    
+    // Example 9: Symbolic differentiation
+    std::cout << "Example 9: Symbolic Differentiation\n";
+    std::cout << "-----------------------------------\n";
+    {
+        const std::string formula = "x ^ 2 * sin ( x ) * exp ( - x ^ 2 / 2 )";
+        auto f = parser.parse(formula);
+        DerivativeExpression df(parser.parse(formula), "x");
+        std::cout << "f(x) = " << f->toString() << "\n";
+        std::cout << "f'(x) = " << df.symbolicForm()->toString() << "\n";
+        
+        auto exact = [](double x) {
+            double g = std::exp(-x * x / 2);
+            return (2 * x * std::sin(x) + x * x * std::cos(x) - x * x * x * std::sin(x)) * g;
+        };
+        
+        const size_t points = 100000;
+        const double h = 1e-8;
+        double fdErr = 0.0, symErr = 0.0;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < points; ++i) {
+            double x = -4.0 + 8.0 * i / points;
+            context.updateVariable("x", x + h);
+            double fPlus = f->evaluate(context);
+            context.updateVariable("x", x - h);
+            double slope = (fPlus - f->evaluate(context)) / (2 * h);
+            fdErr = std::max(fdErr, std::abs(slope - exact(x)));
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < points; ++i) {
+            double x = -4.0 + 8.0 * i / points;
+            context.updateVariable("x", x);
+            double slope = df.evaluate(context);
+            symErr = std::max(symErr, std::abs(slope - exact(x)));
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        context.updateVariable("x", 1.5);
+        
+        auto ms = [](auto a, auto b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+        std::cout << points << " points: finite difference " << std::fixed << std::setprecision(1)
+                  << ms(t0, t1) << " ms (max error " << std::scientific << std::setprecision(1)
+                  << fdErr << "), symbolic " << std::fixed << ms(t1, t2) << " ms (max error "
+                  << std::scientific << symErr << ")\n";
+        
+        DerivativeExpression d2f(std::make_unique<DerivativeExpression>(parser.parse("sin ( x ) * x"), "x"), "x");
+        std::cout << "d²/dx²[x sin(x)] = " << d2f.symbolicForm()->toString() << "\n\n";
+    }
+    
     // Show all variables and constants
     context.showVariables();
     
@@ -851,6 +1879,8 @@ int main() {
     std::cout << "• Numerical derivatives and integration capabilities\n";
     std::cout << "• Physical unit awareness for dimensional analysis\n";
     std::cout << "• Extensible framework for domain-specific languages\n";
+    std::cout << "• Bytecode compilation with constant folding and batched evaluation\n";
+    std::cout << "• Symbolic derivatives with shared common subexpressions\n";
     
     return 0;
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <chrono>
 #include <limits>
 #include <functional>
+#include <utility>
 
 // Abstract Convergence Monitor for iterative solvers
 class ConvergenceMonitor {
@@ -622,6 +623,269 @@ public:
 
 std::shared_ptr<Preconditioner> JacobiPreconditioner::nullPreconditioner_ = nullptr;
 
+// Compile-time Null Objects
+//
+// IterativeSolver and PDESolver pay for a virtual call per hook per iteration
+// even when the hook is a Null Object, and NullPreconditioner::apply still
+// copies the residual. PolicyIterativeSolver takes the monitor,
+// preconditioner and boundary condition as template policies instead: the
+// null policies below have empty inline bodies (the identity preconditioner
+// hands back the residual itself), so they compile to nothing. The Dynamic*
+// policies forward to the virtual interfaces above for components chosen at
+// runtime, e.g. plugins.
+
+// Silent monitor with NullConvergenceMonitor's default stopping rule
+struct NullMonitorPolicy {
+    static constexpr bool isNull() { return true; }
+    void recordIteration(int, double, double) {}
+    void recordConvergence(int, double) {}
+    void recordDivergence(const char*) {}
+    bool shouldStop(double residual, int iteration) const {
+        return residual < 1e-10 || iteration >= 10000;
+    }
+};
+
+// Identity preconditioner: M^-1 r is r itself, so nothing is copied
+struct IdentityPreconditionerPolicy {
+    static constexpr bool isNull() { return true; }
+    const std::vector<double>& precondition(const std::vector<double>& residual,
+                                            std::vector<double>&) {
+        return residual;
+    }
+};
+
+// Open boundary: grid edges are left as they are
+struct OpenBoundaryPolicy {
+    static constexpr bool isNull() { return true; }
+    void applyToGrid(std::vector<std::vector<double>>&, double) {}
+};
+
+// Jacobi preconditioner with the inverse diagonal precomputed
+class DiagonalPreconditionerPolicy {
+private:
+    std::vector<double> inverseDiagonal_;
+
+public:
+    explicit DiagonalPreconditionerPolicy(const std::vector<double>& diagonal = {}) {
+        inverseDiagonal_.reserve(diagonal.size());
+        for (double d : diagonal) inverseDiagonal_.push_back(1.0 / d);
+    }
+
+    static constexpr bool isNull() { return false; }
+
+    const std::vector<double>& precondition(const std::vector<double>& residual,
+                                            std::vector<double>& z) {
+        for (size_t k = 0; k < z.size() && k < inverseDiagonal_.size(); ++k) {
+            z[k] = residual[k] * inverseDiagonal_[k];
+        }
+        return z;
+    }
+};
+
+// Fixed boundary value, the static counterpart of DirichletBoundary
+class DirichletBoundaryPolicy {
+private:
+    double value_;
+
+public:
+    explicit DirichletBoundaryPolicy(double value = 0.0) : value_(value) {}
+
+    static constexpr bool isNull() { return false; }
+
+    void applyToGrid(std::vector<std::vector<double>>& grid, double) {
+        int rows = grid.size();
+        int cols = grid[0].size();
+        for (int i = 0; i < rows; ++i) {
+            grid[i][0] = value_;
+            grid[i][cols-1] = value_;
+        }
+        for (int j = 0; j < cols; ++j) {
+            grid[0][j] = value_;
+            grid[rows-1][j] = value_;
+        }
+    }
+};
+
+// Runtime-polymorphic policies; a null pointer falls back to the Null Object
+class DynamicMonitorPolicy {
+private:
+    std::shared_ptr<ConvergenceMonitor> monitor_;
+
+public:
+    explicit DynamicMonitorPolicy(std::shared_ptr<ConvergenceMonitor> monitor = nullptr)
+        : monitor_(monitor ? monitor : std::make_shared<NullConvergenceMonitor>()) {}
+
+    bool isNull() const { return monitor_->isNull(); }
+    void recordIteration(int iteration, double residual, double error) {
+        monitor_->recordIteration(iteration, residual, error);
+    }
+    void recordConvergence(int totalIterations, double finalError) {
+        monitor_->recordConvergence(totalIterations, finalError);
+    }
+    void recordDivergence(const char* reason) { monitor_->recordDivergence(reason); }
+    bool shouldStop(double residual, int iteration) {
+        return monitor_->shouldStop(residual, iteration);
+    }
+};
+
+class DynamicPreconditionerPolicy {
+private:
+    std::shared_ptr<Preconditioner> preconditioner_;
+
+public:
+    explicit DynamicPreconditionerPolicy(std::shared_ptr<Preconditioner> preconditioner = nullptr)
+        : preconditioner_(preconditioner ? preconditioner
+                                         : JacobiPreconditioner::getNullPreconditioner()) {}
+
+    bool isNull() const { return preconditioner_->isNull(); }
+    const std::vector<double>& precondition(const std::vector<double>& residual,
+                                            std::vector<double>& z) {
+        preconditioner_->apply(z, residual);
+        return z;
+    }
+};
+
+class DynamicBoundaryPolicy {
+private:
+    std::shared_ptr<BoundaryCondition> boundary_;
+
+public:
+    explicit DynamicBoundaryPolicy(std::shared_ptr<BoundaryCondition> boundary = nullptr)
+        : boundary_(boundary ? boundary : std::make_shared<NullBoundary>()) {}
+
+    bool isNull() const { return boundary_->isNull(); }
+    void applyToGrid(std::vector<std::vector<double>>& grid, double t) {
+        boundary_->applyToGrid(grid, t);
+    }
+};
+
+// Diagonal of the five-point operator -∇²u + κu (unit grid spacing), one
+// entry per grid point; boundary points get 1 so they pass through unchanged
+inline std::vector<double> screenedPoissonDiagonal(const std::vector<std::vector<double>>& reaction) {
+    int n = reaction.size();
+    std::vector<double> diagonal(n * n, 1.0);
+    for (int i = 1; i < n-1; ++i) {
+        for (int j = 1; j < n-1; ++j) {
+            diagonal[i * n + j] = 4.0 + reaction[i][j];
+        }
+    }
+    return diagonal;
+}
+
+// Preconditioned Richardson iteration u += ω M^-1 (f - A u) for the screened
+// Poisson equation -∇²u + κu = f on a square grid. The policies are private
+// bases so empty ones take no space.
+template <typename MonitorPolicy = NullMonitorPolicy,
+          typename PreconditionerPolicy = IdentityPreconditionerPolicy,
+          typename BoundaryPolicy = OpenBoundaryPolicy>
+class PolicyIterativeSolver : private MonitorPolicy,
+                              private PreconditionerPolicy,
+                              private BoundaryPolicy {
+public:
+    using Grid = std::vector<std::vector<double>>;
+
+    struct SolveResult {
+        int iterations = 0;
+        double residual = 0.0;   // ||f - Au|| / ||f|| over interior points
+        bool diverged = false;
+    };
+
+private:
+    std::vector<double> residual_;     // Flattened row-major, boundary entries stay 0
+    std::vector<double> correction_;
+
+    double computeResidual(const Grid& u, const Grid& source, const Grid& reaction) {
+        int n = u.size();
+        double sumSquares = 0.0;
+        for (int i = 1; i < n-1; ++i) {
+            for (int j = 1; j < n-1; ++j) {
+                double au = (4.0 + reaction[i][j]) * u[i][j]
+                          - u[i-1][j] - u[i+1][j] - u[i][j-1] - u[i][j+1];
+                double r = source[i][j] - au;
+                residual_[i * n + j] = r;
+                sumSquares += r * r;
+            }
+        }
+        return std::sqrt(sumSquares);
+    }
+
+public:
+    explicit PolicyIterativeSolver(MonitorPolicy monitor = MonitorPolicy(),
+                                   PreconditionerPolicy preconditioner = PreconditionerPolicy(),
+                                   BoundaryPolicy boundary = BoundaryPolicy())
+        : MonitorPolicy(std::move(monitor)),
+          PreconditionerPolicy(std::move(preconditioner)),
+          BoundaryPolicy(std::move(boundary)) {}
+
+    bool monitoringEnabled() const { return !MonitorPolicy::isNull(); }
+    bool preconditioningEnabled() const { return !PreconditionerPolicy::isNull(); }
+    bool boundaryEnabled() const { return !BoundaryPolicy::isNull(); }
+
+    SolveResult solve(Grid& u, const Grid& source, const Grid& reaction, double omega = 1.0) {
+        int n = u.size();
+        residual_.assign(n * n, 0.0);
+        correction_.assign(n * n, 0.0);
+
+        double sourceNorm = 0.0;
+        for (int i = 1; i < n-1; ++i) {
+            for (int j = 1; j < n-1; ++j) sourceNorm += source[i][j] * source[i][j];
+        }
+        sourceNorm = sourceNorm > 0.0 ? std::sqrt(sourceNorm) : 1.0;
+
+        SolveResult result;
+        BoundaryPolicy::applyToGrid(u, 0.0);
+        result.residual = computeResidual(u, source, reaction) / sourceNorm;
+
+        while (!MonitorPolicy::shouldStop(result.residual, result.iterations)) {
+            result.iterations++;
+
+            const std::vector<double>& z = PreconditionerPolicy::precondition(residual_, correction_);
+            double change = 0.0;
+            for (int i = 1; i < n-1; ++i) {
+                for (int j = 1; j < n-1; ++j) {
+                    double du = omega * z[i * n + j];
+                    u[i][j] += du;
+                    change = std::max(change, std::abs(du));
+                }
+            }
+
+            BoundaryPolicy::applyToGrid(u, 0.0);
+            result.residual = computeResidual(u, source, reaction) / sourceNorm;
+            MonitorPolicy::recordIteration(result.iterations, result.residual, change);
+
+            if (!std::isfinite(result.residual) || result.residual > 1e3) {
+                MonitorPolicy::recordDivergence("Residual growing");
+                result.diverged = true;
+                return result;
+            }
+        }
+
+        MonitorPolicy::recordConvergence(result.iterations, result.residual);
+        return result;
+    }
+};
+
+// All hooks resolved at compile time vs. all hooks behind virtual calls
+using StaticNullSolver = PolicyIterativeSolver<>;
+using PluginSolver = PolicyIterativeSolver<DynamicMonitorPolicy,
+                                           DynamicPreconditionerPolicy,
+                                           DynamicBoundaryPolicy>;
+
+// Runs `solves` solves from a zero grid; returns microseconds per solve
+template <typename Solver>
+double timePolicySolves(Solver& solver, const typename Solver::Grid& source,
+                        const typename Solver::Grid& reaction, double omega, int solves,
+                        typename Solver::Grid& u, int& iterations) {
+    int n = source.size();
+    auto start = std::chrono::steady_clock::now();
+    for (int s = 0; s < solves; ++s) {
+        u.assign(n, std::vector<double>(n, 0.0));
+        iterations = solver.solve(u, source, reaction, omega).iterations;
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / solves;
+}
+
 // Define M_PI if not already defined (for MSVC)
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -750,7 +1014,79 @@ int main() {
     std::cout << nullPrecond->getName() << " result: ";
     for (double val : x) std::cout << val << " ";
     std::cout << "\n";
-    
+
+    // Compile-time Null Objects vs. runtime Null Objects
+    std::cout << "\n\n=== Compile-Time Null Objects (Policy Solver) ===\n\n";
+
+    const int n = 16;
+    PluginSolver::Grid source(n, std::vector<double>(n, 1.0));
+    PluginSolver::Grid reaction(n, std::vector<double>(n, 0.0));
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            reaction[i][j] = 20.0 * i * j / (n * n);   // Varying diagonal favors Jacobi
+        }
+    }
+    std::vector<double> operatorDiagonal = screenedPoissonDiagonal(reaction);
+    double richardsonOmega = 1.0 / *std::max_element(operatorDiagonal.begin(), operatorDiagonal.end());
+
+    auto maxDifference = [&](const PluginSolver::Grid& a, const PluginSolver::Grid& b) {
+        double diff = 0.0;
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) diff = std::max(diff, std::abs(a[i][j] - b[i][j]));
+        }
+        return diff;
+    };
+
+    const int solves = 20;
+    PluginSolver::Grid uStatic, uDynamic;
+    int itStatic = 0, itDynamic = 0;
+
+    StaticNullSolver staticNull;
+    PluginSolver dynamicNull;
+    double tStatic = timePolicySolves(staticNull, source, reaction, richardsonOmega, solves, uStatic, itStatic);
+    double tDynamic = timePolicySolves(dynamicNull, source, reaction, richardsonOmega, solves, uDynamic, itDynamic);
+
+    std::cout << n << "x" << n << " screened Poisson, all hooks null, Richardson (omega = "
+              << std::fixed << std::setprecision(4) << richardsonOmega << "):\n";
+    std::cout << "  Template policies: " << itStatic << " iterations, "
+              << std::setprecision(1) << tStatic << " us/solve\n";
+    std::cout << "  Virtual plugins:   " << itDynamic << " iterations, "
+              << tDynamic << " us/solve\n";
+    std::cout << "  Speedup: " << std::setprecision(2) << tDynamic / tStatic
+              << "x, max |difference| = " << std::scientific
+              << maxDifference(uStatic, uDynamic) << "\n";
+
+    PolicyIterativeSolver<NullMonitorPolicy, DiagonalPreconditionerPolicy> staticJacobi{
+        NullMonitorPolicy(), DiagonalPreconditionerPolicy(operatorDiagonal)};
+    PluginSolver dynamicJacobi(DynamicMonitorPolicy(), DynamicPreconditionerPolicy(
+        std::make_shared<JacobiPreconditioner>("Screened Poisson", operatorDiagonal)));
+    tStatic = timePolicySolves(staticJacobi, source, reaction, 1.0, solves, uStatic, itStatic);
+    tDynamic = timePolicySolves(dynamicJacobi, source, reaction, 1.0, solves, uDynamic, itDynamic);
+
+    std::cout << "\nSame system, Jacobi preconditioner (omega = 1):\n";
+    std::cout << "  Template policies: " << itStatic << " iterations, "
+              << std::fixed << std::setprecision(1) << tStatic << " us/solve\n";
+    std::cout << "  Virtual plugins:   " << itDynamic << " iterations, "
+              << tDynamic << " us/solve\n";
+    std::cout << "  Speedup: " << std::setprecision(2) << tDynamic / tStatic
+              << "x, max |difference| = " << std::scientific
+              << maxDifference(uStatic, uDynamic) << "\n";
+
+    // Plugins chosen at runtime still go through the same solver
+    std::cout << "\nPlugin solver with runtime components:\n";
+    PluginSolver configured(
+        DynamicMonitorPolicy(std::make_shared<SummaryConvergenceMonitor>(1e-8, 5000)),
+        DynamicPreconditionerPolicy(std::make_shared<JacobiPreconditioner>("Screened Poisson", operatorDiagonal)),
+        DynamicBoundaryPolicy(std::make_shared<DirichletBoundary>("Cold walls", 0.0)));
+    std::cout << "Monitoring " << (configured.monitoringEnabled() ? "enabled" : "disabled")
+              << ", preconditioning " << (configured.preconditioningEnabled() ? "enabled" : "disabled")
+              << ", boundary " << (configured.boundaryEnabled() ? "enabled" : "disabled") << "\n";
+    PluginSolver::Grid u(n, std::vector<double>(n, 0.0));
+    auto result = configured.solve(u, source, reaction);
+    std::cout << "Center value: " << std::fixed << std::setprecision(6) << u[n/2][n/2]
+              << ", relative residual: " << std::scientific << std::setprecision(2)
+              << result.residual << "\n";
+
     std::cout << "\n=== Null Object Pattern Summary ===\n";
     std::cout << "The Null Object pattern provides safe defaults in scientific computing:\n";
     std::cout << "• Silent convergence monitoring for production runs\n";
@@ -14,6 +14,12 @@
 #include <complex>
 #include <numeric>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 // Define M_PI for MSVC
 #ifndef M_PI
@@ -79,100 +85,415 @@ public:
 int GPUComputeContext::contextCounter_ = 0;
 
 // Thread-safe Object Pool
+//
+// Lock-free fast path: every pooled object lives in a fixed slot, and free
+// slots are linked into Treiber stacks whose heads pack (ABA tag, index) into
+// one 64-bit word. Each thread has a home shard acting as its magazine; on a
+// miss it falls back to the global list, then steals from other shards, and
+// only takes a mutex when the pool is exhausted and it has to wait. Handles
+// carry their slot index, so release is O(1) with no in-use scan.
 template<typename T>
 class ObjectPool {
 private:
-    std::queue<std::unique_ptr<T>> available_;
-    std::vector<T*> inUse_;
+    static constexpr uint32_t kNil = 0;  // Links store index + 1
+    
+    struct Slot {
+        std::unique_ptr<T> object;
+        std::atomic<uint32_t> next{kNil};
+    };
+    
+    class FreeList {
+    private:
+        std::atomic<uint64_t> head_{kNil};  // (tag << 32) | (index + 1)
+        
+    public:
+        void push(Slot* slots, uint32_t index) {
+            uint64_t head = head_.load(std::memory_order_relaxed);
+            uint64_t desired;
+            do {
+                slots[index].next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+                desired = (((head >> 32) + 1) << 32) | (index + 1);
+            } while (!head_.compare_exchange_weak(head, desired,
+                         std::memory_order_release, std::memory_order_relaxed));
+        }
+        
+        bool pop(Slot* slots, uint32_t& index) {
+            uint64_t head = head_.load(std::memory_order_acquire);
+            while (static_cast<uint32_t>(head) != kNil) {
+                uint32_t top = static_cast<uint32_t>(head) - 1;
+                uint32_t next = slots[top].next.load(std::memory_order_relaxed);
+                uint64_t desired = (((head >> 32) + 1) << 32) | next;
+                if (head_.compare_exchange_weak(head, desired,
+                        std::memory_order_acquire, std::memory_order_acquire)) {
+                    index = top;
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+    
+    struct alignas(64) Shard {
+        FreeList freeList;
+        std::atomic<size_t> cached{0};
+        std::atomic<size_t> localHits{0};
+        std::atomic<size_t> globalHits{0};
+        std::atomic<size_t> steals{0};
+    };
+    
+    std::unique_ptr<Slot[]> slots_;
+    std::unique_ptr<Shard[]> shards_;
+    size_t numShards_;
+    size_t magazineSize_;
+    
+    alignas(64) FreeList global_;
+    std::atomic<size_t> globalCount_{0};
+    alignas(64) std::atomic<size_t> currentSize_{0};
+    std::atomic<size_t> creations_{0};
+    std::atomic<size_t> waits_{0};
+    
+    // Slow paths only: object creation and exhausted pool
+    std::mutex factoryMutex_;
     mutable std::mutex mutex_;
     std::condition_variable condition_;
+    std::atomic<int> waiters_{0};
     
     size_t maxSize_;
-    size_t currentSize_ = 0;
     std::function<std::unique_ptr<T>()> factory_;
     std::function<void(T*)> reset_;
     
-public:
-    ObjectPool(size_t maxSize, 
-               std::function<std::unique_ptr<T>()> factory,
-               std::function<void(T*)> reset = [](T* obj) { obj->reset(); })
-        : maxSize_(maxSize), factory_(factory), reset_(reset) {}
+    static size_t threadShardSeed() {
+        static std::atomic<size_t> nextSeed{0};
+        thread_local size_t seed = nextSeed.fetch_add(1, std::memory_order_relaxed);
+        return seed;
+    }
+    
+    Shard& homeShard() { return shards_[threadShardSeed() % numShards_]; }
     
-    ~ObjectPool() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        // Clean up in-use objects
-        for (auto* obj : inUse_) {
-            delete obj;
+    bool tryPop(Shard& home, uint32_t& index) {
+        if (home.freeList.pop(slots_.get(), index)) {
+            home.cached.fetch_sub(1, std::memory_order_relaxed);
+            home.localHits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        if (global_.pop(slots_.get(), index)) {
+            globalCount_.fetch_sub(1, std::memory_order_relaxed);
+            home.globalHits.fetch_add(1, std::memory_order_relaxed);
+            return true;
         }
+        for (size_t i = 0; i < numShards_; ++i) {
+            Shard& victim = shards_[i];
+            if (&victim == &home) continue;
+            if (victim.freeList.pop(slots_.get(), index)) {
+                victim.cached.fetch_sub(1, std::memory_order_relaxed);
+                home.steals.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
     }
     
-    std::unique_ptr<T, std::function<void(T*)>> acquire() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        
-        // Wait if pool is empty and we've reached max size
-        while (available_.empty() && currentSize_ >= maxSize_) {
-            std::cout << "Pool exhausted, waiting for available object...\n";
-            condition_.wait(lock);
-        }
-        
-        // Create new object if pool is empty
-        if (available_.empty()) {
-            currentSize_++;
-            auto obj = factory_();
-            T* rawPtr = obj.release();
-            inUse_.push_back(rawPtr);
-            
-            // Return with custom deleter that returns to pool
-            return std::unique_ptr<T, std::function<void(T*)>>(
-                rawPtr,
-                [this](T* ptr) { this->release(ptr); }
-            );
+    bool tryCreate(uint32_t& index) {
+        size_t size = currentSize_.load(std::memory_order_relaxed);
+        while (size < maxSize_) {
+            if (currentSize_.compare_exchange_weak(size, size + 1, std::memory_order_acq_rel)) {
+                index = static_cast<uint32_t>(size);
+                // Factories are not required to be thread-safe
+                std::lock_guard<std::mutex> lock(factoryMutex_);
+                slots_[index].object = factory_();
+                creations_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
         }
-        
-        // Get object from pool
-        auto obj = std::move(available_.front());
-        available_.pop();
-        T* rawPtr = obj.release();
-        inUse_.push_back(rawPtr);
-        
-        return std::unique_ptr<T, std::function<void(T*)>>(
-            rawPtr,
-            [this](T* ptr) { this->release(ptr); }
-        );
+        return false;
+    }
+    
+public:
+    using Handle = std::unique_ptr<T, std::function<void(T*)>>;
+    
+    ObjectPool(size_t maxSize, 
+               std::function<std::unique_ptr<T>()> factory,
+               std::function<void(T*)> reset = [](T* obj) { obj->reset(); },
+               size_t magazineSize = 8)
+        : slots_(new Slot[maxSize]),
+          numShards_(std::max<size_t>(1, std::min<size_t>(64, std::thread::hardware_concurrency()))),
+          magazineSize_(magazineSize),
+          maxSize_(maxSize), factory_(factory), reset_(reset) {
+        shards_.reset(new Shard[numShards_]);
     }
     
-    void release(T* obj) {
-        std::lock_guard<std::mutex> lock(mutex_);
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    
+    Handle acquire() {
+        Shard& home = homeShard();
+        uint32_t index;
         
-        // Remove from in-use list
-        auto it = std::find(inUse_.begin(), inUse_.end(), obj);
-        if (it != inUse_.end()) {
-            inUse_.erase(it);
+        if (!tryPop(home, index) && !tryCreate(index)) {
+            // Wait if pool is empty and we've reached max size
+            std::unique_lock<std::mutex> lock(mutex_);
+            waiters_.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!tryPop(home, index)) {
+                std::cout << "Pool exhausted, waiting for available object...\n";
+                waits_.fetch_add(1, std::memory_order_relaxed);
+                condition_.wait(lock, [&] { return tryPop(home, index); });
+            }
+            waiters_.fetch_sub(1, std::memory_order_relaxed);
         }
         
+        // Return with custom deleter that returns the slot to the pool
+        return Handle(slots_[index].object.get(),
+                      [this, index](T*) { this->release(index); });
+    }
+    
+    void release(uint32_t index) {
         // Reset object state
-        reset_(obj);
+        reset_(slots_[index].object.get());
         
-        // Return to pool
-        available_.push(std::unique_ptr<T>(obj));
-        condition_.notify_one();
+        // Keep it in the releasing thread's magazine unless someone is
+        // blocked waiting, in which case make it globally visible at once
+        Shard& home = homeShard();
+        if (waiters_.load(std::memory_order_seq_cst) == 0 &&
+            home.cached.load(std::memory_order_relaxed) < magazineSize_) {
+            home.cached.fetch_add(1, std::memory_order_relaxed);
+            home.freeList.push(slots_.get(), index);
+        } else {
+            globalCount_.fetch_add(1, std::memory_order_relaxed);
+            global_.push(slots_.get(), index);
+        }
         
-        std::cout << "Object returned to pool. Available: " 
-                  << available_.size() << "/" << currentSize_ << "\n";
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            condition_.notify_one();
+        }
     }
     
     size_t availableCount() const {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return available_.size();
+        size_t available = globalCount_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < numShards_; ++i) {
+            available += shards_[i].cached.load(std::memory_order_relaxed);
+        }
+        return available;
     }
     
     size_t inUseCount() const {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return inUse_.size();
+        size_t total = totalCount();
+        size_t available = availableCount();
+        return total > available ? total - available : 0;
     }
     
     size_t totalCount() const {
-        return currentSize_;
+        return currentSize_.load(std::memory_order_relaxed);
+    }
+    
+    void printStatistics(const std::string& name) const {
+        size_t local = 0, global = 0, stolen = 0;
+        for (size_t i = 0; i < numShards_; ++i) {
+            local += shards_[i].localHits.load(std::memory_order_relaxed);
+            global += shards_[i].globalHits.load(std::memory_order_relaxed);
+            stolen += shards_[i].steals.load(std::memory_order_relaxed);
+        }
+        size_t created = creations_.load(std::memory_order_relaxed);
+        size_t total = local + global + stolen + created;
+        
+        std::cout << "Pool '" << name << "' statistics (" << numShards_ << " shards):\n";
+        std::cout << "  Acquires: " << total << " (" << created << " created, "
+                  << waits_.load(std::memory_order_relaxed) << " waited)\n";
+        if (total > 0) {
+            std::cout << std::fixed << std::setprecision(1)
+                      << "  Magazine hits: " << 100.0 * local / total << "%, "
+                      << "global list: " << 100.0 * global / total << "%, "
+                      << "stolen: " << 100.0 * stolen / total << "%\n";
+        }
+    }
+};
+
+// Iterative radix-2 FFT plan for one power-of-two size.
+// Holds the bit-reversal permutation and per-stage twiddle factors so a
+// transform is a single in-place pass with no trigonometry.
+class FFTPlan {
+private:
+    size_t n_;
+    std::vector<uint32_t> bitReverse_;
+    // Stage with half-length h uses twiddles_[h .. 2h-1] = exp(-2*pi*i*k/(2h))
+    std::vector<std::complex<double>> twiddles_;
+    
+public:
+    explicit FFTPlan(size_t n) : n_(n), bitReverse_(n), twiddles_(std::max<size_t>(n, 2)) {
+        if (n == 0 || (n & (n - 1)) != 0) {
+            throw std::invalid_argument("FFTPlan size must be a power of two");
+        }
+        unsigned bits = 0;
+        while ((size_t(1) << bits) < n) ++bits;
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t r = 0;
+            for (unsigned b = 0; b < bits; ++b) {
+                r |= ((i >> b) & 1u) << (bits - 1 - b);
+            }
+            bitReverse_[i] = r;
+        }
+        for (size_t h = 1; h < n; h <<= 1) {
+            for (size_t k = 0; k < h; ++k) {
+                twiddles_[h + k] = std::polar(1.0, -M_PI * static_cast<double>(k) / h);
+            }
+        }
+    }
+    
+    size_t size() const { return n_; }
+    
+    void forward(std::complex<double>* data) const {
+        for (size_t i = 0; i < n_; ++i) {
+            if (i < bitReverse_[i]) std::swap(data[i], data[bitReverse_[i]]);
+        }
+        for (size_t h = 1; h < n_; h <<= 1) {
+            const std::complex<double>* w = twiddles_.data() + h;
+            for (size_t start = 0; start < n_; start += 2 * h) {
+                butterflies(data + start, data + start + h, w, h);
+            }
+        }
+    }
+    
+    // Unnormalized forward transform of the conjugate, then scale by 1/n
+    void inverse(std::complex<double>* data) const {
+        for (size_t i = 0; i < n_; ++i) data[i] = std::conj(data[i]);
+        forward(data);
+        const double scale = 1.0 / static_cast<double>(n_);
+        for (size_t i = 0; i < n_; ++i) data[i] = std::conj(data[i]) * scale;
+    }
+    
+private:
+    static void butterflies(std::complex<double>* lo, std::complex<double>* hi,
+                            const std::complex<double>* w, size_t h) {
+        size_t k = 0;
+#if defined(__AVX2__)
+        // Two complex butterflies per 256-bit register
+        double* plo = reinterpret_cast<double*>(lo);
+        double* phi = reinterpret_cast<double*>(hi);
+        const double* pw = reinterpret_cast<const double*>(w);
+        for (; k + 2 <= h; k += 2) {
+            __m256d a = _mm256_loadu_pd(plo + 2 * k);
+            __m256d b = _mm256_loadu_pd(phi + 2 * k);
+            __m256d tw = _mm256_loadu_pd(pw + 2 * k);
+            __m256d twRe = _mm256_movedup_pd(tw);             // wr wr
+            __m256d twIm = _mm256_permute_pd(tw, 0xF);        // wi wi
+            __m256d bSwap = _mm256_permute_pd(b, 0x5);        // bi br
+            __m256d t = _mm256_addsub_pd(_mm256_mul_pd(b, twRe),
+                                         _mm256_mul_pd(bSwap, twIm));
+            _mm256_storeu_pd(plo + 2 * k, _mm256_add_pd(a, t));
+            _mm256_storeu_pd(phi + 2 * k, _mm256_sub_pd(a, t));
+        }
+#endif
+        for (; k < h; ++k) {
+            std::complex<double> t = hi[k] * w[k];
+            hi[k] = lo[k] - t;
+            lo[k] += t;
+        }
+    }
+};
+
+// Real-input FFT of size n computed with one complex FFT of size n/2:
+// even/odd samples are packed as real/imaginary parts, then untangled.
+class RealFFTPlan {
+private:
+    size_t n_;
+    std::shared_ptr<const FFTPlan> half_;
+    std::vector<std::complex<double>> twiddles_;  // exp(-2*pi*i*k/n), k <= n/2
+    
+public:
+    RealFFTPlan(size_t n, std::shared_ptr<const FFTPlan> half)
+        : n_(n), half_(std::move(half)), twiddles_(n / 2 + 1) {
+        for (size_t k = 0; k <= n / 2; ++k) {
+            twiddles_[k] = std::polar(1.0, -2.0 * M_PI * static_cast<double>(k) / n);
+        }
+    }
+    
+    size_t size() const { return n_; }
+    size_t spectrumSize() const { return n_ / 2 + 1; }
+    
+    // in: n reals; out: n/2+1 bins; scratch: n/2 complex values
+    void forward(const double* in, std::complex<double>* out, std::complex<double>* scratch) const {
+        const size_t m = n_ / 2;
+        for (size_t k = 0; k < m; ++k) {
+            scratch[k] = std::complex<double>(in[2 * k], in[2 * k + 1]);
+        }
+        half_->forward(scratch);
+        for (size_t k = 0; k <= m; ++k) {
+            std::complex<double> zk = scratch[k == m ? 0 : k];
+            std::complex<double> zc = std::conj(scratch[k == 0 ? 0 : m - k]);
+            std::complex<double> even = 0.5 * (zk + zc);
+            std::complex<double> odd = std::complex<double>(0.0, -0.5) * (zk - zc);
+            out[k] = even + twiddles_[k] * odd;
+        }
+    }
+    
+    // in: n/2+1 bins; out: n reals; scratch: n/2 complex values
+    void inverse(const std::complex<double>* in, double* out, std::complex<double>* scratch) const {
+        const size_t m = n_ / 2;
+        for (size_t k = 0; k < m; ++k) {
+            std::complex<double> xk = in[k];
+            std::complex<double> xc = std::conj(in[m - k]);
+            std::complex<double> even = 0.5 * (xk + xc);
+            std::complex<double> odd = 0.5 * (xk - xc) * std::conj(twiddles_[k]);
+            scratch[k] = even + std::complex<double>(0.0, 1.0) * odd;
+        }
+        half_->inverse(scratch);
+        for (size_t k = 0; k < m; ++k) {
+            out[2 * k] = scratch[k].real();
+            out[2 * k + 1] = scratch[k].imag();
+        }
+    }
+};
+
+// Process-wide plan cache keyed by transform size
+class FFTPlanCache {
+private:
+    static std::mutex& mutex() {
+        static std::mutex m;
+        return m;
+    }
+    static std::unordered_map<size_t, std::shared_ptr<const FFTPlan>>& complexPlans() {
+        static std::unordered_map<size_t, std::shared_ptr<const FFTPlan>> plans;
+        return plans;
+    }
+    static std::unordered_map<size_t, std::shared_ptr<const RealFFTPlan>>& realPlans() {
+        static std::unordered_map<size_t, std::shared_ptr<const RealFFTPlan>> plans;
+        return plans;
+    }
+    
+    static std::shared_ptr<const FFTPlan> complexPlanLocked(size_t n) {
+        auto& plans = complexPlans();
+        auto it = plans.find(n);
+        if (it == plans.end()) {
+            it = plans.emplace(n, std::make_shared<const FFTPlan>(n)).first;
+        }
+        return it->second;
+    }
+    
+public:
+    static std::shared_ptr<const FFTPlan> complexPlan(size_t n) {
+        std::lock_guard<std::mutex> lock(mutex());
+        return complexPlanLocked(n);
+    }
+    
+    // n must be a power of two >= 2
+    static std::shared_ptr<const RealFFTPlan> realPlan(size_t n) {
+        if (n < 2) {
+            throw std::invalid_argument("RealFFTPlan size must be at least 2");
+        }
+        std::lock_guard<std::mutex> lock(mutex());
+        auto& plans = realPlans();
+        auto it = plans.find(n);
+        if (it == plans.end()) {
+            it = plans.emplace(n, std::make_shared<const RealFFTPlan>(n, complexPlanLocked(n / 2))).first;
+        }
+        return it->second;
+    }
+    
+    static size_t cachedPlanCount() {
+        std::lock_guard<std::mutex> lock(mutex());
+        return complexPlans().size() + realPlans().size();
     }
 };
 
@@ -183,12 +504,16 @@ private:
     int id_;
     size_t fftSize_;
     bool busy_ = false;
-    std::vector<std::complex<double>> workspace_;
+    std::vector<double> input_;                    // fftSize reals
+    std::vector<std::complex<double>> workspace_;  // fftSize/2+1 bins
+    std::vector<std::complex<double>> scratch_;    // fftSize/2 for the half-size transform
+    std::shared_ptr<const RealFFTPlan> plan_;
     std::thread thread_;
     
 public:
     FFTProcessor(size_t fftSize) 
-        : id_(++processorCounter_), fftSize_(fftSize), workspace_(fftSize) {
+        : id_(++processorCounter_), fftSize_(fftSize), input_(fftSize),
+          workspace_(fftSize / 2 + 1), scratch_(fftSize / 2) {
         std::cout << "Creating FFT processor #" << id_ 
                   << " for size " << fftSize_ << "\n";
         // Pre-compute twiddle factors
@@ -213,13 +538,11 @@ public:
             std::cout << "[FFT Processor #" << id_ << "] Processing signal of length " 
                       << signal.size() << "\n";
             
-            // Convert to complex
-            for (size_t i = 0; i < std::min(signal.size(), fftSize_); ++i) {
-                workspace_[i] = std::complex<double>(signal[i], 0.0);
-            }
+            // Zero-pad to the plan size; the spectrum holds bins 0..n/2
+            const size_t count = std::min(signal.size(), fftSize_);
+            std::copy(signal.begin(), signal.begin() + count, input_.begin());
+            std::fill(input_.begin() + count, input_.end(), 0.0);
             
-            // Simulate FFT computation
-            std::this_thread::sleep_for(std::chrono::milliseconds(20));
             performFFT();
             
             callback(workspace_);
@@ -232,6 +555,7 @@ public:
         if (thread_.joinable()) {
             thread_.join();
         }
+        std::fill(input_.begin(), input_.end(), 0.0);
         std::fill(workspace_.begin(), workspace_.end(), std::complex<double>(0, 0));
         busy_ = false;
     }
@@ -242,16 +566,16 @@ public:
     
 private:
     void initializeTwiddleFactors() {
-        // Pre-compute twiddle factors for FFT
+        // Twiddles and bit-reversal tables are shared by all processors of
+        // the same size through the plan cache
+        plan_ = FFTPlanCache::realPlan(fftSize_);
         std::cout << "[FFT Processor #" << id_ 
-                  << "] Initializing twiddle factors\n";
+                  << "] Using cached real-input plan for size " << plan_->size() << "\n";
     }
     
+    // Signals are real, so one half-size complex FFT yields the spectrum
     void performFFT() {
-        // Simplified FFT (normally would use Cooley-Tukey or similar)
-        for (size_t i = 0; i < fftSize_; ++i) {
-            workspace_[i] *= std::exp(std::complex<double>(0, -2 * M_PI * i / fftSize_));
-        }
+        plan_->forward(input_.data(), workspace_.data(), scratch_.data());
     }
 };
 
@@ -491,6 +815,44 @@ public:
     }
 };
 
+// Many threads grabbing short-lived workspaces every timestep
+void pool_contention_benchmark() {
+    std::cout << "\n\n=== Pool Contention Benchmark ===\n\n";
+    
+    const int numThreads = 8;
+    const int acquiresPerThread = 200000;
+    
+    ObjectPool<SimulationBuffer> workspacePool(
+        16,
+        []() { return std::make_unique<SimulationBuffer>(64); }
+    );
+    
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    std::atomic<size_t> checksum{0};
+    for (int t = 0; t < numThreads; ++t) {
+        workers.emplace_back([&workspacePool, &checksum]() {
+            size_t local = 0;
+            for (int i = 0; i < acquiresPerThread; ++i) {
+                auto workspace = workspacePool.acquire();
+                local += workspace->getSize();
+            }
+            checksum += local;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double totalAcquires = static_cast<double>(numThreads) * acquiresPerThread;
+    std::cout << numThreads << " threads x " << acquiresPerThread << " acquire/release pairs: "
+              << std::fixed << std::setprecision(1) << (totalAcquires / seconds / 1e6) 
+              << " M ops/s (" << (seconds * 1e9 / totalAcquires) << " ns/op)\n";
+    workspacePool.printStatistics("Timestep workspaces");
+}
+
 int main() {
     std::cout << "=== High-Performance Scientific Computing Resource Pools ===\n\n";
     
@@ -557,7 +919,7 @@ int main() {
                 // Find dominant frequency
                 double maxMag = 0;
                 size_t maxIdx = 0;
-                for (size_t k = 0; k < spectrum.size() / 2; ++k) {
+                for (size_t k = 0; k < spectrum.size(); ++k) {
                     double mag = std::abs(spectrum[k]);
                     if (mag > maxMag) {
                         maxMag = mag;
@@ -615,7 +977,7 @@ int main() {
                                                  solution.end(), 
                                                  solution.begin(), 0.0)) << "\n";
         
-        if (i < 3) {
+        if (i < 2) {  // Hold two, leaving one object to recycle
             solvers.push_back(std::move(decomp));
         }
         // Others will be automatically returned
@@ -682,12 +1044,17 @@ int main() {
     
     solverManager.showStatistics();
     
+    std::cout << "FFT plans cached: " << FFTPlanCache::cachedPlanCount() << "\n";
+    
+    pool_contention_benchmark();
+    
     std::cout << "\n=== Object Pool Pattern Summary ===\n";
     std::cout << "Resource pooling in scientific computing provides:\n";
     std::cout << "• Reduced allocation overhead for expensive resources\n";
     std::cout << "• Better GPU/accelerator utilization\n";
     std::cout << "• Predictable memory usage patterns\n";
     std::cout << "• Improved cache locality for frequently reused objects\n";
+    std::cout << "• Lock-free, thread-affine acquire/release fast path\n";
     
     return 0;
 }
\ No newline at end of file
@@ -16,17 +16,740 @@
 #include <numeric>
 #include <iomanip>
 #include <random>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <stdexcept>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 // Define M_PI for MSVC
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+// Fork-join worker pool in the spirit of ScientificThreadPool (pattern 30),
+// trimmed to the one operation GEMM and the Monte Carlo servant need: split a
+// range of independent blocks across all threads and wait. The calling thread takes part, so a
+// pool of size 1 runs everything inline.
+class ForkJoinPool {
+private:
+    std::vector<std::thread> workers_;
+    std::mutex submit_;    // One parallelFor at a time when callers share the pool
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    
+    const std::function<void(size_t, size_t)>* job_ = nullptr;
+    size_t jobSize_ = 0;
+    size_t grain_ = 1;
+    std::atomic<size_t> next_{0};
+    size_t active_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+    
+    void runChunks() {
+        size_t begin;
+        while ((begin = next_.fetch_add(grain_)) < jobSize_) {
+            try {
+                (*job_)(begin, std::min(begin + grain_, jobSize_));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) error_ = std::current_exception();
+            }
+        }
+    }
+    
+    void workerLoop() {
+        uint64_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+            }
+            runChunks();
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0) done_.notify_one();
+        }
+    }
+    
+public:
+    explicit ForkJoinPool(size_t threads = std::thread::hardware_concurrency()) {
+        for (size_t i = 1; i < std::max<size_t>(threads, 1); ++i) {
+            workers_.emplace_back(&ForkJoinPool::workerLoop, this);
+        }
+    }
+    
+    ~ForkJoinPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+    
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+    
+    size_t size() const { return workers_.size() + 1; }
+    
+    // Calls body(begin, end) over [0, count) in chunks of grain items
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) {
+        if (workers_.empty() || count <= grain) {
+            if (count > 0) body(0, count);
+            return;
+        }
+        std::lock_guard<std::mutex> submitLock(submit_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &body;
+            jobSize_ = count;
+            grain_ = std::max<size_t>(grain, 1);
+            next_.store(0);
+            active_ = workers_.size();
+            error_ = nullptr;
+            ++generation_;
+        }
+        wake_.notify_all();
+        runChunks();
+        
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return active_ == 0; });
+        job_ = nullptr;
+        if (error_) std::rethrow_exception(error_);
+    }
+};
+
+// Counter-based random streams (Philox4x32-10, Salmon et al., SC'11).
+// Output is a pure function of (key, counter), so stream s, block b gives
+// the same numbers on any thread in any order: there is no generator state
+// to hand between workers and nothing to lock.
+class PhiloxStream {
+private:
+    uint32_t key_[2];
+    uint32_t counter_[4];  // {block lo, block hi, stream lo, stream hi}
+    uint32_t output_[4];
+    int used_ = 4;
+    
+    static void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        uint64_t product = static_cast<uint64_t>(a) * b;
+        hi = static_cast<uint32_t>(product >> 32);
+        lo = static_cast<uint32_t>(product);
+    }
+    
+    void generateBlock() {
+        uint32_t c[4] = {counter_[0], counter_[1], counter_[2], counter_[3]};
+        uint32_t k[2] = {key_[0], key_[1]};
+        for (int round = 0; round < 10; ++round) {
+            uint32_t hi0, lo0, hi1, lo1;
+            mulhilo(0xD2511F53u, c[0], hi0, lo0);
+            mulhilo(0xCD9E8D57u, c[2], hi1, lo1);
+            uint32_t next[4] = {hi1 ^ c[1] ^ k[0], lo1, hi0 ^ c[3] ^ k[1], lo0};
+            std::copy(next, next + 4, c);
+            k[0] += 0x9E3779B9u;
+            k[1] += 0xBB67AE85u;
+        }
+        std::copy(c, c + 4, output_);
+        if (++counter_[0] == 0) ++counter_[1];
+        used_ = 0;
+    }
+    
+public:
+    PhiloxStream(uint64_t seed, uint64_t stream) {
+        key_[0] = static_cast<uint32_t>(seed);
+        key_[1] = static_cast<uint32_t>(seed >> 32);
+        counter_[0] = counter_[1] = 0;
+        counter_[2] = static_cast<uint32_t>(stream);
+        counter_[3] = static_cast<uint32_t>(stream >> 32);
+    }
+    
+    uint32_t next32() {
+        if (used_ == 4) generateBlock();
+        return output_[used_++];
+    }
+    
+    // Uniform on [0, 1) with 53 random bits
+    double uniform() {
+        uint32_t a = next32() >> 5, b = next32() >> 6;
+        return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Cache-blocked DGEMM: C = alpha A B + beta C (row-major, leading dimensions)
+//
+// Goto/BLIS loop structure around a register-blocked micro-kernel:
+//   jc: NC columns of B     -> packed KC×NC panel stays in L3
+//   pc: KC-deep slab        -> each thread packs an MC×KC block of A into L2
+//   ic: MC rows (parallel)
+//   jr/ir: NR×KC sliver of B and MR×KC sliver of A stream from L1 while the
+//          micro-kernel keeps an MR×NR tile of C in vector registers
+// Packed panels are zero-padded to whole tiles, so the micro-kernel never
+// branches. The widest kernel the CPU supports (AVX-512, AVX2+FMA, or a
+// portable one) is chosen once, on first use.
+// ---------------------------------------------------------------------------
+
+struct GemmKernel {
+    const char* name;
+    size_t mr, nr;              // Register tile
+    size_t mc, kc, nc;          // Cache blocks (mc % mr == 0, nc % nr == 0)
+    int flopsPerCycle;          // Nominal double-precision peak per core
+    // C[0..mr)[0..nr) += alpha * (packed A sliver) * (packed B sliver)
+    void (*micro)(size_t kc, const double* A, const double* B, double* C, size_t ldc, double alpha);
+};
+
+// Portable kernel; the fixed-size accumulator loops auto-vectorize
+inline void gemmMicroGeneric(size_t kc, const double* A, const double* B, double* C,
+                             size_t ldc, double alpha) {
+    constexpr size_t MR = 4, NR = 8;
+    double acc[MR][NR] = {};
+    for (size_t k = 0; k < kc; ++k, A += MR, B += NR) {
+        for (size_t r = 0; r < MR; ++r) {
+            for (size_t c = 0; c < NR; ++c) acc[r][c] += A[r] * B[c];
+        }
+    }
+    for (size_t r = 0; r < MR; ++r) {
+        for (size_t c = 0; c < NR; ++c) C[r * ldc + c] += alpha * acc[r][c];
+    }
+}
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GEMM_X86_DISPATCH 1
+
+// 6×8 tile: 12 ymm accumulators, 2 B loads and 6 broadcasts per k
+__attribute__((target("avx2,fma")))
+inline void gemmMicroAvx2(size_t kc, const double* A, const double* B, double* C,
+                          size_t ldc, double alpha) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+    for (size_t k = 0; k < kc; ++k, A += 6, B += 8) {
+        __m256d b0 = _mm256_loadu_pd(B), b1 = _mm256_loadu_pd(B + 4);
+        __m256d a;
+        a = _mm256_broadcast_sd(A + 0); c00 = _mm256_fmadd_pd(a, b0, c00); c01 = _mm256_fmadd_pd(a, b1, c01);
+        a = _mm256_broadcast_sd(A + 1); c10 = _mm256_fmadd_pd(a, b0, c10); c11 = _mm256_fmadd_pd(a, b1, c11);
+        a = _mm256_broadcast_sd(A + 2); c20 = _mm256_fmadd_pd(a, b0, c20); c21 = _mm256_fmadd_pd(a, b1, c21);
+        a = _mm256_broadcast_sd(A + 3); c30 = _mm256_fmadd_pd(a, b0, c30); c31 = _mm256_fmadd_pd(a, b1, c31);
+        a = _mm256_broadcast_sd(A + 4); c40 = _mm256_fmadd_pd(a, b0, c40); c41 = _mm256_fmadd_pd(a, b1, c41);
+        a = _mm256_broadcast_sd(A + 5); c50 = _mm256_fmadd_pd(a, b0, c50); c51 = _mm256_fmadd_pd(a, b1, c51);
+    }
+    __m256d s = _mm256_set1_pd(alpha);
+    __m256d acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+    for (size_t r = 0; r < 6; ++r) {
+        double* row = C + r * ldc;
+        _mm256_storeu_pd(row, _mm256_fmadd_pd(s, acc[r][0], _mm256_loadu_pd(row)));
+        _mm256_storeu_pd(row + 4, _mm256_fmadd_pd(s, acc[r][1], _mm256_loadu_pd(row + 4)));
+    }
+}
+
+// 8×24 tile: 24 zmm accumulators, 3 B loads and 8 broadcasts per k
+__attribute__((target("avx512f")))
+inline void gemmMicroAvx512(size_t kc, const double* A, const double* B, double* C,
+                            size_t ldc, double alpha) {
+    __m512d acc[8][3];
+    for (size_t r = 0; r < 8; ++r) {
+        acc[r][0] = acc[r][1] = acc[r][2] = _mm512_setzero_pd();
+    }
+    for (size_t k = 0; k < kc; ++k, A += 8, B += 24) {
+        __m512d b0 = _mm512_loadu_pd(B), b1 = _mm512_loadu_pd(B + 8), b2 = _mm512_loadu_pd(B + 16);
+#pragma GCC unroll 8
+        for (size_t r = 0; r < 8; ++r) {
+            __m512d a = _mm512_set1_pd(A[r]);
+            acc[r][0] = _mm512_fmadd_pd(a, b0, acc[r][0]);
+            acc[r][1] = _mm512_fmadd_pd(a, b1, acc[r][1]);
+            acc[r][2] = _mm512_fmadd_pd(a, b2, acc[r][2]);
+        }
+    }
+    __m512d s = _mm512_set1_pd(alpha);
+    for (size_t r = 0; r < 8; ++r) {
+        double* row = C + r * ldc;
+        _mm512_storeu_pd(row, _mm512_fmadd_pd(s, acc[r][0], _mm512_loadu_pd(row)));
+        _mm512_storeu_pd(row + 8, _mm512_fmadd_pd(s, acc[r][1], _mm512_loadu_pd(row + 8)));
+        _mm512_storeu_pd(row + 16, _mm512_fmadd_pd(s, acc[r][2], _mm512_loadu_pd(row + 16)));
+    }
+}
+#endif
+
+inline const GemmKernel& gemmKernel() {
+    static const GemmKernel kernel = [] {
+#ifdef GEMM_X86_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return GemmKernel{"AVX-512 8x24", 8, 24, 96, 256, 4080, 32, gemmMicroAvx512};
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return GemmKernel{"AVX2+FMA 6x8", 6, 8, 96, 256, 4096, 16, gemmMicroAvx2};
+        }
+#endif
+        return GemmKernel{"Generic 4x8", 4, 8, 96, 256, 4096, 4, gemmMicroGeneric};
+    }();
+    return kernel;
+}
+
+inline ForkJoinPool& gemmPool() {
+    static ForkJoinPool pool;
+    return pool;
+}
+
+inline void blockedGemm(size_t M, size_t N, size_t K, double alpha,
+                        const double* A, size_t lda, const double* B, size_t ldb,
+                        double beta, double* C, size_t ldc, ForkJoinPool& pool = gemmPool()) {
+    const GemmKernel& kern = gemmKernel();
+    const size_t MR = kern.mr, NR = kern.nr;
+    
+    if (beta != 1.0) {
+        for (size_t i = 0; i < M; ++i) {
+            double* row = C + i * ldc;
+            if (beta == 0.0) std::fill(row, row + N, 0.0);  // Also clears NaNs
+            else for (size_t j = 0; j < N; ++j) row[j] *= beta;
+        }
+    }
+    if (M == 0 || N == 0 || K == 0 || alpha == 0.0) return;
+    
+    std::vector<double> packedB;
+    for (size_t jc = 0; jc < N; jc += kern.nc) {
+        size_t nc = std::min(kern.nc, N - jc);
+        size_t bPanels = (nc + NR - 1) / NR;
+        
+        for (size_t pc = 0; pc < K; pc += kern.kc) {
+            size_t kc = std::min(kern.kc, K - pc);
+            
+            // Pack B[pc.., jc..] into NR-wide slivers, k-major within each
+            packedB.resize(bPanels * NR * kc);
+            pool.parallelFor(bPanels, 16, [&](size_t begin, size_t end) {
+                for (size_t panel = begin; panel < end; ++panel) {
+                    double* dst = packedB.data() + panel * NR * kc;
+                    size_t j0 = panel * NR, width = std::min(NR, nc - j0);
+                    for (size_t k = 0; k < kc; ++k) {
+                        const double* src = B + (pc + k) * ldb + jc + j0;
+                        size_t c = 0;
+                        for (; c < width; ++c) dst[c] = src[c];
+                        for (; c < NR; ++c) dst[c] = 0.0;
+                        dst += NR;
+                    }
+                }
+            });
+            
+            size_t mBlocks = (M + kern.mc - 1) / kern.mc;
+            pool.parallelFor(mBlocks, 1, [&](size_t begin, size_t end) {
+                thread_local std::vector<double> packedA;
+                double edge[8 * 24];  // Largest tile of any kernel
+                for (size_t block = begin; block < end; ++block) {
+                    size_t ic = block * kern.mc, mc = std::min(kern.mc, M - ic);
+                    size_t aPanels = (mc + MR - 1) / MR;
+                    
+                    // Pack A[ic.., pc..] into MR-tall slivers, k-major within each
+                    packedA.resize(aPanels * MR * kc);
+                    for (size_t panel = 0; panel < aPanels; ++panel) {
+                        double* dst = packedA.data() + panel * MR * kc;
+                        size_t i0 = panel * MR, height = std::min(MR, mc - i0);
+                        for (size_t k = 0; k < kc; ++k) {
+                            size_t r = 0;
+                            for (; r < height; ++r) dst[r] = A[(ic + i0 + r) * lda + pc + k];
+                            for (; r < MR; ++r) dst[r] = 0.0;
+                            dst += MR;
+                        }
+                    }
+                    
+                    for (size_t jp = 0; jp < bPanels; ++jp) {
+                        size_t j0 = jp * NR, width = std::min(NR, nc - j0);
+                        const double* bSliver = packedB.data() + jp * NR * kc;
+                        for (size_t ip = 0; ip < aPanels; ++ip) {
+                            size_t i0 = ip * MR, height = std::min(MR, mc - i0);
+                            const double* aSliver = packedA.data() + ip * MR * kc;
+                            double* cTile = C + (ic + i0) * ldc + jc + j0;
+                            if (height == MR && width == NR) {
+                                kern.micro(kc, aSliver, bSliver, cTile, ldc, alpha);
+                            } else {
+                                // Partial tile: run the full kernel into scratch, copy the valid part
+                                std::fill(edge, edge + MR * NR, 0.0);
+                                kern.micro(kc, aSliver, bSliver, edge, NR, alpha);
+                                for (size_t r = 0; r < height; ++r) {
+                                    for (size_t c = 0; c < width; ++c) cTile[r * ldc + c] += edge[r * NR + c];
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+        }
+    }
+}
+
+// Nominal peak of the current core count and kernel, from the reported clock
+inline double theoreticalPeakGflops(size_t threads) {
+    double mhz = 0.0;
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.rfind("cpu MHz", 0) == 0) {
+            mhz = std::stod(line.substr(line.find(':') + 1));
+            break;
+        }
+    }
+    return mhz * 1e-3 * gemmKernel().flopsPerCycle * threads;
+}
+
+// Bounded lock-free MPMC ring (Vyukov). Each cell's sequence number equals
+// its position when the cell is free for that lap and position + 1 once it
+// holds a value, so producers and consumers claim cells with one CAS each.
+template<typename T>
+class BoundedMpmcRing {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+    
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+    
+public:
+    // capacity must be a power of two
+    explicit BoundedMpmcRing(size_t capacity) : cells_(new Cell[capacity]), mask_(capacity - 1) {
+        for (size_t i = 0; i < capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    
+    bool tryPush(T& value) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    
+    bool tryPop(T& out) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = std::move(cell.value);
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Empty
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+enum class AdmissionPolicy {
+    Reject,      // Refuse the new request
+    ShedLowest   // Drop a queued request of lower priority to make room
+};
+
+struct SchedulerOptions {
+    size_t ringCapacity = 1024;                        // Per worker and level, power of two
+    std::chrono::microseconds agingQuantum{2000};      // 0 = strict priority
+    std::chrono::microseconds latencySLO{0};           // 0 = admit everything
+    AdmissionPolicy admission = AdmissionPolicy::Reject;
+};
+
+// Multi-level scheduler. Every worker owns one lock-free ring per priority
+// level. Producers push into their home worker's rings. A worker takes the
+// best level from its own rings first and steals from the others when those
+// are empty, so no worker idles while anything is queued.
+//
+// Aging: a non-empty level's effective priority grows by one per
+// agingQuantum since it was last served, so however much higher-priority
+// work arrives, level l is still served about once every (kLevels - l) quanta.
+//
+// Admission: the expected queueing delay is pending * meanService / workers.
+// When it exceeds latencySLO, the request is either rejected or it evicts a
+// queued request from the lowest non-empty level below its own.
+//
+// Capacity: each level holds at most workers * ringCapacity queued requests.
+// A push that finds every ring of its level full returns QueueFull, whatever
+// the SLO; that is a sizing limit, not an overload verdict.
+template<typename Task>
+class MultiLevelScheduler {
+public:
+    static constexpr int kLevels = 8;
+    
+    enum class Admission { Accepted, Rejected, AcceptedAfterShed, QueueFull };
+    
+    struct LevelStats {
+        size_t served;
+        double maxWaitMs;
+    };
+    
+private:
+    struct Entry {
+        Task task;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+    
+    struct alignas(64) LevelState {
+        std::atomic<size_t> count{0};
+        std::atomic<int64_t> lastServedNs{0};
+        std::atomic<size_t> served{0};
+        std::atomic<int64_t> maxWaitNs{0};
+    };
+    
+    using Clock = std::chrono::steady_clock;
+    
+    size_t workers_;
+    SchedulerOptions options_;
+    // rings_[worker * kLevels + level]
+    std::vector<std::unique_ptr<BoundedMpmcRing<Entry>>> rings_;
+    LevelState levels_[kLevels];
+    
+    alignas(64) std::atomic<size_t> pending_{0};
+    std::atomic<int64_t> meanServiceNs_{0};
+    std::atomic<size_t> steals_{0};
+    std::atomic<size_t> rejected_{0};
+    std::atomic<size_t> shed_{0};
+    std::atomic<size_t> queueFull_{0};
+    std::atomic<size_t> nextHome_{0};
+    
+    // Sleep/wake for idle workers only; the queues themselves take no lock
+    std::mutex idleMutex_;
+    std::condition_variable idleCv_;
+    std::atomic<size_t> idleWorkers_{0};
+    std::atomic<bool> stopped_{false};
+    
+    static int levelOf(int priority) {
+        return std::max(0, std::min(priority, kLevels - 1));
+    }
+    
+    static int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now().time_since_epoch()).count();
+    }
+    
+    BoundedMpmcRing<Entry>& ring(size_t worker, int level) {
+        return *rings_[worker * kLevels + level];
+    }
+    
+    static size_t& boundWorker() {
+        thread_local size_t worker = SIZE_MAX;
+        return worker;
+    }
+    
+    // Worker threads push to their own rings, other threads are spread round-robin
+    size_t homeWorker() {
+        if (boundWorker() != SIZE_MAX) return boundWorker() % workers_;
+        thread_local size_t home = nextHome_.fetch_add(1, std::memory_order_relaxed);
+        return home % workers_;
+    }
+    
+    // Pops the oldest entry of level from worker's ring, or steals one
+    bool takeFrom(size_t worker, int level, Entry& out) {
+        for (size_t i = 0; i < workers_; ++i) {
+            if (ring((worker + i) % workers_, level).tryPop(out)) {
+                if (i != 0) steals_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void retire(int level, const Entry& entry, int64_t now) {
+        levels_[level].count.fetch_sub(1, std::memory_order_relaxed);
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        levels_[level].lastServedNs.store(now, std::memory_order_relaxed);
+        levels_[level].served.fetch_add(1, std::memory_order_relaxed);
+        int64_t wait = now - std::chrono::duration_cast<std::chrono::nanoseconds>(
+            entry.enqueued.time_since_epoch()).count();
+        int64_t seen = levels_[level].maxWaitNs.load(std::memory_order_relaxed);
+        while (wait > seen && !levels_[level].maxWaitNs.compare_exchange_weak(seen, wait)) {}
+    }
+    
+    bool overloaded() const {
+        if (options_.latencySLO.count() == 0) return false;
+        double expectedNs = double(pending_.load(std::memory_order_relaxed)) *
+                            double(meanServiceNs_.load(std::memory_order_relaxed)) / double(workers_);
+        return expectedNs > 1e3 * double(options_.latencySLO.count());
+    }
+    
+    // Evicts one queued entry below level, lowest level first
+    bool shedBelow(int level, Task& shed) {
+        for (int l = 0; l < level; ++l) {
+            if (levels_[l].count.load(std::memory_order_relaxed) == 0) continue;
+            Entry victim;
+            for (size_t w = 0; w < workers_; ++w) {
+                if (ring(w, l).tryPop(victim)) {
+                    levels_[l].count.fetch_sub(1, std::memory_order_relaxed);
+                    pending_.fetch_sub(1, std::memory_order_relaxed);
+                    shed = std::move(victim.task);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    
+public:
+    MultiLevelScheduler(size_t workers, const SchedulerOptions& options = {})
+        : workers_(std::max<size_t>(workers, 1)), options_(options) {
+        for (size_t i = 0; i < workers_ * kLevels; ++i) {
+            rings_.push_back(std::make_unique<BoundedMpmcRing<Entry>>(options_.ringCapacity));
+        }
+    }
+    
+    // Routes pushes made by the calling worker thread to its own rings
+    static void bindWorker(size_t worker) { boundWorker() = worker; }
+    
+    // On Rejected or QueueFull, task is left untouched. On AcceptedAfterShed,
+    // and on a QueueFull that came after an eviction, shed holds the evicted
+    // lower-priority task, which the caller must fail.
+    Admission push(Task& task, int priority, Task& shed) {
+        int level = levelOf(priority);
+        Admission result = Admission::Accepted;
+        if (overloaded()) {
+            if (options_.admission == AdmissionPolicy::ShedLowest && shedBelow(level, shed)) {
+                shed_.fetch_add(1, std::memory_order_relaxed);
+                result = Admission::AcceptedAfterShed;
+            } else {
+                rejected_.fetch_add(1, std::memory_order_relaxed);
+                return Admission::Rejected;
+            }
+        }
+        
+        Entry entry{std::move(task), Clock::now()};
+        size_t home = homeWorker();
+        // A level that was empty starts aging now, not from its last service
+        if (levels_[level].count.fetch_add(1, std::memory_order_relaxed) == 0) {
+            levels_[level].lastServedNs.store(nowNs(), std::memory_order_relaxed);
+        }
+        // Count the entry before it becomes visible, so a worker's retire()
+        // can never decrement pending_ below zero
+        pending_.fetch_add(1, std::memory_order_seq_cst);
+        bool stored = false;
+        for (size_t i = 0; i < workers_ && !stored; ++i) {
+            stored = ring((home + i) % workers_, level).tryPush(entry);
+        }
+        if (!stored) {
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            levels_[level].count.fetch_sub(1, std::memory_order_relaxed);
+            task = std::move(entry.task);
+            queueFull_.fetch_add(1, std::memory_order_relaxed);
+            return Admission::QueueFull;
+        }
+        
+        if (idleWorkers_.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            idleCv_.notify_one();
+        }
+        return result;
+    }
+    
+    // Non-blocking: picks the non-empty level with the highest aged priority
+    bool tryPop(size_t worker, Task& out) {
+        if (pending_.load(std::memory_order_acquire) == 0) return false;
+        int64_t now = nowNs();
+        int64_t quantum = std::chrono::duration_cast<std::chrono::nanoseconds>(options_.agingQuantum).count();
+        
+        int order[kLevels];
+        double effective[kLevels];
+        int candidates = 0;
+        for (int l = kLevels - 1; l >= 0; --l) {
+            if (levels_[l].count.load(std::memory_order_relaxed) == 0) continue;
+            double boost = quantum > 0
+                ? double(now - levels_[l].lastServedNs.load(std::memory_order_relaxed)) / double(quantum) : 0.0;
+            effective[l] = l + std::max(0.0, boost);
+            order[candidates++] = l;
+        }
+        // Highest effective priority first; ties keep the higher level
+        std::stable_sort(order, order + candidates, [&](int a, int b) { return effective[a] > effective[b]; });
+        
+        for (int i = 0; i < candidates; ++i) {
+            Entry entry;
+            if (takeFrom(worker, order[i], entry)) {
+                retire(order[i], entry, now);
+                out = std::move(entry.task);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // Blocks until a task is available; false once stopped and drained
+    bool waitPop(size_t worker, Task& out) {
+        while (true) {
+            if (tryPop(worker, out)) return true;
+            std::unique_lock<std::mutex> lock(idleMutex_);
+            idleWorkers_.fetch_add(1, std::memory_order_seq_cst);
+            idleCv_.wait(lock, [this] {
+                return pending_.load(std::memory_order_seq_cst) > 0 || stopped_.load();
+            });
+            idleWorkers_.fetch_sub(1, std::memory_order_relaxed);
+            if (stopped_.load() && pending_.load() == 0) return false;
+        }
+    }
+    
+    // Feeds the admission estimate; a racy moving average is precise enough
+    void recordServiceTime(std::chrono::nanoseconds elapsed) {
+        int64_t mean = meanServiceNs_.load(std::memory_order_relaxed);
+        int64_t sample = elapsed.count();
+        meanServiceNs_.store(mean == 0 ? sample : mean + (sample - mean) / 8, std::memory_order_relaxed);
+    }
+    
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            stopped_.store(true);
+        }
+        idleCv_.notify_all();
+    }
+    
+    bool stopped() const { return stopped_.load(); }
+    size_t size() const { return pending_.load(); }
+    size_t steals() const { return steals_.load(); }
+    size_t rejected() const { return rejected_.load(); }
+    size_t shed() const { return shed_.load(); }
+    size_t queueFull() const { return queueFull_.load(); }
+    
+    LevelStats levelStats(int priority) const {
+        const LevelState& state = levels_[levelOf(priority)];
+        return {state.served.load(), state.maxWaitNs.load() * 1e-6};
+    }
+};
+
 // Scientific Computation Request interface
 class ComputationRequest {
 public:
     virtual ~ComputationRequest() = default;
     virtual void call() = 0;
+    // Fails the request without running it (admission control)
+    virtual void reject(std::exception_ptr error) = 0;
+};
+
+// Raised through a request's future when the scheduler refuses or sheds it
+class AdmissionRejected : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
 };
 
 // Concrete Scientific Computation Request with Future
@@ -36,11 +759,13 @@ private:
     std::function<Result()> computation_;
     std::promise<Result> promise_;
     std::string name_;
+    bool logSlow_;
     
 public:
     ConcreteComputationRequest(std::function<Result()> computation, 
-                              const std::string& name = "Computation") 
-        : computation_(computation), name_(name) {}
+                              const std::string& name = "Computation",
+                              bool logSlow = true) 
+        : computation_(computation), name_(name), logSlow_(logSlow) {}
     
     void call() override {
         try {
@@ -56,7 +781,7 @@ public:
             auto end = std::chrono::high_resolution_clock::now();
             auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
             
-            if (duration > 100) {  // Log if computation took more than 100μs
+            if (logSlow_ && duration > 100) {  // Log if computation took more than 100μs
                 std::cout << "[" << name_ << "] Computation completed in " 
                           << duration << " μs\n";
             }
@@ -65,6 +790,10 @@ public:
         }
     }
     
+    void reject(std::exception_ptr error) override {
+        promise_.set_exception(error);
+    }
+    
     std::future<Result> getFuture() {
         return promise_.get_future();
     }
@@ -73,71 +802,70 @@ public:
 // Scientific Computation Queue with Priority Support
 class ComputationQueue {
 private:
-    struct PrioritizedRequest {
-        std::unique_ptr<ComputationRequest> request;
-        int priority;
-        std::chrono::steady_clock::time_point enqueueTime;
-        
-        bool operator<(const PrioritizedRequest& other) const {
-            // Higher priority value = higher priority
-            if (priority != other.priority) {
-                return priority < other.priority;  // For max heap
-            }
-            // If same priority, earlier request has priority
-            return enqueueTime > other.enqueueTime;
-        }
-    };
+    using Request = std::unique_ptr<ComputationRequest>;
     
-    std::priority_queue<PrioritizedRequest> queue_;
-    mutable std::mutex mutex_;
-    std::condition_variable condition_;
-    bool stopped_ = false;
+    MultiLevelScheduler<Request> scheduler_;
     std::atomic<size_t> totalProcessed_{0};
     std::atomic<size_t> totalEnqueued_{0};
     
 public:
-    void enqueue(std::unique_ptr<ComputationRequest> request, int priority = 0) {
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            if (stopped_) {
-                throw std::runtime_error("Computation queue is stopped");
-            }
-            queue_.push({std::move(request), priority, 
-                        std::chrono::steady_clock::now()});
-            totalEnqueued_++;
+    ComputationQueue(size_t numWorkers, const SchedulerOptions& options)
+        : scheduler_(numWorkers, options) {}
+    
+    // Higher priority value = higher priority, FIFO within a level
+    void enqueue(Request request, int priority = 0) {
+        if (scheduler_.stopped()) {
+            throw std::runtime_error("Computation queue is stopped");
+        }
+        totalEnqueued_++;
+        Request shed;
+        switch (scheduler_.push(request, priority, shed)) {
+            case MultiLevelScheduler<Request>::Admission::Rejected:
+                request->reject(std::make_exception_ptr(
+                    AdmissionRejected("Backlog exceeds latency SLO; request rejected")));
+                break;
+            case MultiLevelScheduler<Request>::Admission::QueueFull:
+                request->reject(std::make_exception_ptr(
+                    AdmissionRejected("Priority level queue full; request rejected")));
+                if (shed) {
+                    shed->reject(std::make_exception_ptr(
+                        AdmissionRejected("Shed in favour of higher-priority work")));
+                }
+                break;
+            case MultiLevelScheduler<Request>::Admission::AcceptedAfterShed:
+                shed->reject(std::make_exception_ptr(
+                    AdmissionRejected("Shed in favour of higher-priority work")));
+                break;
+            case MultiLevelScheduler<Request>::Admission::Accepted:
+                break;
         }
-        condition_.notify_one();
     }
     
-    std::unique_ptr<ComputationRequest> dequeue() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        condition_.wait(lock, [this] { return !queue_.empty() || stopped_; });
-        
-        if (stopped_ && queue_.empty()) {
+    // Blocks until a request is available; nullptr once stopped and drained
+    Request dequeue(size_t workerId) {
+        Request request;
+        if (!scheduler_.waitPop(workerId, request)) {
             return nullptr;
         }
-        
-        auto request = std::move(const_cast<PrioritizedRequest&>(queue_.top()).request);
-        queue_.pop();
         totalProcessed_++;
         return request;
     }
     
+    void recordServiceTime(std::chrono::nanoseconds elapsed) {
+        scheduler_.recordServiceTime(elapsed);
+    }
+    
     void stop() {
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            stopped_ = true;
-        }
-        condition_.notify_all();
+        scheduler_.stop();
     }
     
     size_t size() const {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return queue_.size();
+        return scheduler_.size();
     }
     
     size_t totalProcessed() const { return totalProcessed_; }
     size_t totalEnqueued() const { return totalEnqueued_; }
+    const MultiLevelScheduler<Request>& scheduler() const { return scheduler_; }
 };
 
 // Scientific Computation Scheduler
@@ -150,22 +878,25 @@ private:
     std::atomic<size_t> activeWorkers_{0};
     
     void run(int workerId) {
-        while (running_) {
-            auto request = queue_.dequeue();
-            if (request) {
-                activeWorkers_++;
-                request->call();
-                activeWorkers_--;
-            } else if (!running_) {
+        MultiLevelScheduler<std::unique_ptr<ComputationRequest>>::bindWorker(workerId);
+        while (true) {
+            auto request = queue_.dequeue(workerId);
+            if (!request) {
                 break;
             }
+            activeWorkers_++;
+            auto start = std::chrono::steady_clock::now();
+            request->call();
+            queue_.recordServiceTime(std::chrono::steady_clock::now() - start);
+            activeWorkers_--;
         }
     }
     
 public:
     ComputationScheduler(const std::string& name = "ComputeScheduler", 
-                        size_t numWorkers = std::thread::hardware_concurrency()) 
-        : name_(name), running_(true) {
+                        size_t numWorkers = std::thread::hardware_concurrency(),
+                        const SchedulerOptions& options = {}) 
+        : queue_(numWorkers, options), running_(true), name_(name) {
         
         std::cout << "[" << name_ << "] Starting with " << numWorkers 
                   << " computation threads\n";
@@ -193,8 +924,11 @@ public:
                 }
             }
             
+            const auto& scheduler = queue_.scheduler();
             std::cout << "[" << name_ << "] Stopped. Total computations processed: " 
-                      << queue_.totalProcessed() << "/" << queue_.totalEnqueued() << "\n";
+                      << queue_.totalProcessed() << "/" << queue_.totalEnqueued()
+                      << " (steals: " << scheduler.steals() << ", rejected: " << scheduler.rejected()
+                      << ", shed: " << scheduler.shed() << ", queue full: " << scheduler.queueFull() << ")\n";
         }
     }
     
@@ -209,6 +943,11 @@ public:
     std::pair<size_t, size_t> getStatistics() const {
         return {queue_.totalProcessed(), queue_.totalEnqueued()};
     }
+    
+    // Requests served and longest queueing delay at one priority level
+    MultiLevelScheduler<std::unique_ptr<ComputationRequest>>::LevelStats levelStats(int priority) const {
+        return queue_.scheduler().levelStats(priority);
+    }
 };
 
 // Scientific Computation Proxy
@@ -257,48 +996,73 @@ public:
 };
 
 // Monte Carlo Simulation Servant
+// Each request draws from its own Philox streams (request id in the high
+// word, batch index in the low word), so the servant holds no generator
+// state and requests may run on several scheduler workers at once. Batches
+// spread over the shared fork-join pool and are summed in batch order, so an
+// answer depends only on the seed and the request id.
 class MonteCarloServant {
 private:
+    static constexpr int batchSize_ = 1 << 16;
+    
     std::string name_;
-    int samplesProcessed_ = 0;
-    double currentEstimate_ = 0.0;
-    std::mt19937 generator_;
+    std::atomic<int> samplesProcessed_{0};
+    std::atomic<double> currentEstimate_{0.0};
+    uint64_t seed_;
+    
+    template <typename Body>
+    void forEachBatch(int samples, uint64_t request, Body body) {
+        const size_t batches = (static_cast<size_t>(samples) + batchSize_ - 1) / batchSize_;
+        gemmPool().parallelFor(batches, 1, [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                PhiloxStream rng(seed_, (request << 32) | b);
+                int count = std::min<int>(batchSize_, samples - static_cast<int>(b) * batchSize_);
+                body(b, count, rng);
+            }
+        });
+    }
     
 public:
-    MonteCarloServant(const std::string& name, unsigned seed = std::random_device{}()) 
-        : name_(name), generator_(seed) {}
-    
-    double estimatePi(int samples) {
-        int insideCircle = 0;
-        std::uniform_real_distribution<double> dist(0.0, 1.0);
-        
-        for (int i = 0; i < samples; ++i) {
-            double x = dist(generator_);
-            double y = dist(generator_);
-            if (x*x + y*y <= 1.0) {
-                insideCircle++;
+    MonteCarloServant(const std::string& name, uint64_t seed = std::random_device{}()) 
+        : name_(name), seed_(seed) {}
+    
+    double estimatePi(int samples, uint64_t request) {
+        std::vector<long> inside((static_cast<size_t>(samples) + batchSize_ - 1) / batchSize_, 0);
+        forEachBatch(samples, request, [&](size_t batch, int count, PhiloxStream& rng) {
+            long hits = 0;
+            for (int i = 0; i < count; ++i) {
+                double x = rng.uniform();
+                double y = rng.uniform();
+                if (x*x + y*y <= 1.0) {
+                    hits++;
+                }
             }
-        }
+            inside[batch] = hits;
+        });
+        long insideCircle = std::accumulate(inside.begin(), inside.end(), 0L);
         
         samplesProcessed_ += samples;
-        currentEstimate_ = 4.0 * insideCircle / samples;
+        double estimate = 4.0 * insideCircle / samples;
+        currentEstimate_ = estimate;
         
         std::cout << "[" << name_ << "] Estimated π = " << std::fixed 
-                  << std::setprecision(6) << currentEstimate_ 
+                  << std::setprecision(6) << estimate 
                   << " (from " << samples << " samples)\n";
         
-        return currentEstimate_;
+        return estimate;
     }
     
     double integrateFunction(std::function<double(double)> f, 
-                           double a, double b, int samples) {
-        std::uniform_real_distribution<double> dist(a, b);
-        double sum = 0.0;
-        
-        for (int i = 0; i < samples; ++i) {
-            double x = dist(generator_);
-            sum += f(x);
-        }
+                           double a, double b, int samples, uint64_t request) {
+        std::vector<double> sums((static_cast<size_t>(samples) + batchSize_ - 1) / batchSize_, 0.0);
+        forEachBatch(samples, request, [&](size_t batch, int count, PhiloxStream& rng) {
+            double sum = 0.0;
+            for (int i = 0; i < count; ++i) {
+                sum += f(a + (b - a) * rng.uniform());
+            }
+            sums[batch] = sum;
+        });
+        double sum = std::accumulate(sums.begin(), sums.end(), 0.0);
         
         double result = (b - a) * sum / samples;
         samplesProcessed_ += samples;
@@ -325,25 +1089,29 @@ private:
     std::shared_ptr<MonteCarloServant> servant_;
     std::shared_ptr<ComputationScheduler> scheduler_;
     ScientificComputationProxy<MonteCarloServant> proxy_;
+    std::atomic<uint64_t> nextRequest_{0};  // Stream id, fixed at submission
     
 public:
     ActiveMonteCarloSimulator(const std::string& name,
-                             std::shared_ptr<ComputationScheduler> scheduler = nullptr) 
-        : servant_(std::make_shared<MonteCarloServant>(name)),
+                             std::shared_ptr<ComputationScheduler> scheduler = nullptr,
+                             uint64_t seed = std::random_device{}()) 
+        : servant_(std::make_shared<MonteCarloServant>(name, seed)),
           scheduler_(scheduler ? scheduler : 
                     std::make_shared<ComputationScheduler>("MonteCarloScheduler", 2)),
           proxy_(servant_, scheduler_) {}
     
     std::future<double> estimatePi(int samples, int priority = 0) {
         return proxy_.computeWithPriority<double>(&MonteCarloServant::estimatePi, 
-                                                 priority, "Pi Estimation", samples);
+                                                 priority, "Pi Estimation", samples,
+                                                 nextRequest_.fetch_add(1));
     }
     
     std::future<double> integrateFunction(std::function<double(double)> f,
                                         double a, double b, int samples,
                                         int priority = 0) {
         return proxy_.computeWithPriority<double>(&MonteCarloServant::integrateFunction, 
-                                                 priority, "MC Integration", f, a, b, samples);
+                                                 priority, "MC Integration", f, a, b, samples,
+                                                 nextRequest_.fetch_add(1));
     }
     
     std::future<int> getSamplesProcessed() {
@@ -492,16 +1260,8 @@ private:
     std::vector<double> multiplyMatrices(const std::vector<double>& A,
                                         const std::vector<double>& B,
                                         int m, int n, int p) {
-        std::vector<double> C(m * p, 0.0);
-        
-        for (int i = 0; i < m; ++i) {
-            for (int j = 0; j < p; ++j) {
-                for (int k = 0; k < n; ++k) {
-                    C[i * p + j] += A[i * n + k] * B[k * p + j];
-                }
-            }
-        }
-        
+        std::vector<double> C(size_t(m) * p, 0.0);
+        blockedGemm(m, p, n, 1.0, A.data(), n, B.data(), p, 0.0, C.data(), p);
         return C;
     }
     
@@ -521,7 +1281,9 @@ public:
         
         std::cout << "[" << name_ << "] Matrix multiply (" << m << "x" << n 
                   << ") × (" << n << "x" << p << ") completed in " 
-                  << duration << " μs\n";
+                  << duration << " μs (" << gemmKernel().name << ", "
+                  << std::fixed << std::setprecision(2)
+                  << 2.0 * m * n * p / std::max<long long>(duration, 1) / 1e3 << " GFLOPS)\n";
         
         return result;
     }
@@ -684,6 +1446,104 @@ public:
     }
 };
 
+// Busy-waits for the given time, standing in for a short computation
+inline double spinFor(std::chrono::microseconds duration) {
+    auto end = std::chrono::steady_clock::now() + duration;
+    double x = 0.0;
+    while (std::chrono::steady_clock::now() < end) {
+        x = std::cos(x);
+    }
+    return x;
+}
+
+// Floods a small scheduler with top-priority requests while a few
+// priority-0 ones wait, first with strict priority and then with aging, and
+// finally overloads one that sheds low-priority work past a latency SLO
+void priorityFloodExample() {
+    std::cout << "\n\n=== Priority Flood and Admission Control ===\n\n";
+    
+    const int floodSize = 4000;
+    const int background = 8;
+    for (int quantumUs : {0, 250}) {
+        SchedulerOptions options;
+        options.ringCapacity = 4096;
+        options.agingQuantum = std::chrono::microseconds(quantumUs);
+        ComputationScheduler scheduler(quantumUs ? "AgingScheduler" : "StrictScheduler", 2, options);
+        
+        std::vector<std::future<double>> futures;
+        auto submit = [&](int priority) {
+            auto request = std::make_unique<ConcreteComputationRequest<double>>(
+                [] { return spinFor(std::chrono::microseconds(20)); }, "Flood", false);
+            futures.push_back(request->getFuture());
+            scheduler.enqueue(std::move(request), priority);
+        };
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < background; ++i) submit(0);
+        for (int i = 0; i < floodSize; ++i) submit(7);
+        for (auto& future : futures) future.get();
+        double drainMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        
+        std::cout << std::fixed << std::setprecision(1)
+                  << "  Aging quantum " << quantumUs << " us: priority-0 max wait "
+                  << scheduler.levelStats(0).maxWaitMs << " ms, priority-7 max wait "
+                  << scheduler.levelStats(7).maxWaitMs << " ms, flood drained in "
+                  << drainMs << " ms\n";
+    }
+    
+    // A burst far larger than the SLO allows. The admission estimate needs
+    // measured service times, so a few requests warm it up first.
+    SchedulerOptions options;
+    options.latencySLO = std::chrono::microseconds(5000);
+    options.admission = AdmissionPolicy::ShedLowest;
+    ComputationScheduler scheduler("SLOScheduler", 2, options);
+    
+    std::vector<std::future<double>> warmup;
+    for (int i = 0; i < 16; ++i) {
+        auto request = std::make_unique<ConcreteComputationRequest<double>>(
+            [] { return spinFor(std::chrono::microseconds(40)); }, "Warmup", false);
+        warmup.push_back(request->getFuture());
+        scheduler.enqueue(std::move(request), 7);
+    }
+    for (auto& future : warmup) future.get();
+    
+    std::vector<std::pair<int, std::future<double>>> futures;
+    for (int i = 0; i < 2000; ++i) {
+        int priority = i % 8;
+        auto request = std::make_unique<ConcreteComputationRequest<double>>(
+            [] { return spinFor(std::chrono::microseconds(40)); }, "Burst", false);
+        futures.emplace_back(priority, request->getFuture());
+        scheduler.enqueue(std::move(request), priority);
+    }
+    
+    int refused[MultiLevelScheduler<int>::kLevels] = {};
+    for (auto& [priority, future] : futures) {
+        try {
+            future.get();
+        } catch (const AdmissionRejected&) {
+            refused[priority]++;
+        }
+    }
+    std::cout << "  SLO 5 ms, 2000 requests of 40 us: refused per priority 0..7:";
+    for (int count : refused) std::cout << " " << count;
+    std::cout << "\n  Worst admitted wait: priority 0 " << scheduler.levelStats(0).maxWaitMs
+              << " ms, priority 7 " << scheduler.levelStats(7).maxWaitMs << " ms\n";
+    
+    // With the SLO off nothing is refused for latency, but a level still
+    // holds only workers * ringCapacity requests
+    SchedulerOptions small;
+    small.ringCapacity = 4;
+    MultiLevelScheduler<int> bounded(2, small);
+    int task = 0, shedTask = 0, accepted = 0;
+    auto outcome = MultiLevelScheduler<int>::Admission::Accepted;
+    while ((outcome = bounded.push(task, 3, shedTask)) == MultiLevelScheduler<int>::Admission::Accepted) {
+        ++accepted;
+    }
+    std::cout << "  SLO off, 2 workers x ring of 4: " << accepted << " accepted, then "
+              << (outcome == MultiLevelScheduler<int>::Admission::QueueFull ? "QueueFull" : "Rejected")
+              << " (" << bounded.rejected() << " SLO rejections)\n";
+}
+
 int main() {
     std::cout << "=== Active Object Pattern - Scientific Computing Demo ===\n";
     std::cout << "Asynchronous execution of scientific computations\n\n";
@@ -874,6 +1734,8 @@ int main() {
     std::cout << "Success rate: " << std::fixed << std::setprecision(1) 
               << (100.0 * processed / enqueued) << "%\n";
     
+    priorityFloodExample();
+    
     std::cout << "\n=== Active Object Pattern Benefits ===\n";
     std::cout << "• Asynchronous execution of expensive computations\n";
     std::cout << "• Priority-based scheduling for critical calculations\n";
@@ -18,6 +18,9 @@
 #include <iomanip>
 #include <fstream>
 #include <complex>
+#include <unordered_map>
+#include <future>
+#include <stdexcept>
 
 // Define M_PI for MSVC
 #ifndef M_PI
@@ -110,59 +113,421 @@ public:
     };
 };
 
-// Thread-safe computational results cache with read-write lock
+// Scalable reader-writer lock for read-mostly scientific data
+//
+// Readers announce themselves on one of kReaderSlots counters, each on its
+// own cache line, chosen per thread; an uncontended lock_read() is one atomic
+// increment on a line no other core is writing. A writer raises writer_,
+// which turns new readers away (writer preference), then waits for every
+// slot to drain. Writers are serialized on writer_mutex_. Readers blocked
+// behind a long write spin briefly and then park on a condition variable.
+// Meets the Lockable/SharedLockable requirements, so std::unique_lock and
+// std::shared_lock work with it.
+class ScalableReadWriteLock {
+private:
+    static constexpr size_t kReaderSlots = 64;
+    static constexpr int kSpinRounds = 128;
+    
+    struct alignas(64) ReaderSlot {
+        std::atomic<int> readers{0};
+    };
+    
+    ReaderSlot slots_[kReaderSlots];
+    alignas(64) std::atomic<bool> writer_{false};
+    std::mutex writer_mutex_;
+    
+    // Parking for readers that wait on a writer
+    alignas(64) std::mutex park_mutex_;
+    std::condition_variable park_cv_;
+    std::atomic<int> parked_readers_{0};
+    
+    static size_t my_slot() {
+        static std::atomic<size_t> next_slot{0};
+        thread_local size_t slot = next_slot.fetch_add(1, std::memory_order_relaxed) % kReaderSlots;
+        return slot;
+    }
+    
+    void wait_for_writer() {
+        for (int spin = 0; spin < kSpinRounds; ++spin) {
+            if (!writer_.load(std::memory_order_acquire)) return;
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(park_mutex_);
+        parked_readers_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        park_cv_.wait(lock, [this] { return !writer_.load(std::memory_order_acquire); });
+        parked_readers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    
+    void wait_for_readers() {
+        for (size_t i = 0; i < kReaderSlots; ++i) {
+            while (slots_[i].readers.load(std::memory_order_acquire) != 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+    
+public:
+    void lock_read() {
+        std::atomic<int>& readers = slots_[my_slot()].readers;
+        while (true) {
+            if (writer_.load(std::memory_order_acquire)) {
+                wait_for_writer();
+            }
+            readers.fetch_add(1, std::memory_order_seq_cst);
+            if (!writer_.load(std::memory_order_seq_cst)) {
+                return;
+            }
+            // A writer arrived between the check and the increment; back off
+            readers.fetch_sub(1, std::memory_order_release);
+        }
+    }
+    
+    bool try_lock_read() {
+        std::atomic<int>& readers = slots_[my_slot()].readers;
+        if (writer_.load(std::memory_order_acquire)) return false;
+        readers.fetch_add(1, std::memory_order_seq_cst);
+        if (!writer_.load(std::memory_order_seq_cst)) return true;
+        readers.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+    
+    void unlock_read() {
+        slots_[my_slot()].readers.fetch_sub(1, std::memory_order_release);
+    }
+    
+    void lock_write() {
+        writer_mutex_.lock();
+        writer_.store(true, std::memory_order_seq_cst);
+        wait_for_readers();
+    }
+    
+    bool try_lock_write() {
+        if (!writer_mutex_.try_lock()) return false;
+        writer_.store(true, std::memory_order_seq_cst);
+        for (size_t i = 0; i < kReaderSlots; ++i) {
+            if (slots_[i].readers.load(std::memory_order_acquire) != 0) {
+                unlock_write();
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    void unlock_write() {
+        writer_.store(false, std::memory_order_release);
+        writer_mutex_.unlock();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked_readers_.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(park_mutex_);
+            park_cv_.notify_all();
+        }
+    }
+    
+    // Standard library lock concepts
+    void lock() { lock_write(); }
+    bool try_lock() { return try_lock_write(); }
+    void unlock() { unlock_write(); }
+    void lock_shared() { lock_read(); }
+    bool try_lock_shared() { return try_lock_read(); }
+    void unlock_shared() { unlock_read(); }
+};
+
+// Default hasher for cache keys; std::hash has no std::pair overload
+template<typename Key>
+struct CacheKeyHash {
+    size_t operator()(const Key& key) const { return std::hash<Key>{}(key); }
+};
+
+template<typename A, typename B>
+struct CacheKeyHash<std::pair<A, B>> {
+    size_t operator()(const std::pair<A, B>& key) const {
+        size_t h = std::hash<A>{}(key.first);
+        return h ^ (std::hash<B>{}(key.second) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+    }
+};
+
+// Bytes charged against the memory budget for one cached result
 template<typename Key, typename Value>
+struct CacheEntryBytes {
+    size_t operator()(const Key&, const Value&) const { return sizeof(Key) + sizeof(Value); }
+};
+
+template<typename Key, typename T>
+struct CacheEntryBytes<Key, std::vector<T>> {
+    size_t operator()(const Key&, const std::vector<T>& value) const {
+        return sizeof(Key) + sizeof(value) + value.capacity() * sizeof(T);
+    }
+};
+
+// Thread-safe computational results cache with read-write lock
+//
+// Keys are hashed onto independent shards, each with its own ReadWriteLock,
+// so lookups for unrelated results never share a lock. Eviction is CLOCK
+// (second chance): a hit only sets a per-slot reference bit, which keeps
+// get() on the shared read lock, and put() sweeps the clock hand to find a
+// victim in amortised O(1). Both an entry count and a byte budget are
+// enforced per shard. get_or_compute() coalesces concurrent misses so an
+// expensive result is computed once while other requesters wait for it.
+//
+// Each shard gets max_bytes / shard_count() of the byte budget, and an entry
+// must fit in its shard's share: a larger result is never cached (put() and
+// get_or_compute() still succeed, the value is just not retained; see
+// max_entry_bytes() and oversized()). Size max_bytes, or lower num_shards,
+// so that the largest result to cache fits in one share.
+template<typename Key, typename Value,
+         typename Hash = CacheKeyHash<Key>,
+         typename SizeOf = CacheEntryBytes<Key, Value>>
 class ComputationalResultsCache {
 private:
-    mutable ReadWriteLock lock_;
-    std::map<Key, Value> cache_;
-    size_t max_size_;
+    struct Slot {
+        Key key{};
+        Value value{};
+        size_t bytes = 0;
+        bool occupied = false;
+        std::atomic<bool> referenced{false};
+    };
+    
+    struct alignas(64) Shard {
+        mutable ReadWriteLock lock;
+        std::unordered_map<Key, uint32_t, Hash> index;
+        std::vector<Slot> slots;
+        std::vector<uint32_t> free_slots;
+        size_t hand = 0;
+        size_t bytes = 0;
+        size_t max_entries = 0;
+        size_t max_bytes = 0;
+        
+        // Results currently being computed by get_or_compute()
+        std::mutex inflight_mutex;
+        std::unordered_map<Key, std::shared_future<Value>, Hash> inflight;
+    };
+    
+    std::unique_ptr<Shard[]> shards_;
+    size_t shard_mask_;
+    Hash hasher_;
+    SizeOf size_of_;
     
     // Cache performance statistics
     mutable std::atomic<size_t> cache_hits_{0};
     mutable std::atomic<size_t> cache_misses_{0};
+    std::atomic<size_t> evictions_{0};
+    std::atomic<size_t> coalesced_waits_{0};
+    std::atomic<size_t> oversized_{0};
+    
+    Shard& shard_for(const Key& key) const {
+        // Remix so shard selection does not reuse the bits unordered_map buckets on
+        uint64_t h = hasher_(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return shards_[h & shard_mask_];
+    }
+    
+    static size_t choose_shard_count(size_t requested, size_t max_size) {
+        // Power of two, and never more shards than entries
+        size_t limit = std::max<size_t>(1, std::min(requested, max_size));
+        size_t n = 1;
+        while (n * 2 <= limit) n *= 2;
+        return n;
+    }
+    
+    bool lookup(Shard& shard, const Key& key, Value& value) const {
+        ReadWriteLock::ReadGuard guard(shard.lock);
+        auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            return false;
+        }
+        Slot& slot = shard.slots[it->second];
+        value = slot.value;
+        slot.referenced.store(true, std::memory_order_relaxed);
+        return true;
+    }
+    
+    // Caller holds the shard write lock
+    void evict_one(Shard& shard) {
+        while (true) {
+            Slot& slot = shard.slots[shard.hand];
+            size_t index = shard.hand;
+            shard.hand = (shard.hand + 1) % shard.slots.size();
+            
+            if (!slot.occupied) continue;
+            if (slot.referenced.exchange(false, std::memory_order_relaxed)) continue;
+            
+            shard.index.erase(slot.key);
+            shard.bytes -= slot.bytes;
+            slot.occupied = false;
+            slot.value = Value{};
+            shard.free_slots.push_back(static_cast<uint32_t>(index));
+            evictions_++;
+            return;
+        }
+    }
+    
+    void insert(Shard& shard, const Key& key, const Value& value) {
+        size_t bytes = size_of_(key, value);
+        ReadWriteLock::WriteGuard guard(shard.lock);
+        
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            remove_slot(shard, it->second);
+            shard.index.erase(it);
+        }
+        
+        // Results larger than a whole shard's budget are not cached
+        if (bytes > shard.max_bytes) {
+            oversized_++;
+            return;
+        }
+        
+        while (!shard.index.empty() &&
+               (shard.index.size() >= shard.max_entries || shard.bytes + bytes > shard.max_bytes)) {
+            evict_one(shard);
+        }
+        
+        uint32_t index = shard.free_slots.back();
+        shard.free_slots.pop_back();
+        Slot& slot = shard.slots[index];
+        slot.key = key;
+        slot.value = value;
+        slot.bytes = bytes;
+        slot.occupied = true;
+        slot.referenced.store(false, std::memory_order_relaxed);
+        shard.bytes += bytes;
+        shard.index.emplace(key, index);
+    }
+    
+    // Caller holds the shard write lock; does not touch the index
+    void remove_slot(Shard& shard, uint32_t index) {
+        Slot& slot = shard.slots[index];
+        shard.bytes -= slot.bytes;
+        slot.occupied = false;
+        slot.value = Value{};
+        shard.free_slots.push_back(index);
+    }
     
 public:
-    explicit ComputationalResultsCache(size_t max_size = 1000) : max_size_(max_size) {}
+    explicit ComputationalResultsCache(size_t max_size = 1000,
+                                       size_t max_bytes = SIZE_MAX,
+                                       size_t num_shards = 16)
+        : shard_mask_(choose_shard_count(num_shards, max_size) - 1) {
+        // Eviction needs at least one slot to hand back to insert()
+        if (max_size == 0) {
+            throw std::invalid_argument("Cache capacity must be at least one entry");
+        }
+        size_t n = shard_mask_ + 1;
+        shards_.reset(new Shard[n]);
+        for (size_t i = 0; i < n; ++i) {
+            Shard& shard = shards_[i];
+            // Spread the remainder so the totals match the requested limits
+            shard.max_entries = max_size / n + (i < max_size % n ? 1 : 0);
+            shard.max_bytes = max_bytes == SIZE_MAX ? SIZE_MAX
+                            : max_bytes / n + (i < max_bytes % n ? 1 : 0);
+            shard.slots = std::vector<Slot>(shard.max_entries);
+            shard.free_slots.reserve(shard.max_entries);
+            for (size_t s = shard.max_entries; s-- > 0;) {
+                shard.free_slots.push_back(static_cast<uint32_t>(s));
+            }
+            shard.index.reserve(shard.max_entries);
+        }
+    }
     
     bool get(const Key& key, Value& value) const {
-        ReadWriteLock::ReadGuard guard(lock_);
-        
-        auto it = cache_.find(key);
-        if (it != cache_.end()) {
-            value = it->second;
+        if (lookup(shard_for(key), key, value)) {
             cache_hits_++;
             return true;
         }
-        
         cache_misses_++;
         return false;
     }
     
     void put(const Key& key, const Value& value) {
-        ReadWriteLock::WriteGuard guard(lock_);
+        insert(shard_for(key), key, value);
+    }
+    
+    // Returns the cached result, or computes it exactly once across all
+    // threads that miss on the same key concurrently
+    template<typename Compute>
+    Value get_or_compute(const Key& key, Compute compute) {
+        Shard& shard = shard_for(key);
+        Value value;
+        if (lookup(shard, key, value)) {
+            cache_hits_++;
+            return value;
+        }
+        cache_misses_++;
         
-        // Evict oldest computation result if at capacity
-        if (cache_.size() >= max_size_ && cache_.find(key) == cache_.end()) {
-            cache_.erase(cache_.begin());
+        std::promise<Value> promise;
+        {
+            std::unique_lock<std::mutex> lock(shard.inflight_mutex);
+            auto it = shard.inflight.find(key);
+            if (it != shard.inflight.end()) {
+                std::shared_future<Value> pending = it->second;
+                lock.unlock();
+                coalesced_waits_++;
+                return pending.get();
+            }
+            // The leader may have published and retired between our miss and here
+            if (lookup(shard, key, value)) {
+                return value;
+            }
+            shard.inflight.emplace(key, promise.get_future().share());
+        }
+        
+        try {
+            value = compute(key);
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            std::lock_guard<std::mutex> lock(shard.inflight_mutex);
+            shard.inflight.erase(key);
+            throw;
         }
         
-        cache_[key] = value;
+        // Publish before retiring the in-flight entry so late missers find it
+        insert(shard, key, value);
+        promise.set_value(value);
+        std::lock_guard<std::mutex> lock(shard.inflight_mutex);
+        shard.inflight.erase(key);
+        return value;
     }
     
     void remove(const Key& key) {
-        ReadWriteLock::WriteGuard guard(lock_);
-        cache_.erase(key);
+        Shard& shard = shard_for(key);
+        ReadWriteLock::WriteGuard guard(shard.lock);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            remove_slot(shard, it->second);
+            shard.index.erase(it);
+        }
     }
     
     size_t size() const {
-        ReadWriteLock::ReadGuard guard(lock_);
-        return cache_.size();
+        size_t total = 0;
+        for (size_t i = 0; i <= shard_mask_; ++i) {
+            ReadWriteLock::ReadGuard guard(shards_[i].lock);
+            total += shards_[i].index.size();
+        }
+        return total;
+    }
+    
+    size_t memory_used() const {
+        size_t total = 0;
+        for (size_t i = 0; i <= shard_mask_; ++i) {
+            ReadWriteLock::ReadGuard guard(shards_[i].lock);
+            total += shards_[i].bytes;
+        }
+        return total;
     }
     
     void clear() {
-        ReadWriteLock::WriteGuard guard(lock_);
-        cache_.clear();
+        for (size_t i = 0; i <= shard_mask_; ++i) {
+            Shard& shard = shards_[i];
+            ReadWriteLock::WriteGuard guard(shard.lock);
+            for (auto& entry : shard.index) {
+                remove_slot(shard, entry.second);
+            }
+            shard.index.clear();
+        }
     }
     
     void get_stats(size_t& hits, size_t& misses) const {
@@ -170,6 +535,21 @@ public:
         misses = cache_misses_.load();
     }
     
+    size_t evictions() const { return evictions_.load(); }
+    size_t coalesced_waits() const { return coalesced_waits_.load(); }
+    size_t shard_count() const { return shard_mask_ + 1; }
+    // Puts that were not retained because they exceed their shard's budget
+    size_t oversized() const { return oversized_.load(); }
+    
+    // Largest entry, as charged by SizeOf, that every shard can hold
+    size_t max_entry_bytes() const {
+        size_t smallest = SIZE_MAX;
+        for (size_t i = 0; i <= shard_mask_; ++i) {
+            smallest = std::min(smallest, shards_[i].max_bytes);
+        }
+        return smallest;
+    }
+    
     double hit_rate() const {
         size_t h = cache_hits_.load();
         size_t m = cache_misses_.load();
@@ -179,10 +559,11 @@ public:
 };
 
 // Scientific data array with concurrent access using std::shared_mutex (C++17)
-template<typename T>
+// or any other SharedLockable mutex such as ScalableReadWriteLock
+template<typename T, typename SharedMutex = std::shared_mutex>
 class ScientificDataArray {
 private:
-    mutable std::shared_mutex data_mutex_;
+    mutable SharedMutex data_mutex_;
     std::vector<T> scientific_data_;
     std::string dataset_name_;
     
@@ -192,7 +573,7 @@ public:
     
     // Multiple analysis threads can read data simultaneously
     T get(size_t index) const {
-        std::shared_lock<std::shared_mutex> lock(data_mutex_);
+        std::shared_lock<SharedMutex> lock(data_mutex_);
         if (index >= scientific_data_.size()) {
             throw std::out_of_range("Scientific data index out of range");
         }
@@ -200,23 +581,23 @@ public:
     }
     
     size_t size() const {
-        std::shared_lock<std::shared_mutex> lock(data_mutex_);
+        std::shared_lock<SharedMutex> lock(data_mutex_);
         return scientific_data_.size();
     }
     
     bool contains(const T& value) const {
-        std::shared_lock<std::shared_mutex> lock(data_mutex_);
+        std::shared_lock<SharedMutex> lock(data_mutex_);
         return std::find(scientific_data_.begin(), scientific_data_.end(), value) != scientific_data_.end();
     }
     
     // Only one computation can append results at a time
     void push_back(const T& value) {
-        std::unique_lock<std::shared_mutex> lock(data_mutex_);
+        std::unique_lock<SharedMutex> lock(data_mutex_);
         scientific_data_.push_back(value);
     }
     
     void update(size_t index, const T& value) {
-        std::unique_lock<std::shared_mutex> lock(data_mutex_);
+        std::unique_lock<SharedMutex> lock(data_mutex_);
         if (index >= scientific_data_.size()) {
             throw std::out_of_range("Scientific data index out of range");
         }
@@ -224,13 +605,13 @@ public:
     }
     
     void clear() {
-        std::unique_lock<std::shared_mutex> lock(data_mutex_);
+        std::unique_lock<SharedMutex> lock(data_mutex_);
         scientific_data_.clear();
     }
     
     // Bulk read operation for analysis
     std::vector<T> get_all() const {
-        std::shared_lock<std::shared_mutex> lock(data_mutex_);
+        std::shared_lock<SharedMutex> lock(data_mutex_);
         return scientific_data_;  // Return copy for safe analysis
     }
 };
@@ -238,7 +619,8 @@ public:
 // Simulation state with version tracking for scientific computations
 class SimulationState {
 private:
-    mutable std::shared_mutex state_mutex_;
+    // Read-mostly: many monitors poll, one simulator updates
+    mutable ScalableReadWriteLock state_mutex_;
     std::vector<double> state_vector_;
     std::vector<double> gradients_;
     double total_energy_ = 0.0;
@@ -251,25 +633,25 @@ public:
     
     // Read operations for analysis
     std::vector<double> read_state() const {
-        std::shared_lock<std::shared_mutex> lock(state_mutex_);
+        std::shared_lock<ScalableReadWriteLock> lock(state_mutex_);
         std::cout << "[Analyzer-" << std::this_thread::get_id() << "] "
                   << "Reading simulation state (iteration " << iteration_ << ")\n";
         return state_vector_;
     }
     
     int get_iteration() const {
-        std::shared_lock<std::shared_mutex> lock(state_mutex_);
+        std::shared_lock<ScalableReadWriteLock> lock(state_mutex_);
         return iteration_;
     }
     
     std::vector<std::pair<int, double>> get_convergence_history() const {
-        std::shared_lock<std::shared_mutex> lock(state_mutex_);
+        std::shared_lock<ScalableReadWriteLock> lock(state_mutex_);
         return convergence_history_;
     }
     
     // Write operations for simulation updates
     void update_state(const std::vector<double>& new_state, double energy) {
-        std::unique_lock<std::shared_mutex> lock(state_mutex_);
+        std::unique_lock<ScalableReadWriteLock> lock(state_mutex_);
         std::cout << "[Simulator-" << std::this_thread::get_id() << "] "
                   << "Updating simulation state\n";
         
@@ -288,7 +670,7 @@ public:
     }
     
     void update_temperature(double new_temperature) {
-        std::unique_lock<std::shared_mutex> lock(state_mutex_);
+        std::unique_lock<ScalableReadWriteLock> lock(state_mutex_);
         std::cout << "[ThermalController-" << std::this_thread::get_id() << "] "
                   << "Updating temperature\n";
         
@@ -303,89 +685,86 @@ public:
     
     // Read operations for monitoring
     double get_energy() const {
-        std::shared_lock<std::shared_mutex> lock(state_mutex_);
+        std::shared_lock<ScalableReadWriteLock> lock(state_mutex_);
         return total_energy_;
     }
     
     double get_temperature() const {
-        std::shared_lock<std::shared_mutex> lock(state_mutex_);
+        std::shared_lock<ScalableReadWriteLock> lock(state_mutex_);
         return temperature_;
     }
     
     std::vector<double> get_gradients() const {
-        std::shared_lock<std::shared_mutex> lock(state_mutex_);
+        std::shared_lock<ScalableReadWriteLock> lock(state_mutex_);
         return gradients_;
     }
 };
 
 // Upgradeable lock for scientific data processing pipelines
-class UpgradeableLock {
+//
+// Layered over any reader-writer lock with lock_read()/lock_write(). The
+// upgrade mutex admits one upgradeable holder at a time and every writer
+// passes through it too, so nobody can write between an upgrader dropping
+// its read hold and taking the write lock.
+template<typename RWLock = ScalableReadWriteLock>
+class BasicUpgradeableLock {
 private:
-    mutable std::mutex mutex_;
-    std::condition_variable cv_;
-    
-    int readers_ = 0;
-    bool writer_ = false;
-    bool upgrader_ = false;
+    RWLock rw_lock_;
+    std::mutex upgrade_mutex_;
     std::thread::id upgrade_thread_id_;
     
 public:
     void lock_read() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        cv_.wait(lock, [this] { return !writer_ && !upgrader_; });
-        readers_++;
+        rw_lock_.lock_read();
     }
     
     void unlock_read() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        readers_--;
-        if (readers_ == 0) {
-            cv_.notify_all();
-        }
+        rw_lock_.unlock_read();
     }
     
     void lock_upgradeable() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        cv_.wait(lock, [this] { return !writer_ && !upgrader_; });
-        upgrader_ = true;
+        upgrade_mutex_.lock();
         upgrade_thread_id_ = std::this_thread::get_id();
-        readers_++;
+        rw_lock_.lock_read();
     }
     
     void unlock_upgradeable() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        upgrader_ = false;
-        readers_--;
-        if (readers_ == 0) {
-            cv_.notify_all();
-        }
+        rw_lock_.unlock_read();
+        upgrade_thread_id_ = std::thread::id();
+        upgrade_mutex_.unlock();
     }
     
     void upgrade_to_write() {
-        std::unique_lock<std::mutex> lock(mutex_);
         if (std::this_thread::get_id() != upgrade_thread_id_) {
             throw std::runtime_error("Only upgrade lock holder can upgrade");
         }
         
-        readers_--;  // Remove self from readers
-        cv_.wait(lock, [this] { return readers_ == 0; });
-        writer_ = true;
+        rw_lock_.unlock_read();  // Remove self from readers
+        rw_lock_.lock_write();
     }
     
+    // Back to an upgradeable (read) hold; release with unlock_upgradeable()
+    // Still holding upgrade_mutex_, so no writer can slip in between
     void downgrade_to_read() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        writer_ = false;
-        readers_++;
-        cv_.notify_all();
+        rw_lock_.unlock_write();
+        rw_lock_.lock_read();
+    }
+    
+    void lock_write() {
+        upgrade_mutex_.lock();
+        rw_lock_.lock_write();
     }
     
+    // Releases a write hold taken by lock_write() or upgrade_to_write()
     void unlock_write() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        writer_ = false;
-        cv_.notify_all();
+        rw_lock_.unlock_write();
+        upgrade_thread_id_ = std::thread::id();
+        upgrade_mutex_.unlock();
     }
 };
 
+using UpgradeableLock = BasicUpgradeableLock<>;
+
 // Example scenarios for scientific computing
 void scientific_cache_example() {
     std::cout << "=== Scientific Computation Cache Example ===\n";
@@ -456,6 +835,64 @@ void scientific_cache_example() {
     std::cout << "Cache Size: " << eigen_cache.size() << "\n";
 }
 
+// Recency-aware eviction, a byte budget, and coalesced misses
+void cache_eviction_and_coalescing_example() {
+    std::cout << "\n\n=== Sharded Cache: CLOCK Eviction and Miss Coalescing ===\n";
+    
+    // A small working set that is re-read constantly survives a scan of cold
+    // results; dropping the smallest key (the old policy) would evict it
+    ComputationalResultsCache<int, double> integrals(64, SIZE_MAX, 4);
+    for (int k = 0; k < 16; ++k) integrals.put(k, std::sqrt(k));
+    for (int k = 1000; k < 1400; ++k) {
+        double v;
+        for (int hot = 0; hot < 16; ++hot) integrals.get(hot, v);
+        integrals.put(k, std::sqrt(k));
+    }
+    int hot_retained = 0;
+    for (int hot = 0; hot < 16; ++hot) {
+        double v;
+        if (integrals.get(hot, v)) hot_retained++;
+    }
+    std::cout << "Hot results retained after 400-entry cold scan: " << hot_retained << "/16"
+              << " (evictions: " << integrals.evictions() << ")\n";
+    
+    // Byte budget: cached spectra are charged by their payload size
+    ComputationalResultsCache<int, std::vector<double>> spectra(1000, 256 * 1024, 4);
+    for (int k = 0; k < 100; ++k) {
+        spectra.put(k, std::vector<double>(2048, k * 0.5));
+    }
+    std::cout << "Spectra cached under 256 KiB budget: " << spectra.size() << " entries, "
+              << spectra.memory_used() / 1024 << " KiB\n";
+    // The budget is split across the 4 shards, so one entry may use 64 KiB
+    spectra.put(1000, std::vector<double>(12 * 1024, 1.0));
+    std::vector<double> wide;
+    std::cout << "96 KiB spectrum with a " << spectra.max_entry_bytes() / 1024
+              << " KiB per-entry limit: " << (spectra.get(1000, wide) ? "cached" : "not cached")
+              << " (oversized puts: " << spectra.oversized() << ")\n";
+    
+    // Eight analysis threads request the same eight expensive eigen-decompositions
+    ComputationalResultsCache<std::pair<int, int>, double> eigen_cache(128);
+    std::atomic<int> computations{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&eigen_cache, &computations, t]() {
+            for (int j = 0; j < 8; ++j) {
+                std::pair<int, int> key{(j + t) % 8, 64};
+                eigen_cache.get_or_compute(key, [&computations](const std::pair<int, int>& k) {
+                    computations++;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    return std::cos(k.first) * k.second;
+                });
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    std::cout << "64 requests over 8 distinct matrices -> " << computations.load()
+              << " computations, " << eigen_cache.coalesced_waits() << " coalesced waits\n";
+}
+
 void simulation_state_example() {
     std::cout << "\n\n=== Simulation State Example ===\n";
     SimulationState sim_state;
@@ -651,13 +1088,108 @@ void performance_comparison() {
     }
 }
 
+// Read-mostly lock scaling: std::shared_mutex vs ReadWriteLock vs ScalableReadWriteLock
+template<typename Lock, typename ReadLock, typename WriteLock>
+double time_read_mostly(Lock& lock, ReadLock read_lock, WriteLock write_lock,
+                        int num_threads, int ops_per_thread, std::vector<double>& data) {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            double sum = 0.0;
+            for (int j = 0; j < ops_per_thread; ++j) {
+                // One update per 1000 reads
+                if (t == 0 && j % 1000 == 0) {
+                    write_lock(lock, [&] { data[j % data.size()] += 1.0; });
+                } else {
+                    read_lock(lock, [&] { sum += data[(j * 7 + t) % data.size()]; });
+                }
+            }
+            volatile double result = sum;  // Prevent optimization
+            (void)result;
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void scalable_lock_benchmark() {
+    std::cout << "\n\n=== Reader Scaling: shared_mutex vs ReadWriteLock vs ScalableReadWriteLock ===\n";
+    std::cout << "(read-mostly, 1 write per 1000 reads, hardware threads: "
+              << std::thread::hardware_concurrency() << ")\n";
+    
+    const int ops_per_thread = 200000;
+    std::vector<double> data(256, 1.0);
+    
+    auto std_read = [](std::shared_mutex& m, auto body) { std::shared_lock<std::shared_mutex> l(m); body(); };
+    auto std_write = [](std::shared_mutex& m, auto body) { std::unique_lock<std::shared_mutex> l(m); body(); };
+    auto basic_read = [](ReadWriteLock& m, auto body) { ReadWriteLock::ReadGuard g(m); body(); };
+    auto basic_write = [](ReadWriteLock& m, auto body) { ReadWriteLock::WriteGuard g(m); body(); };
+    auto scalable_read = [](ScalableReadWriteLock& m, auto body) { m.lock_read(); body(); m.unlock_read(); };
+    auto scalable_write = [](ScalableReadWriteLock& m, auto body) { m.lock_write(); body(); m.unlock_write(); };
+    
+    std::cout << std::setw(8) << "threads" << std::setw(16) << "shared_mutex"
+              << std::setw(16) << "ReadWriteLock" << std::setw(16) << "Scalable" << "\n";
+    for (int threads : {1, 2, 4, 8}) {
+        std::shared_mutex std_lock;
+        ReadWriteLock basic_lock;
+        ScalableReadWriteLock scalable_lock;
+        double t_std = time_read_mostly(std_lock, std_read, std_write, threads, ops_per_thread, data);
+        double t_basic = time_read_mostly(basic_lock, basic_read, basic_write, threads, ops_per_thread, data);
+        double t_scalable = time_read_mostly(scalable_lock, scalable_read, scalable_write, threads, ops_per_thread, data);
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(1)
+                  << std::setw(14) << t_std << "ms"
+                  << std::setw(14) << t_basic << "ms"
+                  << std::setw(14) << t_scalable << "ms\n";
+    }
+    
+    // Check-then-upgrade: upgraders never lose an increment to each other
+    UpgradeableLock upgradeable;
+    int refinements = 0;
+    std::vector<std::thread> refiners;
+    for (int t = 0; t < 4; ++t) {
+        refiners.emplace_back([&]() {
+            for (int j = 0; j < 1000; ++j) {
+                upgradeable.lock_upgradeable();
+                if (refinements < 1000000) {
+                    upgradeable.upgrade_to_write();
+                    refinements++;
+                    upgradeable.unlock_write();
+                } else {
+                    upgradeable.unlock_upgradeable();
+                }
+            }
+        });
+    }
+    for (int t = 0; t < 2; ++t) {
+        refiners.emplace_back([&]() {
+            for (int j = 0; j < 1000; ++j) {
+                upgradeable.lock_read();
+                volatile int seen = refinements;
+                (void)seen;
+                upgradeable.unlock_read();
+            }
+        });
+    }
+    for (auto& th : refiners) {
+        th.join();
+    }
+    std::cout << "UpgradeableLock over ScalableReadWriteLock: " << refinements
+              << " refinements (expected 4000)\n";
+}
+
 int main() {
     std::cout << "=== Read-Write Lock Pattern - Scientific Computing Demo ===\n\n";
     std::cout << "Efficient concurrent access to scientific data and computational results\n\n";
     
     scientific_cache_example();
+    cache_eviction_and_coalescing_example();
     simulation_state_example();
     performance_comparison();
+    scalable_lock_benchmark();
     
     std::cout << "\n=== Key Benefits for Scientific Computing ===\n";
     std::cout << "• Multiple threads can analyze data simultaneously\n";
@@ -665,6 +1197,8 @@ int main() {
     std::cout << "• Optimal for read-heavy scientific analysis workloads\n";
     std::cout << "• Reduced contention compared to exclusive locking\n";
     std::cout << "• Scales well with number of analysis threads\n";
+    std::cout << "• Sharded cache with CLOCK eviction computes each missing result once\n";
+    std::cout << "• Per-slot reader counters keep read locks off a shared cache line\n";
     
     return 0;
 }
\ No newline at end of file
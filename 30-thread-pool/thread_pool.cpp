@@ -18,17 +18,226 @@
 #include <random>
 #include <iomanip>
 #include <complex>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 // Define M_PI for MSVC
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+// Counts heap allocations so the demo can report allocations per submit.
+// The operators are kept out of line so GCC does not pair an inlined free()
+// with the builtin operator new and warn about a mismatch.
+static std::atomic<size_t> g_heap_allocations{0};
+
+#if defined(__GNUC__)
+#define POOL_NOINLINE __attribute__((noinline))
+#else
+#define POOL_NOINLINE
+#endif
+
+POOL_NOINLINE void* operator new(std::size_t size) {
+    g_heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+POOL_NOINLINE void operator delete(void* p) noexcept { std::free(p); }
+POOL_NOINLINE void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// Trimmed copy of pattern 41's UniqueFunction: a move-only callable that
+// stores captures of up to InlineBytes in place, so submitting a task does
+// not allocate. Larger callables fall back to the heap.
+template<typename Signature, size_t InlineBytes = 48>
+class UniqueFunction;
+
+template<typename R, typename... Args, size_t InlineBytes>
+class UniqueFunction<R(Args...), InlineBytes> {
+private:
+    static_assert(InlineBytes >= sizeof(void*), "Buffer must hold at least a pointer");
+    
+    struct VTable {
+        R (*invoke)(void*, Args&&...);
+        // Move into dst and destroy src; null when copying the buffer bytes is enough
+        void (*relocate)(void* src, void* dst) noexcept;
+        // Null when there is nothing to destroy
+        void (*destroy)(void*) noexcept;
+    };
+    
+    template<typename F>
+    static constexpr bool fitsInline = sizeof(F) <= InlineBytes
+        && alignof(F) <= alignof(std::max_align_t)
+        && std::is_nothrow_move_constructible_v<F>;
+    
+    // Trivially relocatable: moving is a byte copy and destruction a no-op
+    template<typename F>
+    static constexpr bool trivial = std::is_trivially_copyable_v<F>
+        && std::is_trivially_destructible_v<F>;
+    
+    template<typename F>
+    static R call(F& f, Args&&... args) {
+        if constexpr (std::is_void_v<R>) {
+            f(std::forward<Args>(args)...);
+        } else {
+            return f(std::forward<Args>(args)...);
+        }
+    }
+    
+    template<typename F>
+    static F& inlineObject(void* buffer) {
+        return *std::launder(static_cast<F*>(buffer));
+    }
+    
+    template<typename F>
+    static F*& heapObject(void* buffer) {
+        return *std::launder(static_cast<F**>(buffer));
+    }
+    
+    template<typename F>
+    static const VTable* vtableFor() {
+        if constexpr (fitsInline<F>) {
+            static constexpr VTable table{
+                [](void* buffer, Args&&... args) -> R {
+                    return call(inlineObject<F>(buffer), std::forward<Args>(args)...);
+                },
+                trivial<F> ? nullptr : +[](void* src, void* dst) noexcept {
+                    F& from = inlineObject<F>(src);
+                    new(dst) F(std::move(from));
+                    from.~F();
+                },
+                trivial<F> ? nullptr : +[](void* buffer) noexcept {
+                    inlineObject<F>(buffer).~F();
+                }
+            };
+            return &table;
+        } else {
+            // The buffer holds a pointer, which is trivially relocatable
+            static constexpr VTable table{
+                [](void* buffer, Args&&... args) -> R {
+                    return call(*heapObject<F>(buffer), std::forward<Args>(args)...);
+                },
+                nullptr,
+                [](void* buffer) noexcept { delete heapObject<F>(buffer); }
+            };
+            return &table;
+        }
+    }
+    
+    alignas(std::max_align_t) unsigned char buffer_[InlineBytes];
+    const VTable* vtable_ = nullptr;
+    
+    void moveFrom(UniqueFunction& other) noexcept {
+        vtable_ = other.vtable_;
+        if (vtable_) {
+            if (vtable_->relocate) {
+                vtable_->relocate(other.buffer_, buffer_);
+            } else {
+                std::memcpy(buffer_, other.buffer_, InlineBytes);
+            }
+            other.vtable_ = nullptr;
+        }
+    }
+    
+public:
+    UniqueFunction() noexcept = default;
+    UniqueFunction(std::nullptr_t) noexcept {}
+    
+    template<typename F, typename D = std::decay_t<F>,
+             typename = std::enable_if_t<!std::is_same_v<D, UniqueFunction> &&
+                                         std::is_invocable_r_v<R, D&, Args...>>>
+    UniqueFunction(F&& f) {
+        if constexpr (fitsInline<D>) {
+            new(buffer_) D(std::forward<F>(f));
+        } else {
+            new(buffer_) D*(new D(std::forward<F>(f)));
+        }
+        vtable_ = vtableFor<D>();
+    }
+    
+    UniqueFunction(UniqueFunction&& other) noexcept { moveFrom(other); }
+    
+    UniqueFunction& operator=(UniqueFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+    
+    UniqueFunction(const UniqueFunction&) = delete;
+    UniqueFunction& operator=(const UniqueFunction&) = delete;
+    
+    ~UniqueFunction() { reset(); }
+    
+    void reset() noexcept {
+        if (vtable_ && vtable_->destroy) {
+            vtable_->destroy(buffer_);
+        }
+        vtable_ = nullptr;
+    }
+    
+    R operator()(Args... args) {
+        return vtable_->invoke(buffer_, std::forward<Args>(args)...);
+    }
+    
+    explicit operator bool() const noexcept { return vtable_ != nullptr; }
+};
+
+// Task storage for the pools; 64 bytes holds a packaged_task or a lambda
+// capturing up to eight pointers
+using PoolTask = UniqueFunction<void(), 64>;
+
+// FIFO ring buffer that keeps its capacity, unlike std::queue's deque,
+// which frees and reallocates a node every few tasks
+template<typename T>
+class TaskRing {
+private:
+    std::vector<T> slots_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+    
+    void grow() {
+        std::vector<T> bigger(slots_.empty() ? 64 : slots_.size() * 2);
+        for (size_t i = 0; i < size_; ++i) {
+            bigger[i] = std::move(slots_[(head_ + i) & (slots_.size() - 1)]);
+        }
+        slots_.swap(bigger);
+        head_ = 0;
+    }
+    
+public:
+    void push(T value) {
+        if (size_ == slots_.size()) {
+            grow();
+        }
+        slots_[(head_ + size_) & (slots_.size() - 1)] = std::move(value);
+        ++size_;
+    }
+    
+    T pop() {
+        T value = std::move(slots_[head_]);
+        head_ = (head_ + 1) & (slots_.size() - 1);
+        --size_;
+        return value;
+    }
+    
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+};
+
 // Scientific Computation Thread Pool for parallel numerical tasks
 class ScientificThreadPool {
 private:
     std::vector<std::thread> workers_;
-    std::queue<std::function<void()>> tasks_;
+    TaskRing<PoolTask> tasks_;
     
     mutable std::mutex queue_mutex_;
     std::condition_variable condition_;
@@ -39,7 +248,7 @@ private:
         std::cout << "[ComputeWorker-" << worker_id << "] Started on CPU core\n";
         
         while (true) {
-            std::function<void()> computation_task;
+            PoolTask computation_task;
             
             {
                 std::unique_lock<std::mutex> lock(queue_mutex_);
@@ -52,8 +261,7 @@ private:
                     return;
                 }
                 
-                computation_task = std::move(tasks_.front());
-                tasks_.pop();
+                computation_task = tasks_.pop();
             }
             
             busy_threads_++;
@@ -90,11 +298,13 @@ public:
         -> std::future<typename std::invoke_result_t<F, Args...>> {
         using return_type = typename std::invoke_result_t<F, Args...>;
         
-        auto task = std::make_shared<std::packaged_task<return_type()>>(
+        // The packaged_task lives in the queue slot itself; its shared state
+        // is the only allocation left
+        std::packaged_task<return_type()> task(
             std::bind(std::forward<F>(f), std::forward<Args>(args)...)
         );
         
-        std::future<return_type> res = task->get_future();
+        std::future<return_type> res = task.get_future();
         
         {
             std::unique_lock<std::mutex> lock(queue_mutex_);
@@ -103,13 +313,29 @@ public:
                 throw std::runtime_error("enqueue on stopped ThreadPool");
             }
             
-            tasks_.emplace([task]() { (*task)(); });
+            tasks_.push(std::move(task));
         }
         
         condition_.notify_one();
         return res;
     }
     
+    // Fire-and-forget submit without a future; does not allocate once the
+    // ring has grown to the working queue depth
+    void post(PoolTask computation) {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            
+            if (stop_) {
+                throw std::runtime_error("post on stopped ThreadPool");
+            }
+            
+            tasks_.push(std::move(computation));
+        }
+        
+        condition_.notify_one();
+    }
+    
     void shutdown() {
         {
             std::unique_lock<std::mutex> lock(queue_mutex_);
@@ -147,7 +373,7 @@ class HPCPriorityPool {
 private:
     struct ComputationTask {
         int priority;  // 0-10: 10 = critical path, 5 = normal, 1 = background
-        std::function<void()> computation;
+        PoolTask computation;
         std::string task_name;
         std::chrono::steady_clock::time_point submission_time;
         
@@ -157,7 +383,9 @@ private:
     };
     
     std::vector<std::thread> compute_workers_;
-    std::priority_queue<ComputationTask> computation_queue_;
+    // Binary heap kept with push_heap/pop_heap; priority_queue::top() is
+    // const and would force a copy of the move-only task
+    std::vector<ComputationTask> computation_queue_;
     
     std::mutex queue_mutex_;
     std::condition_variable condition_;
@@ -186,8 +414,9 @@ private:
                     break;
                 }
                 
-                task = computation_queue_.top();
-                computation_queue_.pop();
+                std::pop_heap(computation_queue_.begin(), computation_queue_.end());
+                task = std::move(computation_queue_.back());
+                computation_queue_.pop_back();
             }
             
             auto wait_time = std::chrono::steady_clock::now() - task.submission_time;
@@ -220,16 +449,17 @@ public:
         shutdown();
     }
     
-    void submit_computation(std::function<void()> computation, const std::string& name, int priority = 5) {
+    void submit_computation(PoolTask computation, const std::string& name, int priority = 5) {
         {
             std::unique_lock<std::mutex> lock(queue_mutex_);
             if (!stop_) {
-                computation_queue_.push({
+                computation_queue_.push_back({
                     priority, 
                     std::move(computation), 
                     name,
                     std::chrono::steady_clock::now()
                 });
+                std::push_heap(computation_queue_.begin(), computation_queue_.end());
             }
         }
         condition_.notify_one();
@@ -259,83 +489,301 @@ public:
     }
 };
 
+// Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli 2013):
+// the owning worker pushes/takes at the bottom (LIFO, cache-warm), thieves
+// steal from the top (FIFO, oldest and usually largest tasks). Only the
+// owner may call push()/take(); steal() is safe from any thread.
+template<typename T>
+class ChaseLevDeque {
+private:
+    struct RingBuffer {
+        int64_t capacity;
+        int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+        
+        explicit RingBuffer(int64_t cap)
+            : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+        
+        T load(int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+        void store(int64_t i, T value) { slots[i & mask].store(value, std::memory_order_relaxed); }
+        
+        RingBuffer* grow(int64_t bottom, int64_t top) const {
+            auto* bigger = new RingBuffer(capacity * 2);
+            for (int64_t i = top; i < bottom; ++i) {
+                bigger->store(i, load(i));
+            }
+            return bigger;
+        }
+    };
+    
+    alignas(64) std::atomic<int64_t> top_{0};
+    alignas(64) std::atomic<int64_t> bottom_{0};
+    alignas(64) std::atomic<RingBuffer*> buffer_;
+    // Retired buffers stay alive until the deque dies: a thief may still be
+    // reading from an old buffer after the owner has grown it.
+    std::vector<std::unique_ptr<RingBuffer>> retired_;
+    
+public:
+    explicit ChaseLevDeque(int64_t initial_capacity = 256)
+        : buffer_(new RingBuffer(initial_capacity)) {}
+    
+    ~ChaseLevDeque() { delete buffer_.load(std::memory_order_relaxed); }
+    
+    ChaseLevDeque(const ChaseLevDeque&) = delete;
+    ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+    
+    void push(T value) {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_acquire);
+        RingBuffer* buf = buffer_.load(std::memory_order_relaxed);
+        
+        if (b - t > buf->capacity - 1) {
+            retired_.emplace_back(buf);
+            buf = buf->grow(b, t);
+            buffer_.store(buf, std::memory_order_release);
+        }
+        
+        buf->store(b, value);
+        bottom_.store(b + 1, std::memory_order_release);
+    }
+    
+    // Owner side: pop the most recently pushed task
+    bool take(T& out) {
+        int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        RingBuffer* buf = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+        
+        if (t > b) {
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        
+        out = buf->load(b);
+        if (t == b) {
+            // Last element: race against thieves for it
+            bool won = top_.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+    
+    // Thief side: pop the oldest task
+    bool steal(T& out) {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom_.load(std::memory_order_acquire);
+        
+        if (t >= b) {
+            return false;
+        }
+        
+        RingBuffer* buf = buffer_.load(std::memory_order_acquire);
+        out = buf->load(t);
+        return top_.compare_exchange_strong(t, t + 1,
+            std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+    
+    bool empty() const {
+        return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+    }
+};
+
 // Work-stealing pool for dynamic load balancing in scientific simulations
 class SimulationWorkStealingPool {
 private:
-    struct SimulationWorker {
+    using SimulationTask = PoolTask;
+    
+    struct alignas(64) SimulationWorker {
         std::thread compute_thread;
-        std::queue<std::function<void()>> simulation_queue;
-        std::mutex queue_mutex;
-        std::condition_variable cv;
-        std::atomic<bool> has_simulations{false};
+        ChaseLevDeque<SimulationTask*> simulation_deque;
+        uint64_t rng_state{0};
         std::atomic<size_t> simulations_completed{0};
+        std::atomic<size_t> simulations_stolen{0};
         std::atomic<double> total_flops{0.0};  // Floating-point operations
     };
     
+    static constexpr int kSpinRounds = 64;
+    
     std::vector<std::unique_ptr<SimulationWorker>> simulation_workers_;
-    std::atomic<size_t> next_worker_{0};
     std::atomic<bool> stop_{false};
     std::string pool_name_;
     
+    // External submissions: non-worker threads cannot push into a Chase-Lev
+    // deque, so they go through a shared injection queue instead
+    std::mutex injection_mutex_;
+    std::queue<SimulationTask*> injection_queue_;
+    std::atomic<size_t> injected_{0};
+    
+    // Parking: idle workers spin first, then sleep until the epoch changes
+    std::mutex park_mutex_;
+    std::condition_variable park_cv_;
+    std::atomic<uint64_t> work_epoch_{0};
+    std::atomic<int> parked_workers_{0};
+    
+    std::atomic<size_t> pending_tasks_{0};
+    
+    // Identifies the worker running on the calling thread (if any)
+    static thread_local SimulationWorkStealingPool* current_pool_;
+    static thread_local size_t current_worker_;
+    
+    // The deques hold task pointers, so each submit needs a node. Nodes of
+    // finished tasks are cached on the thread that ran them and reused by
+    // that thread's next submit; fork-join workloads, where workers both
+    // submit and run, stop allocating once warm.
+    struct NodeCache {
+        static constexpr size_t kLimit = 256;
+        std::vector<SimulationTask*> nodes;
+        
+        NodeCache() { nodes.reserve(kLimit); }
+        ~NodeCache() {
+            for (SimulationTask* node : nodes) delete node;
+        }
+    };
+    static thread_local NodeCache node_cache_;
+    
+    static SimulationTask* acquire_node() {
+        auto& nodes = node_cache_.nodes;
+        if (nodes.empty()) {
+            return new SimulationTask;
+        }
+        SimulationTask* node = nodes.back();
+        nodes.pop_back();
+        return node;
+    }
+    
+    static void release_node(SimulationTask* node) {
+        node->reset();
+        auto& nodes = node_cache_.nodes;
+        if (nodes.size() < NodeCache::kLimit) {
+            nodes.push_back(node);
+        } else {
+            delete node;
+        }
+    }
+    
+    static uint64_t next_random(uint64_t& state) {
+        // xorshift64*: cheap per-worker victim selection
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 2685821657736338717ULL;
+    }
+    
+    bool pop_injected(SimulationTask*& task) {
+        if (injected_.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(injection_mutex_);
+        if (injection_queue_.empty()) {
+            return false;
+        }
+        task = injection_queue_.front();
+        injection_queue_.pop();
+        injected_.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+    
+    bool try_steal(SimulationWorker* worker, size_t worker_id, SimulationTask*& task) {
+        size_t n = simulation_workers_.size();
+        if (n < 2) {
+            return false;
+        }
+        // Random start, then sweep so every victim is probed once per round
+        size_t start = next_random(worker->rng_state) % n;
+        for (size_t k = 0; k < n; ++k) {
+            size_t victim = (start + k) % n;
+            if (victim == worker_id) continue;
+            if (simulation_workers_[victim]->simulation_deque.steal(task)) {
+                worker->simulations_stolen++;
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    bool find_task(SimulationWorker* worker, size_t worker_id, SimulationTask*& task) {
+        return worker->simulation_deque.take(task)
+            || pop_injected(task)
+            || try_steal(worker, worker_id, task);
+    }
+    
+    bool work_visible() const {
+        if (injected_.load(std::memory_order_acquire) > 0) {
+            return true;
+        }
+        for (const auto& w : simulation_workers_) {
+            if (!w->simulation_deque.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void signal_work() {
+        work_epoch_.fetch_add(1, std::memory_order_seq_cst);
+        if (parked_workers_.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(park_mutex_);
+            park_cv_.notify_one();
+        }
+    }
+    
+    void park() {
+        parked_workers_.fetch_add(1, std::memory_order_seq_cst);
+        uint64_t epoch = work_epoch_.load(std::memory_order_seq_cst);
+        if (!work_visible() && !stop_) {
+            std::unique_lock<std::mutex> lock(park_mutex_);
+            park_cv_.wait(lock, [&] {
+                return stop_ || work_epoch_.load(std::memory_order_seq_cst) != epoch;
+            });
+        }
+        parked_workers_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+    
+    void run_task(SimulationWorker* worker, SimulationTask* task) {
+        auto start = std::chrono::high_resolution_clock::now();
+        (*task)();
+        auto end = std::chrono::high_resolution_clock::now();
+        release_node(task);
+        
+        worker->simulations_completed++;
+        // Estimate FLOPS (simplified)
+        auto duration_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        worker->total_flops.store(worker->total_flops.load() + duration_us * 1000.0);  // Rough estimate
+        pending_tasks_.fetch_sub(1, std::memory_order_release);
+    }
+    
     void simulation_worker_thread(SimulationWorker* worker, size_t worker_id) {
+        current_pool_ = this;
+        current_worker_ = worker_id;
         std::cout << "[SimWorker-" << worker_id << "] Started for " << pool_name_ << "\n";
         
-        while (!stop_) {
-            std::function<void()> simulation_task;
+        while (true) {
+            SimulationTask* task = nullptr;
             
-            // Try to get simulation from local queue
-            {
-                std::unique_lock<std::mutex> lock(worker->queue_mutex);
-                
-                if (!worker->simulation_queue.empty()) {
-                    simulation_task = std::move(worker->simulation_queue.front());
-                    worker->simulation_queue.pop();
-                    
-                    if (worker->simulation_queue.empty()) {
-                        worker->has_simulations = false;
-                    }
-                } else {
-                    // Try to steal simulation work from other workers
-                    for (size_t i = 0; i < simulation_workers_.size(); ++i) {
-                        if (i == worker_id) continue;
-                        
-                        std::unique_lock<std::mutex> other_lock(
-                            simulation_workers_[i]->queue_mutex, std::try_to_lock);
-                        
-                        if (other_lock.owns_lock() && !simulation_workers_[i]->simulation_queue.empty()) {
-                            simulation_task = std::move(simulation_workers_[i]->simulation_queue.front());
-                            simulation_workers_[i]->simulation_queue.pop();
-                            
-                            if (simulation_workers_[i]->simulation_queue.empty()) {
-                                simulation_workers_[i]->has_simulations = false;
-                            }
-                            
-                            std::cout << "[SimWorker-" << worker_id 
-                                      << "] Stole simulation task from worker " << i 
-                                      << " (load balancing)\n";
-                            break;
-                        }
-                    }
-                    
-                    if (!simulation_task) {
-                        worker->cv.wait_for(lock, std::chrono::milliseconds(10));
-                        continue;
-                    }
-                }
+            // Spin briefly before parking: fine-grained timesteps usually
+            // produce new work within a few microseconds
+            bool found = false;
+            for (int spin = 0; spin < kSpinRounds && !found; ++spin) {
+                found = find_task(worker, worker_id, task);
+                if (!found) std::this_thread::yield();
             }
             
-            if (simulation_task) {
-                auto start = std::chrono::high_resolution_clock::now();
-                simulation_task();
-                auto end = std::chrono::high_resolution_clock::now();
-                
-                worker->simulations_completed++;
-                // Estimate FLOPS (simplified)
-                auto duration_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
-                worker->total_flops.store(worker->total_flops.load() + duration_us * 1000.0);  // Rough estimate
+            if (found) {
+                run_task(worker, task);
+                continue;
             }
+            
+            if (stop_ && pending_tasks_.load(std::memory_order_acquire) == 0) {
+                break;
+            }
+            park();
         }
         
+        current_pool_ = nullptr;
         std::cout << "[SimWorker-" << worker_id << "] Completed " 
                   << worker->simulations_completed << " simulations\n";
     }
@@ -343,11 +791,16 @@ private:
 public:
     explicit SimulationWorkStealingPool(size_t num_threads, const std::string& name = "Simulation")
         : pool_name_(name) {
+        std::random_device rd;
         for (size_t i = 0; i < num_threads; ++i) {
             simulation_workers_.push_back(std::make_unique<SimulationWorker>());
-            simulation_workers_.back()->compute_thread = std::thread(
+            simulation_workers_.back()->rng_state = (static_cast<uint64_t>(rd()) << 32) | (i + 1);
+        }
+        // Start threads only after every deque exists, since thieves scan all of them
+        for (size_t i = 0; i < num_threads; ++i) {
+            simulation_workers_[i]->compute_thread = std::thread(
                 &SimulationWorkStealingPool::simulation_worker_thread, 
-                this, simulation_workers_.back().get(), i
+                this, simulation_workers_[i].get(), i
             );
         }
         std::cout << "Work-stealing pool '" << name << "' initialized with " 
@@ -355,10 +808,14 @@ public:
     }
     
     ~SimulationWorkStealingPool() {
+        wait_idle();
         stop_ = true;
+        {
+            std::lock_guard<std::mutex> lock(park_mutex_);
+            park_cv_.notify_all();
+        }
         
         for (auto& worker : simulation_workers_) {
-            worker->cv.notify_all();
             if (worker->compute_thread.joinable()) {
                 worker->compute_thread.join();
             }
@@ -367,38 +824,61 @@ public:
         // Print statistics
         std::cout << "\nWork-Stealing Pool '" << pool_name_ << "' Statistics:\n";
         size_t total_simulations = 0;
+        size_t total_steals = 0;
         double total_gflops = 0.0;
         for (size_t i = 0; i < simulation_workers_.size(); ++i) {
             auto sims = simulation_workers_[i]->simulations_completed.load();
+            auto steals = simulation_workers_[i]->simulations_stolen.load();
             auto flops = simulation_workers_[i]->total_flops.load();
             total_simulations += sims;
+            total_steals += steals;
             total_gflops += flops / 1e9;
-            std::cout << "  Worker " << i << ": " << sims << " simulations, "
+            std::cout << "  Worker " << i << ": " << sims << " simulations (" << steals << " stolen), "
                       << std::fixed << std::setprecision(2) << (flops / 1e9) << " GFLOPS\n";
         }
         std::cout << "  Total: " << total_simulations << " simulations, " 
+                  << total_steals << " steals, "
                   << total_gflops << " GFLOPS\n";
     }
     
-    void submit_simulation(std::function<void()> simulation) {
-        size_t worker_id = next_worker_++ % simulation_workers_.size();
+    // Called from a worker of this pool, the task goes straight onto that
+    // worker's own deque (fork-join); otherwise through the injection queue.
+    void submit_simulation(SimulationTask simulation) {
+        SimulationTask* task = acquire_node();
+        *task = std::move(simulation);
+        pending_tasks_.fetch_add(1, std::memory_order_relaxed);
         
-        {
-            std::lock_guard<std::mutex> lock(simulation_workers_[worker_id]->queue_mutex);
-            simulation_workers_[worker_id]->simulation_queue.push(std::move(simulation));
-            simulation_workers_[worker_id]->has_simulations = true;
+        if (current_pool_ == this) {
+            simulation_workers_[current_worker_]->simulation_deque.push(task);
+        } else {
+            std::lock_guard<std::mutex> lock(injection_mutex_);
+            injection_queue_.push(task);
+            injected_.fetch_add(1, std::memory_order_release);
         }
         
-        simulation_workers_[worker_id]->cv.notify_one();
+        signal_work();
+    }
+    
+    // Blocks until every submitted task (including ones spawned by tasks) has run
+    void wait_idle() const {
+        while (pending_tasks_.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
     }
+    
+    size_t size() const { return simulation_workers_.size(); }
 };
 
+thread_local SimulationWorkStealingPool* SimulationWorkStealingPool::current_pool_ = nullptr;
+thread_local size_t SimulationWorkStealingPool::current_worker_ = 0;
+thread_local SimulationWorkStealingPool::NodeCache SimulationWorkStealingPool::node_cache_;
+
 // Scheduled computation pool for time-dependent scientific simulations
 class TimeSteppingComputationPool {
 private:
     struct TimestepComputation {
         std::chrono::steady_clock::time_point execution_time;
-        std::function<void()> computation;
+        PoolTask computation;
         double simulation_time;  // Simulation time (not wall time)
         std::string computation_type;
         
@@ -407,8 +887,9 @@ private:
         }
     };
     
-    std::priority_queue<TimestepComputation, std::vector<TimestepComputation>, 
-                       std::greater<TimestepComputation>> timestep_queue_;
+    // Min-heap on execution time, kept with push_heap/pop_heap so the
+    // move-only computation can be moved out
+    std::vector<TimestepComputation> timestep_queue_;
     std::mutex mutex_;
     std::condition_variable cv_;
     std::thread scheduler_thread_;
@@ -428,10 +909,13 @@ private:
             }
             
             auto now = std::chrono::steady_clock::now();
-            auto next_computation = timestep_queue_.top();
+            auto next_time = timestep_queue_.front().execution_time;
             
-            if (next_computation.execution_time <= now) {
-                timestep_queue_.pop();
+            if (next_time <= now) {
+                std::pop_heap(timestep_queue_.begin(), timestep_queue_.end(),
+                              std::greater<TimestepComputation>());
+                TimestepComputation next_computation = std::move(timestep_queue_.back());
+                timestep_queue_.pop_back();
                 current_simulation_time_ = next_computation.simulation_time;
                 
                 std::cout << "[TimeStepScheduler] Executing " << next_computation.computation_type
@@ -440,9 +924,9 @@ private:
                 
                 lock.unlock();
                 
-                computation_executor_.enqueue(next_computation.computation);
+                computation_executor_.post(std::move(next_computation.computation));
             } else {
-                cv_.wait_until(lock, next_computation.execution_time);
+                cv_.wait_until(lock, next_time);
             }
         }
     }
@@ -467,7 +951,7 @@ public:
                   << current_simulation_time_ << "s\n";
     }
     
-    void schedule_timestep(std::function<void()> computation, 
+    void schedule_timestep(PoolTask computation, 
                           double simulation_time,
                           std::chrono::milliseconds real_time_delay,
                           const std::string& type = "Timestep") {
@@ -475,12 +959,14 @@ public:
         
         {
             std::lock_guard<std::mutex> lock(mutex_);
-            timestep_queue_.push({
+            timestep_queue_.push_back({
                 execution_time, 
                 std::move(computation), 
                 simulation_time,
                 type
             });
+            std::push_heap(timestep_queue_.begin(), timestep_queue_.end(),
+                           std::greater<TimestepComputation>());
         }
         
         cv_.notify_one();
@@ -661,6 +1147,59 @@ void simulation_work_stealing_example() {
     std::this_thread::sleep_for(std::chrono::milliseconds(1500));
 }
 
+// Recursive force reduction: each task splits its particle range and
+// submits the halves from inside the worker, landing on the local deque
+void fork_join_force_reduction(SimulationWorkStealingPool& pool,
+                               const std::vector<double>& forces,
+                               size_t begin, size_t end,
+                               std::atomic<long long>& total_millinewtons) {
+    constexpr size_t kGrain = 4096;
+    if (end - begin <= kGrain) {
+        double partial = 0.0;
+        for (size_t i = begin; i < end; ++i) {
+            partial += forces[i];
+        }
+        total_millinewtons += static_cast<long long>(std::llround(partial * 1000.0));
+        return;
+    }
+    size_t mid = begin + (end - begin) / 2;
+    pool.submit_simulation([&pool, &forces, mid, end, &total_millinewtons]() {
+        fork_join_force_reduction(pool, forces, mid, end, total_millinewtons);
+    });
+    fork_join_force_reduction(pool, forces, begin, mid, total_millinewtons);
+}
+
+void fork_join_simulation_example() {
+    std::cout << "\n\n=== Fork-Join Force Reduction (Chase-Lev Deques) ===\n";
+    
+    const size_t num_particles = 1 << 20;
+    std::vector<double> forces(num_particles);
+    for (size_t i = 0; i < num_particles; ++i) {
+        forces[i] = 0.001 * static_cast<double>(i % 1000);
+    }
+    
+    std::atomic<long long> total_millinewtons{0};
+    {
+        SimulationWorkStealingPool fj_pool(4, "Fork-Join Forces");
+        auto start = std::chrono::high_resolution_clock::now();
+        
+        fj_pool.submit_simulation([&fj_pool, &forces, &total_millinewtons]() {
+            fork_join_force_reduction(fj_pool, forces, 0, forces.size(), total_millinewtons);
+        });
+        fj_pool.wait_idle();
+        
+        auto end = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+        
+        double expected = std::accumulate(forces.begin(), forces.end(), 0.0);
+        std::cout << "  Reduced " << num_particles << " particle forces in " 
+                  << duration.count() << " μs\n";
+        std::cout << "  Total force: " << std::fixed << std::setprecision(3) 
+                  << (total_millinewtons.load() / 1000.0) << " N (serial: " 
+                  << expected << " N)\n";
+    }
+}
+
 void time_stepping_simulation_example() {
     std::cout << "\n\n=== Time-Stepping Scientific Simulation ===\n";
     TimeSteppingComputationPool timestep_pool(2);
@@ -721,6 +1260,98 @@ void time_stepping_simulation_example() {
     std::this_thread::sleep_for(std::chrono::milliseconds(800));
 }
 
+void task_allocation_example() {
+    std::cout << "\n\n=== Task Submission Allocations ===\n";
+    const size_t num_tasks = 100000;
+    std::atomic<size_t> completed{0};
+    std::vector<double> field(4096, 1.0);
+    
+    auto wait_for = [&completed](size_t target) {
+        while (completed.load(std::memory_order_acquire) < target) {
+            std::this_thread::yield();
+        }
+    };
+    
+    // std::function reference: its small buffer holds two pointers, so a
+    // four-pointer stencil capture goes to the heap
+    size_t before = g_heap_allocations.load();
+    {
+        double* data = field.data();
+        double* out = data + 1;
+        size_t stride = 64, offset = 0;
+        for (size_t i = 0; i < num_tasks; ++i) {
+            std::function<void()> task = [data, out, stride, offset]() {
+                out[offset] += 1e-9 * data[stride];
+            };
+            task();
+        }
+    }
+    double function_allocs = double(g_heap_allocations.load() - before) / num_tasks;
+    
+    double post_allocs = 0.0, enqueue_allocs = 0.0;
+    {
+        ScientificThreadPool pool(2);
+        // Warm the ring to the working queue depth
+        for (size_t i = 0; i < 1024; ++i) {
+            pool.post([&completed]() { completed.fetch_add(1, std::memory_order_release); });
+        }
+        wait_for(1024);
+        
+        before = g_heap_allocations.load();
+        double* data = field.data();
+        for (size_t i = 0; i < num_tasks; ++i) {
+            size_t offset = i % 64;
+            pool.post([data, offset, &completed]() {
+                data[offset + 64] += 1e-9 * data[offset];
+                completed.fetch_add(1, std::memory_order_release);
+            });
+            if (pool.queued() > 512) {
+                wait_for(1024 + i - 256);
+            }
+        }
+        wait_for(1024 + num_tasks);
+        post_allocs = double(g_heap_allocations.load() - before) / num_tasks;
+        
+        before = g_heap_allocations.load();
+        const size_t num_futures = 10000;
+        for (size_t i = 0; i < num_futures; ++i) {
+            pool.enqueue([i]() { return static_cast<double>(i) * 0.5; }).get();
+        }
+        enqueue_allocs = double(g_heap_allocations.load() - before) / num_futures;
+    }
+    
+    double fork_join_allocs = 0.0;
+    size_t fork_join_tasks = 0;
+    {
+        SimulationWorkStealingPool fj_pool(2, "Allocation Probe");
+        std::vector<double> forces(1 << 20, 0.25);
+        std::atomic<long long> total_millinewtons{0};
+        auto reduce = [&]() {
+            fj_pool.submit_simulation([&fj_pool, &forces, &total_millinewtons]() {
+                fork_join_force_reduction(fj_pool, forces, 0, forces.size(), total_millinewtons);
+            });
+            fj_pool.wait_idle();
+        };
+        // The first pass fills the node caches and grows the deques
+        reduce();
+        before = g_heap_allocations.load();
+        const int passes = 10;
+        for (int pass = 0; pass < passes; ++pass) {
+            reduce();
+        }
+        fork_join_tasks = passes * (forces.size() / 4096);
+        fork_join_allocs = double(g_heap_allocations.load() - before) / fork_join_tasks;
+    }
+    
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  std::function, 4-pointer capture:       " << function_allocs << " allocs/task\n";
+    std::cout << "  ScientificThreadPool::post:             " << post_allocs << " allocs/task\n";
+    std::cout << "  ScientificThreadPool::enqueue (future): " << enqueue_allocs 
+              << " allocs/task (future state + result)\n";
+    std::cout << "  Work-stealing fork-join, " << fork_join_tasks << " tasks: " 
+              << fork_join_allocs << " allocs/task\n";
+}
+
 int main() {
     std::cout << "=== Thread Pool Pattern - Scientific Computing Demo ===\n";
     std::cout << "Parallel execution of numerical simulations and HPC workloads\n\n";
@@ -730,13 +1361,17 @@ int main() {
     parallel_eigenvalue_example();
     hpc_priority_computation_example();
     simulation_work_stealing_example();
+    fork_join_simulation_example();
     time_stepping_simulation_example();
+    task_allocation_example();
     
     std::cout << "\n=== Key Benefits for Scientific Computing ===\n";
     std::cout << "• Parallel execution of independent computations\n";
     std::cout << "• Priority scheduling for critical path calculations\n";
     std::cout << "• Work stealing for dynamic load balancing\n";
+    std::cout << "• Lock-free fork-join via per-worker Chase-Lev deques\n";
     std::cout << "• Time-stepping for numerical simulations\n";
+    std::cout << "• Allocation-free task submission with move-only inline callables\n";
     std::cout << "• Efficient utilization of multi-core processors\n";
     
     return 0;
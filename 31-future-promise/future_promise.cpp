@@ -16,6 +16,13 @@
 #include <algorithm>
 #include <iomanip>
 #include <array>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <cstdint>
 
 // Define M_PI for MSVC
 #ifndef M_PI
@@ -273,9 +280,168 @@ void shared_simulation_parameters_example() {
     }
 }
 
-// Scientific computation future with progress tracking
+// Executor interface for continuations: anything that can run a task later
+class ComputeExecutor {
+public:
+    virtual ~ComputeExecutor() = default;
+    virtual void post(std::function<void()> task) = 0;
+};
+
+// Runs tasks on the posting thread (for cheap continuations)
+class InlineExecutor : public ComputeExecutor {
+public:
+    void post(std::function<void()> task) override { task(); }
+};
+
+// Trimmed copy of pattern 30's ScientificThreadPool: the same FIFO worker
+// loop without the logging, exposed as a ComputeExecutor
+class ScientificThreadPool : public ComputeExecutor {
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex queue_mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+    std::atomic<size_t> tasks_completed_{0};
+
+    void worker_thread() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                if (stop_ && tasks_.empty()) return;
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+            task();
+            tasks_completed_++;
+        }
+    }
+
+public:
+    explicit ScientificThreadPool(size_t num_threads = std::max(2u, std::thread::hardware_concurrency())) {
+        for (size_t i = 0; i < num_threads; ++i) {
+            workers_.emplace_back(&ScientificThreadPool::worker_thread, this);
+        }
+    }
+
+    ~ScientificThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            stop_ = true;
+        }
+        condition_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    void post(std::function<void()> task) override {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            if (stop_) throw std::runtime_error("post on stopped ThreadPool");
+            tasks_.push(std::move(task));
+        }
+        condition_.notify_one();
+    }
+
+    size_t size() const { return workers_.size(); }
+    size_t tasks_completed() const { return tasks_completed_.load(); }
+};
+
+// Size-class free lists for future shared states. States are created on the
+// thread that chains a continuation and usually released on the pool thread
+// that ran it, so the lists are shared rather than thread-local; the lock is
+// held only for a push or pop.
+class SharedStatePool {
+private:
+    static constexpr size_t kClassBytes[] = {64, 128, 256, 512};
+    static constexpr size_t kClasses = 4;
+
+    struct Lists {
+        std::mutex mutex;
+        std::vector<void*> free[kClasses];
+        ~Lists() {
+            for (auto& list : free) {
+                for (void* block : list) ::operator delete(block);
+            }
+        }
+    };
+
+    static Lists& lists() {
+        static Lists instance;
+        return instance;
+    }
+
+    static int classOf(size_t bytes) {
+        for (size_t c = 0; c < kClasses; ++c) {
+            if (bytes <= kClassBytes[c]) return int(c);
+        }
+        return -1;
+    }
+
+public:
+    static std::atomic<size_t>& reused() {
+        static std::atomic<size_t> count{0};
+        return count;
+    }
+
+    static std::atomic<size_t>& allocated() {
+        static std::atomic<size_t> count{0};
+        return count;
+    }
+
+    static void* allocate(size_t bytes) {
+        int c = classOf(bytes);
+        if (c >= 0) {
+            std::lock_guard<std::mutex> lock(lists().mutex);
+            auto& list = lists().free[c];
+            if (!list.empty()) {
+                void* block = list.back();
+                list.pop_back();
+                reused().fetch_add(1, std::memory_order_relaxed);
+                return block;
+            }
+        }
+        allocated().fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(c >= 0 ? kClassBytes[c] : bytes);
+    }
+
+    static void deallocate(void* block, size_t bytes) {
+        int c = classOf(bytes);
+        if (c < 0) {
+            ::operator delete(block);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(lists().mutex);
+        lists().free[c].push_back(block);
+    }
+};
+
+constexpr size_t SharedStatePool::kClassBytes[];
+
+// Allocator handed to std::allocate_shared for future shared states
 template<typename T>
-class ScientificFuture {
+struct PooledAllocator {
+    using value_type = T;
+
+    PooledAllocator() = default;
+    template<typename U>
+    PooledAllocator(const PooledAllocator<U>&) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(SharedStatePool::allocate(n * sizeof(T))); }
+    void deallocate(T* p, size_t n) { SharedStatePool::deallocate(p, n * sizeof(T)); }
+
+    template<typename U>
+    bool operator==(const PooledAllocator<U>&) const { return true; }
+    template<typename U>
+    bool operator!=(const PooledAllocator<U>&) const { return false; }
+};
+
+template<typename T> class ScientificPromise;
+
+// State shared by a ScientificPromise and its ScientificFutures
+template<typename T>
+class FutureState {
 private:
     mutable std::mutex mutex_;
     mutable std::condition_variable cv_;
@@ -284,107 +450,313 @@ private:
     bool ready_ = false;
     double progress_ = 0.0;  // Progress percentage
     std::string status_message_;
-    
+    std::vector<std::function<void()>> callbacks_;
+
+    template<typename Store>
+    void complete(Store store) {
+        std::vector<std::function<void()>> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (ready_) {
+                throw std::runtime_error("Result already set");
+            }
+            store();
+            ready_ = true;
+            callbacks.swap(callbacks_);
+        }
+        cv_.notify_all();
+        // Run outside the lock; callbacks read the state through the public getters
+        for (auto& callback : callbacks) callback();
+    }
+
 public:
-    T get() const {
+    const T& value() const {
         std::unique_lock<std::mutex> lock(mutex_);
         cv_.wait(lock, [this] { return ready_; });
-        
         if (exception_) {
             std::rethrow_exception(exception_);
         }
-        
         return *result_;
     }
-    
+
+    std::exception_ptr exception() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return exception_;
+    }
+
     bool is_ready() const {
         std::lock_guard<std::mutex> lock(mutex_);
         return ready_;
     }
-    
+
     void wait() const {
         std::unique_lock<std::mutex> lock(mutex_);
         cv_.wait(lock, [this] { return ready_; });
     }
-    
+
     template<typename Rep, typename Period>
     bool wait_for(const std::chrono::duration<Rep, Period>& timeout) const {
         std::unique_lock<std::mutex> lock(mutex_);
         return cv_.wait_for(lock, timeout, [this] { return ready_; });
     }
-    
-    // Progress tracking for long computations
+
     double get_progress() const {
         std::lock_guard<std::mutex> lock(mutex_);
         return progress_;
     }
-    
+
     std::string get_status() const {
         std::lock_guard<std::mutex> lock(mutex_);
         return status_message_;
     }
-    
-    // Used by ScientificPromise
-    void set_value(const T& value) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (ready_) {
-            throw std::runtime_error("Result already set");
-        }
-        result_ = std::make_shared<T>(value);
-        progress_ = 100.0;
-        ready_ = true;
-        cv_.notify_all();
+
+    void set_value(T value) {
+        complete([&] {
+            result_ = std::make_shared<T>(std::move(value));
+            progress_ = 100.0;
+        });
     }
-    
+
     void set_exception(std::exception_ptr e) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (ready_) {
-            throw std::runtime_error("Result already set");
-        }
-        exception_ = e;
-        ready_ = true;
-        cv_.notify_all();
+        complete([&] { exception_ = e; });
     }
-    
-    void update_progress(double progress, const std::string& status = "") {
+
+    void update_progress(double progress, const std::string& status) {
         std::lock_guard<std::mutex> lock(mutex_);
         progress_ = progress;
         if (!status.empty()) {
             status_message_ = status;
         }
     }
+
+    // Runs callback once the state is ready: immediately on this thread if
+    // it already is, otherwise on the thread that completes it
+    void on_ready(std::function<void()> callback) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!ready_) {
+                callbacks_.push_back(std::move(callback));
+                return;
+            }
+        }
+        callback();
+    }
+};
+
+template<typename T>
+std::shared_ptr<FutureState<T>> make_future_state() {
+    return std::allocate_shared<FutureState<T>>(PooledAllocator<FutureState<T>>());
+}
+
+// Scientific computation future with progress tracking and continuations
+template<typename T>
+class ScientificFuture {
+private:
+    std::shared_ptr<FutureState<T>> state_;
+
+    template<typename U> friend class ScientificFuture;
+    friend class ScientificPromise<T>;
+
+    explicit ScientificFuture(std::shared_ptr<FutureState<T>> state) : state_(std::move(state)) {}
+
+    // Runs f(value) into promise, or forwards the antecedent's exception
+    template<typename F, typename U>
+    static void run_continuation(const FutureState<T>& antecedent, F& f, FutureState<U>& result) {
+        if (auto error = antecedent.exception()) {
+            result.set_exception(error);
+            return;
+        }
+        try {
+            result.set_value(f(antecedent.value()));
+        } catch (...) {
+            result.set_exception(std::current_exception());
+        }
+    }
+
+public:
+    ScientificFuture() = default;
+
+    bool valid() const { return state_ != nullptr; }
+
+    T get() const { return state_->value(); }
+    bool is_ready() const { return state_->is_ready(); }
+    void wait() const { state_->wait(); }
+
+    template<typename Rep, typename Period>
+    bool wait_for(const std::chrono::duration<Rep, Period>& timeout) const {
+        return state_->wait_for(timeout);
+    }
+
+    // Progress tracking for long computations
+    double get_progress() const { return state_->get_progress(); }
+    std::string get_status() const { return state_->get_status(); }
+
+    // Schedules f(value) on executor once this future is ready and returns a
+    // future for its result. An exception skips f and propagates. If this
+    // future is already ready, f runs inline and no task is posted.
+    template<typename F>
+    auto then(ComputeExecutor& executor, F f) const
+        -> ScientificFuture<std::decay_t<decltype(f(std::declval<const T&>()))>> {
+        using U = std::decay_t<decltype(f(std::declval<const T&>()))>;
+        auto result = make_future_state<U>();
+        auto antecedent = state_;
+
+        if (antecedent->is_ready()) {
+            run_continuation(*antecedent, f, *result);
+            return ScientificFuture<U>(result);
+        }
+        antecedent->on_ready([antecedent, result, &executor, f]() mutable {
+            executor.post([antecedent, result, f]() mutable {
+                run_continuation(*antecedent, f, *result);
+            });
+        });
+        return ScientificFuture<U>(result);
+    }
+
+    template<typename U>
+    friend ScientificFuture<std::vector<U>> when_all(const std::vector<ScientificFuture<U>>& futures);
+    template<typename U>
+    friend ScientificFuture<std::pair<size_t, U>> when_any(const std::vector<ScientificFuture<U>>& futures);
+};
+
+template<typename T>
+class ScientificPromise {
+private:
+    std::shared_ptr<FutureState<T>> state_ = make_future_state<T>();
+
+public:
+    ScientificFuture<T> get_future() const { return ScientificFuture<T>(state_); }
+
+    void set_value(T value) { state_->set_value(std::move(value)); }
+    void set_exception(std::exception_ptr e) { state_->set_exception(e); }
+
+    void update_progress(double progress, const std::string& status = "") {
+        state_->update_progress(progress, status);
+    }
 };
 
+template<typename T>
+ScientificFuture<T> make_ready_future(T value) {
+    ScientificPromise<T> promise;
+    promise.set_value(std::move(value));
+    return promise.get_future();
+}
+
+// Completes with every value in input order once all futures are ready, or
+// with the first exception. Runs on the completing thread; no task is posted.
+template<typename T>
+ScientificFuture<std::vector<T>> when_all(const std::vector<ScientificFuture<T>>& futures) {
+    struct Gather {
+        std::vector<T> values;
+        std::atomic<size_t> remaining;
+        std::atomic<bool> failed{false};
+        ScientificPromise<std::vector<T>> promise;
+        explicit Gather(size_t n) : values(n), remaining(n) {}
+    };
+    auto gather = std::make_shared<Gather>(futures.size());
+    auto result = gather->promise.get_future();
+    if (futures.empty()) {
+        gather->promise.set_value({});
+        return result;
+    }
+    for (size_t i = 0; i < futures.size(); ++i) {
+        auto state = futures[i].state_;
+        state->on_ready([gather, state, i]() {
+            if (auto error = state->exception()) {
+                if (!gather->failed.exchange(true)) gather->promise.set_exception(error);
+            } else {
+                gather->values[i] = state->value();
+            }
+            if (gather->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1 && !gather->failed.load()) {
+                gather->promise.set_value(std::move(gather->values));
+            }
+        });
+    }
+    return result;
+}
+
+// Completes with (index, value) of the first future to produce a value; if
+// every future fails, with the last exception
+template<typename T>
+ScientificFuture<std::pair<size_t, T>> when_any(const std::vector<ScientificFuture<T>>& futures) {
+    struct Race {
+        std::atomic<bool> won{false};
+        std::atomic<size_t> remaining;
+        ScientificPromise<std::pair<size_t, T>> promise;
+        explicit Race(size_t n) : remaining(n) {}
+    };
+    if (futures.empty()) {
+        throw std::invalid_argument("when_any needs at least one future");
+    }
+    auto race = std::make_shared<Race>(futures.size());
+    auto result = race->promise.get_future();
+    for (size_t i = 0; i < futures.size(); ++i) {
+        auto state = futures[i].state_;
+        state->on_ready([race, state, i]() {
+            auto error = state->exception();
+            if (!error && !race->won.exchange(true)) {
+                race->promise.set_value({i, state->value()});
+            }
+            if (race->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1 && !race->won.load()) {
+                race->promise.set_exception(error);
+            }
+        });
+    }
+    return result;
+}
+
+// Runs f on executor and returns its future
+template<typename F>
+auto async_on(ComputeExecutor& executor, F f) -> ScientificFuture<std::decay_t<decltype(f())>> {
+    using U = std::decay_t<decltype(f())>;
+    auto promise = std::make_shared<ScientificPromise<U>>();
+    auto future = promise->get_future();
+    executor.post([promise, f]() mutable {
+        try {
+            promise->set_value(f());
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+    return future;
+}
+
 // Scientific computation pipeline with chaining
 class ComputationPipeline {
 private:
     using TransformFunc = std::function<std::vector<double>(const std::vector<double>&)>;
     std::vector<std::pair<std::string, TransformFunc>> stages_;
+    bool verbose_ = true;
     
 public:
     ComputationPipeline& add_stage(const std::string& name, TransformFunc transform) {
         stages_.push_back({name, transform});
         return *this;
     }
-    
-    std::future<std::vector<double>> execute(const std::vector<double>& initial_data) {
-        return std::async(std::launch::async, [this, initial_data]() {
-            std::vector<double> data = initial_data;
-            
-            for (const auto& [stage_name, transform] : stages_) {
-                std::cout << "[Pipeline] Executing stage: " << stage_name 
-                         << " (input size: " << data.size() << ")\n";
-                
+
+    void set_verbose(bool verbose) { verbose_ = verbose; }
+    
+    // Chains the stages as continuations on executor. No thread waits
+    // between stages; a pool thread is busy only while a stage runs.
+    ScientificFuture<std::vector<double>> execute(ComputeExecutor& executor,
+                                                  const std::vector<double>& initial_data) const {
+        // Seed on the executor so even the first stage leaves the caller
+        auto future = async_on(executor, [initial_data] { return initial_data; });
+        for (const auto& [stage_name, transform] : stages_) {
+            future = future.then(executor, [name = stage_name, transform = transform, verbose = verbose_](
+                                               const std::vector<double>& data) {
+                if (!verbose) return transform(data);
+                std::cout << "[Pipeline] Executing stage: " << name
+                          << " (input size: " << data.size() << ")\n";
                 auto start = std::chrono::high_resolution_clock::now();
-                data = transform(data);
+                auto output = transform(data);
                 auto end = std::chrono::high_resolution_clock::now();
-                
                 auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
                 std::cout << "[Pipeline] Stage completed in " << duration.count() << "ms\n";
-            }
-            
-            return data;
-        });
+                return output;
+            });
+        }
+        return future;
     }
 };
 
@@ -443,50 +815,364 @@ std::future<std::vector<double>> parallel_matrix_vector_multiply(
     });
 }
 
-// Scientific computation queue with result promises
+// Trimmed copy of pattern 26's MultiLevelScheduler and its ring, without
+// the per-level wait statistics.
+
+// Bounded lock-free MPMC ring (Vyukov). Each cell's sequence number equals
+// its position when the cell is free for that lap and position + 1 once it
+// holds a value, so producers and consumers claim cells with one CAS each.
+template<typename T>
+class BoundedMpmcRing {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+    
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+    
+public:
+    // capacity must be a power of two
+    explicit BoundedMpmcRing(size_t capacity) : cells_(new Cell[capacity]), mask_(capacity - 1) {
+        for (size_t i = 0; i < capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    
+    bool tryPush(T& value) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    
+    bool tryPop(T& out) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = std::move(cell.value);
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Empty
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+enum class AdmissionPolicy {
+    Reject,      // Refuse the new request
+    ShedLowest   // Drop a queued request of lower priority to make room
+};
+
+struct SchedulerOptions {
+    size_t ringCapacity = 1024;                        // Per worker and level, power of two
+    std::chrono::microseconds agingQuantum{2000};      // 0 = strict priority
+    std::chrono::microseconds latencySLO{0};           // 0 = admit everything
+    AdmissionPolicy admission = AdmissionPolicy::Reject;
+};
+
+// Multi-level scheduler. Every worker owns one lock-free ring per priority
+// level. Producers push into their home worker's rings. A worker takes the
+// best level from its own rings first and steals from the others when those
+// are empty, so no worker idles while anything is queued.
+//
+// Aging: a non-empty level's effective priority grows by one per
+// agingQuantum since it was last served, so however much higher-priority
+// work arrives, level l is still served about once every (kLevels - l) quanta.
+//
+// Admission: the expected queueing delay is pending * meanService / workers.
+// When it exceeds latencySLO, the request is either rejected or it evicts a
+// queued request from the lowest non-empty level below its own.
+//
+// Capacity: each level holds at most workers * ringCapacity queued requests.
+// A push that finds every ring of its level full returns QueueFull, whatever
+// the SLO; that is a sizing limit, not an overload verdict.
+template<typename Task>
+class MultiLevelScheduler {
+public:
+    static constexpr int kLevels = 8;
+    
+    enum class Admission { Accepted, Rejected, AcceptedAfterShed, QueueFull };
+    
+private:
+    struct Entry {
+        Task task;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+    
+    struct alignas(64) LevelState {
+        std::atomic<size_t> count{0};
+        std::atomic<int64_t> lastServedNs{0};
+    };
+    
+    using Clock = std::chrono::steady_clock;
+    
+    size_t workers_;
+    SchedulerOptions options_;
+    // rings_[worker * kLevels + level]
+    std::vector<std::unique_ptr<BoundedMpmcRing<Entry>>> rings_;
+    LevelState levels_[kLevels];
+    
+    alignas(64) std::atomic<size_t> pending_{0};
+    std::atomic<int64_t> meanServiceNs_{0};
+    std::atomic<size_t> steals_{0};
+    std::atomic<size_t> rejected_{0};
+    std::atomic<size_t> shed_{0};
+    std::atomic<size_t> queueFull_{0};
+    std::atomic<size_t> nextHome_{0};
+    
+    // Sleep/wake for idle workers only; the queues themselves take no lock
+    std::mutex idleMutex_;
+    std::condition_variable idleCv_;
+    std::atomic<size_t> idleWorkers_{0};
+    std::atomic<bool> stopped_{false};
+    
+    static int levelOf(int priority) {
+        return std::max(0, std::min(priority, kLevels - 1));
+    }
+    
+    static int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now().time_since_epoch()).count();
+    }
+    
+    BoundedMpmcRing<Entry>& ring(size_t worker, int level) {
+        return *rings_[worker * kLevels + level];
+    }
+    
+    static size_t& boundWorker() {
+        thread_local size_t worker = SIZE_MAX;
+        return worker;
+    }
+    
+    // Worker threads push to their own rings, other threads are spread round-robin
+    size_t homeWorker() {
+        if (boundWorker() != SIZE_MAX) return boundWorker() % workers_;
+        thread_local size_t home = nextHome_.fetch_add(1, std::memory_order_relaxed);
+        return home % workers_;
+    }
+    
+    // Pops the oldest entry of level from worker's ring, or steals one
+    bool takeFrom(size_t worker, int level, Entry& out) {
+        for (size_t i = 0; i < workers_; ++i) {
+            if (ring((worker + i) % workers_, level).tryPop(out)) {
+                if (i != 0) steals_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void retire(int level, int64_t now) {
+        levels_[level].count.fetch_sub(1, std::memory_order_relaxed);
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        levels_[level].lastServedNs.store(now, std::memory_order_relaxed);
+    }
+    
+    bool overloaded() const {
+        if (options_.latencySLO.count() == 0) return false;
+        double expectedNs = double(pending_.load(std::memory_order_relaxed)) *
+                            double(meanServiceNs_.load(std::memory_order_relaxed)) / double(workers_);
+        return expectedNs > 1e3 * double(options_.latencySLO.count());
+    }
+    
+    // Evicts one queued entry below level, lowest level first
+    bool shedBelow(int level, Task& shed) {
+        for (int l = 0; l < level; ++l) {
+            if (levels_[l].count.load(std::memory_order_relaxed) == 0) continue;
+            Entry victim;
+            for (size_t w = 0; w < workers_; ++w) {
+                if (ring(w, l).tryPop(victim)) {
+                    levels_[l].count.fetch_sub(1, std::memory_order_relaxed);
+                    pending_.fetch_sub(1, std::memory_order_relaxed);
+                    shed = std::move(victim.task);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    
+public:
+    MultiLevelScheduler(size_t workers, const SchedulerOptions& options = {})
+        : workers_(std::max<size_t>(workers, 1)), options_(options) {
+        for (size_t i = 0; i < workers_ * kLevels; ++i) {
+            rings_.push_back(std::make_unique<BoundedMpmcRing<Entry>>(options_.ringCapacity));
+        }
+    }
+    
+    // Routes pushes made by the calling worker thread to its own rings
+    static void bindWorker(size_t worker) { boundWorker() = worker; }
+    
+    // On Rejected or QueueFull, task is left untouched. On AcceptedAfterShed,
+    // and on a QueueFull that came after an eviction, shed holds the evicted
+    // lower-priority task, which the caller must fail.
+    Admission push(Task& task, int priority, Task& shed) {
+        int level = levelOf(priority);
+        Admission result = Admission::Accepted;
+        if (overloaded()) {
+            if (options_.admission == AdmissionPolicy::ShedLowest && shedBelow(level, shed)) {
+                shed_.fetch_add(1, std::memory_order_relaxed);
+                result = Admission::AcceptedAfterShed;
+            } else {
+                rejected_.fetch_add(1, std::memory_order_relaxed);
+                return Admission::Rejected;
+            }
+        }
+        
+        Entry entry{std::move(task), Clock::now()};
+        size_t home = homeWorker();
+        // A level that was empty starts aging now, not from its last service
+        if (levels_[level].count.fetch_add(1, std::memory_order_relaxed) == 0) {
+            levels_[level].lastServedNs.store(nowNs(), std::memory_order_relaxed);
+        }
+        // Count the entry before it becomes visible, so a worker's retire()
+        // can never decrement pending_ below zero
+        pending_.fetch_add(1, std::memory_order_seq_cst);
+        bool stored = false;
+        for (size_t i = 0; i < workers_ && !stored; ++i) {
+            stored = ring((home + i) % workers_, level).tryPush(entry);
+        }
+        if (!stored) {
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            levels_[level].count.fetch_sub(1, std::memory_order_relaxed);
+            task = std::move(entry.task);
+            queueFull_.fetch_add(1, std::memory_order_relaxed);
+            return Admission::QueueFull;
+        }
+        
+        if (idleWorkers_.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            idleCv_.notify_one();
+        }
+        return result;
+    }
+    
+    // Non-blocking: picks the non-empty level with the highest aged priority
+    bool tryPop(size_t worker, Task& out) {
+        if (pending_.load(std::memory_order_acquire) == 0) return false;
+        int64_t now = nowNs();
+        int64_t quantum = std::chrono::duration_cast<std::chrono::nanoseconds>(options_.agingQuantum).count();
+        
+        int order[kLevels];
+        double effective[kLevels];
+        int candidates = 0;
+        for (int l = kLevels - 1; l >= 0; --l) {
+            if (levels_[l].count.load(std::memory_order_relaxed) == 0) continue;
+            double boost = quantum > 0
+                ? double(now - levels_[l].lastServedNs.load(std::memory_order_relaxed)) / double(quantum) : 0.0;
+            effective[l] = l + std::max(0.0, boost);
+            order[candidates++] = l;
+        }
+        // Highest effective priority first; ties keep the higher level
+        std::stable_sort(order, order + candidates, [&](int a, int b) { return effective[a] > effective[b]; });
+        
+        for (int i = 0; i < candidates; ++i) {
+            Entry entry;
+            if (takeFrom(worker, order[i], entry)) {
+                retire(order[i], now);
+                out = std::move(entry.task);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // Blocks until a task is available; false once stopped and drained
+    bool waitPop(size_t worker, Task& out) {
+        while (true) {
+            if (tryPop(worker, out)) return true;
+            std::unique_lock<std::mutex> lock(idleMutex_);
+            idleWorkers_.fetch_add(1, std::memory_order_seq_cst);
+            idleCv_.wait(lock, [this] {
+                return pending_.load(std::memory_order_seq_cst) > 0 || stopped_.load();
+            });
+            idleWorkers_.fetch_sub(1, std::memory_order_relaxed);
+            if (stopped_.load() && pending_.load() == 0) return false;
+        }
+    }
+    
+    // Feeds the admission estimate; a racy moving average is precise enough
+    void recordServiceTime(std::chrono::nanoseconds elapsed) {
+        int64_t mean = meanServiceNs_.load(std::memory_order_relaxed);
+        int64_t sample = elapsed.count();
+        meanServiceNs_.store(mean == 0 ? sample : mean + (sample - mean) / 8, std::memory_order_relaxed);
+    }
+    
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            stopped_.store(true);
+        }
+        idleCv_.notify_all();
+    }
+    
+    bool stopped() const { return stopped_.load(); }
+    size_t size() const { return pending_.load(); }
+    size_t steals() const { return steals_.load(); }
+    size_t rejected() const { return rejected_.load(); }
+    size_t shed() const { return shed_.load(); }
+    size_t queueFull() const { return queueFull_.load(); }
+};
+
+
+// Raised through a computation's future when the queue refuses or sheds it
+class AdmissionRejected : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// Scientific computation queue with result promises. Priorities go to a
+// multi-level scheduler: per-worker lock-free queues with stealing, aging
+// so low priorities are not starved, and optional latency-SLO admission.
 class ScientificComputationQueue {
 private:
     struct Computation {
         std::function<double()> compute_func;
         std::promise<double> result_promise;
         std::string name;
-        int priority;
+        int priority = 0;
     };
     
-    // Priority queue for computations
-    struct CompareComputation {
-        bool operator()(const Computation& a, const Computation& b) {
-            return a.priority < b.priority;
-        }
-    };
-    
-    std::priority_queue<Computation, std::vector<Computation>, CompareComputation> computations_;
-    std::mutex mutex_;
-    std::condition_variable cv_;
+    MultiLevelScheduler<Computation> scheduler_;
     std::vector<std::thread> workers_;
-    std::atomic<bool> stop_{false};
     std::atomic<size_t> completed_computations_{0};
     
     void worker_thread(int id) {
-        while (!stop_) {
-            Computation comp;
-            
-            {
-                std::unique_lock<std::mutex> lock(mutex_);
-                cv_.wait(lock, [this] { return stop_ || !computations_.empty(); });
-                
-                if (stop_ && computations_.empty()) return;
-                
-                comp = std::move(const_cast<Computation&>(computations_.top()));
-                computations_.pop();
-            }
-            
+        MultiLevelScheduler<Computation>::bindWorker(id);
+        Computation comp;
+        while (scheduler_.waitPop(id, comp)) {
             std::cout << "[Worker " << id << "] Starting computation: " << comp.name << "\n";
             
             try {
                 auto start = std::chrono::high_resolution_clock::now();
                 double result = comp.compute_func();
                 auto end = std::chrono::high_resolution_clock::now();
+                scheduler_.recordServiceTime(end - start);
                 
                 auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
                 std::cout << "[Worker " << id << "] Completed " << comp.name 
@@ -501,7 +1187,9 @@ private:
     }
     
 public:
-    explicit ScientificComputationQueue(size_t num_workers = std::thread::hardware_concurrency()) {
+    explicit ScientificComputationQueue(size_t num_workers = std::thread::hardware_concurrency(),
+                                        const SchedulerOptions& options = {})
+        : scheduler_(num_workers, options) {
         for (size_t i = 0; i < num_workers; ++i) {
             workers_.emplace_back(&ScientificComputationQueue::worker_thread, this, i);
         }
@@ -509,18 +1197,19 @@ public:
     }
     
     ~ScientificComputationQueue() {
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            stop_ = true;
-        }
-        cv_.notify_all();
+        scheduler_.stop();
         
         for (auto& worker : workers_) {
             worker.join();
         }
         
         std::cout << "[ComputationQueue] Completed " << completed_computations_ 
-                  << " computations\n";
+                  << " computations";
+        if (scheduler_.rejected() + scheduler_.shed() + scheduler_.queueFull() > 0) {
+            std::cout << " (" << scheduler_.rejected() << " rejected, " << scheduler_.shed() << " shed, "
+                      << scheduler_.queueFull() << " refused with a full queue)";
+        }
+        std::cout << "\n";
     }
     
     std::future<double> submit_computation(
@@ -534,12 +1223,27 @@ public:
         comp.priority = priority;
         auto future = comp.result_promise.get_future();
         
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            computations_.push(std::move(comp));
+        Computation shed;
+        switch (scheduler_.push(comp, priority, shed)) {
+            case MultiLevelScheduler<Computation>::Admission::Rejected:
+                comp.result_promise.set_exception(std::make_exception_ptr(
+                    AdmissionRejected(name + " rejected: backlog exceeds latency SLO")));
+                break;
+            case MultiLevelScheduler<Computation>::Admission::QueueFull:
+                comp.result_promise.set_exception(std::make_exception_ptr(
+                    AdmissionRejected(name + " rejected: priority level queue full")));
+                if (shed.compute_func) {
+                    shed.result_promise.set_exception(std::make_exception_ptr(
+                        AdmissionRejected(shed.name + " shed for higher-priority work")));
+                }
+                break;
+            case MultiLevelScheduler<Computation>::Admission::AcceptedAfterShed:
+                shed.result_promise.set_exception(std::make_exception_ptr(
+                    AdmissionRejected(shed.name + " shed for higher-priority work")));
+                break;
+            case MultiLevelScheduler<Computation>::Admission::Accepted:
+                break;
         }
-        
-        cv_.notify_one();
         return future;
     }
 };
@@ -585,24 +1289,51 @@ std::future<std::pair<std::string, double>> first_converged_solver(
 void chaining_example() {
     std::cout << "\n=== Task Chaining Example ===\n";
     
-    TaskChain chain;
-    auto future = chain
-        .then([](int x) { return x * 2; })
-        .then([](int x) { return x + 10; })
-        .then([](int x) { return x / 3; })
-        .execute(15);
+    ScientificThreadPool pool(2);
+    ScientificPromise<int> input;
+    auto future = input.get_future()
+        .then(pool, [](int x) { return x * 2; })
+        .then(pool, [](int x) { return x + 10; })
+        .then(pool, [](int x) { return x / 3; });
     
+    // The chain is registered before the value exists; setting it starts the stages
+    input.set_value(15);
     std::cout << "Final result: " << future.get() << "\n";
+    
+    // A failing stage skips the remaining ones and surfaces at get()
+    auto failing = make_ready_future(4.0)
+        .then(pool, [](double x) -> double {
+            if (x > 0) throw std::domain_error("Jacobian singular at x = 4");
+            return x;
+        })
+        .then(pool, [](double x) { return std::sqrt(x); });
+    try {
+        failing.get();
+    } catch (const std::exception& e) {
+        std::cout << "Chain failed: " << e.what() << "\n";
+    }
 }
 
 void parallel_computation_example() {
     std::cout << "\n=== Parallel Computation Example ===\n";
     
+    ScientificThreadPool pool(4);
     std::vector<int> numbers(1000000);
     std::iota(numbers.begin(), numbers.end(), 1);
     
     auto start = std::chrono::high_resolution_clock::now();
-    long long sum = parallel_accumulate(numbers.begin(), numbers.end(), 0LL);
+    const size_t chunks = 8;
+    const size_t chunk_size = numbers.size() / chunks;
+    std::vector<ScientificFuture<long long>> partials;
+    for (size_t c = 0; c < chunks; ++c) {
+        auto first = numbers.begin() + c * chunk_size;
+        auto last = c + 1 == chunks ? numbers.end() : first + chunk_size;
+        partials.push_back(async_on(pool, [first, last] { return std::accumulate(first, last, 0LL); }));
+    }
+    auto sum_future = when_all(partials).then(pool, [](const std::vector<long long>& sums) {
+        return std::accumulate(sums.begin(), sums.end(), 0LL);
+    });
+    long long sum = sum_future.get();
     auto end = std::chrono::high_resolution_clock::now();
     
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
@@ -612,64 +1343,168 @@ void parallel_computation_example() {
 }
 
 void task_queue_example() {
-    std::cout << "\n=== Promise Task Queue Example ===\n";
-    
-    PromiseTaskQueue queue;
-    std::vector<std::future<void>> futures;
+    std::cout << "\n=== Prioritized Computation Queue Example ===\n";
     
-    for (int i = 0; i < 5; ++i) {
-        futures.push_back(queue.submit([i]() {
-            std::cout << "Task " << i << " executing on thread " 
-                      << std::this_thread::get_id() << "\n";
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        }));
+    std::vector<std::future<double>> futures;
+    std::vector<double> results;
+    {
+        ScientificComputationQueue queue(2);
+        
+        for (int i = 0; i < 5; ++i) {
+            futures.push_back(queue.submit_computation("Integral " + std::to_string(i), [i]() {
+                // Trapezoidal rule for the integral of x^i over [0, 1]
+                const int n = 200000;
+                double h = 1.0 / n, total = 0.5 * (std::pow(0.0, i) + 1.0);
+                for (int k = 1; k < n; ++k) total += std::pow(k * h, i);
+                return total * h;
+            }, i));
+        }
+        
+        for (auto& future : futures) {
+            results.push_back(future.get());
+        }
     }
     
-    // Wait for all tasks
-    for (auto& future : futures) {
-        future.wait();
+    for (size_t i = 0; i < results.size(); ++i) {
+        std::cout << "Integral of x^" << i << " = " << std::fixed << std::setprecision(6)
+                  << results[i] << " (exact " << 1.0 / (i + 1) << ")\n";
     }
     
-    std::cout << "All tasks completed\n";
+    std::cout << "All computations completed\n";
 }
 
 void combinator_example() {
     std::cout << "\n=== Future Combinator Example ===\n";
     
-    // when_all example
-    auto f1 = std::async(std::launch::async, []() {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        return 10;
-    });
-    
-    auto f2 = std::async(std::launch::async, []() {
-        std::this_thread::sleep_for(std::chrono::milliseconds(200));
-        return 20;
-    });
+    ScientificThreadPool pool(3);
+    auto delayed = [&pool](int value, int ms) {
+        return async_on(pool, [value, ms] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+            return value;
+        });
+    };
     
-    auto f3 = std::async(std::launch::async, []() {
-        std::this_thread::sleep_for(std::chrono::milliseconds(150));
-        return 30;
-    });
+    // when_all example
+    auto all_future = when_all(std::vector<ScientificFuture<int>>{
+        delayed(10, 100), delayed(20, 200), delayed(30, 150)});
+    auto results = all_future.get();
+    
+    std::cout << "when_all results: " << results[0] << ", " << results[1] << ", " << results[2] << "\n";
+    std::cout << "Sum: " << (results[0] + results[1] + results[2]) << "\n";
+    
+    // when_any example: the fastest solver wins, a diverging one is ignored
+    std::vector<ScientificFuture<int>> solvers = {delayed(1, 120), delayed(2, 40)};
+    solvers.push_back(async_on(pool, []() -> int { throw std::runtime_error("CG diverged"); }));
+    auto [index, value] = when_any(solvers).get();
+    std::cout << "when_any winner: solver " << index << " (value " << value << ")\n";
+}
+
+void pipeline_example() {
+    std::cout << "\n=== Non-blocking Pipeline Example ===\n";
+    
+    ScientificThreadPool pool(2);
+    ComputationPipeline pipeline;
+    pipeline
+        .add_stage("Normalize", [](const std::vector<double>& data) {
+            double norm = std::sqrt(std::inner_product(data.begin(), data.end(), data.begin(), 0.0));
+            std::vector<double> out(data);
+            for (double& x : out) x /= norm;
+            return out;
+        })
+        .add_stage("Square", [](const std::vector<double>& data) {
+            std::vector<double> out(data);
+            for (double& x : out) x *= x;
+            return out;
+        })
+        .add_stage("Prefix sum", [](const std::vector<double>& data) {
+            std::vector<double> out(data.size());
+            std::partial_sum(data.begin(), data.end(), out.begin());
+            return out;
+        });
     
-    auto all_future = when_all(std::move(f1), std::move(f2), std::move(f3));
-    auto [r1, r2, r3] = all_future.get();
+    std::vector<double> data(1000);
+    std::iota(data.begin(), data.end(), 1.0);
+    auto result = pipeline.execute(pool, data);
+    std::cout << "Pipeline submitted; caller is free while stages run\n";
+    double cumulative = result.get().back();
+    std::cout << "Cumulative norm: " << std::setprecision(6) << cumulative << "\n";
+}
+
+// Many short pipelines sharing one small pool: continuations occupy a thread
+// only while a stage runs, whereas blocking chains park a thread per stage
+void continuation_throughput_example() {
+    std::cout << "\n=== Continuation Throughput Example ===\n";
+    
+    const int pipelines = 2000;
+    const int stages = 8;
+    auto stage = [](double x) {
+        for (int k = 0; k < 200; ++k) x = std::cos(x);
+        return x;
+    };
     
-    std::cout << "when_all results: " << r1 << ", " << r2 << ", " << r3 << "\n";
-    std::cout << "Sum: " << (r1 + r2 + r3) << "\n";
+    // Blocking baseline: each stage is a std::async task that waits on the previous one
+    auto start = std::chrono::steady_clock::now();
+    double blocking_sum = 0.0;
+    {
+        std::vector<std::future<double>> tails;
+        for (int p = 0; p < pipelines; ++p) {
+            std::shared_future<double> previous = std::async(std::launch::async, [p] { return p * 1e-3; }).share();
+            for (int s = 0; s < stages; ++s) {
+                previous = std::async(std::launch::async, [previous, stage] { return stage(previous.get()); }).share();
+            }
+            blocking_sum += previous.get();
+        }
+    }
+    double blocking_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    
+    size_t reused_before = SharedStatePool::reused().load();
+    size_t allocated_before = SharedStatePool::allocated().load();
+    start = std::chrono::steady_clock::now();
+    double chained_sum = 0.0;
+    size_t pool_tasks = 0;
+    {
+        // Submitted in batches so later batches recycle the shared states of earlier ones
+        ScientificThreadPool pool(4);
+        const int batch = 250;
+        for (int first = 0; first < pipelines; first += batch) {
+            std::vector<ScientificFuture<double>> tails;
+            tails.reserve(batch);
+            for (int p = first; p < first + batch; ++p) {
+                auto future = async_on(pool, [p] { return p * 1e-3; });
+                for (int s = 0; s < stages; ++s) {
+                    future = future.then(pool, stage);
+                }
+                tails.push_back(future);
+            }
+            for (double value : when_all(tails).get()) chained_sum += value;
+        }
+        pool_tasks = pool.tasks_completed();
+    }
+    double chained_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    
+    std::cout << pipelines << " pipelines x " << stages << " stages\n";
+    std::cout << "Blocking std::async chain: " << std::setprecision(1) << blocking_ms
+              << " ms (one thread per stage, " << pipelines * (stages + 1) << " threads created)\n";
+    std::cout << "Executor continuations:    " << chained_ms << " ms (4 pool threads, "
+              << pool_tasks << " posted tasks; the rest ran inline on ready futures)\n";
+    std::cout << "Results agree: " << (std::abs(blocking_sum - chained_sum) < 1e-9 ? "yes" : "NO") << "\n";
+    std::cout << "Shared states: " << SharedStatePool::allocated().load() - allocated_before
+              << " allocated, " << SharedStatePool::reused().load() - reused_before << " reused from pool\n";
 }
 
 int main() {
     std::cout << "=== Future-Promise Pattern Demo ===\n\n";
     
-    basic_example();
-    async_example();
-    exception_example();
-    shared_future_example();
+    eigenvalue_computation_example();
+    monte_carlo_integration_example();
+    numerical_solver_exception_example();
+    shared_simulation_parameters_example();
     chaining_example();
     parallel_computation_example();
     task_queue_example();
     combinator_example();
+    pipeline_example();
+    continuation_throughput_example();
     
     return 0;
-}
\ No newline at end of file
+}
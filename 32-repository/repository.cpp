@@ -9,6 +9,13 @@
 #include <sstream>
 #include <chrono>
 #include <iomanip>
+#include <map>
+#include <set>
+#include <unordered_set>
+#include <string>
+#include <limits>
+#include <stdexcept>
+#include <random>
 
 // Domain Entity
 class User {
@@ -20,11 +27,11 @@ private:
     bool active_;
     
 public:
-    User() : id_(0), active_(true), created_at_(std::chrono::system_clock::now()) {}
+    User() : id_(0), created_at_(std::chrono::system_clock::now()), active_(true) {}
     
     User(int id, const std::string& username, const std::string& email)
         : id_(id), username_(username), email_(email), 
-          active_(true), created_at_(std::chrono::system_clock::now()) {}
+          created_at_(std::chrono::system_clock::now()), active_(true) {}
     
     // Getters
     int getId() const { return id_; }
@@ -52,27 +59,51 @@ public:
     }
 };
 
-// Specification pattern for queries
+// How a secondary index can answer a leaf specification
+struct IndexProbe {
+    enum class Kind { Equality, Range, Suffix };
+    
+    Kind kind;
+    std::string field;
+    std::string key;        // Equality and Suffix
+    double low = 0.0;       // Range, inclusive
+    double high = 0.0;
+};
+
+template<typename T> class AndSpecification;
+template<typename T> class OrSpecification;
+template<typename T> class NotSpecification;
+
+// Specification pattern for queries. Combinators share their operands, so
+// and_/or_/not_ need the specification to be owned by a shared_ptr.
 template<typename T>
-class Specification {
+class Specification : public std::enable_shared_from_this<Specification<T>> {
 public:
+    enum class Shape { Leaf, And, Or, Not };
+    
     virtual ~Specification() = default;
     virtual bool isSatisfiedBy(const T& entity) const = 0;
     
+    // Query planning hooks: combinators expose their operands, and leaves an
+    // index can answer describe the probe
+    virtual Shape shape() const { return Shape::Leaf; }
+    virtual std::vector<const Specification<T>*> operands() const { return {}; }
+    virtual std::optional<IndexProbe> indexProbe() const { return std::nullopt; }
+    
     // Composite specifications
     std::shared_ptr<Specification<T>> and_(std::shared_ptr<Specification<T>> other) {
         return std::make_shared<AndSpecification<T>>(
-            std::shared_ptr<Specification<T>>(this), other);
+            this->shared_from_this(), other);
     }
     
     std::shared_ptr<Specification<T>> or_(std::shared_ptr<Specification<T>> other) {
         return std::make_shared<OrSpecification<T>>(
-            std::shared_ptr<Specification<T>>(this), other);
+            this->shared_from_this(), other);
     }
     
     std::shared_ptr<Specification<T>> not_() {
         return std::make_shared<NotSpecification<T>>(
-            std::shared_ptr<Specification<T>>(this));
+            this->shared_from_this());
     }
 };
 
@@ -90,6 +121,14 @@ public:
     bool isSatisfiedBy(const T& entity) const override {
         return left_->isSatisfiedBy(entity) && right_->isSatisfiedBy(entity);
     }
+    
+    typename Specification<T>::Shape shape() const override {
+        return Specification<T>::Shape::And;
+    }
+    
+    std::vector<const Specification<T>*> operands() const override {
+        return {left_.get(), right_.get()};
+    }
 };
 
 template<typename T>
@@ -106,6 +145,14 @@ public:
     bool isSatisfiedBy(const T& entity) const override {
         return left_->isSatisfiedBy(entity) || right_->isSatisfiedBy(entity);
     }
+    
+    typename Specification<T>::Shape shape() const override {
+        return Specification<T>::Shape::Or;
+    }
+    
+    std::vector<const Specification<T>*> operands() const override {
+        return {left_.get(), right_.get()};
+    }
 };
 
 template<typename T>
@@ -120,6 +167,14 @@ public:
     bool isSatisfiedBy(const T& entity) const override {
         return !spec_->isSatisfiedBy(entity);
     }
+    
+    typename Specification<T>::Shape shape() const override {
+        return Specification<T>::Shape::Not;
+    }
+    
+    std::vector<const Specification<T>*> operands() const override {
+        return {spec_.get()};
+    }
 };
 
 // Concrete specifications for User
@@ -128,6 +183,10 @@ public:
     bool isSatisfiedBy(const User& user) const override {
         return user.isActive();
     }
+    
+    std::optional<IndexProbe> indexProbe() const override {
+        return IndexProbe{IndexProbe::Kind::Equality, "active", "true"};
+    }
 };
 
 class UserByUsernameSpecification : public Specification<User> {
@@ -141,6 +200,27 @@ public:
     bool isSatisfiedBy(const User& user) const override {
         return user.getUsername() == username_;
     }
+    
+    std::optional<IndexProbe> indexProbe() const override {
+        return IndexProbe{IndexProbe::Kind::Equality, "username", username_};
+    }
+};
+
+class UserByEmailSpecification : public Specification<User> {
+private:
+    std::string email_;
+    
+public:
+    explicit UserByEmailSpecification(const std::string& email)
+        : email_(email) {}
+    
+    bool isSatisfiedBy(const User& user) const override {
+        return user.getEmail() == email_;
+    }
+    
+    std::optional<IndexProbe> indexProbe() const override {
+        return IndexProbe{IndexProbe::Kind::Equality, "email", email_};
+    }
 };
 
 class UserByEmailDomainSpecification : public Specification<User> {
@@ -158,6 +238,329 @@ public:
         }
         return false;
     }
+    
+    // "@domain" as a suffix of the whole address
+    std::optional<IndexProbe> indexProbe() const override {
+        return IndexProbe{IndexProbe::Kind::Suffix, "email", "@" + domain_};
+    }
+};
+
+// Secondary index over entities of type T, keyed by entity id. estimate()
+// may stop counting at limit: the planner only needs to know whether a probe
+// beats the best one found so far.
+template<typename T>
+class SecondaryIndex {
+public:
+    virtual ~SecondaryIndex() = default;
+    virtual const std::string& field() const = 0;
+    virtual bool supports(IndexProbe::Kind kind) const = 0;
+    virtual const char* kindName() const = 0;
+    virtual void insert(int id, const T& entity) = 0;
+    virtual void erase(int id, const T& entity) = 0;
+    virtual size_t estimate(const IndexProbe& probe, size_t limit) const = 0;
+    virtual void lookup(const IndexProbe& probe, std::vector<int>& ids) const = 0;
+};
+
+// Equality on a string key
+template<typename T>
+class HashIndex : public SecondaryIndex<T> {
+private:
+    std::string field_;
+    std::function<std::string(const T&)> key_;
+    std::unordered_map<std::string, std::unordered_set<int>> entries_;
+    
+public:
+    HashIndex(const std::string& field, std::function<std::string(const T&)> key)
+        : field_(field), key_(std::move(key)) {}
+    
+    const std::string& field() const override { return field_; }
+    bool supports(IndexProbe::Kind kind) const override { return kind == IndexProbe::Kind::Equality; }
+    const char* kindName() const override { return "hash"; }
+    
+    void insert(int id, const T& entity) override {
+        entries_[key_(entity)].insert(id);
+    }
+    
+    void erase(int id, const T& entity) override {
+        auto it = entries_.find(key_(entity));
+        if (it != entries_.end()) {
+            it->second.erase(id);
+            if (it->second.empty()) entries_.erase(it);
+        }
+    }
+    
+    size_t estimate(const IndexProbe& probe, size_t) const override {
+        auto it = entries_.find(probe.key);
+        return it == entries_.end() ? 0 : it->second.size();
+    }
+    
+    void lookup(const IndexProbe& probe, std::vector<int>& ids) const override {
+        auto it = entries_.find(probe.key);
+        if (it != entries_.end()) ids.insert(ids.end(), it->second.begin(), it->second.end());
+    }
+};
+
+// Inclusive ranges over a numeric key
+template<typename T>
+class OrderedIndex : public SecondaryIndex<T> {
+private:
+    std::string field_;
+    std::function<double(const T&)> key_;
+    std::set<std::pair<double, int>> entries_;
+    
+    auto first(const IndexProbe& probe) const {
+        return entries_.lower_bound({probe.low, std::numeric_limits<int>::min()});
+    }
+    
+public:
+    OrderedIndex(const std::string& field, std::function<double(const T&)> key)
+        : field_(field), key_(std::move(key)) {}
+    
+    const std::string& field() const override { return field_; }
+    bool supports(IndexProbe::Kind kind) const override { return kind == IndexProbe::Kind::Range; }
+    const char* kindName() const override { return "ordered"; }
+    
+    void insert(int id, const T& entity) override { entries_.insert({key_(entity), id}); }
+    void erase(int id, const T& entity) override { entries_.erase({key_(entity), id}); }
+    
+    size_t estimate(const IndexProbe& probe, size_t limit) const override {
+        size_t n = 0;
+        for (auto it = first(probe); it != entries_.end() && it->first <= probe.high && n < limit; ++it) ++n;
+        return n;
+    }
+    
+    void lookup(const IndexProbe& probe, std::vector<int>& ids) const override {
+        for (auto it = first(probe); it != entries_.end() && it->first <= probe.high; ++it) {
+            ids.push_back(it->second);
+        }
+    }
+};
+
+// Suffix matches on a string key, stored reversed so a suffix becomes a
+// prefix range of the ordered set
+template<typename T>
+class SuffixIndex : public SecondaryIndex<T> {
+private:
+    std::string field_;
+    std::function<std::string(const T&)> key_;
+    std::set<std::pair<std::string, int>> entries_;
+    
+    static std::string reversed(const std::string& text) {
+        return std::string(text.rbegin(), text.rend());
+    }
+    
+    template<typename Visit>
+    void scan(const std::string& suffix, Visit visit) const {
+        std::string prefix = reversed(suffix);
+        for (auto it = entries_.lower_bound({prefix, std::numeric_limits<int>::min()});
+             it != entries_.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+            if (!visit(it->second)) return;
+        }
+    }
+    
+public:
+    SuffixIndex(const std::string& field, std::function<std::string(const T&)> key)
+        : field_(field), key_(std::move(key)) {}
+    
+    const std::string& field() const override { return field_; }
+    bool supports(IndexProbe::Kind kind) const override { return kind == IndexProbe::Kind::Suffix; }
+    const char* kindName() const override { return "suffix"; }
+    
+    void insert(int id, const T& entity) override { entries_.insert({reversed(key_(entity)), id}); }
+    void erase(int id, const T& entity) override { entries_.erase({reversed(key_(entity)), id}); }
+    
+    size_t estimate(const IndexProbe& probe, size_t limit) const override {
+        size_t n = 0;
+        scan(probe.key, [&](int) { return ++n < limit; });
+        return n;
+    }
+    
+    void lookup(const IndexProbe& probe, std::vector<int>& ids) const override {
+        scan(probe.key, [&](int id) { ids.push_back(id); return true; });
+    }
+};
+
+// Entities by id plus the secondary indexes declared on them. Queries are
+// planned against the specification tree. A conjunction probes the index of
+// its most selective operand. A disjunction unions its operands' probes if
+// every operand has one. Anything else is a full scan. Candidates are always
+// re-checked against the whole specification.
+template<typename T>
+class IndexedCollection {
+public:
+    struct QueryPlan {
+        enum class Access { FullScan, Probe, Union };
+        
+        Access access = Access::FullScan;
+        const SecondaryIndex<T>* index = nullptr;
+        IndexProbe probe{};
+        std::vector<QueryPlan> branches;
+        size_t estimatedRows = 0;
+    };
+    
+private:
+    std::unordered_map<int, T> rows_;
+    std::vector<std::unique_ptr<SecondaryIndex<T>>> indexes_;
+    
+    QueryPlan fullScan() const {
+        QueryPlan plan;
+        plan.estimatedRows = rows_.size();
+        return plan;
+    }
+    
+    // Estimates stop counting at limit; a plan estimated at limit or more
+    // only tells the caller it is no better than limit
+    QueryPlan planLeaf(const Specification<T>& spec, size_t limit) const {
+        QueryPlan best = fullScan();
+        auto probe = spec.indexProbe();
+        if (!probe) return best;
+        for (const auto& index : indexes_) {
+            if (index->field() != probe->field || !index->supports(probe->kind)) continue;
+            size_t rows = index->estimate(*probe, std::min(limit, best.estimatedRows));
+            if (best.access == QueryPlan::Access::FullScan || rows < best.estimatedRows) {
+                best.access = QueryPlan::Access::Probe;
+                best.index = index.get();
+                best.probe = *probe;
+                best.estimatedRows = rows;
+            }
+        }
+        return best;
+    }
+    
+    QueryPlan plan(const Specification<T>& spec, size_t limit) const {
+        switch (spec.shape()) {
+            case Specification<T>::Shape::Leaf:
+                return planLeaf(spec, limit);
+            case Specification<T>::Shape::And: {
+                // Estimate all operands under a growing cap, so counting stops
+                // as soon as the most selective one is known
+                for (size_t cap = std::min<size_t>(64, limit); ; cap = std::min(cap * 4, limit)) {
+                    QueryPlan best = fullScan();
+                    for (const auto* operand : spec.operands()) {
+                        QueryPlan candidate = plan(*operand, cap);
+                        if (candidate.access != QueryPlan::Access::FullScan &&
+                            candidate.estimatedRows < std::min(cap, best.estimatedRows)) {
+                            best = std::move(candidate);
+                        }
+                    }
+                    if (best.access != QueryPlan::Access::FullScan || cap >= limit) return best;
+                }
+            }
+            case Specification<T>::Shape::Or: {
+                QueryPlan merged;
+                merged.access = QueryPlan::Access::Union;
+                for (const auto* operand : spec.operands()) {
+                    QueryPlan branch = plan(*operand, limit);
+                    if (branch.access == QueryPlan::Access::FullScan) return fullScan();
+                    merged.estimatedRows += branch.estimatedRows;
+                    merged.branches.push_back(std::move(branch));
+                }
+                return merged.estimatedRows < rows_.size() ? merged : fullScan();
+            }
+            case Specification<T>::Shape::Not:
+                break;
+        }
+        return fullScan();
+    }
+    
+    void collect(const QueryPlan& plan, std::vector<int>& ids) const {
+        if (plan.access == QueryPlan::Access::Probe) {
+            plan.index->lookup(plan.probe, ids);
+        } else {
+            for (const auto& branch : plan.branches) collect(branch, ids);
+        }
+    }
+    
+    static std::string describe(const IndexProbe& probe) {
+        std::ostringstream out;
+        out << probe.field;
+        switch (probe.kind) {
+            case IndexProbe::Kind::Equality: out << " = '" << probe.key << "'"; break;
+            case IndexProbe::Kind::Suffix: out << " ends with '" << probe.key << "'"; break;
+            case IndexProbe::Kind::Range: out << " in [" << probe.low << ", " << probe.high << "]"; break;
+        }
+        return out.str();
+    }
+    
+public:
+    void addIndex(std::unique_ptr<SecondaryIndex<T>> index) {
+        for (const auto& [id, entity] : rows_) index->insert(id, entity);
+        indexes_.push_back(std::move(index));
+    }
+    
+    void insert(const T& entity) {
+        int id = entity.getId();
+        auto [it, inserted] = rows_.emplace(id, entity);
+        if (!inserted) {
+            for (auto& index : indexes_) index->erase(id, it->second);
+            it->second = entity;
+        }
+        for (auto& index : indexes_) index->insert(id, entity);
+    }
+    
+    bool erase(int id) {
+        auto it = rows_.find(id);
+        if (it == rows_.end()) return false;
+        for (auto& index : indexes_) index->erase(id, it->second);
+        rows_.erase(it);
+        return true;
+    }
+    
+    const T* find(int id) const {
+        auto it = rows_.find(id);
+        return it == rows_.end() ? nullptr : &it->second;
+    }
+    
+    const std::unordered_map<int, T>& rows() const { return rows_; }
+    size_t size() const { return rows_.size(); }
+    
+    QueryPlan plan(const Specification<T>& spec) const {
+        return plan(spec, rows_.size());
+    }
+    
+    std::vector<T> query(const Specification<T>& spec) const {
+        QueryPlan chosen = plan(spec);
+        std::vector<T> result;
+        if (chosen.access == QueryPlan::Access::FullScan) {
+            for (const auto& [id, entity] : rows_) {
+                if (spec.isSatisfiedBy(entity)) result.push_back(entity);
+            }
+            return result;
+        }
+        
+        std::vector<int> ids;
+        collect(chosen, ids);
+        if (chosen.access == QueryPlan::Access::Union) {
+            std::sort(ids.begin(), ids.end());
+            ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        }
+        for (int id : ids) {
+            const T& entity = rows_.at(id);
+            if (spec.isSatisfiedBy(entity)) result.push_back(entity);
+        }
+        return result;
+    }
+    
+    std::string explain(const QueryPlan& plan) const {
+        std::ostringstream out;
+        switch (plan.access) {
+            case QueryPlan::Access::FullScan:
+                out << "FullScan(" << plan.estimatedRows << " rows)";
+                break;
+            case QueryPlan::Access::Probe:
+                out << "Probe(" << plan.index->kindName() << " index: " << describe(plan.probe)
+                    << ", ~" << plan.estimatedRows << " rows)";
+                break;
+            case QueryPlan::Access::Union:
+                out << "Union(";
+                for (size_t i = 0; i < plan.branches.size(); ++i) {
+                    out << (i ? ", " : "") << explain(plan.branches[i]);
+                }
+                out << ")";
+                break;
+        }
+        return out.str();
+    }
 };
 
 // Repository Interface
@@ -190,60 +593,81 @@ public:
 // In-Memory Repository Implementation
 class InMemoryUserRepository : public IUserRepository {
 private:
-    mutable std::unordered_map<int, User> users_;
-    mutable int nextId_ = 1;
+    IndexedCollection<User> users_;
+    int nextId_ = 1;
+    bool verbose_ = true;
     
 public:
+    // Secondary index declarations; existing users are indexed immediately.
+    // Specifications name the field they probe ("username", "email", ...).
+    void declareHashIndex(const std::string& field, std::function<std::string(const User&)> key) {
+        users_.addIndex(std::make_unique<HashIndex<User>>(field, std::move(key)));
+    }
+    
+    void declareOrderedIndex(const std::string& field, std::function<double(const User&)> key) {
+        users_.addIndex(std::make_unique<OrderedIndex<User>>(field, std::move(key)));
+    }
+    
+    void declareSuffixIndex(const std::string& field, std::function<std::string(const User&)> key) {
+        users_.addIndex(std::make_unique<SuffixIndex<User>>(field, std::move(key)));
+    }
+    
+    // The indexes the built-in user specifications can use
+    void declareStandardIndexes() {
+        declareHashIndex("username", [](const User& u) { return u.getUsername(); });
+        declareHashIndex("email", [](const User& u) { return u.getEmail(); });
+        declareSuffixIndex("email", [](const User& u) { return u.getEmail(); });
+        declareHashIndex("active", [](const User& u) { return u.isActive() ? "true" : "false"; });
+    }
+    
+    std::string explain(const Specification<User>& spec) const {
+        return users_.explain(users_.plan(spec));
+    }
+    
+    void setVerbose(bool verbose) { verbose_ = verbose; }
+    
     void add(const User& user) override {
         User newUser = user;
         if (newUser.getId() == 0) {
             newUser.setId(nextId_++);
         }
-        users_[newUser.getId()] = newUser;
-        std::cout << "Added: " << newUser.toString() << "\n";
+        users_.insert(newUser);
+        if (verbose_) std::cout << "Added: " << newUser.toString() << "\n";
     }
     
     void update(const User& user) override {
-        if (users_.find(user.getId()) != users_.end()) {
-            users_[user.getId()] = user;
-            std::cout << "Updated: " << user.toString() << "\n";
+        if (users_.find(user.getId())) {
+            users_.insert(user);
+            if (verbose_) std::cout << "Updated: " << user.toString() << "\n";
         } else {
             throw std::runtime_error("User not found for update");
         }
     }
     
     void remove(int id) override {
-        auto it = users_.find(id);
-        if (it != users_.end()) {
-            std::cout << "Removed: " << it->second.toString() << "\n";
-            users_.erase(it);
+        if (const User* user = users_.find(id)) {
+            if (verbose_) std::cout << "Removed: " << user->toString() << "\n";
+            users_.erase(id);
         }
     }
     
     std::optional<User> findById(int id) const override {
-        auto it = users_.find(id);
-        if (it != users_.end()) {
-            return it->second;
+        if (const User* user = users_.find(id)) {
+            return *user;
         }
         return std::nullopt;
     }
     
     std::vector<User> findAll() const override {
         std::vector<User> result;
-        for (const auto& [id, user] : users_) {
+        for (const auto& [id, user] : users_.rows()) {
             result.push_back(user);
         }
         return result;
     }
     
     std::vector<User> findBySpecification(const Specification<User>& spec) const override {
-        std::vector<User> result;
-        for (const auto& [id, user] : users_) {
-            if (spec.isSatisfiedBy(user)) {
-                result.push_back(user);
-            }
-        }
-        return result;
+        return users_.query(spec);
     }
     
     size_t count() const override {
@@ -251,29 +675,21 @@ public:
     }
     
     bool exists(int id) const override {
-        return users_.find(id) != users_.end();
+        return users_.find(id) != nullptr;
     }
     
     std::optional<User> findByUsername(const std::string& username) const override {
-        auto it = std::find_if(users_.begin(), users_.end(),
-            [&username](const auto& pair) {
-                return pair.second.getUsername() == username;
-            });
-        
-        if (it != users_.end()) {
-            return it->second;
+        auto matches = findBySpecification(UserByUsernameSpecification(username));
+        if (!matches.empty()) {
+            return matches.front();
         }
         return std::nullopt;
     }
     
     std::optional<User> findByEmail(const std::string& email) const override {
-        auto it = std::find_if(users_.begin(), users_.end(),
-            [&email](const auto& pair) {
-                return pair.second.getEmail() == email;
-            });
-        
-        if (it != users_.end()) {
-            return it->second;
+        auto matches = findBySpecification(UserByEmailSpecification(email));
+        if (!matches.empty()) {
+            return matches.front();
         }
         return std::nullopt;
     }
@@ -394,6 +810,11 @@ public:
     bool isSatisfiedBy(const Product& product) const override {
         return product.getStock() > 0;
     }
+    
+    std::optional<IndexProbe> indexProbe() const override {
+        return IndexProbe{IndexProbe::Kind::Range, "stock", "", 1.0,
+                          std::numeric_limits<double>::infinity()};
+    }
 };
 
 class PriceRangeSpecification : public Specification<Product> {
@@ -408,6 +829,10 @@ public:
     bool isSatisfiedBy(const Product& product) const override {
         return product.getPrice() >= minPrice_ && product.getPrice() <= maxPrice_;
     }
+    
+    std::optional<IndexProbe> indexProbe() const override {
+        return IndexProbe{IndexProbe::Kind::Range, "price", "", minPrice_, maxPrice_};
+    }
 };
 
 // Service layer using repository
@@ -457,12 +882,97 @@ public:
     }
 };
 
+// Milliseconds taken by one call of f
+template<typename F>
+double timeMs(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Same queries against an unindexed and an indexed repository of generated users
+void indexedQueryExample() {
+    std::cout << "\n=== Indexed Specification Queries ===\n";
+    const int userCount = 200000;
+    const int domains = 50;
+    
+    InMemoryUserRepository scanned, indexed;
+    scanned.setVerbose(false);
+    indexed.setVerbose(false);
+    indexed.declareStandardIndexes();
+    
+    std::mt19937 rng(42);
+    for (int i = 1; i <= userCount; ++i) {
+        User user(i, "user" + std::to_string(i),
+                  "user" + std::to_string(i) + "@lab" + std::to_string(rng() % domains) + ".example.org");
+        user.setActive(rng() % 10 != 0);
+        scanned.add(user);
+        indexed.add(user);
+    }
+    
+    auto active = std::make_shared<ActiveUserSpecification>();
+    auto lab7 = std::make_shared<UserByEmailDomainSpecification>("lab7.example.org");
+    auto lab8 = std::make_shared<UserByEmailDomainSpecification>("lab8.example.org");
+    std::vector<std::pair<std::string, std::shared_ptr<Specification<User>>>> queries = {
+        {"username = user123456", std::make_shared<UserByUsernameSpecification>("user123456")},
+        {"domain lab7", lab7},
+        {"active AND domain lab7", active->and_(lab7)},
+        {"domain lab7 OR domain lab8", lab7->or_(lab8)},
+        {"NOT active", active->not_()},
+    };
+    
+    std::cout << std::fixed << std::setprecision(2);
+    for (const auto& [label, spec] : queries) {
+        size_t rowsScanned = 0, rowsIndexed = 0;
+        double scanMs = timeMs([&] { rowsScanned = scanned.findBySpecification(*spec).size(); });
+        double indexMs = timeMs([&] { rowsIndexed = indexed.findBySpecification(*spec).size(); });
+        std::cout << "  " << label << ": " << rowsIndexed << " rows"
+                  << (rowsIndexed == rowsScanned ? "" : " (MISMATCH)") << ", scan " << scanMs
+                  << " ms, planned " << indexMs << " ms\n"
+                  << "    plan: " << indexed.explain(*spec) << "\n";
+    }
+    
+    // Index maintenance: moving a user to another domain and removing one
+    User moved = indexed.findById(7).value();
+    moved.setEmail("user7@lab8.example.org");
+    indexed.update(moved);
+    indexed.remove(8);
+    std::cout << "  After update/remove: lab8 has "
+              << indexed.findBySpecification(*lab8).size() << " users, user7 found by email: "
+              << (indexed.findByEmail("user7@lab8.example.org") ? "yes" : "no")
+              << ", user8 found by username: " << (indexed.findByUsername("user8") ? "yes" : "no") << "\n";
+}
+
+// Ordered indexes on a product catalog: the planner probes the narrower range
+void productCatalogExample() {
+    std::cout << "\n=== Product Catalog Range Queries ===\n";
+    IndexedCollection<Product> catalog;
+    catalog.addIndex(std::make_unique<OrderedIndex<Product>>("price", [](const Product& p) { return p.getPrice(); }));
+    catalog.addIndex(std::make_unique<OrderedIndex<Product>>("stock", [](const Product& p) { return double(p.getStock()); }));
+    
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> price(1.0, 500.0);
+    for (int i = 1; i <= 100000; ++i) {
+        catalog.insert(Product(i, "Item " + std::to_string(i), price(rng), int(rng() % 4) * 10));
+    }
+    
+    auto inStock = std::make_shared<InStockSpecification>();
+    auto affordable = std::make_shared<PriceRangeSpecification>(10.0, 12.0);
+    auto query = inStock->and_(affordable);
+    
+    size_t rows = 0;
+    double ms = timeMs([&] { rows = catalog.query(*query).size(); });
+    std::cout << "  in stock AND $10-$12: " << rows << " products in " << ms << " ms\n"
+              << "    plan: " << catalog.explain(catalog.plan(*query)) << "\n";
+}
+
 int main() {
     std::cout << "=== Repository Pattern Demo ===\n\n";
     
     // Basic repository usage
     std::cout << "=== Basic Repository Usage ===\n";
     auto userRepo = std::make_shared<InMemoryUserRepository>();
+    userRepo->declareStandardIndexes();
     
     // Add users
     userRepo->add(User(0, "alice", "alice@example.com"));
@@ -502,6 +1012,7 @@ int main() {
     UserByEmailDomainSpecification domainSpec("example.com");
     auto exampleUsers = userRepo->findBySpecification(domainSpec);
     std::cout << "Users from example.com: " << exampleUsers.size() << "\n";
+    std::cout << "Plan: " << userRepo->explain(domainSpec) << "\n";
     
     // Service layer
     std::cout << "\n=== Service Layer ===\n";
@@ -542,5 +1053,8 @@ int main() {
     // Find all again - cache hit
     cachedRepo.findAll();
     
+    indexedQueryExample();
+    productCatalogExample();
+    
     return 0;
 }
\ No newline at end of file
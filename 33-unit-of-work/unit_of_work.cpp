@@ -9,12 +9,17 @@
 #include <functional>
 #include <optional>
 #include <string>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <chrono>
 
 // Entity base class
 class Entity {
 protected:
     int id_;
     int version_ = 0;
+    uint32_t dirtyFields_ = 0;  // One bit per field, set by setters that change a value
     
 public:
     Entity(int id = 0) : id_(id) {}
@@ -26,6 +31,10 @@ public:
     int getVersion() const { return version_; }
     void incrementVersion() { version_++; }
     
+    uint32_t dirtyFields() const { return dirtyFields_; }
+    void markDirty(uint32_t fields) { dirtyFields_ |= fields; }
+    void clearDirty() { dirtyFields_ = 0; }
+    
     virtual std::string toString() const = 0;
     virtual std::unique_ptr<Entity> clone() const = 0;
 };
@@ -38,18 +47,46 @@ private:
     double creditLimit_;
     
 public:
+    enum Field : uint32_t {
+        NameField = 1u << 0,
+        EmailField = 1u << 1,
+        CreditLimitField = 1u << 2,
+        AllFields = NameField | EmailField | CreditLimitField
+    };
+    
     Customer(int id = 0, const std::string& name = "", 
              const std::string& email = "", double creditLimit = 0.0)
         : Entity(id), name_(name), email_(email), creditLimit_(creditLimit) {}
     
     std::string getName() const { return name_; }
-    void setName(const std::string& name) { name_ = name; }
+    void setName(const std::string& name) {
+        if (name != name_) { name_ = name; markDirty(NameField); }
+    }
     
     std::string getEmail() const { return email_; }
-    void setEmail(const std::string& email) { email_ = email; }
+    void setEmail(const std::string& email) {
+        if (email != email_) { email_ = email; markDirty(EmailField); }
+    }
     
     double getCreditLimit() const { return creditLimit_; }
-    void setCreditLimit(double limit) { creditLimit_ = limit; }
+    void setCreditLimit(double limit) {
+        if (limit != creditLimit_) { creditLimit_ = limit; markDirty(CreditLimitField); }
+    }
+    
+    // Copies the selected fields from other without marking them dirty
+    void copyFields(const Customer& other, uint32_t fields) {
+        if (fields & NameField) name_ = other.name_;
+        if (fields & EmailField) email_ = other.email_;
+        if (fields & CreditLimitField) creditLimit_ = other.creditLimit_;
+    }
+    
+    static std::string fieldNames(uint32_t fields) {
+        std::string names;
+        if (fields & NameField) names += "name, ";
+        if (fields & EmailField) names += "email, ";
+        if (fields & CreditLimitField) names += "creditLimit, ";
+        return names.empty() ? names : names.substr(0, names.size() - 2);
+    }
     
     std::string toString() const override {
         return "Customer{id=" + std::to_string(id_) + 
@@ -72,22 +109,45 @@ private:
     std::string status_;
     
 public:
+    enum Field : uint32_t {
+        CustomerIdField = 1u << 0,
+        OrderNumberField = 1u << 1,
+        TotalAmountField = 1u << 2,
+        StatusField = 1u << 3,
+        AllFields = CustomerIdField | OrderNumberField | TotalAmountField | StatusField
+    };
+    
     Order(int id = 0, int customerId = 0, const std::string& orderNumber = "",
           double totalAmount = 0.0, const std::string& status = "PENDING")
         : Entity(id), customerId_(customerId), orderNumber_(orderNumber),
           totalAmount_(totalAmount), status_(status) {}
     
     int getCustomerId() const { return customerId_; }
-    void setCustomerId(int id) { customerId_ = id; }
+    void setCustomerId(int id) {
+        if (id != customerId_) { customerId_ = id; markDirty(CustomerIdField); }
+    }
     
     std::string getOrderNumber() const { return orderNumber_; }
-    void setOrderNumber(const std::string& number) { orderNumber_ = number; }
+    void setOrderNumber(const std::string& number) {
+        if (number != orderNumber_) { orderNumber_ = number; markDirty(OrderNumberField); }
+    }
     
     double getTotalAmount() const { return totalAmount_; }
-    void setTotalAmount(double amount) { totalAmount_ = amount; }
+    void setTotalAmount(double amount) {
+        if (amount != totalAmount_) { totalAmount_ = amount; markDirty(TotalAmountField); }
+    }
     
     std::string getStatus() const { return status_; }
-    void setStatus(const std::string& status) { status_ = status; }
+    void setStatus(const std::string& status) {
+        if (status != status_) { status_ = status; markDirty(StatusField); }
+    }
+    
+    void copyFields(const Order& other, uint32_t fields) {
+        if (fields & CustomerIdField) customerId_ = other.customerId_;
+        if (fields & OrderNumberField) orderNumber_ = other.orderNumber_;
+        if (fields & TotalAmountField) totalAmount_ = other.totalAmount_;
+        if (fields & StatusField) status_ = other.status_;
+    }
     
     std::string toString() const override {
         return "Order{id=" + std::to_string(id_) + 
@@ -113,34 +173,20 @@ public:
     virtual void insert(const T& entity) = 0;
     virtual void update(const T& entity) = 0;
     virtual void remove(int id) = 0;
-};
-
-// Identity Map to prevent duplicate objects
-template<typename T>
-class IdentityMap {
-private:
-    std::unordered_map<int, std::shared_ptr<T>> map_;
-    
-public:
-    void add(int id, std::shared_ptr<T> entity) {
-        map_[id] = entity;
-    }
     
-    std::shared_ptr<T> get(int id) {
-        auto it = map_.find(id);
-        return (it != map_.end()) ? it->second : nullptr;
-    }
-    
-    void remove(int id) {
-        map_.erase(id);
+    // Batched writes used by UnitOfWork::commit. Each entity's dirtyFields()
+    // says which fields an update changed. The defaults make one call per
+    // entity; stores that can do better override them.
+    virtual void insertBatch(const std::vector<T>& entities) {
+        for (const auto& entity : entities) insert(entity);
     }
     
-    void clear() {
-        map_.clear();
+    virtual void updateBatch(const std::vector<T>& entities) {
+        for (const auto& entity : entities) update(entity);
     }
     
-    bool contains(int id) const {
-        return map_.find(id) != map_.end();
+    virtual void removeBatch(const std::vector<int>& ids) {
+        for (int id : ids) remove(id);
     }
 };
 
@@ -155,17 +201,120 @@ enum class EntityState {
 template<typename T>
 struct TrackedEntity {
     std::shared_ptr<T> entity;
-    std::shared_ptr<T> originalEntity;  // For optimistic concurrency
+    std::shared_ptr<T> originalEntity;  // Taken on first modification, for rollback
     EntityState state;
+    bool queued = false;                // Already on the unit of work's change list
     
     TrackedEntity() : state(EntityState::UNCHANGED) {}
     
     TrackedEntity(std::shared_ptr<T> e, EntityState s) 
-        : entity(e), state(s) {
-        if (s == EntityState::UNCHANGED || s == EntityState::MODIFIED) {
-            originalEntity = std::make_shared<T>(*e);
+        : entity(e), state(s) {}
+};
+
+// Identity Map to prevent duplicate objects. Open addressing with linear
+// probing: each entity's tracking record sits inline in one slot array, so
+// a lookup is a hash and a short scan of adjacent slots rather than a
+// pointer chase through hash nodes. Removed slots become tombstones until
+// the next rehash.
+template<typename T>
+class IdentityMap {
+private:
+    static constexpr int kEmpty = std::numeric_limits<int>::min();
+    static constexpr int kTombstone = kEmpty + 1;
+    
+    struct Slot {
+        int id = kEmpty;
+        TrackedEntity<T> tracked;
+    };
+    
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+    size_t used_ = 0;  // Live slots plus tombstones
+    
+    size_t home(int id) const {
+        // Fibonacci hashing spreads sequential ids across the table
+        return (static_cast<uint64_t>(static_cast<uint32_t>(id)) * 0x9E3779B97F4A7C15ull >> 32) &
+               (slots_.size() - 1);
+    }
+    
+    // Slot holding id, or the slot an insert of id should use
+    size_t probe(int id) const {
+        size_t i = home(id);
+        size_t reuse = slots_.size();
+        while (slots_[i].id != kEmpty) {
+            if (slots_[i].id == id) return i;
+            if (slots_[i].id == kTombstone && reuse == slots_.size()) reuse = i;
+            i = (i + 1) & (slots_.size() - 1);
         }
+        return reuse != slots_.size() ? reuse : i;
+    }
+    
+    void rehash(size_t capacity) {
+        std::vector<Slot> old = std::move(slots_);
+        slots_ = std::vector<Slot>(capacity);
+        size_ = used_ = 0;
+        for (auto& slot : old) {
+            if (slot.id != kEmpty && slot.id != kTombstone) insert(slot.id, std::move(slot.tracked));
+        }
+    }
+    
+public:
+    IdentityMap() : slots_(16) {}
+    
+    void reserve(size_t count) {
+        size_t capacity = slots_.size();
+        while (count * 10 > capacity * 7) capacity *= 2;
+        if (capacity != slots_.size()) rehash(capacity);
+    }
+    
+    TrackedEntity<T>& insert(int id, TrackedEntity<T> tracked) {
+        if ((used_ + 1) * 10 > slots_.size() * 7) {
+            // Grow when live entries dominate, otherwise just drop tombstones
+            rehash(size_ * 2 >= slots_.size() / 2 ? slots_.size() * 2 : slots_.size());
+        }
+        size_t i = probe(id);
+        if (slots_[i].id != id) {
+            if (slots_[i].id == kEmpty) ++used_;
+            slots_[i].id = id;
+            ++size_;
+        }
+        slots_[i].tracked = std::move(tracked);
+        return slots_[i].tracked;
+    }
+    
+    void add(int id, std::shared_ptr<T> entity) {
+        insert(id, TrackedEntity<T>(entity, EntityState::UNCHANGED));
     }
+    
+    TrackedEntity<T>* find(int id) {
+        size_t i = probe(id);
+        return slots_[i].id == id ? &slots_[i].tracked : nullptr;
+    }
+    
+    std::shared_ptr<T> get(int id) {
+        auto* tracked = find(id);
+        return tracked ? tracked->entity : nullptr;
+    }
+    
+    void remove(int id) {
+        size_t i = probe(id);
+        if (slots_[i].id == id) {
+            slots_[i].id = kTombstone;
+            slots_[i].tracked = TrackedEntity<T>();
+            --size_;
+        }
+    }
+    
+    void clear() {
+        slots_.assign(16, Slot());
+        size_ = used_ = 0;
+    }
+    
+    bool contains(int id) const {
+        return slots_[probe(id)].id == id;
+    }
+    
+    size_t size() const { return size_; }
 };
 
 // Unit of Work interface
@@ -206,18 +355,33 @@ class TrackingCustomerRepository : public IRepository<Customer> {
 
 // Unit of Work implementation
 class UnitOfWork : public IUnitOfWork {
+public:
+    struct CommitStats {
+        size_t inserted = 0;
+        size_t updated = 0;
+        size_t deleted = 0;
+        size_t skipped = 0;       // On the change list but with no dirty field
+        size_t batchCalls = 0;
+    };
+    
 private:
     // Repositories
+    std::shared_ptr<IRepository<Customer>> customerStore_;  // Where commit writes
     std::shared_ptr<IRepository<Customer>> customerRepo_;
     std::shared_ptr<IRepository<Order>> orderRepo_;
     
-    // Identity maps
+    // Identity maps, holding each loaded entity's tracking record
     IdentityMap<Customer> customerIdentityMap_;
     IdentityMap<Order> orderIdentityMap_;
     
-    // Change tracking
-    std::unordered_map<int, TrackedEntity<Customer>> trackedCustomers_;
-    std::unordered_map<int, TrackedEntity<Order>> trackedOrders_;
+    // Change tracking: ids whose state left UNCHANGED, in order, so commit
+    // and rollback never visit entities that were only read
+    std::vector<int> changedCustomers_;
+    std::vector<std::shared_ptr<Customer>> newCustomers_;  // Inserts without an id yet
+    
+    size_t batchSize_ = 1000;
+    bool verbose_ = true;
+    CommitStats lastCommit_;
     
     // Transaction state
     bool inTransaction_ = false;
@@ -225,37 +389,79 @@ private:
     // Make TrackingCustomerRepository a friend
     friend class TrackingCustomerRepository;
     
+    void markChanged(int id, TrackedEntity<Customer>& tracked) {
+        if (!tracked.queued) {
+            tracked.queued = true;
+            changedCustomers_.push_back(id);
+        }
+    }
+    
+    // Hands entities to a repository batch call batchSize_ at a time
+    template<typename Item, typename Write>
+    void flush(const std::vector<Item>& items, Write write) {
+        for (size_t first = 0; first < items.size(); first += batchSize_) {
+            size_t last = std::min(items.size(), first + batchSize_);
+            write(std::vector<Item>(items.begin() + first, items.begin() + last));
+            lastCommit_.batchCalls++;
+        }
+    }
+    
 public:
     UnitOfWork(std::shared_ptr<IRepository<Customer>> customerRepo,
               std::shared_ptr<IRepository<Order>> orderRepo)
-        : customerRepo_(std::make_shared<TrackingCustomerRepository>(this, customerRepo)),
+        : customerStore_(customerRepo),
+          customerRepo_(std::make_shared<TrackingCustomerRepository>(this, customerRepo)),
           orderRepo_(orderRepo) {}
     
+    void setBatchSize(size_t batchSize) { batchSize_ = std::max<size_t>(batchSize, 1); }
+    void setVerbose(bool verbose) { verbose_ = verbose; }
+    
+    // Sizes the identity map for a known number of loads
+    void reserveCustomers(size_t count) { customerIdentityMap_.reserve(count); }
+    
+    size_t trackedCustomers() const { return customerIdentityMap_.size(); }
+    const CommitStats& lastCommit() const { return lastCommit_; }
+    
     void commit() override {
-        std::cout << "\n=== Committing Unit of Work ===\n";
+        if (verbose_) std::cout << "\n=== Committing Unit of Work ===\n";
         inTransaction_ = true;
+        lastCommit_ = CommitStats();
         
         try {
-            // Process customers
-            for (const auto& [id, tracked] : trackedCustomers_) {
-                switch (tracked.state) {
+            // Group the change list into inserts, updates and deletes
+            std::vector<Customer> inserts, updates;
+            std::vector<int> deletes;
+            for (const auto& entity : newCustomers_) {
+                inserts.push_back(*entity);
+            }
+            for (int id : changedCustomers_) {
+                auto* tracked = customerIdentityMap_.find(id);
+                // Skip ids added and removed again, and second entries for
+                // an id that was removed and re-added after being queued
+                if (!tracked || !tracked->queued) continue;
+                tracked->queued = false;
+                
+                switch (tracked->state) {
                     case EntityState::ADDED:
-                        std::cout << "INSERT: " << tracked.entity->toString() << "\n";
-                        // In real implementation, would call actual repo
+                        inserts.push_back(*tracked->entity);
                         break;
                         
                     case EntityState::MODIFIED:
                         // Check for optimistic concurrency
-                        if (tracked.originalEntity && 
-                            tracked.originalEntity->getVersion() != tracked.entity->getVersion()) {
+                        if (tracked->originalEntity && 
+                            tracked->originalEntity->getVersion() != tracked->entity->getVersion()) {
                             throw std::runtime_error("Concurrency conflict detected!");
                         }
-                        tracked.entity->incrementVersion();
-                        std::cout << "UPDATE: " << tracked.entity->toString() << "\n";
+                        if (tracked->entity->dirtyFields() == 0) {
+                            lastCommit_.skipped++;
+                            break;
+                        }
+                        tracked->entity->incrementVersion();
+                        updates.push_back(*tracked->entity);
                         break;
                         
                     case EntityState::DELETED:
-                        std::cout << "DELETE: Customer with ID " << id << "\n";
+                        deletes.push_back(id);
                         break;
                         
                     case EntityState::UNCHANGED:
@@ -264,9 +470,29 @@ public:
                 }
             }
             
+            if (verbose_) {
+                for (const auto& entity : inserts) {
+                    std::cout << "INSERT: " << entity.toString() << "\n";
+                }
+                for (const auto& entity : updates) {
+                    std::cout << "UPDATE [" << Customer::fieldNames(entity.dirtyFields()) << "]: "
+                              << entity.toString() << "\n";
+                }
+                for (int id : deletes) {
+                    std::cout << "DELETE: Customer with ID " << id << "\n";
+                }
+            }
+            
+            flush(inserts, [this](const std::vector<Customer>& batch) { customerStore_->insertBatch(batch); });
+            flush(updates, [this](const std::vector<Customer>& batch) { customerStore_->updateBatch(batch); });
+            flush(deletes, [this](const std::vector<int>& batch) { customerStore_->removeBatch(batch); });
+            lastCommit_.inserted = inserts.size();
+            lastCommit_.updated = updates.size();
+            lastCommit_.deleted = deletes.size();
+            
             // Clear tracking after successful commit
             clear();
-            std::cout << "Commit successful!\n";
+            if (verbose_) std::cout << "Commit successful!\n";
             
         } catch (const std::exception& e) {
             std::cout << "Commit failed: " << e.what() << "\n";
@@ -278,18 +504,19 @@ public:
     }
     
     void rollback() override {
-        std::cout << "\n=== Rolling back Unit of Work ===\n";
+        if (verbose_) std::cout << "\n=== Rolling back Unit of Work ===\n";
         
         // Restore original values for modified entities
-        for (auto& [id, tracked] : trackedCustomers_) {
-            if (tracked.state == EntityState::MODIFIED && tracked.originalEntity) {
-                *tracked.entity = *tracked.originalEntity;
+        for (int id : changedCustomers_) {
+            auto* tracked = customerIdentityMap_.find(id);
+            if (tracked && tracked->state == EntityState::MODIFIED && tracked->originalEntity) {
+                *tracked->entity = *tracked->originalEntity;
             }
         }
         
         // Clear all tracking
         clear();
-        std::cout << "Rollback complete!\n";
+        if (verbose_) std::cout << "Rollback complete!\n";
     }
     
     std::shared_ptr<IRepository<Customer>> customers() override {
@@ -302,8 +529,8 @@ public:
     
 private:
     void clear() {
-        trackedCustomers_.clear();
-        trackedOrders_.clear();
+        changedCustomers_.clear();
+        newCustomers_.clear();
         customerIdentityMap_.clear();
         orderIdentityMap_.clear();
     }
@@ -312,18 +539,19 @@ private:
 // Implementation of TrackingCustomerRepository methods
 std::optional<Customer> TrackingCustomerRepository::findById(int id) {
     // Check identity map first
-    auto cached = uow_->customerIdentityMap_.get(id);
-    if (cached) {
-        return *cached;
+    if (auto* tracked = uow_->customerIdentityMap_.find(id)) {
+        if (tracked->state == EntityState::DELETED) {
+            return std::nullopt;
+        }
+        return *tracked->entity;
     }
     
     // Load from repository
     auto result = innerRepo_->findById(id);
     if (result.has_value()) {
         auto entity = std::make_shared<Customer>(result.value());
+        entity->clearDirty();
         uow_->customerIdentityMap_.add(id, entity);
-        uow_->trackedCustomers_[id] = TrackedEntity<Customer>(
-            entity, EntityState::UNCHANGED);
         return *entity;
     }
     
@@ -336,46 +564,60 @@ std::vector<Customer> TrackingCustomerRepository::findAll() {
 
 void TrackingCustomerRepository::insert(const Customer& entity) {
     auto tracked = std::make_shared<Customer>(entity);
-    if (tracked->getId() != 0) {
-        uow_->customerIdentityMap_.add(tracked->getId(), tracked);
-    }
-    uow_->trackedCustomers_[tracked->getId()] = TrackedEntity<Customer>(
-        tracked, EntityState::ADDED);
+    if (tracked->getId() == 0) {
+        // The store assigns the id at commit
+        uow_->newCustomers_.push_back(tracked);
+        return;
+    }
+    auto& record = uow_->customerIdentityMap_.insert(
+        tracked->getId(), TrackedEntity<Customer>(tracked, EntityState::ADDED));
+    uow_->markChanged(tracked->getId(), record);
 }
 
 void TrackingCustomerRepository::update(const Customer& entity) {
     auto id = entity.getId();
-    auto existing = uow_->customerIdentityMap_.get(id);
+    auto* tracked = uow_->customerIdentityMap_.find(id);
     
-    if (existing) {
-        // Update existing tracked entity
-        *existing = entity;
-        
-        auto& tracked = uow_->trackedCustomers_[id];
-        if (tracked.state == EntityState::UNCHANGED) {
-            tracked.state = EntityState::MODIFIED;
+    if (tracked && tracked->entity && tracked->state != EntityState::DELETED) {
+        // Snapshot before the first change so rollback can restore it
+        if (tracked->state == EntityState::UNCHANGED) {
+            tracked->originalEntity = std::make_shared<Customer>(*tracked->entity);
+            tracked->state = EntityState::MODIFIED;
         }
+        // The caller's copy carries the dirty bits its setters set
+        *tracked->entity = entity;
+        uow_->markChanged(id, *tracked);
     } else {
-        // Not tracked yet, add to tracking
-        auto tracked = std::make_shared<Customer>(entity);
-        uow_->customerIdentityMap_.add(id, tracked);
-        uow_->trackedCustomers_[id] = TrackedEntity<Customer>(
-            tracked, EntityState::MODIFIED);
+        // Not tracked yet, or only queued for deletion (possibly without a
+        // loaded entity): nothing to diff against, so write every field
+        auto fresh = std::make_shared<Customer>(entity);
+        fresh->markDirty(Customer::AllFields);
+        TrackedEntity<Customer> record(fresh, EntityState::MODIFIED);
+        record.originalEntity = std::make_shared<Customer>(entity);
+        if (tracked) {
+            record.queued = tracked->queued;
+            *tracked = std::move(record);
+        } else {
+            tracked = &uow_->customerIdentityMap_.insert(id, std::move(record));
+        }
+        uow_->markChanged(id, *tracked);
     }
 }
 
 void TrackingCustomerRepository::remove(int id) {
-    auto it = uow_->trackedCustomers_.find(id);
-    if (it != uow_->trackedCustomers_.end()) {
-        if (it->second.state == EntityState::ADDED) {
-            // If it was added in this UoW, just remove from tracking
-            uow_->trackedCustomers_.erase(it);
-            uow_->customerIdentityMap_.remove(id);
-        } else {
-            // Mark for deletion
-            it->second.state = EntityState::DELETED;
-        }
-    }
+    auto* tracked = uow_->customerIdentityMap_.find(id);
+    if (tracked && tracked->state == EntityState::ADDED) {
+        // If it was added in this UoW, just remove from tracking
+        uow_->customerIdentityMap_.remove(id);
+        return;
+    }
+    if (!tracked) {
+        // Deleting needs no load; track the id alone
+        tracked = &uow_->customerIdentityMap_.insert(id, TrackedEntity<Customer>());
+    }
+    // Mark for deletion
+    tracked->state = EntityState::DELETED;
+    uow_->markChanged(id, *tracked);
 }
 
 // In-memory repository implementations for testing
@@ -383,6 +625,17 @@ class InMemoryCustomerRepository : public IRepository<Customer> {
 private:
     std::unordered_map<int, Customer> data_;
     int nextId_ = 1;
+    size_t writeCalls_ = 0;
+    
+    void store(Customer entity) {
+        if (entity.getId() == 0) {
+            entity.setId(nextId_++);
+        } else {
+            nextId_ = std::max(nextId_, entity.getId() + 1);
+        }
+        entity.clearDirty();
+        data_[entity.getId()] = entity;
+    }
     
 public:
     std::optional<Customer> findById(int id) override {
@@ -399,21 +652,49 @@ public:
     }
     
     void insert(const Customer& entity) override {
-        Customer newEntity = entity;
-        if (newEntity.getId() == 0) {
-            newEntity.setId(nextId_++);
-        }
-        data_[newEntity.getId()] = newEntity;
+        writeCalls_++;
+        store(entity);
     }
     
     void update(const Customer& entity) override {
+        writeCalls_++;
         data_[entity.getId()] = entity;
+        data_[entity.getId()].clearDirty();
     }
     
     void remove(int id) override {
+        writeCalls_++;
         data_.erase(id);
     }
     
+    void insertBatch(const std::vector<Customer>& entities) override {
+        writeCalls_++;
+        data_.reserve(data_.size() + entities.size());
+        for (const auto& entity : entities) store(entity);
+    }
+    
+    // Writes only the dirty fields of each entity over the stored row
+    void updateBatch(const std::vector<Customer>& entities) override {
+        writeCalls_++;
+        for (const auto& entity : entities) {
+            auto it = data_.find(entity.getId());
+            if (it == data_.end()) {
+                store(entity);
+                continue;
+            }
+            it->second.copyFields(entity, entity.dirtyFields());
+            it->second.incrementVersion();
+        }
+    }
+    
+    void removeBatch(const std::vector<int>& ids) override {
+        writeCalls_++;
+        for (int id : ids) data_.erase(id);
+    }
+    
+    size_t size() const { return data_.size(); }
+    size_t writeCalls() const { return writeCalls_; }
+    
     // Helper method to populate test data
     void seedData() {
         insert(Customer(1, "John Doe", "john@example.com", 5000.0));
@@ -422,6 +703,22 @@ public:
     }
 };
 
+// Same store without batch support: every change is its own repository call
+class RowAtATimeCustomerRepository : public InMemoryCustomerRepository {
+public:
+    void insertBatch(const std::vector<Customer>& entities) override {
+        IRepository<Customer>::insertBatch(entities);
+    }
+    
+    void updateBatch(const std::vector<Customer>& entities) override {
+        IRepository<Customer>::updateBatch(entities);
+    }
+    
+    void removeBatch(const std::vector<int>& ids) override {
+        IRepository<Customer>::removeBatch(ids);
+    }
+};
+
 // Service layer using Unit of Work
 class CustomerService {
 private:
@@ -550,12 +847,75 @@ void demonstrateRollback() {
     }
 }
 
+// An import-sized transaction: load 500k customers, touch a few percent
+void demonstrateBulkImport() {
+    std::cout << "\n=== Bulk Import Demo ===\n";
+    const int loaded = 500000;
+    
+    auto runImport = [&](std::shared_ptr<InMemoryCustomerRepository> store, const char* label) {
+        std::vector<Customer> seed;
+        seed.reserve(loaded);
+        for (int id = 1; id <= loaded; ++id) {
+            seed.emplace_back(id, "Customer " + std::to_string(id),
+                              "c" + std::to_string(id) + "@example.com", 1000.0 + id % 100);
+        }
+        store->insertBatch(seed);
+        size_t callsBefore = store->writeCalls();
+        
+        UnitOfWork uow(store, std::shared_ptr<IRepository<Order>>());
+        uow.setVerbose(false);
+        uow.reserveCustomers(loaded);
+        auto repo = uow.customers();
+        
+        auto start = std::chrono::steady_clock::now();
+        for (int id = 1; id <= loaded; ++id) {
+            repo->findById(id);
+        }
+        auto loadedAt = std::chrono::steady_clock::now();
+        
+        for (int id = 1; id <= loaded; id += 20) {      // 5%: raise the credit limit
+            auto customer = repo->findById(id);
+            customer->setCreditLimit(customer->getCreditLimit() + 500.0);
+            repo->update(*customer);
+        }
+        for (int id = 11; id <= loaded; id += 100) {    // 1%: re-save unchanged
+            repo->update(*repo->findById(id));
+        }
+        for (int id = 7; id <= loaded; id += 100) {     // 1%: delete
+            repo->remove(id);
+        }
+        for (int i = 0; i < 10000; ++i) {               // 2%: new customers
+            repo->insert(Customer(0, "Imported " + std::to_string(i),
+                                  "import" + std::to_string(i) + "@example.com", 2500.0));
+        }
+        auto commitStart = std::chrono::steady_clock::now();
+        size_t tracked = uow.trackedCustomers();
+        uow.commit();
+        auto end = std::chrono::steady_clock::now();
+        
+        const auto& stats = uow.lastCommit();
+        auto ms = [](auto d) { return std::chrono::duration<double, std::milli>(d).count(); };
+        std::cout << label << ": " << tracked << " tracked, " << stats.inserted << " inserts, "
+                  << stats.updated << " updates, " << stats.deleted << " deletes, "
+                  << stats.skipped << " unchanged skipped\n"
+                  << "  load " << ms(loadedAt - start) << " ms, commit " << ms(end - commitStart)
+                  << " ms, " << store->writeCalls() - callsBefore << " repository write calls\n";
+        
+        auto sample = store->findById(21);
+        std::cout << "  customer 21 after commit: " << sample->toString() << "\n";
+    };
+    
+    runImport(std::make_shared<InMemoryCustomerRepository>(), "Batched store");
+    runImport(std::make_shared<RowAtATimeCustomerRepository>(), "Row-at-a-time store");
+}
+
 int main() {
     std::cout << "=== Unit of Work Pattern Demo ===\n\n";
     
     demonstrateBasicUnitOfWork();
     demonstrateIdentityMap();
     demonstrateRollback();
+    demonstrateBulkImport();
     
     // Service layer example
     std::cout << "\n=== Service Layer with Unit of Work ===\n";
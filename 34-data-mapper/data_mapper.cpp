@@ -2,8 +2,13 @@
 #include <iostream>
 #include <memory>
 #include <vector>
+#include <deque>
+#include <algorithm>
+#include <cstdint>
 #include <unordered_map>
 #include <optional>
+#include <string_view>
+#include <chrono>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
@@ -33,18 +38,26 @@ namespace Domain {
             return street_ + ", " + city_ + ", " + zipCode_ + ", " + country_;
         }
         
-        // Getters/Setters
-        std::string getStreet() const { return street_; }
-        void setStreet(const std::string& street) { street_ = street; }
+        // Getters return views into this object; setters reuse existing capacity
+        std::string_view getStreet() const { return street_; }
+        void setStreet(std::string_view street) { street_.assign(street); }
+        
+        std::string_view getCity() const { return city_; }
+        void setCity(std::string_view city) { city_.assign(city); }
         
-        std::string getCity() const { return city_; }
-        void setCity(const std::string& city) { city_ = city; }
+        std::string_view getZipCode() const { return zipCode_; }
+        void setZipCode(std::string_view zipCode) { zipCode_.assign(zipCode); }
         
-        std::string getZipCode() const { return zipCode_; }
-        void setZipCode(const std::string& zipCode) { zipCode_ = zipCode; }
+        std::string_view getCountry() const { return country_; }
+        void setCountry(std::string_view country) { country_.assign(country); }
         
-        std::string getCountry() const { return country_; }
-        void setCountry(const std::string& country) { country_ = country; }
+        void assign(std::string_view street, std::string_view city,
+                    std::string_view zipCode, std::string_view country) {
+            street_.assign(street);
+            city_.assign(city);
+            zipCode_.assign(zipCode);
+            country_.assign(country);
+        }
     };
     
     class Customer {
@@ -86,20 +99,22 @@ namespace Domain {
         int getId() const { return id_; }
         void setId(int id) { id_ = id; }
         
-        std::string getFirstName() const { return firstName_; }
-        void setFirstName(const std::string& name) { firstName_ = name; }
+        std::string_view getFirstName() const { return firstName_; }
+        void setFirstName(std::string_view name) { firstName_.assign(name); }
         
-        std::string getLastName() const { return lastName_; }
-        void setLastName(const std::string& name) { lastName_ = name; }
+        std::string_view getLastName() const { return lastName_; }
+        void setLastName(std::string_view name) { lastName_.assign(name); }
         
-        std::string getEmail() const { return email_; }
-        void setEmail(const std::string& email) { email_ = email; }
+        std::string_view getEmail() const { return email_; }
+        void setEmail(std::string_view email) { email_.assign(email); }
         
         const Address& getShippingAddress() const { return shippingAddress_; }
         void setShippingAddress(const Address& address) { shippingAddress_ = address; }
+        Address& shippingAddress() { return shippingAddress_; }
         
         const Address& getBillingAddress() const { return billingAddress_; }
         void setBillingAddress(const Address& address) { billingAddress_ = address; }
+        Address& billingAddress() { return billingAddress_; }
         
         double getTotalPurchases() const { return totalPurchases_; }
         void setTotalPurchases(double amount) { totalPurchases_ = amount; }
@@ -146,14 +161,14 @@ namespace Domain {
         int getId() const { return id_; }
         void setId(int id) { id_ = id; }
         
-        std::string getSku() const { return sku_; }
-        void setSku(const std::string& sku) { sku_ = sku; }
+        std::string_view getSku() const { return sku_; }
+        void setSku(std::string_view sku) { sku_.assign(sku); }
         
-        std::string getName() const { return name_; }
-        void setName(const std::string& name) { name_ = name; }
+        std::string_view getName() const { return name_; }
+        void setName(std::string_view name) { name_.assign(name); }
         
-        std::string getDescription() const { return description_; }
-        void setDescription(const std::string& desc) { description_ = desc; }
+        std::string_view getDescription() const { return description_; }
+        void setDescription(std::string_view desc) { description_.assign(desc); }
         
         double getPrice() const { return price_; }
         void setPrice(double price) { price_ = price; }
@@ -161,8 +176,8 @@ namespace Domain {
         int getStockQuantity() const { return stockQuantity_; }
         void setStockQuantity(int quantity) { stockQuantity_ = quantity; }
         
-        std::string getCategory() const { return category_; }
-        void setCategory(const std::string& category) { category_ = category; }
+        std::string_view getCategory() const { return category_; }
+        void setCategory(std::string_view category) { category_.assign(category); }
     };
 }
 
@@ -194,6 +209,201 @@ namespace Data {
         int stock_quantity;
         std::string category;
     };
+    
+    // Each distinct string is stored once and referred to by a 32-bit id.
+    // Strings live in a deque, so views handed out stay valid as the pool grows.
+    class StringPool {
+    private:
+        std::deque<std::string> strings_;
+        std::unordered_map<std::string_view, uint32_t> ids_;
+        
+    public:
+        uint32_t intern(std::string_view text) {
+            auto it = ids_.find(text);
+            if (it != ids_.end()) {
+                return it->second;
+            }
+            uint32_t id = static_cast<uint32_t>(strings_.size());
+            strings_.emplace_back(text);
+            ids_.emplace(strings_.back(), id);
+            return id;
+        }
+        
+        // Id of an already interned string, without adding it
+        std::optional<uint32_t> lookup(std::string_view text) const {
+            auto it = ids_.find(text);
+            if (it == ids_.end()) {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+        
+        std::string_view view(uint32_t id) const { return strings_[id]; }
+        size_t size() const { return strings_.size(); }
+    };
+    
+    // Column-per-field customer table. String columns hold pool ids, so scans
+    // over flags and amounts touch only those columns.
+    struct CustomerTable {
+        StringPool strings;
+        std::vector<int> id;
+        std::vector<uint32_t> firstName, lastName, email;
+        std::vector<uint32_t> shippingStreet, shippingCity, shippingZip, shippingCountry;
+        std::vector<uint32_t> billingStreet, billingCity, billingZip, billingCountry;
+        std::vector<double> totalPurchases;
+        std::vector<uint8_t> isVip;
+        std::unordered_map<int, size_t> rowOf;
+        
+        size_t size() const { return id.size(); }
+        std::string_view text(uint32_t ref) const { return strings.view(ref); }
+        
+        std::optional<size_t> find(int key) const {
+            auto it = rowOf.find(key);
+            if (it == rowOf.end()) {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+        
+        void reserve(size_t rows) {
+            for (auto* column : {&firstName, &lastName, &email, &shippingStreet, &shippingCity,
+                                 &shippingZip, &shippingCountry, &billingStreet, &billingCity,
+                                 &billingZip, &billingCountry}) {
+                column->reserve(rows);
+            }
+            id.reserve(rows);
+            totalPurchases.reserve(rows);
+            isVip.reserve(rows);
+            rowOf.reserve(rows);
+        }
+        
+        // Insert or overwrite the row for record.id
+        void store(const CustomerRecord& record) {
+            auto existing = find(record.id);
+            size_t row = existing ? *existing : size();
+            if (!existing) {
+                rowOf.emplace(record.id, row);
+                id.push_back(record.id);
+                for (auto* column : {&firstName, &lastName, &email, &shippingStreet, &shippingCity,
+                                     &shippingZip, &shippingCountry, &billingStreet, &billingCity,
+                                     &billingZip, &billingCountry}) {
+                    column->push_back(0);
+                }
+                totalPurchases.push_back(0);
+                isVip.push_back(0);
+            }
+            firstName[row] = strings.intern(record.first_name);
+            lastName[row] = strings.intern(record.last_name);
+            email[row] = strings.intern(record.email);
+            shippingStreet[row] = strings.intern(record.shipping_street);
+            shippingCity[row] = strings.intern(record.shipping_city);
+            shippingZip[row] = strings.intern(record.shipping_zip);
+            shippingCountry[row] = strings.intern(record.shipping_country);
+            billingStreet[row] = strings.intern(record.billing_street);
+            billingCity[row] = strings.intern(record.billing_city);
+            billingZip[row] = strings.intern(record.billing_zip);
+            billingCountry[row] = strings.intern(record.billing_country);
+            totalPurchases[row] = record.total_purchases;
+            isVip[row] = record.is_vip;
+        }
+        
+        // Swap-with-last removal; row order is not preserved
+        void erase(int key) {
+            auto existing = find(key);
+            if (!existing) {
+                return;
+            }
+            size_t row = *existing, last = size() - 1;
+            auto move = [&](auto& column) {
+                column[row] = column[last];
+                column.pop_back();
+            };
+            move(id);
+            for (auto* column : {&firstName, &lastName, &email, &shippingStreet, &shippingCity,
+                                 &shippingZip, &shippingCountry, &billingStreet, &billingCity,
+                                 &billingZip, &billingCountry}) {
+                move(*column);
+            }
+            move(totalPurchases);
+            move(isVip);
+            rowOf.erase(key);
+            if (row != last) {
+                rowOf[id[row]] = row;
+            }
+        }
+    };
+    
+    struct ProductTable {
+        StringPool strings;
+        std::vector<int> id;
+        std::vector<uint32_t> sku, name, description, category;
+        std::vector<double> price;
+        std::vector<int> stockQuantity;
+        std::unordered_map<int, size_t> rowOf;
+        
+        size_t size() const { return id.size(); }
+        std::string_view text(uint32_t ref) const { return strings.view(ref); }
+        
+        std::optional<size_t> find(int key) const {
+            auto it = rowOf.find(key);
+            if (it == rowOf.end()) {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+        
+        void reserve(size_t rows) {
+            for (auto* column : {&sku, &name, &description, &category}) {
+                column->reserve(rows);
+            }
+            id.reserve(rows);
+            price.reserve(rows);
+            stockQuantity.reserve(rows);
+            rowOf.reserve(rows);
+        }
+        
+        void store(const ProductRecord& record) {
+            auto existing = find(record.id);
+            size_t row = existing ? *existing : size();
+            if (!existing) {
+                rowOf.emplace(record.id, row);
+                id.push_back(record.id);
+                for (auto* column : {&sku, &name, &description, &category}) {
+                    column->push_back(0);
+                }
+                price.push_back(0);
+                stockQuantity.push_back(0);
+            }
+            sku[row] = strings.intern(record.sku);
+            name[row] = strings.intern(record.name);
+            description[row] = strings.intern(record.description);
+            category[row] = strings.intern(record.category);
+            price[row] = record.price;
+            stockQuantity[row] = record.stock_quantity;
+        }
+        
+        void erase(int key) {
+            auto existing = find(key);
+            if (!existing) {
+                return;
+            }
+            size_t row = *existing, last = size() - 1;
+            auto move = [&](auto& column) {
+                column[row] = column[last];
+                column.pop_back();
+            };
+            move(id);
+            for (auto* column : {&sku, &name, &description, &category}) {
+                move(*column);
+            }
+            move(price);
+            move(stockQuantity);
+            rowOf.erase(key);
+            if (row != last) {
+                rowOf[id[row]] = row;
+            }
+        }
+    };
 }
 
 // Data Mapper interfaces
@@ -219,11 +429,29 @@ public:
 // Customer Data Mapper
 class CustomerDataMapper : public IDataMapper<Domain::Customer, Data::CustomerRecord> {
 private:
-    // Simulate database with in-memory storage
-    std::unordered_map<int, Data::CustomerRecord> database_;
+    // Simulate database with an in-memory columnar table
+    Data::CustomerTable table_;
+    std::vector<size_t> selection_;   // rows matched by the last query, reused
     int nextId_ = 1;
+    bool verbose_ = true;
+    
+    template<typename Predicate>
+    const std::vector<size_t>& select(Predicate matches) {
+        selection_.clear();
+        for (size_t row = 0; row < table_.size(); ++row) {
+            if (matches(row)) {
+                selection_.push_back(row);
+            }
+        }
+        return selection_;
+    }
     
 public:
+    void setVerbose(bool verbose) { verbose_ = verbose; }
+    void reserve(size_t rows) { table_.reserve(rows); }
+    size_t size() const { return table_.size(); }
+    size_t distinctStrings() const { return table_.strings.size(); }
+    
     Data::CustomerRecord toData(const Domain::Customer& customer) const override {
         Data::CustomerRecord record;
         record.id = customer.getId();
@@ -269,85 +497,148 @@ public:
         return customer;
     }
     
+    // Fill an existing customer from a table row. Assigning into strings the
+    // customer already owns reuses their buffers instead of allocating.
+    void toDomain(size_t row, Domain::Customer& customer) const {
+        const auto& t = table_;
+        customer.setId(t.id[row]);
+        customer.setFirstName(t.text(t.firstName[row]));
+        customer.setLastName(t.text(t.lastName[row]));
+        customer.setEmail(t.text(t.email[row]));
+        customer.shippingAddress().assign(t.text(t.shippingStreet[row]), t.text(t.shippingCity[row]),
+                                          t.text(t.shippingZip[row]), t.text(t.shippingCountry[row]));
+        customer.billingAddress().assign(t.text(t.billingStreet[row]), t.text(t.billingCity[row]),
+                                         t.text(t.billingZip[row]), t.text(t.billingCountry[row]));
+        customer.setTotalPurchases(t.totalPurchases[row]);
+        customer.setIsVip(t.isVip[row] != 0);
+    }
+    
+    // Batch mapping into a caller-owned vector; keep the vector between calls
+    // to map without allocating
+    void toDomain(const std::vector<size_t>& rows, std::vector<Domain::Customer>& out) const {
+        out.resize(rows.size());
+        for (size_t i = 0; i < rows.size(); ++i) {
+            toDomain(rows[i], out[i]);
+        }
+    }
+    
     std::optional<Domain::Customer> findById(int id) override {
-        std::cout << "SQL: SELECT * FROM customers WHERE id = " << id << "\n";
+        if (verbose_) std::cout << "SQL: SELECT * FROM customers WHERE id = " << id << "\n";
         
-        auto it = database_.find(id);
-        if (it != database_.end()) {
-            return toDomain(it->second);
+        auto row = table_.find(id);
+        if (row) {
+            Domain::Customer customer;
+            toDomain(*row, customer);
+            return customer;
         }
         return std::nullopt;
     }
     
     std::vector<Domain::Customer> findAll() override {
-        std::cout << "SQL: SELECT * FROM customers\n";
-        
         std::vector<Domain::Customer> result;
-        for (const auto& [id, record] : database_) {
-            result.push_back(toDomain(record));
-        }
+        findAll(result);
         return result;
     }
     
+    void findAll(std::vector<Domain::Customer>& out) {
+        if (verbose_) std::cout << "SQL: SELECT * FROM customers\n";
+        
+        out.resize(table_.size());
+        for (size_t row = 0; row < table_.size(); ++row) {
+            toDomain(row, out[row]);
+        }
+    }
+    
     void insert(Domain::Customer& entity) override {
         if (entity.getId() == 0) {
             entity.setId(nextId_++);
+        } else {
+            nextId_ = std::max(nextId_, entity.getId() + 1);
         }
         
         auto record = toData(entity);
-        database_[record.id] = record;
+        table_.store(record);
         
-        std::cout << "SQL: INSERT INTO customers (id, first_name, last_name, ...) "
-                  << "VALUES (" << record.id << ", '" << record.first_name 
-                  << "', '" << record.last_name << "', ...)\n";
+        if (verbose_) {
+            std::cout << "SQL: INSERT INTO customers (id, first_name, last_name, ...) "
+                      << "VALUES (" << record.id << ", '" << record.first_name 
+                      << "', '" << record.last_name << "', ...)\n";
+        }
     }
     
     void update(const Domain::Customer& entity) override {
         auto record = toData(entity);
-        database_[record.id] = record;
+        table_.store(record);
         
-        std::cout << "SQL: UPDATE customers SET first_name = '" << record.first_name
-                  << "', last_name = '" << record.last_name 
-                  << "', ... WHERE id = " << record.id << "\n";
+        if (verbose_) {
+            std::cout << "SQL: UPDATE customers SET first_name = '" << record.first_name
+                      << "', last_name = '" << record.last_name 
+                      << "', ... WHERE id = " << record.id << "\n";
+        }
     }
     
     void remove(int id) override {
-        database_.erase(id);
-        std::cout << "SQL: DELETE FROM customers WHERE id = " << id << "\n";
+        table_.erase(id);
+        if (verbose_) std::cout << "SQL: DELETE FROM customers WHERE id = " << id << "\n";
     }
     
     // Additional query methods
     std::optional<Domain::Customer> findByEmail(const std::string& email) {
-        std::cout << "SQL: SELECT * FROM customers WHERE email = '" << email << "'\n";
+        if (verbose_) std::cout << "SQL: SELECT * FROM customers WHERE email = '" << email << "'\n";
         
-        for (const auto& [id, record] : database_) {
-            if (record.email == email) {
-                return toDomain(record);
+        // A string never interned cannot match any row
+        auto ref = table_.strings.lookup(email);
+        if (!ref) {
+            return std::nullopt;
+        }
+        for (size_t row = 0; row < table_.size(); ++row) {
+            if (table_.email[row] == *ref) {
+                Domain::Customer customer;
+                toDomain(row, customer);
+                return customer;
             }
         }
         return std::nullopt;
     }
     
     std::vector<Domain::Customer> findVipCustomers() {
-        std::cout << "SQL: SELECT * FROM customers WHERE is_vip = true\n";
-        
         std::vector<Domain::Customer> result;
-        for (const auto& [id, record] : database_) {
-            if (record.is_vip) {
-                result.push_back(toDomain(record));
-            }
-        }
+        findVipCustomers(result);
         return result;
     }
+    
+    void findVipCustomers(std::vector<Domain::Customer>& out) {
+        if (verbose_) std::cout << "SQL: SELECT * FROM customers WHERE is_vip = true\n";
+        
+        toDomain(select([&](size_t row) { return table_.isVip[row] != 0; }), out);
+    }
 };
 
 // Product Data Mapper
 class ProductDataMapper : public IDataMapper<Domain::Product, Data::ProductRecord> {
 private:
-    std::unordered_map<int, Data::ProductRecord> database_;
+    Data::ProductTable table_;
+    std::vector<size_t> selection_;
     int nextId_ = 1;
+    bool verbose_ = true;
+    
+    template<typename Predicate>
+    const std::vector<size_t>& select(Predicate matches) {
+        selection_.clear();
+        for (size_t row = 0; row < table_.size(); ++row) {
+            if (matches(row)) {
+                selection_.push_back(row);
+            }
+        }
+        return selection_;
+    }
     
 public:
+    void setVerbose(bool verbose) { verbose_ = verbose; }
+    void reserve(size_t rows) { table_.reserve(rows); }
+    size_t size() const { return table_.size(); }
+    size_t distinctStrings() const { return table_.strings.size(); }
+    
     Data::ProductRecord toData(const Domain::Product& product) const override {
         Data::ProductRecord record;
         record.id = product.getId();
@@ -368,18 +659,39 @@ public:
         return product;
     }
     
+    void toDomain(size_t row, Domain::Product& product) const {
+        const auto& t = table_;
+        product.setId(t.id[row]);
+        product.setSku(t.text(t.sku[row]));
+        product.setName(t.text(t.name[row]));
+        product.setDescription(t.text(t.description[row]));
+        product.setPrice(t.price[row]);
+        product.setStockQuantity(t.stockQuantity[row]);
+        product.setCategory(t.text(t.category[row]));
+    }
+    
+    void toDomain(const std::vector<size_t>& rows, std::vector<Domain::Product>& out) const {
+        out.resize(rows.size());
+        for (size_t i = 0; i < rows.size(); ++i) {
+            toDomain(rows[i], out[i]);
+        }
+    }
+    
     std::optional<Domain::Product> findById(int id) override {
-        auto it = database_.find(id);
-        if (it != database_.end()) {
-            return toDomain(it->second);
+        auto row = table_.find(id);
+        if (row) {
+            Domain::Product product;
+            toDomain(*row, product);
+            return product;
         }
         return std::nullopt;
     }
     
     std::vector<Domain::Product> findAll() override {
         std::vector<Domain::Product> result;
-        for (const auto& [id, record] : database_) {
-            result.push_back(toDomain(record));
+        result.resize(table_.size());
+        for (size_t row = 0; row < table_.size(); ++row) {
+            toDomain(row, result[row]);
         }
         return result;
     }
@@ -387,55 +699,68 @@ public:
     void insert(Domain::Product& entity) override {
         if (entity.getId() == 0) {
             entity.setId(nextId_++);
+        } else {
+            nextId_ = std::max(nextId_, entity.getId() + 1);
         }
         
         auto record = toData(entity);
-        database_[record.id] = record;
+        table_.store(record);
         
-        std::cout << "SQL: INSERT INTO products (id, sku, name, price, ...) "
-                  << "VALUES (" << record.id << ", '" << record.sku 
-                  << "', '" << record.name << "', " << record.price << ", ...)\n";
+        if (verbose_) {
+            std::cout << "SQL: INSERT INTO products (id, sku, name, price, ...) "
+                      << "VALUES (" << record.id << ", '" << record.sku 
+                      << "', '" << record.name << "', " << record.price << ", ...)\n";
+        }
     }
     
     void update(const Domain::Product& entity) override {
         auto record = toData(entity);
-        database_[record.id] = record;
+        table_.store(record);
         
-        std::cout << "SQL: UPDATE products SET name = '" << record.name
-                  << "', price = " << record.price 
-                  << ", stock_quantity = " << record.stock_quantity
-                  << " WHERE id = " << record.id << "\n";
+        if (verbose_) {
+            std::cout << "SQL: UPDATE products SET name = '" << record.name
+                      << "', price = " << record.price 
+                      << ", stock_quantity = " << record.stock_quantity
+                      << " WHERE id = " << record.id << "\n";
+        }
     }
     
     void remove(int id) override {
-        database_.erase(id);
-        std::cout << "SQL: DELETE FROM products WHERE id = " << id << "\n";
+        table_.erase(id);
+        if (verbose_) std::cout << "SQL: DELETE FROM products WHERE id = " << id << "\n";
     }
     
-    // Custom query methods
+    // Custom query methods. Predicates run over columns; only matching rows
+    // are turned into domain objects.
     std::vector<Domain::Product> findByCategory(const std::string& category) {
-        std::cout << "SQL: SELECT * FROM products WHERE category = '" << category << "'\n";
-        
         std::vector<Domain::Product> result;
-        for (const auto& [id, record] : database_) {
-            if (record.category == category) {
-                result.push_back(toDomain(record));
-            }
-        }
+        findByCategory(category, result);
         return result;
     }
     
-    std::vector<Domain::Product> findInStock() {
-        std::cout << "SQL: SELECT * FROM products WHERE stock_quantity > 0\n";
+    void findByCategory(std::string_view category, std::vector<Domain::Product>& out) {
+        if (verbose_) std::cout << "SQL: SELECT * FROM products WHERE category = '" << category << "'\n";
         
-        std::vector<Domain::Product> result;
-        for (const auto& [id, record] : database_) {
-            if (record.stock_quantity > 0) {
-                result.push_back(toDomain(record));
-            }
+        auto ref = table_.strings.lookup(category);
+        if (!ref) {
+            out.clear();
+            return;
         }
+        uint32_t wanted = *ref;
+        toDomain(select([&](size_t row) { return table_.category[row] == wanted; }), out);
+    }
+    
+    std::vector<Domain::Product> findInStock() {
+        std::vector<Domain::Product> result;
+        findInStock(result);
         return result;
     }
+    
+    void findInStock(std::vector<Domain::Product>& out) {
+        if (verbose_) std::cout << "SQL: SELECT * FROM products WHERE stock_quantity > 0\n";
+        
+        toDomain(select([&](size_t row) { return table_.stockQuantity[row] > 0; }), out);
+    }
 };
 
 // Service layer using mappers
@@ -498,6 +823,82 @@ public:
     }
 };
 
+// Reporting over a large table: fresh result vectors vs reused ones
+void reportingScanExample() {
+    std::cout << "\n=== Reporting Scan ===\n";
+    const int customers = 500000, products = 200000;
+    const char* firstNames[] = {"John", "Jane", "Bob", "Alice", "Maria", "Wei", "Omar", "Priya"};
+    const char* lastNames[] = {"Doe", "Smith", "Johnson", "Garcia", "Chen", "Okafor", "Patel", "Novak"};
+    const char* cities[][3] = {{"New York", "10001", "USA"}, {"Los Angeles", "90001", "USA"},
+                               {"London", "SW1A 1AA", "UK"}, {"Toronto", "M5H 2N2", "Canada"},
+                               {"Berlin", "10115", "Germany"}};
+    const char* categories[] = {"Electronics", "Books", "Garden", "Kitchen", "Toys", "Sports"};
+    auto ms = [](auto d) { return std::chrono::duration<double, std::milli>(d).count(); };
+    
+    CustomerDataMapper customerMapper;
+    customerMapper.setVerbose(false);
+    customerMapper.reserve(customers);
+    for (int i = 0; i < customers; ++i) {
+        Domain::Customer customer(0, firstNames[i % 8], lastNames[i / 8 % 8],
+                                  "customer" + std::to_string(i) + "@example.com");
+        const auto* city = cities[i % 5];
+        Domain::Address address(std::to_string(i % 2000) + " Commonwealth Avenue", city[0], city[1], city[2]);
+        customer.setShippingAddress(address);
+        customer.setBillingAddress(address);
+        customer.recordPurchase((i % 97) * 150.0);
+        customerMapper.insert(customer);
+    }
+    
+    ProductDataMapper productMapper;
+    productMapper.setVerbose(false);
+    productMapper.reserve(products);
+    for (int i = 0; i < products; ++i) {
+        Domain::Product product(0, "SKU-" + std::to_string(i), "Catalogue item " + std::to_string(i % 5000),
+                                5.0 + i % 300, i % 4 == 0 ? 0 : i % 50);
+        product.setDescription("Standard catalogue description for range " + std::to_string(i % 40));
+        product.setCategory(categories[i % 6]);
+        productMapper.insert(product);
+    }
+    std::cout << customers << " customers (" << customerMapper.distinctStrings() << " distinct strings for "
+              << customers * 11 << " string fields), " << products << " products ("
+              << productMapper.distinctStrings() << " distinct strings)\n";
+    
+    // Each query runs three times: returning a new vector, then twice into a kept one
+    auto run = [&](const char* label, auto fresh, auto reused) {
+        auto start = std::chrono::steady_clock::now();
+        size_t rows = fresh();
+        auto afterFresh = std::chrono::steady_clock::now();
+        reused();
+        auto afterWarmup = std::chrono::steady_clock::now();
+        reused();
+        auto end = std::chrono::steady_clock::now();
+        std::cout << "  " << label << ": " << rows << " rows, new vector " << ms(afterFresh - start)
+                  << " ms, reused vector " << ms(afterWarmup - afterFresh) << " ms first / "
+                  << ms(end - afterWarmup) << " ms warm\n";
+    };
+    
+    std::vector<Domain::Customer> customerRows;
+    std::vector<Domain::Product> productRows;
+    run("findAll customers",
+        [&] { return customerMapper.findAll().size(); },
+        [&] { customerMapper.findAll(customerRows); });
+    run("findVipCustomers",
+        [&] { return customerMapper.findVipCustomers().size(); },
+        [&] { customerMapper.findVipCustomers(customerRows); });
+    run("findInStock",
+        [&] { return productMapper.findInStock().size(); },
+        [&] { productMapper.findInStock(productRows); });
+    run("findByCategory(Books)",
+        [&] { return productMapper.findByCategory("Books").size(); },
+        [&] { productMapper.findByCategory("Books", productRows); });
+    
+    if (!productRows.empty()) {
+        const auto& first = productRows.front();
+        std::cout << "  first Books row: " << first.getSku() << " '" << first.getName() << "' $"
+                  << first.getPrice() << "\n";
+    }
+}
+
 int main() {
     std::cout << "=== Data Mapper Pattern Demo ===\n\n";
     
@@ -570,5 +971,7 @@ int main() {
         std::cout << vip.getFullName() << " - " << vip.getEmail() << "\n";
     }
     
+    reportingScanExample();
+    
     return 0;
 }
\ No newline at end of file
@@ -7,6 +7,10 @@
 #include <stdexcept>
 #include <string>
 #include <vector>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <type_traits>
 
 // Forward declarations
 class ILogger;
@@ -58,19 +62,87 @@ public:
     virtual void logout(const std::string& username) = 0;
 };
 
+// Dense per-type index. Each type gets the next free slot the first time it
+// is asked for, so registries can be flat arrays instead of name-keyed maps.
+class TypeSlot {
+private:
+    static inline std::atomic<size_t> next_{0};
+    
+public:
+    template<typename T>
+    static size_t of() {
+        static const size_t slot = next_.fetch_add(1, std::memory_order_relaxed);
+        return slot;
+    }
+};
+
 // Service Locator
 class ServiceLocator {
 private:
+    struct Entry {
+        std::shared_ptr<void> service;
+        std::function<std::shared_ptr<void>()> factory;
+        std::string typeName;
+    };
+    
     // Static instance
     static std::unique_ptr<ServiceLocator> instance_;
     
-    // Service registry
-    std::unordered_map<std::string, std::shared_ptr<void>> services_;
-    std::unordered_map<std::string, std::function<std::shared_ptr<void>()>> factories_;
+    // Service registry indexed by TypeSlot. Until freeze() every access takes
+    // the mutex; afterwards the table is read-only and reads skip it.
+    std::vector<Entry> slots_;
+    mutable std::recursive_mutex mutex_;
+    std::atomic<bool> frozen_{false};
     
     // Constructor is private for singleton
     ServiceLocator() = default;
     
+    Entry& entry(size_t slot) {
+        if (slot >= slots_.size()) {
+            slots_.resize(slot + 1);
+        }
+        return slots_[slot];
+    }
+    
+    const Entry* findEntry(size_t slot) const {
+        if (slot >= slots_.size()) {
+            return nullptr;
+        }
+        const Entry& e = slots_[slot];
+        return (e.service || e.factory) ? &e : nullptr;
+    }
+    
+    void requireMutable(const char* operation) const {
+        if (frozen_.load(std::memory_order_acquire)) {
+            throw std::logic_error(std::string(operation) + " after ServiceLocator::freeze()");
+        }
+    }
+    
+    template<typename T>
+    std::shared_ptr<void> lookup() {
+        size_t slot = TypeSlot::of<T>();
+        
+        if (frozen_.load(std::memory_order_acquire)) {
+            const Entry* e = findEntry(slot);
+            if (!e) {
+                throw std::runtime_error(std::string("Service not found: ") + typeid(T).name());
+            }
+            return e->service;
+        }
+        
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        Entry* e = const_cast<Entry*>(findEntry(slot));
+        if (!e) {
+            throw std::runtime_error(std::string("Service not found: ") + typeid(T).name());
+        }
+        if (!e->service) {
+            // Create service using factory
+            e->service = e->factory();
+            std::cout << "Created service using factory: " << e->typeName << "\n";
+        }
+        return e->service;
+    }
+    
 public:
     // Delete copy constructor and assignment
     ServiceLocator(const ServiceLocator&) = delete;
@@ -87,72 +159,106 @@ public:
     // Register a service instance
     template<typename T>
     void registerService(std::shared_ptr<T> service) {
-        std::string typeName = typeid(T).name();
-        services_[typeName] = std::static_pointer_cast<void>(service);
-        std::cout << "Registered service: " << typeName << "\n";
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        requireMutable("registerService");
+        Entry& e = entry(TypeSlot::of<T>());
+        e.typeName = typeid(T).name();
+        e.service = std::static_pointer_cast<void>(service);
+        e.factory = nullptr;
+        std::cout << "Registered service: " << e.typeName << "\n";
     }
     
     // Register a service factory (lazy initialization)
     template<typename T>
     void registerFactory(std::function<std::shared_ptr<T>()> factory) {
-        std::string typeName = typeid(T).name();
-        factories_[typeName] = [factory]() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        requireMutable("registerFactory");
+        Entry& e = entry(TypeSlot::of<T>());
+        e.typeName = typeid(T).name();
+        e.service = nullptr;
+        e.factory = [factory]() {
             return std::static_pointer_cast<void>(factory());
         };
-        std::cout << "Registered factory for: " << typeName << "\n";
+        std::cout << "Registered factory for: " << e.typeName << "\n";
     }
     
     // Get a service
     template<typename T>
     std::shared_ptr<T> getService() {
-        std::string typeName = typeid(T).name();
-        
-        // Check if service already exists
-        auto it = services_.find(typeName);
-        if (it != services_.end()) {
-            return std::static_pointer_cast<T>(it->second);
+        return std::static_pointer_cast<T>(lookup<T>());
+    }
+    
+    // Borrow a service without touching its reference count. Only valid after
+    // freeze(), when the registry holds every service until the locator dies.
+    template<typename T>
+    T& getServiceRef() {
+        if (!frozen_.load(std::memory_order_acquire)) {
+            throw std::logic_error("getServiceRef requires a frozen ServiceLocator");
         }
-        
-        // Check if factory exists
-        auto factoryIt = factories_.find(typeName);
-        if (factoryIt != factories_.end()) {
-            // Create service using factory
-            auto service = factoryIt->second();
-            services_[typeName] = service;
-            std::cout << "Created service using factory: " << typeName << "\n";
-            return std::static_pointer_cast<T>(service);
+        const Entry* e = findEntry(TypeSlot::of<T>());
+        if (!e) {
+            throw std::runtime_error(std::string("Service not found: ") + typeid(T).name());
         }
-        
-        throw std::runtime_error("Service not found: " + typeName);
+        return *static_cast<T*>(e->service.get());
     }
     
+    // Run every pending factory and make the registry read-only. After this
+    // lookups are a bounds check and an array load, with no lock.
+    void freeze() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        if (frozen_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        for (auto& e : slots_) {
+            if (e.factory && !e.service) {
+                e.service = e.factory();
+                std::cout << "Created service using factory: " << e.typeName << "\n";
+            }
+        }
+        frozen_.store(true, std::memory_order_release);
+        std::cout << "Service registry frozen with " << getServiceCount() << " services\n";
+    }
+    
+    bool isFrozen() const { return frozen_.load(std::memory_order_acquire); }
+    
     // Check if service is registered
     template<typename T>
     bool hasService() const {
-        std::string typeName = typeid(T).name();
-        return services_.find(typeName) != services_.end() ||
-               factories_.find(typeName) != factories_.end();
+        if (frozen_.load(std::memory_order_acquire)) {
+            return findEntry(TypeSlot::of<T>()) != nullptr;
+        }
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return findEntry(TypeSlot::of<T>()) != nullptr;
     }
     
     // Remove a service
     template<typename T>
     void removeService() {
-        std::string typeName = typeid(T).name();
-        services_.erase(typeName);
-        factories_.erase(typeName);
-        std::cout << "Removed service: " << typeName << "\n";
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        requireMutable("removeService");
+        size_t slot = TypeSlot::of<T>();
+        if (slot < slots_.size()) {
+            slots_[slot] = Entry{};
+        }
+        std::cout << "Removed service: " << typeid(T).name() << "\n";
     }
     
     // Clear all services
     void clear() {
-        services_.clear();
-        factories_.clear();
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        requireMutable("clear");
+        slots_.clear();
         std::cout << "Cleared all services\n";
     }
     
     // Get service count
     size_t getServiceCount() const {
-        return services_.size() + factories_.size();
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        size_t count = 0;
+        for (size_t slot = 0; slot < slots_.size(); ++slot) {
+            count += findEntry(slot) != nullptr;
+        }
+        return count;
     }
 };
 
@@ -472,6 +578,64 @@ public:
     }
 };
 
+// Request handlers resolving a dozen services per call, through each lookup path
+void resolutionBenchmark(ServiceLocator& locator) {
+    std::cout << "\n=== Resolution Cost per Request ===\n";
+    const int requests = 200000;
+    size_t resolved = 0;
+    
+    // Name-keyed provider as the comparison point
+    ServiceProvider provider;
+    provider.addService<ILogger>(locator.getService<ILogger>());
+    provider.addService<IDatabase>(locator.getService<IDatabase>());
+    provider.addService<IEmailService>(locator.getService<IEmailService>());
+    provider.addService<IPaymentGateway>(locator.getService<IPaymentGateway>());
+    provider.addService<IAuthService>(locator.getService<IAuthService>());
+    
+    auto time = [&](const char* label, auto resolveAll) {
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < requests; ++r) {
+            resolveAll();
+        }
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "  " << label << ": " << ns / (requests * 12.0) << " ns per resolution\n";
+    };
+    
+    auto twelve = [&](auto get) {
+        for (int round = 0; round < 2; ++round) {
+            resolved += get(static_cast<ILogger*>(nullptr)) != nullptr;
+            resolved += get(static_cast<IDatabase*>(nullptr)) != nullptr;
+            resolved += get(static_cast<IEmailService*>(nullptr)) != nullptr;
+            resolved += get(static_cast<IPaymentGateway*>(nullptr)) != nullptr;
+            resolved += get(static_cast<IAuthService*>(nullptr)) != nullptr;
+        }
+        resolved += get(static_cast<ILogger*>(nullptr)) != nullptr;
+        resolved += get(static_cast<IDatabase*>(nullptr)) != nullptr;
+    };
+    
+    time("type-name map (ServiceProvider)", [&] {
+        twelve([&](auto* tag) { return provider.getService<std::remove_pointer_t<decltype(tag)>>().get(); });
+    });
+    time("slot table, locked", [&] {
+        twelve([&](auto* tag) { return locator.getService<std::remove_pointer_t<decltype(tag)>>().get(); });
+    });
+    
+    locator.freeze();
+    time("slot table, frozen", [&] {
+        twelve([&](auto* tag) { return locator.getService<std::remove_pointer_t<decltype(tag)>>().get(); });
+    });
+    time("slot table, frozen, by reference", [&] {
+        twelve([&](auto* tag) { return &locator.getServiceRef<std::remove_pointer_t<decltype(tag)>>(); });
+    });
+    std::cout << "  " << resolved << " resolutions in total\n";
+    
+    try {
+        locator.registerService<ILogger>(std::make_shared<ConsoleLogger>("[LATE]"));
+    } catch (const std::logic_error& e) {
+        std::cout << "Late registration rejected: " << e.what() << "\n";
+    }
+}
+
 int main() {
     std::cout << "=== Service Locator Pattern Demo ===\n\n";
     
@@ -540,6 +704,8 @@ int main() {
     auto newLogger = locator.getService<ILogger>();
     newLogger->log("Using new file logger");
     
+    resolutionBenchmark(locator);
+    
     // Anti-pattern warning
     std::cout << "\n=== Anti-Pattern Warning ===\n";
     std::cout << "Service Locator can be considered an anti-pattern because:\n";
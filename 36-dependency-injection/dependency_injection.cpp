@@ -5,7 +5,16 @@
 #include <unordered_map>
 #include <vector>
 #include <typeinfo>
-#include <any>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <condition_variable>
+#include <deque>
+#include <optional>
+#include <exception>
+#include <sstream>
+#include <iomanip>
 #include <string>
 
 // Service interfaces
@@ -71,17 +80,27 @@ public:
     }
 };
 
+// Discards messages; keeps benchmarks quiet
+class NullLogger : public ILogger {
+public:
+    void log(const std::string&) override {}
+};
+
 class MySQLDatabase : public IDatabase {
 private:
     std::string connectionString_;
+    std::chrono::milliseconds connectLatency_;   // simulated network handshake
     bool connected_ = false;
     
 public:
-    explicit MySQLDatabase(const std::string& connectionString) 
-        : connectionString_(connectionString) {}
+    explicit MySQLDatabase(const std::string& connectionString,
+                           std::chrono::milliseconds connectLatency = std::chrono::milliseconds(0)) 
+        : connectionString_(connectionString), connectLatency_(connectLatency) {}
     
     void connect() override {
-        std::cout << "Connecting to MySQL: " << connectionString_ << "\n";
+        // One write per line so connections opened in parallel do not interleave
+        std::cout << "Connecting to MySQL: " + connectionString_ + "\n";
+        std::this_thread::sleep_for(connectLatency_);
         connected_ = true;
     }
     
@@ -102,15 +121,18 @@ private:
     std::string host_;
     int port_;
     std::string database_;
+    std::chrono::milliseconds connectLatency_;
     bool connected_ = false;
     
 public:
-    PostgreSQLDatabase(const std::string& host, int port, const std::string& database)
-        : host_(host), port_(port), database_(database) {}
+    PostgreSQLDatabase(const std::string& host, int port, const std::string& database,
+                       std::chrono::milliseconds connectLatency = std::chrono::milliseconds(0))
+        : host_(host), port_(port), database_(database), connectLatency_(connectLatency) {}
     
     void connect() override {
-        std::cout << "Connecting to PostgreSQL: " << host_ << ":" << port_ 
-                  << "/" << database_ << "\n";
+        std::cout << "Connecting to PostgreSQL: " + host_ + ":" + std::to_string(port_) 
+                     + "/" + database_ + "\n";
+        std::this_thread::sleep_for(connectLatency_);
         connected_ = true;
     }
     
@@ -132,8 +154,12 @@ private:
     int port_;
     
 public:
-    SMTPEmailService(const std::string& server, int port) 
-        : server_(server), port_(port) {}
+    // setupLatency stands in for the TLS handshake and login done at startup
+    SMTPEmailService(const std::string& server, int port,
+                     std::chrono::milliseconds setupLatency = std::chrono::milliseconds(0)) 
+        : server_(server), port_(port) {
+        std::this_thread::sleep_for(setupLatency);
+    }
     
     void sendEmail(const std::string& to, const std::string& subject, 
                   const std::string& body) override {
@@ -337,49 +363,116 @@ public:
     }
 };
 
+// Trimmed copy of pattern 35's TypeSlot: a dense index per type, assigned on
+// first use, so containers can keep registrations in flat arrays
+class TypeSlot {
+private:
+    static inline std::atomic<size_t> next_{0};
+    
+public:
+    template<typename T>
+    static size_t of() {
+        static const size_t slot = next_.fetch_add(1, std::memory_order_relaxed);
+        return slot;
+    }
+};
+
+// Trimmed copy of pattern 50's Lazy<T>: builds the value on first get(),
+// exactly once, even when several threads ask at the same time
+template<typename T>
+class Lazy {
+private:
+    mutable std::optional<T> value_;
+    std::function<T()> factory_;
+    mutable std::mutex mutex_;
+    
+public:
+    explicit Lazy(std::function<T()> factory) : factory_(std::move(factory)) {}
+    
+    const T& get() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!value_) {
+            value_ = factory_();
+        }
+        return *value_;
+    }
+    
+    bool isInitialized() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return value_.has_value();
+    }
+};
+
 // Simple DI Container
 class DIContainer {
 private:
-    std::unordered_map<std::string, std::any> services_;
-    std::unordered_map<std::string, std::function<std::any()>> factories_;
+    struct Registration {
+        std::shared_ptr<void> service;
+        std::function<std::shared_ptr<void>()> factory;
+    };
+    
+    // Indexed by TypeSlot; locked until freeze(), read-only afterwards
+    std::vector<Registration> slots_;
+    std::recursive_mutex mutex_;
+    std::atomic<bool> frozen_{false};
+    
+    Registration& slot(size_t index) {
+        if (frozen_.load(std::memory_order_acquire)) {
+            throw std::logic_error("DIContainer is frozen");
+        }
+        if (index >= slots_.size()) {
+            slots_.resize(index + 1);
+        }
+        return slots_[index];
+    }
     
 public:
     // Register a singleton service
     template<typename T>
     void registerSingleton(std::shared_ptr<T> service) {
-        std::string typeName = typeid(T).name();
-        services_[typeName] = service;
-        std::cout << "Registered singleton: " << typeName << "\n";
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        slot(TypeSlot::of<T>()) = {std::static_pointer_cast<void>(service), nullptr};
+        std::cout << "Registered singleton: " << typeid(T).name() << "\n";
     }
     
     // Register a factory for transient services
     template<typename T>
     void registerFactory(std::function<std::shared_ptr<T>()> factory) {
-        std::string typeName = typeid(T).name();
-        factories_[typeName] = [factory]() -> std::any {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        slot(TypeSlot::of<T>()) = {nullptr, [factory]() -> std::shared_ptr<void> {
             return factory();
-        };
-        std::cout << "Registered factory: " << typeName << "\n";
+        }};
+        std::cout << "Registered factory: " << typeid(T).name() << "\n";
     }
     
     // Resolve a service
     template<typename T>
     std::shared_ptr<T> resolve() {
-        std::string typeName = typeid(T).name();
-        
-        // Check singletons first
-        auto it = services_.find(typeName);
-        if (it != services_.end()) {
-            return std::any_cast<std::shared_ptr<T>>(it->second);
+        size_t index = TypeSlot::of<T>();
+        std::unique_lock<std::recursive_mutex> lock(mutex_, std::defer_lock);
+        if (!frozen_.load(std::memory_order_acquire)) {
+            lock.lock();
         }
         
-        // Check factories
-        auto factoryIt = factories_.find(typeName);
-        if (factoryIt != factories_.end()) {
-            return std::any_cast<std::shared_ptr<T>>(factoryIt->second());
+        if (index < slots_.size()) {
+            const Registration& registration = slots_[index];
+            // Check singletons first
+            if (registration.service) {
+                return std::static_pointer_cast<T>(registration.service);
+            }
+            // Check factories
+            if (registration.factory) {
+                return std::static_pointer_cast<T>(registration.factory());
+            }
         }
         
-        throw std::runtime_error("Service not registered: " + typeName);
+        throw std::runtime_error(std::string("Service not registered: ") + typeid(T).name());
+    }
+    
+    // Stop accepting registrations; resolution no longer locks
+    void freeze() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        frozen_.store(true, std::memory_order_release);
     }
     
     // Build object with dependencies
@@ -396,78 +489,392 @@ enum class ServiceLifetime {
     Scoped
 };
 
+class AdvancedDIContainer;
+class ServiceScope;
+
 class ServiceDescriptor {
 public:
     std::string typeName;
     ServiceLifetime lifetime;
-    std::function<std::any(DIContainer&)> factory;
-    std::any instance; // For singleton
+    std::function<std::shared_ptr<void>(AdvancedDIContainer&, ServiceScope*)> factory;
+    std::shared_ptr<void> instance; // For singleton
+    std::vector<size_t> dependencies;   // TypeSlots the factory resolves
+    bool deferred = false;              // singleton left out of eager startup
+    std::shared_ptr<Lazy<std::shared_ptr<void>>> lazy;   // set by freeze() when deferred
+};
+
+// One service construction during startup or on first use of a deferred one
+struct StartupEvent {
+    std::string service;
+    int worker;            // -1 for deferred services built on demand
+    double startMs;        // since freeze() began
+    double durationMs;
 };
 
+// Singletons are built once, either on first use or all together by
+// freeze(), and every scope shares that graph. Scopes only construct their
+// scoped and transient services.
 class AdvancedDIContainer {
 private:
-    std::unordered_map<std::string, ServiceDescriptor> descriptors_;
-    std::unordered_map<std::string, std::any> scopedInstances_;
+    std::vector<ServiceDescriptor> descriptors_;   // indexed by TypeSlot
+    std::recursive_mutex mutex_;
+    std::atomic<bool> frozen_{false};
+    std::atomic<size_t> instancesCreated_{0};
+    std::chrono::steady_clock::time_point startupBegin_;
+    std::vector<StartupEvent> trace_;
+    std::mutex traceMutex_;
+    
+    // scope goes unused when TDeps is empty
+    template<typename TInterface, typename TImplementation, typename... TDeps>
+    static std::shared_ptr<void> construct(AdvancedDIContainer& container,
+                                           [[maybe_unused]] ServiceScope* scope) {
+        return std::static_pointer_cast<TInterface>(
+            std::make_shared<TImplementation>(
+                container.resolveIn<TDeps>(scope)...
+            ));
+    }
+    
+    template<typename TInterface>
+    void add(ServiceLifetime lifetime, decltype(ServiceDescriptor::factory) factory,
+             std::vector<size_t> dependencies, std::shared_ptr<void> instance = nullptr) {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        if (frozen_.load(std::memory_order_relaxed)) {
+            throw std::logic_error("AdvancedDIContainer is frozen");
+        }
+        size_t slot = TypeSlot::of<TInterface>();
+        if (slot >= descriptors_.size()) {
+            descriptors_.resize(slot + 1);
+        }
+        ServiceDescriptor& descriptor = descriptors_[slot];
+        descriptor.typeName = typeid(TInterface).name();
+        descriptor.lifetime = lifetime;
+        descriptor.factory = std::move(factory);
+        descriptor.instance = std::move(instance);
+        descriptor.dependencies = std::move(dependencies);
+    }
+    
+    // Run a singleton factory and record how long it took
+    std::shared_ptr<void> buildTraced(size_t slot, int worker) {
+        auto start = std::chrono::steady_clock::now();
+        auto instance = descriptors_[slot].factory(*this, nullptr);
+        auto end = std::chrono::steady_clock::now();
+        instancesCreated_.fetch_add(1, std::memory_order_relaxed);
+        
+        std::lock_guard<std::mutex> lock(traceMutex_);
+        trace_.push_back({descriptors_[slot].typeName, worker,
+                          std::chrono::duration<double, std::milli>(start - startupBegin_).count(),
+                          std::chrono::duration<double, std::milli>(end - start).count()});
+        return instance;
+    }
+    
+    // Build the given singletons so that each starts only after the singletons
+    // it depends on exist. Up to `workers` threads take ready services from a
+    // shared queue; independent services are built at the same time.
+    void buildInDependencyOrder(const std::vector<size_t>& slots, size_t workers) {
+        const size_t none = static_cast<size_t>(-1);
+        std::vector<size_t> position(descriptors_.size(), none);
+        for (size_t i = 0; i < slots.size(); ++i) {
+            position[slots[i]] = i;
+        }
+        std::vector<size_t> waitingOn(slots.size(), 0);
+        std::vector<std::vector<size_t>> dependents(slots.size());
+        for (size_t i = 0; i < slots.size(); ++i) {
+            for (size_t dependency : descriptors_[slots[i]].dependencies) {
+                if (dependency < position.size() && position[dependency] != none) {
+                    ++waitingOn[i];
+                    dependents[position[dependency]].push_back(i);
+                }
+            }
+        }
+        
+        std::mutex queueMutex;
+        std::condition_variable changed;
+        std::deque<size_t> ready;
+        size_t remaining = slots.size(), running = 0;
+        std::exception_ptr failure;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            if (waitingOn[i] == 0) {
+                ready.push_back(i);
+            }
+        }
+        
+        auto work = [&](int worker) {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            while (remaining > 0 && !failure) {
+                if (ready.empty()) {
+                    if (running == 0) {
+                        break;   // nothing ready and nothing in flight: a cycle
+                    }
+                    changed.wait(lock);
+                    continue;
+                }
+                size_t i = ready.front();
+                ready.pop_front();
+                ++running;
+                lock.unlock();
+                
+                std::shared_ptr<void> instance;
+                std::exception_ptr error;
+                try {
+                    instance = buildTraced(slots[i], worker);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                
+                lock.lock();
+                --running;
+                if (error) {
+                    failure = error;
+                    break;
+                }
+                {
+                    // A factory that resolved an undeclared dependency may
+                    // already have built it on the fly; keep the first one
+                    std::lock_guard<std::recursive_mutex> registry(mutex_);
+                    auto& descriptor = descriptors_[slots[i]];
+                    if (!descriptor.instance) {
+                        descriptor.instance = instance;
+                    }
+                }
+                --remaining;
+                for (size_t dependent : dependents[i]) {
+                    if (--waitingOn[dependent] == 0) {
+                        ready.push_back(dependent);
+                    }
+                }
+                changed.notify_all();
+            }
+            changed.notify_all();
+        };
+        
+        workers = std::max<size_t>(1, std::min(workers, slots.size()));
+        if (workers == 1) {
+            work(0);
+        } else {
+            std::vector<std::thread> threads;
+            for (size_t w = 0; w < workers; ++w) {
+                threads.emplace_back(work, static_cast<int>(w));
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+        
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        if (remaining > 0) {
+            throw std::logic_error("Dependency cycle among singleton services");
+        }
+    }
     
 public:
     template<typename TInterface, typename TImplementation>
     void addSingleton() {
-        ServiceDescriptor descriptor;
-        descriptor.typeName = typeid(TInterface).name();
-        descriptor.lifetime = ServiceLifetime::Singleton;
-        descriptor.factory = [](DIContainer& container) -> std::any {
-            return std::static_pointer_cast<TInterface>(
-                std::make_shared<TImplementation>());
-        };
-        descriptors_[descriptor.typeName] = descriptor;
+        add<TInterface>(ServiceLifetime::Singleton, &construct<TInterface, TImplementation>, {});
     }
     
     template<typename TInterface, typename TImplementation, typename... TDeps>
     void addSingletonWithDeps() {
-        ServiceDescriptor descriptor;
-        descriptor.typeName = typeid(TInterface).name();
-        descriptor.lifetime = ServiceLifetime::Singleton;
-        descriptor.factory = [this](DIContainer& container) -> std::any {
-            return std::static_pointer_cast<TInterface>(
-                std::make_shared<TImplementation>(
-                    resolve<TDeps>()...
-                ));
-        };
-        descriptors_[descriptor.typeName] = descriptor;
+        add<TInterface>(ServiceLifetime::Singleton, &construct<TInterface, TImplementation, TDeps...>,
+                        {TypeSlot::of<TDeps>()...});
+    }
+    
+    // Singleton built by a custom factory, called with its resolved dependencies
+    template<typename TInterface, typename... TDeps, typename TFactory>
+    void addSingletonFactory(TFactory factory) {
+        add<TInterface>(ServiceLifetime::Singleton,
+                        [factory](AdvancedDIContainer& container, ServiceScope* scope) -> std::shared_ptr<void> {
+                            return std::static_pointer_cast<TInterface>(
+                                factory(container.resolveIn<TDeps>(scope)...));
+                        },
+                        {TypeSlot::of<TDeps>()...});
+    }
+    
+    // Leave a registered singleton out of eager startup; it is built, once,
+    // by whichever resolution needs it first
+    template<typename TInterface>
+    void deferSingleton() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        size_t slot = TypeSlot::of<TInterface>();
+        if (frozen_.load(std::memory_order_relaxed) || slot >= descriptors_.size() ||
+            descriptors_[slot].lifetime != ServiceLifetime::Singleton) {
+            throw std::logic_error(std::string("Cannot defer ") + typeid(TInterface).name());
+        }
+        descriptors_[slot].deferred = true;
+    }
+    
+    // Register an already constructed singleton
+    template<typename TInterface>
+    void addSingletonInstance(std::shared_ptr<TInterface> instance) {
+        add<TInterface>(ServiceLifetime::Singleton,
+                        [instance](AdvancedDIContainer&, ServiceScope*) -> std::shared_ptr<void> {
+                            return instance;
+                        },
+                        {}, instance);
+    }
+    
+    // One instance per ServiceScope
+    template<typename TInterface, typename TImplementation, typename... TDeps>
+    void addScoped() {
+        add<TInterface>(ServiceLifetime::Scoped, &construct<TInterface, TImplementation, TDeps...>,
+                        {TypeSlot::of<TDeps>()...});
+    }
+    
+    // A new instance on every resolution
+    template<typename TInterface, typename TImplementation, typename... TDeps>
+    void addTransient() {
+        add<TInterface>(ServiceLifetime::Transient, &construct<TInterface, TImplementation, TDeps...>,
+                        {TypeSlot::of<TDeps>()...});
     }
     
     template<typename T>
     std::shared_ptr<T> resolve() {
-        std::string typeName = typeid(T).name();
-        auto it = descriptors_.find(typeName);
-        
-        if (it == descriptors_.end()) {
-            throw std::runtime_error("Service not registered: " + typeName);
+        return resolveIn<T>(nullptr);
+    }
+    
+    // Resolve on behalf of a scope; nullptr means the root container, where
+    // scoped services are not available
+    template<typename T>
+    std::shared_ptr<T> resolveIn(ServiceScope* scope);
+    
+    ServiceScope createScope();
+    
+    // Build every non-deferred singleton now and make the container
+    // read-only. With workers > 1, singletons that do not depend on each
+    // other are constructed on separate threads. Resolution afterwards takes
+    // no lock; a singleton that depends on a scoped service fails here
+    // instead of on some later request. Do not register while this runs.
+    void freeze(size_t workers = 1) {
+        std::vector<size_t> eager;
+        {
+            std::lock_guard<std::recursive_mutex> lock(mutex_);
+            if (frozen_.load(std::memory_order_relaxed)) {
+                return;
+            }
+            startupBegin_ = std::chrono::steady_clock::now();
+            for (size_t slot = 0; slot < descriptors_.size(); ++slot) {
+                const auto& descriptor = descriptors_[slot];
+                if (descriptor.factory && descriptor.lifetime == ServiceLifetime::Singleton &&
+                    !descriptor.instance && !descriptor.deferred) {
+                    eager.push_back(slot);
+                }
+            }
         }
         
-        auto& descriptor = it->second;
+        buildInDependencyOrder(eager, workers);
         
-        switch (descriptor.lifetime) {
-            case ServiceLifetime::Singleton:
-                if (!descriptor.instance.has_value()) {
-                    DIContainer temp;
-                    descriptor.instance = descriptor.factory(temp);
-                }
-                return std::any_cast<std::shared_ptr<T>>(descriptor.instance);
-                
-            case ServiceLifetime::Scoped:
-                // Implementation for scoped services
-                break;
-                
-            case ServiceLifetime::Transient:
-                DIContainer temp;
-                return std::any_cast<std::shared_ptr<T>>(descriptor.factory(temp));
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        for (size_t slot = 0; slot < descriptors_.size(); ++slot) {
+            auto& descriptor = descriptors_[slot];
+            if (descriptor.deferred && !descriptor.instance) {
+                descriptor.lazy = std::make_shared<Lazy<std::shared_ptr<void>>>(
+                    [this, slot] { return buildTraced(slot, -1); });
+            }
         }
-        
-        return nullptr;
+        frozen_.store(true, std::memory_order_release);
+    }
+    
+    // Whether a singleton exists yet (deferred ones may not)
+    template<typename T>
+    bool isBuilt() {
+        std::unique_lock<std::recursive_mutex> lock(mutex_, std::defer_lock);
+        if (!frozen_.load(std::memory_order_acquire)) {
+            lock.lock();
+        }
+        size_t slot = TypeSlot::of<T>();
+        if (slot >= descriptors_.size()) {
+            return false;
+        }
+        const auto& descriptor = descriptors_[slot];
+        return descriptor.instance || (descriptor.lazy && descriptor.lazy->isInitialized());
+    }
+    
+    // Constructions recorded since freeze() began, in completion order
+    std::vector<StartupEvent> startupTrace() {
+        std::lock_guard<std::mutex> lock(traceMutex_);
+        return trace_;
+    }
+    
+    bool isFrozen() const { return frozen_.load(std::memory_order_acquire); }
+    
+    // Objects constructed by the container so far (factory calls)
+    size_t instancesCreated() const { return instancesCreated_.load(std::memory_order_relaxed); }
+};
+
+// Per-request cache of scoped services, indexed like the container
+class ServiceScope {
+private:
+    friend class AdvancedDIContainer;
+    AdvancedDIContainer& container_;
+    std::vector<std::shared_ptr<void>> instances_;
+    
+public:
+    explicit ServiceScope(AdvancedDIContainer& container) : container_(container) {}
+    
+    template<typename T>
+    std::shared_ptr<T> resolve() {
+        return container_.resolveIn<T>(this);
     }
 };
 
+template<typename T>
+std::shared_ptr<T> AdvancedDIContainer::resolveIn(ServiceScope* scope) {
+    size_t slot = TypeSlot::of<T>();
+    std::unique_lock<std::recursive_mutex> lock(mutex_, std::defer_lock);
+    if (!frozen_.load(std::memory_order_acquire)) {
+        lock.lock();
+    }
+    
+    if (slot >= descriptors_.size() || !descriptors_[slot].factory) {
+        throw std::runtime_error(std::string("Service not registered: ") + typeid(T).name());
+    }
+    
+    ServiceDescriptor& descriptor = descriptors_[slot];
+    
+    switch (descriptor.lifetime) {
+        case ServiceLifetime::Singleton:
+            if (!descriptor.instance && descriptor.lazy) {
+                // Deferred past freeze(): Lazy builds it once, under its own lock
+                return std::static_pointer_cast<T>(descriptor.lazy->get());
+            }
+            if (!descriptor.instance) {
+                descriptor.instance = descriptor.factory(*this, nullptr);
+                instancesCreated_.fetch_add(1, std::memory_order_relaxed);
+            }
+            return std::static_pointer_cast<T>(descriptor.instance);
+            
+        case ServiceLifetime::Scoped: {
+            if (!scope) {
+                throw std::logic_error("Scoped service resolved outside a scope: " + descriptor.typeName);
+            }
+            auto& instances = scope->instances_;
+            if (slot < instances.size() && instances[slot]) {
+                return std::static_pointer_cast<T>(instances[slot]);
+            }
+            // The factory may resolve other scoped services and grow the
+            // vector, so index it again afterwards
+            auto created = descriptor.factory(*this, scope);
+            instancesCreated_.fetch_add(1, std::memory_order_relaxed);
+            if (slot >= instances.size()) {
+                instances.resize(slot + 1);
+            }
+            instances[slot] = created;
+            return std::static_pointer_cast<T>(created);
+        }
+            
+        case ServiceLifetime::Transient:
+            instancesCreated_.fetch_add(1, std::memory_order_relaxed);
+            return std::static_pointer_cast<T>(descriptor.factory(*this, scope));
+    }
+    
+    return nullptr;
+}
+
+inline ServiceScope AdvancedDIContainer::createScope() {
+    return ServiceScope(*this);
+}
+
 // Example of Poor Man's DI (manual wiring)
 class ApplicationBootstrapper {
 public:
@@ -492,8 +899,177 @@ public:
         userService->createUser("john_doe", "john@example.com");
         productService->getProduct(123);
     }
+    
+    // The same graph registered with the container. Singletons are shared by
+    // every request scope; only the cache and UserService are per request.
+    static void configureServices(AdvancedDIContainer& container, std::shared_ptr<ILogger> logger) {
+        container.addSingletonInstance<ILogger>(logger);
+        container.addSingletonInstance<IDatabase>(std::make_shared<MySQLDatabase>("localhost:3306/myapp"));
+        container.addSingletonInstance<IEmailService>(std::make_shared<SMTPEmailService>("smtp.gmail.com", 587));
+        container.addSingleton<IConfiguration, AppConfiguration>();
+        container.addScoped<ICache, MemoryCache>();
+        container.addScoped<UserService, UserService, ILogger, IDatabase, IEmailService>();
+    }
+    
+    static void bootstrapWithContainer() {
+        std::cout << "\n=== Container Bootstrap with Request Scopes ===\n";
+        
+        AdvancedDIContainer container;
+        configureServices(container, std::make_shared<ConsoleLogger>("[SCOPE]"));
+        container.freeze();
+        std::cout << "Frozen; objects built by the container so far: " << container.instancesCreated() << "\n";
+        
+        std::shared_ptr<ICache> previousCache;
+        for (int request = 1; request <= 2; ++request) {
+            ServiceScope scope = container.createScope();
+            auto userService = scope.resolve<UserService>();
+            auto cache = scope.resolve<ICache>();
+            std::cout << "Request " << request << ": same UserService within scope: "
+                      << (userService == scope.resolve<UserService>() ? "yes" : "no")
+                      << ", new cache per scope: " << (cache != previousCache ? "yes" : "no")
+                      << ", shared configuration: "
+                      << scope.resolve<IConfiguration>()->getValue("app.name") << "\n";
+            previousCache = cache;
+        }
+        std::cout << "Objects built after two requests: " << container.instancesCreated() << "\n";
+        
+        try {
+            container.resolve<ICache>();
+        } catch (const std::logic_error& e) {
+            std::cout << "Root resolution rejected: " << e.what() << "\n";
+        }
+        try {
+            container.addSingleton<ILogger, NullLogger>();
+        } catch (const std::logic_error& e) {
+            std::cout << "Late registration rejected: " << e.what() << "\n";
+        }
+    }
 };
 
+// Cold start: services whose constructors wait on the network, built one
+// after another and then in dependency order across workers
+class ColdStartBootstrapper {
+public:
+    static void configureSlowServices(AdvancedDIContainer& container, std::shared_ptr<ILogger> logger) {
+        using std::chrono::milliseconds;
+        container.addSingletonInstance<ILogger>(logger);
+        container.addSingleton<IConfiguration, AppConfiguration>();
+        container.addSingletonFactory<IDatabase, IConfiguration>(
+            [](std::shared_ptr<IConfiguration>) -> std::shared_ptr<IDatabase> {
+                auto database = std::make_shared<MySQLDatabase>("localhost:3306/myapp", milliseconds(300));
+                database->connect();
+                return database;
+            });
+        container.addSingletonFactory<PostgreSQLDatabase, IConfiguration>(
+            [](std::shared_ptr<IConfiguration>) {
+                auto analytics = std::make_shared<PostgreSQLDatabase>("analytics", 5432, "warehouse",
+                                                                      milliseconds(400));
+                analytics->connect();
+                return analytics;
+            });
+        container.addSingletonFactory<IEmailService, IConfiguration>(
+            [](std::shared_ptr<IConfiguration> config) -> std::shared_ptr<IEmailService> {
+                return std::make_shared<SMTPEmailService>("smtp.gmail.com", config->getInt("email.smtp.port"),
+                                                          milliseconds(200));
+            });
+        container.addSingletonWithDeps<UserService, UserService, ILogger, IDatabase, IEmailService>();
+    }
+    
+    static void printTrace(AdvancedDIContainer& container) {
+        for (const auto& event : container.startupTrace()) {
+            std::ostringstream line;
+            line << "  " << std::left << std::setw(8)
+                 << (event.worker < 0 ? std::string("[lazy]") : "[w" + std::to_string(event.worker) + "]")
+                 << std::right << std::fixed << std::setprecision(1)
+                 << "start " << std::setw(6) << event.startMs << " ms  took "
+                 << std::setw(6) << event.durationMs << " ms  " << event.service << "\n";
+            std::cout << line.str();
+        }
+    }
+    
+    static void run(const char* label, size_t workers, bool deferAnalytics) {
+        std::cout << "\n-- " << label << " --\n";
+        AdvancedDIContainer container;
+        configureSlowServices(container, std::make_shared<NullLogger>());
+        if (deferAnalytics) {
+            container.deferSingleton<PostgreSQLDatabase>();
+        }
+        
+        auto start = std::chrono::steady_clock::now();
+        container.freeze(workers);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Ready in " << static_cast<int>(ms) << " ms\n";
+        
+        if (deferAnalytics) {
+            std::cout << "Analytics database built at startup: "
+                      << (container.isBuilt<PostgreSQLDatabase>() ? "yes" : "no") << "\n";
+            container.resolve<PostgreSQLDatabase>()->execute("SELECT count(*) FROM events");
+        }
+        printTrace(container);
+    }
+    
+    static void coldStartExample() {
+        std::cout << "\n=== Cold Start: Dependency-Ordered Construction ===\n";
+        run("serial, 1 worker", 1, false);
+        run("parallel, 4 workers", 4, false);
+        run("parallel, analytics deferred", 4, true);
+    }
+};
+
+// Request handlers that resolve a dozen services each, three ways
+void requestScopeBenchmark() {
+    std::cout << "\n=== Request Scope Cost ===\n";
+    const int requests = 100000;
+    size_t resolved = 0;
+    auto logger = std::make_shared<NullLogger>();
+    
+    auto time = [&](const char* label, auto handleRequest) {
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < requests; ++r) {
+            handleRequest();
+        }
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "  " << label << ": " << us / requests << " us per request\n";
+    };
+    
+    // Rebuild the whole graph for every request
+    time("manual wiring per request", [&] {
+        auto database = std::make_shared<MySQLDatabase>("localhost:3306/myapp");
+        auto emailService = std::make_shared<SMTPEmailService>("smtp.gmail.com", 587);
+        auto configuration = std::make_shared<AppConfiguration>();
+        auto cache = std::make_shared<MemoryCache>();
+        auto userService = std::make_shared<UserService>(logger, database, emailService);
+        resolved += 12 * (userService && cache && configuration);
+    });
+    
+    auto runScopes = [&](AdvancedDIContainer& container) {
+        return [&] {
+            ServiceScope scope = container.createScope();
+            for (int round = 0; round < 2; ++round) {
+                resolved += scope.resolve<UserService>() != nullptr;
+                resolved += scope.resolve<ICache>() != nullptr;
+                resolved += scope.resolve<ILogger>() != nullptr;
+                resolved += scope.resolve<IDatabase>() != nullptr;
+                resolved += scope.resolve<IEmailService>() != nullptr;
+                resolved += scope.resolve<IConfiguration>() != nullptr;
+            }
+        };
+    };
+    
+    AdvancedDIContainer locked;
+    ApplicationBootstrapper::configureServices(locked, logger);
+    time("container scopes, not frozen", runScopes(locked));
+    
+    AdvancedDIContainer frozen;
+    ApplicationBootstrapper::configureServices(frozen, logger);
+    frozen.freeze();
+    size_t built = frozen.instancesCreated();
+    time("container scopes, frozen", runScopes(frozen));
+    std::cout << "  frozen container built " << built << " singleton at freeze, then "
+              << static_cast<double>(frozen.instancesCreated() - built) / requests
+              << " objects per request (" << resolved << " resolutions)\n";
+}
+
 int main() {
     std::cout << "=== Dependency Injection Pattern Demo ===\n";
     
@@ -552,6 +1128,9 @@ int main() {
     
     // Poor Man's DI
     ApplicationBootstrapper::bootstrapApplication();
+    ApplicationBootstrapper::bootstrapWithContainer();
+    ColdStartBootstrapper::coldStartExample();
+    requestScopeBenchmark();
     
     // Benefits of DI
     std::cout << "\n=== Benefits of Dependency Injection ===\n";
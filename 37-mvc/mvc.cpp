@@ -8,6 +8,12 @@
 #include <sstream>
 #include <iomanip>
 #include <ctime>
+#include <cmath>
+#include <cstdint>
+#include <bitset>
+#include <chrono>
+#include <limits>
+#include <initializer_list>
 
 // Forward declarations
 class IObserver;
@@ -15,11 +21,154 @@ class Model;
 class View;
 class Controller;
 
+// Set of changed fields. Each model numbers its own fields from 0 to 63.
+class FieldSet {
+private:
+    uint64_t bits_ = 0;
+    
+public:
+    FieldSet() = default;
+    FieldSet(std::initializer_list<int> fields) {
+        for (int field : fields) add(field);
+    }
+    
+    static FieldSet all() {
+        FieldSet set;
+        set.bits_ = ~uint64_t(0);
+        return set;
+    }
+    
+    void add(int field) { bits_ |= uint64_t(1) << field; }
+    void merge(const FieldSet& other) { bits_ |= other.bits_; }
+    void clear() { bits_ = 0; }
+    bool contains(int field) const { return (bits_ >> field) & 1; }
+    bool intersects(const FieldSet& other) const { return (bits_ & other.bits_) != 0; }
+    bool empty() const { return bits_ == 0; }
+    size_t count() const { return std::bitset<64>(bits_).count(); }
+};
+
+// Coalesces change marks into notifications. Outside a transaction a mark is
+// delivered at once, as before. Inside one, or while the refresh interval
+// has not yet passed, marks accumulate, and listeners later get a single
+// call with every field that changed. Derived values are recomputed just
+// before delivery, and only when one of their inputs is in the set.
+class ChangeBatcher {
+public:
+    using Listener = std::function<void(const FieldSet&)>;
+    using Clock = std::function<double()>;   // seconds
+    
+    // Changes made while a Transaction is alive go out as one notification
+    class Transaction {
+    private:
+        ChangeBatcher& batcher_;
+        
+    public:
+        explicit Transaction(ChangeBatcher& batcher) : batcher_(batcher) { batcher_.begin(); }
+        ~Transaction() { batcher_.end(); }
+        Transaction(const Transaction&) = delete;
+        Transaction& operator=(const Transaction&) = delete;
+    };
+    
+private:
+    struct Derived {
+        FieldSet inputs;
+        std::function<void()> recompute;
+    };
+    
+    std::vector<Listener> listeners_;
+    std::vector<Derived> derived_;
+    FieldSet pending_;
+    int depth_ = 0;
+    bool flushing_ = false;
+    double minInterval_ = 0.0;
+    double lastFlush_ = -std::numeric_limits<double>::infinity();
+    Clock clock_;
+    size_t marks_ = 0, notifications_ = 0, recomputes_ = 0;
+    
+    bool flush(bool force) {
+        if (pending_.empty() || depth_ > 0 || flushing_) {
+            return false;
+        }
+        double now = clock_();
+        if (!force && now - lastFlush_ < minInterval_) {
+            return false;   // picked up by a later poll() or change
+        }
+        lastFlush_ = now;
+        flushing_ = true;
+        // Listeners may change more fields; those go out in a follow-up
+        // notification within the same flush
+        while (!pending_.empty()) {
+            for (auto& derived : derived_) {
+                if (pending_.intersects(derived.inputs)) {
+                    derived.recompute();
+                    ++recomputes_;
+                }
+            }
+            FieldSet changed = pending_;
+            pending_.clear();
+            ++notifications_;
+            for (auto& listener : listeners_) {
+                listener(changed);
+            }
+        }
+        flushing_ = false;
+        return true;
+    }
+    
+public:
+    ChangeBatcher()
+        : clock_([] {
+              return std::chrono::duration<double>(
+                  std::chrono::steady_clock::now().time_since_epoch()).count();
+          }) {}
+    
+    void subscribe(Listener listener) { listeners_.push_back(std::move(listener)); }
+    
+    // At most `hz` notifications per second; 0 removes the limit
+    void setMaxRefreshRate(double hz) { minInterval_ = hz > 0 ? 1.0 / hz : 0.0; }
+    void setClock(Clock clock) { clock_ = std::move(clock); }
+    
+    // recompute() runs when any input changed and should mark its own output
+    // field only if the value actually changed. Register derived values after
+    // the ones they read from.
+    void addDerived(FieldSet inputs, std::function<void()> recompute) {
+        derived_.push_back({inputs, std::move(recompute)});
+    }
+    
+    void markChanged(int field) { markChanged(FieldSet{field}); }
+    
+    void markChanged(const FieldSet& fields) {
+        ++marks_;
+        pending_.merge(fields);
+        flush(false);
+    }
+    
+    void begin() { ++depth_; }
+    void end() {
+        if (--depth_ == 0) flush(false);
+    }
+    
+    // Deliver held-back changes if the refresh interval allows; call per frame
+    bool poll() { return flush(false); }
+    
+    // Deliver held-back changes regardless of the refresh rate
+    bool flushNow() { return flush(true); }
+    
+    bool hasPending() const { return !pending_.empty(); }
+    size_t marks() const { return marks_; }
+    size_t notifications() const { return notifications_; }
+    size_t recomputes() const { return recomputes_; }
+};
+
 // Observer interface for MVC communication
 class IObserver {
 public:
     virtual ~IObserver() = default;
     virtual void update() = 0;
+    
+    // Views that can redraw part of themselves override this; the default
+    // redraws everything
+    virtual void onFieldsChanged(const FieldSet&) { update(); }
 };
 
 // Subject interface for Model
@@ -35,8 +184,23 @@ public:
 class Model : public ISubject {
 protected:
     std::vector<IObserver*> observers_;
+    ChangeBatcher changes_;
+    
+    // Mark specific fields; delivery follows the batcher's rules
+    void notifyChanged(const FieldSet& fields) { changes_.markChanged(fields); }
     
 public:
+    Model() {
+        changes_.subscribe([this](const FieldSet& changed) {
+            for (auto observer : observers_) {
+                observer->onFieldsChanged(changed);
+            }
+        });
+    }
+    
+    Model(const Model&) = delete;
+    Model& operator=(const Model&) = delete;
+    
     void attach(IObserver* observer) override {
         observers_.push_back(observer);
     }
@@ -48,11 +212,12 @@ public:
         );
     }
     
+    // Everything may have changed
     void notify() override {
-        for (auto observer : observers_) {
-            observer->update();
-        }
+        changes_.markChanged(FieldSet::all());
     }
+    
+    ChangeBatcher& changes() { return changes_; }
 };
 
 // Example 1: Simple Todo Application
@@ -543,6 +708,126 @@ namespace Calculator {
     };
 }
 
+// Example 4: Simulation Dashboard with batched, partial redraws
+namespace SimulationDashboard {
+    enum Field { Time, Temperature, Pressure, Energy, Status };
+    
+    class SimulationModel : public Model {
+    private:
+        double time_ = 0.0;
+        double temperature_ = 300.0;
+        double pressure_ = 101.3;
+        double energy_ = 0.0;
+        std::string status_ = "NOMINAL";
+        
+        void set(double& slot, double value, Field field) {
+            if (slot != value) {
+                slot = value;
+                notifyChanged({field});
+            }
+        }
+        
+    public:
+        SimulationModel() {
+            // Derived fields; recomputed once per notification, and only when
+            // an input is part of it
+            changes_.addDerived({Temperature, Pressure}, [this] {
+                set(energy_, 0.5 * pressure_ * temperature_, Energy);
+            });
+            changes_.addDerived({Temperature}, [this] {
+                std::string status = temperature_ > 340.0 ? "OVERHEAT" : "NOMINAL";
+                if (status != status_) {
+                    status_ = status;
+                    notifyChanged({Status});
+                }
+            });
+        }
+        
+        void setTime(double t) { set(time_, t, Time); }
+        void setTemperature(double t) { set(temperature_, t, Temperature); }
+        void setPressure(double p) { set(pressure_, p, Pressure); }
+        
+        double getTime() const { return time_; }
+        double getTemperature() const { return temperature_; }
+        double getPressure() const { return pressure_; }
+        double getEnergy() const { return energy_; }
+        const std::string& getStatus() const { return status_; }
+    };
+    
+    // Four panels; each is formatted only when one of its fields changed
+    class DashboardView : public IObserver {
+    private:
+        SimulationModel* model_;
+        std::string clockPanel_, gaugePanel_, energyPanel_, statusPanel_;
+        size_t panelRedraws_ = 0;
+        
+        template<typename... Args>
+        void draw(std::string& panel, const Args&... parts) {
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(2);
+            (oss << ... << parts);
+            panel = oss.str();
+            ++panelRedraws_;
+        }
+        
+    public:
+        explicit DashboardView(SimulationModel* model) : model_(model) {
+            model_->attach(this);
+        }
+        
+        ~DashboardView() override {
+            model_->detach(this);
+        }
+        
+        void update() override {
+            onFieldsChanged(FieldSet::all());
+        }
+        
+        void onFieldsChanged(const FieldSet& changed) override {
+            if (changed.contains(Time)) {
+                draw(clockPanel_, "t=", model_->getTime(), "s");
+            }
+            if (changed.contains(Temperature) || changed.contains(Pressure)) {
+                draw(gaugePanel_, "T=", model_->getTemperature(), "K P=", model_->getPressure(), "kPa");
+            }
+            if (changed.contains(Energy)) {
+                draw(energyPanel_, "E=", model_->getEnergy(), "J");
+            }
+            if (changed.contains(Status)) {
+                draw(statusPanel_, "[", model_->getStatus(), "]");
+            }
+        }
+        
+        void render() const {
+            std::cout << "  " << clockPanel_ << " | " << gaugePanel_ << " | "
+                      << energyPanel_ << " | " << statusPanel_ << "\n";
+        }
+        
+        size_t panelRedraws() const { return panelRedraws_; }
+    };
+    
+    // Feeds the model the way a solver would: three fields per step
+    class SimulationController {
+    private:
+        SimulationModel* model_;
+        
+    public:
+        explicit SimulationController(SimulationModel* model) : model_(model) {}
+        
+        void step(double t) {
+            model_->setTime(t);
+            model_->setTemperature(320.0 + 25.0 * std::sin(t * 0.7));
+            model_->setPressure(101.3 + 3.0 * std::cos(t * 1.3));
+        }
+        
+        // One notification per step
+        void batchedStep(double t) {
+            ChangeBatcher::Transaction frame(model_->changes());
+            step(t);
+        }
+    };
+}
+
 // MVC Framework Base Classes
 namespace MVCFramework {
     template<typename TModel>
@@ -646,12 +931,59 @@ void demonstrateCalculator() {
     view.showHistory();
 }
 
+// Drives 10 simulated seconds at 10 kHz through three notification modes
+void demonstrateSimulationDashboard() {
+    std::cout << "\n=== Simulation Dashboard Demo ===\n";
+    
+    const int steps = 100000;
+    const double dt = 1e-4;
+    
+    enum class Mode { PerSetter, PerStep, Throttled };
+    auto run = [&](const char* label, Mode mode) {
+        SimulationDashboard::SimulationModel model;
+        SimulationDashboard::DashboardView view(&model);
+        SimulationDashboard::SimulationController controller(&model);
+        
+        double simTime = 0.0;
+        model.changes().setClock([&simTime] { return simTime; });
+        if (mode == Mode::Throttled) {
+            model.changes().setMaxRefreshRate(30.0);
+        }
+        
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 1; i <= steps; ++i) {
+            simTime = i * dt;
+            if (mode == Mode::PerSetter) {
+                controller.step(simTime);
+            } else {
+                controller.batchedStep(simTime);
+            }
+        }
+        model.changes().flushNow();
+        double ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        
+        std::cout << std::left << std::setw(21) << label << std::right << ": "
+                  << model.changes().notifications() << " notifications, "
+                  << view.panelRedraws() << " panel redraws, "
+                  << model.changes().recomputes() << " derived recomputes, "
+                  << std::fixed << std::setprecision(1) << ms << " ms\n";
+        std::cout.unsetf(std::ios::fixed);
+        view.render();
+    };
+    
+    run("Notify per setter", Mode::PerSetter);
+    run("Transaction per step", Mode::PerStep);
+    run("Per step, 30 Hz cap", Mode::Throttled);
+}
+
 int main() {
     std::cout << "=== MVC (Model-View-Controller) Pattern Demo ===\n\n";
     
     demonstrateTodoApp();
     demonstrateUserManagement();
     demonstrateCalculator();
+    demonstrateSimulationDashboard();
     
     std::cout << "\n=== MVC Pattern Benefits ===\n";
     std::cout << "1. Separation of Concerns\n";
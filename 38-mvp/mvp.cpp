@@ -8,6 +8,148 @@
 #include <iomanip>
 #include <algorithm>
 #include <ctime>
+#include <cmath>
+#include <cstdint>
+#include <chrono>
+#include <limits>
+#include <initializer_list>
+
+// Trimmed copy of pattern 37's FieldSet and ChangeBatcher. A presenter
+// subscribes to its model's batcher and pushes one view update per batch.
+// Each model numbers its own fields from 0 to 63.
+class FieldSet {
+private:
+    uint64_t bits_ = 0;
+    
+public:
+    FieldSet() = default;
+    FieldSet(std::initializer_list<int> fields) {
+        for (int field : fields) add(field);
+    }
+    
+    static FieldSet all() {
+        FieldSet set;
+        set.bits_ = ~uint64_t(0);
+        return set;
+    }
+    
+    void add(int field) { bits_ |= uint64_t(1) << field; }
+    void merge(const FieldSet& other) { bits_ |= other.bits_; }
+    void clear() { bits_ = 0; }
+    bool contains(int field) const { return (bits_ >> field) & 1; }
+    bool intersects(const FieldSet& other) const { return (bits_ & other.bits_) != 0; }
+    bool empty() const { return bits_ == 0; }
+};
+
+// Coalesces change marks into notifications. Outside a transaction a mark is
+// delivered at once, as before. Inside one, or while the refresh interval
+// has not yet passed, marks accumulate, and listeners later get a single
+// call with every field that changed. Derived values are recomputed just
+// before delivery, and only when one of their inputs is in the set.
+class ChangeBatcher {
+public:
+    using Listener = std::function<void(const FieldSet&)>;
+    using Clock = std::function<double()>;   // seconds
+    
+    // Changes made while a Transaction is alive go out as one notification
+    class Transaction {
+    private:
+        ChangeBatcher& batcher_;
+        
+    public:
+        explicit Transaction(ChangeBatcher& batcher) : batcher_(batcher) { batcher_.begin(); }
+        ~Transaction() { batcher_.end(); }
+        Transaction(const Transaction&) = delete;
+        Transaction& operator=(const Transaction&) = delete;
+    };
+    
+private:
+    struct Derived {
+        FieldSet inputs;
+        std::function<void()> recompute;
+    };
+    
+    std::vector<Listener> listeners_;
+    std::vector<Derived> derived_;
+    FieldSet pending_;
+    int depth_ = 0;
+    bool flushing_ = false;
+    double minInterval_ = 0.0;
+    double lastFlush_ = -std::numeric_limits<double>::infinity();
+    Clock clock_;
+    size_t notifications_ = 0, recomputes_ = 0;
+    
+    bool flush(bool force) {
+        if (pending_.empty() || depth_ > 0 || flushing_) {
+            return false;
+        }
+        double now = clock_();
+        if (!force && now - lastFlush_ < minInterval_) {
+            return false;   // picked up by a later poll() or change
+        }
+        lastFlush_ = now;
+        flushing_ = true;
+        // Listeners may change more fields; those go out in a follow-up
+        // notification within the same flush
+        while (!pending_.empty()) {
+            for (auto& derived : derived_) {
+                if (pending_.intersects(derived.inputs)) {
+                    derived.recompute();
+                    ++recomputes_;
+                }
+            }
+            FieldSet changed = pending_;
+            pending_.clear();
+            ++notifications_;
+            for (auto& listener : listeners_) {
+                listener(changed);
+            }
+        }
+        flushing_ = false;
+        return true;
+    }
+    
+public:
+    ChangeBatcher()
+        : clock_([] {
+              return std::chrono::duration<double>(
+                  std::chrono::steady_clock::now().time_since_epoch()).count();
+          }) {}
+    
+    void subscribe(Listener listener) { listeners_.push_back(std::move(listener)); }
+    
+    // At most `hz` notifications per second; 0 removes the limit
+    void setMaxRefreshRate(double hz) { minInterval_ = hz > 0 ? 1.0 / hz : 0.0; }
+    void setClock(Clock clock) { clock_ = std::move(clock); }
+    
+    // recompute() runs when any input changed and should mark its own output
+    // field only if the value actually changed. Register derived values after
+    // the ones they read from.
+    void addDerived(FieldSet inputs, std::function<void()> recompute) {
+        derived_.push_back({inputs, std::move(recompute)});
+    }
+    
+    void markChanged(int field) { markChanged(FieldSet{field}); }
+    
+    void markChanged(const FieldSet& fields) {
+        pending_.merge(fields);
+        flush(false);
+    }
+    
+    void begin() { ++depth_; }
+    void end() {
+        if (--depth_ == 0) flush(false);
+    }
+    
+    // Deliver held-back changes if the refresh interval allows; call per frame
+    bool poll() { return flush(false); }
+    
+    // Deliver held-back changes regardless of the refresh rate
+    bool flushNow() { return flush(true); }
+    
+    size_t notifications() const { return notifications_; }
+    size_t recomputes() const { return recomputes_; }
+};
 
 // MVP interfaces
 template<typename T>
@@ -646,6 +788,159 @@ namespace ShoppingCart {
     };
 }
 
+// Example 4: Telemetry Dashboard with batched, diffed view pushes
+namespace TelemetryDashboard {
+    enum Field { Altitude, Velocity, Fuel, Warning, FieldCount };
+    
+    class TelemetryModel {
+    private:
+        double values_[FieldCount - 1] = {0.0, 0.0, 100.0};
+        bool lowFuel_ = false;
+        ChangeBatcher changes_;
+        
+    public:
+        TelemetryModel() {
+            // Recomputed only when Fuel is part of the batch
+            changes_.addDerived({Fuel}, [this] {
+                bool low = values_[Fuel] < 20.0;
+                if (low != lowFuel_) {
+                    lowFuel_ = low;
+                    changes_.markChanged(Warning);
+                }
+            });
+        }
+        
+        void set(Field field, double value) {
+            if (values_[field] != value) {
+                values_[field] = value;
+                changes_.markChanged(field);
+            }
+        }
+        
+        double get(Field field) const { return values_[field]; }
+        bool isLowFuel() const { return lowFuel_; }
+        ChangeBatcher& changes() { return changes_; }
+    };
+    
+    struct Readout {
+        Field field;
+        std::string text;
+    };
+    
+    // View Interface
+    class ITelemetryView : public IView<std::vector<Readout>> {
+    public:
+        // One panel only
+        virtual void showReadout(const Readout& readout) = 0;
+        
+        // From IView: every panel
+        void showData(const std::vector<Readout>& readouts) override {
+            for (const auto& readout : readouts) {
+                showReadout(readout);
+            }
+        }
+    };
+    
+    // Console View; keeps the latest text per panel and prints on demand
+    class ConsoleTelemetryView : public ITelemetryView {
+    private:
+        std::string panels_[FieldCount];
+        size_t pushes_ = 0;
+        
+    public:
+        void showReadout(const Readout& readout) override {
+            panels_[readout.field] = readout.text;
+            ++pushes_;
+        }
+        
+        void showMessage(const std::string& message) override {
+            std::cout << "[INFO] " << message << "\n";
+        }
+        
+        void showError(const std::string& error) override {
+            std::cout << "[ERROR] " << error << "\n";
+        }
+        
+        void render() const {
+            std::cout << " ";
+            for (const auto& panel : panels_) {
+                std::cout << " | " << panel;
+            }
+            std::cout << " |\n";
+        }
+        
+        size_t pushes() const { return pushes_; }
+    };
+    
+    // Presenter
+    class TelemetryPresenter {
+    private:
+        TelemetryModel* model_;
+        ITelemetryView* view_;
+        bool incremental_;
+        std::string lastPushed_[FieldCount];
+        
+        Readout format(Field field) const {
+            std::ostringstream oss;
+            oss << std::fixed;
+            switch (field) {
+                case Altitude: oss << "ALT " << std::setprecision(0) << model_->get(Altitude) << " m"; break;
+                case Velocity: oss << "VEL " << std::setprecision(1) << model_->get(Velocity) << " m/s"; break;
+                case Fuel:     oss << "FUEL " << std::setprecision(1) << model_->get(Fuel) << "%"; break;
+                default:       oss << (model_->isLowFuel() ? "LOW FUEL" : "OK"); break;
+            }
+            return {field, oss.str()};
+        }
+        
+    public:
+        // A full presenter formats and pushes every panel on each change; an
+        // incremental one formats changed fields and pushes text that differs
+        TelemetryPresenter(TelemetryModel* model, ITelemetryView* view, bool incremental)
+            : model_(model), view_(view), incremental_(incremental) {
+            model_->changes().subscribe([this](const FieldSet& changed) {
+                onModelChanged(changed);
+            });
+        }
+        
+        void refreshAll() {
+            std::vector<Readout> readouts;
+            for (int f = 0; f < FieldCount; ++f) {
+                readouts.push_back(format(static_cast<Field>(f)));
+            }
+            view_->showData(readouts);
+        }
+        
+        void onModelChanged(const FieldSet& changed) {
+            if (!incremental_) {
+                refreshAll();
+                return;
+            }
+            for (int f = 0; f < FieldCount; ++f) {
+                if (!changed.contains(f)) continue;
+                Readout readout = format(static_cast<Field>(f));
+                if (readout.text != lastPushed_[f]) {
+                    lastPushed_[f] = readout.text;
+                    view_->showReadout(readout);
+                }
+            }
+        }
+        
+        // Feed one telemetry sample; with `batched` it goes out as one update
+        void onSample(double altitude, double velocity, double fuel, bool batched) {
+            if (batched) {
+                ChangeBatcher::Transaction sample(model_->changes());
+                model_->set(Altitude, altitude);
+                model_->set(Velocity, velocity);
+                model_->set(Fuel, fuel);
+            } else {
+                model_->set(Altitude, altitude);
+                model_->set(Velocity, velocity);
+                model_->set(Fuel, fuel);
+            }
+        }
+    };
+}
+
 // Demo
 void demonstrateLoginSystem() {
     std::cout << "=== Login System Demo ===\n";
@@ -715,12 +1010,56 @@ void demonstrateShoppingCart() {
     presenter.showCart();
 }
 
+// 20 seconds of 1 kHz telemetry pushed three ways
+void demonstrateTelemetryDashboard() {
+    std::cout << "\n=== Telemetry Dashboard Demo ===\n";
+    
+    const int samples = 20000;
+    const double dt = 1e-3;
+    
+    enum class Mode { FullPush, Incremental, Throttled };
+    auto run = [&](const char* label, Mode mode) {
+        TelemetryDashboard::TelemetryModel model;
+        TelemetryDashboard::ConsoleTelemetryView view;
+        TelemetryDashboard::TelemetryPresenter presenter(&model, &view, mode != Mode::FullPush);
+        
+        double simTime = 0.0;
+        model.changes().setClock([&simTime] { return simTime; });
+        if (mode == Mode::Throttled) {
+            model.changes().setMaxRefreshRate(20.0);
+        }
+        
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 1; i <= samples; ++i) {
+            simTime = i * dt;
+            double velocity = 9.81 * simTime;
+            presenter.onSample(0.5 * velocity * simTime, velocity,
+                               100.0 - 4.5 * simTime, mode != Mode::FullPush);
+        }
+        model.changes().flushNow();
+        double ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        
+        std::cout << std::left << std::setw(20) << label << std::right << ": "
+                  << model.changes().notifications() << " model notifications, "
+                  << view.pushes() << " view pushes, "
+                  << std::fixed << std::setprecision(1) << ms << " ms\n";
+        std::cout.unsetf(std::ios::fixed);
+        view.render();
+    };
+    
+    run("Full push per set", Mode::FullPush);
+    run("Batched + diffed", Mode::Incremental);
+    run("Batched, 20 Hz cap", Mode::Throttled);
+}
+
 int main() {
     std::cout << "=== MVP (Model-View-Presenter) Pattern Demo ===\n\n";
     
     demonstrateLoginSystem();
     demonstrateTaskManagement();
     demonstrateShoppingCart();
+    demonstrateTelemetryDashboard();
     
     std::cout << "\n=== MVP vs MVC ===\n";
     std::cout << "MVP Differences:\n";
@@ -7,29 +7,219 @@
 #include <algorithm>
 #include <unordered_map>
 #include <any>
+#include <cmath>
+#include <cstdint>
+#include <bitset>
+#include <chrono>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+#include <initializer_list>
+
+// Trimmed copy of pattern 37's FieldSet and ChangeBatcher. A ViewModel
+// routes property notifications through a batcher; each ViewModel numbers
+// its properties from 0 to 63 in declaration order.
+class FieldSet {
+private:
+    uint64_t bits_ = 0;
+    
+public:
+    FieldSet() = default;
+    FieldSet(std::initializer_list<int> fields) {
+        for (int field : fields) add(field);
+    }
+    
+    static FieldSet all() {
+        FieldSet set;
+        set.bits_ = ~uint64_t(0);
+        return set;
+    }
+    
+    void add(int field) { bits_ |= uint64_t(1) << field; }
+    void merge(const FieldSet& other) { bits_ |= other.bits_; }
+    void clear() { bits_ = 0; }
+    bool contains(int field) const { return (bits_ >> field) & 1; }
+    bool intersects(const FieldSet& other) const { return (bits_ & other.bits_) != 0; }
+    bool empty() const { return bits_ == 0; }
+    size_t count() const { return std::bitset<64>(bits_).count(); }
+};
+
+// Coalesces change marks into notifications. Outside a transaction a mark is
+// delivered at once, as before. Inside one, or while the refresh interval
+// has not yet passed, marks accumulate, and listeners later get a single
+// call with every field that changed. Derived values are recomputed just
+// before delivery, and only when one of their inputs is in the set.
+class ChangeBatcher {
+public:
+    using Listener = std::function<void(const FieldSet&)>;
+    using Clock = std::function<double()>;   // seconds
+    
+    // Changes made while a Transaction is alive go out as one notification
+    class Transaction {
+    private:
+        ChangeBatcher& batcher_;
+        
+    public:
+        explicit Transaction(ChangeBatcher& batcher) : batcher_(batcher) { batcher_.begin(); }
+        ~Transaction() { batcher_.end(); }
+        Transaction(const Transaction&) = delete;
+        Transaction& operator=(const Transaction&) = delete;
+    };
+    
+private:
+    struct Derived {
+        FieldSet inputs;
+        std::function<void()> recompute;
+    };
+    
+    std::vector<Listener> listeners_;
+    std::vector<Derived> derived_;
+    FieldSet pending_;
+    int depth_ = 0;
+    bool flushing_ = false;
+    double minInterval_ = 0.0;
+    double lastFlush_ = -std::numeric_limits<double>::infinity();
+    Clock clock_;
+    size_t notifications_ = 0, recomputes_ = 0;
+    
+    bool flush(bool force) {
+        if (pending_.empty() || depth_ > 0 || flushing_) {
+            return false;
+        }
+        double now = clock_();
+        if (!force && now - lastFlush_ < minInterval_) {
+            return false;   // picked up by a later poll() or change
+        }
+        lastFlush_ = now;
+        flushing_ = true;
+        // Listeners may change more fields; those go out in a follow-up
+        // notification within the same flush
+        while (!pending_.empty()) {
+            for (auto& derived : derived_) {
+                if (pending_.intersects(derived.inputs)) {
+                    derived.recompute();
+                    ++recomputes_;
+                }
+            }
+            FieldSet changed = pending_;
+            pending_.clear();
+            ++notifications_;
+            for (auto& listener : listeners_) {
+                listener(changed);
+            }
+        }
+        flushing_ = false;
+        return true;
+    }
+    
+public:
+    ChangeBatcher()
+        : clock_([] {
+              return std::chrono::duration<double>(
+                  std::chrono::steady_clock::now().time_since_epoch()).count();
+          }) {}
+    
+    void subscribe(Listener listener) { listeners_.push_back(std::move(listener)); }
+    
+    // At most `hz` notifications per second; 0 removes the limit
+    void setMaxRefreshRate(double hz) { minInterval_ = hz > 0 ? 1.0 / hz : 0.0; }
+    void setClock(Clock clock) { clock_ = std::move(clock); }
+    
+    // recompute() runs when any input changed and should mark its own output
+    // field only if the value actually changed. Register derived values after
+    // the ones they read from.
+    void addDerived(FieldSet inputs, std::function<void()> recompute) {
+        derived_.push_back({inputs, std::move(recompute)});
+    }
+    
+    void markChanged(int field) { markChanged(FieldSet{field}); }
+    
+    void markChanged(const FieldSet& fields) {
+        pending_.merge(fields);
+        flush(false);
+    }
+    
+    void begin() { ++depth_; }
+    void end() {
+        if (--depth_ == 0) flush(false);
+    }
+    
+    // Deliver held-back changes if the refresh interval allows; call per frame
+    bool poll() { return flush(false); }
+    
+    // Deliver held-back changes regardless of the refresh rate
+    bool flushNow() { return flush(true); }
+    
+    size_t notifications() const { return notifications_; }
+    size_t recomputes() const { return recomputes_; }
+};
 
 // Property Changed Notification
 class INotifyPropertyChanged {
 public:
     using PropertyChangedHandler = std::function<void(const std::string&)>;
+    using PropertiesChangedHandler = std::function<void(const FieldSet&)>;
+    
+    INotifyPropertyChanged() {
+        changes_.subscribe([this](const FieldSet& changed) {
+            for (size_t id = 0; id < propertyNames_.size(); ++id) {
+                if (!changed.contains(static_cast<int>(id))) continue;
+                for (const auto& handler : handlers_) {
+                    handler(propertyNames_[id]);
+                }
+            }
+            for (const auto& handler : batchHandlers_) {
+                handler(changed);
+            }
+        });
+    }
     
+    INotifyPropertyChanged(const INotifyPropertyChanged&) = delete;
+    INotifyPropertyChanged& operator=(const INotifyPropertyChanged&) = delete;
     virtual ~INotifyPropertyChanged() = default;
     
+    // Called once per changed property
     void addPropertyChangedHandler(PropertyChangedHandler handler) {
         handlers_.push_back(handler);
     }
     
+    // Called once per notification with every property that changed, which
+    // lets a view re-render once per batch instead of once per property
+    void addPropertiesChangedHandler(PropertiesChangedHandler handler) {
+        batchHandlers_.push_back(handler);
+    }
+    
+    // Wrap a group of assignments in ChangeBatcher::Transaction, or set a
+    // max refresh rate here
+    ChangeBatcher& changes() { return changes_; }
+    
 protected:
     template<typename T> friend class ObservableProperty;
     
-    void notifyPropertyChanged(const std::string& propertyName) {
-        for (const auto& handler : handlers_) {
-            handler(propertyName);
+    int registerProperty(const std::string& propertyName) {
+        if (propertyNames_.size() == 64) {
+            throw std::length_error("A ViewModel supports at most 64 properties");
         }
+        propertyNames_.push_back(propertyName);
+        return static_cast<int>(propertyNames_.size() - 1);
+    }
+    
+    void notifyPropertyChanged(int propertyId) {
+        changes_.markChanged(propertyId);
+    }
+    
+    // recompute() runs once per notification in which any input changed;
+    // register derived properties after the ones they read from
+    void addDerivedProperty(FieldSet inputs, std::function<void()> recompute) {
+        changes_.addDerived(inputs, std::move(recompute));
     }
     
 private:
     std::vector<PropertyChangedHandler> handlers_;
+    std::vector<PropertiesChangedHandler> batchHandlers_;
+    std::vector<std::string> propertyNames_;
+    ChangeBatcher changes_;
 };
 
 // Observable Property Template
@@ -39,18 +229,21 @@ private:
     T value_;
     std::string name_;
     INotifyPropertyChanged* owner_;
+    int id_;
     
 public:
     ObservableProperty(const std::string& name, INotifyPropertyChanged* owner, const T& initial = T())
-        : name_(name), owner_(owner), value_(initial) {}
+        : value_(initial), name_(name), owner_(owner),
+          id_(owner ? owner->registerProperty(name) : -1) {}
     
     const T& get() const { return value_; }
+    int id() const { return id_; }
     
     void set(const T& newValue) {
         if (value_ != newValue) {
             value_ = newValue;
             if (owner_) {
-                owner_->notifyPropertyChanged(name_);
+                owner_->notifyPropertyChanged(id_);
             }
         }
     }
@@ -586,6 +779,94 @@ namespace FormValidation {
     };
 }
 
+// Example 4: Sensor Dashboard with batched bindings and derived properties
+namespace SensorDashboard {
+    // ViewModel
+    class SensorViewModel : public INotifyPropertyChanged {
+    private:
+        ObservableProperty<double> temperature_;
+        ObservableProperty<double> humidity_;
+        ObservableProperty<double> heatIndex_;
+        ObservableProperty<std::string> comfort_;
+        
+    public:
+        SensorViewModel()
+            : temperature_("Temperature", this, 20.0),
+              humidity_("Humidity", this, 50.0),
+              heatIndex_("HeatIndex", this, 20.0),
+              comfort_("Comfort", this, "Comfortable") {
+            
+            // Rounded to a tenth, so small input moves often leave it unchanged
+            addDerivedProperty({temperature_.id(), humidity_.id()}, [this] {
+                double t = temperature_.get(), h = humidity_.get();
+                heatIndex_.set(std::round((t + 0.05 * h * (t - 14.0) / 10.0) * 10.0) / 10.0);
+            });
+            addDerivedProperty({heatIndex_.id()}, [this] {
+                double hi = heatIndex_.get();
+                comfort_.set(hi < 27.0 ? "Comfortable" : hi < 32.0 ? "Caution" : "Extreme caution");
+            });
+        }
+        
+        void onReading(double temperature, double humidity) {
+            temperature_.set(temperature);
+            humidity_.set(humidity);
+        }
+        
+        const ObservableProperty<double>& getTemperature() const { return temperature_; }
+        const ObservableProperty<double>& getHumidity() const { return humidity_; }
+        const ObservableProperty<double>& getHeatIndex() const { return heatIndex_; }
+        const ObservableProperty<std::string>& getComfort() const { return comfort_; }
+    };
+    
+    // View; re-renders once per notification and rebinds only changed properties
+    class SensorView {
+    private:
+        SensorViewModel* viewModel_;
+        std::string readingsText_, heatIndexText_, comfortText_;
+        size_t renders_ = 0, bindingUpdates_ = 0;
+        
+    public:
+        explicit SensorView(SensorViewModel* vm) : viewModel_(vm) {
+            viewModel_->addPropertiesChangedHandler(
+                [this](const FieldSet& changed) {
+                    onPropertiesChanged(changed);
+                }
+            );
+        }
+        
+        void onPropertiesChanged(const FieldSet& changed) {
+            ++renders_;
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(1);
+            if (changed.contains(viewModel_->getTemperature().id()) ||
+                changed.contains(viewModel_->getHumidity().id())) {
+                oss << viewModel_->getTemperature().get() << " C, "
+                    << viewModel_->getHumidity().get() << "% RH";
+                readingsText_ = oss.str();
+                ++bindingUpdates_;
+            }
+            if (changed.contains(viewModel_->getHeatIndex().id())) {
+                oss.str("");
+                oss << "feels like " << viewModel_->getHeatIndex().get() << " C";
+                heatIndexText_ = oss.str();
+                ++bindingUpdates_;
+            }
+            if (changed.contains(viewModel_->getComfort().id())) {
+                comfortText_ = viewModel_->getComfort().get();
+                ++bindingUpdates_;
+            }
+        }
+        
+        void render() const {
+            std::cout << "  " << readingsText_ << " | " << heatIndexText_
+                      << " | " << comfortText_ << "\n";
+        }
+        
+        size_t renders() const { return renders_; }
+        size_t bindingUpdates() const { return bindingUpdates_; }
+    };
+}
+
 // Demo
 void demonstrateCounter() {
     std::cout << "=== Counter Application Demo ===\n";
@@ -659,12 +940,61 @@ void demonstrateFormValidation() {
     }
 }
 
+// One simulated minute of 2 kHz sensor readings bound three ways
+void demonstrateSensorDashboard() {
+    std::cout << "\n=== Sensor Dashboard Demo ===\n";
+    
+    const int readings = 120000;
+    const double dt = 0.5e-3;
+    
+    enum class Mode { PerAssignment, PerReading, Throttled };
+    auto run = [&](const char* label, Mode mode) {
+        SensorDashboard::SensorViewModel viewModel;
+        SensorDashboard::SensorView view(&viewModel);
+        
+        double simTime = 0.0;
+        viewModel.changes().setClock([&simTime] { return simTime; });
+        if (mode == Mode::Throttled) {
+            viewModel.changes().setMaxRefreshRate(25.0);
+        }
+        
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 1; i <= readings; ++i) {
+            simTime = i * dt;
+            double temperature = 24.0 + 8.0 * std::sin(simTime * 0.1) + 0.3 * std::sin(simTime * 40.0);
+            double humidity = 55.0 + 10.0 * std::cos(simTime * 0.05);
+            if (mode == Mode::PerAssignment) {
+                viewModel.onReading(temperature, humidity);
+            } else {
+                ChangeBatcher::Transaction frame(viewModel.changes());
+                viewModel.onReading(temperature, humidity);
+            }
+        }
+        viewModel.changes().flushNow();
+        double ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        
+        std::cout << std::left << std::setw(20) << label << std::right << ": "
+                  << view.renders() << " renders, "
+                  << view.bindingUpdates() << " binding updates, "
+                  << viewModel.changes().recomputes() << " derived recomputes, "
+                  << std::fixed << std::setprecision(1) << ms << " ms\n";
+        std::cout.unsetf(std::ios::fixed);
+        view.render();
+    };
+    
+    run("Per assignment", Mode::PerAssignment);
+    run("Frame per reading", Mode::PerReading);
+    run("Frames, 25 Hz cap", Mode::Throttled);
+}
+
 int main() {
     std::cout << "=== MVVM (Model-View-ViewModel) Pattern Demo ===\n\n";
     
     demonstrateCounter();
     demonstrateTodoList();
     demonstrateFormValidation();
+    demonstrateSensorDashboard();
     
     std::cout << "\n=== MVVM Pattern Characteristics ===\n";
     std::cout << "1. Data Binding between View and ViewModel\n";
@@ -9,6 +9,24 @@
 #include <cstring>
 #include <algorithm>
 #include <stdexcept>
+#include <atomic>
+#include <string>
+#include <map>
+#include <unordered_map>
+#include <functional>
+#include <iomanip>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <cstddef>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 // Example 1: File Handle RAII
 class FileHandle {
@@ -82,26 +100,38 @@ class MemoryBuffer {
 private:
     T* data_;
     size_t size_;
+    std::pmr::memory_resource* resource_;
+    
+    void release() {
+        if (data_) {
+            std::destroy_n(data_, size_);
+            resource_->deallocate(data_, size_ * sizeof(T), alignof(T));
+        }
+    }
     
 public:
-    // Acquire memory in constructor
-    explicit MemoryBuffer(size_t size) : size_(size), data_(nullptr) {
+    // Acquire memory in constructor; from the global heap unless a resource
+    // such as an Arena::MonotonicArena is passed
+    explicit MemoryBuffer(size_t size, std::pmr::memory_resource* resource = std::pmr::new_delete_resource())
+        : data_(nullptr), size_(size), resource_(resource) {
         if (size > 0) {
-            data_ = new T[size];
+            data_ = static_cast<T*>(resource_->allocate(size * sizeof(T), alignof(T)));
+            std::uninitialized_default_construct_n(data_, size);
             std::cout << "Allocated " << size << " elements of type " 
                       << typeid(T).name() << "\n";
         }
     }
     
     // Initialize with value
-    MemoryBuffer(size_t size, const T& value) : MemoryBuffer(size) {
+    MemoryBuffer(size_t size, const T& value, std::pmr::memory_resource* resource = std::pmr::new_delete_resource())
+        : MemoryBuffer(size, resource) {
         std::fill(data_, data_ + size_, value);
     }
     
     // Release memory in destructor
     ~MemoryBuffer() {
         if (data_) {
-            delete[] data_;
+            release();
             std::cout << "Deallocated " << size_ << " elements\n";
         }
     }
@@ -112,7 +142,7 @@ public:
     
     // Move constructor
     MemoryBuffer(MemoryBuffer&& other) noexcept
-        : data_(other.data_), size_(other.size_) {
+        : data_(other.data_), size_(other.size_), resource_(other.resource_) {
         other.data_ = nullptr;
         other.size_ = 0;
     }
@@ -120,9 +150,10 @@ public:
     // Move assignment
     MemoryBuffer& operator=(MemoryBuffer&& other) noexcept {
         if (this != &other) {
-            delete[] data_;
+            release();
             data_ = other.data_;
             size_ = other.size_;
+            resource_ = other.resource_;
             other.data_ = nullptr;
             other.size_ = 0;
         }
@@ -147,6 +178,7 @@ public:
     T* data() { return data_; }
     const T* data() const { return data_; }
     size_t size() const { return size_; }
+    std::pmr::memory_resource* resource() const { return resource_; }
 };
 
 // Example 3: Lock Guard RAII
@@ -419,6 +451,587 @@ public:
     size_t size() const { return size_; }
 };
 
+// Example 9: Profiler RAII
+// ScopedTimer prints a line per scope, which is too slow and too noisy for a
+// hot path. ProfileScope records the same interval into a per-thread buffer
+// instead; the Profiler aggregates and exports the events on demand.
+namespace Profiling {
+    // Raw timestamp: the TSC on x86, steady_clock nanoseconds elsewhere.
+    // Profiler::nsPerTick() converts.
+    inline uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+    
+    struct Event {
+        uint64_t start;
+        uint64_t end;
+        uint32_t name;    // interned name id
+        uint32_t depth;   // nesting depth on the recording thread, 0 = outermost
+    };
+    
+    // Events of one thread, kept in fixed-size chunks. Only the owning thread
+    // appends. A collector can walk the chunks at the same time, reading each
+    // chunk's published size. Chunks never move while recording, so an
+    // append is a plain store followed by a release store of the size.
+    class ThreadLog {
+    public:
+        static constexpr size_t kChunkEvents = 4096;
+        
+    private:
+        struct Chunk {
+            Event events[kChunkEvents];
+            std::atomic<size_t> size{0};
+            std::atomic<Chunk*> next{nullptr};
+        };
+        
+        Chunk* head_;
+        Chunk* tail_;   // owning thread only
+        uint32_t thread_;
+        
+    public:
+        explicit ThreadLog(uint32_t thread) : head_(new Chunk), tail_(head_), thread_(thread) {}
+        
+        ~ThreadLog() {
+            for (Chunk* chunk = head_; chunk; ) {
+                Chunk* next = chunk->next.load(std::memory_order_relaxed);
+                delete chunk;
+                chunk = next;
+            }
+        }
+        
+        ThreadLog(const ThreadLog&) = delete;
+        ThreadLog& operator=(const ThreadLog&) = delete;
+        
+        void append(const Event& event) {
+            size_t n = tail_->size.load(std::memory_order_relaxed);
+            if (n == kChunkEvents) {
+                // Chunks kept by clear() are refilled before new ones are allocated
+                Chunk* next = tail_->next.load(std::memory_order_relaxed);
+                if (!next) {
+                    next = new Chunk;
+                    tail_->next.store(next, std::memory_order_release);
+                }
+                tail_ = next;
+                n = 0;
+            }
+            tail_->events[n] = event;
+            tail_->size.store(n + 1, std::memory_order_release);
+        }
+        
+        template<typename Fn>
+        void forEach(Fn&& fn) const {
+            for (const Chunk* chunk = head_; chunk; chunk = chunk->next.load(std::memory_order_acquire)) {
+                size_t n = chunk->size.load(std::memory_order_acquire);
+                for (size_t i = 0; i < n; ++i) {
+                    fn(chunk->events[i]);
+                }
+            }
+        }
+        
+        // Empties the log but keeps its chunks, so steady-state recording
+        // does not allocate. Only while the owning thread is not inside a
+        // ProfileScope.
+        void clear() {
+            for (Chunk* chunk = head_; chunk; chunk = chunk->next.load(std::memory_order_relaxed)) {
+                chunk->size.store(0, std::memory_order_relaxed);
+            }
+            tail_ = head_;
+        }
+        
+        uint32_t thread() const { return thread_; }
+    };
+    
+    struct ScopeStats {
+        std::string name;
+        uint64_t count;
+        double totalNs, minNs, p50Ns, p99Ns, maxNs;
+    };
+    
+    // Scopes merged by call path across threads
+    struct CallTreeNode {
+        uint32_t name;
+        int parent;       // -1 for roots
+        uint32_t depth;
+        uint64_t count;
+        double totalNs;
+    };
+    
+    class Profiler {
+    public:
+        struct ThreadState {
+            ThreadLog* log;
+            uint32_t depth;
+        };
+        
+    private:
+        static inline thread_local ThreadState threadState_{nullptr, 0};
+        
+        // Guards registration and collection; never taken on the hot path
+        std::mutex mutex_;
+        std::vector<std::string> names_;
+        std::unordered_map<std::string, uint32_t> nameIds_;
+        std::vector<std::unique_ptr<ThreadLog>> logs_;
+        static inline std::atomic<bool> enabled_{true};
+        uint64_t originTicks_;
+        std::chrono::steady_clock::time_point originTime_;
+        
+        Profiler() : originTicks_(ticks()), originTime_(std::chrono::steady_clock::now()) {}
+        
+        ThreadLog* registerThread() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            logs_.push_back(std::make_unique<ThreadLog>(static_cast<uint32_t>(logs_.size())));
+            return logs_.back().get();
+        }
+        
+        // Events of every thread, grouped by thread; caller holds mutex_
+        std::vector<std::vector<Event>> snapshot() const {
+            std::vector<std::vector<Event>> events;
+            for (const auto& log : logs_) {
+                events.emplace_back();
+                log->forEach([&](const Event& e) { events.back().push_back(e); });
+            }
+            return events;
+        }
+        
+        // TSC rate measured against steady_clock since the profiler started
+        double nsPerTick() const {
+#if defined(__x86_64__) || defined(__i386__)
+            auto minSpan = std::chrono::milliseconds(10);
+            while (std::chrono::steady_clock::now() - originTime_ < minSpan) {}
+            uint64_t t = ticks();
+            double ns = std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - originTime_).count();
+            return ns / static_cast<double>(t - originTicks_);
+#else
+            return 1.0;
+#endif
+        }
+        
+    public:
+        static Profiler& instance() {
+            static Profiler profiler;
+            return profiler;
+        }
+        
+        // Same name, same id, whichever call site asks
+        uint32_t intern(const char* name) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto [it, inserted] = nameIds_.try_emplace(name, static_cast<uint32_t>(names_.size()));
+            if (inserted) {
+                names_.push_back(name);
+            }
+            return it->second;
+        }
+        
+        static ThreadState& threadState() {
+            ThreadState& state = threadState_;
+            if (!state.log) {
+                state.log = instance().registerThread();
+            }
+            return state;
+        }
+        
+        static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+        static void setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+        
+        size_t eventCount() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            size_t count = 0;
+            for (const auto& log : logs_) {
+                log->forEach([&](const Event&) { ++count; });
+            }
+            return count;
+        }
+        
+        // Drop all events; only while no thread is inside a ProfileScope
+        void reset() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& log : logs_) {
+                log->clear();
+            }
+        }
+        
+        // Count, total, min, max and percentiles per scope name, busiest first
+        std::vector<ScopeStats> aggregate() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            double scale = nsPerTick();
+            std::vector<std::vector<double>> durations(names_.size());
+            for (const auto& threadEvents : snapshot()) {
+                for (const Event& e : threadEvents) {
+                    durations[e.name].push_back(static_cast<double>(e.end - e.start) * scale);
+                }
+            }
+            
+            std::vector<ScopeStats> stats;
+            for (uint32_t id = 0; id < durations.size(); ++id) {
+                auto& d = durations[id];
+                if (d.empty()) continue;
+                auto percentile = [&d](double p) {
+                    auto nth = d.begin() + static_cast<ptrdiff_t>(p * static_cast<double>(d.size() - 1));
+                    std::nth_element(d.begin(), nth, d.end());
+                    return *nth;
+                };
+                ScopeStats s{names_[id], d.size(), 0.0,
+                             *std::min_element(d.begin(), d.end()), percentile(0.50),
+                             percentile(0.99), *std::max_element(d.begin(), d.end())};
+                for (double ns : d) s.totalNs += ns;
+                stats.push_back(s);
+            }
+            std::sort(stats.begin(), stats.end(),
+                [](const ScopeStats& a, const ScopeStats& b) { return a.totalNs > b.totalNs; });
+            return stats;
+        }
+        
+        // Rebuilds nesting from start times and depths; a scope recorded
+        // while its parent was still open becomes a root
+        std::vector<CallTreeNode> callTree() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            double scale = nsPerTick();
+            std::vector<CallTreeNode> nodes;
+            std::map<std::pair<int, uint32_t>, int> index;
+            for (auto& threadEvents : snapshot()) {
+                std::sort(threadEvents.begin(), threadEvents.end(), [](const Event& a, const Event& b) {
+                    return a.start != b.start ? a.start < b.start : a.depth < b.depth;
+                });
+                std::vector<std::pair<uint32_t, int>> open;   // (depth, node)
+                for (const Event& e : threadEvents) {
+                    while (!open.empty() && open.back().first >= e.depth) {
+                        open.pop_back();
+                    }
+                    int parent = open.empty() ? -1 : open.back().second;
+                    auto [it, inserted] = index.try_emplace({parent, e.name}, static_cast<int>(nodes.size()));
+                    if (inserted) {
+                        uint32_t depth = parent < 0 ? 0 : nodes[parent].depth + 1;
+                        nodes.push_back({e.name, parent, depth, 0, 0.0});
+                    }
+                    nodes[it->second].count++;
+                    nodes[it->second].totalNs += static_cast<double>(e.end - e.start) * scale;
+                    open.push_back({e.depth, it->second});
+                }
+            }
+            return nodes;
+        }
+        
+        const std::string& name(uint32_t id) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return names_[id];
+        }
+        
+        void printReport(std::ostream& out) {
+            auto stats = aggregate();
+            out << std::left << std::setw(18) << "Scope" << std::right
+                << std::setw(9) << "Count" << std::setw(11) << "Total ms"
+                << std::setw(10) << "Min us" << std::setw(10) << "p50 us"
+                << std::setw(10) << "p99 us" << std::setw(10) << "Max us" << "\n";
+            out << std::fixed;
+            for (const auto& s : stats) {
+                out << std::left << std::setw(18) << s.name << std::right
+                    << std::setw(9) << s.count
+                    << std::setw(11) << std::setprecision(2) << s.totalNs / 1e6
+                    << std::setw(10) << std::setprecision(1) << s.minNs / 1e3
+                    << std::setw(10) << s.p50Ns / 1e3
+                    << std::setw(10) << s.p99Ns / 1e3
+                    << std::setw(10) << s.maxNs / 1e3 << "\n";
+            }
+            
+            auto tree = callTree();
+            out << "\nCall tree (total ms, calls):\n";
+            std::function<void(int)> printChildren = [&](int parent) {
+                for (int i = 0; i < static_cast<int>(tree.size()); ++i) {
+                    if (tree[i].parent != parent) continue;
+                    out << std::string(2 + 2 * tree[i].depth, ' ') << name(tree[i].name) << "  "
+                        << std::setprecision(2) << tree[i].totalNs / 1e6 << " ms, "
+                        << tree[i].count << "\n";
+                    printChildren(i);
+                }
+            };
+            printChildren(-1);
+            out.unsetf(std::ios::fixed);
+        }
+        
+        // Chrome trace event format; load in chrome://tracing or Perfetto
+        void writeChromeTrace(std::ostream& out) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            double scale = nsPerTick();
+            auto escaped = [](const std::string& s) {
+                std::string r;
+                for (char c : s) {
+                    if (c == '"' || c == '\\') r += '\\';
+                    r += c;
+                }
+                return r;
+            };
+            
+            out << "{\"traceEvents\":[";
+            bool first = true;
+            auto events = snapshot();
+            out << std::fixed << std::setprecision(3);
+            for (size_t t = 0; t < events.size(); ++t) {
+                out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                    << logs_[t]->thread() << ",\"args\":{\"name\":\"thread " << logs_[t]->thread() << "\"}}";
+                first = false;
+                for (const Event& e : events[t]) {
+                    double ts = static_cast<double>(e.start - originTicks_) * scale / 1e3;
+                    double dur = static_cast<double>(e.end - e.start) * scale / 1e3;
+                    out << ",\n{\"name\":\"" << escaped(names_[e.name]) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+                        << logs_[t]->thread() << ",\"ts\":" << ts << ",\"dur\":" << dur << "}";
+                }
+            }
+            out << "\n]}\n";
+            out.unsetf(std::ios::fixed);
+        }
+    };
+    
+    // One per PROFILE_SCOPE call site. It interns its name the first time
+    // the site runs, so the hot path carries only a 32-bit id.
+    struct ScopeSite {
+        uint32_t id;
+        explicit ScopeSite(const char* name) : id(Profiler::instance().intern(name)) {}
+    };
+    
+    class ProfileScope {
+    private:
+        uint64_t start_;
+        Profiler::ThreadState* state_;
+        uint32_t name_;
+        uint32_t depth_;
+        
+    public:
+        // Take the timestamp last, so setup is not billed to the scope
+        explicit ProfileScope(const ScopeSite& site)
+            : state_(Profiler::enabled() ? &Profiler::threadState() : nullptr), name_(site.id) {
+            if (state_) {
+                depth_ = state_->depth++;
+                start_ = ticks();
+            }
+        }
+        
+        ~ProfileScope() {
+            if (state_) {
+                uint64_t end = ticks();
+                state_->depth = depth_;
+                state_->log->append({start_, end, name_, depth_});
+            }
+        }
+        
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+    };
+}
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) \
+    static const Profiling::ScopeSite PROFILE_CONCAT(profileSite_, __LINE__)(name); \
+    Profiling::ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(PROFILE_CONCAT(profileSite_, __LINE__))
+
+// Example 10: Arena Allocator RAII
+// Scratch memory that lives for one step of a computation. Allocation is a
+// pointer bump, freeing is a no-op, and a ScopedArena hands the whole step's
+// memory back in one move when it goes out of scope. Every arena is a
+// std::pmr::memory_resource, so pmr containers and MemoryBuffer opt in by
+// taking a pointer to one.
+namespace Arena {
+    constexpr size_t kCacheLine = 64;
+    constexpr size_t kHugePage = size_t(2) << 20;
+    
+    struct ArenaOptions {
+        size_t blockBytes = 256 * 1024;                 // first block; later ones double
+        size_t minAlignment = alignof(std::max_align_t); // kCacheLine for SIMD/false-sharing safety
+        bool useMmap = false;                           // map blocks directly from the OS
+        bool hugePages = false;                         // MADV_HUGEPAGE on mapped blocks
+        int numaNode = -1;                              // prefer this node for mapped blocks
+    };
+    
+    // One backing block; mapped from the OS or taken from an upstream resource
+    class Block {
+    private:
+        char* data_ = nullptr;
+        size_t size_ = 0;
+        void* mapping_ = nullptr;
+        size_t mappingSize_ = 0;
+        std::pmr::memory_resource* upstream_ = nullptr;
+        size_t alignment_ = kCacheLine;
+        bool hugePages_ = false;
+        bool numaBound_ = false;
+        
+    public:
+        Block(size_t size, const ArenaOptions& options, std::pmr::memory_resource* upstream) : size_(size) {
+#if defined(__linux__)
+            if (options.useMmap || options.hugePages || options.numaNode >= 0) {
+                // Huge pages need 2 MiB alignment, so over-map and trim
+                size_t align = options.hugePages ? kHugePage : 4096;
+                size_ = (size + align - 1) / align * align;
+                mappingSize_ = size_ + align;
+                mapping_ = mmap(nullptr, mappingSize_, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (mapping_ == MAP_FAILED) {
+                    throw std::bad_alloc();
+                }
+                auto start = reinterpret_cast<uintptr_t>(mapping_);
+                data_ = reinterpret_cast<char*>((start + align - 1) / align * align);
+                if (options.hugePages) {
+                    hugePages_ = madvise(data_, size_, MADV_HUGEPAGE) == 0;
+                }
+                if (options.numaNode >= 0 && options.numaNode < 64) {
+                    const int kMpolPreferred = 1;
+                    unsigned long nodeMask = 1UL << options.numaNode;
+                    numaBound_ = syscall(SYS_mbind, data_, size_, kMpolPreferred,
+                                         &nodeMask, 64, 0) == 0;
+                }
+                return;
+            }
+#endif
+            upstream_ = upstream;
+            alignment_ = std::max(options.minAlignment, kCacheLine);
+            data_ = static_cast<char*>(upstream_->allocate(size_, alignment_));
+        }
+        
+        ~Block() {
+            if (!data_) return;
+            if (upstream_) {
+                upstream_->deallocate(data_, size_, alignment_);
+            }
+#if defined(__linux__)
+            else {
+                munmap(mapping_, mappingSize_);
+            }
+#endif
+        }
+        
+        Block(const Block&) = delete;
+        Block& operator=(const Block&) = delete;
+        
+        Block(Block&& other) noexcept
+            : data_(other.data_), size_(other.size_), mapping_(other.mapping_),
+              mappingSize_(other.mappingSize_), upstream_(other.upstream_),
+              alignment_(other.alignment_), hugePages_(other.hugePages_), numaBound_(other.numaBound_) {
+            other.data_ = nullptr;
+        }
+        
+        Block& operator=(Block&&) = delete;
+        
+        char* data() const { return data_; }
+        size_t size() const { return size_; }
+        bool hugePages() const { return hugePages_; }
+        bool numaBound() const { return numaBound_; }
+    };
+    
+    // Bump allocator over a growing list of blocks. deallocate() is a no-op;
+    // memory comes back through rewind() or release(). Blocks are kept on
+    // rewind, so a steady-state loop stops talking to the OS after its first
+    // pass. Not thread-safe; give each thread its own (see threadArena()).
+    class MonotonicArena : public std::pmr::memory_resource {
+    public:
+        struct Marker {
+            size_t block;
+            size_t offset;
+        };
+        
+    private:
+        ArenaOptions options_;
+        std::pmr::memory_resource* upstream_;
+        std::vector<Block> blocks_;
+        size_t current_ = 0;   // block being bumped
+        size_t offset_ = 0;    // next free byte in it
+        size_t before_ = 0;    // bytes in blocks before current_
+        size_t highWater_ = 0;
+        
+        void moveTo(size_t block, size_t offset) {
+            before_ = 0;
+            for (size_t i = 0; i < block; ++i) before_ += blocks_[i].size();
+            current_ = block;
+            offset_ = offset;
+        }
+        
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            alignment = std::max(alignment, options_.minAlignment);
+            while (current_ < blocks_.size()) {
+                auto base = reinterpret_cast<uintptr_t>(blocks_[current_].data());
+                size_t aligned = ((base + offset_ + alignment - 1) & ~(alignment - 1)) - base;
+                if (aligned + bytes <= blocks_[current_].size()) {
+                    offset_ = aligned + bytes;
+                    highWater_ = std::max(highWater_, before_ + offset_);
+                    return blocks_[current_].data() + aligned;
+                }
+                if (current_ + 1 == blocks_.size()) break;
+                before_ += blocks_[current_].size();
+                ++current_;
+                offset_ = 0;
+            }
+            size_t grow = blocks_.empty() ? options_.blockBytes : blocks_.back().size() * 2;
+            blocks_.emplace_back(std::max(grow, bytes + alignment), options_, upstream_);
+            moveTo(blocks_.size() - 1, 0);
+            return do_allocate(bytes, alignment);
+        }
+        
+        void do_deallocate(void*, size_t, size_t) override {}
+        
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+        
+    public:
+        explicit MonotonicArena(ArenaOptions options = {},
+                                std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+            : options_(options), upstream_(upstream) {}
+        
+        MonotonicArena(const MonotonicArena&) = delete;
+        MonotonicArena& operator=(const MonotonicArena&) = delete;
+        
+        Marker mark() const { return {current_, offset_}; }
+        
+        // Everything allocated since `marker` becomes free again
+        void rewind(Marker marker) {
+            moveTo(marker.block, marker.offset);
+        }
+        
+        // Returns all blocks to the OS or upstream
+        void release() {
+            blocks_.clear();
+            current_ = offset_ = before_ = 0;
+        }
+        
+        size_t blockCount() const { return blocks_.size(); }
+        size_t reservedBytes() const {
+            size_t total = 0;
+            for (const auto& block : blocks_) total += block.size();
+            return total;
+        }
+        size_t highWaterBytes() const { return highWater_; }
+        bool hugePages() const { return !blocks_.empty() && blocks_.front().hugePages(); }
+        bool numaBound() const { return !blocks_.empty() && blocks_.front().numaBound(); }
+    };
+    
+    // Rewinds the arena to where it was on entry
+    class ScopedArena {
+    private:
+        MonotonicArena& arena_;
+        MonotonicArena::Marker marker_;
+        
+    public:
+        explicit ScopedArena(MonotonicArena& arena) : arena_(arena), marker_(arena.mark()) {}
+        ~ScopedArena() { arena_.rewind(marker_); }
+        
+        ScopedArena(const ScopedArena&) = delete;
+        ScopedArena& operator=(const ScopedArena&) = delete;
+        
+        std::pmr::memory_resource* resource() { return &arena_; }
+    };
+    
+    // Per-thread scratch arena with cache-line aligned allocations
+    inline MonotonicArena& threadArena() {
+        thread_local MonotonicArena arena(ArenaOptions{256 * 1024, kCacheLine});
+        return arena;
+    }
+}
+
 // Demo functions
 void demonstrateFileHandling() {
     std::cout << "=== File Handling RAII ===\n";
@@ -541,6 +1154,200 @@ void demonstrateScopedTimer() {
     }
 }
 
+// Small Jacobi solve, instrumented the way a solver in a pool would be
+double solveInstrumented(int size, int sweeps) {
+    PROFILE_SCOPE("task");
+    std::vector<double> x(size, 0.0), next(size), rhs(size);
+    {
+        PROFILE_SCOPE("assemble");
+        for (int i = 0; i < size; ++i) {
+            rhs[i] = 1.0 + 0.001 * i;
+        }
+    }
+    {
+        PROFILE_SCOPE("solve");
+        for (int sweep = 0; sweep < sweeps; ++sweep) {
+            PROFILE_SCOPE("jacobi sweep");
+            for (int i = 0; i < size; ++i) {
+                double left = i > 0 ? x[i - 1] : 0.0;
+                double right = i + 1 < size ? x[i + 1] : 0.0;
+                next[i] = (rhs[i] + left + right) / 4.0;
+            }
+            x.swap(next);
+        }
+    }
+    return x[size / 2];
+}
+
+void demonstrateProfiler() {
+    std::cout << "\n=== Profiler RAII ===\n";
+    auto& profiler = Profiling::Profiler::instance();
+    
+    // Per-scope cost: an empty scope in a tight loop against the bare loop
+    const int iterations = 1000000;
+    volatile uint64_t sink = 0;
+    auto timeLoop = [&](auto&& body) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            body(i);
+        }
+        return std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / iterations;
+    };
+    auto probe = [&](int i) {
+        PROFILE_SCOPE("overhead probe");
+        sink = sink + i;
+    };
+    timeLoop(probe);        // first pass allocates the chunks
+    profiler.reset();
+    double bare = timeLoop([&](int i) { sink = sink + i; });
+    double stamp = timeLoop([&](int) { sink = sink + Profiling::ticks(); }) - bare;
+    double profiled = timeLoop(probe);
+    profiler.setEnabled(false);
+    double disabled = timeLoop(probe);
+    profiler.setEnabled(true);
+    std::cout << std::fixed << std::setprecision(1)
+              << "Scope overhead: " << profiled - bare << " ns enabled, "
+              << disabled - bare << " ns disabled (" << profiler.eventCount()
+              << " events recorded; one timestamp read costs " << stamp << " ns here)\n";
+    std::cout.unsetf(std::ios::fixed);
+    profiler.reset();
+    
+    // Worker pool pulling solver tasks from a shared queue
+    const int workers = 4, tasks = 64;
+    std::mutex queueMutex;
+    int nextTask = 0;
+    std::vector<std::thread> pool;
+    std::atomic<double> checksum{0.0};
+    for (int w = 0; w < workers; ++w) {
+        pool.emplace_back([&] {
+            PROFILE_SCOPE("worker");
+            while (true) {
+                int task;
+                {
+                    PROFILE_SCOPE("queue pop");
+                    std::lock_guard<std::mutex> lock(queueMutex);
+                    if (nextTask == tasks) break;
+                    task = nextTask++;
+                }
+                double value = solveInstrumented(2000 + 100 * (task % 8), 40);
+                double seen = checksum.load();
+                while (!checksum.compare_exchange_weak(seen, seen + value)) {}
+            }
+        });
+    }
+    for (auto& t : pool) {
+        t.join();
+    }
+    
+    std::cout << workers << " workers solved " << tasks << " tasks, "
+              << profiler.eventCount() << " events\n\n";
+    profiler.printReport(std::cout);
+    
+    std::ofstream trace("profile_trace.json");
+    profiler.writeChromeTrace(trace);
+    std::cout << "\nChrome trace written to profile_trace.json (" << trace.tellp() << " bytes)\n";
+}
+
+// One timestep's scratch work: a few workspaces sized per step plus a
+// growing event list. The code is the same whichever resource backs it.
+double timestepScratch(int step, std::pmr::memory_resource* resource) {
+    size_t n = 64 + static_cast<size_t>(step * 37) % 2048;
+    std::pmr::vector<double> state(n, resource);
+    std::pmr::vector<double> flux(n, resource);
+    std::pmr::vector<double> residual(n, resource);
+    std::pmr::vector<int> events(resource);
+    for (size_t i = 0; i < n; ++i) {
+        state[i] = static_cast<double>((i * 7 + static_cast<size_t>(step)) % 13) * 0.1;
+    }
+    for (size_t i = 1; i + 1 < n; ++i) {
+        flux[i] = 0.5 * (state[i + 1] - state[i - 1]);
+        residual[i] = state[i] - flux[i];
+        if (residual[i] < 1.0) events.push_back(static_cast<int>(i));
+    }
+    return residual[n / 2] + static_cast<double>(events.size());
+}
+
+void demonstrateArenas() {
+    std::cout << "\n=== Arena Allocator RAII ===\n";
+    
+    // MemoryBuffer opts in by taking the arena as its resource
+    Arena::MonotonicArena aligned(Arena::ArenaOptions{64 * 1024, Arena::kCacheLine});
+    {
+        MemoryBuffer<float> buffer(1000, 0.5f, &aligned);
+        std::cout << "Arena-backed buffer is "
+                  << (reinterpret_cast<uintptr_t>(buffer.data()) % Arena::kCacheLine == 0 ? "" : "not ")
+                  << "64-byte aligned\n";
+    }
+    
+    const int steps = 20000;
+    // Best of three passes
+    auto run = [&](const char* label, auto&& stepResource) {
+        double checksum = 0.0, ms = 0.0;
+        for (int pass = 0; pass < 3; ++pass) {
+            checksum = 0.0;
+            auto start = std::chrono::steady_clock::now();
+            for (int step = 0; step < steps; ++step) {
+                checksum += stepResource(step);
+            }
+            double passMs = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count();
+            ms = pass == 0 ? passMs : std::min(ms, passMs);
+        }
+        std::cout << std::left << std::setw(26) << label << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(7) << ms << " ms (checksum "
+                  << std::setprecision(0) << checksum << ")\n";
+        std::cout.unsetf(std::ios::fixed);
+    };
+    
+    std::cout << steps << " timesteps, 4 scratch vectors each (best of 3):\n";
+    run("Global heap", [](int step) {
+        return timestepScratch(step, std::pmr::new_delete_resource());
+    });
+    run("Thread arena, rewound", [](int step) {
+        Arena::ScopedArena scope(Arena::threadArena());
+        return timestepScratch(step, scope.resource());
+    });
+    
+    Arena::ArenaOptions mapped;
+    mapped.blockBytes = Arena::kHugePage;
+    mapped.minAlignment = Arena::kCacheLine;
+    mapped.hugePages = true;
+    mapped.numaNode = 0;
+    Arena::MonotonicArena hugeArena(mapped);
+    run("mmap + huge pages, rewound", [&hugeArena](int step) {
+        Arena::ScopedArena scope(hugeArena);
+        return timestepScratch(step, scope.resource());
+    });
+    
+    const auto& threadArena = Arena::threadArena();
+    std::cout << "Thread arena: " << threadArena.blockCount() << " block(s), "
+              << threadArena.reservedBytes() / 1024 << " KiB reserved, high water "
+              << threadArena.highWaterBytes() / 1024 << " KiB\n";
+    std::cout << "Mapped arena: " << hugeArena.blockCount() << " block(s), "
+              << hugeArena.reservedBytes() / 1024 << " KiB reserved, MADV_HUGEPAGE "
+              << (hugeArena.hugePages() ? "accepted" : "refused") << ", NUMA node 0 preference "
+              << (hugeArena.numaBound() ? "set" : "not set") << "\n";
+    
+    // Each worker gets its own arena; no locks, no shared free lists
+    std::vector<std::thread> workers;
+    std::vector<size_t> blocks(4);
+    for (int w = 0; w < 4; ++w) {
+        workers.emplace_back([w, &blocks, steps] {
+            for (int step = w; step < steps; step += 4) {
+                Arena::ScopedArena scope(Arena::threadArena());
+                timestepScratch(step, scope.resource());
+            }
+            blocks[w] = Arena::threadArena().blockCount();
+        });
+    }
+    for (auto& t : workers) {
+        t.join();
+    }
+    std::cout << "4 workers on thread arenas: " << blocks[0] << "/" << blocks[1] << "/"
+              << blocks[2] << "/" << blocks[3] << " block(s) each\n";
+}
+
 int main() {
     std::cout << "=== RAII (Resource Acquisition Is Initialization) Pattern Demo ===\n\n";
     
@@ -549,6 +1356,8 @@ int main() {
     demonstrateLocking();
     demonstrateDatabaseTransaction();
     demonstrateScopedTimer();
+    demonstrateProfiler();
+    demonstrateArenas();
     
     std::cout << "\n=== RAII Benefits ===\n";
     std::cout << "1. Automatic resource management\n";
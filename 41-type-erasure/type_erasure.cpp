@@ -6,6 +6,32 @@
 #include <functional>
 #include <typeinfo>
 #include <any>
+#include <array>
+#include <tuple>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <iomanip>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Counts heap allocations so the demo can report allocations per task
+static std::atomic<size_t> g_heapAllocations{0};
+
+void* operator new(std::size_t size) {
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
 
 // Example 1: Basic Type Erasure for Drawable Objects
 namespace BasicTypeErasure {
@@ -320,8 +346,8 @@ namespace AdvancedTypeErasure {
         };
         
         template<typename T>
-        static constexpr VTable vtableFor() {
-            return VTable{
+        static const VTable* vtableFor() {
+            static constexpr VTable table{
                 [](void* p) { static_cast<T*>(p)->~T(); },
                 [](const void* src, void* dst) { 
                     new(dst) T(*static_cast<const T*>(src)); 
@@ -331,6 +357,7 @@ namespace AdvancedTypeErasure {
                 },
                 []() -> const std::type_info* { return &typeid(T); }
             };
+            return &table;
         }
         
         const VTable* vtable_ = nullptr;
@@ -344,7 +371,7 @@ namespace AdvancedTypeErasure {
             static_assert(alignof(T) <= alignof(std::max_align_t), "Type has excessive alignment");
             
             new(buffer_) std::decay_t<T>(std::forward<T>(value));
-            vtable_ = &vtableFor<std::decay_t<T>>();
+            vtable_ = vtableFor<std::decay_t<T>>();
         }
         
         ~AnySmall() {
@@ -382,6 +409,152 @@ namespace AdvancedTypeErasure {
             return vtable_ ? *vtable_->type() : typeid(void);
         }
     };
+    
+    // Move-only callable with an inline buffer, grown from AnySmall's
+    // hand-rolled vtable. A callable that fits in InlineBytes, is no more
+    // aligned than max_align_t and has a nothrow move lives in the buffer;
+    // anything else goes to the heap, with only its pointer in the buffer.
+    // Being move-only, it can hold std::packaged_task and unique_ptr
+    // captures, which std::function cannot.
+    template<typename Signature, size_t InlineBytes = 48>
+    class UniqueFunction;
+    
+    template<typename R, typename... Args, size_t InlineBytes>
+    class UniqueFunction<R(Args...), InlineBytes> {
+    private:
+        static_assert(InlineBytes >= sizeof(void*), "Buffer must hold at least a pointer");
+        
+        struct VTable {
+            R (*invoke)(void*, Args&&...);
+            // Move into dst and destroy src; null when copying the buffer bytes is enough
+            void (*relocate)(void* src, void* dst) noexcept;
+            // Null when there is nothing to destroy
+            void (*destroy)(void*) noexcept;
+            bool inlineStored;
+        };
+        
+        template<typename F>
+        static constexpr bool fitsInline = sizeof(F) <= InlineBytes
+            && alignof(F) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<F>;
+        
+        // Trivially relocatable: moving is a byte copy and destruction a no-op
+        template<typename F>
+        static constexpr bool trivial = std::is_trivially_copyable_v<F>
+            && std::is_trivially_destructible_v<F>;
+        
+        template<typename F>
+        static R call(F& f, Args&&... args) {
+            if constexpr (std::is_void_v<R>) {
+                f(std::forward<Args>(args)...);
+            } else {
+                return f(std::forward<Args>(args)...);
+            }
+        }
+        
+        template<typename F>
+        static F& inlineObject(void* buffer) {
+            return *std::launder(static_cast<F*>(buffer));
+        }
+        
+        template<typename F>
+        static F*& heapObject(void* buffer) {
+            return *std::launder(static_cast<F**>(buffer));
+        }
+        
+        template<typename F>
+        static const VTable* vtableFor() {
+            if constexpr (fitsInline<F>) {
+                static constexpr VTable table{
+                    [](void* buffer, Args&&... args) -> R {
+                        return call(inlineObject<F>(buffer), std::forward<Args>(args)...);
+                    },
+                    trivial<F> ? nullptr : +[](void* src, void* dst) noexcept {
+                        F& from = inlineObject<F>(src);
+                        new(dst) F(std::move(from));
+                        from.~F();
+                    },
+                    trivial<F> ? nullptr : +[](void* buffer) noexcept {
+                        inlineObject<F>(buffer).~F();
+                    },
+                    true
+                };
+                return &table;
+            } else {
+                // The buffer holds a pointer, which is trivially relocatable
+                static constexpr VTable table{
+                    [](void* buffer, Args&&... args) -> R {
+                        return call(*heapObject<F>(buffer), std::forward<Args>(args)...);
+                    },
+                    nullptr,
+                    [](void* buffer) noexcept { delete heapObject<F>(buffer); },
+                    false
+                };
+                return &table;
+            }
+        }
+        
+        alignas(std::max_align_t) unsigned char buffer_[InlineBytes];
+        const VTable* vtable_ = nullptr;
+        
+        void moveFrom(UniqueFunction& other) noexcept {
+            vtable_ = other.vtable_;
+            if (vtable_) {
+                if (vtable_->relocate) {
+                    vtable_->relocate(other.buffer_, buffer_);
+                } else {
+                    std::memcpy(buffer_, other.buffer_, InlineBytes);
+                }
+                other.vtable_ = nullptr;
+            }
+        }
+        
+    public:
+        UniqueFunction() noexcept = default;
+        UniqueFunction(std::nullptr_t) noexcept {}
+        
+        template<typename F, typename D = std::decay_t<F>,
+                 typename = std::enable_if_t<!std::is_same_v<D, UniqueFunction> &&
+                                             std::is_invocable_r_v<R, D&, Args...>>>
+        UniqueFunction(F&& f) {
+            if constexpr (fitsInline<D>) {
+                new(buffer_) D(std::forward<F>(f));
+            } else {
+                new(buffer_) D*(new D(std::forward<F>(f)));
+            }
+            vtable_ = vtableFor<D>();
+        }
+        
+        UniqueFunction(UniqueFunction&& other) noexcept { moveFrom(other); }
+        
+        UniqueFunction& operator=(UniqueFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+        
+        UniqueFunction(const UniqueFunction&) = delete;
+        UniqueFunction& operator=(const UniqueFunction&) = delete;
+        
+        ~UniqueFunction() { reset(); }
+        
+        void reset() noexcept {
+            if (vtable_ && vtable_->destroy) {
+                vtable_->destroy(buffer_);
+            }
+            vtable_ = nullptr;
+        }
+        
+        R operator()(Args... args) {
+            return vtable_->invoke(buffer_, std::forward<Args>(args)...);
+        }
+        
+        explicit operator bool() const noexcept { return vtable_ != nullptr; }
+        bool isInline() const noexcept { return vtable_ && vtable_->inlineStored; }
+        bool isTriviallyRelocatable() const noexcept { return vtable_ && !vtable_->relocate; }
+    };
 }
 
 // Example 5: Visitor Pattern with Type Erasure
@@ -554,6 +727,67 @@ void demonstrateAdvancedTypeErasure() {
     }
 }
 
+void demonstrateUniqueFunction() {
+    using namespace AdvancedTypeErasure;
+    
+    std::cout << "\n=== Move-Only UniqueFunction ===\n";
+    
+    // Holds callables std::function cannot: packaged_task and unique_ptr captures
+    std::packaged_task<int()> answer([] { return 42; });
+    std::future<int> result = answer.get_future();
+    UniqueFunction<void()> task(std::move(answer));
+    UniqueFunction<void()> moved(std::move(task));
+    moved();
+    std::cout << "packaged_task result: " << result.get() << " (inline: "
+              << (moved.isInline() ? "yes" : "no") << ")\n";
+    
+    auto owned = std::make_unique<std::string>("owned capture");
+    UniqueFunction<size_t()> length([p = std::move(owned)] { return p->size(); });
+    std::cout << "unique_ptr capture length: " << length() << "\n";
+    
+    int a = 1, b = 2, c = 3, d = 4;
+    UniqueFunction<int(int)> fourPointers([&a, &b, &c, &d](int x) { return x + a + b + c + d; });
+    std::cout << "Four-pointer capture: inline " << (fourPointers.isInline() ? "yes" : "no")
+              << ", trivially relocatable " << (fourPointers.isTriviallyRelocatable() ? "yes" : "no")
+              << ", result " << fourPointers(10) << "\n";
+    
+    std::array<double, 16> coefficients{};
+    UniqueFunction<double()> large([coefficients] { return coefficients[0]; });
+    std::cout << "128-byte capture: inline " << (large.isInline() ? "yes" : "no") << "\n";
+    
+    // Queue-style churn: build, move into storage, invoke
+    const int tasks = 200000;
+    auto churn = [&](auto tag) {
+        using Task = typename decltype(tag)::type;
+        std::vector<Task> queue;
+        queue.reserve(tasks);
+        long long sum = 0;
+        size_t before = g_heapAllocations.load(std::memory_order_relaxed);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < tasks; ++i) {
+            int* pa = &a; int* pb = &b; int* pc = &c;
+            queue.emplace_back([pa, pb, pc, i, &sum] { sum += *pa + *pb + *pc + i; });
+        }
+        for (auto& t : queue) {
+            t();
+        }
+        queue.clear();
+        double ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        size_t allocations = g_heapAllocations.load(std::memory_order_relaxed) - before;
+        return std::make_tuple(ms, static_cast<double>(allocations) / tasks, sum);
+    };
+    
+    auto [fnMs, fnAllocs, fnSum] = churn(std::common_type<std::function<void()>>{});
+    auto [ufMs, ufAllocs, ufSum] = churn(std::common_type<UniqueFunction<void()>>{});
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << tasks << " tasks capturing four pointers and an int:\n";
+    std::cout << "  std::function<void()>  " << fnAllocs << " allocations/task, " << fnMs << " ms\n";
+    std::cout << "  UniqueFunction<void()> " << ufAllocs << " allocations/task, " << ufMs << " ms\n";
+    std::cout << "  Same results: " << (fnSum == ufSum ? "yes" : "no") << "\n";
+    std::cout.unsetf(std::ios::fixed);
+}
+
 void demonstrateVisitorTypeErasure() {
     using namespace VisitorTypeErasure;
     
@@ -583,6 +817,7 @@ int main() {
     demonstrateMultiMethodTypeErasure();
     demonstrateFunctionTypeErasure();
     demonstrateAdvancedTypeErasure();
+    demonstrateUniqueFunction();
     demonstrateVisitorTypeErasure();
     
     std::cout << "\n=== Type Erasure Benefits ===\n";
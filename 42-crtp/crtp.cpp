@@ -6,6 +6,9 @@
 #include <cmath>
 #include <memory>
 #include <algorithm>
+#include <numeric>
+#include <iomanip>
+#include <thread>
 
 // Define M_PI for MSVC
 #ifndef M_PI
@@ -454,6 +457,197 @@ namespace SharedFromThis {
     };
 }
 
+// Example 7: Kernel Framework for Hot Loops
+// A derived kernel supplies only operator() for one element. Kernel<Derived>
+// supplies the loops: batched apply, tiled map-reduce and a parallel version
+// of both. The element call is resolved at compile time, so it inlines into
+// the loop and the compiler can vectorize it; a virtual call per element
+// blocks both.
+namespace KernelFramework {
+    // Minimal contiguous view (std::span is C++20)
+    template<typename T>
+    class Span {
+    private:
+        T* data_ = nullptr;
+        size_t size_ = 0;
+        
+    public:
+        Span() = default;
+        Span(T* data, size_t size) : data_(data), size_(size) {}
+        template<typename Container>
+        Span(Container& c) : data_(c.data()), size_(c.size()) {}
+        
+        T* data() const { return data_; }
+        size_t size() const { return size_; }
+        T& operator[](size_t i) const { return data_[i]; }
+        Span subspan(size_t offset, size_t count) const {
+            return Span(data_ + offset, std::min(count, size_ - offset));
+        }
+    };
+    
+    // Calls body(begin, end) for each grain-sized chunk of [0, count),
+    // spread across threads. Uses OpenMP when the build enables it, plain
+    // std::threads otherwise; threads = 1 runs the chunks inline.
+    class ParallelExecutor {
+    private:
+        size_t threads_;
+        
+    public:
+        explicit ParallelExecutor(size_t threads = std::thread::hardware_concurrency())
+            : threads_(std::max<size_t>(threads, 1)) {}
+        
+        size_t threads() const { return threads_; }
+        
+        template<typename Body>
+        void parallelFor(size_t count, size_t grain, Body&& body) const {
+            const size_t chunks = (count + grain - 1) / grain;
+            if (threads_ == 1 || chunks <= 1) {
+                for (size_t begin = 0; begin < count; begin += grain) {
+                    body(begin, std::min(begin + grain, count));
+                }
+                return;
+            }
+#ifdef _OPENMP
+            #pragma omp parallel for schedule(static) num_threads(static_cast<int>(threads_))
+            for (long long c = 0; c < static_cast<long long>(chunks); ++c) {
+                size_t begin = static_cast<size_t>(c) * grain;
+                body(begin, std::min(begin + grain, count));
+            }
+#else
+            // Static block partition: thread t takes a contiguous run of chunks
+            const size_t workers = std::min(threads_, chunks);
+            auto runBlock = [&](size_t t) {
+                size_t first = chunks * t / workers, last = chunks * (t + 1) / workers;
+                for (size_t c = first; c < last; ++c) {
+                    body(c * grain, std::min((c + 1) * grain, count));
+                }
+            };
+            std::vector<std::thread> pool;
+            for (size_t t = 1; t < workers; ++t) pool.emplace_back(runBlock, t);
+            runBlock(0);
+            for (auto& thread : pool) thread.join();
+#endif
+        }
+    };
+    
+    template<typename Derived>
+    class Kernel {
+    public:
+        // Elements per tile: a tile of input and output (16 KiB each) stays in L1
+        static constexpr size_t kTile = 2048;
+        
+        // out[i] = kernel(in[i])
+        void apply(Span<const double> in, Span<double> out) const {
+            applyRange(in.data(), out.data(), in.size());
+        }
+        
+        // x[i] = kernel(x[i])
+        void applyInPlace(Span<double> x) const {
+            applyRange(x.data(), x.data(), x.size());
+        }
+        
+        // Sum of kernel(in[i]), one partial sum per tile so the error grows
+        // with the number of tiles rather than the number of elements
+        double reduce(Span<const double> in) const {
+            double total = 0.0;
+            for (size_t begin = 0; begin < in.size(); begin += kTile) {
+                total += reduceRange(in.data() + begin, std::min(kTile, in.size() - begin));
+            }
+            return total;
+        }
+        
+        void parallelApply(const ParallelExecutor& executor, Span<const double> in, Span<double> out) const {
+            executor.parallelFor(in.size(), kTile, [&](size_t begin, size_t end) {
+                applyRange(in.data() + begin, out.data() + begin, end - begin);
+            });
+        }
+        
+        // Tile sums land in fixed slots and are added in order, so the result
+        // does not depend on the thread count
+        double parallelReduce(const ParallelExecutor& executor, Span<const double> in) const {
+            const size_t tiles = (in.size() + kTile - 1) / kTile;
+            std::vector<double> partial(tiles, 0.0);
+            executor.parallelFor(in.size(), kTile, [&](size_t begin, size_t end) {
+                partial[begin / kTile] = reduceRange(in.data() + begin, end - begin);
+            });
+            double total = 0.0;
+            for (double p : partial) total += p;
+            return total;
+        }
+        
+    private:
+        const Derived& self() const { return *static_cast<const Derived*>(this); }
+        
+        void applyRange(const double* in, double* out, size_t count) const {
+            const Derived& kernel = self();
+            for (size_t i = 0; i < count; ++i) out[i] = kernel(in[i]);
+        }
+        
+        double reduceRange(const double* in, size_t count) const {
+            const Derived& kernel = self();
+            double sum = 0.0;
+            for (size_t i = 0; i < count; ++i) sum += kernel(in[i]);
+            return sum;
+        }
+    };
+    
+    // Kernels: only the per-element operation
+    class CubicPolynomial : public Kernel<CubicPolynomial> {
+    private:
+        double c0_, c1_, c2_, c3_;
+        
+    public:
+        CubicPolynomial(double c0, double c1, double c2, double c3)
+            : c0_(c0), c1_(c1), c2_(c2), c3_(c3) {}
+        
+        double operator()(double x) const {
+            return c0_ + x * (c1_ + x * (c2_ + x * c3_));
+        }
+    };
+    
+    class LorentzianLine : public Kernel<LorentzianLine> {
+    private:
+        double centre_, halfWidth_;
+        
+    public:
+        LorentzianLine(double centre, double halfWidth) : centre_(centre), halfWidth_(halfWidth) {}
+        
+        double operator()(double x) const {
+            double d = x - centre_;
+            return halfWidth_ / (halfWidth_ * halfWidth_ + d * d);
+        }
+    };
+    
+    // The same two operations behind a virtual interface, for comparison
+    class ElementFunction {
+    public:
+        virtual ~ElementFunction() = default;
+        virtual double operator()(double x) const = 0;
+    };
+    
+    class VirtualCubic : public ElementFunction {
+    private:
+        CubicPolynomial kernel_;
+        
+    public:
+        explicit VirtualCubic(const CubicPolynomial& kernel) : kernel_(kernel) {}
+        double operator()(double x) const override { return kernel_(x); }
+    };
+    
+    class VirtualLorentzian : public ElementFunction {
+    private:
+        LorentzianLine kernel_;
+        
+    public:
+        explicit VirtualLorentzian(const LorentzianLine& kernel) : kernel_(kernel) {}
+        double operator()(double x) const override { return kernel_(x); }
+    };
+    
+    void applyVirtual(const ElementFunction& f, const std::vector<double>& in, std::vector<double>& out) {
+        for (size_t i = 0; i < in.size(); ++i) out[i] = f(in[i]);
+    }
+}
+
 // Demo functions
 void demonstrateStaticPolymorphism() {
     using namespace StaticPolymorphism;
@@ -594,6 +788,70 @@ void demonstrateSingletonPattern() {
     std::cout << "User: " << config.getSetting("user") << "\n";
 }
 
+void demonstrateKernelFramework() {
+    using namespace KernelFramework;
+    
+    std::cout << "\n=== CRTP Kernel Framework ===\n";
+    
+    const size_t n = size_t(1) << 22;
+    std::vector<double> x(n), out(n);
+    for (size_t i = 0; i < n; ++i) x[i] = -2.0 + 4.0 * static_cast<double>(i) / n;
+    
+    CubicPolynomial cubic(-1.0, 1.0, -2.0, 1.0);
+    LorentzianLine line(0.25, 0.05);
+    
+    // Chosen at run time so the compiler cannot devirtualize the loop
+    std::vector<std::unique_ptr<ElementFunction>> functions;
+    functions.push_back(std::make_unique<VirtualCubic>(cubic));
+    functions.push_back(std::make_unique<VirtualLorentzian>(line));
+    
+    auto bestOf = [](int runs, auto&& body) {
+        double best = 1e30;
+        for (int r = 0; r < runs; ++r) {
+            auto start = std::chrono::high_resolution_clock::now();
+            body();
+            auto end = std::chrono::high_resolution_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        return best;
+    };
+    
+    ParallelExecutor executor;
+    std::cout << std::fixed << std::setprecision(2);
+    const char* names[] = {"Cubic polynomial", "Lorentzian line"};
+    for (size_t k = 0; k < functions.size(); ++k) {
+        double virtualMs = bestOf(5, [&] { applyVirtual(*functions[k], x, out); });
+        double virtualSum = std::accumulate(out.begin(), out.end(), 0.0);
+        
+        double kernelMs, parallelMs;
+        if (k == 0) {
+            kernelMs = bestOf(5, [&] { cubic.apply(x, out); });
+            parallelMs = bestOf(5, [&] { cubic.parallelApply(executor, x, out); });
+        } else {
+            kernelMs = bestOf(5, [&] { line.apply(x, out); });
+            parallelMs = bestOf(5, [&] { line.parallelApply(executor, x, out); });
+        }
+        double kernelSum = std::accumulate(out.begin(), out.end(), 0.0);
+        
+        std::cout << names[k] << " over " << n << " elements:\n";
+        std::cout << "  Virtual call per element: " << virtualMs << " ms\n";
+        std::cout << "  CRTP kernel apply:        " << kernelMs << " ms ("
+                  << virtualMs / kernelMs << "x)\n";
+        std::cout << "  CRTP parallel apply:      " << parallelMs << " ms ("
+                  << executor.threads() << " thread(s))\n";
+        std::cout << "  Results agree: " << (virtualSum == kernelSum ? "yes" : "no") << "\n";
+    }
+    
+    // Midpoint rule for the Lorentzian over [-2, 2] as a tiled reduction
+    double h = 4.0 / n;
+    for (size_t i = 0; i < n; ++i) x[i] = -2.0 + (i + 0.5) * h;
+    double serial = line.reduce(x) * h;
+    double parallel = line.parallelReduce(executor, x) * h;
+    double exact = std::atan((2.0 - 0.25) / 0.05) + std::atan((2.0 + 0.25) / 0.05);
+    std::cout << std::setprecision(8) << "Lorentzian integral: " << serial << " (parallel " 
+              << (parallel == serial ? "identical" : "differs") << ", exact " << exact << ")\n";
+}
+
 int main() {
     std::cout << "=== CRTP (Curiously Recurring Template Pattern) Demo ===\n\n";
     
@@ -602,6 +860,7 @@ int main() {
     demonstrateClonePattern();
     demonstrateCounterPattern();
     demonstrateSingletonPattern();
+    demonstrateKernelFramework();
     
     std::cout << "\n=== CRTP Benefits ===\n";
     std::cout << "1. Static polymorphism (no virtual function overhead)\n";
@@ -609,6 +868,7 @@ int main() {
     std::cout << "3. Mixin-style functionality\n";
     std::cout << "4. Code reuse without runtime cost\n";
     std::cout << "5. Type safety\n";
+    std::cout << "6. Inlined, vectorizable hot loops via kernel bases\n";
     
     return 0;
 }
\ No newline at end of file
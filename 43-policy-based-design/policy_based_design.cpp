@@ -8,6 +8,19 @@
 #include <thread>
 #include <cstring>
 #include <stdexcept>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <list>
+#include <map>
+#include <new>
+#include <iomanip>
+#include <cctype>
+#include <type_traits>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 // Example 1: Smart Pointer with Policies
 namespace SmartPointerPolicies {
@@ -205,8 +218,67 @@ namespace ThreadSafeContainer {
         void unlock() { mutex_.unlock(); }
     };
     
-    // Growth Policies
-    class FixedSize {
+    // Test-and-test-and-set spinlock for critical sections of a few dozen
+    // instructions: waiters spin on a plain load, so the cache line stays
+    // shared until the holder releases it, and yield after a while
+    class SpinLocking {
+    private:
+        std::atomic<bool> locked_{false};
+        
+    public:
+        void lock() {
+            for (int spins = 0; locked_.exchange(true, std::memory_order_acquire); ) {
+                while (locked_.load(std::memory_order_relaxed)) {
+                    if (++spins < 64) {
+#if defined(__x86_64__) || defined(__i386__)
+                        _mm_pause();
+#endif
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+        
+        void unlock() { locked_.store(false, std::memory_order_release); }
+    };
+    
+    // Relocation: how a grown buffer is obtained and the elements moved.
+    // The default allocates through the container's allocator and
+    // move-constructs (or copies, when the move may throw) element by
+    // element.
+    struct AllocatorRelocation {
+        template<typename T, typename Alloc>
+        static T* reallocate(Alloc& alloc, T* old, size_t size, size_t oldCapacity, size_t newCapacity) {
+            using Traits = std::allocator_traits<Alloc>;
+            T* fresh = Traits::allocate(alloc, newCapacity);
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                if (size > 0) std::memcpy(static_cast<void*>(fresh), old, size * sizeof(T));
+            } else {
+                size_t built = 0;
+                try {
+                    for (; built < size; ++built) {
+                        Traits::construct(alloc, fresh + built, std::move_if_noexcept(old[built]));
+                    }
+                } catch (...) {
+                    for (size_t i = 0; i < built; ++i) Traits::destroy(alloc, fresh + i);
+                    Traits::deallocate(alloc, fresh, newCapacity);
+                    throw;
+                }
+                for (size_t i = 0; i < size; ++i) Traits::destroy(alloc, old + i);
+            }
+            if (old) Traits::deallocate(alloc, old, oldCapacity);
+            return fresh;
+        }
+        
+        template<typename T, typename Alloc>
+        static void release(Alloc& alloc, T* p, size_t capacity) {
+            if (p) std::allocator_traits<Alloc>::deallocate(alloc, p, capacity);
+        }
+    };
+    
+    // Growth Policies: the next capacity, plus a relocation strategy
+    class FixedSize : public AllocatorRelocation {
     public:
         static size_t getNewCapacity(size_t current, size_t required) {
             if (required > 1000) {
@@ -216,7 +288,7 @@ namespace ThreadSafeContainer {
         }
     };
     
-    class ExponentialGrowth {
+    class ExponentialGrowth : public AllocatorRelocation {
     public:
         static size_t getNewCapacity(size_t current, size_t required) {
             size_t newCapacity = current;
@@ -227,22 +299,57 @@ namespace ThreadSafeContainer {
         }
     };
     
-    class LinearGrowth {
+    class LinearGrowth : public AllocatorRelocation {
     public:
         static size_t getNewCapacity(size_t current, size_t required) {
             return required + 10; // Add 10 extra elements
         }
     };
     
-    // Thread-Safe Vector
+    // Exponential growth that hands trivially copyable elements to realloc.
+    // realloc extends the block in place when the neighbouring memory is
+    // free, and for large blocks glibc remaps pages instead of copying
+    // bytes. This bypasses the Allocator policy for such T, because only
+    // malloc'd memory can be realloc'd; other T fall back to the allocator.
+    class ReallocGrowth : public ExponentialGrowth {
+    public:
+        template<typename T, typename Alloc>
+        static T* reallocate(Alloc& alloc, T* old, size_t size, size_t oldCapacity, size_t newCapacity) {
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                void* grown = std::realloc(old, newCapacity * sizeof(T));
+                if (!grown) throw std::bad_alloc();
+                return static_cast<T*>(grown);
+            } else {
+                return AllocatorRelocation::reallocate(alloc, old, size, oldCapacity, newCapacity);
+            }
+        }
+        
+        template<typename T, typename Alloc>
+        static void release(Alloc& alloc, T* p, size_t capacity) {
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::free(p);
+            } else {
+                AllocatorRelocation::release(alloc, p, capacity);
+            }
+        }
+    };
+    
+    // Thread-Safe Vector. Owns its buffer so the growth policy decides both
+    // the new capacity and how elements reach the new buffer.
     template<
         typename T,
         typename LockingPolicy = MutexLocking,
-        typename GrowthPolicy = ExponentialGrowth
+        typename GrowthPolicy = ExponentialGrowth,
+        typename Allocator = std::allocator<T>
     >
     class SafeVector : private LockingPolicy {
     private:
-        std::vector<T> data_;
+        using Traits = std::allocator_traits<Allocator>;
+        
+        T* data_ = nullptr;
+        size_t size_ = 0;
+        size_t capacity_ = 0;
+        Allocator alloc_;
         using Lock = LockingPolicy;
         
         class LockGuard {
@@ -260,84 +367,215 @@ namespace ThreadSafeContainer {
         };
         
     public:
+        SafeVector() = default;
+        SafeVector(const SafeVector&) = delete;
+        SafeVector& operator=(const SafeVector&) = delete;
+        
+        ~SafeVector() {
+            for (size_t i = 0; i < size_; ++i) Traits::destroy(alloc_, data_ + i);
+            GrowthPolicy::release(alloc_, data_, capacity_);
+        }
+        
         void push_back(const T& value) {
             LockGuard guard(this);
             
-            if (data_.size() == data_.capacity()) {
-                size_t newCapacity = GrowthPolicy::getNewCapacity(
-                    data_.capacity(), data_.size() + 1);
-                data_.reserve(newCapacity);
+            if (size_ == capacity_) {
+                size_t newCapacity = GrowthPolicy::getNewCapacity(capacity_, size_ + 1);
+                data_ = GrowthPolicy::reallocate(alloc_, data_, size_, capacity_, newCapacity);
+                capacity_ = newCapacity;
             }
             
-            data_.push_back(value);
+            Traits::construct(alloc_, data_ + size_, value);
+            ++size_;
         }
         
         T pop_back() {
             LockGuard guard(this);
             
-            if (data_.empty()) {
+            if (size_ == 0) {
                 throw std::out_of_range("Container is empty");
             }
             
-            T value = data_.back();
-            data_.pop_back();
+            T value = std::move(data_[size_ - 1]);
+            Traits::destroy(alloc_, data_ + --size_);
             return value;
         }
         
         size_t size() const {
             LockGuard guard(const_cast<SafeVector*>(this));
-            return data_.size();
+            return size_;
         }
         
         bool empty() const {
             LockGuard guard(const_cast<SafeVector*>(this));
-            return data_.empty();
+            return size_ == 0;
+        }
+        
+        size_t capacity() const {
+            LockGuard guard(const_cast<SafeVector*>(this));
+            return capacity_;
         }
     };
 }
 
 // Example 3: String Class with Policies
 namespace StringPolicies {
-    // Character Case Policies
+    // ASCII case kernels for the SIMD policies: scalar, SSE2 (16 bytes per
+    // step) and AVX2 (32 bytes), picked once at run time. A byte is shifted
+    // by 0x20 only when it lies in 'a'..'z' (or 'A'..'Z'); every other byte,
+    // including UTF-8 continuation bytes, passes through unchanged.
+    namespace AsciiCase {
+        inline void convertScalar(char* s, size_t n, char first, char last) {
+            for (size_t i = 0; i < n; ++i) {
+                if (s[i] >= first && s[i] <= last) s[i] ^= 0x20;
+            }
+        }
+        
+        inline char fold(char c) {
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+        }
+        
+        inline bool equalScalar(const char* a, const char* b, size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                if (fold(a[i]) != fold(b[i])) return false;
+            }
+            return true;
+        }
+        
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ASCII_CASE_X86 1
+        // Signed compares: bytes >= 0x80 are negative and never in range
+        __attribute__((target("sse2")))
+        inline void convertSse2(char* s, size_t n, char first, char last) {
+            const __m128i lo = _mm_set1_epi8(static_cast<char>(first - 1));
+            const __m128i hi = _mm_set1_epi8(static_cast<char>(last + 1));
+            const __m128i flip = _mm_set1_epi8(0x20);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+                __m128i in = _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+                v = _mm_xor_si128(v, _mm_and_si128(in, flip));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(s + i), v);
+            }
+            convertScalar(s + i, n - i, first, last);
+        }
+        
+        __attribute__((target("avx2")))
+        inline void convertAvx2(char* s, size_t n, char first, char last) {
+            const __m256i lo = _mm256_set1_epi8(static_cast<char>(first - 1));
+            const __m256i hi = _mm256_set1_epi8(static_cast<char>(last + 1));
+            const __m256i flip = _mm256_set1_epi8(0x20);
+            size_t i = 0;
+            for (; i + 32 <= n; i += 32) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+                __m256i in = _mm256_and_si256(_mm256_cmpgt_epi8(v, lo), _mm256_cmpgt_epi8(hi, v));
+                v = _mm256_xor_si256(v, _mm256_and_si256(in, flip));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(s + i), v);
+            }
+            convertSse2(s + i, n - i, first, last);
+        }
+        
+        __attribute__((target("avx2")))
+        inline __m256i foldAvx2(__m256i v) {
+            const __m256i lo = _mm256_set1_epi8('A' - 1);
+            const __m256i hi = _mm256_set1_epi8('Z' + 1);
+            __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(v, lo), _mm256_cmpgt_epi8(hi, v));
+            return _mm256_or_si256(v, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+        }
+        
+        // Folds both inputs to lower case and compares 32 bytes at a time
+        __attribute__((target("avx2")))
+        inline bool equalAvx2(const char* a, const char* b, size_t n) {
+            size_t i = 0;
+            for (; i + 32 <= n; i += 32) {
+                __m256i va = foldAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)));
+                __m256i vb = foldAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)) != -1) return false;
+            }
+            return equalScalar(a + i, b + i, n - i);
+        }
+#endif
+        
+        struct Kernels {
+            const char* name;
+            void (*convert)(char*, size_t, char, char);
+            bool (*equal)(const char*, const char*, size_t);
+        };
+        
+        inline const Kernels& kernels() {
+            static const Kernels selected = [] {
+#ifdef ASCII_CASE_X86
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2")) {
+                    return Kernels{"AVX2", convertAvx2, equalAvx2};
+                }
+                return Kernels{"SSE2", convertSse2, equalScalar};
+#else
+                return Kernels{"Scalar", convertScalar, equalScalar};
+#endif
+            }();
+            return selected;
+        }
+        
+        inline void toUpper(char* s, size_t n) { kernels().convert(s, n, 'a', 'z'); }
+        inline void toLower(char* s, size_t n) { kernels().convert(s, n, 'A', 'Z'); }
+        inline bool equalIgnoreCase(const char* a, const char* b, size_t n) {
+            return kernels().equal(a, b, n);
+        }
+    }
+    
+    // Character Case Policies: processChar for single characters, transform
+    // for a range converted in place
     class PreserveCase {
     public:
         static char processChar(char c) { return c; }
-        static std::string processString(const std::string& s) { return s; }
+        static void transform(char*, size_t) {}
     };
     
     class UpperCase {
     public:
         static char processChar(char c) { return std::toupper(c); }
-        static std::string processString(const std::string& s) {
-            std::string result = s;
-            std::transform(result.begin(), result.end(), result.begin(), ::toupper);
-            return result;
+        static void transform(char* s, size_t n) {
+            std::transform(s, s + n, s, ::toupper);
         }
     };
     
     class LowerCase {
     public:
         static char processChar(char c) { return std::tolower(c); }
-        static std::string processString(const std::string& s) {
-            std::string result = s;
-            std::transform(result.begin(), result.end(), result.begin(), ::tolower);
-            return result;
+        static void transform(char* s, size_t n) {
+            std::transform(s, s + n, s, ::tolower);
         }
     };
     
-    // Storage Optimization Policies
+    // ASCII-only variants of the above; std::toupper also honours the C
+    // locale's single-byte mappings, these leave bytes >= 0x80 alone
+    class SimdUpperCase {
+    public:
+        static char processChar(char c) { return (c >= 'a' && c <= 'z') ? static_cast<char>(c ^ 0x20) : c; }
+        static void transform(char* s, size_t n) { AsciiCase::toUpper(s, n); }
+    };
+    
+    class SimdLowerCase {
+    public:
+        static char processChar(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c ^ 0x20) : c; }
+        static void transform(char* s, size_t n) { AsciiCase::toLower(s, n); }
+    };
+    
+    // Storage Optimization Policies. Each provides data(), size(),
+    // mutableData() (unshared, writable) and append().
     class EagerCopy {
     protected:
         std::string data_;
         
     public:
         EagerCopy() = default;
-        explicit EagerCopy(const std::string& s) : data_(s) {}
+        EagerCopy(const char* s, size_t n) : data_(s, n) {}
         
-        std::string& getData() { return data_; }
-        const std::string& getData() const { return data_; }
-        
-        void ensureUnique() {} // Always unique
+        const char* data() const { return data_.data(); }
+        size_t size() const { return data_.size(); }
+        char* mutableData() { return &data_[0]; }
+        void append(const char* s, size_t n) { data_.append(s, n); }
     };
     
     class CopyOnWrite {
@@ -346,15 +584,21 @@ namespace StringPolicies {
         
     public:
         CopyOnWrite() : data_(std::make_shared<std::string>()) {}
-        explicit CopyOnWrite(const std::string& s) 
-            : data_(std::make_shared<std::string>(s)) {}
+        CopyOnWrite(const char* s, size_t n) 
+            : data_(std::make_shared<std::string>(s, n)) {}
+        
+        const char* data() const { return data_->data(); }
+        size_t size() const { return data_->size(); }
         
-        std::string& getData() {
+        char* mutableData() {
             ensureUnique();
-            return *data_;
+            return &(*data_)[0];
         }
         
-        const std::string& getData() const { return *data_; }
+        void append(const char* s, size_t n) {
+            ensureUnique();
+            data_->append(s, n);
+        }
         
         void ensureUnique() {
             if (data_.use_count() > 1) {
@@ -363,6 +607,92 @@ namespace StringPolicies {
         }
     };
     
+    // Small-string-optimized storage with a configurable inline capacity.
+    // libstdc++'s std::string keeps 15 characters inline; identifiers and
+    // labels of up to Inline characters avoid the heap here. Longer strings
+    // move to a heap buffer that grows geometrically.
+    template<size_t Inline = 39>
+    class SmallStringStorage {
+    protected:
+        char* data_;
+        size_t size_ = 0;
+        size_t capacity_ = Inline;
+        char inline_[Inline + 1];
+        
+        bool onHeap() const { return data_ != inline_; }
+        
+        // Takes other's heap buffer, or copies its inline characters; this
+        // must be empty and inline
+        void steal(SmallStringStorage& other) noexcept {
+            if (other.onHeap()) {
+                data_ = other.data_;
+                capacity_ = other.capacity_;
+                other.data_ = other.inline_;
+                other.capacity_ = Inline;
+            } else {
+                std::memcpy(inline_, other.inline_, other.size_ + 1);
+            }
+            size_ = other.size_;
+            other.size_ = 0;
+            other.data_[0] = '\0';
+        }
+        
+        void reserve(size_t required) {
+            if (required <= capacity_) return;
+            size_t capacity = std::max(required, 2 * capacity_);
+            char* buffer = new char[capacity + 1];
+            std::memcpy(buffer, data_, size_ + 1);
+            if (onHeap()) delete[] data_;
+            data_ = buffer;
+            capacity_ = capacity;
+        }
+        
+    public:
+        SmallStringStorage() : data_(inline_) { inline_[0] = '\0'; }
+        SmallStringStorage(const char* s, size_t n) : SmallStringStorage() { append(s, n); }
+        
+        SmallStringStorage(const SmallStringStorage& other) : SmallStringStorage() {
+            append(other.data_, other.size_);
+        }
+        
+        SmallStringStorage(SmallStringStorage&& other) noexcept : SmallStringStorage() {
+            steal(other);
+        }
+        
+        SmallStringStorage& operator=(const SmallStringStorage& other) {
+            if (this != &other) {
+                size_ = 0;
+                append(other.data_, other.size_);
+            }
+            return *this;
+        }
+        
+        SmallStringStorage& operator=(SmallStringStorage&& other) noexcept {
+            if (this != &other) {
+                if (onHeap()) delete[] data_;
+                data_ = inline_;
+                capacity_ = Inline;
+                steal(other);
+            }
+            return *this;
+        }
+        
+        ~SmallStringStorage() {
+            if (onHeap()) delete[] data_;
+        }
+        
+        const char* data() const { return data_; }
+        size_t size() const { return size_; }
+        char* mutableData() { return data_; }
+        
+        void append(const char* s, size_t n) {
+            reserve(size_ + n);
+            std::memcpy(data_ + size_, s, n);
+            size_ += n;
+            data_[size_] = '\0';
+        }
+    };
+    
     // Policy-Based String
     template<
         typename CasePolicy = PreserveCase,
@@ -372,39 +702,60 @@ namespace StringPolicies {
     private:
         using Storage = StoragePolicy;
         
+        // Appends raw characters, then case-converts only the new tail
+        void appendConverted(const char* s, size_t n) {
+            size_t old = Storage::size();
+            Storage::append(s, n);
+            CasePolicy::transform(this->mutableData() + old, n);
+        }
+        
     public:
         String() = default;
         
-        explicit String(const std::string& s) 
-            : Storage(CasePolicy::processString(s)) {}
+        explicit String(const std::string& s) {
+            appendConverted(s.data(), s.size());
+        }
         
-        String(const char* s) 
-            : Storage(CasePolicy::processString(std::string(s))) {}
+        String(const char* s) {
+            appendConverted(s, std::strlen(s));
+        }
         
         String& operator+=(const String& other) {
-            this->getData() += other.getData();
+            Storage::append(other.data(), other.length());
             return *this;
         }
         
         String& operator+=(char c) {
-            this->getData() += CasePolicy::processChar(c);
+            c = CasePolicy::processChar(c);
+            Storage::append(&c, 1);
             return *this;
         }
         
         char operator[](size_t index) const {
-            return this->getData()[index];
+            return Storage::data()[index];
         }
         
         size_t length() const {
-            return this->getData().length();
+            return Storage::size();
+        }
+        
+        const char* data() const {
+            return Storage::data();
         }
         
-        const std::string& str() const {
-            return this->getData();
+        std::string str() const {
+            return std::string(Storage::data(), Storage::size());
         }
         
         void append(const std::string& s) {
-            this->getData() += CasePolicy::processString(s);
+            appendConverted(s.data(), s.size());
+        }
+        
+        // ASCII case-insensitive comparison, vectorized where available
+        template<typename OtherCase, typename OtherStorage>
+        bool equalsIgnoreCase(const String<OtherCase, OtherStorage>& other) const {
+            return length() == other.length() &&
+                   AsciiCase::equalIgnoreCase(data(), other.data(), length());
         }
     };
 }
@@ -442,44 +793,202 @@ namespace AllocatorPolicies {
         }
     };
     
-    template<typename T, size_t PoolSize = 1024>
-    class PoolAllocator {
+    // Segregated size-class pool. Each small request is rounded up to a
+    // size class. The class's blocks come from an intrusive free list in a
+    // per-thread cache, so the common path is a pointer pop with no lock and
+    // no search. An empty cache refills a batch from the central pool; a
+    // full one returns a batch. The central pool carves new blocks from
+    // 64 KiB slabs. Requests over kMaxSmall bytes go to operator new.
+    class SizeClasses {
+    public:
+        // 16-byte steps up to 128, then powers of two up to 4096
+        static constexpr size_t kCount = 13;
+        static constexpr size_t kMaxSmall = 4096;
+        static constexpr size_t kAlignment = alignof(std::max_align_t);
+        
+        static constexpr size_t classOf(size_t bytes) {
+            if (bytes <= 128) return bytes <= 16 ? 0 : (bytes - 1) / 16;
+            size_t cls = 8;
+            for (size_t size = 256; size < bytes; size *= 2) ++cls;
+            return cls;
+        }
+        
+        static constexpr size_t sizeOf(size_t cls) {
+            return cls < 8 ? (cls + 1) * 16 : size_t(256) << (cls - 8);
+        }
+        
+        // Blocks moved between a thread cache and the central pool at a time
+        static constexpr size_t batchOf(size_t cls) {
+            size_t batch = 8192 / sizeOf(cls);
+            return batch < 4 ? 4 : (batch > 64 ? 64 : batch);
+        }
+    };
+    
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+    
+    class CentralPool {
+    private:
+        static constexpr size_t kSlabBytes = 64 * 1024;
+        
+        struct SizeClass {
+            std::mutex mutex;
+            FreeBlock* free = nullptr;
+            size_t freeCount = 0;
+        };
+        
+        SizeClass classes_[SizeClasses::kCount];
+        std::mutex slabMutex_;
+        std::vector<void*> slabs_;
+        std::atomic<size_t> refills_{0};
+        std::atomic<size_t> flushes_{0};
+        
+        CentralPool() = default;
+        
+        // Carves a fresh slab into blocks of one class; called with the
+        // class mutex held
+        void grow(SizeClass& sc, size_t cls) {
+            const size_t size = SizeClasses::sizeOf(cls);
+            char* slab = static_cast<char*>(::operator new(kSlabBytes));
+            {
+                std::lock_guard<std::mutex> lock(slabMutex_);
+                slabs_.push_back(slab);
+            }
+            for (size_t offset = 0; offset + size <= kSlabBytes; offset += size) {
+                auto* block = reinterpret_cast<FreeBlock*>(slab + offset);
+                block->next = sc.free;
+                sc.free = block;
+                ++sc.freeCount;
+            }
+        }
+        
+    public:
+        ~CentralPool() {
+            for (void* slab : slabs_) ::operator delete(slab);
+        }
+        
+        CentralPool(const CentralPool&) = delete;
+        CentralPool& operator=(const CentralPool&) = delete;
+        
+        static CentralPool& instance() {
+            static CentralPool pool;
+            return pool;
+        }
+        
+        // Detaches up to count blocks as a list; returns how many
+        size_t fetch(size_t cls, size_t count, FreeBlock*& head) {
+            SizeClass& sc = classes_[cls];
+            std::lock_guard<std::mutex> lock(sc.mutex);
+            if (sc.freeCount < count) grow(sc, cls);
+            head = sc.free;
+            FreeBlock* tail = head;
+            for (size_t i = 1; i < count; ++i) tail = tail->next;
+            sc.free = tail->next;
+            tail->next = nullptr;
+            sc.freeCount -= count;
+            refills_.fetch_add(1, std::memory_order_relaxed);
+            return count;
+        }
+        
+        void give(size_t cls, FreeBlock* head, FreeBlock* tail, size_t count) {
+            SizeClass& sc = classes_[cls];
+            std::lock_guard<std::mutex> lock(sc.mutex);
+            tail->next = sc.free;
+            sc.free = head;
+            sc.freeCount += count;
+            flushes_.fetch_add(1, std::memory_order_relaxed);
+        }
+        
+        size_t slabCount() {
+            std::lock_guard<std::mutex> lock(slabMutex_);
+            return slabs_.size();
+        }
+        size_t refills() const { return refills_.load(std::memory_order_relaxed); }
+        size_t flushes() const { return flushes_.load(std::memory_order_relaxed); }
+    };
+    
+    class ThreadCache {
     private:
-        static inline char memory_[PoolSize * sizeof(T)];
-        static inline bool used_[PoolSize] = {false};
+        struct List {
+            FreeBlock* head = nullptr;
+            size_t count = 0;
+        };
+        
+        List lists_[SizeClasses::kCount];
+        CentralPool& central_;
+        
+        // Takes the central pool first so it outlives every thread cache
+        ThreadCache() : central_(CentralPool::instance()) {}
+        
+        // Hands the first batch of the list back to the central pool
+        void flush(List& list, size_t cls, size_t count) {
+            FreeBlock* head = list.head;
+            FreeBlock* tail = head;
+            for (size_t i = 1; i < count; ++i) tail = tail->next;
+            list.head = tail->next;
+            list.count -= count;
+            central_.give(cls, head, tail, count);
+        }
+        
+    public:
+        ~ThreadCache() {
+            for (size_t cls = 0; cls < SizeClasses::kCount; ++cls) {
+                if (lists_[cls].count > 0) flush(lists_[cls], cls, lists_[cls].count);
+            }
+        }
+        
+        static ThreadCache& local() {
+            thread_local ThreadCache cache;
+            return cache;
+        }
+        
+        void* allocate(size_t cls) {
+            List& list = lists_[cls];
+            if (!list.head) {
+                list.count = central_.fetch(cls, SizeClasses::batchOf(cls), list.head);
+            }
+            FreeBlock* block = list.head;
+            list.head = block->next;
+            --list.count;
+            return block;
+        }
+        
+        void deallocate(void* p, size_t cls) {
+            List& list = lists_[cls];
+            auto* block = static_cast<FreeBlock*>(p);
+            block->next = list.head;
+            list.head = block;
+            // Keep up to two batches so alternating alloc/free does not bounce
+            if (++list.count > 2 * SizeClasses::batchOf(cls)) {
+                flush(list, cls, SizeClasses::batchOf(cls));
+            }
+        }
+    };
+    
+    // Allocation policy over the size-class pool. Blocks may be freed on a
+    // different thread than the one that allocated them; they join the
+    // freeing thread's cache.
+    template<typename T>
+    class PoolAllocator {
+        static_assert(alignof(T) <= SizeClasses::kAlignment, "Over-aligned types are not pooled");
         
     public:
         static T* allocate(size_t n) {
-            if (n > PoolSize) throw std::bad_alloc();
-            
-            // Find contiguous free blocks
-            for (size_t i = 0; i <= PoolSize - n; ++i) {
-                bool canAllocate = true;
-                for (size_t j = 0; j < n; ++j) {
-                    if (used_[i + j]) {
-                        canAllocate = false;
-                        break;
-                    }
-                }
-                
-                if (canAllocate) {
-                    for (size_t j = 0; j < n; ++j) {
-                        used_[i + j] = true;
-                    }
-                    std::cout << "Pool: Allocated " << n << " objects\n";
-                    return reinterpret_cast<T*>(&memory_[i * sizeof(T)]);
-                }
+            const size_t bytes = n * sizeof(T);
+            if (bytes > SizeClasses::kMaxSmall) {
+                return static_cast<T*>(::operator new(bytes));
             }
-            
-            throw std::bad_alloc();
+            return static_cast<T*>(ThreadCache::local().allocate(SizeClasses::classOf(bytes)));
         }
         
         static void deallocate(T* p, size_t n) {
-            size_t index = (reinterpret_cast<char*>(p) - memory_) / sizeof(T);
-            for (size_t i = 0; i < n; ++i) {
-                used_[index + i] = false;
+            const size_t bytes = n * sizeof(T);
+            if (bytes > SizeClasses::kMaxSmall) {
+                ::operator delete(p);
+                return;
             }
-            std::cout << "Pool: Deallocated " << n << " objects\n";
+            ThreadCache::local().deallocate(p, SizeClasses::classOf(bytes));
         }
     };
     
@@ -545,9 +1054,71 @@ namespace AllocatorPolicies {
         struct rebind {
             using other = Allocator<U, AllocationPolicy, TrackingPolicy>;
         };
+        
+        // Stateless: any two instances can free each other's memory
+        template<typename U>
+        bool operator==(const Allocator<U, AllocationPolicy, TrackingPolicy>&) const { return true; }
+        template<typename U>
+        bool operator!=(const Allocator<U, AllocationPolicy, TrackingPolicy>&) const { return false; }
     };
 }
 
+// Example 5: The pool allocator as the Allocator policy of SmartPtr and SafeVector
+namespace SmartPointerPolicies {
+    // Storage policy that destroys the object and frees it through an
+    // allocation policy instead of delete
+    template<typename T, template<typename> class AllocationPolicy>
+    class AllocatorStorage {
+    protected:
+        T* ptr_;
+        
+        void destroy() {
+            if (ptr_) {
+                ptr_->~T();
+                AllocationPolicy<T>::deallocate(ptr_, 1);
+            }
+        }
+        
+    public:
+        AllocatorStorage() : ptr_(nullptr) {}
+        explicit AllocatorStorage(T* p) : ptr_(p) {}
+        
+        ~AllocatorStorage() {
+            destroy();
+        }
+        
+        T* get() const { return ptr_; }
+        void reset(T* p = nullptr) {
+            destroy();
+            ptr_ = p;
+        }
+        
+        T* release() {
+            T* tmp = ptr_;
+            ptr_ = nullptr;
+            return tmp;
+        }
+    };
+    
+    template<typename T>
+    using PoolStorage = AllocatorStorage<T, AllocatorPolicies::PoolAllocator>;
+    
+    template<typename T>
+    using PooledPtr = SmartPtr<T, PoolStorage, ExclusiveOwnership, EnforceNotNull>;
+    
+    // Constructs T in a pool block; the pointer returns it to the pool
+    template<typename T, typename... Args>
+    PooledPtr<T> makePooled(Args&&... args) {
+        T* p = AllocatorPolicies::PoolAllocator<T>::allocate(1);
+        try {
+            return PooledPtr<T>(new (p) T(std::forward<Args>(args)...));
+        } catch (...) {
+            AllocatorPolicies::PoolAllocator<T>::deallocate(p, 1);
+            throw;
+        }
+    }
+}
+
 // Demo functions
 void demonstrateSmartPointers() {
     using namespace SmartPointerPolicies;
@@ -663,12 +1234,163 @@ void demonstrateAllocatorPolicies() {
     
     vec2.clear();
     
+    // Node containers rebind the allocator to their node types
+    std::list<int, Allocator<int, PoolAllocator>> list1(100, 7);
+    std::map<int, double, std::less<int>, Allocator<std::pair<const int, double>, PoolAllocator>> map1;
+    for (int i = 0; i < 100; ++i) {
+        map1[i] = i * 0.5;
+    }
+    std::cout << "Pooled list size: " << list1.size() << ", pooled map size: " << map1.size() << "\n";
+    
+    // The pool as SafeVector's and SmartPtr's Allocator policy
+    ThreadSafeContainer::SafeVector<int, ThreadSafeContainer::MutexLocking,
+                                    ThreadSafeContainer::ExponentialGrowth,
+                                    Allocator<int, PoolAllocator>> pooledVec;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 3; ++t) {
+        writers.emplace_back([&pooledVec, t]() {
+            for (int j = 0; j < 100; ++j) pooledVec.push_back(t * 100 + j);
+        });
+    }
+    for (auto& w : writers) w.join();
+    std::cout << "Pooled SafeVector size: " << pooledVec.size() << "\n";
+    
+    auto pooledName = SmartPointerPolicies::makePooled<std::string>("pooled string");
+    std::cout << "Pooled SmartPtr value: " << *pooledName << "\n";
+    
+    // Node churn on several threads: std::allocator vs. the size-class pool
+    auto churn = [](auto tag) {
+        using ListAlloc = decltype(tag);
+        const int threads = 4, rounds = 200, nodes = 1000;
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([]() {
+                std::list<int, ListAlloc> queue;
+                for (int r = 0; r < rounds; ++r) {
+                    for (int i = 0; i < nodes; ++i) queue.push_back(i);
+                    while (!queue.empty()) queue.pop_front();
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    double stdMs = churn(std::allocator<int>());
+    double poolMs = churn(Allocator<int, PoolAllocator>());
+    CentralPool& central = CentralPool::instance();
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "List node churn, 4 threads x 200k nodes: std::allocator " << stdMs 
+              << " ms, size-class pool " << poolMs << " ms\n";
+    std::cout << "Central pool: " << central.slabCount() << " slabs, " << central.refills()
+              << " batch refills, " << central.flushes() << " batch returns\n";
+    
     // Vector with malloc allocator
     using MallocAlloc = Allocator<std::string, MallocAllocator, NoTracking>;
     std::vector<std::string, MallocAlloc> vec3;
     vec3.push_back("Test");
 }
 
+// Measures what each policy choice costs on its own
+void demonstratePolicyCosts() {
+    using namespace StringPolicies;
+    using namespace ThreadSafeContainer;
+    
+    std::cout << "\n=== Policy Costs ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+    
+    auto bestOf = [](int runs, auto&& body) {
+        double best = 1e30;
+        for (int r = 0; r < runs; ++r) {
+            auto start = std::chrono::steady_clock::now();
+            body();
+            best = std::min(best, std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    };
+    
+    // Case policies over 4 MiB of mixed-case ASCII
+    const size_t textBytes = size_t(4) << 20;
+    std::string text(textBytes, ' ');
+    for (size_t i = 0; i < textBytes; ++i) {
+        text[i] = "The Quick Brown Fox, 42 Jumps!\n"[i % 31];
+    }
+    std::string work = text;
+    double copyMs = bestOf(5, [&] { work = text; });
+    double scalarMs = bestOf(5, [&] { work = text; UpperCase::transform(&work[0], work.size()); });
+    std::string scalarUpper = work;
+    double simdMs = bestOf(5, [&] { work = text; SimdUpperCase::transform(&work[0], work.size()); });
+    std::cout << "Case conversion, 4 MiB (" << AsciiCase::kernels().name << "):\n";
+    std::cout << "  UpperCase (std::toupper): " << scalarMs - copyMs << " ms\n";
+    std::cout << "  SimdUpperCase:            " << simdMs - copyMs << " ms (same result: "
+              << (work == scalarUpper ? "yes" : "no") << ")\n";
+    
+    volatile bool equal = false;   // keeps the scalar loop inside the timed region
+    double foldScalarMs = bestOf(5, [&] { equal = AsciiCase::equalScalar(text.data(), work.data(), textBytes); });
+    double foldSimdMs = bestOf(5, [&] { equal = AsciiCase::equalIgnoreCase(text.data(), work.data(), textBytes); });
+    std::cout << "  Case-insensitive compare: scalar " << foldScalarMs << " ms, SIMD " 
+              << foldSimdMs << " ms (equal: " << (equal ? "yes" : "no") << ")\n";
+    
+    // Storage policies: build and copy 200k 30-character labels
+    const int labels = 200000;
+    auto storageRun = [&](auto tag) {
+        using Label = decltype(tag);
+        return bestOf(3, [&] {
+            std::vector<Label> built, copies;
+            built.reserve(labels);
+            copies.reserve(labels);
+            for (int i = 0; i < labels; ++i) built.emplace_back("species-carbon-dioxide-00000");
+            for (const Label& label : built) copies.push_back(label);
+        });
+    };
+    std::cout << "Storage, 200k 28-char labels built and copied:\n";
+    std::cout << "  EagerCopy (std::string):  " << storageRun(String<PreserveCase, EagerCopy>()) << " ms\n";
+    std::cout << "  CopyOnWrite:              " << storageRun(String<PreserveCase, CopyOnWrite>()) << " ms\n";
+    std::cout << "  SmallStringStorage<39>:   " << storageRun(String<PreserveCase, SmallStringStorage<>>()) << " ms\n";
+    
+    // Growth policies: append 16M ints without locking
+    const int elements = 1 << 24;
+    auto growthRun = [&](auto tag) {
+        using Vector = decltype(tag);
+        return bestOf(3, [&] {
+            Vector vec;
+            for (int i = 0; i < elements; ++i) vec.push_back(i);
+        });
+    };
+    std::cout << "Growth, 16M int push_backs:\n";
+    std::cout << "  ExponentialGrowth (allocate + copy): "
+              << growthRun(SafeVector<int, NoLocking, ExponentialGrowth>()) << " ms\n";
+    std::cout << "  ReallocGrowth (realloc in place):    "
+              << growthRun(SafeVector<int, NoLocking, ReallocGrowth>()) << " ms\n";
+    
+    // Locking policies: push/pop pairs, uncontended then 4 threads
+    const int pairs = 2000000;
+    auto lockRun = [&](auto tag, int threads) {
+        using Vector = decltype(tag);
+        Vector vec;
+        double ms = bestOf(3, [&] {
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threads; ++t) {
+                workers.emplace_back([&vec, threads]() {
+                    for (int i = 0; i < pairs / threads; ++i) {
+                        vec.push_back(i);
+                        vec.pop_back();
+                    }
+                });
+            }
+            for (auto& w : workers) w.join();
+        });
+        return ms * 1e6 / (2.0 * pairs);
+    };
+    std::cout << "Locking, ns per push or pop:\n";
+    std::cout << "  NoLocking (1 thread):     " << lockRun(SafeVector<int, NoLocking>(), 1) << " ns\n";
+    std::cout << "  SpinLocking (1 thread):   " << lockRun(SafeVector<int, SpinLocking>(), 1) << " ns\n";
+    std::cout << "  MutexLocking (1 thread):  " << lockRun(SafeVector<int, MutexLocking>(), 1) << " ns\n";
+    std::cout << "  SpinLocking (4 threads):  " << lockRun(SafeVector<int, SpinLocking>(), 4) << " ns\n";
+    std::cout << "  MutexLocking (4 threads): " << lockRun(SafeVector<int, MutexLocking>(), 4) << " ns\n";
+}
+
 int main() {
     std::cout << "=== Policy-Based Design Pattern Demo ===\n\n";
     
@@ -676,6 +1398,7 @@ int main() {
     demonstrateThreadSafeContainer();
     demonstrateStringPolicies();
     demonstrateAllocatorPolicies();
+    demonstratePolicyCosts();
     
     std::cout << "\n=== Policy-Based Design Benefits ===\n";
     std::cout << "1. Compile-time configuration\n";
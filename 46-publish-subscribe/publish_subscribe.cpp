@@ -8,8 +8,111 @@
 #include <any>
 #include <typeindex>
 #include <mutex>
+#include <stdexcept>
 #include <queue>
+#include <deque>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+
+// Copy-on-write holder for read-mostly subscriber tables. Readers load the
+// current version through an atomic pointer and take no lock, so a publisher
+// never waits for a subscribe, an unsubscribe or another publisher's slow
+// handler. Writers copy the table under writerMutex_, swap the pointer and
+// retire the old version. Reclamation is epoch based: a reader registers in
+// the counter for the epoch it started in, the epoch only advances once the
+// previous epoch's counter drains, and a version retired in epoch R is freed
+// once the epoch reaches R + 2, when every reader that could have loaded it
+// has left. Sustained reading therefore never pins retired versions. A
+// publisher that loaded the table just before an unsubscribe still sees the
+// removed entry, so MessageBroker also clears the subscriber's active flag;
+// only a delivery already past that check can reach the removed handler.
+template<typename T>
+class RcuSnapshot {
+private:
+    struct Retired {
+        std::unique_ptr<const T> value;
+        uint64_t epoch;
+    };
+    
+    std::atomic<const T*> current_;
+    mutable std::atomic<uint64_t> epoch_{0};
+    mutable std::atomic<int> readers_[2] = {};
+    std::mutex writerMutex_;
+    std::deque<Retired> retired_;
+    
+    // Moves to the next epoch if nobody is left in the one before the
+    // current epoch, whose counter the next epoch reuses
+    bool tryAdvance() {
+        uint64_t epoch = epoch_.load();
+        if (readers_[(epoch + 1) & 1].load() != 0) return false;
+        epoch_.store(epoch + 1);
+        return true;
+    }
+    
+public:
+    class ReadGuard {
+    private:
+        const RcuSnapshot& owner_;
+        const T* value_;
+        uint64_t epoch_;
+        
+    public:
+        explicit ReadGuard(const RcuSnapshot& owner) : owner_(owner) {
+            // Re-check after registering, so the counter always matches an
+            // epoch that was current while this reader was counted in it
+            while (true) {
+                epoch_ = owner_.epoch_.load();
+                owner_.readers_[epoch_ & 1].fetch_add(1);
+                if (owner_.epoch_.load() == epoch_) break;
+                owner_.readers_[epoch_ & 1].fetch_sub(1);
+            }
+            value_ = owner_.current_.load();
+        }
+        ~ReadGuard() { owner_.readers_[epoch_ & 1].fetch_sub(1); }
+        
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        
+        const T& operator*() const { return *value_; }
+        const T* operator->() const { return value_; }
+    };
+    
+    RcuSnapshot() : current_(new T()) {}
+    
+    RcuSnapshot(const RcuSnapshot&) = delete;
+    RcuSnapshot& operator=(const RcuSnapshot&) = delete;
+    
+    // Readers must have finished before the holder goes away
+    ~RcuSnapshot() { delete current_.load(); }
+    
+    ReadGuard read() const { return ReadGuard(*this); }
+    
+    // Applies mutate to a private copy and publishes it if mutate returns true
+    template<typename Mutation>
+    bool update(Mutation mutate) {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        std::unique_ptr<T> next(new T(*current_.load()));
+        if (!mutate(*next)) return false;
+        retired_.push_back({std::unique_ptr<const T>(current_.exchange(next.release())), epoch_.load()});
+        // Two advances complete the grace period for everything retired so far
+        if (tryAdvance()) tryAdvance();
+        uint64_t epoch = epoch_.load();
+        while (!retired_.empty() && retired_.front().epoch + 2 <= epoch) {
+            retired_.pop_front();
+        }
+        return true;
+    }
+    
+    size_t retiredCount() {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        return retired_.size();
+    }
+};
 
 // Example 1: Basic Publish-Subscribe System
 namespace BasicPubSub {
@@ -24,24 +127,26 @@ namespace BasicPubSub {
             Handler handler;
         };
         
-        std::unordered_map<std::type_index, std::vector<Subscription>> handlers_;
-        HandlerId nextId_ = 1;
-        mutable std::mutex mutex_;
+        using HandlerTable = std::unordered_map<std::type_index, std::vector<Subscription>>;
+        
+        RcuSnapshot<HandlerTable> handlers_;
+        std::atomic<HandlerId> nextId_{1};
         
     public:
         // Subscribe to specific event type
         template<typename T>
         HandlerId subscribe(std::function<void(const T&)> handler) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            
             HandlerId id = nextId_++;
             auto typeIndex = std::type_index(typeid(T));
             
-            handlers_[typeIndex].push_back({
-                id,
-                [handler](const EventType& event) {
-                    handler(std::any_cast<const T&>(event));
-                }
+            handlers_.update([&](HandlerTable& table) {
+                table[typeIndex].push_back({
+                    id,
+                    [handler](const EventType& event) {
+                        handler(std::any_cast<const T&>(event));
+                    }
+                });
+                return true;
             });
             
             std::cout << "Subscriber " << id << " registered for " 
@@ -51,28 +156,30 @@ namespace BasicPubSub {
         
         // Unsubscribe by ID
         void unsubscribe(HandlerId id) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            
-            for (auto& [type, subs] : handlers_) {
-                subs.erase(
-                    std::remove_if(subs.begin(), subs.end(),
-                        [id](const Subscription& sub) { return sub.id == id; }),
-                    subs.end()
-                );
-            }
+            handlers_.update([id](HandlerTable& table) {
+                for (auto& [type, subs] : table) {
+                    subs.erase(
+                        std::remove_if(subs.begin(), subs.end(),
+                            [id](const Subscription& sub) { return sub.id == id; }),
+                        subs.end()
+                    );
+                }
+                return true;
+            });
             
             std::cout << "Subscriber " << id << " unregistered\n";
         }
         
-        // Publish event
+        // Publish event; takes no lock, so handlers may publish, subscribe
+        // or unsubscribe themselves
         template<typename T>
         void publish(const T& event) {
-            std::lock_guard<std::mutex> lock(mutex_);
+            auto handlers = handlers_.read();
             
             auto typeIndex = std::type_index(typeid(T));
-            auto it = handlers_.find(typeIndex);
+            auto it = handlers->find(typeIndex);
             
-            if (it != handlers_.end()) {
+            if (it != handlers->end()) {
                 std::cout << "Publishing " << typeIndex.name() 
                           << " to " << it->second.size() << " subscribers\n";
                 
@@ -111,6 +218,185 @@ namespace BasicPubSub {
 
 // Example 2: Topic-Based Publish-Subscribe
 namespace TopicBasedPubSub {
+    // Subscription patterns are dot-separated topics in which '*' matches
+    // exactly one segment and a final '#' matches zero or more, so
+    // "sensors.*.temp" and "sensors.#" both match "sensors.7.temp"; '#'
+    // anywhere but the last segment is rejected by insert(). A
+    // publish walks the trie once, following the literal, '*' and '#'
+    // children at each level, instead of testing every pattern.
+    // Nodes are immutable and shared: insert and erase copy only the nodes
+    // on the pattern's path, which keeps the copy made by RcuSnapshot cheap.
+    // That copy still grows with the fan-out along the path, so subscribing
+    // is cheapest with deep, hierarchical topic names.
+    template<typename Value>
+    class TopicTrie {
+    private:
+        struct Node;
+        
+        // Children are a sorted flat array: a copy is one allocation, and
+        // lookups binary-search contiguous memory
+        using Child = std::pair<std::string, std::shared_ptr<const Node>>;
+        
+        struct Node {
+            std::vector<Child> children;
+            std::vector<Value> values;
+        };
+        
+        static constexpr size_t kEnd = std::string_view::npos;
+        
+        std::shared_ptr<const Node> root_ = std::make_shared<const Node>();
+        
+        // Segment starting at pos, and the start of the next one (kEnd after the last)
+        static std::string_view segmentAt(std::string_view topic, size_t pos, size_t& next) {
+            size_t dot = topic.find('.', pos);
+            next = dot == kEnd ? kEnd : dot + 1;
+            return topic.substr(pos, dot == kEnd ? kEnd : dot - pos);
+        }
+        
+        template<typename Children>
+        static auto findChild(Children& children, std::string_view segment) {
+            auto it = std::lower_bound(children.begin(), children.end(), segment,
+                [](const Child& c, std::string_view s) { return std::string_view(c.first) < s; });
+            return (it != children.end() && it->first == segment) ? it : children.end();
+        }
+        
+        static const Node* child(const Node& node, std::string_view segment) {
+            auto it = findChild(node.children, segment);
+            return it == node.children.end() ? nullptr : it->second.get();
+        }
+        
+        template<typename Visitor>
+        static size_t visitAll(const std::vector<Value>& values, Visitor& visit) {
+            for (const Value& value : values) visit(value);
+            return values.size();
+        }
+        
+        template<typename Visitor>
+        static size_t matchFrom(const Node& node, std::string_view topic, size_t pos, Visitor& visit) {
+            size_t count = 0;
+            if (const Node* rest = child(node, "#")) count += visitAll(rest->values, visit);
+            if (pos == kEnd) return count + visitAll(node.values, visit);
+            
+            size_t next;
+            std::string_view segment = segmentAt(topic, pos, next);
+            if (const Node* exact = child(node, segment)) count += matchFrom(*exact, topic, next, visit);
+            if (segment != "*") {
+                if (const Node* any = child(node, "*")) count += matchFrom(*any, topic, next, visit);
+            }
+            return count;
+        }
+        
+        static std::shared_ptr<const Node> insertAt(const Node* node, std::string_view pattern,
+                                                    size_t pos, Value& value) {
+            auto copy = node ? std::make_shared<Node>(*node) : std::make_shared<Node>();
+            if (pos == kEnd) {
+                copy->values.push_back(std::move(value));
+                return copy;
+            }
+            size_t next;
+            std::string_view segment = segmentAt(pattern, pos, next);
+            auto it = std::lower_bound(copy->children.begin(), copy->children.end(), segment,
+                [](const Child& c, std::string_view s) { return std::string_view(c.first) < s; });
+            if (it != copy->children.end() && it->first == segment) {
+                it->second = insertAt(it->second.get(), pattern, next, value);
+            } else {
+                copy->children.emplace(it, std::string(segment), insertAt(nullptr, pattern, next, value));
+            }
+            return copy;
+        }
+        
+        // Returns the rebuilt node, nullptr once it holds nothing
+        template<typename Predicate>
+        static std::shared_ptr<const Node> eraseAt(const std::shared_ptr<const Node>& node, std::string_view pattern,
+                                                   size_t pos, Predicate& remove, size_t& removed) {
+            auto copy = std::make_shared<Node>(*node);
+            if (pos == kEnd) {
+                auto end = std::remove_if(copy->values.begin(), copy->values.end(), remove);
+                removed += static_cast<size_t>(copy->values.end() - end);
+                copy->values.erase(end, copy->values.end());
+            } else {
+                size_t next;
+                auto it = findChild(copy->children, segmentAt(pattern, pos, next));
+                if (it == copy->children.end()) return node;
+                auto rebuilt = eraseAt(it->second, pattern, next, remove, removed);
+                if (rebuilt) {
+                    it->second = std::move(rebuilt);
+                } else {
+                    copy->children.erase(it);
+                }
+            }
+            if (copy->values.empty() && copy->children.empty()) return nullptr;
+            return copy;
+        }
+        
+        template<typename Visitor>
+        static void forEachPatternFrom(const Node& node, const std::string& prefix, Visitor& visit) {
+            if (!node.values.empty()) visit(prefix, node.values);
+            for (const auto& [segment, next] : node.children) {
+                forEachPatternFrom(*next, prefix.empty() ? segment : prefix + "." + segment, visit);
+            }
+        }
+        
+    public:
+        // True unless a '#' segment is followed by another segment
+        static bool isValidPattern(std::string_view pattern) {
+            for (size_t pos = 0, next; pos != kEnd; pos = next) {
+                if (segmentAt(pattern, pos, next) == "#" && next != kEnd) return false;
+            }
+            return true;
+        }
+        
+        // Throws std::invalid_argument for a pattern with a non-final '#',
+        // which matchFrom() would otherwise treat as matching every topic
+        // under its prefix
+        void insert(std::string_view pattern, Value value) {
+            if (!isValidPattern(pattern)) {
+                throw std::invalid_argument("TopicTrie: '#' must be the last segment of \""
+                                            + std::string(pattern) + "\"");
+            }
+            root_ = insertAt(root_.get(), pattern, 0, value);
+        }
+        
+        // Removes the values under exactly this pattern for which remove(value) is true
+        template<typename Predicate>
+        size_t erase(std::string_view pattern, Predicate remove) {
+            size_t removed = 0;
+            auto rebuilt = eraseAt(root_, pattern, 0, remove, removed);
+            if (removed > 0) {
+                root_ = rebuilt ? std::move(rebuilt) : std::make_shared<const Node>();
+            }
+            return removed;
+        }
+        
+        // Calls visit(value) for every pattern matching topic; returns the count
+        template<typename Visitor>
+        size_t match(std::string_view topic, Visitor visit) const {
+            return matchFrom(*root_, topic, 0, visit);
+        }
+        
+        // Calls visit(pattern, values) for every pattern, in lexicographic order
+        template<typename Visitor>
+        void forEachPattern(Visitor visit) const {
+            forEachPatternFrom(*root_, std::string(), visit);
+        }
+        
+        // Reference matcher for a single pattern, used to check the trie
+        static bool matches(std::string_view pattern, std::string_view topic) {
+            size_t p = 0, t = 0;
+            while (true) {
+                if (p == kEnd) return t == kEnd;
+                size_t nextP, nextT;
+                std::string_view want = segmentAt(pattern, p, nextP);
+                if (want == "#" && nextP == kEnd) return true;
+                if (t == kEnd) return false;
+                std::string_view have = segmentAt(topic, t, nextT);
+                if (want != "*" && want != have) return false;
+                p = nextP;
+                t = nextT;
+            }
+        }
+    };
+    
     class MessageBroker {
     private:
         using MessageHandler = std::function<void(const std::string&, const std::any&)>;
@@ -118,80 +404,102 @@ namespace TopicBasedPubSub {
         struct Subscriber {
             std::string id;
             MessageHandler handler;
-            bool active = true;
+            // Cleared by unsubscribe, so publishers still holding the old
+            // table skip the handler from then on
+            std::atomic<bool> active{true};
         };
         
-        std::unordered_map<std::string, std::vector<std::shared_ptr<Subscriber>>> topics_;
-        mutable std::mutex mutex_;
+        using Topics = TopicTrie<std::shared_ptr<Subscriber>>;
+        
+        RcuSnapshot<Topics> topics_;
+        std::atomic<bool> verbose_{true};
+        
+        static size_t deliver(const Topics& topics, const std::string& topic, const std::any& message) {
+            return topics.match(topic, [&](const std::shared_ptr<Subscriber>& subscriber) {
+                if (subscriber->active.load(std::memory_order_acquire)) {
+                    subscriber->handler(topic, message);
+                }
+            });
+        }
         
     public:
-        // Subscribe to topic
+        // Turns the per-call log lines off for high-rate use
+        void setVerbose(bool verbose) { verbose_.store(verbose, std::memory_order_relaxed); }
+        
+        // Topic tables replaced but not yet past their grace period
+        size_t retiredTables() { return topics_.retiredCount(); }
+        
+        // Subscribe to a topic or wildcard pattern; throws
+        // std::invalid_argument if '#' is not the last segment
         std::shared_ptr<Subscriber> subscribe(const std::string& topic, 
                                              const std::string& subscriberId,
                                              MessageHandler handler) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            
             auto subscriber = std::make_shared<Subscriber>();
             subscriber->id = subscriberId;
             subscriber->handler = handler;
             
-            topics_[topic].push_back(subscriber);
+            topics_.update([&](Topics& topics) {
+                topics.insert(topic, subscriber);
+                return true;
+            });
             
-            std::cout << "Subscriber '" << subscriberId 
-                      << "' subscribed to topic '" << topic << "'\n";
+            if (verbose_.load(std::memory_order_relaxed)) {
+                std::cout << "Subscriber '" << subscriberId 
+                          << "' subscribed to topic '" << topic << "'\n";
+            }
             
             return subscriber;
         }
         
-        // Unsubscribe from topic
+        // Unsubscribe from a topic or pattern, given exactly as subscribed
         void unsubscribe(const std::string& topic, const std::string& subscriberId) {
-            std::lock_guard<std::mutex> lock(mutex_);
+            std::vector<std::shared_ptr<Subscriber>> unsubscribed;
+            bool removed = topics_.update([&](Topics& topics) {
+                return topics.erase(topic, [&](const std::shared_ptr<Subscriber>& sub) {
+                    if (sub->id != subscriberId) return false;
+                    unsubscribed.push_back(sub);
+                    return true;
+                }) > 0;
+            });
+            for (const auto& subscriber : unsubscribed) {
+                subscriber->active.store(false, std::memory_order_release);
+            }
             
-            auto it = topics_.find(topic);
-            if (it != topics_.end()) {
-                it->second.erase(
-                    std::remove_if(it->second.begin(), it->second.end(),
-                        [&subscriberId](const std::shared_ptr<Subscriber>& sub) {
-                            return sub->id == subscriberId;
-                        }),
-                    it->second.end()
-                );
-                
+            if (removed && verbose_.load(std::memory_order_relaxed)) {
                 std::cout << "Subscriber '" << subscriberId 
                           << "' unsubscribed from topic '" << topic << "'\n";
             }
         }
         
-        // Publish to topic
+        // Publish to topic; one trie walk finds literal and wildcard
+        // subscriptions, and no lock is held while handlers run
         template<typename T>
-        void publish(const std::string& topic, const T& message) {
-            std::lock_guard<std::mutex> lock(mutex_);
+        size_t publish(const std::string& topic, const T& message) {
+            auto topics = topics_.read();
             
-            auto it = topics_.find(topic);
-            if (it != topics_.end()) {
-                std::cout << "Publishing to topic '" << topic 
-                          << "' (" << it->second.size() << " subscribers)\n";
-                
-                std::any wrappedMessage = message;
-                for (const auto& subscriber : it->second) {
-                    if (subscriber->active) {
-                        subscriber->handler(topic, wrappedMessage);
-                    }
+            if (verbose_.load(std::memory_order_relaxed)) {
+                size_t matched = topics->match(topic, [](const std::shared_ptr<Subscriber>&) {});
+                if (matched == 0) {
+                    std::cout << "No subscribers for topic '" << topic << "'\n";
+                    return 0;
                 }
-            } else {
-                std::cout << "No subscribers for topic '" << topic << "'\n";
+                std::cout << "Publishing to topic '" << topic 
+                          << "' (" << matched << " subscribers)\n";
             }
+            
+            std::any wrappedMessage = message;
+            return deliver(*topics, topic, wrappedMessage);
         }
         
         // Get topic statistics
         void printStats() const {
-            std::lock_guard<std::mutex> lock(mutex_);
+            auto topics = topics_.read();
             
             std::cout << "\nBroker Statistics:\n";
-            for (const auto& [topic, subscribers] : topics_) {
-                std::cout << "  Topic '" << topic << "': " 
+            topics->forEachPattern([](const std::string& pattern, const auto& subscribers) {
+                std::cout << "  Topic '" << pattern << "': " 
                           << subscribers.size() << " subscribers\n";
-            }
+            });
         }
     };
     
@@ -228,8 +536,11 @@ namespace FilteredPubSub {
             int priority;
         };
         
-        std::vector<Subscription> subscriptions_;
-        mutable std::mutex mutex_;
+        // Kept sorted by descending priority; equal priorities stay in
+        // subscription order
+        using SubscriptionList = std::vector<Subscription>;
+        
+        RcuSnapshot<SubscriptionList> subscriptions_;
         
     public:
         // Subscribe with filter
@@ -237,26 +548,23 @@ namespace FilteredPubSub {
                       Filter filter, 
                       Handler handler,
                       int priority = 0) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            
-            subscriptions_.push_back({id, filter, handler, priority});
-            
-            // Sort by priority
-            std::sort(subscriptions_.begin(), subscriptions_.end(),
-                [](const Subscription& a, const Subscription& b) {
-                    return a.priority > b.priority;
-                });
+            subscriptions_.update([&](SubscriptionList& subs) {
+                auto position = std::upper_bound(subs.begin(), subs.end(), priority,
+                    [](int p, const Subscription& sub) { return p > sub.priority; });
+                subs.insert(position, {id, filter, handler, priority});
+                return true;
+            });
             
             std::cout << "Subscriber '" << id << "' registered with priority " 
                       << priority << "\n";
         }
         
-        // Publish event
+        // Publish event; filters and handlers run without any lock held
         void publish(const EventType& event) {
-            std::lock_guard<std::mutex> lock(mutex_);
+            auto subscriptions = subscriptions_.read();
             
             int matchCount = 0;
-            for (const auto& sub : subscriptions_) {
+            for (const auto& sub : *subscriptions) {
                 if (sub.filter(event)) {
                     sub.handler(event);
                     matchCount++;
@@ -269,13 +577,13 @@ namespace FilteredPubSub {
         
         // Remove subscriber
         void unsubscribe(const std::string& id) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            
-            subscriptions_.erase(
-                std::remove_if(subscriptions_.begin(), subscriptions_.end(),
-                    [&id](const Subscription& sub) { return sub.id == id; }),
-                subscriptions_.end()
-            );
+            subscriptions_.update([&id](SubscriptionList& subs) {
+                auto end = std::remove_if(subs.begin(), subs.end(),
+                    [&id](const Subscription& sub) { return sub.id == id; });
+                if (end == subs.end()) return false;
+                subs.erase(end, subs.end());
+                return true;
+            });
         }
     };
     
@@ -371,87 +679,172 @@ namespace WeakPubSub {
 
 // Example 5: Priority Queue Publish-Subscribe
 namespace PriorityPubSub {
+    // Delivery runs on a fixed set of worker threads, one per shard. Each
+    // subscriber is pinned to a shard when it subscribes, so its handler
+    // never runs concurrently with itself and receives events in priority
+    // order, FIFO among equal priorities. Subscribers on different shards
+    // are served in parallel, and a slow one only delays its own shard.
     class PriorityEventQueue {
     private:
+        using Handler = std::function<void(const std::any&)>;
+        
+        struct Route {
+            size_t shard;
+            std::shared_ptr<const Handler> handler;
+        };
+        
         struct Event {
             int priority;
-            std::any data;
+            uint64_t sequence;
+            std::shared_ptr<const std::any> data;   // Shared by every subscriber's copy
+            std::shared_ptr<const Handler> handler;
             std::chrono::steady_clock::time_point timestamp;
             
             bool operator<(const Event& other) const {
-                return priority < other.priority; // Higher priority first
+                if (priority != other.priority) {
+                    return priority < other.priority; // Higher priority first
+                }
+                return sequence > other.sequence;     // Then publish order
             }
         };
         
-        using Handler = std::function<void(const std::any&)>;
+        struct Shard {
+            std::mutex mutex;
+            std::condition_variable ready;
+            std::priority_queue<Event> queue;
+            bool stopping = false;
+            std::thread worker;
+        };
+        
+        using RouteTable = std::unordered_map<std::type_index, std::vector<Route>>;
+        
+        RcuSnapshot<RouteTable> routes_;
+        std::vector<std::unique_ptr<Shard>> shards_;
+        std::atomic<size_t> nextShard_{0};
+        std::atomic<uint64_t> sequence_{0};
+        std::atomic<size_t> failures_{0};
         
-        std::priority_queue<Event> eventQueue_;
-        std::unordered_map<std::type_index, std::vector<Handler>> handlers_;
-        std::mutex queueMutex_;
-        std::mutex handlerMutex_;
-        bool processing_ = false;
+        // Events queued or being handled, across all shards
+        std::atomic<size_t> pending_{0};
+        std::mutex idleMutex_;
+        std::condition_variable idle_;
+        
+        void run(Shard& shard) {
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            while (true) {
+                shard.ready.wait(lock, [&] { return shard.stopping || !shard.queue.empty(); });
+                if (shard.queue.empty()) return;
+                
+                Event event = shard.queue.top();
+                shard.queue.pop();
+                lock.unlock();
+                
+                try {
+                    (*event.handler)(*event.data);
+                } catch (...) {
+                    failures_.fetch_add(1, std::memory_order_relaxed);
+                }
+                event = Event();
+                
+                // Events the handler published are already counted, so zero
+                // really means idle
+                if (pending_.fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> idleLock(idleMutex_);
+                    idle_.notify_all();
+                }
+                lock.lock();
+            }
+        }
         
     public:
+        explicit PriorityEventQueue(size_t workers = std::max(1u, std::thread::hardware_concurrency())) {
+            for (size_t i = 0; i < std::max<size_t>(workers, 1); ++i) {
+                shards_.push_back(std::make_unique<Shard>());
+            }
+            for (auto& shard : shards_) {
+                shard->worker = std::thread([this, s = shard.get()] { run(*s); });
+            }
+        }
+        
+        PriorityEventQueue(const PriorityEventQueue&) = delete;
+        PriorityEventQueue& operator=(const PriorityEventQueue&) = delete;
+        
+        // Delivers everything already queued, then stops the workers
+        ~PriorityEventQueue() {
+            for (auto& shard : shards_) {
+                {
+                    std::lock_guard<std::mutex> lock(shard->mutex);
+                    shard->stopping = true;
+                }
+                shard->ready.notify_one();
+            }
+            for (auto& shard : shards_) {
+                shard->worker.join();
+            }
+        }
+        
         // Subscribe to event type
         template<typename T>
         void subscribe(std::function<void(const T&)> handler) {
-            std::lock_guard<std::mutex> lock(handlerMutex_);
+            Route route{
+                nextShard_.fetch_add(1) % shards_.size(),
+                std::make_shared<const Handler>([handler](const std::any& data) {
+                    handler(std::any_cast<const T&>(data));
+                })
+            };
             
             auto typeIndex = std::type_index(typeid(T));
-            handlers_[typeIndex].push_back(
-                [handler](const std::any& data) {
-                    handler(std::any_cast<const T&>(data));
-                }
-            );
+            routes_.update([&](RouteTable& routes) {
+                routes[typeIndex].push_back(route);
+                return true;
+            });
         }
         
-        // Publish with priority
+        // Publish with priority; queues one entry per subscriber and returns
+        // without waiting for delivery
         template<typename T>
         void publish(const T& data, int priority = 0) {
-            {
-                std::lock_guard<std::mutex> lock(queueMutex_);
-                eventQueue_.push({
-                    priority, 
-                    data, 
-                    std::chrono::steady_clock::now()
-                });
-            }
+            auto routes = routes_.read();
+            auto it = routes->find(std::type_index(typeid(T)));
+            if (it == routes->end()) return;
             
-            if (!processing_) {
-                processEvents();
-            }
-        }
-        
-        // Process queued events
-        void processEvents() {
-            processing_ = true;
+            auto payload = std::make_shared<const std::any>(data);
+            const uint64_t sequence = sequence_.fetch_add(1);
+            const auto timestamp = std::chrono::steady_clock::now();
             
-            while (true) {
-                Event event;
-                
+            pending_.fetch_add(it->second.size());
+            for (const Route& route : it->second) {
+                Shard& shard = *shards_[route.shard];
                 {
-                    std::lock_guard<std::mutex> lock(queueMutex_);
-                    if (eventQueue_.empty()) {
-                        break;
-                    }
-                    event = eventQueue_.top();
-                    eventQueue_.pop();
-                }
-                
-                // Dispatch event
-                std::lock_guard<std::mutex> lock(handlerMutex_);
-                auto typeIndex = std::type_index(event.data.type());
-                auto it = handlers_.find(typeIndex);
-                
-                if (it != handlers_.end()) {
-                    for (const auto& handler : it->second) {
-                        handler(event.data);
-                    }
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    shard.queue.push({priority, sequence, payload, route.handler, timestamp});
                 }
+                shard.ready.notify_one();
             }
-            
-            processing_ = false;
         }
+        
+        // Blocks until every published event has been handled, including
+        // events published by handlers meanwhile. Must not be called from a
+        // handler.
+        void processEvents() {
+            std::unique_lock<std::mutex> lock(idleMutex_);
+            idle_.wait(lock, [this] { return pending_.load() == 0; });
+        }
+        
+        size_t workerCount() const { return shards_.size(); }
+        
+        // Handlers that threw; delivery to other subscribers continues
+        size_t failedDeliveries() const { return failures_.load(std::memory_order_relaxed); }
+    };
+    
+    struct MarketTick {
+        std::string symbol;
+        uint64_t sequence;
+        double price;
+    };
+    
+    struct TradingHalt {
+        std::string symbol;
     };
 }
 
@@ -623,6 +1016,204 @@ void demonstrateWeakPubSub() {
     publisher.publish("Second message");
 }
 
+void demonstrateWildcardTopics() {
+    using namespace TopicBasedPubSub;
+    
+    std::cout << "\n=== Wildcard Topics ===\n";
+    
+    MessageBroker broker;
+    
+    broker.subscribe("sensors.*.temp", "thermostat",
+        [](const std::string& topic, const std::any& data) {
+            std::cout << "  Thermostat: " << topic << " = " 
+                      << std::any_cast<double>(data) << "\n";
+        }
+    );
+    broker.subscribe("sensors.lab.#", "labMonitor",
+        [](const std::string& topic, const std::any&) {
+            std::cout << "  LabMonitor: " << topic << "\n";
+        }
+    );
+    broker.subscribe("sensors.lab.humidity", "dehumidifier",
+        [](const std::string& topic, const std::any& data) {
+            std::cout << "  Dehumidifier: " << topic << " = " 
+                      << std::any_cast<double>(data) << "\n";
+        }
+    );
+    
+    broker.publish("sensors.lab.temp", 21.5);
+    broker.publish("sensors.lab.humidity", 0.43);
+    broker.publish("sensors.roof.temp", 12.0);
+    broker.publish("sensors.roof.wind", 7.5);
+    
+    broker.unsubscribe("sensors.lab.#", "labMonitor");
+    broker.publish("sensors.lab.temp", 21.7);
+    
+    try {
+        broker.subscribe("sensors.#.temp", "misplaced", [](const std::string&, const std::any&) {});
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Rejected: " << e.what() << "\n";
+    }
+    
+    broker.printStats();
+    
+    // One trie walk against a scan of every pattern, with 10k literal
+    // subscriptions (100 buildings x 100 rooms) plus two wildcards
+    const int sensors = 10000;
+    auto sensorTopic = [](int i) {
+        return "sensors.b" + std::to_string(i / 100) + ".r" + std::to_string(i % 100) + ".temp";
+    };
+    MessageBroker index;
+    index.setVerbose(false);
+    std::vector<std::string> patterns = {"sensors.*.*.temp", "sensors.#"};
+    for (int i = 0; i < sensors; ++i) {
+        patterns.push_back(sensorTopic(i));
+    }
+    for (size_t i = 0; i < patterns.size(); ++i) {
+        index.subscribe(patterns[i], "logger" + std::to_string(i),
+                        [](const std::string&, const std::any&) {});
+    }
+    
+    const int lookups = 200000;
+    std::vector<std::string> topics;
+    for (int i = 0; i < 64; ++i) {
+        topics.push_back(sensorTopic(i * 151 % sensors));
+    }
+    
+    size_t delivered = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < lookups; ++i) {
+        delivered += index.publish(topics[i % topics.size()], 1.0);
+    }
+    double trieNs = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / lookups;
+    
+    size_t scanned = 0;
+    const int scanLookups = lookups / 100;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < scanLookups; ++i) {
+        for (const auto& pattern : patterns) {
+            scanned += TopicTrie<int>::matches(pattern, topics[i % topics.size()]);
+        }
+    }
+    double scanNs = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / scanLookups;
+    
+    std::cout << "Matching against " << patterns.size() << " patterns: trie " 
+              << trieNs << " ns/publish, pattern scan " << scanNs << " ns/publish ("
+              << delivered / lookups << " and " << scanned / scanLookups << " matches each)\n";
+}
+
+void demonstrateConcurrentPublishing() {
+    using namespace TopicBasedPubSub;
+    
+    std::cout << "\n=== Lock-Free Publishing ===\n";
+    
+    MessageBroker broker;
+    broker.setVerbose(false);
+    
+    std::atomic<long> bids{0}, allQuotes{0}, aapl{0}, churned{0};
+    broker.subscribe("quotes.*.bid", "bidBook",
+        [&](const std::string&, const std::any&) { bids.fetch_add(1, std::memory_order_relaxed); });
+    broker.subscribe("quotes.#", "recorder",
+        [&](const std::string&, const std::any&) { allQuotes.fetch_add(1, std::memory_order_relaxed); });
+    broker.subscribe("quotes.AAPL.*", "aaplDesk",
+        [&](const std::string&, const std::any&) { aapl.fetch_add(1, std::memory_order_relaxed); });
+    
+    const std::vector<std::string> topics = {
+        "quotes.AAPL.bid", "quotes.AAPL.ask", "quotes.MSFT.bid", "quotes.MSFT.ask"
+    };
+    const int publishers = 4;
+    const int quotesPerPublisher = 250000;
+    
+    // A subscriber that keeps joining and leaving while quotes flow; with a
+    // locked broker every publisher would queue behind these updates
+    std::atomic<bool> publishing{true};
+    int churnCycles = 0;
+    std::thread churn([&] {
+        while (publishing.load()) {
+            broker.subscribe("quotes.MSFT.bid", "scalper",
+                [&](const std::string&, const std::any&) { churned.fetch_add(1, std::memory_order_relaxed); });
+            broker.unsubscribe("quotes.MSFT.bid", "scalper");
+            ++churnCycles;
+        }
+    });
+    
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < publishers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < quotesPerPublisher; ++i) {
+                broker.publish(topics[(i + p) % topics.size()], 100.0 + i * 0.01);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    publishing.store(false);
+    churn.join();
+    
+    const long total = static_cast<long>(publishers) * quotesPerPublisher;
+    std::cout << publishers << " publishers, " << total << " quotes in " << seconds * 1e3 
+              << " ms (" << total / seconds / 1e6 << " M publishes/s) during " 
+              << churnCycles << " subscribe/unsubscribe cycles\n";
+    std::cout << "bidBook " << bids.load() << ", recorder " << allQuotes.load() 
+              << ", aaplDesk " << aapl.load() << " (expected " << total / 2 << ", " 
+              << total << ", " << total / 2 << ")\n";
+    std::cout << "Retired topic tables still held: " << broker.retiredTables() 
+              << " (of " << 2 * churnCycles << " replaced)\n";
+}
+
+void demonstratePriorityPubSub() {
+    using namespace PriorityPubSub;
+    
+    std::cout << "\n=== Sharded Priority Publish-Subscribe ===\n";
+    
+    PriorityEventQueue queue(4);
+    
+    // Each subscriber checks that its ticks arrive in publish order; the
+    // halt is only delivered to the risk engine
+    struct Feed {
+        std::string name;
+        size_t ticks = 0;
+        uint64_t lastSequence = 0;
+        bool inOrder = true;
+        std::thread::id thread{};
+        bool oneThread = true;
+    };
+    std::vector<Feed> feeds = {{"orderBook"}, {"riskEngine"}, {"auditLog"}};
+    
+    for (auto& feed : feeds) {
+        queue.subscribe<MarketTick>([&feed](const MarketTick& tick) {
+            if (feed.ticks > 0 && tick.sequence <= feed.lastSequence) feed.inOrder = false;
+            if (feed.ticks > 0 && feed.thread != std::this_thread::get_id()) feed.oneThread = false;
+            feed.thread = std::this_thread::get_id();
+            feed.lastSequence = tick.sequence;
+            ++feed.ticks;
+        });
+    }
+    
+    std::atomic<int> halts{0};
+    queue.subscribe<TradingHalt>([&halts](const TradingHalt&) { halts.fetch_add(1); });
+    queue.subscribe<TradingHalt>([](const TradingHalt&) { throw std::runtime_error("halt handler failed"); });
+    
+    const uint64_t ticks = 100000;
+    for (uint64_t i = 1; i <= ticks; ++i) {
+        queue.publish(MarketTick{"AAPL", i, 150.0 + (i % 100) * 0.01});
+        if (i % 25000 == 0) queue.publish(TradingHalt{"AAPL"}, 10);
+    }
+    queue.processEvents();
+    
+    std::cout << queue.workerCount() << " worker shards\n";
+    for (const auto& feed : feeds) {
+        std::cout << "  " << feed.name << ": " << feed.ticks << " ticks, in publish order: " 
+                  << (feed.inOrder ? "yes" : "no") << ", one thread: " 
+                  << (feed.oneThread ? "yes" : "no") << "\n";
+    }
+    std::cout << "  Halts handled: " << halts.load() << ", failed deliveries: " 
+              << queue.failedDeliveries() << "\n";
+}
+
 int main() {
     std::cout << "=== Publish-Subscribe Pattern Demo ===\n\n";
     
@@ -630,6 +1221,9 @@ int main() {
     demonstrateTopicBasedPubSub();
     demonstrateFilteredPubSub();
     demonstrateWeakPubSub();
+    demonstrateWildcardTopics();
+    demonstrateConcurrentPublishing();
+    demonstratePriorityPubSub();
     
     std::cout << "\n=== Publish-Subscribe Benefits ===\n";
     std::cout << "1. Loose coupling between publishers and subscribers\n";
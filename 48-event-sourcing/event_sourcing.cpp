@@ -12,6 +12,32 @@
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
+#include <map>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
+
+// Aggregate state captured at a version, so loading can skip the events
+// before it. Used by Example 1's EventStore and Example 2's ShoppingCart.
+namespace SnapshotEventSourcing {
+    class Snapshot {
+    private:
+        std::string aggregateId_;
+        int version_;
+        std::any state_;
+        std::chrono::system_clock::time_point timestamp_;
+        
+    public:
+        Snapshot(const std::string& id, int version, std::any state)
+            : aggregateId_(id), version_(version), state_(state),
+              timestamp_(std::chrono::system_clock::now()) {}
+        
+        const std::string& getAggregateId() const { return aggregateId_; }
+        int getVersion() const { return version_; }
+        const std::any& getState() const { return state_; }
+    };
+}
 
 // Example 1: Basic Event Sourcing for Bank Account
 namespace BasicEventSourcing {
@@ -35,6 +61,15 @@ namespace BasicEventSourcing {
         
         virtual std::string getEventType() const = 0;
         virtual std::string toString() const = 0;
+        
+        // Copies the event into the store's arena
+        virtual Event* cloneInto(std::pmr::memory_resource& arena) const = 0;
+        
+    protected:
+        template<typename Derived>
+        static Event* cloneAs(const Derived& event, std::pmr::memory_resource& arena) {
+            return new (arena.allocate(sizeof(Derived), alignof(Derived))) Derived(event);
+        }
     };
     
     // Concrete Events
@@ -58,6 +93,10 @@ namespace BasicEventSourcing {
             return ss.str();
         }
         
+        Event* cloneInto(std::pmr::memory_resource& arena) const override {
+            return cloneAs(*this, arena);
+        }
+        
         const std::string& getAccountHolder() const { return accountHolder_; }
         double getInitialBalance() const { return initialBalance_; }
     };
@@ -80,6 +119,10 @@ namespace BasicEventSourcing {
             return ss.str();
         }
         
+        Event* cloneInto(std::pmr::memory_resource& arena) const override {
+            return cloneAs(*this, arena);
+        }
+        
         double getAmount() const { return amount_; }
     };
     
@@ -101,44 +144,143 @@ namespace BasicEventSourcing {
             return ss.str();
         }
         
+        Event* cloneInto(std::pmr::memory_resource& arena) const override {
+            return cloneAs(*this, arena);
+        }
+        
         double getAmount() const { return amount_; }
     };
     
-    // Event Store
+    // Event Store. Events are copied into a monotonic arena in append
+    // order; the global sequence number is an event's position in log_.
+    // Per-aggregate streams and a timestamp index are lists of positions,
+    // so aggregate loads, sequence ranges and time ranges are lookups
+    // rather than scans, and nothing is sorted on read.
     class EventStore {
     private:
-        std::unordered_map<std::string, std::vector<std::shared_ptr<Event>>> events_;
+        using Snapshot = SnapshotEventSourcing::Snapshot;
         
-    public:
-        void append(std::shared_ptr<Event> event) {
-            events_[event->getAggregateId()].push_back(event);
+        struct Stream {
+            std::vector<uint32_t> positions;          // Into log_, in version order
+            std::optional<Snapshot> latestSnapshot;
+        };
+        
+        // Monotonic arena that counts the bytes handed out
+        class CountingArena : public std::pmr::memory_resource {
+        private:
+            std::pmr::monotonic_buffer_resource upstream_{64 * 1024};
+            size_t bytes_ = 0;
+            
+            void* do_allocate(size_t bytes, size_t alignment) override {
+                bytes_ += bytes;
+                return upstream_.allocate(bytes, alignment);
+            }
+            void do_deallocate(void*, size_t, size_t) override {}
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }
             
-            std::cout << "Event stored: " << event->toString() 
-                      << " (v" << event->getVersion() << ")\n";
+        public:
+            size_t bytes() const { return bytes_; }
+        };
+        
+        CountingArena arena_;
+        std::vector<Event*> log_;
+        // Non-decreasing key per log position: the event's timestamp, or the
+        // previous key if the clock stepped back
+        std::vector<std::chrono::system_clock::time_point> timeIndex_;
+        std::unordered_map<std::string, Stream> streams_;
+        bool verbose_ = true;
+        
+        std::vector<const Event*> slice(size_t begin, size_t end) const {
+            return std::vector<const Event*>(log_.begin() + begin, log_.begin() + end);
         }
         
-        std::vector<std::shared_ptr<Event>> getEvents(const std::string& aggregateId) {
-            auto it = events_.find(aggregateId);
-            if (it != events_.end()) {
-                return it->second;
+    public:
+        EventStore() = default;
+        EventStore(const EventStore&) = delete;
+        EventStore& operator=(const EventStore&) = delete;
+        
+        // The arena releases memory but does not run destructors
+        ~EventStore() {
+            for (Event* event : log_) {
+                event->~Event();
             }
-            return {};
         }
         
-        std::vector<std::shared_ptr<Event>> getAllEvents() {
-            std::vector<std::shared_ptr<Event>> allEvents;
-            for (const auto& [id, events] : events_) {
-                allEvents.insert(allEvents.end(), events.begin(), events.end());
-            }
+        // Turns the per-event log line off for bulk loads
+        void setVerbose(bool verbose) { verbose_ = verbose; }
+        
+        // Copies the event into the store and returns its global sequence
+        // number (1-based)
+        uint64_t append(const std::shared_ptr<Event>& event) {
+            Event* stored = event->cloneInto(arena_);
             
-            // Sort by timestamp
-            std::sort(allEvents.begin(), allEvents.end(),
-                [](const auto& a, const auto& b) {
-                    return a->getTimestamp() < b->getTimestamp();
-                });
+            auto timestamp = stored->getTimestamp();
+            if (!timeIndex_.empty()) timestamp = std::max(timestamp, timeIndex_.back());
+            streams_[stored->getAggregateId()].positions.push_back(static_cast<uint32_t>(log_.size()));
+            log_.push_back(stored);
+            timeIndex_.push_back(timestamp);
             
-            return allEvents;
+            if (verbose_) {
+                std::cout << "Event stored: " << stored->toString() 
+                          << " (v" << stored->getVersion() << ")\n";
+            }
+            return log_.size();
         }
+        
+        // Events of one aggregate with version >= fromVersion
+        std::vector<const Event*> getEvents(const std::string& aggregateId, int fromVersion = 1) const {
+            std::vector<const Event*> events;
+            auto it = streams_.find(aggregateId);
+            if (it == streams_.end()) return events;
+            
+            const auto& positions = it->second.positions;
+            auto first = std::lower_bound(positions.begin(), positions.end(), fromVersion,
+                [this](uint32_t position, int version) { return log_[position]->getVersion() < version; });
+            events.reserve(static_cast<size_t>(positions.end() - first));
+            for (auto p = first; p != positions.end(); ++p) {
+                events.push_back(log_[*p]);
+            }
+            return events;
+        }
+        
+        // Every event in global sequence order
+        std::vector<const Event*> getAllEvents() const {
+            return slice(0, log_.size());
+        }
+        
+        // Events with sequence numbers in [fromSequence, toSequence]
+        std::vector<const Event*> getEventsBySequence(uint64_t fromSequence, uint64_t toSequence) const {
+            const size_t begin = static_cast<size_t>(std::max<uint64_t>(fromSequence, 1) - 1);
+            const size_t end = static_cast<size_t>(std::min<uint64_t>(toSequence, log_.size()));
+            return begin < end ? slice(begin, end) : std::vector<const Event*>();
+        }
+        
+        // Events stored with timestamps in [from, to]
+        std::vector<const Event*> getEventsBetween(std::chrono::system_clock::time_point from,
+                                                   std::chrono::system_clock::time_point to) const {
+            auto begin = std::lower_bound(timeIndex_.begin(), timeIndex_.end(), from);
+            auto end = std::upper_bound(begin, timeIndex_.end(), to);
+            return slice(static_cast<size_t>(begin - timeIndex_.begin()), 
+                         static_cast<size_t>(end - timeIndex_.begin()));
+        }
+        
+        void saveSnapshot(const Snapshot& snapshot) {
+            streams_[snapshot.getAggregateId()].latestSnapshot = snapshot;
+        }
+        
+        const Snapshot* getLatestSnapshot(const std::string& aggregateId) const {
+            auto it = streams_.find(aggregateId);
+            if (it == streams_.end() || !it->second.latestSnapshot) return nullptr;
+            return &*it->second.latestSnapshot;
+        }
+        
+        size_t size() const { return log_.size(); }
+        
+        // Bytes of event objects in the arena; strings longer than the
+        // small-string buffer still live on the heap
+        size_t arenaBytes() const { return arena_.bytes(); }
     };
     
     // Aggregate Root
@@ -150,20 +292,26 @@ namespace BasicEventSourcing {
         int version_;
         std::vector<std::shared_ptr<Event>> uncommittedEvents_;
         
-        void apply(std::shared_ptr<AccountCreatedEvent> event) {
-            accountHolder_ = event->getAccountHolder();
-            balance_ = event->getInitialBalance();
+        void apply(const AccountCreatedEvent& event) {
+            accountHolder_ = event.getAccountHolder();
+            balance_ = event.getInitialBalance();
         }
         
-        void apply(std::shared_ptr<MoneyDepositedEvent> event) {
-            balance_ += event->getAmount();
+        void apply(const MoneyDepositedEvent& event) {
+            balance_ += event.getAmount();
         }
         
-        void apply(std::shared_ptr<MoneyWithdrawnEvent> event) {
-            balance_ -= event->getAmount();
+        void apply(const MoneyWithdrawnEvent& event) {
+            balance_ -= event.getAmount();
         }
         
     public:
+        // State captured in a snapshot
+        struct AccountState {
+            std::string accountHolder;
+            double balance;
+        };
+        
         BankAccount(const std::string& id) : id_(id), balance_(0), version_(0) {}
         
         // Command handlers
@@ -174,7 +322,7 @@ namespace BasicEventSourcing {
             
             auto event = std::make_shared<AccountCreatedEvent>(
                 id_, ++version_, holder, initialBalance);
-            applyEvent(event);
+            applyEvent(*event);
             uncommittedEvents_.push_back(event);
         }
         
@@ -188,7 +336,7 @@ namespace BasicEventSourcing {
             
             auto event = std::make_shared<MoneyDepositedEvent>(
                 id_, ++version_, amount, description);
-            applyEvent(event);
+            applyEvent(*event);
             uncommittedEvents_.push_back(event);
         }
         
@@ -205,29 +353,40 @@ namespace BasicEventSourcing {
             
             auto event = std::make_shared<MoneyWithdrawnEvent>(
                 id_, ++version_, amount, description);
-            applyEvent(event);
+            applyEvent(*event);
             uncommittedEvents_.push_back(event);
         }
         
         // Apply event polymorphically
-        void applyEvent(std::shared_ptr<Event> event) {
-            if (auto e = std::dynamic_pointer_cast<AccountCreatedEvent>(event)) {
-                apply(e);
-            } else if (auto e = std::dynamic_pointer_cast<MoneyDepositedEvent>(event)) {
-                apply(e);
-            } else if (auto e = std::dynamic_pointer_cast<MoneyWithdrawnEvent>(event)) {
-                apply(e);
+        void applyEvent(const Event& event) {
+            if (auto e = dynamic_cast<const AccountCreatedEvent*>(&event)) {
+                apply(*e);
+            } else if (auto e = dynamic_cast<const MoneyDepositedEvent*>(&event)) {
+                apply(*e);
+            } else if (auto e = dynamic_cast<const MoneyWithdrawnEvent*>(&event)) {
+                apply(*e);
             }
         }
         
         // Load from event stream
-        void loadFromHistory(const std::vector<std::shared_ptr<Event>>& events) {
-            for (const auto& event : events) {
-                applyEvent(event);
+        void loadFromHistory(const std::vector<const Event*>& events) {
+            for (const Event* event : events) {
+                applyEvent(*event);
                 version_ = event->getVersion();
             }
         }
         
+        SnapshotEventSourcing::Snapshot createSnapshot() const {
+            return SnapshotEventSourcing::Snapshot(id_, version_, AccountState{accountHolder_, balance_});
+        }
+        
+        void restoreFromSnapshot(const SnapshotEventSourcing::Snapshot& snapshot) {
+            const auto& state = std::any_cast<const AccountState&>(snapshot.getState());
+            accountHolder_ = state.accountHolder;
+            balance_ = state.balance;
+            version_ = snapshot.getVersion();
+        }
+        
         // Get uncommitted events
         std::vector<std::shared_ptr<Event>> getUncommittedEvents() {
             return uncommittedEvents_;
@@ -242,27 +401,58 @@ namespace BasicEventSourcing {
         const std::string& getAccountHolder() const { return accountHolder_; }
         int getVersion() const { return version_; }
     };
-}
-
-// Example 2: Event Sourcing with Snapshots
-namespace SnapshotEventSourcing {
-    // Snapshot class
-    class Snapshot {
+    
+    // Saves and loads accounts through the store, taking a snapshot each
+    // time an account's version crosses a multiple of snapshotEvery so a
+    // load replays at most snapshotEvery - 1 events
+    class BankAccountRepository {
     private:
-        std::string aggregateId_;
-        int version_;
-        std::any state_;
-        std::chrono::system_clock::time_point timestamp_;
+        EventStore& store_;
+        int snapshotEvery_;
+        size_t snapshotsTaken_ = 0;
         
     public:
-        Snapshot(const std::string& id, int version, std::any state)
-            : aggregateId_(id), version_(version), state_(state),
-              timestamp_(std::chrono::system_clock::now()) {}
+        BankAccountRepository(EventStore& store, int snapshotEvery)
+            : store_(store), snapshotEvery_(snapshotEvery) {
+            if (snapshotEvery <= 0) {
+                throw std::invalid_argument("snapshotEvery must be positive");
+            }
+        }
         
-        const std::string& getAggregateId() const { return aggregateId_; }
-        int getVersion() const { return version_; }
-        const std::any& getState() const { return state_; }
+        void save(BankAccount& account) {
+            auto events = account.getUncommittedEvents();
+            if (events.empty()) return;
+            
+            for (const auto& event : events) {
+                store_.append(event);
+            }
+            account.markEventsAsCommitted();
+            
+            const int before = events.front()->getVersion() - 1;
+            if (account.getVersion() / snapshotEvery_ > before / snapshotEvery_) {
+                store_.saveSnapshot(account.createSnapshot());
+                ++snapshotsTaken_;
+            }
+        }
+        
+        BankAccount load(const std::string& id) const {
+            BankAccount account(id);
+            int fromVersion = 1;
+            if (const auto* snapshot = store_.getLatestSnapshot(id)) {
+                account.restoreFromSnapshot(*snapshot);
+                fromVersion = snapshot->getVersion() + 1;
+            }
+            account.loadFromHistory(store_.getEvents(id, fromVersion));
+            return account;
+        }
+        
+        size_t snapshotsTaken() const { return snapshotsTaken_; }
     };
+}
+
+// Example 2: Event Sourcing with Snapshots
+namespace SnapshotEventSourcing {
+    // Snapshot is defined at the top of the file
     
     // Shopping Cart Events
     class ItemAddedEvent {
@@ -431,23 +621,42 @@ namespace ProjectionEventSourcing {
         std::unordered_map<std::string, OrderStatus> orders_;
         
     public:
-        void apply(std::shared_ptr<OrderEvent> event) {
-            if (auto e = std::dynamic_pointer_cast<OrderPlacedEvent>(event)) {
+        void apply(const OrderEvent& event) {
+            if (auto e = dynamic_cast<const OrderPlacedEvent*>(&event)) {
                 orders_[e->orderId] = {
                     e->orderId, e->customerId, "Placed", ""
                 };
-            } else if (auto e = std::dynamic_pointer_cast<OrderShippedEvent>(event)) {
-                if (orders_.find(e->orderId) != orders_.end()) {
-                    orders_[e->orderId].status = "Shipped";
-                    orders_[e->orderId].trackingNumber = e->trackingNumber;
+            } else if (auto e = dynamic_cast<const OrderShippedEvent*>(&event)) {
+                auto it = orders_.find(e->orderId);
+                if (it != orders_.end()) {
+                    it->second.status = "Shipped";
+                    it->second.trackingNumber = e->trackingNumber;
                 }
-            } else if (auto e = std::dynamic_pointer_cast<OrderDeliveredEvent>(event)) {
-                if (orders_.find(e->orderId) != orders_.end()) {
-                    orders_[e->orderId].status = "Delivered";
+            } else if (auto e = dynamic_cast<const OrderDeliveredEvent*>(&event)) {
+                auto it = orders_.find(e->orderId);
+                if (it != orders_.end()) {
+                    it->second.status = "Delivered";
                 }
             }
         }
         
+        void apply(std::shared_ptr<OrderEvent> event) { apply(*event); }
+        
+        // Partitions hold disjoint orders, so merging is a union
+        void mergeFrom(const OrderStatusProjection& other) {
+            orders_.insert(other.orders_.begin(), other.orders_.end());
+        }
+        
+        size_t size() const { return orders_.size(); }
+        
+        std::map<std::string, size_t> countByStatus() const {
+            std::map<std::string, size_t> counts;
+            for (const auto& [id, status] : orders_) {
+                counts[status.status]++;
+            }
+            return counts;
+        }
+        
         void printOrderStatuses() const {
             std::cout << "\nOrder Status Projection:\n";
             for (const auto& [id, status] : orders_) {
@@ -467,12 +676,23 @@ namespace ProjectionEventSourcing {
         std::unordered_map<std::string, int> orderCounts_;
         
     public:
-        void apply(std::shared_ptr<OrderEvent> event) {
-            if (auto e = std::dynamic_pointer_cast<OrderPlacedEvent>(event)) {
+        void apply(const OrderEvent& event) {
+            if (auto e = dynamic_cast<const OrderPlacedEvent*>(&event)) {
                 orderCounts_[e->customerId]++;
             }
         }
         
+        void apply(std::shared_ptr<OrderEvent> event) { apply(*event); }
+        
+        // A customer's orders can land in several partitions, so counts add
+        void mergeFrom(const CustomerOrderCountProjection& other) {
+            for (const auto& [customerId, count] : other.orderCounts_) {
+                orderCounts_[customerId] += count;
+            }
+        }
+        
+        const std::unordered_map<std::string, int>& getOrderCounts() const { return orderCounts_; }
+        
         void printCustomerOrderCounts() const {
             std::cout << "\nCustomer Order Count Projection:\n";
             for (const auto& [customerId, count] : orderCounts_) {
@@ -481,6 +701,74 @@ namespace ProjectionEventSourcing {
             }
         }
     };
+    
+    // Runs a projection as K independent partitions chosen by hashing the
+    // order ID. Every event of an order lands in the same partition in log
+    // order, so partitions can apply their share on separate threads with
+    // no locking. The checkpoint is the log position applied so far;
+    // catchUp() only touches events appended since the last call.
+    template<typename Projection>
+    class PartitionedProjection {
+    private:
+        std::vector<Projection> partitions_;
+        size_t checkpoint_ = 0;
+        
+        size_t partitionOf(const std::string& orderId) const {
+            return std::hash<std::string>{}(orderId) % partitions_.size();
+        }
+        
+    public:
+        explicit PartitionedProjection(size_t partitions)
+            : partitions_(std::max<size_t>(partitions, 1)) {}
+        
+        // Applies log[checkpoint, end) and returns the number of events applied
+        size_t catchUp(const std::vector<std::shared_ptr<OrderEvent>>& log) {
+            if (checkpoint_ >= log.size()) return 0;
+            
+            std::vector<std::vector<const OrderEvent*>> buckets(partitions_.size());
+            for (size_t i = checkpoint_; i < log.size(); ++i) {
+                buckets[partitionOf(log[i]->orderId)].push_back(log[i].get());
+            }
+            
+            auto applyPartition = [this, &buckets](size_t p) {
+                for (const OrderEvent* event : buckets[p]) {
+                    partitions_[p].apply(*event);
+                }
+            };
+            std::vector<std::thread> workers;
+            for (size_t p = 1; p < partitions_.size(); ++p) {
+                workers.emplace_back(applyPartition, p);
+            }
+            applyPartition(0);
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            
+            const size_t applied = log.size() - checkpoint_;
+            checkpoint_ = log.size();
+            return applied;
+        }
+        
+        // Discards all partitions and replays the log from the start
+        void rebuild(const std::vector<std::shared_ptr<OrderEvent>>& log) {
+            for (auto& partition : partitions_) {
+                partition = Projection();
+            }
+            checkpoint_ = 0;
+            catchUp(log);
+        }
+        
+        Projection merged() const {
+            Projection result;
+            for (const auto& partition : partitions_) {
+                result.mergeFrom(partition);
+            }
+            return result;
+        }
+        
+        size_t checkpoint() const { return checkpoint_; }
+        size_t partitionCount() const { return partitions_.size(); }
+    };
 }
 
 // Example 4: Event Store with Replay
@@ -495,29 +783,34 @@ namespace EventReplay {
             bool success;
         };
         
+        // Kept sorted by timestamp so replay stops at the cut-off
         std::vector<AuditEvent> events_;
         
+        static bool earlier(std::chrono::system_clock::time_point t, const AuditEvent& e) {
+            return t < e.timestamp;
+        }
+        
     public:
         void recordEvent(const std::string& userId, const std::string& action,
                         const std::string& resource, bool success) {
-            events_.push_back({
-                userId, action, resource, 
-                std::chrono::system_clock::now(), success
-            });
+            auto now = std::chrono::system_clock::now();
+            // Appends unless the clock stepped back
+            auto position = std::upper_bound(events_.begin(), events_.end(), now, earlier);
+            events_.insert(position, {userId, action, resource, now, success});
         }
         
         // Replay events with time travel
         void replayUntil(std::chrono::system_clock::time_point pointInTime) {
             std::cout << "\nReplaying events until specified time:\n";
             
-            for (const auto& event : events_) {
-                if (event.timestamp <= pointInTime) {
-                    auto time_t = std::chrono::system_clock::to_time_t(event.timestamp);
-                    std::cout << "  [" << std::put_time(std::localtime(&time_t), "%H:%M:%S") 
-                              << "] User " << event.userId << " " << event.action 
-                              << " " << event.resource 
-                              << " - " << (event.success ? "SUCCESS" : "FAILED") << "\n";
-                }
+            auto end = std::upper_bound(events_.begin(), events_.end(), pointInTime, earlier);
+            for (auto it = events_.begin(); it != end; ++it) {
+                const auto& event = *it;
+                auto time_t = std::chrono::system_clock::to_time_t(event.timestamp);
+                std::cout << "  [" << std::put_time(std::localtime(&time_t), "%H:%M:%S") 
+                          << "] User " << event.userId << " " << event.action 
+                          << " " << event.resource 
+                          << " - " << (event.success ? "SUCCESS" : "FAILED") << "\n";
             }
         }
         
@@ -664,6 +957,139 @@ void demonstrateEventReplay() {
     auditLog.replayUntil(replayTime);
 }
 
+void demonstrateScalableEventStore() {
+    using Clock = std::chrono::steady_clock;
+    auto msSince = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+    
+    std::cout << "\n=== Scalable Event Store ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+    
+    {
+        using namespace BasicEventSourcing;
+        
+        const int operations = 20050;
+        const int snapshotEvery = 100;
+        EventStore store;
+        store.setVerbose(false);
+        BankAccountRepository repository(store, snapshotEvery);
+        
+        BankAccount account("ACC100");
+        account.create("Jane Roe", 1000.0);
+        for (int i = 1; i < operations; ++i) {
+            if (i % 3 == 0) {
+                account.withdraw(5.0, "Card");
+            } else {
+                account.deposit(10.0, "Transfer");
+            }
+            if (i % 7 == 0) {
+                repository.save(account);
+            }
+        }
+        repository.save(account);
+        
+        std::cout << store.size() << " events, " << repository.snapshotsTaken() 
+                  << " snapshots (every " << snapshotEvery << " events)\n";
+        std::cout << "Arena: " << store.arenaBytes() / store.size() << " bytes per event\n";
+        
+        const int loads = 50;
+        auto start = Clock::now();
+        double fullBalance = 0;
+        for (int i = 0; i < loads; ++i) {
+            BankAccount replayed("ACC100");
+            replayed.loadFromHistory(store.getEvents("ACC100"));
+            fullBalance = replayed.getBalance();
+        }
+        double fullUs = msSince(start) * 1000 / loads;
+        
+        start = Clock::now();
+        double snapshotBalance = 0;
+        int snapshotVersion = 0;
+        for (int i = 0; i < loads; ++i) {
+            BankAccount loaded = repository.load("ACC100");
+            snapshotBalance = loaded.getBalance();
+            snapshotVersion = loaded.getVersion();
+        }
+        double snapshotUs = msSince(start) * 1000 / loads;
+        
+        std::cout << "Full replay: " << fullUs << " us, snapshot + tail: " << snapshotUs 
+                  << " us (v" << snapshotVersion << ", replayed " 
+                  << store.getEvents("ACC100", store.getLatestSnapshot("ACC100")->getVersion() + 1).size()
+                  << " events)\n";
+        std::cout << "Balances match: " << (fullBalance == snapshotBalance ? "yes" : "no") 
+                  << " ($" << snapshotBalance << ")\n";
+        
+        auto bySequence = store.getEventsBySequence(10001, 10010);
+        std::cout << "Sequence read 10001-10010: " << bySequence.size() << " events, versions " 
+                  << bySequence.front()->getVersion() << "-" << bySequence.back()->getVersion() << "\n";
+        auto all = store.getAllEvents();
+        auto byTime = store.getEventsBetween(all[4999]->getTimestamp(), all[5999]->getTimestamp());
+        std::cout << "Time-range read: " << byTime.size() << " events, covers #5000-#6000: " 
+                  << (byTime.size() >= 1001 ? "yes" : "no") << "\n";
+    }
+    
+    {
+        using namespace ProjectionEventSourcing;
+        
+        const int orders = 60000;
+        std::vector<std::shared_ptr<OrderEvent>> log;
+        auto appendOrders = [&log](int first, int last) {
+            for (int i = first; i < last; ++i) {
+                std::string orderId = "ORD" + std::to_string(i);
+                log.push_back(std::make_shared<OrderPlacedEvent>(orderId, "CUST" + std::to_string(i % 1000)));
+                if (i % 2 == 0) log.push_back(std::make_shared<OrderShippedEvent>(orderId, "TRK" + std::to_string(i)));
+                if (i % 4 == 0) log.push_back(std::make_shared<OrderDeliveredEvent>(orderId));
+            }
+        };
+        appendOrders(0, orders);
+        
+        auto start = Clock::now();
+        OrderStatusProjection serial;
+        for (const auto& event : log) {
+            serial.apply(*event);
+        }
+        double serialMs = msSince(start);
+        
+        const size_t partitions = std::max(2u, std::thread::hardware_concurrency());
+        PartitionedProjection<OrderStatusProjection> statuses(partitions);
+        PartitionedProjection<CustomerOrderCountProjection> counts(partitions);
+        start = Clock::now();
+        statuses.rebuild(log);
+        double partitionedMs = msSince(start);
+        counts.rebuild(log);
+        
+        std::cout << "Projection rebuild over " << log.size() << " events: serial " << serialMs 
+                  << " ms, " << partitions << " partitions " << partitionedMs << " ms\n";
+        
+        // New events since the checkpoint are all a catch-up applies
+        appendOrders(orders, orders + 1000);
+        start = Clock::now();
+        size_t applied = statuses.catchUp(log);
+        double catchUpMs = msSince(start);
+        counts.catchUp(log);
+        
+        OrderStatusProjection full;
+        CustomerOrderCountProjection fullCounts;
+        for (const auto& event : log) {
+            full.apply(*event);
+            fullCounts.apply(*event);
+        }
+        std::cout << "Catch-up from checkpoint: " << applied << " events in " << catchUpMs 
+                  << " ms, checkpoint " << statuses.checkpoint() << "\n";
+        
+        auto merged = statuses.merged();
+        auto byStatus = merged.countByStatus();
+        std::cout << "Orders: " << merged.size() << " (Placed " << byStatus["Placed"] 
+                  << ", Shipped " << byStatus["Shipped"] << ", Delivered " << byStatus["Delivered"] << ")\n";
+        std::cout << "Matches full rebuild: " 
+                  << (byStatus == full.countByStatus() 
+                      && counts.merged().getOrderCounts() == fullCounts.getOrderCounts() ? "yes" : "no") << "\n";
+    }
+    
+    std::cout << std::defaultfloat;
+}
+
 int main() {
     std::cout << "=== Event Sourcing Pattern Demo ===\n\n";
     
@@ -671,6 +1097,7 @@ int main() {
     demonstrateSnapshotEventSourcing();
     demonstrateProjections();
     demonstrateEventReplay();
+    demonstrateScalableEventStore();
     
     std::cout << "\n=== Event Sourcing Benefits ===\n";
     std::cout << "1. Complete audit trail\n";
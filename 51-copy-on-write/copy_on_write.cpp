@@ -7,6 +7,14 @@
 #include <atomic>
 #include <mutex>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
 
 // Example 1: Basic Copy-on-Write String
 namespace BasicCopyOnWrite {
@@ -133,41 +141,57 @@ namespace COWVector {
         };
         
         std::shared_ptr<SharedData> sharedData_;
+        static inline bool verbose_ = true;
         
         void ensureUnique() {
             if (sharedData_.use_count() > 1) {
-                std::cout << "COWVector: Creating copy for modification\n";
+                if (verbose_) {
+                    std::cout << "COWVector: Creating copy for modification\n";
+                }
                 sharedData_ = std::make_shared<SharedData>(sharedData_->data);
             }
         }
         
     public:
+        // Turns the per-operation log off for benchmarks
+        static void setVerbose(bool verbose) { verbose_ = verbose; }
+        
         // Constructors
         COWVector() : sharedData_(std::make_shared<SharedData>()) {
-            std::cout << "COWVector: Creating empty vector\n";
+            if (verbose_) {
+                std::cout << "COWVector: Creating empty vector\n";
+            }
         }
         
         explicit COWVector(const std::vector<T>& vec) 
             : sharedData_(std::make_shared<SharedData>(vec)) {
-            std::cout << "COWVector: Creating vector with " << vec.size() << " elements\n";
+            if (verbose_) {
+                std::cout << "COWVector: Creating vector with " << vec.size() << " elements\n";
+            }
         }
         
         explicit COWVector(std::initializer_list<T> init) 
             : sharedData_(std::make_shared<SharedData>(std::vector<T>(init))) {
-            std::cout << "COWVector: Creating vector with " << init.size() << " elements\n";
+            if (verbose_) {
+                std::cout << "COWVector: Creating vector with " << init.size() << " elements\n";
+            }
         }
         
         // Copy operations (shallow)
         COWVector(const COWVector& other) : sharedData_(other.sharedData_) {
-            std::cout << "COWVector: Shallow copy (ref count: " 
-                      << sharedData_.use_count() << ")\n";
+            if (verbose_) {
+                std::cout << "COWVector: Shallow copy (ref count: " 
+                          << sharedData_.use_count() << ")\n";
+            }
         }
         
         COWVector& operator=(const COWVector& other) {
             if (this != &other) {
                 sharedData_ = other.sharedData_;
-                std::cout << "COWVector: Shallow assignment (ref count: " 
-                          << sharedData_.use_count() << ")\n";
+                if (verbose_) {
+                    std::cout << "COWVector: Shallow assignment (ref count: " 
+                              << sharedData_.use_count() << ")\n";
+                }
             }
             return *this;
         }
@@ -210,31 +234,41 @@ namespace COWVector {
         void push_back(const T& value) {
             ensureUnique();
             sharedData_->data.push_back(value);
-            std::cout << "COWVector: Pushed back element\n";
+            if (verbose_) {
+                std::cout << "COWVector: Pushed back element\n";
+            }
         }
         
         void pop_back() {
             ensureUnique();
             sharedData_->data.pop_back();
-            std::cout << "COWVector: Popped back element\n";
+            if (verbose_) {
+                std::cout << "COWVector: Popped back element\n";
+            }
         }
         
         void insert(size_t pos, const T& value) {
             ensureUnique();
             sharedData_->data.insert(sharedData_->data.begin() + pos, value);
-            std::cout << "COWVector: Inserted element at position " << pos << "\n";
+            if (verbose_) {
+                std::cout << "COWVector: Inserted element at position " << pos << "\n";
+            }
         }
         
         void erase(size_t pos) {
             ensureUnique();
             sharedData_->data.erase(sharedData_->data.begin() + pos);
-            std::cout << "COWVector: Erased element at position " << pos << "\n";
+            if (verbose_) {
+                std::cout << "COWVector: Erased element at position " << pos << "\n";
+            }
         }
         
         void clear() {
             ensureUnique();
             sharedData_->data.clear();
-            std::cout << "COWVector: Cleared all elements\n";
+            if (verbose_) {
+                std::cout << "COWVector: Cleared all elements\n";
+            }
         }
         
         // Non-const reference access (triggers COW)
@@ -283,31 +317,43 @@ namespace COWDocument {
         };
         
         std::shared_ptr<DocumentData> data_;
+        static inline bool verbose_ = true;
         
         void ensureUnique() {
             if (data_.use_count() > 1) {
-                std::cout << "Document: Creating copy for modification\n";
+                if (verbose_) {
+                    std::cout << "Document: Creating copy for modification\n";
+                }
                 data_ = std::make_shared<DocumentData>(*data_);
             }
         }
         
     public:
+        // Turns the per-operation log off for benchmarks
+        static void setVerbose(bool verbose) { verbose_ = verbose; }
+        
         explicit Document(const std::string& initialContent = "") 
             : data_(std::make_shared<DocumentData>(initialContent)) {
-            std::cout << "Document: Created with content: \"" << initialContent << "\"\n";
+            if (verbose_) {
+                std::cout << "Document: Created with content: \"" << initialContent << "\"\n";
+            }
         }
         
         // Copy operations (shallow)
         Document(const Document& other) : data_(other.data_) {
-            std::cout << "Document: Shallow copy (ref count: " 
-                      << data_.use_count() << ")\n";
+            if (verbose_) {
+                std::cout << "Document: Shallow copy (ref count: " 
+                          << data_.use_count() << ")\n";
+            }
         }
         
         Document& operator=(const Document& other) {
             if (this != &other) {
                 data_ = other.data_;
-                std::cout << "Document: Shallow assignment (ref count: " 
-                          << data_.use_count() << ")\n";
+                if (verbose_) {
+                    std::cout << "Document: Shallow assignment (ref count: " 
+                              << data_.use_count() << ")\n";
+                }
             }
             return *this;
         }
@@ -330,28 +376,36 @@ namespace COWDocument {
             ensureUnique();
             data_->content = newContent;
             data_->history.push_back(newContent);
-            std::cout << "Document: Set text to: \"" << newContent << "\"\n";
+            if (verbose_) {
+                std::cout << "Document: Set text to: \"" << newContent << "\"\n";
+            }
         }
         
         void append(const std::string& text) {
             ensureUnique();
             data_->content += text;
             data_->history.push_back(data_->content);
-            std::cout << "Document: Appended: \"" << text << "\"\n";
+            if (verbose_) {
+                std::cout << "Document: Appended: \"" << text << "\"\n";
+            }
         }
         
         void insert(size_t pos, const std::string& text) {
             ensureUnique();
             data_->content.insert(pos, text);
             data_->history.push_back(data_->content);
-            std::cout << "Document: Inserted \"" << text << "\" at position " << pos << "\n";
+            if (verbose_) {
+                std::cout << "Document: Inserted \"" << text << "\" at position " << pos << "\n";
+            }
         }
         
         void erase(size_t pos, size_t count) {
             ensureUnique();
             data_->content.erase(pos, count);
             data_->history.push_back(data_->content);
-            std::cout << "Document: Erased " << count << " characters at position " << pos << "\n";
+            if (verbose_) {
+                std::cout << "Document: Erased " << count << " characters at position " << pos << "\n";
+            }
         }
         
         bool undo() {
@@ -362,7 +416,9 @@ namespace COWDocument {
             ensureUnique();
             data_->history.pop_back();
             data_->content = data_->history.back();
-            std::cout << "Document: Undo - restored to: \"" << data_->content << "\"\n";
+            if (verbose_) {
+                std::cout << "Document: Undo - restored to: \"" << data_->content << "\"\n";
+            }
             return true;
         }
         
@@ -494,6 +550,480 @@ namespace SmartCOW {
     };
 }
 
+// Example 5: Structural Sharing
+// The containers above copy the whole buffer on the first write after a
+// share. These split their data into small immutable nodes instead. A
+// write copies only the nodes on the path to the touched chunk, and every
+// other node stays shared with older versions.
+namespace StructuralSharing {
+    // Reference count embedded in each node. Containers that never cross
+    // threads pass ThreadSafe = false and skip the locked instructions.
+    template<bool ThreadSafe>
+    class RefCount {
+    private:
+        std::atomic<uint32_t> count_{1};
+        
+    public:
+        void retain() { count_.fetch_add(1, std::memory_order_relaxed); }
+        bool release() { return count_.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+        bool unique() const { return count_.load(std::memory_order_acquire) == 1; }
+    };
+    
+    template<>
+    class RefCount<false> {
+    private:
+        uint32_t count_ = 1;
+        
+    public:
+        void retain() { ++count_; }
+        bool release() { return --count_ == 0; }
+        bool unique() const { return count_ == 1; }
+    };
+    
+    // Intrusive pointer to a node with a `refs` member. A new node starts
+    // with a count of one, which the first NodePtr adopts.
+    template<typename Node>
+    class NodePtr {
+    private:
+        Node* node_ = nullptr;
+        
+    public:
+        NodePtr() = default;
+        explicit NodePtr(Node* node) : node_(node) {}
+        
+        NodePtr(const NodePtr& other) : node_(other.node_) {
+            if (node_) node_->refs.retain();
+        }
+        
+        NodePtr(NodePtr&& other) noexcept : node_(std::exchange(other.node_, nullptr)) {}
+        
+        NodePtr& operator=(NodePtr other) noexcept {
+            std::swap(node_, other.node_);
+            return *this;
+        }
+        
+        ~NodePtr() {
+            if (node_ && node_->refs.release()) delete node_;
+        }
+        
+        Node* get() const { return node_; }
+        Node* operator->() const { return node_; }
+        Node& operator*() const { return *node_; }
+        explicit operator bool() const { return node_ != nullptr; }
+        
+        // Only this pointer refers to the node, so it may be edited in place
+        bool unique() const { return node_ && node_->refs.unique(); }
+    };
+    
+    // Makes `slot` the sole owner of its node, copying it if it is shared
+    template<typename Node>
+    void ensureUnique(NodePtr<Node>& slot) {
+        if (!slot.unique()) {
+            slot = NodePtr<Node>(new Node(*slot));
+        }
+    }
+    
+    // Persistent vector as a 32-way radix trie (the layout Clojure's vector
+    // uses). Leaves hold 32 elements. Copying the vector copies the root
+    // pointer, and a write copies the log32(n) nodes on one root-to-leaf
+    // path. Nodes this vector owns alone are edited in place.
+    template<typename T, bool ThreadSafe = true>
+    class PersistentVector {
+    private:
+        static constexpr unsigned kBits = 5;
+        static constexpr size_t kWidth = size_t(1) << kBits;
+        static constexpr size_t kMask = kWidth - 1;
+        
+        struct Node {
+            RefCount<ThreadSafe> refs;
+            std::vector<NodePtr<Node>> children;   // Inner nodes
+            std::vector<T> values;                 // Leaves
+            
+            Node() = default;
+            Node(const Node& other) : children(other.children), values(other.values) {}
+        };
+        
+        NodePtr<Node> root_;
+        size_t size_ = 0;
+        unsigned shift_ = 0;        // kBits * (levels above the leaves)
+        
+        size_t capacity() const {
+            return root_ ? kWidth << shift_ : 0;
+        }
+        
+        // Walks to the leaf holding `index`, making every node on the way
+        // unique and creating missing ones when appending
+        Node* editableLeaf(size_t index) {
+            NodePtr<Node>* slot = &root_;
+            for (unsigned level = shift_; ; level -= kBits) {
+                if (*slot) {
+                    ensureUnique(*slot);
+                } else {
+                    *slot = NodePtr<Node>(new Node());
+                }
+                if (level == 0) return slot->get();
+                
+                auto& children = (*slot)->children;
+                size_t child = (index >> level) & kMask;
+                if (child == children.size()) children.emplace_back();
+                slot = &children[child];
+            }
+        }
+        
+        static size_t footprint(const Node* node, std::unordered_set<const void*>& seen) {
+            if (!seen.insert(node).second) return 0;
+            size_t bytes = sizeof(Node) + node->children.capacity() * sizeof(NodePtr<Node>)
+                         + node->values.capacity() * sizeof(T);
+            for (const auto& child : node->children) {
+                bytes += footprint(child.get(), seen);
+            }
+            return bytes;
+        }
+        
+    public:
+        PersistentVector() = default;
+        
+        PersistentVector(std::initializer_list<T> init) {
+            for (const auto& value : init) push_back(value);
+        }
+        
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        
+        const T& operator[](size_t index) const {
+            const Node* node = root_.get();
+            for (unsigned level = shift_; level > 0; level -= kBits) {
+                node = node->children[(index >> level) & kMask].get();
+            }
+            return node->values[index & kMask];
+        }
+        
+        const T& at(size_t index) const {
+            if (index >= size_) throw std::out_of_range("PersistentVector: index out of range");
+            return (*this)[index];
+        }
+        
+        const T& back() const { return (*this)[size_ - 1]; }
+        
+        void set(size_t index, const T& value) {
+            if (index >= size_) throw std::out_of_range("PersistentVector: index out of range");
+            editableLeaf(index)->values[index & kMask] = value;
+        }
+        
+        void push_back(const T& value) {
+            if (size_ == capacity() && root_) {
+                // Root is full: grow the trie by one level
+                NodePtr<Node> newRoot(new Node());
+                newRoot->children.push_back(std::move(root_));
+                root_ = std::move(newRoot);
+                shift_ += kBits;
+            }
+            editableLeaf(size_)->values.push_back(value);
+            ++size_;
+        }
+        
+        void pop_back() {
+            if (size_ == 0) throw std::out_of_range("PersistentVector: pop_back on empty vector");
+            --size_;
+            
+            // Remember the path so emptied nodes can be pruned bottom-up
+            NodePtr<Node>* path[64 / kBits + 1];
+            size_t depth = 0;
+            NodePtr<Node>* slot = &root_;
+            for (unsigned level = shift_; ; level -= kBits) {
+                ensureUnique(*slot);
+                path[depth++] = slot;
+                if (level == 0) break;
+                slot = &(*slot)->children[(size_ >> level) & kMask];
+            }
+            (*slot)->values.pop_back();
+            
+            for (size_t d = depth - 1; d > 0; --d) {
+                const Node& node = **path[d];
+                if (!node.values.empty() || !node.children.empty()) break;
+                (*path[d - 1])->children.pop_back();
+            }
+            if (size_ == 0) {
+                root_ = NodePtr<Node>();
+                shift_ = 0;
+            } else if (shift_ > 0 && root_->children.size() == 1) {
+                NodePtr<Node> child = root_->children.front();
+                root_ = std::move(child);
+                shift_ -= kBits;
+            }
+        }
+        
+        // Visits the elements in order, one leaf at a time
+        template<typename Visitor>
+        void forEach(Visitor visit) const {
+            for (size_t base = 0; base < size_; base += kWidth) {
+                const Node* node = root_.get();
+                for (unsigned level = shift_; level > 0; level -= kBits) {
+                    node = node->children[(base >> level) & kMask].get();
+                }
+                for (const T& value : node->values) visit(value);
+            }
+        }
+        
+        // Bytes of nodes not already in `seen`; pass one set across several
+        // versions to measure what they occupy together
+        size_t memoryUsage(std::unordered_set<const void*>& seen) const {
+            return root_ ? footprint(root_.get(), seen) : 0;
+        }
+    };
+    
+    // Rope: an immutable AVL tree of string chunks of at most kLeafSize
+    // characters. Insert and erase split the tree at a position and join
+    // the pieces back; both create O(log n) new nodes plus at most one
+    // partial leaf, and every other chunk stays shared with older versions.
+    template<bool ThreadSafe = true>
+    class Rope {
+    private:
+        static constexpr size_t kLeafSize = 512;
+        
+        struct Node {
+            RefCount<ThreadSafe> refs;
+            size_t length = 0;
+            int height = 0;                 // 0 for leaves
+            NodePtr<Node> left, right;
+            std::string text;               // Leaves only
+            
+            Node() = default;
+            Node(const Node& other)
+                : length(other.length), height(other.height),
+                  left(other.left), right(other.right), text(other.text) {}
+        };
+        using Ptr = NodePtr<Node>;
+        
+        Ptr root_;
+        
+        static int heightOf(const Ptr& node) { return node ? node->height : -1; }
+        static size_t lengthOf(const Ptr& node) { return node ? node->length : 0; }
+        
+        static Ptr makeLeaf(std::string_view text) {
+            Ptr leaf(new Node());
+            leaf->length = text.size();
+            leaf->text.assign(text);
+            return leaf;
+        }
+        
+        static Ptr makeBranch(Ptr left, Ptr right) {
+            Ptr branch(new Node());
+            branch->length = left->length + right->length;
+            branch->height = std::max(left->height, right->height) + 1;
+            branch->left = std::move(left);
+            branch->right = std::move(right);
+            return branch;
+        }
+        
+        // Restores the AVL invariant when the children differ in height by two
+        static Ptr balance(Ptr left, Ptr right) {
+            if (heightOf(left) > heightOf(right) + 1) {
+                if (heightOf(left->left) >= heightOf(left->right)) {
+                    return makeBranch(left->left, makeBranch(left->right, std::move(right)));
+                }
+                return makeBranch(makeBranch(left->left, left->right->left),
+                                  makeBranch(left->right->right, std::move(right)));
+            }
+            if (heightOf(right) > heightOf(left) + 1) {
+                if (heightOf(right->right) >= heightOf(right->left)) {
+                    return makeBranch(makeBranch(std::move(left), right->left), right->right);
+                }
+                return makeBranch(makeBranch(std::move(left), right->left->left),
+                                  makeBranch(right->left->right, right->right));
+            }
+            return makeBranch(std::move(left), std::move(right));
+        }
+        
+        // Joins two ropes, descending the taller one's spine until the
+        // heights meet. Small adjacent leaves are merged.
+        static Ptr concat(const Ptr& left, const Ptr& right) {
+            if (!left) return right;
+            if (!right) return left;
+            if (left->height == 0 && right->height == 0 && left->length + right->length <= kLeafSize) {
+                std::string text;
+                text.reserve(left->length + right->length);
+                text.append(left->text).append(right->text);
+                return makeLeaf(text);
+            }
+            if (left->height > right->height + 1) {
+                return balance(left->left, concat(left->right, right));
+            }
+            if (right->height > left->height + 1) {
+                return balance(concat(left, right->left), right->right);
+            }
+            return makeBranch(left, right);
+        }
+        
+        // Splits into [0, position) and [position, length)
+        static std::pair<Ptr, Ptr> split(const Ptr& node, size_t position) {
+            if (!node || position == 0) return {Ptr(), node};
+            if (position >= node->length) return {node, Ptr()};
+            if (node->height == 0) {
+                std::string_view text(node->text);
+                return {makeLeaf(text.substr(0, position)), makeLeaf(text.substr(position))};
+            }
+            if (position < node->left->length) {
+                auto [a, b] = split(node->left, position);
+                return {std::move(a), concat(b, node->right)};
+            }
+            auto [a, b] = split(node->right, position - node->left->length);
+            return {concat(node->left, a), std::move(b)};
+        }
+        
+        // Balanced tree over full-size chunks of text
+        static Ptr build(std::string_view text) {
+            if (text.empty()) return Ptr();
+            if (text.size() <= kLeafSize) return makeLeaf(text);
+            size_t chunks = (text.size() + kLeafSize - 1) / kLeafSize;
+            size_t middle = chunks / 2 * kLeafSize;
+            return makeBranch(build(text.substr(0, middle)), build(text.substr(middle)));
+        }
+        
+        template<typename Visitor>
+        static void visitChunks(const Node* node, Visitor& visit) {
+            if (!node) return;
+            if (node->height == 0) {
+                visit(std::string_view(node->text));
+                return;
+            }
+            visitChunks(node->left.get(), visit);
+            visitChunks(node->right.get(), visit);
+        }
+        
+        static size_t footprint(const Node* node, std::unordered_set<const void*>& seen) {
+            if (!node || !seen.insert(node).second) return 0;
+            size_t heap = node->text.capacity() > 15 ? node->text.capacity() : 0;
+            return sizeof(Node) + heap + footprint(node->left.get(), seen) 
+                 + footprint(node->right.get(), seen);
+        }
+        
+        explicit Rope(Ptr root) : root_(std::move(root)) {}
+        
+    public:
+        Rope() = default;
+        explicit Rope(std::string_view text) : root_(build(text)) {}
+        
+        size_t length() const { return lengthOf(root_); }
+        int height() const { return heightOf(root_); }
+        
+        char operator[](size_t index) const {
+            const Node* node = root_.get();
+            while (node->height > 0) {
+                if (index < node->left->length) {
+                    node = node->left.get();
+                } else {
+                    index -= node->left->length;
+                    node = node->right.get();
+                }
+            }
+            return node->text[index];
+        }
+        
+        void insert(size_t position, std::string_view text) {
+            if (position > length()) throw std::out_of_range("Rope: insert position out of range");
+            if (text.empty()) return;
+            auto [left, right] = split(root_, position);
+            root_ = concat(concat(left, build(text)), right);
+        }
+        
+        void append(std::string_view text) {
+            insert(length(), text);
+        }
+        
+        void erase(size_t position, size_t count) {
+            if (position > length()) throw std::out_of_range("Rope: erase position out of range");
+            auto [left, rest] = split(root_, position);
+            root_ = concat(left, split(rest, count).second);
+        }
+        
+        Rope substr(size_t position, size_t count) const {
+            return Rope(split(split(root_, position).second, count).first);
+        }
+        
+        // Visits the text chunk by chunk, without flattening it
+        template<typename Visitor>
+        void forEachChunk(Visitor visit) const {
+            visitChunks(root_.get(), visit);
+        }
+        
+        std::string str() const {
+            std::string result;
+            result.reserve(length());
+            forEachChunk([&result](std::string_view chunk) { result.append(chunk); });
+            return result;
+        }
+        
+        size_t memoryUsage(std::unordered_set<const void*>& seen) const {
+            return footprint(root_.get(), seen);
+        }
+    };
+    
+    // COWDocument::Document rebuilt on the structures above. Each revision
+    // is a Rope sharing all untouched chunks with the previous one, and the
+    // history is a PersistentVector, so copying a document is O(1) and an
+    // edit costs O(log n) however long the text or history grows.
+    template<bool ThreadSafe = true>
+    class VersionedDocument {
+    private:
+        PersistentVector<Rope<ThreadSafe>, ThreadSafe> history_;
+        
+        void commit(Rope<ThreadSafe> revision) {
+            history_.push_back(std::move(revision));
+        }
+        
+    public:
+        explicit VersionedDocument(std::string_view initialContent = "") {
+            history_.push_back(Rope<ThreadSafe>(initialContent));
+        }
+        
+        const Rope<ThreadSafe>& getContent() const { return history_.back(); }
+        size_t getLength() const { return getContent().length(); }
+        size_t getHistorySize() const { return history_.size(); }
+        const Rope<ThreadSafe>& getRevision(size_t index) const { return history_.at(index); }
+        
+        void setText(std::string_view newContent) {
+            commit(Rope<ThreadSafe>(newContent));
+        }
+        
+        void append(std::string_view text) {
+            Rope<ThreadSafe> revision = getContent();
+            revision.append(text);
+            commit(std::move(revision));
+        }
+        
+        void insert(size_t pos, std::string_view text) {
+            Rope<ThreadSafe> revision = getContent();
+            revision.insert(pos, text);
+            commit(std::move(revision));
+        }
+        
+        void erase(size_t pos, size_t count) {
+            Rope<ThreadSafe> revision = getContent();
+            revision.erase(pos, count);
+            commit(std::move(revision));
+        }
+        
+        bool undo() {
+            if (history_.size() <= 1) {
+                return false;
+            }
+            history_.pop_back();
+            return true;
+        }
+        
+        // Bytes of all revisions, counting shared chunks once
+        size_t memoryUsage() const {
+            std::unordered_set<const void*> seen;
+            size_t bytes = history_.memoryUsage(seen);
+            history_.forEach([&](const Rope<ThreadSafe>& revision) {
+                bytes += revision.memoryUsage(seen);
+            });
+            return bytes;
+        }
+    };
+}
+
 // Demo functions
 void demonstrateBasicCOW() {
     using namespace BasicCopyOnWrite;
@@ -660,6 +1190,139 @@ void demonstrateSmartCOW() {
     cowPtr3->print();
 }
 
+void demonstrateStructuralSharing() {
+    using namespace StructuralSharing;
+    using Clock = std::chrono::steady_clock;
+    auto usSince = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    };
+    auto printVector = [](const char* name, const PersistentVector<int>& vec) {
+        std::cout << name << ": Vector[" << vec.size() << "]: ";
+        vec.forEach([](int value) { std::cout << value << " "; });
+        std::cout << "\n";
+    };
+    
+    std::cout << "\n=== Structural Sharing ===\n";
+    
+    PersistentVector<int> vec1{1, 2, 3, 4, 5};
+    PersistentVector<int> vec2 = vec1;
+    vec2.set(0, 99);
+    vec2.push_back(6);
+    printVector("vec1", vec1);
+    printVector("vec2", vec2);
+    
+    Rope<> rope1("Hello World");
+    Rope<> rope2 = rope1;
+    rope2.insert(5, " Beautiful");
+    rope2.erase(0, 6);
+    std::cout << "rope1: \"" << rope1.str() << "\"\n";
+    std::cout << "rope2: \"" << rope2.str() << "\"\n";
+    
+    std::cout << std::fixed << std::setprecision(2);
+    
+    // Take a snapshot, then write one element, many times over
+    const size_t elements = 100000;
+    const size_t versions = 1000;
+    std::mt19937 rng(42);
+    std::vector<size_t> positions(versions);
+    for (auto& position : positions) position = rng() % elements;
+    
+    std::cout << "\n" << versions << " snapshots of a " << elements 
+              << "-element vector, one write after each:\n";
+    
+    COWVector::COWVector<int>::setVerbose(false);
+    {
+        std::vector<int> initial(elements);
+        for (size_t i = 0; i < elements; ++i) initial[i] = static_cast<int>(i);
+        COWVector::COWVector<int> vec(initial);
+        std::vector<COWVector::COWVector<int>> snapshots;
+        snapshots.reserve(versions);
+        
+        auto start = Clock::now();
+        for (size_t v = 0; v < versions; ++v) {
+            snapshots.push_back(vec);
+            vec[positions[v]] = -1;
+        }
+        double us = usSince(start) / versions;
+        
+        std::unordered_set<const void*> buffers{vec.getDataPtr()};
+        for (const auto& snapshot : snapshots) buffers.insert(snapshot.getDataPtr());
+        double mib = buffers.size() * elements * sizeof(int) / (1024.0 * 1024.0);
+        std::cout << "  COWVector (whole copy):         " << std::setw(8) << us << " us/write, " 
+                  << std::setw(7) << mib << " MiB\n";
+    }
+    COWVector::COWVector<int>::setVerbose(true);
+    
+    auto runPersistent = [&](auto vec, const char* label) {
+        for (size_t i = 0; i < elements; ++i) vec.push_back(static_cast<int>(i));
+        std::vector<decltype(vec)> snapshots;
+        snapshots.reserve(versions);
+        
+        auto start = Clock::now();
+        for (size_t v = 0; v < versions; ++v) {
+            snapshots.push_back(vec);
+            vec.set(positions[v], -1);
+        }
+        double us = usSince(start) / versions;
+        
+        std::unordered_set<const void*> seen;
+        size_t bytes = vec.memoryUsage(seen);
+        for (const auto& snapshot : snapshots) bytes += snapshot.memoryUsage(seen);
+        std::cout << "  " << label << std::setw(8) << us << " us/write, " 
+                  << std::setw(7) << bytes / (1024.0 * 1024.0) << " MiB\n";
+        return vec[positions.back()] == -1 && snapshots.front()[positions.front()] == static_cast<int>(positions.front());
+    };
+    bool atomicOk = runPersistent(PersistentVector<int, true>(), "PersistentVector (atomic refs): ");
+    bool plainOk = runPersistent(PersistentVector<int, false>(), "PersistentVector (plain refs):  ");
+    std::cout << "  Snapshots unchanged: " << (atomicOk && plainOk ? "yes" : "no") << "\n";
+    
+    // Small edits at random positions of a large document, keeping every revision
+    const size_t textSize = 256 * 1024;
+    const size_t edits = 1000;
+    std::string text(textSize, ' ');
+    for (size_t i = 0; i < textSize; ++i) text[i] = static_cast<char>('a' + i % 26);
+    std::vector<size_t> editPositions(edits);
+    for (size_t i = 0; i < edits; ++i) editPositions[i] = rng() % (textSize + i * 5);
+    
+    std::cout << "\n" << edits << " inserts into a " << textSize / 1024 
+              << " KiB document, keeping every revision:\n";
+    
+    COWDocument::Document::setVerbose(false);
+    std::string cowContent;
+    {
+        COWDocument::Document doc(text);
+        auto start = Clock::now();
+        for (size_t pos : editPositions) {
+            doc.insert(pos, "edit ");
+        }
+        double us = usSince(start) / edits;
+        
+        size_t bytes = 0;
+        for (const auto& revision : doc.getHistory()) bytes += revision.capacity();
+        std::cout << "  Document (whole copy):          " << std::setw(8) << us << " us/edit, " 
+                  << std::setw(7) << bytes / (1024.0 * 1024.0) << " MiB\n";
+        cowContent = doc.getContent();
+    }
+    COWDocument::Document::setVerbose(true);
+    
+    auto runVersioned = [&](auto doc, const char* label) {
+        auto start = Clock::now();
+        for (size_t pos : editPositions) {
+            doc.insert(pos, "edit ");
+        }
+        double us = usSince(start) / edits;
+        std::cout << "  " << label << std::setw(8) << us << " us/edit, " 
+                  << std::setw(7) << doc.memoryUsage() / (1024.0 * 1024.0) << " MiB (height " 
+                  << doc.getContent().height() << ")\n";
+        return doc.getContent().str() == cowContent && doc.getRevision(0).str() == text;
+    };
+    bool ropeOk = runVersioned(VersionedDocument<true>(text), "VersionedDocument (atomic):     ");
+    ropeOk = runVersioned(VersionedDocument<false>(text), "VersionedDocument (plain):      ") && ropeOk;
+    std::cout << "  Same final text and first revision: " << (ropeOk ? "yes" : "no") << "\n";
+    
+    std::cout << std::defaultfloat;
+}
+
 int main() {
     std::cout << "=== Copy-on-Write Pattern Demo ===\n\n";
     
@@ -667,6 +1330,7 @@ int main() {
     demonstrateCOWVector();
     demonstrateCOWDocument();
     demonstrateSmartCOW();
+    demonstrateStructuralSharing();
     
     std::cout << "\n=== Copy-on-Write Benefits ===\n";
     std::cout << "1. Memory efficiency through sharing\n";
@@ -9,6 +9,30 @@
 #include <chrono>
 #include <string>
 #include <random>
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <cmath>
+#include <iomanip>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#define DCL_HAVE_SOCKETS 1
+// macOS has no MSG_NOSIGNAL; sockets there get SO_NOSIGPIPE instead
+#ifdef MSG_NOSIGNAL
+#define DCL_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define DCL_SEND_FLAGS 0
+#endif
+#endif
 
 // Example 1: Classic Double-Checked Locking Singleton
 namespace ClassicDCL {
@@ -141,6 +165,427 @@ namespace ModernDCL {
     std::mutex ConfigurationManager::mutex_;
 }
 
+// Metrics subsystem behind Example 3's MetricsCollector. Metrics are
+// registered once by name and used through the returned handle, so the hot
+// path does no string lookup, no allocation and takes no lock. Counters and
+// histograms are split into per-thread shards (the scheme of pattern 01's
+// ShardedCounter) and summed when scraped.
+namespace ShardedMetrics {
+    // Per-thread shard slot, assigned round-robin on a thread's first use
+    inline size_t shardIndex() {
+        static std::atomic<size_t> nextThread{0};
+        thread_local size_t index = nextThread.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+    
+    class Metric {
+    private:
+        std::string name_;
+        std::string help_;
+        
+    public:
+        Metric(std::string name, std::string help) 
+            : name_(std::move(name)), help_(std::move(help)) {}
+        virtual ~Metric() = default;
+        
+        const std::string& getName() const { return name_; }
+        
+        // Writes the metric in the Prometheus text exposition format
+        void expose(std::ostream& out) const {
+            out << "# HELP " << name_ << " " << help_ << "\n";
+            out << "# TYPE " << name_ << " " << type() << "\n";
+            exposeSamples(out);
+        }
+        
+    protected:
+        virtual const char* type() const = 0;
+        virtual void exposeSamples(std::ostream& out) const = 0;
+    };
+    
+    // Monotonic counter. Each thread adds to its own cache line.
+    class Counter : public Metric {
+    private:
+        static constexpr size_t kShards = 64;
+        
+        struct alignas(64) Shard {
+            std::atomic<uint64_t> value{0};
+        };
+        Shard shards_[kShards];
+        
+    protected:
+        const char* type() const override { return "counter"; }
+        
+        void exposeSamples(std::ostream& out) const override {
+            out << getName() << " " << value() << "\n";
+        }
+        
+    public:
+        using Metric::Metric;
+        
+        void increment(uint64_t delta = 1) {
+            shards_[shardIndex() % kShards].value.fetch_add(delta, std::memory_order_relaxed);
+        }
+        
+        uint64_t value() const {
+            uint64_t sum = 0;
+            for (const Shard& shard : shards_) sum += shard.value.load(std::memory_order_relaxed);
+            return sum;
+        }
+    };
+    
+    // Value that goes up and down, such as a queue depth. Writers replace
+    // or adjust one atomic; a gauge has no meaningful per-thread sum.
+    class Gauge : public Metric {
+    private:
+        std::atomic<double> value_{0.0};
+        
+    protected:
+        const char* type() const override { return "gauge"; }
+        
+        void exposeSamples(std::ostream& out) const override {
+            out << getName() << " " << value() << "\n";
+        }
+        
+    public:
+        using Metric::Metric;
+        
+        void set(double value) { value_.store(value, std::memory_order_relaxed); }
+        void add(double delta) { value_.fetch_add(delta, std::memory_order_relaxed); }
+        double value() const { return value_.load(std::memory_order_relaxed); }
+    };
+    
+    // Latency histogram in nanoseconds with HDR-style log-linear buckets:
+    // each power of two is split into 16 sub-buckets, so a recorded value
+    // is known to within 1/16 (6.25%) at any magnitude. Recording is one
+    // bit scan and two relaxed fetch_adds on the thread's shard.
+    class Histogram : public Metric {
+    private:
+        static constexpr unsigned kSubBucketBits = 4;
+        static constexpr size_t kSubBuckets = size_t(1) << kSubBucketBits;
+        static constexpr size_t kBuckets = (64 - kSubBucketBits + 1) * kSubBuckets;
+        static constexpr size_t kShards = 8;
+        
+        struct alignas(64) Shard {
+            std::atomic<uint64_t> sum{0};
+            std::atomic<uint64_t> buckets[kBuckets] = {};
+        };
+        std::unique_ptr<Shard[]> shards_{new Shard[kShards]};
+        
+    public:
+        static size_t bucketOf(uint64_t value) {
+            if (value < kSubBuckets) return static_cast<size_t>(value);
+            unsigned shift = static_cast<unsigned>(63 - __builtin_clzll(value)) - kSubBucketBits;
+            return (shift + 1) * kSubBuckets + ((value >> shift) & (kSubBuckets - 1));
+        }
+        
+        // Smallest value that lands in bucket
+        static uint64_t lowerBound(size_t bucket) {
+            if (bucket < 2 * kSubBuckets) return bucket;
+            size_t shift = bucket / kSubBuckets - 1;
+            return static_cast<uint64_t>(kSubBuckets + bucket % kSubBuckets) << shift;
+        }
+        
+        // Merged view of all shards
+        struct Snapshot {
+            std::vector<uint64_t> buckets = std::vector<uint64_t>(kBuckets);
+            uint64_t count = 0;
+            uint64_t sum = 0;
+            
+            // Upper bound of the bucket holding the q-th quantile, in ns
+            uint64_t percentile(double q) const {
+                if (count == 0) return 0;
+                uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(q * count + 0.5));
+                uint64_t seen = 0;
+                for (size_t b = 0; b < kBuckets; ++b) {
+                    seen += buckets[b];
+                    if (seen >= rank) return b + 1 < kBuckets ? lowerBound(b + 1) - 1 : UINT64_MAX;
+                }
+                return UINT64_MAX;
+            }
+            
+            // Values recorded below limit; exact when limit is a bucket boundary
+            uint64_t countBelow(uint64_t limit) const {
+                uint64_t total = 0;
+                for (size_t b = 0; b < kBuckets && lowerBound(b) < limit; ++b) total += buckets[b];
+                return total;
+            }
+            
+            // Values recorded at or below limit; exact when limit + 1 is a
+            // bucket boundary
+            uint64_t countAtMost(uint64_t limit) const {
+                return limit == UINT64_MAX ? count : countBelow(limit + 1);
+            }
+        };
+        
+    protected:
+        const char* type() const override { return "histogram"; }
+        
+        // Prometheus buckets at every power of four from 1.024 us to 17.2 s.
+        // "le" is inclusive, so each bound is 1 ns below the power of four:
+        // samples are whole nanoseconds and the power of four is a bucket
+        // boundary, so every count is exact. Values are exported in seconds.
+        void exposeSamples(std::ostream& out) const override {
+            Snapshot snap = snapshot();
+            for (unsigned exponent = 10; exponent <= 34; exponent += 2) {
+                uint64_t limit = (uint64_t(1) << exponent) - 1;
+                out << getName() << "_bucket{le=\"" << static_cast<double>(limit) / 1e9 << "\"} " 
+                    << snap.countAtMost(limit) << "\n";
+            }
+            out << getName() << "_bucket{le=\"+Inf\"} " << snap.count << "\n";
+            out << getName() << "_sum " << static_cast<double>(snap.sum) / 1e9 << "\n";
+            out << getName() << "_count " << snap.count << "\n";
+        }
+        
+    public:
+        using Metric::Metric;
+        
+        void record(uint64_t nanos) {
+            Shard& shard = shards_[shardIndex() % kShards];
+            shard.buckets[bucketOf(nanos)].fetch_add(1, std::memory_order_relaxed);
+            shard.sum.fetch_add(nanos, std::memory_order_relaxed);
+        }
+        
+        Snapshot snapshot() const {
+            Snapshot snap;
+            for (size_t s = 0; s < kShards; ++s) {
+                snap.sum += shards_[s].sum.load(std::memory_order_relaxed);
+                for (size_t b = 0; b < kBuckets; ++b) {
+                    snap.buckets[b] += shards_[s].buckets[b].load(std::memory_order_relaxed);
+                }
+            }
+            for (uint64_t n : snap.buckets) snap.count += n;
+            return snap;
+        }
+        
+        // Records the lifetime of a scope
+        class ScopedTimer {
+        private:
+            Histogram& histogram_;
+            std::chrono::steady_clock::time_point start_;
+            
+        public:
+            explicit ScopedTimer(Histogram& histogram)
+                : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+            ~ScopedTimer() {
+                histogram_.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start_).count()));
+            }
+        };
+    };
+    
+    // Owns the metrics and hands out handles that stay valid for its
+    // lifetime. Lookups double-check an immutable name index: readers load
+    // the published index without a lock, and only a miss locks, checks
+    // again and publishes a copy with the new entry. Superseded indexes are
+    // kept until the registry dies, since readers may still hold them.
+    class MetricsRegistry {
+    private:
+        using Index = std::map<std::string, Metric*>;
+        
+        std::mutex mutex_;
+        std::vector<std::unique_ptr<Metric>> metrics_;
+        std::vector<std::unique_ptr<const Index>> indexes_;
+        std::atomic<const Index*> index_;
+        
+        template<typename M>
+        M& getOrCreate(const std::string& name, const std::string& help) {
+            // First check - no locking
+            const Index* index = index_.load(std::memory_order_acquire);
+            auto it = index->find(name);
+            if (it == index->end()) {
+                // Lock and check again
+                std::lock_guard<std::mutex> lock(mutex_);
+                index = index_.load(std::memory_order_relaxed);
+                it = index->find(name);
+                if (it == index->end()) {
+                    metrics_.push_back(std::make_unique<M>(name, help));
+                    auto next = std::make_unique<Index>(*index);
+                    it = next->emplace(name, metrics_.back().get()).first;
+                    index_.store(next.get(), std::memory_order_release);
+                    indexes_.push_back(std::move(next));
+                }
+            }
+            if (auto* metric = dynamic_cast<M*>(it->second)) {
+                return *metric;
+            }
+            throw std::logic_error("MetricsRegistry: '" + name + "' is registered with another type");
+        }
+        
+    public:
+        MetricsRegistry() {
+            indexes_.push_back(std::make_unique<Index>());
+            index_.store(indexes_.back().get());
+        }
+        
+        MetricsRegistry(const MetricsRegistry&) = delete;
+        MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+        
+        Counter& counter(const std::string& name, const std::string& help = "") {
+            return getOrCreate<Counter>(name, help);
+        }
+        
+        Gauge& gauge(const std::string& name, const std::string& help = "") {
+            return getOrCreate<Gauge>(name, help);
+        }
+        
+        Histogram& histogram(const std::string& name, const std::string& help = "") {
+            return getOrCreate<Histogram>(name, help);
+        }
+        
+        // Metric by name, or nullptr; never registers
+        const Metric* find(const std::string& name) const {
+            const Index* index = index_.load(std::memory_order_acquire);
+            auto it = index->find(name);
+            return it != index->end() ? it->second : nullptr;
+        }
+        
+        // Visits every metric in name order without locking
+        template<typename Visitor>
+        void forEach(Visitor visit) const {
+            for (const auto& [name, metric] : *index_.load(std::memory_order_acquire)) {
+                visit(*metric);
+            }
+        }
+        
+        // Prometheus text exposition of every metric
+        std::string scrape() const {
+            std::ostringstream out;
+            // Enough digits to print the bucket bounds exactly
+            out << std::setprecision(12);
+            forEach([&out](const Metric& metric) { metric.expose(out); });
+            return out.str();
+        }
+    };
+    
+#ifdef DCL_HAVE_SOCKETS
+    // Serves GET /metrics on a loopback port from a background thread, one
+    // connection at a time. A scrape reads the shards without stopping
+    // the writers. The thread waits in poll() on the listening socket and a
+    // self-pipe, so the destructor can wake it on any POSIX system (shutdown()
+    // on a listening socket does not interrupt accept() on macOS).
+    class MetricsEndpoint {
+    private:
+        const MetricsRegistry& registry_;
+        int listenFd_ = -1;
+        int wakeFds_[2] = {-1, -1};  // Self-pipe: read end, write end
+        uint16_t port_ = 0;
+        std::thread thread_;
+        
+        static constexpr int kErrorBackoffMs = 100;
+        static constexpr int kClientTimeoutSeconds = 2;
+        
+        static void writeAll(int fd, const std::string& data) {
+            size_t written = 0;
+            while (written < data.size()) {
+                ssize_t n = ::send(fd, data.data() + written, data.size() - written, DCL_SEND_FLAGS);
+                if (n <= 0) return;
+                written += static_cast<size_t>(n);
+            }
+        }
+        
+        void respond(int fd) {
+            std::string request;
+            char buffer[1024];
+            while (request.find("\r\n\r\n") == std::string::npos && request.size() < 8192) {
+                ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+                if (n <= 0) return;
+                request.append(buffer, static_cast<size_t>(n));
+            }
+            
+            const bool found = request.compare(0, 13, "GET /metrics ") == 0;
+            std::string body = found ? registry_.scrape() : "Not Found\n";
+            std::ostringstream response;
+            response << (found ? "HTTP/1.1 200 OK\r\n" : "HTTP/1.1 404 Not Found\r\n")
+                     << "Content-Type: text/plain; version=0.0.4\r\n"
+                     << "Content-Length: " << body.size() << "\r\n"
+                     << "Connection: close\r\n\r\n" << body;
+            writeAll(fd, response.str());
+        }
+        
+        // Waits up to timeoutMs (-1: forever) for a connection; false once
+        // the destructor has written to the self-pipe
+        bool waitReadable(bool includeListener, int timeoutMs) {
+            pollfd fds[2] = {{wakeFds_[0], POLLIN, 0}, {listenFd_, POLLIN, 0}};
+            while (::poll(fds, includeListener ? 2 : 1, timeoutMs) < 0 && errno == EINTR) {}
+            return !(fds[0].revents & (POLLIN | POLLHUP));
+        }
+        
+        void serve() {
+            while (waitReadable(true, -1)) {
+                int fd = ::accept(listenFd_, nullptr, nullptr);
+                if (fd < 0) {
+                    // The peer went away or a signal hit: just wait again.
+                    // Anything else (e.g. out of descriptors) persists, so
+                    // back off instead of spinning on it.
+                    if (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK
+                        || errno == ECONNABORTED) {
+                        continue;
+                    }
+                    if (!waitReadable(false, kErrorBackoffMs)) return;
+                    continue;
+                }
+                // BSDs pass the listener's O_NONBLOCK on to accepted sockets
+                ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+                // A stalled client must not hold up the destructor forever
+                timeval timeout{kClientTimeoutSeconds, 0};
+                ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+                ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+                int one = 1;
+                ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+                respond(fd);
+                ::close(fd);
+            }
+        }
+        
+    public:
+        // Port 0 picks a free port
+        explicit MetricsEndpoint(const MetricsRegistry& registry, uint16_t port = 0)
+            : registry_(registry) {
+            listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+            if (listenFd_ < 0) throw std::runtime_error("MetricsEndpoint: socket failed");
+            int reuse = 1;
+            ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+            
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = htons(port);
+            socklen_t length = sizeof(address);
+            if (::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0
+                || ::listen(listenFd_, 16) < 0
+                || ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&address), &length) < 0) {
+                ::close(listenFd_);
+                throw std::runtime_error("MetricsEndpoint: cannot listen on port " + std::to_string(port));
+            }
+            port_ = ntohs(address.sin_port);
+            // Non-blocking so a connection reset between poll() and accept()
+            // cannot block the thread
+            ::fcntl(listenFd_, F_SETFL, ::fcntl(listenFd_, F_GETFL) | O_NONBLOCK);
+            if (::pipe(wakeFds_) < 0) {
+                ::close(listenFd_);
+                throw std::runtime_error("MetricsEndpoint: pipe failed");
+            }
+            thread_ = std::thread([this] { serve(); });
+        }
+        
+        ~MetricsEndpoint() {
+            // Closing the write end makes the read end readable (EOF)
+            ::close(wakeFds_[1]);
+            thread_.join();
+            ::close(wakeFds_[0]);
+            ::close(listenFd_);
+        }
+        
+        MetricsEndpoint(const MetricsEndpoint&) = delete;
+        MetricsEndpoint& operator=(const MetricsEndpoint&) = delete;
+        
+        uint16_t getPort() const { return port_; }
+    };
+#endif
+}
+
 // Example 3: Generic Double-Checked Locking Template
 namespace GenericDCL {
     template<typename T>
@@ -217,10 +662,12 @@ namespace GenericDCL {
         }
     };
     
+    // Named-counter front end over a ShardedMetrics::MetricsRegistry. The
+    // string overloads look the name up on each call; hot paths should keep
+    // the handle from registry().counter() instead.
     class MetricsCollector : public DCLSingleton<MetricsCollector> {
     private:
-        std::map<std::string, int> metrics_;
-        std::mutex metricsMutex_;
+        ShardedMetrics::MetricsRegistry registry_;
         
         friend class DCLSingleton<MetricsCollector>;
         
@@ -230,22 +677,24 @@ namespace GenericDCL {
         }
         
     public:
+        ShardedMetrics::MetricsRegistry& registry() { return registry_; }
+        
         void increment(const std::string& metric) {
-            std::lock_guard<std::mutex> lock(metricsMutex_);
-            metrics_[metric]++;
+            registry_.counter(metric).increment();
         }
         
         int getMetric(const std::string& metric) {
-            std::lock_guard<std::mutex> lock(metricsMutex_);
-            return metrics_[metric];
+            auto* counter = dynamic_cast<const ShardedMetrics::Counter*>(registry_.find(metric));
+            return counter ? static_cast<int>(counter->value()) : 0;
         }
         
         void printMetrics() {
-            std::lock_guard<std::mutex> lock(metricsMutex_);
             std::cout << "Metrics:\n";
-            for (const auto& [name, value] : metrics_) {
-                std::cout << "  " << name << ": " << value << "\n";
-            }
+            registry_.forEach([](const ShardedMetrics::Metric& metric) {
+                if (auto* counter = dynamic_cast<const ShardedMetrics::Counter*>(&metric)) {
+                    std::cout << "  " << metric.getName() << ": " << counter->value() << "\n";
+                }
+            });
         }
     };
 }
@@ -553,6 +1002,121 @@ void demonstrateCallOnceDCL() {
     ServiceRegistry::cleanup();
 }
 
+void demonstrateShardedMetrics() {
+    using namespace ShardedMetrics;
+    using Clock = std::chrono::steady_clock;
+    
+    std::cout << "\n=== Sharded Metrics ===\n";
+    
+    const int threads = 4;
+    auto runThreads = [threads](int iterations, auto body) {
+        std::vector<std::thread> workers;
+        auto start = Clock::now();
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([=] {
+                for (int i = 0; i < iterations; ++i) body(i);
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        return ns / (static_cast<double>(iterations) * threads);
+    };
+    
+    // The old MetricsCollector: a string key and one global lock per increment
+    std::map<std::string, int> legacyMetrics;
+    std::mutex legacyMutex;
+    auto legacyIncrement = [&](const std::string& metric) {
+        std::lock_guard<std::mutex> lock(legacyMutex);
+        legacyMetrics[metric]++;
+    };
+    
+    MetricsRegistry registry;
+    Counter& tasks = registry.counter("pool_tasks_completed_total", "Tasks finished by pool workers");
+    Histogram& latency = registry.histogram("pool_task_duration_seconds", "Task run time");
+    
+    const int iterations = 500000;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << threads << " threads incrementing one counter:\n";
+    std::cout << "  mutex + std::map<std::string, int>: " 
+              << runThreads(iterations / 10, [&](int) { legacyIncrement("pool_tasks_completed_total"); }) 
+              << " ns/op\n";
+    std::cout << "  registry lookup by name:            " 
+              << runThreads(iterations / 10, [&](int) { registry.counter("pool_tasks_completed_total").increment(); }) 
+              << " ns/op\n";
+    std::cout << "  pre-registered handle:              " 
+              << runThreads(iterations, [&](int) { tasks.increment(); }) << " ns/op\n";
+    std::cout << "  histogram record:                   " 
+              << runThreads(iterations, [&](int i) { latency.record(static_cast<uint64_t>(i)); }) << " ns/op\n";
+    const uint64_t expected = static_cast<uint64_t>(threads) * (iterations + iterations / 10);
+    std::cout << "Counter total: " << tasks.value() << " (expected " << expected << ", " 
+              << (tasks.value() == expected ? "match" : "MISMATCH") << ")\n";
+    
+    // Instrumented pool-style inner loop: time each task, count it and
+    // track the queue, while the main thread scrapes concurrently
+    MetricsRegistry poolRegistry;
+    Counter& poolTasks = poolRegistry.counter("pool_tasks_completed_total", "Tasks finished by pool workers");
+    Gauge& poolQueue = poolRegistry.gauge("pool_queue_depth", "Tasks waiting in the pool queue");
+    Histogram& poolLatency = poolRegistry.histogram("pool_task_duration_seconds", "Task run time");
+    
+    const int tasksPerWorker = 20000;
+    poolQueue.set(threads * tasksPerWorker);
+    std::atomic<bool> running{true};
+    size_t scrapes = 0;
+    std::thread scraper([&] {
+        while (running.load()) {
+            scrapes += poolRegistry.scrape().empty() ? 0 : 1;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    runThreads(tasksPerWorker, [&](int i) {
+        Histogram::ScopedTimer timer(poolLatency);
+        volatile double sum = 0;
+        for (int k = 0; k < 50 + (i % 7 == 0 ? 2000 : 0); ++k) sum = sum + std::sqrt(static_cast<double>(k));
+        poolTasks.increment();
+        poolQueue.add(-1);
+    });
+    running.store(false);
+    scraper.join();
+    
+    auto snapshot = poolLatency.snapshot();
+    std::cout << "\nInstrumented pool loop: " << poolTasks.value() << " tasks, queue depth " 
+              << poolQueue.value() << ", " << (scrapes > 0 ? "scraped while running" : "no scrapes") << "\n";
+    std::cout << "Task latency p50 " << snapshot.percentile(0.50) / 1000.0 << " us, p99 " 
+              << snapshot.percentile(0.99) / 1000.0 << " us, p99.9 " 
+              << snapshot.percentile(0.999) / 1000.0 << " us\n";
+    std::cout << std::defaultfloat;
+    
+#ifdef DCL_HAVE_SOCKETS
+    MetricsEndpoint endpoint(poolRegistry);
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(endpoint.getPort());
+    std::string response;
+#ifdef SO_NOSIGPIPE
+    int one = 1;
+    if (fd >= 0) ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+    if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+        const std::string request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+        ::send(fd, request.data(), request.size(), DCL_SEND_FLAGS);
+        char buffer[4096];
+        ssize_t n;
+        while ((n = ::recv(fd, buffer, sizeof(buffer), 0)) > 0) {
+            response.append(buffer, static_cast<size_t>(n));
+        }
+    }
+    if (fd >= 0) ::close(fd);
+    
+    std::cout << "\nGET /metrics: " << response.substr(0, response.find("\r\n")) << "\n";
+    auto body = response.find("\r\n\r\n");
+    std::cout << (body == std::string::npos ? response : response.substr(body + 4));
+#else
+    std::cout << "\n" << poolRegistry.scrape();
+#endif
+}
+
 int main() {
     std::cout << "=== Double-Checked Locking Pattern Demo ===\n\n";
     
@@ -561,6 +1125,7 @@ int main() {
     demonstrateGenericDCL();
     demonstrateResourcePoolDCL();
     demonstrateCallOnceDCL();
+    demonstrateShardedMetrics();
     
     std::cout << "\n=== Double-Checked Locking Benefits ===\n";
     std::cout << "1. Reduces synchronization overhead\n";
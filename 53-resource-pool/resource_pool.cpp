@@ -10,6 +10,11 @@
 #include <chrono>
 #include <atomic>
 #include <functional>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <unordered_set>
 #include <algorithm>
 #include <random>
@@ -149,10 +154,150 @@ namespace BasicResourcePool {
 
 // Example 2: Thread Pool
 namespace ThreadPool {
+    // Trimmed copy of pattern 41's UniqueFunction. Tasks with small captures
+    // are stored inside the queue slot instead of on the heap, and move-only
+    // captures (unique_ptr, packaged_task) are accepted.
+    template<typename Signature, size_t InlineBytes = 48>
+    class UniqueFunction;
+
+    template<typename R, typename... Args, size_t InlineBytes>
+    class UniqueFunction<R(Args...), InlineBytes> {
+    private:
+        static_assert(InlineBytes >= sizeof(void*), "Buffer must hold at least a pointer");
+        
+        struct VTable {
+            R (*invoke)(void*, Args&&...);
+            // Move into dst and destroy src; null when copying the buffer bytes is enough
+            void (*relocate)(void* src, void* dst) noexcept;
+            // Null when there is nothing to destroy
+            void (*destroy)(void*) noexcept;
+        };
+        
+        template<typename F>
+        static constexpr bool fitsInline = sizeof(F) <= InlineBytes
+            && alignof(F) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<F>;
+        
+        // Trivially relocatable: moving is a byte copy and destruction a no-op
+        template<typename F>
+        static constexpr bool trivial = std::is_trivially_copyable_v<F>
+            && std::is_trivially_destructible_v<F>;
+        
+        template<typename F>
+        static R call(F& f, Args&&... args) {
+            if constexpr (std::is_void_v<R>) {
+                f(std::forward<Args>(args)...);
+            } else {
+                return f(std::forward<Args>(args)...);
+            }
+        }
+        
+        template<typename F>
+        static F& inlineObject(void* buffer) {
+            return *std::launder(static_cast<F*>(buffer));
+        }
+        
+        template<typename F>
+        static F*& heapObject(void* buffer) {
+            return *std::launder(static_cast<F**>(buffer));
+        }
+        
+        template<typename F>
+        static const VTable* vtableFor() {
+            if constexpr (fitsInline<F>) {
+                static constexpr VTable table{
+                    [](void* buffer, Args&&... args) -> R {
+                        return call(inlineObject<F>(buffer), std::forward<Args>(args)...);
+                    },
+                    trivial<F> ? nullptr : +[](void* src, void* dst) noexcept {
+                        F& from = inlineObject<F>(src);
+                        new(dst) F(std::move(from));
+                        from.~F();
+                    },
+                    trivial<F> ? nullptr : +[](void* buffer) noexcept {
+                        inlineObject<F>(buffer).~F();
+                    }
+                };
+                return &table;
+            } else {
+                // The buffer holds a pointer, which is trivially relocatable
+                static constexpr VTable table{
+                    [](void* buffer, Args&&... args) -> R {
+                        return call(*heapObject<F>(buffer), std::forward<Args>(args)...);
+                    },
+                    nullptr,
+                    [](void* buffer) noexcept { delete heapObject<F>(buffer); }
+                };
+                return &table;
+            }
+        }
+        
+        alignas(std::max_align_t) unsigned char buffer_[InlineBytes];
+        const VTable* vtable_ = nullptr;
+        
+        void moveFrom(UniqueFunction& other) noexcept {
+            vtable_ = other.vtable_;
+            if (vtable_) {
+                if (vtable_->relocate) {
+                    vtable_->relocate(other.buffer_, buffer_);
+                } else {
+                    std::memcpy(buffer_, other.buffer_, InlineBytes);
+                }
+                other.vtable_ = nullptr;
+            }
+        }
+        
+    public:
+        UniqueFunction() noexcept = default;
+        UniqueFunction(std::nullptr_t) noexcept {}
+        
+        template<typename F, typename D = std::decay_t<F>,
+                 typename = std::enable_if_t<!std::is_same_v<D, UniqueFunction> &&
+                                             std::is_invocable_r_v<R, D&, Args...>>>
+        UniqueFunction(F&& f) {
+            if constexpr (fitsInline<D>) {
+                new(buffer_) D(std::forward<F>(f));
+            } else {
+                new(buffer_) D*(new D(std::forward<F>(f)));
+            }
+            vtable_ = vtableFor<D>();
+        }
+        
+        UniqueFunction(UniqueFunction&& other) noexcept { moveFrom(other); }
+        
+        UniqueFunction& operator=(UniqueFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+        
+        UniqueFunction(const UniqueFunction&) = delete;
+        UniqueFunction& operator=(const UniqueFunction&) = delete;
+        
+        ~UniqueFunction() { reset(); }
+        
+        void reset() noexcept {
+            if (vtable_ && vtable_->destroy) {
+                vtable_->destroy(buffer_);
+            }
+            vtable_ = nullptr;
+        }
+        
+        R operator()(Args... args) {
+            return vtable_->invoke(buffer_, std::forward<Args>(args)...);
+        }
+        
+        explicit operator bool() const noexcept { return vtable_ != nullptr; }
+    };
+    
+    using Task = UniqueFunction<void(), 64>;
+    
     class ThreadPool {
     private:
         std::vector<std::thread> workers_;
-        std::queue<std::function<void()>> tasks_;
+        std::queue<Task> tasks_;
         mutable std::mutex queueMutex_;
         std::condition_variable cv_;
         std::atomic<bool> stop_{false};
@@ -166,7 +311,7 @@ namespace ThreadPool {
                     std::cout << "Worker thread " << i << " started\n";
                     
                     while (true) {
-                        std::function<void()> task;
+                        Task task;
                         
                         {
                             std::unique_lock<std::mutex> lock(queueMutex_);
@@ -235,55 +380,75 @@ namespace ThreadPool {
 
 // Example 3: Memory Pool
 namespace MemoryPool {
+    // Fixed-size block pool. Blocks are carved on demand from one
+    // reservation of maxBlocks * blockSize bytes. Free blocks form an
+    // intrusive list threaded through their own first bytes, so allocate and
+    // deallocate are O(1) pointer pops and pushes. A freed pointer is
+    // validated by range and stride instead of a search.
     class MemoryPool {
     private:
-        struct Block {
-            char* data;
-            size_t size;
-            bool inUse;
-            
-            Block(size_t s) : size(s), inUse(false) {
-                data = new char[size];
-                std::cout << "MemoryPool: Allocated block of " << size << " bytes\n";
-            }
-            
-            ~Block() {
-                delete[] data;
-                std::cout << "MemoryPool: Deallocated block of " << size << " bytes\n";
-            }
+        struct FreeBlock {
+            FreeBlock* next;
         };
         
-        std::vector<std::unique_ptr<Block>> blocks_;
+        std::unique_ptr<char[]> storage_;
+        std::vector<bool> inUse_;
+        FreeBlock* freeList_ = nullptr;
+        size_t carved_ = 0;
+        size_t used_ = 0;
         mutable std::mutex mutex_;
         size_t blockSize_;
         size_t maxBlocks_;
         
+        // Every block can hold a FreeBlock and starts suitably aligned
+        static size_t blockBytes(size_t requested) {
+            const size_t align = alignof(std::max_align_t);
+            return (std::max(requested, sizeof(FreeBlock)) + align - 1) / align * align;
+        }
+        
+        // Block index of ptr, or maxBlocks_ when ptr is not a block start
+        size_t indexOf(void* ptr) const {
+            auto* p = static_cast<char*>(ptr);
+            if (p < storage_.get() || p >= storage_.get() + carved_ * blockSize_) return maxBlocks_;
+            size_t offset = static_cast<size_t>(p - storage_.get());
+            return offset % blockSize_ == 0 ? offset / blockSize_ : maxBlocks_;
+        }
+        
     public:
         MemoryPool(size_t blockSize, size_t maxBlocks)
-            : blockSize_(blockSize), maxBlocks_(maxBlocks) {
+            : storage_(new char[maxBlocks * blockBytes(blockSize)]),
+              inUse_(maxBlocks, false),
+              blockSize_(blockBytes(blockSize)), maxBlocks_(maxBlocks) {
             std::cout << "MemoryPool: Created with block size " << blockSize_ 
                       << " and max " << maxBlocks_ << " blocks\n";
         }
         
+        ~MemoryPool() {
+            for (size_t i = 0; i < carved_; ++i) {
+                std::cout << "MemoryPool: Deallocated block of " << blockSize_ << " bytes\n";
+            }
+        }
+        
         void* allocate() {
             std::lock_guard<std::mutex> lock(mutex_);
             
-            // Look for available block
-            for (auto& block : blocks_) {
-                if (!block->inUse) {
-                    block->inUse = true;
-                    std::cout << "MemoryPool: Reusing existing block\n";
-                    return block->data;
-                }
+            // Pop a previously returned block
+            if (freeList_) {
+                FreeBlock* block = freeList_;
+                freeList_ = block->next;
+                inUse_[indexOf(block)] = true;
+                ++used_;
+                std::cout << "MemoryPool: Reusing existing block\n";
+                return block;
             }
             
-            // Create new block if under limit
-            if (blocks_.size() < maxBlocks_) {
-                auto block = std::make_unique<Block>(blockSize_);
-                void* ptr = block->data;
-                block->inUse = true;
-                blocks_.push_back(std::move(block));
-                std::cout << "MemoryPool: Created new block (" << blocks_.size() 
+            // Carve a new block if under limit
+            if (carved_ < maxBlocks_) {
+                void* ptr = storage_.get() + carved_ * blockSize_;
+                inUse_[carved_++] = true;
+                ++used_;
+                std::cout << "MemoryPool: Allocated block of " << blockSize_ << " bytes\n";
+                std::cout << "MemoryPool: Created new block (" << carved_ 
                           << "/" << maxBlocks_ << ")\n";
                 return ptr;
             }
@@ -297,32 +462,33 @@ namespace MemoryPool {
             
             std::lock_guard<std::mutex> lock(mutex_);
             
-            for (auto& block : blocks_) {
-                if (block->data == ptr && block->inUse) {
-                    block->inUse = false;
-                    std::cout << "MemoryPool: Block returned to pool\n";
-                    return;
-                }
+            size_t index = indexOf(ptr);
+            if (index == maxBlocks_ || !inUse_[index]) {
+                std::cout << "MemoryPool: Warning - deallocating unknown pointer\n";
+                return;
             }
             
-            std::cout << "MemoryPool: Warning - deallocating unknown pointer\n";
+            inUse_[index] = false;
+            --used_;
+            auto* block = static_cast<FreeBlock*>(ptr);
+            block->next = freeList_;
+            freeList_ = block;
+            std::cout << "MemoryPool: Block returned to pool\n";
         }
         
         size_t getAvailableBlocks() const {
             std::lock_guard<std::mutex> lock(mutex_);
-            return std::count_if(blocks_.begin(), blocks_.end(),
-                [](const auto& block) { return !block->inUse; });
+            return carved_ - used_;
         }
         
         size_t getUsedBlocks() const {
             std::lock_guard<std::mutex> lock(mutex_);
-            return std::count_if(blocks_.begin(), blocks_.end(),
-                [](const auto& block) { return block->inUse; });
+            return used_;
         }
         
         size_t getTotalBlocks() const {
             std::lock_guard<std::mutex> lock(mutex_);
-            return blocks_.size();
+            return carved_;
         }
     };
 }
@@ -12,6 +12,15 @@
 #include <type_traits>
 #include <thread>
 #include <chrono>
+#include <condition_variable>
+#include <future>
+#include <iomanip>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <queue>
+#include <tuple>
+#include <utility>
 
 // Example 1: Basic Function Composition
 namespace BasicComposition {
@@ -153,6 +162,10 @@ namespace VariadicComposition {
 
 // Example 3: Function Composition with Containers
 namespace ContainerComposition {
+    // Per-call log lines; off for benchmarks
+    inline bool verbose = true;
+    inline void setVerbose(bool enabled) { verbose = enabled; }
+    
     // Map function over container
     template<typename F>
     auto map(F&& func) {
@@ -164,7 +177,9 @@ namespace ContainerComposition {
             std::vector<ResultType> result;
             result.reserve(container.size());
             
-            std::cout << "Mapping function over container with " << container.size() << " elements\n";
+            if (verbose) {
+                std::cout << "Mapping function over container with " << container.size() << " elements\n";
+            }
             for (const auto& item : container) {
                 result.push_back(func(item));
             }
@@ -180,11 +195,15 @@ namespace ContainerComposition {
             using ContainerType = std::decay_t<decltype(container)>;
             ContainerType result;
             
-            std::cout << "Filtering container\n";
+            if (verbose) {
+                std::cout << "Filtering container\n";
+            }
             std::copy_if(container.begin(), container.end(), 
                         std::back_inserter(result), pred);
             
-            std::cout << "Filtered from " << container.size() << " to " << result.size() << " elements\n";
+            if (verbose) {
+                std::cout << "Filtered from " << container.size() << " to " << result.size() << " elements\n";
+            }
             return result;
         };
     }
@@ -193,7 +212,9 @@ namespace ContainerComposition {
     template<typename T, typename BinaryOp>
     auto reduce(T init, BinaryOp&& op) {
         return [init, op = std::forward<BinaryOp>(op)](const auto& container) {
-            std::cout << "Reducing container to single value\n";
+            if (verbose) {
+                std::cout << "Reducing container to single value\n";
+            }
             return std::accumulate(container.begin(), container.end(), init, op);
         };
     }
@@ -401,6 +422,303 @@ namespace AsyncComposition {
     }
 }
 
+// Example 6: Lazy Fused Pipelines
+// ContainerComposition materializes a vector per stage. Here map and filter
+// only record their function; the terminal (reduce, toVector) wraps the
+// stages around its accumulator from the inside out, so every element
+// flows through all of them in one loop with no intermediate container.
+namespace LazyComposition {
+    // Trimmed copy of pattern 30's ScientificThreadPool: the same
+    // mutex/condition-variable queue with std::function tasks and no logging
+    class ComputePool {
+    private:
+        std::vector<std::thread> workers_;
+        std::queue<std::function<void()>> tasks_;
+        std::mutex queueMutex_;
+        std::condition_variable condition_;
+        bool stop_ = false;
+        
+        void workerThread() {
+            while (true) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(queueMutex_);
+                    condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                    if (stop_ && tasks_.empty()) return;
+                    task = std::move(tasks_.front());
+                    tasks_.pop();
+                }
+                task();
+            }
+        }
+        
+    public:
+        explicit ComputePool(size_t threads = std::thread::hardware_concurrency()) {
+            for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) {
+                workers_.emplace_back(&ComputePool::workerThread, this);
+            }
+        }
+        
+        ~ComputePool() {
+            {
+                std::lock_guard<std::mutex> lock(queueMutex_);
+                stop_ = true;
+            }
+            condition_.notify_all();
+            for (auto& worker : workers_) worker.join();
+        }
+        
+        template<typename F>
+        auto enqueue(F&& f) -> std::future<std::invoke_result_t<F>> {
+            auto task = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(f));
+            auto result = task->get_future();
+            {
+                std::lock_guard<std::mutex> lock(queueMutex_);
+                tasks_.emplace([task] { (*task)(); });
+            }
+            condition_.notify_one();
+            return result;
+        }
+        
+        size_t size() const { return workers_.size(); }
+    };
+    
+    // Stages turn a downstream sink into a sink for their input
+    template<typename F>
+    struct MapStage {
+        F func;
+        
+        template<typename In>
+        using Output = std::decay_t<std::invoke_result_t<const F&, In>>;
+        
+        template<typename Sink>
+        auto wrap(Sink sink) const {
+            return [func = func, sink](const auto& x) mutable { sink(func(x)); };
+        }
+    };
+    
+    template<typename Predicate>
+    struct FilterStage {
+        Predicate pred;
+        
+        template<typename In>
+        using Output = In;
+        
+        template<typename Sink>
+        auto wrap(Sink sink) const {
+            return [pred = pred, sink](const auto& x) mutable { if (pred(x)) sink(x); };
+        }
+    };
+    
+    // Element type after stages I.. of the tuple
+    template<typename In, typename Stages, size_t I = 0>
+    struct OutputOf {
+        using type = In;
+    };
+    
+    template<typename In, typename... Ss, size_t I>
+    struct OutputOf<In, std::tuple<Ss...>, I> {
+        using Stage = std::tuple_element_t<I, std::tuple<Ss...>>;
+        using Next = typename Stage::template Output<In>;
+        using type = typename std::conditional_t<I + 1 == sizeof...(Ss),
+            std::common_type<Next>, OutputOf<Next, std::tuple<Ss...>, I + 1>>::type;
+    };
+    
+    template<typename In>
+    struct OutputOf<In, std::tuple<>, 0> {
+        using type = In;
+    };
+    
+    // Containers whose data() is a raw pointer (vector, array, string)
+    template<typename C, typename = void>
+    struct IsContiguous : std::false_type {};
+    
+    template<typename C>
+    struct IsContiguous<C, std::void_t<decltype(std::data(std::declval<const C&>()))>>
+        : std::is_pointer<decltype(std::data(std::declval<const C&>()))> {};
+    
+    // Non-owning view of a container plus the stages applied so far. The
+    // container must outlive the pipeline. Containers with data() are read
+    // through a raw pointer (the contiguous fast path); others through
+    // their iterators.
+    template<typename Container, typename Stages = std::tuple<>>
+    class Pipeline {
+    private:
+        const Container* source_;
+        Stages stages_;
+        
+        template<size_t I = 0, typename Sink>
+        auto chain(Sink sink) const {
+            if constexpr (I == std::tuple_size_v<Stages>) {
+                return sink;
+            } else {
+                return std::get<I>(stages_).wrap(chain<I + 1>(sink));
+            }
+        }
+        
+        // Runs [begin, end) of a contiguous source split over Lanes sinks,
+        // each feeding its own accumulator. Independent lanes let the
+        // compiler keep several sums in flight and vectorize the stages.
+        template<size_t Lanes, typename T, typename Op, size_t... L>
+        T reduceLanes(size_t begin, size_t end, const T& identity, const Op& op,
+                      std::index_sequence<L...>) const {
+            const auto* data = std::data(*source_);
+            T accumulators[Lanes] = {((void)L, identity)...};
+            auto sinks = std::make_tuple(chain([&acc = accumulators[L], &op](const auto& x) { acc = op(acc, x); })...);
+            
+            size_t i = begin;
+            for (; i + Lanes <= end; i += Lanes) {
+                (std::get<L>(sinks)(data[i + L]), ...);
+            }
+            for (; i < end; ++i) {
+                std::get<0>(sinks)(data[i]);
+            }
+            T result = identity;
+            for (const T& acc : accumulators) result = op(result, acc);
+            return result;
+        }
+        
+    public:
+        static constexpr bool kContiguous = IsContiguous<Container>::value;
+        using InputType = typename Container::value_type;
+        using value_type = typename OutputOf<InputType, Stages>::type;
+        
+        Pipeline(const Container& source, Stages stages) 
+            : source_(&source), stages_(std::move(stages)) {}
+        
+        template<typename Stage>
+        auto then(Stage stage) const {
+            auto stages = std::tuple_cat(stages_, std::make_tuple(std::move(stage)));
+            return Pipeline<Container, decltype(stages)>(*source_, std::move(stages));
+        }
+        
+        size_t sourceSize() const { return std::size(*source_); }
+        
+        // Pushes every element through the stages into sink, in order
+        template<typename Sink>
+        void run(Sink sink) const {
+            auto fused = chain(sink);
+            if constexpr (kContiguous) {
+                const auto* data = std::data(*source_);
+                const size_t size = std::size(*source_);
+                for (size_t i = 0; i < size; ++i) fused(data[i]);
+            } else {
+                for (const auto& item : *source_) fused(item);
+            }
+        }
+        
+        // Contiguous range [begin, end) reduced in 8 lanes; op must be
+        // associative and identity its neutral element
+        template<typename T, typename Op>
+        T reduceRange(size_t begin, size_t end, const T& identity, const Op& op) const {
+            static_assert(kContiguous, "reduceRange needs a contiguous source");
+            return reduceLanes<8>(begin, end, identity, op, std::make_index_sequence<8>());
+        }
+    };
+    
+    template<typename Container>
+    auto from(const Container& container) {
+        return Pipeline<Container>(container, std::tuple<>());
+    }
+    
+    template<typename T>
+    struct IsPipeline : std::false_type {};
+    
+    template<typename C, typename S>
+    struct IsPipeline<Pipeline<C, S>> : std::true_type {};
+    
+    // Accepts a pipeline or a container, so adaptors work with
+    // VariadicComposition::pipe as well as with operator|
+    template<typename Source>
+    auto asPipeline(const Source& source) {
+        if constexpr (IsPipeline<Source>::value) {
+            return source;
+        } else {
+            return from(source);
+        }
+    }
+    
+    template<typename F>
+    auto map(F func) {
+        return [func](const auto& source) { return asPipeline(source).then(MapStage<F>{func}); };
+    }
+    
+    template<typename Predicate>
+    auto filter(Predicate pred) {
+        return [pred](const auto& source) { 
+            return asPipeline(source).then(FilterStage<Predicate>{pred}); 
+        };
+    }
+    
+    // Ordered fold in one fused loop; same result as the eager reduce
+    template<typename T, typename BinaryOp>
+    auto reduce(T init, BinaryOp op) {
+        return [init, op](const auto& source) {
+            T acc = init;
+            asPipeline(source).run([&acc, &op](const auto& x) { acc = op(acc, x); });
+            return acc;
+        };
+    }
+    
+    // Unordered fold: op must be associative and identity its neutral
+    // element. Contiguous sources use the multi-lane loop, so floating-point
+    // results can differ from reduce() in the last bits.
+    template<typename T, typename BinaryOp>
+    auto reduceAssociative(T identity, BinaryOp op) {
+        return [identity, op](const auto& source) {
+            auto pipeline = asPipeline(source);
+            if constexpr (decltype(pipeline)::kContiguous) {
+                return pipeline.reduceRange(0, pipeline.sourceSize(), identity, op);
+            } else {
+                T acc = identity;
+                pipeline.run([&acc, &op](const auto& x) { acc = op(acc, x); });
+                return acc;
+            }
+        };
+    }
+    
+    // Splits a contiguous source into chunks, reduces each chunk on the
+    // pool with the multi-lane loop and folds the partial results in chunk
+    // order, so the result does not depend on scheduling
+    template<typename Pool, typename T, typename BinaryOp>
+    auto parallelReduce(Pool& pool, T identity, BinaryOp op, size_t chunkSize = 1 << 18) {
+        return [&pool, identity, op, chunkSize](const auto& source) {
+            auto pipeline = asPipeline(source);
+            static_assert(decltype(pipeline)::kContiguous, "parallelReduce needs a contiguous source");
+            
+            const size_t size = pipeline.sourceSize();
+            std::vector<std::future<T>> partials;
+            partials.reserve(size / chunkSize + 1);
+            for (size_t begin = 0; begin < size; begin += chunkSize) {
+                size_t end = std::min(size, begin + chunkSize);
+                partials.push_back(pool.enqueue([pipeline, begin, end, identity, op] {
+                    return pipeline.reduceRange(begin, end, identity, op);
+                }));
+            }
+            T result = identity;
+            for (auto& partial : partials) result = op(result, partial.get());
+            return result;
+        };
+    }
+    
+    // Materializes the pipeline once, at the end
+    inline auto toVector() {
+        return [](const auto& source) {
+            auto pipeline = asPipeline(source);
+            std::vector<typename decltype(pipeline)::value_type> result;
+            pipeline.run([&result](const auto& x) { result.push_back(x); });
+            return result;
+        };
+    }
+    
+    // source | adaptor, for either a container or a pipeline on the left
+    template<typename Source, typename Adaptor,
+             typename = std::enable_if_t<std::is_invocable_v<const Adaptor&, const Source&>>>
+    auto operator|(const Source& source, const Adaptor& adaptor) {
+        return adaptor(source);
+    }
+}
+
 // Demo functions
 void demonstrateBasicComposition() {
     using namespace BasicComposition;
@@ -556,6 +874,81 @@ void demonstrateAsyncComposition() {
     std::cout << "Final result: " << finalResult << "\n";
 }
 
+void demonstrateLazyPipelines() {
+    using namespace LazyComposition;
+    using Clock = std::chrono::steady_clock;
+    auto msSince = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+    
+    std::cout << "\n=== Lazy Fused Pipelines ===\n";
+    
+    std::vector<int> numbers = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    
+    // Same stages as the eager pipeline, composed with pipe but fused
+    auto evenSquares = VariadicComposition::pipe(
+        filter([](int x) { return x % 2 == 0; }),
+        map([](int x) { return x * x; }),
+        toVector()
+    );
+    ContainerComposition::print("Even squares: ")(evenSquares(numbers));
+    
+    int sum = numbers | filter([](int x) { return x > 5; }) | reduce(0, std::plus<>());
+    std::cout << "Sum of numbers > 5: " << sum << "\n";
+    
+    std::list<int> linked(numbers.begin(), numbers.end());
+    std::cout << "Same sum over a std::list: " 
+              << (linked | filter([](int x) { return x > 5; }) | reduce(0, std::plus<>())) << "\n";
+    
+    // map -> filter -> map -> reduce over a large array
+    const size_t size = 20000000;
+    std::vector<double> samples(size);
+    for (size_t i = 0; i < size; ++i) samples[i] = static_cast<double>(i % 1000) * 0.001;
+    
+    auto scale = [](double x) { return 2.0 * x + 1.0; };
+    auto below = [](double y) { return y < 2.0; };
+    auto square = [](double y) { return y * y; };
+    
+    std::cout << "\nmap -> filter -> map -> reduce over " << size / 1000000 << "M doubles:\n";
+    std::cout << std::fixed << std::setprecision(2);
+    
+    ContainerComposition::setVerbose(false);
+    auto start = Clock::now();
+    double eager = VariadicComposition::pipe(
+        ContainerComposition::map(scale),
+        ContainerComposition::filter(below),
+        ContainerComposition::map(square),
+        ContainerComposition::reduce(0.0, std::plus<>())
+    )(samples);
+    double eagerMs = msSince(start);
+    ContainerComposition::setVerbose(true);
+    
+    start = Clock::now();
+    double fused = samples | map(scale) | filter(below) | map(square) | reduce(0.0, std::plus<>());
+    double fusedMs = msSince(start);
+    
+    start = Clock::now();
+    double lanes = samples | map(scale) | filter(below) | map(square) | reduceAssociative(0.0, std::plus<>());
+    double lanesMs = msSince(start);
+    
+    ComputePool pool(std::max(2u, std::thread::hardware_concurrency()));
+    start = Clock::now();
+    double parallel = samples | map(scale) | filter(below) | map(square) 
+                              | parallelReduce(pool, 0.0, std::plus<>());
+    double parallelMs = msSince(start);
+    
+    auto close = [eager](double value) { return std::abs(value - eager) <= 1e-9 * std::abs(eager); };
+    std::cout << "  Eager (3 temporary vectors):  " << std::setw(8) << eagerMs << " ms\n";
+    std::cout << "  Fused ordered reduce:         " << std::setw(8) << fusedMs << " ms, " 
+              << (fused == eager ? "identical" : "DIFFERENT") << "\n";
+    std::cout << "  Fused 8-lane reduce:          " << std::setw(8) << lanesMs << " ms, " 
+              << (close(lanes) ? "matches" : "MISMATCH") << "\n";
+    std::cout << "  Fused parallel reduce:        " << std::setw(8) << parallelMs << " ms, " 
+              << (close(parallel) ? "matches" : "MISMATCH") << " (" << pool.size() << " workers)\n";
+    std::cout << "  Result: " << eager << "\n";
+    std::cout << std::defaultfloat;
+}
+
 int main() {
     std::cout << "=== Function Composition Pattern Demo ===\n\n";
     
@@ -564,6 +957,7 @@ int main() {
     demonstrateContainerComposition();
     demonstrateMonadicComposition();
     demonstrateAsyncComposition();
+    demonstrateLazyPipelines();
     
     std::cout << "\n=== Function Composition Benefits ===\n";
     std::cout << "1. Modular and reusable code\n";
@@ -10,6 +10,20 @@
 #include <algorithm>
 #include <numeric>
 #include <unordered_map>
+#include <utility>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <thread>
 
 // Example 1: Basic Concepts for Type Constraints
 namespace BasicConcepts {
@@ -211,7 +225,10 @@ namespace ConceptPatterns {
     public:
         explicit Sorter(Strategy strategy) : strategy_(strategy) {}
         
-        void performSort(std::vector<int>& data) {
+        // Accepts any element type the strategy's own constraints admit
+        template<typename T>
+            requires requires(Strategy& s, std::vector<T>& data) { s.sort(data); }
+        void performSort(std::vector<T>& data) {
             std::cout << "Using strategy: " << strategy_.name() << "\n";
             strategy_.sort(data);
         }
@@ -523,6 +540,378 @@ namespace ConceptComposition {
     }
 }
 
+// Example 6: Concept-Dispatched Sorting
+namespace ConceptSorting {
+    // Keys an LSD radix sort can order by their bit pattern
+    template<typename T>
+    concept RadixKey = std::totally_ordered<T> && 
+        ((std::integral<T> && !std::same_as<T, bool>) ||
+         (std::floating_point<T> && (sizeof(T) == 4 || sizeof(T) == 8)));
+    
+    // Trimmed copy of pattern 30's ScientificThreadPool: the same
+    // mutex/condition-variable queue with std::function tasks and no logging
+    class ComputePool {
+    private:
+        std::vector<std::thread> workers_;
+        std::queue<std::function<void()>> tasks_;
+        std::mutex queueMutex_;
+        std::condition_variable condition_;
+        bool stop_ = false;
+        
+        void workerThread() {
+            while (true) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(queueMutex_);
+                    condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                    if (stop_ && tasks_.empty()) return;
+                    task = std::move(tasks_.front());
+                    tasks_.pop();
+                }
+                task();
+            }
+        }
+        
+    public:
+        explicit ComputePool(size_t threads = std::thread::hardware_concurrency()) {
+            for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) {
+                workers_.emplace_back(&ComputePool::workerThread, this);
+            }
+        }
+        
+        ~ComputePool() {
+            {
+                std::lock_guard<std::mutex> lock(queueMutex_);
+                stop_ = true;
+            }
+            condition_.notify_all();
+            for (auto& worker : workers_) worker.join();
+        }
+        
+        template<std::invocable F>
+        auto enqueue(F&& f) -> std::future<std::invoke_result_t<F>> {
+            auto task = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(f));
+            auto result = task->get_future();
+            {
+                std::lock_guard<std::mutex> lock(queueMutex_);
+                tasks_.emplace([task] { (*task)(); });
+            }
+            condition_.notify_one();
+            return result;
+        }
+        
+        size_t size() const { return workers_.size(); }
+    };
+    
+    namespace detail {
+        constexpr std::ptrdiff_t kInsertionThreshold = 16;
+        constexpr std::ptrdiff_t kNintherThreshold = 128;
+        
+        template<typename It, typename Compare>
+        It medianOf3(It a, It b, It c, Compare& comp) {
+            if (comp(*a, *b)) {
+                if (comp(*b, *c)) return b;
+                return comp(*a, *c) ? c : a;
+            }
+            if (comp(*a, *c)) return a;
+            return comp(*b, *c) ? c : b;
+        }
+        
+        // Moves the pivot to *first: median of three for short ranges,
+        // Tukey's ninther (median of three medians) for long ones. The
+        // candidates all lie in (first, last), so elements on both sides of
+        // the pivot remain and the partition scans need no bounds checks.
+        template<typename It, typename Compare>
+        void movePivotToFirst(It first, It last, Compare& comp) {
+            const auto n = last - first;
+            It mid = first + n / 2;
+            It pivot;
+            if (n < kNintherThreshold) {
+                pivot = medianOf3(first + 1, mid, last - 1, comp);
+            } else {
+                const auto step = n / 8;
+                pivot = medianOf3(medianOf3(first + 1, first + 1 + step, first + 1 + 2 * step, comp),
+                                  medianOf3(mid - step, mid, mid + step, comp),
+                                  medianOf3(last - 1 - 2 * step, last - 1 - step, last - 1, comp), comp);
+            }
+            std::iter_swap(first, pivot);
+        }
+        
+        // Hoare partition of (first, last) around *first
+        template<typename It, typename Compare>
+        It hoarePartition(It first, It last, Compare& comp) {
+            It lo = first + 1;
+            It hi = last;
+            while (true) {
+                while (comp(*lo, *first)) ++lo;
+                --hi;
+                while (comp(*first, *hi)) --hi;
+                if (!(lo < hi)) return lo;
+                std::iter_swap(lo, hi);
+                ++lo;
+            }
+        }
+        
+        // Quicksort down to short runs; past the depth limit the range is
+        // heapsorted, which caps the worst case at O(n log n)
+        template<typename It, typename Compare>
+        void introLoop(It first, It last, int depthLimit, Compare& comp) {
+            while (last - first > kInsertionThreshold) {
+                if (depthLimit-- == 0) {
+                    std::make_heap(first, last, comp);
+                    std::sort_heap(first, last, comp);
+                    return;
+                }
+                movePivotToFirst(first, last, comp);
+                It cut = hoarePartition(first, last, comp);
+                introLoop(cut, last, depthLimit, comp);
+                last = cut;
+            }
+        }
+        
+        // Elements move at most kInsertionThreshold places after introLoop
+        template<typename It, typename Compare>
+        void insertionSort(It first, It last, Compare& comp) {
+            if (first == last) return;
+            for (It i = first + 1; i != last; ++i) {
+                auto value = std::move(*i);
+                It j = i;
+                for (; j != first && comp(value, *(j - 1)); --j) {
+                    *j = std::move(*(j - 1));
+                }
+                *j = std::move(value);
+            }
+        }
+        
+        // Unsigned integer of the same width as T
+        template<RadixKey T>
+        using RadixBits = std::conditional_t<sizeof(T) == 1, uint8_t,
+                          std::conditional_t<sizeof(T) == 2, uint16_t,
+                          std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+        
+        // Maps a key to an unsigned integer with the same order
+        template<RadixKey T>
+        RadixBits<T> radixEncode(T key) {
+            using Bits = RadixBits<T>;
+            constexpr Bits kSignBit = Bits(1) << (sizeof(T) * 8 - 1);
+            Bits bits = std::bit_cast<Bits>(key);
+            if constexpr (std::floating_point<T>) {
+                // Negative floats order backwards, so flip all their bits
+                return (bits & kSignBit) ? Bits(~bits) : Bits(bits | kSignBit);
+            } else if constexpr (std::signed_integral<T>) {
+                return bits ^ kSignBit;
+            } else {
+                return bits;
+            }
+        }
+    }
+    
+    // Introsort over random-access iterators
+    template<std::random_access_iterator It, typename Compare = std::ranges::less>
+        requires std::sortable<It, Compare>
+    void introSort(It first, It last, Compare comp = {}) {
+        const auto n = last - first;
+        if (n < 2) return;
+        const int depthLimit = 2 * static_cast<int>(std::bit_width(static_cast<size_t>(n)));
+        detail::introLoop(first, last, depthLimit, comp);
+        detail::insertionSort(first, last, comp);
+    }
+    
+    // LSD radix sort, one byte per pass. A single read builds every pass's
+    // histogram, and passes where all keys share the byte are skipped.
+    template<RadixKey T>
+    void radixSort(std::vector<T>& data) {
+        constexpr size_t kPasses = sizeof(T);
+        const size_t n = data.size();
+        if (n < 2) return;
+        
+        std::vector<std::array<size_t, 256>> counts(kPasses);
+        for (auto& histogram : counts) histogram.fill(0);
+        for (const T& key : data) {
+            auto bits = detail::radixEncode(key);
+            for (size_t pass = 0; pass < kPasses; ++pass) {
+                ++counts[pass][(bits >> (pass * 8)) & 0xFF];
+            }
+        }
+        
+        std::vector<T> buffer(n);
+        T* source = data.data();
+        T* target = buffer.data();
+        for (size_t pass = 0; pass < kPasses; ++pass) {
+            auto& histogram = counts[pass];
+            if (std::ranges::find(histogram, n) != histogram.end()) continue;
+            
+            size_t offset = 0;
+            for (auto& count : histogram) {
+                offset += std::exchange(count, offset);
+            }
+            for (size_t i = 0; i < n; ++i) {
+                auto digit = (detail::radixEncode(source[i]) >> (pass * 8)) & 0xFF;
+                target[histogram[digit]++] = source[i];
+            }
+            std::swap(source, target);
+        }
+        if (source != data.data()) {
+            std::copy(source, source + n, data.data());
+        }
+    }
+    
+    // Sequential sort chosen by the key type: radix for numeric keys in
+    // their natural order, introsort for everything else
+    template<std::totally_ordered T>
+    void autoSort(std::vector<T>& data) {
+        introSort(data.begin(), data.end());
+    }
+    
+    template<RadixKey T>
+    void autoSort(std::vector<T>& data) {
+        radixSort(data);
+    }
+    
+    template<typename T>
+    const char* autoSortName() {
+        if constexpr (RadixKey<T>) return "radix sort";
+        else return "introsort";
+    }
+    
+    // Parallel sample sort: sorted samples pick splitters, each chunk of
+    // the input is classified and counted on the pool, elements are moved
+    // into their bucket's slice of a buffer, and buckets are sorted on the
+    // pool with autoSort. Every stage keeps the input order within a bucket.
+    template<typename Pool, std::totally_ordered T>
+        requires std::default_initializable<T> && std::movable<T>
+    void parallelSampleSort(Pool& pool, std::vector<T>& data) {
+        const size_t n = data.size();
+        const size_t buckets = std::max<size_t>(2, pool.size() * 4);
+        if (n < (size_t(1) << 16)) {
+            autoSort(data);
+            return;
+        }
+        
+        // Evenly spaced samples, 16 per bucket
+        const size_t oversample = 16;
+        std::vector<T> samples;
+        samples.reserve(buckets * oversample);
+        for (size_t i = 0; i < buckets * oversample; ++i) {
+            samples.push_back(data[(i * 2 + 1) * n / (buckets * oversample * 2)]);
+        }
+        autoSort(samples);
+        std::vector<T> splitters;
+        for (size_t b = 1; b < buckets; ++b) splitters.push_back(samples[b * oversample]);
+        
+        // Classify each chunk and count its elements per bucket
+        const size_t chunks = buckets;
+        const size_t chunkSize = (n + chunks - 1) / chunks;
+        std::vector<uint16_t> bucketOf(n);
+        std::vector<std::vector<size_t>> counts(chunks, std::vector<size_t>(buckets, 0));
+        std::vector<std::future<void>> pending;
+        for (size_t c = 0; c < chunks; ++c) {
+            pending.push_back(pool.enqueue([&, c] {
+                const size_t end = std::min(n, (c + 1) * chunkSize);
+                for (size_t i = c * chunkSize; i < end; ++i) {
+                    auto b = static_cast<uint16_t>(std::ranges::upper_bound(splitters, data[i]) - splitters.begin());
+                    bucketOf[i] = b;
+                    ++counts[c][b];
+                }
+            }));
+        }
+        for (auto& task : pending) task.get();
+        pending.clear();
+        
+        // Bucket-major offsets: bucket b's slice holds chunk 0's elements,
+        // then chunk 1's, and so on
+        std::vector<size_t> bucketStart(buckets + 1, 0);
+        size_t offset = 0;
+        for (size_t b = 0; b < buckets; ++b) {
+            bucketStart[b] = offset;
+            for (size_t c = 0; c < chunks; ++c) {
+                offset += std::exchange(counts[c][b], offset);
+            }
+        }
+        bucketStart[buckets] = n;
+        
+        std::vector<T> buffer(n);
+        for (size_t c = 0; c < chunks; ++c) {
+            pending.push_back(pool.enqueue([&, c] {
+                const size_t end = std::min(n, (c + 1) * chunkSize);
+                for (size_t i = c * chunkSize; i < end; ++i) {
+                    buffer[counts[c][bucketOf[i]]++] = std::move(data[i]);
+                }
+            }));
+        }
+        for (auto& task : pending) task.get();
+        pending.clear();
+        
+        // Sort each bucket and move it back
+        for (size_t b = 0; b < buckets; ++b) {
+            pending.push_back(pool.enqueue([&, b] {
+                auto first = buffer.begin() + static_cast<std::ptrdiff_t>(bucketStart[b]);
+                auto last = buffer.begin() + static_cast<std::ptrdiff_t>(bucketStart[b + 1]);
+                std::vector<T> bucket(std::make_move_iterator(first), std::make_move_iterator(last));
+                autoSort(bucket);
+                std::ranges::move(bucket, data.begin() + static_cast<std::ptrdiff_t>(bucketStart[b]));
+            }));
+        }
+        for (auto& task : pending) task.get();
+    }
+    
+    template<typename Strategy, typename T>
+    concept SortsVectorOf = requires(Strategy strategy, std::vector<T>& data) { strategy.sort(data); };
+    
+    // Strategies for ConceptPatterns::Sorter; each sorts any vector whose
+    // element type meets its constraint
+    class IntroSort {
+    public:
+        template<std::totally_ordered T>
+        void sort(std::vector<T>& data) {
+            std::cout << "Performing introsort (ninther pivot, heapsort fallback)\n";
+            introSort(data.begin(), data.end());
+        }
+        
+        std::string name() const { return "Introsort"; }
+    };
+    
+    class RadixSort {
+    public:
+        template<RadixKey T>
+        void sort(std::vector<T>& data) {
+            std::cout << "Performing LSD radix sort (" << sizeof(T) << " byte passes)\n";
+            radixSort(data);
+        }
+        
+        std::string name() const { return "Radix Sort"; }
+    };
+    
+    class AutoSort {
+    public:
+        template<std::totally_ordered T>
+        void sort(std::vector<T>& data) {
+            std::cout << "Key type selects " << autoSortName<T>() << "\n";
+            autoSort(data);
+        }
+        
+        std::string name() const { return "Auto Sort"; }
+    };
+    
+    class SampleSort {
+    private:
+        ComputePool* pool_;
+        
+    public:
+        explicit SampleSort(ComputePool& pool) : pool_(&pool) {}
+        
+        template<std::totally_ordered T>
+            requires std::default_initializable<T> && std::movable<T>
+        void sort(std::vector<T>& data) {
+            std::cout << "Performing sample sort on " << pool_->size() << " workers (buckets use " 
+                      << autoSortName<T>() << ")\n";
+            parallelSampleSort(*pool_, data);
+        }
+        
+        std::string name() const { return "Parallel Sample Sort"; }
+    };
+}
+
 // Demo functions
 void demonstrateBasicConcepts() {
     using namespace BasicConcepts;
@@ -570,6 +959,10 @@ void demonstrateAdvancedConcepts() {
         
         std::size_t size() const { return data_.size(); }
         
+        // Growth goes through std::vector, which moves elements on reallocation
+        void push_back(double value) { data_.push_back(value); }
+        void reserve(std::size_t capacity) { data_.reserve(capacity); }
+        
         double& operator[](std::size_t index) { return data_[index]; }
         const double& operator[](std::size_t index) const { return data_[index]; }
         
@@ -704,6 +1097,95 @@ void demonstrateConceptComposition() {
     demonstrateSequenceOps(vec);
 }
 
+void demonstrateConceptSorting() {
+    using namespace ConceptSorting;
+    using ConceptPatterns::Sorter;
+    using Clock = std::chrono::steady_clock;
+    
+    std::cout << "\n=== Concept-Dispatched Sorting ===\n";
+    
+    // The key type picks the algorithm at compile time
+    std::vector<int> ids = {64, -34, 25, 12, -22, 11, 90};
+    std::vector<double> readings = {2.5, -0.75, 3.25, -12.5, 0.0, 1.125};
+    std::vector<std::string> names = {"delta", "alpha", "charlie", "bravo"};
+    
+    auto autoSorter = Sorter(AutoSort{});
+    autoSorter.performSort(ids);
+    std::cout << "Sorted ints: ";
+    for (int x : ids) std::cout << x << " ";
+    std::cout << "\n";
+    autoSorter.performSort(readings);
+    std::cout << "Sorted doubles: ";
+    for (double x : readings) std::cout << x << " ";
+    std::cout << "\n";
+    autoSorter.performSort(names);
+    std::cout << "Sorted strings: ";
+    for (const auto& x : names) std::cout << x << " ";
+    std::cout << "\n";
+    
+    static_assert(RadixKey<float> && RadixKey<uint64_t> && !RadixKey<bool>);
+    static_assert(!RadixKey<std::string> && !RadixKey<long double>);
+    static_assert(SortsVectorOf<RadixSort, double> && !SortsVectorOf<RadixSort, std::string>);
+    std::cout << "RadixSort rejects std::string keys at compile time\n\n";
+    
+    // Throughput on random 64-bit keys
+    const size_t count = 5'000'000;
+    std::mt19937_64 rng(57);
+    std::vector<int64_t> keys(count);
+    for (auto& key : keys) key = static_cast<int64_t>(rng());
+    
+    ComputePool pool;
+    auto timeSort = [&](const char* label, auto&& sortFn) {
+        auto copy = keys;
+        auto start = Clock::now();
+        sortFn(copy);
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::cout << "  " << std::left << std::setw(24) << label << std::right << std::fixed 
+                  << std::setprecision(1) << std::setw(8) << ms << " ms  "
+                  << (std::ranges::is_sorted(copy) ? "sorted" : "NOT SORTED") << "\n";
+        std::cout.unsetf(std::ios::fixed);
+        std::cout << std::setprecision(6);
+    };
+    
+    std::cout << "Sorting " << count << " int64 keys (" << pool.size() << " pool workers):\n";
+    timeSort("std::sort", [](auto& v) { std::sort(v.begin(), v.end()); });
+    timeSort("introSort", [](auto& v) { introSort(v.begin(), v.end()); });
+    timeSort("radixSort", [](auto& v) { radixSort(v); });
+    timeSort("parallelSampleSort", [&](auto& v) { parallelSampleSort(pool, v); });
+    
+    // Inputs that drive a naive first-element-pivot quicksort to O(n^2)
+    std::cout << "\nIntrosort on adversarial inputs (" << count << " ints):\n";
+    std::vector<std::pair<const char*, std::vector<int>>> inputs;
+    std::vector<int> ascending(count);
+    std::iota(ascending.begin(), ascending.end(), 0);
+    inputs.emplace_back("already sorted", ascending);
+    inputs.emplace_back("reversed", std::vector<int>(ascending.rbegin(), ascending.rend()));
+    inputs.emplace_back("all equal", std::vector<int>(count, 7));
+    std::vector<int> organPipe(count);
+    for (size_t i = 0; i < count; ++i) organPipe[i] = static_cast<int>(std::min(i, count - 1 - i));
+    inputs.emplace_back("organ pipe", std::move(organPipe));
+    
+    for (auto& [label, input] : inputs) {
+        auto start = Clock::now();
+        introSort(input.begin(), input.end());
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::cout << "  " << std::left << std::setw(24) << label << std::right << std::fixed 
+                  << std::setprecision(1) << std::setw(8) << ms << " ms  "
+                  << (std::ranges::is_sorted(input) ? "sorted" : "NOT SORTED") << "\n";
+        std::cout.unsetf(std::ios::fixed);
+        std::cout << std::setprecision(6);
+    }
+    
+    // Sample sort of strings: buckets fall back to introsort
+    std::vector<std::string> words(200'000);
+    for (auto& word : words) word = "key" + std::to_string(rng() % 1'000'000);
+    auto sampleSorter = Sorter(SampleSort(pool));
+    std::cout << "\n";
+    sampleSorter.performSort(words);
+    std::cout << words.size() << " strings " << (std::ranges::is_sorted(words) ? "sorted" : "NOT SORTED") 
+              << ", first " << words.front() << ", last " << words.back() << "\n";
+}
+
 int main() {
     std::cout << "=== Concepts Pattern Demo (C++20) ===\n\n";
     
@@ -712,6 +1194,7 @@ int main() {
     demonstrateConceptPatterns();
     demonstrateConceptSpecialization();
     demonstrateConceptComposition();
+    demonstrateConceptSorting();
     
     std::cout << "\n=== Concepts Benefits ===\n";
     std::cout << "1. Clear, readable template constraints\n";
@@ -10,6 +10,30 @@
 #include <queue>
 #include <optional>
 #include <exception>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define CORO_HAVE_EPOLL 1
+#endif
 
 // Example 1: Basic Generator Coroutine
 namespace BasicGenerator {
@@ -139,7 +163,7 @@ namespace BasicGenerator {
         std::cout << "Range generator finished\n";
     }
     
-    Generator<std::string> tokenize(const std::string& text, char delimiter) {
+    Generator<std::string> tokenize(std::string text, char delimiter) {
         std::cout << "Starting tokenization of: \"" << text << "\"\n";
         
         std::string token;
@@ -164,29 +188,257 @@ namespace BasicGenerator {
     }
 }
 
-// Example 2: Async Task Coroutine
-namespace AsyncTask {
+// Coroutine runtime used by the async examples below
+namespace CoroutineRuntime {
+    using Clock = std::chrono::steady_clock;
+    
+    // Size-classed free lists for coroutine frames. Each thread caches freed
+    // frames for its own next allocations, so steady-state spawning does not
+    // reach the global heap; a frame freed on another thread simply joins
+    // that thread's cache.
+    class FramePool {
+    private:
+        static constexpr size_t kGranule = 64;
+        static constexpr size_t kClasses = 16;       // frames up to 1 KiB
+        static constexpr size_t kCacheLimit = 256;   // per class and thread
+        
+        struct Cache {
+            std::array<std::vector<void*>, kClasses> free;
+            
+            ~Cache() {
+                for (auto& blocks : free) {
+                    for (void* block : blocks) ::operator delete(block);
+                }
+            }
+        };
+        
+        static inline thread_local Cache cache_;
+        static inline std::atomic<size_t> heapAllocations_{0};
+        static inline std::atomic<size_t> cachedAllocations_{0};
+        
+        static size_t classOf(size_t bytes) { return (bytes + kGranule - 1) / kGranule - 1; }
+        
+    public:
+        static void* allocate(size_t bytes) {
+            size_t sizeClass = classOf(bytes);
+            if (sizeClass < kClasses && !cache_.free[sizeClass].empty()) {
+                void* block = cache_.free[sizeClass].back();
+                cache_.free[sizeClass].pop_back();
+                cachedAllocations_.fetch_add(1, std::memory_order_relaxed);
+                return block;
+            }
+            heapAllocations_.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(sizeClass < kClasses ? (sizeClass + 1) * kGranule : bytes);
+        }
+        
+        static void deallocate(void* block, size_t bytes) {
+            size_t sizeClass = classOf(bytes);
+            if (sizeClass < kClasses && cache_.free[sizeClass].size() < kCacheLimit) {
+                cache_.free[sizeClass].push_back(block);
+                return;
+            }
+            ::operator delete(block);
+        }
+        
+        static size_t heapAllocations() { return heapAllocations_.load(std::memory_order_relaxed); }
+        static size_t cachedAllocations() { return cachedAllocations_.load(std::memory_order_relaxed); }
+    };
+    
+    // Copy of pattern 30's ChaseLevDeque: the owning worker pushes and takes
+    // at the bottom, thieves steal from the top. Only the owner may call
+    // push()/take(); steal() is safe from any thread.
     template<typename T>
-    class Task {
+    class ChaseLevDeque {
+    private:
+        struct RingBuffer {
+            int64_t capacity;
+            int64_t mask;
+            std::unique_ptr<std::atomic<T>[]> slots;
+            
+            explicit RingBuffer(int64_t cap)
+                : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+            
+            T load(int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+            void store(int64_t i, T value) { slots[i & mask].store(value, std::memory_order_relaxed); }
+            
+            RingBuffer* grow(int64_t bottom, int64_t top) const {
+                auto* bigger = new RingBuffer(capacity * 2);
+                for (int64_t i = top; i < bottom; ++i) {
+                    bigger->store(i, load(i));
+                }
+                return bigger;
+            }
+        };
+        
+        alignas(64) std::atomic<int64_t> top_{0};
+        alignas(64) std::atomic<int64_t> bottom_{0};
+        alignas(64) std::atomic<RingBuffer*> buffer_;
+        std::vector<std::unique_ptr<RingBuffer>> retired_;
+        
     public:
-        struct promise_type {
-            T result;
-            std::exception_ptr exception;
+        explicit ChaseLevDeque(int64_t initial_capacity = 256)
+            : buffer_(new RingBuffer(initial_capacity)) {}
+        
+        ~ChaseLevDeque() { delete buffer_.load(std::memory_order_relaxed); }
+        
+        ChaseLevDeque(const ChaseLevDeque&) = delete;
+        ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+        
+        void push(T value) {
+            int64_t b = bottom_.load(std::memory_order_relaxed);
+            int64_t t = top_.load(std::memory_order_acquire);
+            RingBuffer* buf = buffer_.load(std::memory_order_relaxed);
             
-            Task get_return_object() {
-                return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+            if (b - t > buf->capacity - 1) {
+                retired_.emplace_back(buf);
+                buf = buf->grow(b, t);
+                buffer_.store(buf, std::memory_order_release);
             }
             
-            std::suspend_never initial_suspend() { return {}; }
-            std::suspend_always final_suspend() noexcept { return {}; }
+            buf->store(b, value);
+            bottom_.store(b + 1, std::memory_order_release);
+        }
+        
+        bool take(T& out) {
+            int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            RingBuffer* buf = buffer_.load(std::memory_order_relaxed);
+            bottom_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top_.load(std::memory_order_relaxed);
+            
+            if (t > b) {
+                bottom_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+            
+            out = buf->load(b);
+            if (t == b) {
+                bool won = top_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom_.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+        
+        bool steal(T& out) {
+            int64_t t = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = bottom_.load(std::memory_order_acquire);
+            
+            if (t >= b) {
+                return false;
+            }
+            
+            RingBuffer* buf = buffer_.load(std::memory_order_acquire);
+            out = buf->load(t);
+            return top_.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+        
+        bool empty() const {
+            return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+        }
+    };
+    
+    // Hashed timing wheel with 1 ms ticks. A timer lands in the slot of its
+    // deadline tick; deadlines more than one revolution away stay in their
+    // slot until a later pass reaches them. Not thread-safe on its own.
+    class TimerWheel {
+    private:
+        static constexpr size_t kSlots = 512;
+        using Tick = std::chrono::milliseconds;
+        
+        struct Timer {
+            std::coroutine_handle<> handle;
+            uint64_t deadline;
+        };
+        
+        std::array<std::vector<Timer>, kSlots> slots_;
+        Clock::time_point origin_ = Clock::now();
+        uint64_t currentTick_ = 0;
+        size_t pending_ = 0;
+        
+        uint64_t tickAt(Clock::time_point time) const {
+            return static_cast<uint64_t>(std::chrono::duration_cast<Tick>(time - origin_).count());
+        }
+        
+    public:
+        void add(std::coroutine_handle<> handle, Clock::time_point deadline) {
+            if (pending_ == 0) currentTick_ = tickAt(Clock::now());
+            // Round up so a timer never fires early
+            uint64_t tick = std::max(currentTick_ + 1, tickAt(deadline) + 1);
+            slots_[tick % kSlots].push_back({handle, tick});
+            ++pending_;
+        }
+        
+        // Calls expire(handle) for every timer due at or before now
+        template<typename F>
+        void advance(Clock::time_point now, F&& expire) {
+            uint64_t target = tickAt(now);
+            if (pending_ == 0) {
+                currentTick_ = std::max(currentTick_, target);
+                return;
+            }
+            while (currentTick_ < target && pending_ > 0) {
+                ++currentTick_;
+                auto& slot = slots_[currentTick_ % kSlots];
+                auto due = std::partition(slot.begin(), slot.end(),
+                    [this](const Timer& timer) { return timer.deadline > currentTick_; });
+                for (auto it = due; it != slot.end(); ++it) expire(it->handle);
+                pending_ -= static_cast<size_t>(slot.end() - due);
+                slot.erase(due, slot.end());
+            }
+            currentTick_ = std::max(currentTick_, target);
+        }
+        
+        bool empty() const { return pending_ == 0; }
+    };
+    
+    class Scheduler;
+    
+    namespace detail {
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
             
-            void return_value(T value) {
-                result = std::move(value);
+            // Symmetric transfer: jump straight into the awaiting coroutine
+            // instead of resuming it from inside this frame, so long await
+            // chains run in constant stack depth
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+                auto continuation = handle.promise().continuation;
+                return continuation ? continuation : std::noop_coroutine();
             }
             
-            void unhandled_exception() {
-                exception = std::current_exception();
+            void await_resume() const noexcept {}
+        };
+        
+        struct PromiseBase {
+            std::coroutine_handle<> continuation;
+            std::exception_ptr exception;
+            
+            static void* operator new(size_t bytes) { return FramePool::allocate(bytes); }
+            static void operator delete(void* frame, size_t bytes) { FramePool::deallocate(frame, bytes); }
+            
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            FinalAwaiter final_suspend() noexcept { return {}; }
+            void unhandled_exception() { exception = std::current_exception(); }
+        };
+    }
+    
+    // Lazy task: the body starts when the task is awaited, and completion
+    // transfers control straight back to the awaiting coroutine
+    template<typename T = void>
+    class Task {
+    public:
+        struct promise_type : detail::PromiseBase {
+            std::optional<T> value;
+            
+            Task get_return_object() {
+                return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
             }
+            
+            void return_value(T result) { value = std::move(result); }
         };
         
         using handle_type = std::coroutine_handle<promise_type>;
@@ -198,62 +450,758 @@ namespace AsyncTask {
         explicit Task(handle_type h) : coro_handle(h) {}
         
         ~Task() {
-            if (coro_handle) {
-                coro_handle.destroy();
+            if (coro_handle) coro_handle.destroy();
+        }
+        
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        
+        Task(Task&& other) noexcept : coro_handle(std::exchange(other.coro_handle, {})) {}
+        
+        bool await_ready() const { return !coro_handle || coro_handle.done(); }
+        
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) {
+            coro_handle.promise().continuation = awaiting;
+            return coro_handle;
+        }
+        
+        T await_resume() {
+            if (coro_handle.promise().exception) {
+                std::rethrow_exception(coro_handle.promise().exception);
+            }
+            return std::move(*coro_handle.promise().value);
+        }
+    };
+    
+    template<>
+    class Task<void> {
+    public:
+        struct promise_type : detail::PromiseBase {
+            Task get_return_object() {
+                return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
             }
+            
+            void return_void() {}
+        };
+        
+        using handle_type = std::coroutine_handle<promise_type>;
+        
+    private:
+        handle_type coro_handle;
+        
+    public:
+        explicit Task(handle_type h) : coro_handle(h) {}
+        
+        ~Task() {
+            if (coro_handle) coro_handle.destroy();
         }
         
         Task(const Task&) = delete;
         Task& operator=(const Task&) = delete;
         
-        Task(Task&& other) noexcept : coro_handle(other.coro_handle) {
-            other.coro_handle = {};
+        Task(Task&& other) noexcept : coro_handle(std::exchange(other.coro_handle, {})) {}
+        
+        bool await_ready() const { return !coro_handle || coro_handle.done(); }
+        
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) {
+            coro_handle.promise().continuation = awaiting;
+            return coro_handle;
         }
         
-        Task& operator=(Task&& other) noexcept {
-            if (this != &other) {
-                if (coro_handle) {
-                    coro_handle.destroy();
+        void await_resume() {
+            if (coro_handle.promise().exception) {
+                std::rethrow_exception(coro_handle.promise().exception);
+            }
+        }
+    };
+    
+    // Root coroutine owned by nobody: it starts when scheduled and frees its
+    // own frame when it finishes
+    class Detached {
+    public:
+        struct promise_type {
+            static void* operator new(size_t bytes) { return FramePool::allocate(bytes); }
+            static void operator delete(void* frame, size_t bytes) { FramePool::deallocate(frame, bytes); }
+            
+            Detached get_return_object() {
+                return Detached{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+            
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+        
+        std::coroutine_handle<> handle;
+    };
+    
+    // Resumes coroutine handles on a work-stealing pool. A reactor thread
+    // owns the timer wheel (and, on Linux, an epoll instance) and hands
+    // every expired sleep or ready descriptor back to the pool; no thread
+    // ever blocks on behalf of a single coroutine.
+    class Scheduler {
+    private:
+        struct alignas(64) Worker {
+            std::thread thread;
+            ChaseLevDeque<void*> deque;
+            uint64_t rng_state{0};
+            std::atomic<size_t> resumed{0};
+            std::atomic<size_t> stolen{0};
+        };
+        
+        static constexpr int kSpinRounds = 64;
+        
+        std::vector<std::unique_ptr<Worker>> workers_;
+        std::atomic<bool> stop_{false};
+        
+        // Handles scheduled from outside the pool (reactor, main thread)
+        std::mutex injection_mutex_;
+        std::queue<void*> injection_queue_;
+        std::atomic<size_t> injected_{0};
+        
+        std::mutex park_mutex_;
+        std::condition_variable park_cv_;
+        std::atomic<uint64_t> work_epoch_{0};
+        std::atomic<int> parked_workers_{0};
+        std::atomic<size_t> pending_{0};
+        
+        // Reactor state
+        std::thread reactor_;
+        std::mutex timer_mutex_;
+        TimerWheel timers_;
+#ifdef CORO_HAVE_EPOLL
+        int epoll_fd_ = -1;
+        int wake_fd_ = -1;
+#else
+        std::condition_variable timer_cv_;
+#endif
+        
+        static inline thread_local Scheduler* current_ = nullptr;
+        static inline thread_local size_t current_worker_ = 0;
+        
+        static uint64_t next_random(uint64_t& state) {
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 2685821657736338717ULL;
+        }
+        
+        bool pop_injected(void*& task) {
+            if (injected_.load(std::memory_order_acquire) == 0) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(injection_mutex_);
+            if (injection_queue_.empty()) {
+                return false;
+            }
+            task = injection_queue_.front();
+            injection_queue_.pop();
+            injected_.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+        
+        bool try_steal(Worker* worker, size_t worker_id, void*& task) {
+            size_t n = workers_.size();
+            if (n < 2) {
+                return false;
+            }
+            size_t start = next_random(worker->rng_state) % n;
+            for (size_t k = 0; k < n; ++k) {
+                size_t victim = (start + k) % n;
+                if (victim == worker_id) continue;
+                if (workers_[victim]->deque.steal(task)) {
+                    worker->stolen.fetch_add(1, std::memory_order_relaxed);
+                    return true;
                 }
-                coro_handle = other.coro_handle;
-                other.coro_handle = {};
             }
-            return *this;
+            return false;
         }
         
-        bool is_ready() const {
-            return !coro_handle || coro_handle.done();
+        bool find_task(Worker* worker, size_t worker_id, void*& task) {
+            return worker->deque.take(task)
+                || pop_injected(task)
+                || try_steal(worker, worker_id, task);
+        }
+        
+        bool work_visible() const {
+            if (injected_.load(std::memory_order_acquire) > 0) {
+                return true;
+            }
+            for (const auto& w : workers_) {
+                if (!w->deque.empty()) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        
+        void signal_work() {
+            work_epoch_.fetch_add(1, std::memory_order_seq_cst);
+            if (parked_workers_.load(std::memory_order_seq_cst) > 0) {
+                std::lock_guard<std::mutex> lock(park_mutex_);
+                park_cv_.notify_one();
+            }
         }
         
-        T get() {
-            if (!coro_handle.done()) {
-                throw std::runtime_error("Task not completed");
+        void park() {
+            parked_workers_.fetch_add(1, std::memory_order_seq_cst);
+            uint64_t epoch = work_epoch_.load(std::memory_order_seq_cst);
+            if (!work_visible() && !stop_) {
+                std::unique_lock<std::mutex> lock(park_mutex_);
+                park_cv_.wait(lock, [&] {
+                    return stop_ || work_epoch_.load(std::memory_order_seq_cst) != epoch;
+                });
             }
+            parked_workers_.fetch_sub(1, std::memory_order_seq_cst);
+        }
+        
+        void worker_thread(Worker* worker, size_t worker_id) {
+            current_ = this;
+            current_worker_ = worker_id;
             
-            if (coro_handle.promise().exception) {
-                std::rethrow_exception(coro_handle.promise().exception);
+            while (true) {
+                void* task = nullptr;
+                bool found = false;
+                for (int spin = 0; spin < kSpinRounds && !found; ++spin) {
+                    found = find_task(worker, worker_id, task);
+                    if (!found) std::this_thread::yield();
+                }
+                
+                if (found) {
+                    std::coroutine_handle<>::from_address(task).resume();
+                    worker->resumed.fetch_add(1, std::memory_order_relaxed);
+                    pending_.fetch_sub(1, std::memory_order_release);
+                    continue;
+                }
+                
+                if (stop_ && pending_.load(std::memory_order_acquire) == 0) {
+                    break;
+                }
+                park();
             }
             
-            return std::move(coro_handle.promise().result);
+            current_ = nullptr;
         }
         
-        // Make Task awaitable
-        bool await_ready() {
-            return coro_handle.done();
+        void wake_reactor() {
+#ifdef CORO_HAVE_EPOLL
+            uint64_t one = 1;
+            [[maybe_unused]] auto written = ::write(wake_fd_, &one, sizeof(one));
+#else
+            timer_cv_.notify_one();
+#endif
         }
         
-        void await_suspend(std::coroutine_handle<> awaiting) {
-            // In a real implementation, you'd schedule the awaiting coroutine
-            // to resume when this task completes
-            coro_handle.resume();
+        void reactor_thread() {
+            std::vector<std::coroutine_handle<>> expired;
+            while (!stop_.load(std::memory_order_acquire)) {
+                bool timersPending;
+                {
+                    std::lock_guard<std::mutex> lock(timer_mutex_);
+                    timersPending = !timers_.empty();
+                }
+#ifdef CORO_HAVE_EPOLL
+                epoll_event events[64];
+                int ready = ::epoll_wait(epoll_fd_, events, 64, timersPending ? 1 : -1);
+                for (int i = 0; i < ready; ++i) {
+                    const int fd = events[i].data.fd;
+                    if (fd == wake_fd_) {
+                        uint64_t count;
+                        [[maybe_unused]] auto drained = ::read(wake_fd_, &count, sizeof(count));
+                        continue;
+                    }
+                    const uint32_t fired = events[i].events;
+                    IoWaiter* woken[2] = {nullptr, nullptr};
+                    {
+                        std::lock_guard<std::mutex> lock(io_mutex_);
+                        FdWatch& watch = fd_watches_[fd];
+                        if (watch.reader && (fired & kReadEvents)) {
+                            woken[0] = std::exchange(watch.reader, nullptr);
+                        }
+                        if (watch.writer && (fired & kWriteEvents)) {
+                            woken[1] = std::exchange(watch.writer, nullptr);
+                        }
+                        // The one-shot registration is spent; keep watching
+                        // for whoever is still waiting
+                        if (watch.reader || watch.writer) arm(fd, watch);
+                    }
+                    for (IoWaiter* waiter : woken) {
+                        if (!waiter) continue;
+                        waiter->ready = fired;
+                        schedule(waiter->handle);
+                    }
+                }
+#else
+                {
+                    std::unique_lock<std::mutex> lock(timer_mutex_);
+                    if (timersPending) {
+                        timer_cv_.wait_for(lock, std::chrono::milliseconds(1));
+                    } else {
+                        timer_cv_.wait(lock, [this] { return stop_.load() || !timers_.empty(); });
+                    }
+                }
+#endif
+                {
+                    std::lock_guard<std::mutex> lock(timer_mutex_);
+                    timers_.advance(Clock::now(), [&](std::coroutine_handle<> h) { expired.push_back(h); });
+                }
+                for (auto handle : expired) schedule(handle);
+                expired.clear();
+            }
         }
         
-        T await_resume() {
-            return get();
+    public:
+#ifdef CORO_HAVE_EPOLL
+        // Registration record for one suspended I/O wait; lives in the
+        // awaiting coroutine's frame. io_mutex_ orders its hand-off between
+        // watch() and the reactor.
+        struct IoWaiter {
+            std::coroutine_handle<> handle;
+            uint32_t ready = 0;
+        };
+        
+    private:
+        // One reader and one writer may wait on a descriptor at once; the
+        // registration watches the union of what they wait for
+        struct FdWatch {
+            IoWaiter* reader = nullptr;
+            IoWaiter* writer = nullptr;
+        };
+        std::mutex io_mutex_;
+        std::unordered_map<int, FdWatch> fd_watches_;
+        
+        static constexpr uint32_t kReadEvents = EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR;
+        static constexpr uint32_t kWriteEvents = EPOLLOUT | EPOLLHUP | EPOLLERR;
+        
+        // Caller holds io_mutex_. Re-arms the one-shot registration for the
+        // waiters still present, adding it if the descriptor is new to epoll.
+        bool arm(int fd, const FdWatch& watch) {
+            epoll_event event{};
+            event.events = EPOLLONESHOT | (watch.reader ? uint32_t(EPOLLIN) : 0u) 
+                                        | (watch.writer ? uint32_t(EPOLLOUT) : 0u);
+            event.data.fd = fd;
+            if (::epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, fd, &event) == 0) return true;
+            return errno == ENOENT && ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) == 0;
+        }
+        
+    public:
+#endif
+        
+        explicit Scheduler(size_t threads = std::max(2u, std::thread::hardware_concurrency())) {
+#ifdef CORO_HAVE_EPOLL
+            epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+            wake_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (epoll_fd_ < 0 || wake_fd_ < 0) {
+                throw std::runtime_error("Scheduler: cannot create epoll instance");
+            }
+            epoll_event wake{};
+            wake.events = EPOLLIN;
+            wake.data.fd = wake_fd_;
+            ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &wake);
+#endif
+            std::random_device rd;
+            for (size_t i = 0; i < threads; ++i) {
+                workers_.push_back(std::make_unique<Worker>());
+                workers_.back()->rng_state = (static_cast<uint64_t>(rd()) << 32) | (i + 1);
+            }
+            for (size_t i = 0; i < threads; ++i) {
+                workers_[i]->thread = std::thread(&Scheduler::worker_thread, this, workers_[i].get(), i);
+            }
+            reactor_ = std::thread(&Scheduler::reactor_thread, this);
+        }
+        
+        // Coroutines still suspended at shutdown are not resumed
+        ~Scheduler() {
+            stop_.store(true, std::memory_order_release);
+            wake_reactor();
+            reactor_.join();
+            {
+                std::lock_guard<std::mutex> lock(park_mutex_);
+                work_epoch_.fetch_add(1);
+            }
+            park_cv_.notify_all();
+            for (auto& worker : workers_) worker->thread.join();
+#ifdef CORO_HAVE_EPOLL
+            ::close(wake_fd_);
+            ::close(epoll_fd_);
+#endif
+        }
+        
+        Scheduler(const Scheduler&) = delete;
+        Scheduler& operator=(const Scheduler&) = delete;
+        
+        // Queue a handle for resumption: onto the calling worker's own deque
+        // when called from this pool, else through the injection queue
+        void schedule(std::coroutine_handle<> handle) {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            if (current_ == this) {
+                workers_[current_worker_]->deque.push(handle.address());
+            } else {
+                std::lock_guard<std::mutex> lock(injection_mutex_);
+                injection_queue_.push(handle.address());
+                injected_.fetch_add(1, std::memory_order_release);
+            }
+            signal_work();
+        }
+        
+        void addTimer(std::coroutine_handle<> handle, Clock::time_point deadline) {
+            bool wasEmpty;
+            {
+                std::lock_guard<std::mutex> lock(timer_mutex_);
+                wasEmpty = timers_.empty();
+                timers_.add(handle, deadline);
+            }
+            // The reactor only sleeps without a timeout while the wheel is empty
+            if (wasEmpty) wake_reactor();
+        }
+        
+#ifdef CORO_HAVE_EPOLL
+        // Waits for EPOLLIN or EPOLLOUT on fd. A descriptor takes one
+        // reader and one writer at a time, so a full-duplex socket can have
+        // a coroutine parked in each direction; a second waiter in the same
+        // direction is a logic error. Returns false when the descriptor
+        // cannot be polled (regular files are always ready); the caller then
+        // continues without suspending.
+        bool watch(int fd, uint32_t events, IoWaiter* waiter) {
+            const bool write = (events & EPOLLOUT) != 0;
+            std::lock_guard<std::mutex> lock(io_mutex_);
+            FdWatch& watch = fd_watches_[fd];
+            IoWaiter*& slot = write ? watch.writer : watch.reader;
+            if (slot) {
+                throw std::logic_error("Scheduler::watch: descriptor already has a waiter in that direction");
+            }
+            slot = waiter;
+            if (arm(fd, watch)) return true;
+            slot = nullptr;
+            waiter->ready = events;
+            return false;
+        }
+#endif
+        
+        // co_await scheduler.schedule() continues on a pool worker
+        auto schedule() {
+            struct ScheduleAwaiter {
+                Scheduler& scheduler;
+                bool await_ready() const noexcept { return false; }
+                void await_suspend(std::coroutine_handle<> handle) { scheduler.schedule(handle); }
+                void await_resume() const noexcept {}
+            };
+            return ScheduleAwaiter{*this};
+        }
+        
+        // Suspends on the timer wheel; no thread sleeps on the coroutine's behalf
+        auto sleepFor(Clock::duration duration) {
+            struct SleepAwaiter {
+                Scheduler& scheduler;
+                Clock::time_point deadline;
+                bool await_ready() const { return deadline <= Clock::now(); }
+                void await_suspend(std::coroutine_handle<> handle) { scheduler.addTimer(handle, deadline); }
+                void await_resume() const noexcept {}
+            };
+            return SleepAwaiter{*this, Clock::now() + duration};
+        }
+        
+        void spawn(Task<void> task) {
+            schedule(runDetached(std::move(task)).handle);
+        }
+        
+        // Runs a task on the pool and blocks the calling (non-pool) thread
+        // until it finishes
+        template<typename T>
+        T blockOn(Task<T> task) {
+            std::promise<T> result;
+            auto future = result.get_future();
+            schedule(fulfil(std::move(task), std::move(result)).handle);
+            return future.get();
+        }
+        
+        // Scheduler whose worker is running the calling thread, if any
+        static Scheduler* current() { return current_; }
+        
+        size_t size() const { return workers_.size(); }
+        
+        size_t stolen() const {
+            size_t total = 0;
+            for (const auto& w : workers_) total += w->stolen.load(std::memory_order_relaxed);
+            return total;
+        }
+        
+    private:
+        static Detached runDetached(Task<void> task) {
+            co_await task;
+        }
+        
+        template<typename T>
+        static Detached fulfil(Task<T> task, std::promise<T> result) {
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    co_await task;
+                    result.set_value();
+                } else {
+                    result.set_value(co_await task);
+                }
+            } catch (...) {
+                result.set_exception(std::current_exception());
+            }
+        }
+    };
+    
+    // Counts outstanding work; one coroutine may await the count reaching
+    // zero. The count starts at 1, a reference held by the waiter itself,
+    // and whichever side drops it to zero resumes the waiter. A done() that
+    // is not last never touches the group again, and the last one runs
+    // while the waiter is still suspended, so the group may live in the
+    // waiter's frame.
+    class WaitGroup {
+    private:
+        Scheduler& scheduler_;
+        std::atomic<int64_t> count_{1};
+        std::coroutine_handle<> waiter_;
+        
+    public:
+        explicit WaitGroup(Scheduler& scheduler) : scheduler_(scheduler) {}
+        
+        void add(int64_t n) { count_.fetch_add(n, std::memory_order_relaxed); }
+        
+        void done() {
+            if (count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                scheduler_.schedule(waiter_);
+            }
+        }
+        
+        // Awaited at most once, after every add()
+        auto wait() {
+            struct WaitAwaiter {
+                WaitGroup& group;
+                
+                // Only the waiter's own reference left: nothing can call done()
+                bool await_ready() const { return group.count_.load(std::memory_order_acquire) == 1; }
+                
+                bool await_suspend(std::coroutine_handle<> handle) {
+                    group.waiter_ = handle;
+                    // Dropping the waiter's reference publishes the handle; if
+                    // that was the last reference, keep running instead
+                    return group.count_.fetch_sub(1, std::memory_order_acq_rel) != 1;
+                }
+                
+                void await_resume() const noexcept {}
+            };
+            return WaitAwaiter{*this};
+        }
+    };
+    
+    // Runs every task concurrently on the scheduler and completes when the
+    // last one does
+    Task<void> whenAll(Scheduler& scheduler, std::vector<Task<void>> tasks) {
+        WaitGroup group(scheduler);
+        group.add(static_cast<int64_t>(tasks.size()));
+        auto signalWhenDone = [](Task<void> task, WaitGroup& done) -> Task<void> {
+            co_await task;
+            done.done();
+        };
+        for (auto& task : tasks) {
+            scheduler.spawn(signalWhenDone(std::move(task), group));
+        }
+        co_await group.wait();
+    }
+    
+    // Bounded MPMC channel whose blocked senders and receivers are resumed
+    // through the scheduler, never inline under the channel lock.
+    // receive() yields std::nullopt once the channel is closed and drained.
+    template<typename T>
+    class Channel {
+    private:
+        struct BlockedSender {
+            std::coroutine_handle<> handle;
+            T* value;
+            bool* accepted;
+        };
+        
+        struct BlockedReceiver {
+            std::coroutine_handle<> handle;
+            std::optional<T>* slot;
+        };
+        
+        Scheduler& scheduler_;
+        size_t capacity_;
+        std::mutex mutex_;
+        std::deque<T> buffer_;
+        std::deque<BlockedSender> senders_;
+        std::deque<BlockedReceiver> receivers_;
+        bool closed_ = false;
+        
+    public:
+        Channel(Scheduler& scheduler, size_t capacity) : scheduler_(scheduler), capacity_(capacity) {}
+        
+        class SendAwaiter {
+        private:
+            Channel& channel_;
+            T value_;
+            bool accepted_ = true;
+            
+        public:
+            SendAwaiter(Channel& channel, T value) : channel_(channel), value_(std::move(value)) {}
+            
+            bool await_ready() const { return false; }
+            
+            bool await_suspend(std::coroutine_handle<> handle) {
+                std::unique_lock<std::mutex> lock(channel_.mutex_);
+                if (channel_.closed_) {
+                    accepted_ = false;
+                    return false;
+                }
+                if (!channel_.receivers_.empty()) {
+                    // Hand the value straight to a waiting receiver
+                    auto receiver = channel_.receivers_.front();
+                    channel_.receivers_.pop_front();
+                    *receiver.slot = std::move(value_);
+                    lock.unlock();
+                    channel_.scheduler_.schedule(receiver.handle);
+                    return false;
+                }
+                if (channel_.buffer_.size() < channel_.capacity_) {
+                    channel_.buffer_.push_back(std::move(value_));
+                    return false;
+                }
+                channel_.senders_.push_back({handle, &value_, &accepted_});
+                return true;
+            }
+            
+            // False if the channel was closed before the value was accepted
+            bool await_resume() const { return accepted_; }
+        };
+        
+        class ReceiveAwaiter {
+        private:
+            Channel& channel_;
+            std::optional<T> result_;
+            
+        public:
+            explicit ReceiveAwaiter(Channel& channel) : channel_(channel) {}
+            
+            bool await_ready() const { return false; }
+            
+            bool await_suspend(std::coroutine_handle<> handle) {
+                std::unique_lock<std::mutex> lock(channel_.mutex_);
+                std::coroutine_handle<> wake;
+                if (!channel_.buffer_.empty()) {
+                    result_ = std::move(channel_.buffer_.front());
+                    channel_.buffer_.pop_front();
+                    // A slot opened: admit one blocked sender's value
+                    if (!channel_.senders_.empty()) {
+                        auto sender = channel_.senders_.front();
+                        channel_.senders_.pop_front();
+                        channel_.buffer_.push_back(std::move(*sender.value));
+                        wake = sender.handle;
+                    }
+                } else if (!channel_.senders_.empty()) {
+                    auto sender = channel_.senders_.front();
+                    channel_.senders_.pop_front();
+                    result_ = std::move(*sender.value);
+                    wake = sender.handle;
+                } else if (!channel_.closed_) {
+                    channel_.receivers_.push_back({handle, &result_});
+                    return true;
+                }
+                lock.unlock();
+                if (wake) channel_.scheduler_.schedule(wake);
+                return false;
+            }
+            
+            std::optional<T> await_resume() { return std::move(result_); }
+        };
+        
+        SendAwaiter send(T value) { return SendAwaiter{*this, std::move(value)}; }
+        ReceiveAwaiter receive() { return ReceiveAwaiter{*this}; }
+        
+        // Wakes every blocked receiver with std::nullopt and every blocked
+        // sender with a rejected send
+        void close() {
+            std::deque<BlockedSender> senders;
+            std::deque<BlockedReceiver> receivers;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                closed_ = true;
+                senders.swap(senders_);
+                receivers.swap(receivers_);
+            }
+            for (auto& sender : senders) {
+                *sender.accepted = false;
+                scheduler_.schedule(sender.handle);
+            }
+            for (auto& receiver : receivers) scheduler_.schedule(receiver.handle);
         }
     };
     
-    // Awaitable for sleeping
+#ifdef CORO_HAVE_EPOLL
+    // Suspends until fd is ready for the given epoll events
+    class ReadyAwaiter {
+    private:
+        Scheduler& scheduler_;
+        int fd_;
+        uint32_t events_;
+        Scheduler::IoWaiter waiter_;
+        
+    public:
+        ReadyAwaiter(Scheduler& scheduler, int fd, uint32_t events)
+            : scheduler_(scheduler), fd_(fd), events_(events) {}
+        
+        bool await_ready() const { return false; }
+        
+        bool await_suspend(std::coroutine_handle<> handle) {
+            waiter_.handle = handle;
+            return scheduler_.watch(fd_, events_, &waiter_);
+        }
+        
+        uint32_t await_resume() const { return waiter_.ready; }
+    };
+    
+    // Non-blocking read: retries after each readiness notification.
+    // Returns bytes read, 0 at end of stream or -1 with errno set.
+    Task<ssize_t> asyncRead(Scheduler& scheduler, int fd, void* buffer, size_t length) {
+        while (true) {
+            ssize_t n = ::read(fd, buffer, length);
+            if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) co_return n;
+            co_await ReadyAwaiter(scheduler, fd, EPOLLIN);
+        }
+    }
+    
+    // Writes all bytes, suspending whenever the socket buffer is full
+    Task<ssize_t> asyncWrite(Scheduler& scheduler, int fd, const void* buffer, size_t length) {
+        size_t written = 0;
+        while (written < length) {
+            ssize_t n = ::write(fd, static_cast<const char*>(buffer) + written, length - written);
+            if (n >= 0) {
+                written += static_cast<size_t>(n);
+            } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                co_await ReadyAwaiter(scheduler, fd, EPOLLOUT);
+            } else {
+                co_return -1;
+            }
+        }
+        co_return static_cast<ssize_t>(written);
+    }
+    
+    // Positional read. epoll reports regular files as always ready, so for
+    // them this completes without suspending; pipes and sockets wait
+    Task<ssize_t> asyncReadAt(Scheduler& scheduler, int fd, void* buffer, size_t length, off_t offset) {
+        while (true) {
+            ssize_t n = ::pread(fd, buffer, length, offset);
+            if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) co_return n;
+            co_await ReadyAwaiter(scheduler, fd, EPOLLIN);
+        }
+    }
+#endif
+}
+
+// Example 2: Async Task Coroutine
+namespace AsyncTask {
+    using CoroutineRuntime::Task;
+    using CoroutineRuntime::Scheduler;
+    
+    // Awaitable for sleeping: parks the coroutine on the timer wheel of the
+    // scheduler running it instead of blocking a thread
     class SleepAwaiter {
     private:
         std::chrono::milliseconds duration;
@@ -264,10 +1212,11 @@ namespace AsyncTask {
         bool await_ready() const { return duration.count() <= 0; }
         
         void await_suspend(std::coroutine_handle<> handle) {
-            std::thread([handle, duration = this->duration]() {
-                std::this_thread::sleep_for(duration);
-                handle.resume();
-            }).detach();
+            Scheduler* scheduler = Scheduler::current();
+            if (!scheduler) {
+                throw std::runtime_error("SleepAwaiter: coroutine is not running on a Scheduler");
+            }
+            scheduler->addTimer(handle, CoroutineRuntime::Clock::now() + duration);
         }
         
         void await_resume() {}
@@ -290,7 +1239,7 @@ namespace AsyncTask {
         co_return n * n;
     }
     
-    Task<std::string> fetchDataAsync(const std::string& url) {
+    Task<std::string> fetchDataAsync(std::string url) {
         std::cout << "Fetching data from: " << url << "\n";
         
         co_await sleep_for(std::chrono::milliseconds(200));
@@ -419,125 +1368,9 @@ namespace StateMachine {
 
 // Example 4: Producer-Consumer with Coroutines
 namespace ProducerConsumer {
-    template<typename T>
-    class Channel {
-    private:
-        std::queue<T> buffer_;
-        std::queue<std::coroutine_handle<>> waiting_producers_;
-        std::queue<std::coroutine_handle<>> waiting_consumers_;
-        size_t capacity_;
-        mutable std::mutex mutex_;
-        
-    public:
-        explicit Channel(size_t capacity = 10) : capacity_(capacity) {}
-        
-        class SendAwaiter {
-        private:
-            Channel& channel_;
-            T value_;
-            
-        public:
-            SendAwaiter(Channel& channel, T value) : channel_(channel), value_(std::move(value)) {}
-            
-            bool await_ready() {
-                std::lock_guard<std::mutex> lock(channel_.mutex_);
-                return channel_.buffer_.size() < channel_.capacity_;
-            }
-            
-            void await_suspend(std::coroutine_handle<> handle) {
-                std::lock_guard<std::mutex> lock(channel_.mutex_);
-                channel_.waiting_producers_.push(handle);
-            }
-            
-            void await_resume() {
-                std::lock_guard<std::mutex> lock(channel_.mutex_);
-                channel_.buffer_.push(std::move(value_));
-                
-                if (!channel_.waiting_consumers_.empty()) {
-                    auto consumer = channel_.waiting_consumers_.front();
-                    channel_.waiting_consumers_.pop();
-                    consumer.resume();
-                }
-            }
-        };
-        
-        class ReceiveAwaiter {
-        private:
-            Channel& channel_;
-            T result_;
-            
-        public:
-            explicit ReceiveAwaiter(Channel& channel) : channel_(channel) {}
-            
-            bool await_ready() {
-                std::lock_guard<std::mutex> lock(channel_.mutex_);
-                return !channel_.buffer_.empty();
-            }
-            
-            void await_suspend(std::coroutine_handle<> handle) {
-                std::lock_guard<std::mutex> lock(channel_.mutex_);
-                channel_.waiting_consumers_.push(handle);
-            }
-            
-            T await_resume() {
-                std::lock_guard<std::mutex> lock(channel_.mutex_);
-                result_ = std::move(channel_.buffer_.front());
-                channel_.buffer_.pop();
-                
-                if (!channel_.waiting_producers_.empty()) {
-                    auto producer = channel_.waiting_producers_.front();
-                    channel_.waiting_producers_.pop();
-                    producer.resume();
-                }
-                
-                return std::move(result_);
-            }
-        };
-        
-        SendAwaiter send(T value) {
-            return SendAwaiter{*this, std::move(value)};
-        }
-        
-        ReceiveAwaiter receive() {
-            return ReceiveAwaiter{*this};
-        }
-    };
-    
-    // Simple task type for producer-consumer
-    class SimpleTask {
-    public:
-        struct promise_type {
-            SimpleTask get_return_object() {
-                return SimpleTask{std::coroutine_handle<promise_type>::from_promise(*this)};
-            }
-            
-            std::suspend_never initial_suspend() { return {}; }
-            std::suspend_always final_suspend() noexcept { return {}; }
-            void return_void() {}
-            void unhandled_exception() {}
-        };
-        
-        using handle_type = std::coroutine_handle<promise_type>;
-        
-    private:
-        handle_type coro_handle;
-        
-    public:
-        explicit SimpleTask(handle_type h) : coro_handle(h) {}
-        
-        ~SimpleTask() {
-            if (coro_handle) {
-                coro_handle.destroy();
-            }
-        }
-        
-        SimpleTask(const SimpleTask&) = delete;
-        SimpleTask& operator=(const SimpleTask&) = delete;
-        
-        SimpleTask(SimpleTask&& other) noexcept : coro_handle(other.coro_handle) {
-            other.coro_handle = {};
-        }
-    };
+    // Blocked senders and receivers are resumed through the channel's scheduler
+    using CoroutineRuntime::Channel;
+    using SimpleTask = CoroutineRuntime::Task<void>;
     
     SimpleTask producer(Channel<int>& channel, int start, int count) {
         std::cout << "Producer starting: will produce " << count << " items starting from " << start << "\n";
@@ -552,19 +1385,211 @@ namespace ProducerConsumer {
         std::cout << "Producer finished\n";
     }
     
-    SimpleTask consumer(Channel<int>& channel, const std::string& name, int count) {
+    SimpleTask consumer(Channel<int>& channel, std::string name, int count) {
         std::cout << "Consumer " << name << " starting: will consume " << count << " items\n";
         
         for (int i = 0; i < count; ++i) {
             std::cout << "Consumer " << name << ": waiting for item\n";
-            int value = co_await channel.receive();
-            std::cout << "Consumer " << name << ": received " << value << "\n";
+            auto value = co_await channel.receive();
+            if (!value) break;
+            std::cout << "Consumer " << name << ": received " << *value << "\n";
         }
         
         std::cout << "Consumer " << name << " finished\n";
     }
 }
 
+// Example 5: Scaling the Runtime
+namespace RuntimeWorkloads {
+    using namespace CoroutineRuntime;
+    
+    Task<void> sleeper(Scheduler& scheduler, WaitGroup& group, std::chrono::milliseconds delay,
+                       std::atomic<int64_t>& latenessUs) {
+        auto deadline = Clock::now() + delay;
+        co_await scheduler.sleepFor(delay);
+        auto late = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - deadline);
+        latenessUs.fetch_add(late.count(), std::memory_order_relaxed);
+        group.done();
+    }
+    
+    Task<void> sleepMany(Scheduler& scheduler, int count, std::atomic<int64_t>& latenessUs) {
+        WaitGroup group(scheduler);
+        group.add(count);
+        std::mt19937 rng(58);
+        std::uniform_int_distribution<int> delay(1, 50);
+        for (int i = 0; i < count; ++i) {
+            scheduler.spawn(sleeper(scheduler, group, std::chrono::milliseconds(delay(rng)), latenessUs));
+        }
+        co_await group.wait();
+    }
+    
+    Task<int64_t> immediate(int64_t value) {
+        co_return value;
+    }
+    
+    // Each co_await completes synchronously; without symmetric transfer every
+    // iteration would leave a resume() frame on the stack
+    Task<int64_t> awaitChain(int64_t length) {
+        int64_t sum = 0;
+        for (int64_t i = 0; i < length; ++i) {
+            sum += co_await immediate(i);
+        }
+        co_return sum;
+    }
+    
+    Task<void> produce(Channel<int64_t>& channel, WaitGroup& producers, int64_t first, int64_t count) {
+        for (int64_t i = first; i < first + count; ++i) {
+            co_await channel.send(i);
+        }
+        producers.done();
+    }
+    
+    Task<void> consume(Channel<int64_t>& channel, WaitGroup& consumers, std::atomic<int64_t>& total) {
+        int64_t sum = 0;
+        while (auto value = co_await channel.receive()) {
+            sum += *value;
+        }
+        total.fetch_add(sum);
+        consumers.done();
+    }
+    
+    Task<void> channelPipeline(Scheduler& scheduler, int workers, int64_t perProducer,
+                               std::atomic<int64_t>& total) {
+        Channel<int64_t> channel(scheduler, 64);
+        WaitGroup producers(scheduler);
+        WaitGroup consumers(scheduler);
+        producers.add(workers);
+        consumers.add(workers);
+        for (int i = 0; i < workers; ++i) {
+            scheduler.spawn(produce(channel, producers, i * perProducer, perProducer));
+            scheduler.spawn(consume(channel, consumers, total));
+        }
+        co_await producers.wait();
+        channel.close();
+        co_await consumers.wait();
+    }
+    
+#ifdef CORO_HAVE_EPOLL
+    Task<void> echoServer(Scheduler& scheduler, int fd, WaitGroup& group) {
+        char buffer[4096];
+        while (true) {
+            ssize_t n = co_await asyncRead(scheduler, fd, buffer, sizeof(buffer));
+            if (n <= 0) break;
+            co_await asyncWrite(scheduler, fd, buffer, static_cast<size_t>(n));
+        }
+        ::close(fd);
+        group.done();
+    }
+    
+    Task<void> echoClient(Scheduler& scheduler, int fd, int roundTrips, WaitGroup& group,
+                          std::atomic<int64_t>& echoed) {
+        char message[64];
+        char reply[64];
+        std::memset(message, 'x', sizeof(message));
+        for (int i = 0; i < roundTrips; ++i) {
+            co_await asyncWrite(scheduler, fd, message, sizeof(message));
+            size_t received = 0;
+            while (received < sizeof(reply)) {
+                ssize_t n = co_await asyncRead(scheduler, fd, reply + received, sizeof(reply) - received);
+                if (n <= 0) break;
+                received += static_cast<size_t>(n);
+            }
+            echoed.fetch_add(static_cast<int64_t>(received), std::memory_order_relaxed);
+        }
+        ::shutdown(fd, SHUT_WR);
+        ::close(fd);
+        group.done();
+    }
+    
+    Task<void> echoSessions(Scheduler& scheduler, int connections, int roundTrips, 
+                            std::atomic<int64_t>& echoed) {
+        WaitGroup group(scheduler);
+        for (int i = 0; i < connections; ++i) {
+            int fds[2];
+            if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) != 0) {
+                throw std::runtime_error("echoSessions: socketpair failed");
+            }
+            group.add(2);
+            scheduler.spawn(echoServer(scheduler, fds[0], group));
+            scheduler.spawn(echoClient(scheduler, fds[1], roundTrips, group, echoed));
+        }
+        co_await group.wait();
+    }
+    
+    Task<void> readChunk(Scheduler& scheduler, int fd, off_t offset, size_t length, WaitGroup& group,
+                         std::atomic<uint64_t>& checksum) {
+        std::vector<unsigned char> buffer(length);
+        ssize_t n = co_await asyncReadAt(scheduler, fd, buffer.data(), length, offset);
+        uint64_t sum = 0;
+        for (ssize_t i = 0; i < n; ++i) sum += buffer[static_cast<size_t>(i)];
+        checksum.fetch_add(sum, std::memory_order_relaxed);
+        group.done();
+    }
+    
+    Task<void> readFileParallel(Scheduler& scheduler, int fd, size_t size, size_t chunk,
+                                std::atomic<uint64_t>& checksum) {
+        WaitGroup group(scheduler);
+        for (size_t offset = 0; offset < size; offset += chunk) {
+            group.add(1);
+            scheduler.spawn(readChunk(scheduler, fd, static_cast<off_t>(offset), 
+                                      std::min(chunk, size - offset), group, checksum));
+        }
+        co_await group.wait();
+    }
+    
+    Task<void> duplexReader(Scheduler& scheduler, int fd, WaitGroup& group, std::atomic<bool>& woke) {
+        char byte;
+        ssize_t n = co_await asyncRead(scheduler, fd, &byte, 1);
+        woke.store(n == 1);
+        group.done();
+    }
+    
+    Task<void> duplexWriter(Scheduler& scheduler, int fd, size_t bytes, WaitGroup& group) {
+        std::vector<char> payload(bytes, 'w');
+        co_await asyncWrite(scheduler, fd, payload.data(), payload.size());
+        group.done();
+    }
+    
+    // One socket with a coroutine parked in each direction: the writer is
+    // stuck on a full send buffer when the peer answers the reader. Returns
+    // whether the reader woke while the writer was still waiting.
+    Task<bool> duplexSocket(Scheduler& scheduler) {
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) != 0) {
+            throw std::runtime_error("duplexSocket: socketpair failed");
+        }
+        const size_t bytes = 8 << 20;   // Far more than the socket buffers hold
+        WaitGroup group(scheduler);
+        std::atomic<bool> woke{false};
+        group.add(2);
+        scheduler.spawn(duplexReader(scheduler, fds[0], group, woke));
+        scheduler.spawn(duplexWriter(scheduler, fds[0], bytes, group));
+        co_await scheduler.sleepFor(std::chrono::milliseconds(20));
+        
+        const char reply = 'r';
+        [[maybe_unused]] auto sent = ::write(fds[1], &reply, 1);
+        for (int i = 0; i < 100 && !woke.load(); ++i) {
+            co_await scheduler.sleepFor(std::chrono::milliseconds(10));
+        }
+        const bool readerWoke = woke.load();
+        
+        // Drain the peer so the writer can finish
+        std::vector<char> sink(64 << 10);
+        size_t drained = 0;
+        while (drained < bytes) {
+            ssize_t n = co_await asyncRead(scheduler, fds[1], sink.data(), sink.size());
+            if (n <= 0) break;
+            drained += static_cast<size_t>(n);
+        }
+        co_await group.wait();
+        ::close(fds[0]);
+        ::close(fds[1]);
+        co_return readerWoke && drained == bytes;
+    }
+#endif
+}
+
+
 // Demo functions
 void demonstrateBasicGenerator() {
     using namespace BasicGenerator;
@@ -598,26 +1623,18 @@ void demonstrateAsyncTask() {
     
     std::cout << "\n=== Async Task Coroutines ===\n";
     
+    // Tasks are lazy; blockOn starts one on the pool and waits for it
+    Scheduler scheduler(1);
+    
     // Simple async computation
     std::cout << "\nStarting async computation...\n";
-    auto task1 = computeAsync(7);
-    
-    // Wait for completion (busy wait for demo)
-    while (!task1.is_ready()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-    
-    std::cout << "Async computation result: " << task1.get() << "\n";
+    int result = scheduler.blockOn(computeAsync(7));
+    std::cout << "Async computation result: " << result << "\n";
     
     // Chained async operations
     std::cout << "\nStarting processing chain...\n";
-    auto chain_task = processChainAsync();
-    
-    while (!chain_task.is_ready()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-    
-    std::cout << "Processing chain result: " << chain_task.get() << "\n";
+    int chain_result = scheduler.blockOn(processChainAsync());
+    std::cout << "Processing chain result: " << chain_result << "\n";
 }
 
 void demonstrateStateMachine() {
@@ -647,22 +1664,105 @@ void demonstrateProducerConsumer() {
     
     std::cout << "\n=== Producer-Consumer Coroutines ===\n";
     
-    Channel<int> channel(3); // Buffer size 3
+    // One worker keeps the interleaving below deterministic
+    CoroutineRuntime::Scheduler scheduler(1);
+    Channel<int> channel(scheduler, 3); // Buffer size 3
     
     // Create producer and consumer tasks
-    auto prod_task = producer(channel, 100, 5);
-    auto cons_task1 = consumer(channel, "A", 3);
-    auto cons_task2 = consumer(channel, "B", 2);
+    std::vector<SimpleTask> tasks;
+    tasks.push_back(producer(channel, 100, 5));
+    tasks.push_back(consumer(channel, "A", 3));
+    tasks.push_back(consumer(channel, "B", 2));
     
     std::cout << "\nProducer-Consumer demo started\n";
-    std::cout << "(Note: This is a simplified demo - real implementation would use proper scheduling)\n";
-    
-    // In a real implementation, you'd use a proper coroutine scheduler
-    // This is just for demonstration
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    scheduler.blockOn(CoroutineRuntime::whenAll(scheduler, std::move(tasks)));
     std::cout << "Producer-Consumer demo completed\n";
 }
 
+void demonstrateCoroutineRuntime() {
+    using namespace RuntimeWorkloads;
+    
+    std::cout << "\n=== Coroutine Runtime ===\n";
+    
+    Scheduler scheduler;
+    std::cout << "Scheduler: " << scheduler.size() << " work-stealing workers + 1 reactor thread\n";
+    
+    // Thousands of concurrent sleeps on the timer wheel
+    const int sleepers = 10000;
+    std::atomic<int64_t> latenessUs{0};
+    auto start = Clock::now();
+    scheduler.blockOn(sleepMany(scheduler, sleepers, latenessUs));
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::cout << sleepers << " coroutines slept 1-50 ms each: done in " << std::fixed << std::setprecision(1) 
+              << ms << " ms, mean lateness " << latenessUs.load() / 1000.0 / sleepers << " ms\n";
+    std::cout << "(a thread per sleep would have meant " << sleepers << " threads)\n";
+    
+    // Symmetric transfer keeps synchronous await chains at constant depth
+    const int64_t chainLength = 1'000'000;
+    start = Clock::now();
+    int64_t chainSum = scheduler.blockOn(awaitChain(chainLength));
+    ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::cout << chainLength << " chained co_awaits: sum " << chainSum << " ("
+              << (chainSum == chainLength * (chainLength - 1) / 2 ? "correct" : "WRONG") << ") in " 
+              << ms << " ms\n";
+    
+    // Channel resumes blocked peers through the scheduler
+    const int channelWorkers = 4;
+    const int64_t perProducer = 25000;
+    std::atomic<int64_t> channelTotal{0};
+    start = Clock::now();
+    scheduler.blockOn(channelPipeline(scheduler, channelWorkers, perProducer, channelTotal));
+    ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    int64_t items = channelWorkers * perProducer;
+    std::cout << channelWorkers << " producers -> " << channelWorkers << " consumers, " << items 
+              << " items through a 64-slot channel in " << ms << " ms, sum " 
+              << (channelTotal.load() == items * (items - 1) / 2 ? "matches" : "MISMATCH") << "\n";
+    
+#ifdef CORO_HAVE_EPOLL
+    // Socket I/O through epoll readiness
+    const int connections = 64;
+    const int roundTrips = 200;
+    std::atomic<int64_t> echoed{0};
+    start = Clock::now();
+    scheduler.blockOn(echoSessions(scheduler, connections, roundTrips, echoed));
+    ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::cout << connections << " socket pairs x " << roundTrips << " echo round trips: " << echoed.load() 
+              << " bytes echoed in " << ms << " ms\n";
+    
+    // A reader and a blocked writer on one socket both get woken
+    std::cout << "Full-duplex socket, reader answered while writer blocked: " 
+              << (scheduler.blockOn(duplexSocket(scheduler)) ? "both completed" : "READER STALLED") << "\n";
+    
+    // File reads fanned out across coroutines
+    const size_t fileSize = 4 << 20;
+    const size_t chunk = 64 << 10;
+    std::FILE* file = std::tmpfile();
+    std::vector<unsigned char> contents(fileSize);
+    uint64_t expected = 0;
+    for (size_t i = 0; i < fileSize; ++i) {
+        contents[i] = static_cast<unsigned char>(i * 31);
+        expected += contents[i];
+    }
+    std::fwrite(contents.data(), 1, fileSize, file);
+    std::fflush(file);
+    std::atomic<uint64_t> checksum{0};
+    start = Clock::now();
+    scheduler.blockOn(readFileParallel(scheduler, ::fileno(file), fileSize, chunk, checksum));
+    ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::fclose(file);
+    std::cout << "Read " << (fileSize >> 20) << " MiB file as " << fileSize / chunk << " concurrent chunks in " 
+              << ms << " ms, checksum " << (checksum.load() == expected ? "matches" : "MISMATCH") << "\n";
+#else
+    std::cout << "epoll unavailable: socket and file awaitables disabled\n";
+#endif
+    
+    std::cout << "Coroutine frames: " << FramePool::cachedAllocations() << " reused from thread caches, "
+              << FramePool::heapAllocations() << " from the heap\n";
+    std::cout << "Handles stolen between workers: " << scheduler.stolen() << "\n";
+    std::cout.unsetf(std::ios::fixed);
+    std::cout << std::setprecision(6);
+}
+
 int main() {
     std::cout << "=== Coroutines Pattern Demo (C++20) ===\n\n";
     
@@ -670,6 +1770,7 @@ int main() {
     demonstrateAsyncTask();
     demonstrateStateMachine();
     demonstrateProducerConsumer();
+    demonstrateCoroutineRuntime();
     
     std::cout << "\n=== Coroutines Benefits ===\n";
     std::cout << "1. Simplified asynchronous programming\n";
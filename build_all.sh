@@ -65,6 +65,28 @@ for dir in [0-9][0-9]-*/; do
     fi
 done
 
+# Device backend variants of 03-abstract-factory, when a toolchain is present
+if command -v nvcc &> /dev/null; then
+    echo -e "\nBuilding ${YELLOW}03-abstract-factory (CUDA)${NC}..."
+    if nvcc -std=c++14 -O2 -x cu -DDEVICE_BACKEND_CUDA 03-abstract-factory/abstract_factory.cpp -o build/03-abstract-factory-cuda; then
+        echo -e "${GREEN}[OK]${NC} 03-abstract-factory-cuda built successfully"
+        ((success++))
+    else
+        echo -e "${RED}[FAILED]${NC} 03-abstract-factory-cuda build failed"
+        ((failed++))
+    fi
+fi
+if command -v icpx &> /dev/null; then
+    echo -e "\nBuilding ${YELLOW}03-abstract-factory (SYCL)${NC}..."
+    if icpx -fsycl -std=c++17 -O2 -DDEVICE_BACKEND_SYCL 03-abstract-factory/abstract_factory.cpp -o build/03-abstract-factory-sycl; then
+        echo -e "${GREEN}[OK]${NC} 03-abstract-factory-sycl built successfully"
+        ((success++))
+    else
+        echo -e "${RED}[FAILED]${NC} 03-abstract-factory-sycl build failed"
+        ((failed++))
+    fi
+fi
+
 echo
 echo "====================================="
 echo "Build Summary:"